@@ -0,0 +1,5339 @@
+#pragma once
+
+/**
+ * Embedded Alpha Maps
+ *
+ * Generated by tools/gen_alpha_maps.py from embedded_assets.hpp. Do not edit.
+ *
+ * The alpha maps are calculate_alpha_map() of the embedded captures
+ * (row-major CV_32FC1); the blend factors are the per-pixel Q16 scale and
+ * offset make_blend_table() derives from them for a white logo.
+ */
+
+#include <cstddef>
+#include <cstdint>
+
+namespace gwt {
+namespace embedded {
+
+// Logo value the blend factors were computed for
+inline constexpr float alpha_maps_logo_value = 255.0f;
+
+// alpha_map_48 (48x48)
+inline constexpr int alpha_map_48_size = 48;
+
+alignas(64) inline constexpr float alpha_map_48[48 * 48] = {
+    0.00784313772f, 0.00392156886f, 0.00392156886f, 0.0f, 0.0f, 0.0f, 0.0f, 0.00392156886f,
+    0.0f, 0.0f, 0.0f, 0.0f, 0.00392156886f, 0.00392156886f, 0.0f, 0.0f,
+    0.00392156886f, 0.00392156886f, 0.00392156886f, 0.0f, 0.0f, 0.00392156886f, 0.0f, 0.443137288f,
+    0.43921572f, 0.00392156886f, 0.00392156886f, 0.00392156886f, 0.00392156886f, 0.00392156886f, 0.00784313772f, 0.00392156886f,
+    0.00392156886f, 0.00784313772f, 0.00392156886f, 0.00392156886f, 0.00784313772f, 0.011764707f, 0.00392156886f, 0.00392156886f,
+    0.00392156886f, 0.00392156886f, 0.00784313772f, 0.00392156886f, 0.011764707f, 0.00784313772f, 0.00392156886f, 0.00392156886f,
+    0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.00392156886f, 0.00392156886f,
+    0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.00392156886f, 0.00392156886f, 0.00392156886f,
+    0.0f, 0.0f, 0.0f, 0.00392156886f, 0.0f, 0.00392156886f, 0.129411772f, 0.501960814f,
+    0.501960814f, 0.125490203f, 0.0f, 0.00784313772f, 0.0f, 0.00392156886f, 0.00392156886f, 0.00392156886f,
+    0.00392156886f, 0.00392156886f, 0.00392156886f, 0.00784313772f, 0.00784313772f, 0.00784313772f, 0.00392156886f, 0.00392156886f,
+    0.00392156886f, 0.00392156886f, 0.00392156886f, 0.00784313772f, 0.00784313772f, 0.011764707f, 0.00392156886f, 0.00392156886f,
+    0.00392156886f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.00392156886f,
+    0.0f, 0.00392156886f, 0.00784313772f, 0.00784313772f, 0.00392156886f, 0.0f, 0.0f, 0.00784313772f,
+    0.00392156886f, 0.0f, 0.0f, 0.00392156886f, 0.0f, 0.00392156886f, 0.282352954f, 0.501960814f,
+    0.501960814f, 0.282352954f, 0.0f, 0.00392156886f, 0.0f, 0.00392156886f, 0.00392156886f, 0.00392156886f,
+    0.00784313772f, 0.00784313772f, 0.0f, 0.00784313772f, 0.011764707f, 0.011764707f, 0.00392156886f, 0.00392156886f,
+    0.00784313772f, 0.00784313772f, 0.00784313772f, 0.011764707f, 0.00392156886f, 0.00392156886f, 0.00392156886f, 0.00392156886f,
+    0.00392156886f, 0.00784313772f, 0.0f, 0.0f, 0.00392156886f, 0.0f, 0.0f, 0.00392156886f,
+    0.0f, 0.00392156886f, 0.00392156886f, 0.00392156886f, 0.00392156886f, 0.00392156886f, 0.00392156886f, 0.00392156886f,
+    0.00392156886f, 0.00784313772f, 0.00392156886f, 0.00392156886f, 0.0f, 0.00392156886f, 0.43921572f, 0.501960814f,
+    0.501960814f, 0.470588267f, 0.0f, 0.00392156886f, 0.00392156886f, 0.00392156886f, 0.00784313772f, 0.00392156886f,
+    0.00784313772f, 0.011764707f, 0.00392156886f, 0.00392156886f, 0.00784313772f, 0.00784313772f, 0.00392156886f, 0.00392156886f,
+    0.00784313772f, 0.00784313772f, 0.00784313772f, 0.00392156886f, 0.00392156886f, 0.00392156886f, 0.00784313772f, 0.00784313772f,
+    0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.00392156886f,
+    0.0f, 0.0f, 0.00392156886f, 0.00392156886f, 0.0f, 0.0f, 0.00392156886f, 0.0f,
+    0.0f, 0.0f, 0.0f, 0.00392156886f, 0.0f, 0.125490203f, 0.501960814f, 0.501960814f,
+    0.501960814f, 0.501960814f, 0.125490203f, 0.0f, 0.0f, 0.00392156886f, 0.00784313772f, 0.0f,
+    0.00784313772f, 0.00784313772f, 0.00392156886f, 0.00392156886f, 0.00392156886f, 0.0f, 0.011764707f, 0.011764707f,
+    0.00784313772f, 0.00784313772f, 0.00392156886f, 0.00392156886f, 0.00392156886f, 0.00392156886f, 0.00392156886f, 0.00392156886f,
+    0.0f, 0.00784313772f, 0.0f, 0.0f, 0.00392156886f, 0.0f, 0.00392156886f, 0.00392156886f,
+    0.00392156886f, 0.00392156886f, 0.0f, 0.0f, 0.00392156886f, 0.0f, 0.0f, 0.0f,
+    0.0f, 0.00392156886f, 0.0f, 0.0f, 0.00392156886f, 0.313725501f, 0.501960814f, 0.501960814f,
+    0.501960814f, 0.501960814f, 0.376470625f, 0.0f, 0.0f, 0.00392156886f, 0.0f, 0.00392156886f,
+    0.00784313772f, 0.00784313772f, 0.0f, 0.00392156886f, 0.00392156886f, 0.00392156886f, 0.00784313772f, 0.011764707f,
+    0.011764707f, 0.011764707f, 0.00392156886f, 0.00392156886f, 0.0f, 0.0f, 0.00392156886f, 0.00392156886f,
+    0.00392156886f, 0.0f, 0.0f, 0.0f, 0.00392156886f, 0.0f, 0.011764707f, 0.00392156886f,
+    0.00392156886f, 0.00392156886f, 0.0f, 0.0f, 0.00392156886f, 0.00392156886f, 0.00392156886f, 0.00784313772f,
+    0.00784313772f, 0.0f, 0.0f, 0.00784313772f, 0.0666666701f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.501960814f, 0.501960814f, 0.501960814f, 0.0627451017f, 0.0f, 0.00392156886f, 0.0f, 0.0f,
+    0.0f, 0.00392156886f, 0.00784313772f, 0.00784313772f, 0.00392156886f, 0.00392156886f, 0.00392156886f, 0.00392156886f,
+    0.00392156886f, 0.00392156886f, 0.00392156886f, 0.00392156886f, 0.00392156886f, 0.00392156886f, 0.00392156886f, 0.00392156886f,
+    0.0f, 0.0f, 0.0f, 0.0f, 0.00784313772f, 0.0f, 0.00392156886f, 0.00784313772f,
+    0.00392156886f, 0.00392156886f, 0.0f, 0.0f, 0.00392156886f, 0.011764707f, 0.00392156886f, 0.00392156886f,
+    0.00392156886f, 0.0f, 0.00392156886f, 0.00392156886f, 0.313725501f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.501960814f, 0.501960814f, 0.501960814f, 0.31764707f, 0.00392156886f, 0.00784313772f, 0.0f, 0.00392156886f,
+    0.00392156886f, 0.00392156886f, 0.011764707f, 0.00784313772f, 0.00392156886f, 0.00392156886f, 0.00784313772f, 0.00784313772f,
+    0.00392156886f, 0.00392156886f, 0.00392156886f, 0.00392156886f, 0.00392156886f, 0.00392156886f, 0.00392156886f, 0.00392156886f,
+    0.00784313772f, 0.0f, 0.0f, 0.00392156886f, 0.00784313772f, 0.00392156886f, 0.00784313772f, 0.00392156886f,
+    0.00392156886f, 0.00784313772f, 0.00784313772f, 0.00392156886f, 0.00392156886f, 0.00392156886f, 0.00784313772f, 0.00392156886f,
+    0.00784313772f, 0.00784313772f, 0.00392156886f, 0.0666666701f, 0.501960814f, 0.501960814f, 0.501960814f, 0.505882382f,
+    0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.125490203f, 0.00784313772f, 0.00392156886f, 0.00784313772f,
+    0.0f, 0.00392156886f, 0.00784313772f, 0.00392156886f, 0.011764707f, 0.00784313772f, 0.00784313772f, 0.011764707f,
+    0.011764707f, 0.011764707f, 0.00784313772f, 0.00784313772f, 0.00392156886f, 0.00392156886f, 0.00784313772f, 0.00784313772f,
+    0.00392156886f, 0.0f, 0.0f, 0.00392156886f, 0.00392156886f, 0.00392156886f, 0.0f, 0.00784313772f,
+    0.00392156886f, 0.0f, 0.00392156886f, 0.00392156886f, 0.0f, 0.00392156886f, 0.0f, 0.00392156886f,
+    0.0f, 0.00392156886f, 0.00392156886f, 0.43921572f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.376470625f, 0.00392156886f, 0.00392156886f, 0.00392156886f,
+    0.00392156886f, 0.00392156886f, 0.00392156886f, 0.00392156886f, 0.00392156886f, 0.00392156886f, 0.011764707f, 0.011764707f,
+    0.011764707f, 0.00784313772f, 0.011764707f, 0.00784313772f, 0.00392156886f, 0.00392156886f, 0.00784313772f, 0.00784313772f,
+    0.00784313772f, 0.00392156886f, 0.0f, 0.0f, 0.00392156886f, 0.00784313772f, 0.0f, 0.00392156886f,
+    0.00392156886f, 0.0f, 0.0f, 0.0f, 0.00784313772f, 0.00392156886f, 0.00392156886f, 0.00784313772f,
+    0.0f, 0.00392156886f, 0.250980407f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.21960786f, 0.0f, 0.0f,
+    0.00784313772f, 0.00784313772f, 0.011764707f, 0.00392156886f, 0.00784313772f, 0.00784313772f, 0.00392156886f, 0.00784313772f,
+    0.00784313772f, 0.00784313772f, 0.00392156886f, 0.00392156886f, 0.00784313772f, 0.00784313772f, 0.00392156886f, 0.00392156886f,
+    0.0f, 0.0f, 0.00392156886f, 0.0f, 0.0f, 0.00392156886f, 0.00392156886f, 0.011764707f,
+    0.0f, 0.00392156886f, 0.00784313772f, 0.0f, 0.00784313772f, 0.0f, 0.00784313772f, 0.00392156886f,
+    0.0f, 0.0627451017f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.470588267f, 0.0941176564f, 0.00392156886f,
+    0.00784313772f, 0.011764707f, 0.00784313772f, 0.00784313772f, 0.00784313772f, 0.00784313772f, 0.0f, 0.00392156886f,
+    0.00392156886f, 0.00392156886f, 0.00392156886f, 0.00784313772f, 0.00784313772f, 0.00784313772f, 0.00392156886f, 0.00392156886f,
+    0.00392156886f, 0.0f, 0.00392156886f, 0.00392156886f, 0.0f, 0.0f, 0.0f, 0.00392156886f,
+    0.0f, 0.00392156886f, 0.00392156886f, 0.00392156886f, 0.0f, 0.011764707f, 0.00784313772f, 0.00392156886f,
+    0.0627451017f, 0.43921572f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.43921572f, 0.0313725509f,
+    0.00392156886f, 0.00392156886f, 0.0f, 0.00392156886f, 0.00392156886f, 0.00392156886f, 0.00784313772f, 0.00784313772f,
+    0.00392156886f, 0.00392156886f, 0.00784313772f, 0.00784313772f, 0.00784313772f, 0.00784313772f, 0.00392156886f, 0.00784313772f,
+    0.00392156886f, 0.0f, 0.00392156886f, 0.0f, 0.0f, 0.00392156886f, 0.0f, 0.00392156886f,
+    0.0f, 0.00392156886f, 0.0f, 0.00392156886f, 0.00392156886f, 0.00392156886f, 0.00392156886f, 0.00392156886f,
+    0.411764741f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.376470625f,
+    0.00784313772f, 0.00392156886f, 0.00392156886f, 0.00392156886f, 0.00392156886f, 0.00392156886f, 0.00784313772f, 0.00784313772f,
+    0.00392156886f, 0.00392156886f, 0.00784313772f, 0.00784313772f, 0.00784313772f, 0.00784313772f, 0.00392156886f, 0.00784313772f,
+    0.00392156886f, 0.00392156886f, 0.00392156886f, 0.0f, 0.0f, 0.00392156886f, 0.0f, 0.0f,
+    0.0f, 0.0f, 0.00392156886f, 0.0f, 0.00784313772f, 0.00392156886f, 0.00392156886f, 0.31764707f,
+    0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.313725501f, 0.00392156886f, 0.0f, 0.00392156886f, 0.00392156886f, 0.00392156886f, 0.011764707f, 0.00392156886f,
+    0.00392156886f, 0.00392156886f, 0.00392156886f, 0.00784313772f, 0.00784313772f, 0.00784313772f, 0.00392156886f, 0.00392156886f,
+    0.0f, 0.0f, 0.0f, 0.00392156886f, 0.00392156886f, 0.0f, 0.0f, 0.00392156886f,
+    0.0f, 0.00392156886f, 0.0f, 0.0f, 0.00392156886f, 0.00392156886f, 0.313725501f, 0.501960814f,
+    0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.501960814f, 0.313725501f, 0.0f, 0.00392156886f, 0.00392156886f, 0.00392156886f, 0.011764707f, 0.00392156886f,
+    0.00392156886f, 0.00392156886f, 0.00392156886f, 0.00392156886f, 0.00784313772f, 0.00784313772f, 0.00392156886f, 0.00392156886f,
+    0.0f, 0.00784313772f, 0.0f, 0.00392156886f, 0.00392156886f, 0.0f, 0.0f, 0.00392156886f,
+    0.0f, 0.0f, 0.0f, 0.00392156886f, 0.0313725509f, 0.376470625f, 0.501960814f, 0.501960814f,
+    0.501960814f, 0.501960814f, 0.505882382f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.501960814f, 0.501960814f, 0.407843173f, 0.0627451017f, 0.00784313772f, 0.00784313772f, 0.00392156886f, 0.00392156886f,
+    0.00392156886f, 0.00392156886f, 0.011764707f, 0.0156862754f, 0.011764707f, 0.00784313772f, 0.0f, 0.00392156886f,
+    0.00392156886f, 0.0f, 0.00392156886f, 0.00392156886f, 0.0f, 0.00392156886f, 0.00392156886f, 0.00392156886f,
+    0.00392156886f, 0.0f, 0.0f, 0.0941176564f, 0.43921572f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.501960814f, 0.501960814f, 0.505882382f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.501960814f, 0.501960814f, 0.501960814f, 0.43921572f, 0.0666666701f, 0.0156862754f, 0.00784313772f, 0.00392156886f,
+    0.00392156886f, 0.00392156886f, 0.00784313772f, 0.00392156886f, 0.00784313772f, 0.00784313772f, 0.00392156886f, 0.00392156886f,
+    0.00392156886f, 0.0f, 0.0f, 0.00392156886f, 0.00392156886f, 0.0f, 0.0f, 0.00392156886f,
+    0.0f, 0.0f, 0.21960786f, 0.470588267f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.258823544f, 0.00392156886f, 0.00392156886f,
+    0.00784313772f, 0.011764707f, 0.00784313772f, 0.011764707f, 0.011764707f, 0.00392156886f, 0.00392156886f, 0.0f,
+    0.00784313772f, 0.00392156886f, 0.0f, 0.00392156886f, 0.0f, 0.0f, 0.00784313772f, 0.00392156886f,
+    0.125490203f, 0.376470625f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.43921572f, 0.0627451017f,
+    0.00784313772f, 0.011764707f, 0.00784313772f, 0.00784313772f, 0.00784313772f, 0.00784313772f, 0.00392156886f, 0.00392156886f,
+    0.0f, 0.00392156886f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0627451017f, 0.31764707f,
+    0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.505882382f, 0.501960814f,
+    0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.313725501f, 0.0627451017f, 0.00784313772f, 0.00392156886f, 0.00784313772f, 0.00784313772f, 0.00392156886f, 0.00392156886f,
+    0.0f, 0.00392156886f, 0.0f, 0.00392156886f, 0.129411772f, 0.376470625f, 0.501960814f, 0.501960814f,
+    0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.505882382f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.501960814f, 0.501960814f, 0.313725501f, 0.125490203f, 0.00392156886f, 0.00784313772f, 0.00392156886f, 0.00392156886f,
+    0.0f, 0.125490203f, 0.282352954f, 0.470588267f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.43921572f, 0.282352954f, 0.125490203f, 0.0156862754f,
+    0.43921572f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.443137288f,
+    0.43921572f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.43921572f,
+    0.00392156886f, 0.125490203f, 0.282352954f, 0.43921572f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.470588267f, 0.282352954f, 0.125490203f, 0.00392156886f,
+    0.00392156886f, 0.011764707f, 0.0f, 0.00392156886f, 0.125490203f, 0.313725501f, 0.501960814f, 0.501960814f,
+    0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.501960814f, 0.501960814f, 0.376470625f, 0.125490203f, 0.00784313772f, 0.00784313772f, 0.00392156886f, 0.00392156886f,
+    0.0f, 0.00392156886f, 0.00392156886f, 0.0f, 0.0f, 0.00784313772f, 0.0627451017f, 0.31764707f,
+    0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.505882382f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.501960814f, 0.505882382f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.31764707f, 0.0666666701f, 0.00392156886f, 0.00392156886f, 0.00784313772f, 0.00784313772f, 0.00392156886f, 0.00392156886f,
+    0.00392156886f, 0.00784313772f, 0.00392156886f, 0.00392156886f, 0.0f, 0.0f, 0.00392156886f, 0.00784313772f,
+    0.0627451017f, 0.43921572f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.376470625f, 0.125490203f,
+    0.00392156886f, 0.00392156886f, 0.00392156886f, 0.00392156886f, 0.00392156886f, 0.00392156886f, 0.00392156886f, 0.00392156886f,
+    0.00392156886f, 0.00392156886f, 0.00392156886f, 0.00392156886f, 0.0f, 0.0f, 0.0f, 0.00392156886f,
+    0.0f, 0.00392156886f, 0.250980407f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.474509835f, 0.223529428f, 0.00392156886f, 0.00392156886f,
+    0.00392156886f, 0.00392156886f, 0.00392156886f, 0.00392156886f, 0.00392156886f, 0.00392156886f, 0.00392156886f, 0.00392156886f,
+    0.00392156886f, 0.00392156886f, 0.0f, 0.00392156886f, 0.0f, 0.00392156886f, 0.0f, 0.0f,
+    0.0f, 0.00784313772f, 0.0f, 0.0627451017f, 0.443137288f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.505882382f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.501960814f, 0.501960814f, 0.501960814f, 0.43921572f, 0.0941176564f, 0.00392156886f, 0.00392156886f, 0.00392156886f,
+    0.00784313772f, 0.00784313772f, 0.00392156886f, 0.00392156886f, 0.00784313772f, 0.00784313772f, 0.00392156886f, 0.00392156886f,
+    0.00392156886f, 0.00392156886f, 0.0f, 0.00392156886f, 0.0f, 0.00392156886f, 0.0f, 0.00392156886f,
+    0.0f, 0.0f, 0.0f, 0.0f, 0.0627451017f, 0.407843173f, 0.501960814f, 0.501960814f,
+    0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.501960814f, 0.501960814f, 0.376470625f, 0.0313725509f, 0.00392156886f, 0.00392156886f, 0.00392156886f, 0.00392156886f,
+    0.00784313772f, 0.00784313772f, 0.00392156886f, 0.00392156886f, 0.00784313772f, 0.00784313772f, 0.00392156886f, 0.00392156886f,
+    0.00392156886f, 0.00392156886f, 0.00392156886f, 0.00392156886f, 0.00784313772f, 0.00392156886f, 0.00392156886f, 0.00392156886f,
+    0.0f, 0.0f, 0.0f, 0.0f, 0.00392156886f, 0.00392156886f, 0.313725501f, 0.501960814f,
+    0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.505882382f, 0.501960814f, 0.501960814f,
+    0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.505882382f, 0.505882382f, 0.501960814f, 0.501960814f,
+    0.501960814f, 0.313725501f, 0.011764707f, 0.011764707f, 0.00784313772f, 0.00392156886f, 0.00784313772f, 0.00784313772f,
+    0.00392156886f, 0.00392156886f, 0.011764707f, 0.011764707f, 0.00784313772f, 0.00784313772f, 0.00392156886f, 0.0f,
+    0.00392156886f, 0.00392156886f, 0.0f, 0.00392156886f, 0.00392156886f, 0.00392156886f, 0.00392156886f, 0.0f,
+    0.0f, 0.0f, 0.0f, 0.00392156886f, 0.00392156886f, 0.00784313772f, 0.00392156886f, 0.313725501f,
+    0.501960814f, 0.501960814f, 0.505882382f, 0.501960814f, 0.501960814f, 0.505882382f, 0.501960814f, 0.501960814f,
+    0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.505882382f, 0.505882382f, 0.501960814f, 0.501960814f,
+    0.313725501f, 0.00392156886f, 0.0156862754f, 0.0156862754f, 0.00784313772f, 0.00784313772f, 0.00784313772f, 0.00784313772f,
+    0.00392156886f, 0.00392156886f, 0.011764707f, 0.011764707f, 0.00392156886f, 0.00784313772f, 0.00392156886f, 0.00392156886f,
+    0.00392156886f, 0.00392156886f, 0.00784313772f, 0.00784313772f, 0.00392156886f, 0.00784313772f, 0.011764707f, 0.011764707f,
+    0.00784313772f, 0.00784313772f, 0.00784313772f, 0.00784313772f, 0.00392156886f, 0.00392156886f, 0.00392156886f, 0.00392156886f,
+    0.380392194f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.407843173f,
+    0.00784313772f, 0.00784313772f, 0.011764707f, 0.011764707f, 0.00392156886f, 0.0f, 0.00392156886f, 0.00784313772f,
+    0.00784313772f, 0.00784313772f, 0.011764707f, 0.011764707f, 0.00392156886f, 0.00392156886f, 0.011764707f, 0.011764707f,
+    0.00392156886f, 0.00392156886f, 0.00784313772f, 0.00784313772f, 0.00392156886f, 0.00392156886f, 0.0156862754f, 0.011764707f,
+    0.00784313772f, 0.011764707f, 0.00784313772f, 0.011764707f, 0.00392156886f, 0.00392156886f, 0.00392156886f, 0.00392156886f,
+    0.0392156877f, 0.443137288f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.505882382f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.43921572f, 0.0627451017f,
+    0.00784313772f, 0.011764707f, 0.011764707f, 0.011764707f, 0.00392156886f, 0.00392156886f, 0.00392156886f, 0.00784313772f,
+    0.00784313772f, 0.00784313772f, 0.0156862754f, 0.011764707f, 0.0f, 0.00392156886f, 0.011764707f, 0.011764707f,
+    0.00784313772f, 0.00784313772f, 0.00784313772f, 0.00392156886f, 0.00784313772f, 0.00784313772f, 0.0f, 0.0f,
+    0.00784313772f, 0.011764707f, 0.00784313772f, 0.011764707f, 0.00784313772f, 0.00784313772f, 0.0f, 0.00392156886f,
+    0.00784313772f, 0.0980392247f, 0.470588267f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.0627451017f, 0.0f,
+    0.00784313772f, 0.00784313772f, 0.0f, 0.0f, 0.00392156886f, 0.00392156886f, 0.00784313772f, 0.011764707f,
+    0.00784313772f, 0.00392156886f, 0.0f, 0.0f, 0.00392156886f, 0.00392156886f, 0.00392156886f, 0.00392156886f,
+    0.00784313772f, 0.00784313772f, 0.00784313772f, 0.00784313772f, 0.011764707f, 0.00784313772f, 0.00392156886f, 0.00392156886f,
+    0.00784313772f, 0.00784313772f, 0.00784313772f, 0.00784313772f, 0.00784313772f, 0.00784313772f, 0.00392156886f, 0.00392156886f,
+    0.00784313772f, 0.00784313772f, 0.21960786f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.250980407f, 0.00392156886f, 0.00392156886f,
+    0.011764707f, 0.00784313772f, 0.00392156886f, 0.0f, 0.00392156886f, 0.00392156886f, 0.011764707f, 0.011764707f,
+    0.00392156886f, 0.00784313772f, 0.00392156886f, 0.0f, 0.0f, 0.0f, 0.00392156886f, 0.00392156886f,
+    0.00784313772f, 0.00392156886f, 0.00392156886f, 0.00392156886f, 0.00392156886f, 0.00392156886f, 0.00392156886f, 0.00392156886f,
+    0.00392156886f, 0.00392156886f, 0.00392156886f, 0.00392156886f, 0.0f, 0.00392156886f, 0.00784313772f, 0.00784313772f,
+    0.00784313772f, 0.00784313772f, 0.0f, 0.376470625f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.43921572f, 0.00392156886f, 0.00392156886f, 0.00392156886f,
+    0.00784313772f, 0.00784313772f, 0.0f, 0.00784313772f, 0.00392156886f, 0.00392156886f, 0.00784313772f, 0.00392156886f,
+    0.00392156886f, 0.0f, 0.00392156886f, 0.0f, 0.0f, 0.00392156886f, 0.00392156886f, 0.00392156886f,
+    0.00784313772f, 0.00784313772f, 0.00392156886f, 0.00392156886f, 0.00392156886f, 0.00392156886f, 0.00392156886f, 0.00392156886f,
+    0.00392156886f, 0.00392156886f, 0.00392156886f, 0.00392156886f, 0.00392156886f, 0.00392156886f, 0.00784313772f, 0.00784313772f,
+    0.011764707f, 0.00784313772f, 0.00392156886f, 0.125490203f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.0627451017f, 0.00392156886f, 0.00392156886f, 0.0f,
+    0.00784313772f, 0.00784313772f, 0.00392156886f, 0.00784313772f, 0.00392156886f, 0.00392156886f, 0.00392156886f, 0.00392156886f,
+    0.00392156886f, 0.00784313772f, 0.00392156886f, 0.00392156886f, 0.00392156886f, 0.00392156886f, 0.00392156886f, 0.00392156886f,
+    0.00392156886f, 0.00392156886f, 0.00392156886f, 0.00392156886f, 0.00392156886f, 0.00392156886f, 0.00392156886f, 0.00392156886f,
+    0.00784313772f, 0.00784313772f, 0.0f, 0.0f, 0.00392156886f, 0.0f, 0.00784313772f, 0.00784313772f,
+    0.00784313772f, 0.00392156886f, 0.00392156886f, 0.0f, 0.313725501f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.501960814f, 0.501960814f, 0.501960814f, 0.313725501f, 0.00392156886f, 0.00392156886f, 0.00392156886f, 0.00392156886f,
+    0.00784313772f, 0.011764707f, 0.0f, 0.00392156886f, 0.00392156886f, 0.00392156886f, 0.00392156886f, 0.00392156886f,
+    0.00392156886f, 0.00392156886f, 0.00784313772f, 0.00784313772f, 0.00392156886f, 0.00392156886f, 0.00392156886f, 0.00392156886f,
+    0.00392156886f, 0.00392156886f, 0.00392156886f, 0.00392156886f, 0.00392156886f, 0.00392156886f, 0.00392156886f, 0.00392156886f,
+    0.00784313772f, 0.00784313772f, 0.0f, 0.00392156886f, 0.00392156886f, 0.00784313772f, 0.00784313772f, 0.00784313772f,
+    0.00392156886f, 0.00392156886f, 0.0f, 0.00392156886f, 0.0627451017f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.501960814f, 0.501960814f, 0.501960814f, 0.0627451017f, 0.00392156886f, 0.00392156886f, 0.00392156886f, 0.00392156886f,
+    0.00784313772f, 0.00784313772f, 0.00784313772f, 0.00392156886f, 0.00392156886f, 0.00392156886f, 0.00392156886f, 0.00392156886f,
+    0.00392156886f, 0.00392156886f, 0.00784313772f, 0.00784313772f, 0.00392156886f, 0.00392156886f, 0.00392156886f, 0.00392156886f,
+    0.00784313772f, 0.00784313772f, 0.00784313772f, 0.00784313772f, 0.00784313772f, 0.00784313772f, 0.00392156886f, 0.00392156886f,
+    0.00392156886f, 0.00784313772f, 0.00392156886f, 0.00392156886f, 0.00392156886f, 0.00784313772f, 0.00784313772f, 0.00392156886f,
+    0.00392156886f, 0.00392156886f, 0.00392156886f, 0.00392156886f, 0.0f, 0.380392194f, 0.505882382f, 0.505882382f,
+    0.501960814f, 0.501960814f, 0.313725501f, 0.00392156886f, 0.00784313772f, 0.00784313772f, 0.00784313772f, 0.00392156886f,
+    0.00392156886f, 0.00392156886f, 0.00392156886f, 0.00392156886f, 0.00784313772f, 0.00784313772f, 0.00392156886f, 0.00392156886f,
+    0.00392156886f, 0.00392156886f, 0.00392156886f, 0.00392156886f, 0.00784313772f, 0.00784313772f, 0.00392156886f, 0.00392156886f,
+    0.00784313772f, 0.00784313772f, 0.00784313772f, 0.00784313772f, 0.00784313772f, 0.00784313772f, 0.00392156886f, 0.00392156886f,
+    0.00392156886f, 0.00392156886f, 0.00392156886f, 0.0f, 0.00784313772f, 0.00784313772f, 0.00392156886f, 0.0f,
+    0.00392156886f, 0.00392156886f, 0.00784313772f, 0.011764707f, 0.00392156886f, 0.125490203f, 0.505882382f, 0.501960814f,
+    0.501960814f, 0.501960814f, 0.125490203f, 0.00392156886f, 0.00784313772f, 0.00784313772f, 0.0f, 0.00392156886f,
+    0.00392156886f, 0.00392156886f, 0.00392156886f, 0.00392156886f, 0.00784313772f, 0.00784313772f, 0.00392156886f, 0.00392156886f,
+    0.00392156886f, 0.00392156886f, 0.00392156886f, 0.00392156886f, 0.00784313772f, 0.00784313772f, 0.00392156886f, 0.00392156886f,
+    0.00784313772f, 0.00784313772f, 0.00784313772f, 0.00784313772f, 0.00392156886f, 0.00392156886f, 0.00784313772f, 0.00392156886f,
+    0.00392156886f, 0.00392156886f, 0.00392156886f, 0.00392156886f, 0.00784313772f, 0.00784313772f, 0.00784313772f, 0.00784313772f,
+    0.0f, 0.0f, 0.00784313772f, 0.00784313772f, 0.00392156886f, 0.00392156886f, 0.474509835f, 0.501960814f,
+    0.501960814f, 0.43921572f, 0.00392156886f, 0.00392156886f, 0.00784313772f, 0.011764707f, 0.00392156886f, 0.00392156886f,
+    0.00784313772f, 0.00784313772f, 0.0f, 0.0f, 0.00392156886f, 0.00392156886f, 0.00392156886f, 0.00392156886f,
+    0.00392156886f, 0.00392156886f, 0.00392156886f, 0.00392156886f, 0.00784313772f, 0.00784313772f, 0.00392156886f, 0.00392156886f,
+    0.00784313772f, 0.00784313772f, 0.00784313772f, 0.00784313772f, 0.00392156886f, 0.0f, 0.00784313772f, 0.00784313772f,
+    0.00392156886f, 0.00392156886f, 0.00392156886f, 0.00392156886f, 0.00784313772f, 0.00784313772f, 0.00784313772f, 0.00784313772f,
+    0.00392156886f, 0.00392156886f, 0.00784313772f, 0.00784313772f, 0.00392156886f, 0.00392156886f, 0.286274523f, 0.501960814f,
+    0.501960814f, 0.286274523f, 0.00392156886f, 0.00392156886f, 0.00784313772f, 0.00784313772f, 0.00392156886f, 0.00392156886f,
+    0.00392156886f, 0.00784313772f, 0.00392156886f, 0.00392156886f, 0.00392156886f, 0.00392156886f, 0.00392156886f, 0.00392156886f,
+    0.00392156886f, 0.00392156886f, 0.00392156886f, 0.00392156886f, 0.00784313772f, 0.00784313772f, 0.00392156886f, 0.00392156886f,
+    0.00392156886f, 0.00392156886f, 0.00392156886f, 0.00392156886f, 0.00784313772f, 0.00784313772f, 0.00392156886f, 0.00392156886f,
+    0.00784313772f, 0.00392156886f, 0.00784313772f, 0.00392156886f, 0.0f, 0.00392156886f, 0.011764707f, 0.011764707f,
+    0.00392156886f, 0.0f, 0.00392156886f, 0.00392156886f, 0.00784313772f, 0.00784313772f, 0.125490203f, 0.501960814f,
+    0.501960814f, 0.129411772f, 0.00392156886f, 0.00392156886f, 0.00784313772f, 0.00784313772f, 0.00784313772f, 0.00784313772f,
+    0.0f, 0.00392156886f, 0.0f, 0.00392156886f, 0.00784313772f, 0.00784313772f, 0.00392156886f, 0.00392156886f,
+    0.00784313772f, 0.00784313772f, 0.00392156886f, 0.00392156886f, 0.00784313772f, 0.00784313772f, 0.00392156886f, 0.00392156886f,
+    0.00392156886f, 0.00392156886f, 0.00392156886f, 0.00392156886f, 0.00784313772f, 0.00784313772f, 0.00392156886f, 0.00392156886f,
+    0.00392156886f, 0.0f, 0.00392156886f, 0.00392156886f, 0.00392156886f, 0.00392156886f, 0.00392156886f, 0.00784313772f,
+    0.00392156886f, 0.00392156886f, 0.00392156886f, 0.0f, 0.011764707f, 0.00784313772f, 0.00392156886f, 0.43921572f,
+    0.43921572f, 0.00392156886f, 0.00392156886f, 0.00392156886f, 0.00784313772f, 0.00784313772f, 0.00784313772f, 0.00784313772f,
+    0.00392156886f, 0.0f, 0.00392156886f, 0.0f, 0.00784313772f, 0.00784313772f, 0.00392156886f, 0.00392156886f,
+    0.00784313772f, 0.00784313772f, 0.00392156886f, 0.00392156886f, 0.00784313772f, 0.00784313772f, 0.00392156886f, 0.00392156886f,
+};
+
+inline constexpr int32_t blend_remove_scale_48[48 * 48] = {
+    66054, 65794, 65794, 65536, 65536, 65536, 65536, 65794, 65536, 65536, 65536, 65536,
+    65794, 65794, 65536, 65536, 65794, 65794, 65794, 65536, 65536, 65794, 65536, 117688,
+    116865, 65794, 65794, 65794, 65794, 65794, 66054, 65794, 65794, 66054, 65794, 65794,
+    66054, 66316, 65794, 65794, 65794, 65794, 66054, 65794, 66316, 66054, 65794, 65794,
+    65536, 65536, 65536, 65536, 65536, 65536, 65794, 65794, 65536, 65536, 65536, 65536,
+    65536, 65794, 65794, 65794, 65536, 65536, 65536, 65794, 65536, 65794, 75278, 131588,
+    131588, 74940, 65536, 66054, 65536, 65794, 65794, 65794, 65794, 65794, 65794, 66054,
+    66054, 66054, 65794, 65794, 65794, 65794, 65794, 66054, 66054, 66316, 65794, 65794,
+    65794, 65536, 65536, 65536, 65536, 65536, 65536, 65794, 65536, 65794, 66054, 66054,
+    65794, 65536, 65536, 66054, 65794, 65536, 65536, 65794, 65536, 65794, 91321, 131588,
+    131588, 91321, 65536, 65794, 65536, 65794, 65794, 65794, 66054, 66054, 65536, 66054,
+    66316, 66316, 65794, 65794, 66054, 66054, 66054, 66316, 65794, 65794, 65794, 65794,
+    65794, 66054, 65536, 65536, 65794, 65536, 65536, 65794, 65536, 65794, 65794, 65794,
+    65794, 65794, 65794, 65794, 65794, 66054, 65794, 65794, 65536, 65794, 116865, 131588,
+    131588, 123790, 65536, 65794, 65794, 65794, 66054, 65794, 66054, 66316, 65794, 65794,
+    66054, 66054, 65794, 65794, 66054, 66054, 66054, 65794, 65794, 65794, 66054, 66054,
+    65536, 65536, 65536, 65536, 65536, 65536, 65536, 65794, 65536, 65536, 65794, 65794,
+    65536, 65536, 65794, 65536, 65536, 65536, 65536, 65794, 65536, 74940, 131588, 131588,
+    131588, 131588, 74940, 65536, 65536, 65794, 66054, 65536, 66054, 66054, 65794, 65794,
+    65794, 65536, 66316, 66316, 66054, 66054, 65794, 65794, 65794, 65794, 65794, 65794,
+    65536, 66054, 65536, 65536, 65794, 65536, 65794, 65794, 65794, 65794, 65536, 65536,
+    65794, 65536, 65536, 65536, 65536, 65794, 65536, 65536, 65794, 95495, 131588, 131588,
+    131588, 131588, 105105, 65536, 65536, 65794, 65536, 65794, 66054, 66054, 65536, 65794,
+    65794, 65794, 66054, 66316, 66316, 66316, 65794, 65794, 65536, 65536, 65794, 65794,
+    65794, 65536, 65536, 65536, 65794, 65536, 66316, 65794, 65794, 65794, 65536, 65536,
+    65794, 65794, 65794, 66054, 66054, 65536, 65536, 66054, 70217, 131588, 131588, 131588,
+    131588, 131588, 131588, 69923, 65536, 65794, 65536, 65536, 65536, 65794, 66054, 66054,
+    65794, 65794, 65794, 65794, 65794, 65794, 65794, 65794, 65794, 65794, 65794, 65794,
+    65536, 65536, 65536, 65536, 66054, 65536, 65794, 66054, 65794, 65794, 65536, 65536,
+    65794, 66316, 65794, 65794, 65794, 65536, 65794, 65794, 95495, 131588, 131588, 131588,
+    131588, 131588, 131588, 96044, 65794, 66054, 65536, 65794, 65794, 65794, 66316, 66054,
+    65794, 65794, 66054, 66054, 65794, 65794, 65794, 65794, 65794, 65794, 65794, 65794,
+    66054, 65536, 65536, 65794, 66054, 65794, 66054, 65794, 65794, 66054, 66054, 65794,
+    65794, 65794, 66054, 65794, 66054, 66054, 65794, 70217, 131588, 131588, 131588, 132632,
+    131588, 131588, 131588, 131588, 74940, 66054, 65794, 66054, 65536, 65794, 66054, 65794,
+    66316, 66054, 66054, 66316, 66316, 66316, 66054, 66054, 65794, 65794, 66054, 66054,
+    65794, 65536, 65536, 65794, 65794, 65794, 65536, 66054, 65794, 65536, 65794, 65794,
+    65536, 65794, 65536, 65794, 65536, 65794, 65794, 116865, 131588, 131588, 131588, 131588,
+    131588, 131588, 131588, 131588, 105105, 65794, 65794, 65794, 65794, 65794, 65794, 65794,
+    65794, 65794, 66316, 66316, 66316, 66054, 66316, 66054, 65794, 65794, 66054, 66054,
+    66054, 65794, 65536, 65536, 65794, 66054, 65536, 65794, 65794, 65536, 65536, 65536,
+    66054, 65794, 65794, 66054, 65536, 65794, 87496, 131588, 131588, 131588, 131588, 131588,
+    131588, 131588, 131588, 131588, 131588, 83978, 65536, 65536, 66054, 66054, 66316, 65794,
+    66054, 66054, 65794, 66054, 66054, 66054, 65794, 65794, 66054, 66054, 65794, 65794,
+    65536, 65536, 65794, 65536, 65536, 65794, 65794, 66316, 65536, 65794, 66054, 65536,
+    66054, 65536, 66054, 65794, 65536, 69923, 131588, 131588, 131588, 131588, 131588, 131588,
+    131588, 131588, 131588, 131588, 131588, 123790, 72345, 65794, 66054, 66316, 66054, 66054,
+    66054, 66054, 65536, 65794, 65794, 65794, 65794, 66054, 66054, 66054, 65794, 65794,
+    65794, 65536, 65794, 65794, 65536, 65536, 65536, 65794, 65536, 65794, 65794, 65794,
+    65536, 66316, 66054, 65794, 69923, 116865, 131588, 131588, 131588, 131588, 131588, 131588,
+    131588, 131588, 131588, 131588, 131588, 131588, 116865, 67659, 65794, 65794, 65536, 65794,
+    65794, 65794, 66054, 66054, 65794, 65794, 66054, 66054, 66054, 66054, 65794, 66054,
+    65794, 65536, 65794, 65536, 65536, 65794, 65536, 65794, 65536, 65794, 65536, 65794,
+    65794, 65794, 65794, 65794, 111411, 131588, 131588, 131588, 131588, 131588, 131588, 131588,
+    131588, 131588, 131588, 131588, 131588, 131588, 131588, 105105, 66054, 65794, 65794, 65794,
+    65794, 65794, 66054, 66054, 65794, 65794, 66054, 66054, 66054, 66054, 65794, 66054,
+    65794, 65794, 65794, 65536, 65536, 65794, 65536, 65536, 65536, 65536, 65794, 65536,
+    66054, 65794, 65794, 96044, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588,
+    131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 95495, 65794, 65536, 65794,
+    65794, 65794, 66316, 65794, 65794, 65794, 65794, 66054, 66054, 66054, 65794, 65794,
+    65536, 65536, 65536, 65794, 65794, 65536, 65536, 65794, 65536, 65794, 65536, 65536,
+    65794, 65794, 95495, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588,
+    131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 95495, 65536, 65794,
+    65794, 65794, 66316, 65794, 65794, 65794, 65794, 65794, 66054, 66054, 65794, 65794,
+    65536, 66054, 65536, 65794, 65794, 65536, 65536, 65794, 65536, 65536, 65536, 65794,
+    67659, 105105, 131588, 131588, 131588, 131588, 132632, 131588, 131588, 131588, 131588, 131588,
+    131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 110673, 69923,
+    66054, 66054, 65794, 65794, 65794, 65794, 66316, 66580, 66316, 66054, 65536, 65794,
+    65794, 65536, 65794, 65794, 65536, 65794, 65794, 65794, 65794, 65536, 65536, 72345,
+    116865, 131588, 131588, 131588, 131588, 131588, 132632, 131588, 131588, 131588, 131588, 131588,
+    131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 116865,
+    70217, 66580, 66054, 65794, 65794, 65794, 66054, 65794, 66054, 66054, 65794, 65794,
+    65794, 65536, 65536, 65794, 65794, 65536, 65536, 65794, 65536, 65536, 83978, 123790,
+    131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588,
+    131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588,
+    131588, 88422, 65794, 65794, 66054, 66316, 66054, 66316, 66316, 65794, 65794, 65536,
+    66054, 65794, 65536, 65794, 65536, 65536, 66054, 65794, 74940, 105105, 131588, 131588,
+    131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588,
+    131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588,
+    131588, 131588, 116865, 69923, 66054, 66316, 66054, 66054, 66054, 66054, 65794, 65794,
+    65536, 65794, 65536, 65536, 65536, 65536, 69923, 96044, 131588, 131588, 131588, 131588,
+    131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588,
+    131588, 131588, 131588, 131588, 131588, 131588, 132632, 131588, 131588, 131588, 131588, 131588,
+    131588, 131588, 131588, 131588, 95495, 69923, 66054, 65794, 66054, 66054, 65794, 65794,
+    65536, 65794, 65536, 65794, 75278, 105105, 131588, 131588, 131588, 131588, 131588, 131588,
+    132632, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588,
+    131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588,
+    131588, 131588, 131588, 131588, 131588, 131588, 95495, 74940, 65794, 66054, 65794, 65794,
+    65536, 74940, 91321, 123790, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588,
+    131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588,
+    131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588,
+    131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 116865, 91321, 74940, 66580,
+    116865, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588,
+    131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588,
+    131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588,
+    131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 117688,
+    116865, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588,
+    131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588,
+    131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588,
+    131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 116865,
+    65794, 74940, 91321, 116865, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588,
+    131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588,
+    131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588,
+    131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 123790, 91321, 74940, 65794,
+    65794, 66316, 65536, 65794, 74940, 95495, 131588, 131588, 131588, 131588, 131588, 131588,
+    131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588,
+    131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588,
+    131588, 131588, 131588, 131588, 131588, 131588, 105105, 74940, 66054, 66054, 65794, 65794,
+    65536, 65794, 65794, 65536, 65536, 66054, 69923, 96044, 131588, 131588, 131588, 131588,
+    132632, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588,
+    131588, 132632, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588,
+    131588, 131588, 131588, 131588, 96044, 70217, 65794, 65794, 66054, 66054, 65794, 65794,
+    65794, 66054, 65794, 65794, 65536, 65536, 65794, 66054, 69923, 116865, 131588, 131588,
+    131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588,
+    131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588,
+    131588, 131588, 105105, 74940, 65794, 65794, 65794, 65794, 65794, 65794, 65794, 65794,
+    65794, 65794, 65794, 65794, 65536, 65536, 65536, 65794, 65536, 65794, 87496, 131588,
+    131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588,
+    131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588,
+    124714, 84402, 65794, 65794, 65794, 65794, 65794, 65794, 65794, 65794, 65794, 65794,
+    65794, 65794, 65536, 65794, 65536, 65794, 65536, 65536, 65536, 66054, 65536, 69923,
+    117688, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 132632, 131588, 131588, 131588,
+    131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 116865,
+    72345, 65794, 65794, 65794, 66054, 66054, 65794, 65794, 66054, 66054, 65794, 65794,
+    65794, 65794, 65536, 65794, 65536, 65794, 65536, 65794, 65536, 65536, 65536, 65536,
+    69923, 110673, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588,
+    131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 105105, 67659,
+    65794, 65794, 65794, 65794, 66054, 66054, 65794, 65794, 66054, 66054, 65794, 65794,
+    65794, 65794, 65794, 65794, 66054, 65794, 65794, 65794, 65536, 65536, 65536, 65536,
+    65794, 65794, 95495, 131588, 131588, 131588, 131588, 131588, 131588, 132632, 131588, 131588,
+    131588, 131588, 131588, 131588, 132632, 132632, 131588, 131588, 131588, 95495, 66316, 66316,
+    66054, 65794, 66054, 66054, 65794, 65794, 66316, 66316, 66054, 66054, 65794, 65536,
+    65794, 65794, 65536, 65794, 65794, 65794, 65794, 65536, 65536, 65536, 65536, 65794,
+    65794, 66054, 65794, 95495, 131588, 131588, 132632, 131588, 131588, 132632, 131588, 131588,
+    131588, 131588, 131588, 131588, 132632, 132632, 131588, 131588, 95495, 65794, 66580, 66580,
+    66054, 66054, 66054, 66054, 65794, 65794, 66316, 66316, 65794, 66054, 65794, 65794,
+    65794, 65794, 66054, 66054, 65794, 66054, 66316, 66316, 66054, 66054, 66054, 66054,
+    65794, 65794, 65794, 65794, 105770, 131588, 131588, 131588, 131588, 131588, 131588, 131588,
+    131588, 131588, 131588, 131588, 131588, 131588, 131588, 110673, 66054, 66054, 66316, 66316,
+    65794, 65536, 65794, 66054, 66054, 66054, 66316, 66316, 65794, 65794, 66316, 66316,
+    65794, 65794, 66054, 66054, 65794, 65794, 66580, 66316, 66054, 66316, 66054, 66316,
+    65794, 65794, 65794, 65794, 68211, 117688, 131588, 131588, 131588, 131588, 131588, 131588,
+    132632, 131588, 131588, 131588, 131588, 131588, 116865, 69923, 66054, 66316, 66316, 66316,
+    65794, 65794, 65794, 66054, 66054, 66054, 66580, 66316, 65536, 65794, 66316, 66316,
+    66054, 66054, 66054, 65794, 66054, 66054, 65536, 65536, 66054, 66316, 66054, 66316,
+    66054, 66054, 65536, 65794, 66054, 72659, 123790, 131588, 131588, 131588, 131588, 131588,
+    131588, 131588, 131588, 131588, 131588, 131588, 69923, 65536, 66054, 66054, 65536, 65536,
+    65794, 65794, 66054, 66316, 66054, 65794, 65536, 65536, 65794, 65794, 65794, 65794,
+    66054, 66054, 66054, 66054, 66316, 66054, 65794, 65794, 66054, 66054, 66054, 66054,
+    66054, 66054, 65794, 65794, 66054, 66054, 83978, 131588, 131588, 131588, 131588, 131588,
+    131588, 131588, 131588, 131588, 131588, 87496, 65794, 65794, 66316, 66054, 65794, 65536,
+    65794, 65794, 66316, 66316, 65794, 66054, 65794, 65536, 65536, 65536, 65794, 65794,
+    66054, 65794, 65794, 65794, 65794, 65794, 65794, 65794, 65794, 65794, 65794, 65794,
+    65536, 65794, 66054, 66054, 66054, 66054, 65536, 105105, 131588, 131588, 131588, 131588,
+    131588, 131588, 131588, 131588, 116865, 65794, 65794, 65794, 66054, 66054, 65536, 66054,
+    65794, 65794, 66054, 65794, 65794, 65536, 65794, 65536, 65536, 65794, 65794, 65794,
+    66054, 66054, 65794, 65794, 65794, 65794, 65794, 65794, 65794, 65794, 65794, 65794,
+    65794, 65794, 66054, 66054, 66316, 66054, 65794, 74940, 131588, 131588, 131588, 131588,
+    131588, 131588, 131588, 131588, 69923, 65794, 65794, 65536, 66054, 66054, 65794, 66054,
+    65794, 65794, 65794, 65794, 65794, 66054, 65794, 65794, 65794, 65794, 65794, 65794,
+    65794, 65794, 65794, 65794, 65794, 65794, 65794, 65794, 66054, 66054, 65536, 65536,
+    65794, 65536, 66054, 66054, 66054, 65794, 65794, 65536, 95495, 131588, 131588, 131588,
+    131588, 131588, 131588, 95495, 65794, 65794, 65794, 65794, 66054, 66316, 65536, 65794,
+    65794, 65794, 65794, 65794, 65794, 65794, 66054, 66054, 65794, 65794, 65794, 65794,
+    65794, 65794, 65794, 65794, 65794, 65794, 65794, 65794, 66054, 66054, 65536, 65794,
+    65794, 66054, 66054, 66054, 65794, 65794, 65536, 65794, 69923, 131588, 131588, 131588,
+    131588, 131588, 131588, 69923, 65794, 65794, 65794, 65794, 66054, 66054, 66054, 65794,
+    65794, 65794, 65794, 65794, 65794, 65794, 66054, 66054, 65794, 65794, 65794, 65794,
+    66054, 66054, 66054, 66054, 66054, 66054, 65794, 65794, 65794, 66054, 65794, 65794,
+    65794, 66054, 66054, 65794, 65794, 65794, 65794, 65794, 65536, 105770, 132632, 132632,
+    131588, 131588, 95495, 65794, 66054, 66054, 66054, 65794, 65794, 65794, 65794, 65794,
+    66054, 66054, 65794, 65794, 65794, 65794, 65794, 65794, 66054, 66054, 65794, 65794,
+    66054, 66054, 66054, 66054, 66054, 66054, 65794, 65794, 65794, 65794, 65794, 65536,
+    66054, 66054, 65794, 65536, 65794, 65794, 66054, 66316, 65794, 74940, 132632, 131588,
+    131588, 131588, 74940, 65794, 66054, 66054, 65536, 65794, 65794, 65794, 65794, 65794,
+    66054, 66054, 65794, 65794, 65794, 65794, 65794, 65794, 66054, 66054, 65794, 65794,
+    66054, 66054, 66054, 66054, 65794, 65794, 66054, 65794, 65794, 65794, 65794, 65794,
+    66054, 66054, 66054, 66054, 65536, 65536, 66054, 66054, 65794, 65794, 124714, 131588,
+    131588, 116865, 65794, 65794, 66054, 66316, 65794, 65794, 66054, 66054, 65536, 65536,
+    65794, 65794, 65794, 65794, 65794, 65794, 65794, 65794, 66054, 66054, 65794, 65794,
+    66054, 66054, 66054, 66054, 65794, 65536, 66054, 66054, 65794, 65794, 65794, 65794,
+    66054, 66054, 66054, 66054, 65794, 65794, 66054, 66054, 65794, 65794, 91822, 131588,
+    131588, 91822, 65794, 65794, 66054, 66054, 65794, 65794, 65794, 66054, 65794, 65794,
+    65794, 65794, 65794, 65794, 65794, 65794, 65794, 65794, 66054, 66054, 65794, 65794,
+    65794, 65794, 65794, 65794, 66054, 66054, 65794, 65794, 66054, 65794, 66054, 65794,
+    65536, 65794, 66316, 66316, 65794, 65536, 65794, 65794, 66054, 66054, 74940, 131588,
+    131588, 75278, 65794, 65794, 66054, 66054, 66054, 66054, 65536, 65794, 65536, 65794,
+    66054, 66054, 65794, 65794, 66054, 66054, 65794, 65794, 66054, 66054, 65794, 65794,
+    65794, 65794, 65794, 65794, 66054, 66054, 65794, 65794, 65794, 65536, 65794, 65794,
+    65794, 65794, 65794, 66054, 65794, 65794, 65794, 65536, 66316, 66054, 65794, 116865,
+    116865, 65794, 65794, 65794, 66054, 66054, 66054, 66054, 65794, 65536, 65794, 65536,
+    66054, 66054, 65794, 65794, 66054, 66054, 65794, 65794, 66054, 66054, 65794, 65794,
+};
+
+inline constexpr int32_t blend_remove_offset_48[48 * 48] = {
+    -99340, -33026, -33026, 32768, 32768, 32768, 32768, -33026, 32768, 32768, 32768, 32768,
+    -33026, -33026, 32768, 32768, -33026, -33026, -33026, 32768, 32768, -33026, 32768, -13265965,
+    -13056102, -33026, -33026, -33026, -33026, -33026, -99340, -33026, -33026, -99340, -33026, -33026,
+    -99340, -166181, -33026, -33026, -33026, -33026, -99340, -33026, -166181, -99340, -33026, -33026,
+    32768, 32768, 32768, 32768, 32768, 32768, -33026, -33026, 32768, 32768, 32768, 32768,
+    32768, -33026, -33026, -33026, 32768, 32768, 32768, -33026, 32768, -33026, -2451401, -16810502,
+    -16810502, -2365321, 32768, -99340, 32768, -33026, -33026, -33026, -33026, -33026, -33026, -99340,
+    -99340, -99340, -33026, -33026, -33026, -33026, -33026, -99340, -99340, -166181, -33026, -33026,
+    -33026, 32768, 32768, 32768, 32768, 32768, 32768, -33026, 32768, -33026, -99340, -99340,
+    -33026, 32768, 32768, -99340, -33026, 32768, 32768, -33026, 32768, -33026, -6542320, -16810502,
+    -16810502, -6542320, 32768, -33026, 32768, -33026, -33026, -33026, -99340, -99340, 32768, -99340,
+    -166181, -166181, -33026, -33026, -99340, -99340, -99340, -166181, -33026, -33026, -33026, -33026,
+    -33026, -99340, 32768, 32768, -33026, 32768, 32768, -33026, 32768, -33026, -33026, -33026,
+    -33026, -33026, -33026, -33026, -33026, -99340, -33026, -33026, 32768, -33026, -13056102, -16810502,
+    -16810502, -14822061, 32768, -33026, -33026, -33026, -99340, -33026, -99340, -166181, -33026, -33026,
+    -99340, -99340, -33026, -33026, -99340, -99340, -99340, -33026, -33026, -33026, -99340, -99340,
+    32768, 32768, 32768, 32768, 32768, 32768, 32768, -33026, 32768, 32768, -33026, -33026,
+    32768, 32768, -33026, 32768, 32768, 32768, 32768, -33026, 32768, -2365321, -16810502, -16810502,
+    -16810502, -16810502, -2365321, 32768, 32768, -33026, -99340, 32768, -99340, -99340, -33026, -33026,
+    -33026, 32768, -166181, -166181, -99340, -99340, -33026, -33026, -33026, -33026, -33026, -33026,
+    32768, -99340, 32768, 32768, -33026, 32768, -33026, -33026, -33026, -33026, 32768, 32768,
+    -33026, 32768, 32768, 32768, 32768, -33026, 32768, 32768, -33026, -7606858, -16810502, -16810502,
+    -16810502, -16810502, -10057305, 32768, 32768, -33026, 32768, -33026, -99340, -99340, 32768, -33026,
+    -33026, -33026, -99340, -166181, -166181, -166181, -33026, -33026, 32768, 32768, -33026, -33026,
+    -33026, 32768, 32768, 32768, -33026, 32768, -166181, -33026, -33026, -33026, 32768, 32768,
+    -33026, -33026, -33026, -99340, -99340, 32768, 32768, -99340, -1160923, -16810502, -16810502, -16810502,
+    -16810502, -16810502, -16810502, -1086006, 32768, -33026, 32768, 32768, 32768, -33026, -99340, -99340,
+    -33026, -33026, -33026, -33026, -33026, -33026, -33026, -33026, -33026, -33026, -33026, -33026,
+    32768, 32768, 32768, 32768, -99340, 32768, -33026, -99340, -33026, -33026, 32768, 32768,
+    -33026, -166181, -33026, -33026, -33026, 32768, -33026, -33026, -7606858, -16810502, -16810502, -16810502,
+    -16810502, -16810502, -16810502, -7746808, -33026, -99340, 32768, -33026, -33026, -33026, -166181, -99340,
+    -33026, -33026, -99340, -99340, -33026, -33026, -33026, -33026, -33026, -33026, -33026, -33026,
+    -99340, 32768, 32768, -33026, -99340, -33026, -99340, -33026, -33026, -99340, -99340, -33026,
+    -33026, -33026, -99340, -33026, -99340, -99340, -33026, -1160923, -16810502, -16810502, -16810502, -17076811,
+    -16810502, -16810502, -16810502, -16810502, -2365321, -99340, -33026, -99340, 32768, -33026, -99340, -33026,
+    -166181, -99340, -99340, -166181, -166181, -166181, -99340, -99340, -33026, -33026, -99340, -99340,
+    -33026, 32768, 32768, -33026, -33026, -33026, 32768, -99340, -33026, 32768, -33026, -33026,
+    32768, -33026, 32768, -33026, 32768, -33026, -33026, -13056102, -16810502, -16810502, -16810502, -16810502,
+    -16810502, -16810502, -16810502, -16810502, -10057305, -33026, -33026, -33026, -33026, -33026, -33026, -33026,
+    -33026, -33026, -166181, -166181, -166181, -99340, -166181, -99340, -33026, -33026, -99340, -99340,
+    -99340, -33026, 32768, 32768, -33026, -99340, 32768, -33026, -33026, 32768, 32768, 32768,
+    -99340, -33026, -33026, -99340, 32768, -33026, -5566958, -16810502, -16810502, -16810502, -16810502, -16810502,
+    -16810502, -16810502, -16810502, -16810502, -16810502, -4670017, 32768, 32768, -99340, -99340, -166181, -33026,
+    -99340, -99340, -33026, -99340, -99340, -99340, -33026, -33026, -99340, -99340, -33026, -33026,
+    32768, 32768, -33026, 32768, 32768, -33026, -33026, -166181, 32768, -33026, -99340, 32768,
+    -99340, 32768, -99340, -33026, 32768, -1086006, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502,
+    -16810502, -16810502, -16810502, -16810502, -16810502, -14822061, -1703511, -33026, -99340, -166181, -99340, -99340,
+    -99340, -99340, 32768, -33026, -33026, -33026, -33026, -99340, -99340, -99340, -33026, -33026,
+    -33026, 32768, -33026, -33026, 32768, 32768, 32768, -33026, 32768, -33026, -33026, -33026,
+    32768, -166181, -99340, -33026, -1086006, -13056102, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502,
+    -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -13056102, -508501, -33026, -33026, 32768, -33026,
+    -33026, -33026, -99340, -99340, -33026, -33026, -99340, -99340, -99340, -99340, -33026, -99340,
+    -33026, 32768, -33026, 32768, 32768, -33026, 32768, -33026, 32768, -33026, 32768, -33026,
+    -33026, -33026, -33026, -33026, -11665410, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502,
+    -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -10057305, -99340, -33026, -33026, -33026,
+    -33026, -33026, -99340, -99340, -33026, -33026, -99340, -99340, -99340, -99340, -33026, -99340,
+    -33026, -33026, -33026, 32768, 32768, -33026, 32768, 32768, 32768, 32768, -33026, 32768,
+    -99340, -33026, -33026, -7746808, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502,
+    -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -7606858, -33026, 32768, -33026,
+    -33026, -33026, -166181, -33026, -33026, -33026, -33026, -99340, -99340, -99340, -33026, -33026,
+    32768, 32768, 32768, -33026, -33026, 32768, 32768, -33026, 32768, -33026, 32768, 32768,
+    -33026, -33026, -7606858, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502,
+    -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -7606858, 32768, -33026,
+    -33026, -33026, -166181, -33026, -33026, -33026, -33026, -33026, -99340, -99340, -33026, -33026,
+    32768, -99340, 32768, -33026, -33026, 32768, 32768, -33026, 32768, 32768, 32768, -33026,
+    -508501, -10057305, -16810502, -16810502, -16810502, -16810502, -17076811, -16810502, -16810502, -16810502, -16810502, -16810502,
+    -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -11477265, -1086006,
+    -99340, -99340, -33026, -33026, -33026, -33026, -166181, -233554, -166181, -99340, 32768, -33026,
+    -33026, 32768, -33026, -33026, 32768, -33026, -33026, -33026, -33026, 32768, 32768, -1703511,
+    -13056102, -16810502, -16810502, -16810502, -16810502, -16810502, -17076811, -16810502, -16810502, -16810502, -16810502, -16810502,
+    -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -13056102,
+    -1160923, -233554, -99340, -33026, -33026, -33026, -99340, -33026, -99340, -99340, -33026, -33026,
+    -33026, 32768, 32768, -33026, -33026, 32768, 32768, -33026, 32768, 32768, -4670017, -14822061,
+    -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502,
+    -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502,
+    -16810502, -5803057, -33026, -33026, -99340, -166181, -99340, -166181, -166181, -33026, -33026, 32768,
+    -99340, -33026, 32768, -33026, 32768, 32768, -99340, -33026, -2365321, -10057305, -16810502, -16810502,
+    -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502,
+    -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502,
+    -16810502, -16810502, -13056102, -1086006, -99340, -166181, -99340, -99340, -99340, -99340, -33026, -33026,
+    32768, -33026, 32768, 32768, 32768, 32768, -1086006, -7746808, -16810502, -16810502, -16810502, -16810502,
+    -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502,
+    -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -17076811, -16810502, -16810502, -16810502, -16810502, -16810502,
+    -16810502, -16810502, -16810502, -16810502, -7606858, -1086006, -99340, -33026, -99340, -99340, -33026, -33026,
+    32768, -33026, 32768, -33026, -2451401, -10057305, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502,
+    -17076811, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502,
+    -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502,
+    -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -7606858, -2365321, -33026, -99340, -33026, -33026,
+    32768, -2365321, -6542320, -14822061, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502,
+    -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502,
+    -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502,
+    -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -13056102, -6542320, -2365321, -233554,
+    -13056102, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502,
+    -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502,
+    -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502,
+    -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -13265965,
+    -13056102, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502,
+    -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502,
+    -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502,
+    -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -13056102,
+    -33026, -2365321, -6542320, -13056102, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502,
+    -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502,
+    -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502,
+    -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -14822061, -6542320, -2365321, -33026,
+    -33026, -166181, 32768, -33026, -2365321, -7606858, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502,
+    -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502,
+    -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502,
+    -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -10057305, -2365321, -99340, -99340, -33026, -33026,
+    32768, -33026, -33026, 32768, 32768, -99340, -1086006, -7746808, -16810502, -16810502, -16810502, -16810502,
+    -17076811, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502,
+    -16810502, -17076811, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502,
+    -16810502, -16810502, -16810502, -16810502, -7746808, -1160923, -33026, -33026, -99340, -99340, -33026, -33026,
+    -33026, -99340, -33026, -33026, 32768, 32768, -33026, -99340, -1086006, -13056102, -16810502, -16810502,
+    -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502,
+    -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502,
+    -16810502, -16810502, -10057305, -2365321, -33026, -33026, -33026, -33026, -33026, -33026, -33026, -33026,
+    -33026, -33026, -33026, -33026, 32768, 32768, 32768, -33026, 32768, -33026, -5566958, -16810502,
+    -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502,
+    -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502,
+    -15057632, -4778171, -33026, -33026, -33026, -33026, -33026, -33026, -33026, -33026, -33026, -33026,
+    -33026, -33026, 32768, -33026, 32768, -33026, 32768, 32768, 32768, -99340, 32768, -1086006,
+    -13265965, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -17076811, -16810502, -16810502, -16810502,
+    -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -13056102,
+    -1703511, -33026, -33026, -33026, -99340, -99340, -33026, -33026, -99340, -99340, -33026, -33026,
+    -33026, -33026, 32768, -33026, 32768, -33026, 32768, -33026, 32768, 32768, 32768, 32768,
+    -1086006, -11477265, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502,
+    -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -10057305, -508501,
+    -33026, -33026, -33026, -33026, -99340, -99340, -33026, -33026, -99340, -99340, -33026, -33026,
+    -33026, -33026, -33026, -33026, -99340, -33026, -33026, -33026, 32768, 32768, 32768, 32768,
+    -33026, -33026, -7606858, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -17076811, -16810502, -16810502,
+    -16810502, -16810502, -16810502, -16810502, -17076811, -17076811, -16810502, -16810502, -16810502, -7606858, -166181, -166181,
+    -99340, -33026, -99340, -99340, -33026, -33026, -166181, -166181, -99340, -99340, -33026, 32768,
+    -33026, -33026, 32768, -33026, -33026, -33026, -33026, 32768, 32768, 32768, 32768, -33026,
+    -33026, -99340, -33026, -7606858, -16810502, -16810502, -17076811, -16810502, -16810502, -17076811, -16810502, -16810502,
+    -16810502, -16810502, -16810502, -16810502, -17076811, -17076811, -16810502, -16810502, -7606858, -33026, -233554, -233554,
+    -99340, -99340, -99340, -99340, -33026, -33026, -166181, -166181, -33026, -99340, -33026, -33026,
+    -33026, -33026, -99340, -99340, -33026, -99340, -166181, -166181, -99340, -99340, -99340, -99340,
+    -33026, -33026, -33026, -33026, -10226936, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502,
+    -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -11477265, -99340, -99340, -166181, -166181,
+    -33026, 32768, -33026, -99340, -99340, -99340, -166181, -166181, -33026, -33026, -166181, -166181,
+    -33026, -33026, -99340, -99340, -33026, -33026, -233554, -166181, -99340, -166181, -99340, -166181,
+    -33026, -33026, -33026, -33026, -649341, -13265965, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502,
+    -17076811, -16810502, -16810502, -16810502, -16810502, -16810502, -13056102, -1086006, -99340, -166181, -166181, -166181,
+    -33026, -33026, -33026, -99340, -99340, -99340, -233554, -166181, 32768, -33026, -166181, -166181,
+    -99340, -99340, -99340, -33026, -99340, -99340, 32768, 32768, -99340, -166181, -99340, -166181,
+    -99340, -99340, 32768, -33026, -99340, -1783719, -14822061, -16810502, -16810502, -16810502, -16810502, -16810502,
+    -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -1086006, 32768, -99340, -99340, 32768, 32768,
+    -33026, -33026, -99340, -166181, -99340, -33026, 32768, 32768, -33026, -33026, -33026, -33026,
+    -99340, -99340, -99340, -99340, -166181, -99340, -33026, -33026, -99340, -99340, -99340, -99340,
+    -99340, -99340, -33026, -33026, -99340, -99340, -4670017, -16810502, -16810502, -16810502, -16810502, -16810502,
+    -16810502, -16810502, -16810502, -16810502, -16810502, -5566958, -33026, -33026, -166181, -99340, -33026, 32768,
+    -33026, -33026, -166181, -166181, -33026, -99340, -33026, 32768, 32768, 32768, -33026, -33026,
+    -99340, -33026, -33026, -33026, -33026, -33026, -33026, -33026, -33026, -33026, -33026, -33026,
+    32768, -33026, -99340, -99340, -99340, -99340, 32768, -10057305, -16810502, -16810502, -16810502, -16810502,
+    -16810502, -16810502, -16810502, -16810502, -13056102, -33026, -33026, -33026, -99340, -99340, 32768, -99340,
+    -33026, -33026, -99340, -33026, -33026, 32768, -33026, 32768, 32768, -33026, -33026, -33026,
+    -99340, -99340, -33026, -33026, -33026, -33026, -33026, -33026, -33026, -33026, -33026, -33026,
+    -33026, -33026, -99340, -99340, -166181, -99340, -33026, -2365321, -16810502, -16810502, -16810502, -16810502,
+    -16810502, -16810502, -16810502, -16810502, -1086006, -33026, -33026, 32768, -99340, -99340, -33026, -99340,
+    -33026, -33026, -33026, -33026, -33026, -99340, -33026, -33026, -33026, -33026, -33026, -33026,
+    -33026, -33026, -33026, -33026, -33026, -33026, -33026, -33026, -99340, -99340, 32768, 32768,
+    -33026, 32768, -99340, -99340, -99340, -33026, -33026, 32768, -7606858, -16810502, -16810502, -16810502,
+    -16810502, -16810502, -16810502, -7606858, -33026, -33026, -33026, -33026, -99340, -166181, 32768, -33026,
+    -33026, -33026, -33026, -33026, -33026, -33026, -99340, -99340, -33026, -33026, -33026, -33026,
+    -33026, -33026, -33026, -33026, -33026, -33026, -33026, -33026, -99340, -99340, 32768, -33026,
+    -33026, -99340, -99340, -99340, -33026, -33026, 32768, -33026, -1086006, -16810502, -16810502, -16810502,
+    -16810502, -16810502, -16810502, -1086006, -33026, -33026, -33026, -33026, -99340, -99340, -99340, -33026,
+    -33026, -33026, -33026, -33026, -33026, -33026, -99340, -99340, -33026, -33026, -33026, -33026,
+    -99340, -99340, -99340, -99340, -99340, -99340, -33026, -33026, -33026, -99340, -33026, -33026,
+    -33026, -99340, -99340, -33026, -33026, -33026, -33026, -33026, 32768, -10226936, -17076811, -17076811,
+    -16810502, -16810502, -7606858, -33026, -99340, -99340, -99340, -33026, -33026, -33026, -33026, -33026,
+    -99340, -99340, -33026, -33026, -33026, -33026, -33026, -33026, -99340, -99340, -33026, -33026,
+    -99340, -99340, -99340, -99340, -99340, -99340, -33026, -33026, -33026, -33026, -33026, 32768,
+    -99340, -99340, -33026, 32768, -33026, -33026, -99340, -166181, -33026, -2365321, -17076811, -16810502,
+    -16810502, -16810502, -2365321, -33026, -99340, -99340, 32768, -33026, -33026, -33026, -33026, -33026,
+    -99340, -99340, -33026, -33026, -33026, -33026, -33026, -33026, -99340, -99340, -33026, -33026,
+    -99340, -99340, -99340, -99340, -33026, -33026, -99340, -33026, -33026, -33026, -33026, -33026,
+    -99340, -99340, -99340, -99340, 32768, 32768, -99340, -99340, -33026, -33026, -15057632, -16810502,
+    -16810502, -13056102, -33026, -33026, -99340, -166181, -33026, -33026, -99340, -99340, 32768, 32768,
+    -33026, -33026, -33026, -33026, -33026, -33026, -33026, -33026, -99340, -99340, -33026, -33026,
+    -99340, -99340, -99340, -99340, -33026, 32768, -99340, -99340, -33026, -33026, -33026, -33026,
+    -99340, -99340, -99340, -99340, -33026, -33026, -99340, -99340, -33026, -33026, -6670269, -16810502,
+    -16810502, -6670269, -33026, -33026, -99340, -99340, -33026, -33026, -33026, -99340, -33026, -33026,
+    -33026, -33026, -33026, -33026, -33026, -33026, -33026, -33026, -99340, -99340, -33026, -33026,
+    -33026, -33026, -33026, -33026, -99340, -99340, -33026, -33026, -99340, -33026, -99340, -33026,
+    32768, -33026, -166181, -166181, -33026, 32768, -33026, -33026, -99340, -99340, -2365321, -16810502,
+    -16810502, -2451401, -33026, -33026, -99340, -99340, -99340, -99340, 32768, -33026, 32768, -33026,
+    -99340, -99340, -33026, -33026, -99340, -99340, -33026, -33026, -99340, -99340, -33026, -33026,
+    -33026, -33026, -33026, -33026, -99340, -99340, -33026, -33026, -33026, 32768, -33026, -33026,
+    -33026, -33026, -33026, -99340, -33026, -33026, -33026, 32768, -166181, -99340, -33026, -13056102,
+    -13056102, -33026, -33026, -33026, -99340, -99340, -99340, -99340, -33026, 32768, -33026, 32768,
+    -99340, -99340, -33026, -33026, -99340, -99340, -33026, -33026, -99340, -99340, -33026, -33026,
+};
+
+inline constexpr int32_t blend_add_scale_48[48 * 48] = {
+    65022, 65279, 65279, 65536, 65536, 65536, 65536, 65279, 65536, 65536, 65536, 65536,
+    65279, 65279, 65536, 65536, 65279, 65279, 65279, 65536, 65536, 65279, 65536, 36495,
+    36752, 65279, 65279, 65279, 65279, 65279, 65022, 65279, 65279, 65022, 65279, 65279,
+    65022, 64765, 65279, 65279, 65279, 65279, 65022, 65279, 64765, 65022, 65279, 65279,
+    65536, 65536, 65536, 65536, 65536, 65536, 65279, 65279, 65536, 65536, 65536, 65536,
+    65536, 65279, 65279, 65279, 65536, 65536, 65536, 65279, 65536, 65279, 57055, 32639,
+    32639, 57312, 65536, 65022, 65536, 65279, 65279, 65279, 65279, 65279, 65279, 65022,
+    65022, 65022, 65279, 65279, 65279, 65279, 65279, 65022, 65022, 64765, 65279, 65279,
+    65279, 65536, 65536, 65536, 65536, 65536, 65536, 65279, 65536, 65279, 65022, 65022,
+    65279, 65536, 65536, 65022, 65279, 65536, 65536, 65279, 65536, 65279, 47032, 32639,
+    32639, 47032, 65536, 65279, 65536, 65279, 65279, 65279, 65022, 65022, 65536, 65022,
+    64765, 64765, 65279, 65279, 65022, 65022, 65022, 64765, 65279, 65279, 65279, 65279,
+    65279, 65022, 65536, 65536, 65279, 65536, 65536, 65279, 65536, 65279, 65279, 65279,
+    65279, 65279, 65279, 65279, 65279, 65022, 65279, 65279, 65536, 65279, 36752, 32639,
+    32639, 34696, 65536, 65279, 65279, 65279, 65022, 65279, 65022, 64765, 65279, 65279,
+    65022, 65022, 65279, 65279, 65022, 65022, 65022, 65279, 65279, 65279, 65022, 65022,
+    65536, 65536, 65536, 65536, 65536, 65536, 65536, 65279, 65536, 65536, 65279, 65279,
+    65536, 65536, 65279, 65536, 65536, 65536, 65536, 65279, 65536, 57312, 32639, 32639,
+    32639, 32639, 57312, 65536, 65536, 65279, 65022, 65536, 65022, 65022, 65279, 65279,
+    65279, 65536, 64765, 64765, 65022, 65022, 65279, 65279, 65279, 65279, 65279, 65279,
+    65536, 65022, 65536, 65536, 65279, 65536, 65279, 65279, 65279, 65279, 65536, 65536,
+    65279, 65536, 65536, 65536, 65536, 65279, 65536, 65536, 65279, 44976, 32639, 32639,
+    32639, 32639, 40864, 65536, 65536, 65279, 65536, 65279, 65022, 65022, 65536, 65279,
+    65279, 65279, 65022, 64765, 64765, 64765, 65279, 65279, 65536, 65536, 65279, 65279,
+    65279, 65536, 65536, 65536, 65279, 65536, 64765, 65279, 65279, 65279, 65536, 65536,
+    65279, 65279, 65279, 65022, 65022, 65536, 65536, 65022, 61167, 32639, 32639, 32639,
+    32639, 32639, 32639, 61424, 65536, 65279, 65536, 65536, 65536, 65279, 65022, 65022,
+    65279, 65279, 65279, 65279, 65279, 65279, 65279, 65279, 65279, 65279, 65279, 65279,
+    65536, 65536, 65536, 65536, 65022, 65536, 65279, 65022, 65279, 65279, 65536, 65536,
+    65279, 64765, 65279, 65279, 65279, 65536, 65279, 65279, 44976, 32639, 32639, 32639,
+    32639, 32639, 32639, 44719, 65279, 65022, 65536, 65279, 65279, 65279, 64765, 65022,
+    65279, 65279, 65022, 65022, 65279, 65279, 65279, 65279, 65279, 65279, 65279, 65279,
+    65022, 65536, 65536, 65279, 65022, 65279, 65022, 65279, 65279, 65022, 65022, 65279,
+    65279, 65279, 65022, 65279, 65022, 65022, 65279, 61167, 32639, 32639, 32639, 32382,
+    32639, 32639, 32639, 32639, 57312, 65022, 65279, 65022, 65536, 65279, 65022, 65279,
+    64765, 65022, 65022, 64765, 64765, 64765, 65022, 65022, 65279, 65279, 65022, 65022,
+    65279, 65536, 65536, 65279, 65279, 65279, 65536, 65022, 65279, 65536, 65279, 65279,
+    65536, 65279, 65536, 65279, 65536, 65279, 65279, 36752, 32639, 32639, 32639, 32639,
+    32639, 32639, 32639, 32639, 40864, 65279, 65279, 65279, 65279, 65279, 65279, 65279,
+    65279, 65279, 64765, 64765, 64765, 65022, 64765, 65022, 65279, 65279, 65022, 65022,
+    65022, 65279, 65536, 65536, 65279, 65022, 65536, 65279, 65279, 65536, 65536, 65536,
+    65022, 65279, 65279, 65022, 65536, 65279, 49088, 32639, 32639, 32639, 32639, 32639,
+    32639, 32639, 32639, 32639, 32639, 51144, 65536, 65536, 65022, 65022, 64765, 65279,
+    65022, 65022, 65279, 65022, 65022, 65022, 65279, 65279, 65022, 65022, 65279, 65279,
+    65536, 65536, 65279, 65536, 65536, 65279, 65279, 64765, 65536, 65279, 65022, 65536,
+    65022, 65536, 65022, 65279, 65536, 61424, 32639, 32639, 32639, 32639, 32639, 32639,
+    32639, 32639, 32639, 32639, 32639, 34696, 59368, 65279, 65022, 64765, 65022, 65022,
+    65022, 65022, 65536, 65279, 65279, 65279, 65279, 65022, 65022, 65022, 65279, 65279,
+    65279, 65536, 65279, 65279, 65536, 65536, 65536, 65279, 65536, 65279, 65279, 65279,
+    65536, 64765, 65022, 65279, 61424, 36752, 32639, 32639, 32639, 32639, 32639, 32639,
+    32639, 32639, 32639, 32639, 32639, 32639, 36752, 63480, 65279, 65279, 65536, 65279,
+    65279, 65279, 65022, 65022, 65279, 65279, 65022, 65022, 65022, 65022, 65279, 65022,
+    65279, 65536, 65279, 65536, 65536, 65279, 65536, 65279, 65536, 65279, 65536, 65279,
+    65279, 65279, 65279, 65279, 38551, 32639, 32639, 32639, 32639, 32639, 32639, 32639,
+    32639, 32639, 32639, 32639, 32639, 32639, 32639, 40864, 65022, 65279, 65279, 65279,
+    65279, 65279, 65022, 65022, 65279, 65279, 65022, 65022, 65022, 65022, 65279, 65022,
+    65279, 65279, 65279, 65536, 65536, 65279, 65536, 65536, 65536, 65536, 65279, 65536,
+    65022, 65279, 65279, 44719, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639,
+    32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 44976, 65279, 65536, 65279,
+    65279, 65279, 64765, 65279, 65279, 65279, 65279, 65022, 65022, 65022, 65279, 65279,
+    65536, 65536, 65536, 65279, 65279, 65536, 65536, 65279, 65536, 65279, 65536, 65536,
+    65279, 65279, 44976, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639,
+    32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 44976, 65536, 65279,
+    65279, 65279, 64765, 65279, 65279, 65279, 65279, 65279, 65022, 65022, 65279, 65279,
+    65536, 65022, 65536, 65279, 65279, 65536, 65536, 65279, 65536, 65536, 65536, 65279,
+    63480, 40864, 32639, 32639, 32639, 32639, 32382, 32639, 32639, 32639, 32639, 32639,
+    32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 38808, 61424,
+    65022, 65022, 65279, 65279, 65279, 65279, 64765, 64508, 64765, 65022, 65536, 65279,
+    65279, 65536, 65279, 65279, 65536, 65279, 65279, 65279, 65279, 65536, 65536, 59368,
+    36752, 32639, 32639, 32639, 32639, 32639, 32382, 32639, 32639, 32639, 32639, 32639,
+    32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 36752,
+    61167, 64508, 65022, 65279, 65279, 65279, 65022, 65279, 65022, 65022, 65279, 65279,
+    65279, 65536, 65536, 65279, 65279, 65536, 65536, 65279, 65536, 65536, 51144, 34696,
+    32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639,
+    32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639,
+    32639, 48574, 65279, 65279, 65022, 64765, 65022, 64765, 64765, 65279, 65279, 65536,
+    65022, 65279, 65536, 65279, 65536, 65536, 65022, 65279, 57312, 40864, 32639, 32639,
+    32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639,
+    32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639,
+    32639, 32639, 36752, 61424, 65022, 64765, 65022, 65022, 65022, 65022, 65279, 65279,
+    65536, 65279, 65536, 65536, 65536, 65536, 61424, 44719, 32639, 32639, 32639, 32639,
+    32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639,
+    32639, 32639, 32639, 32639, 32639, 32639, 32382, 32639, 32639, 32639, 32639, 32639,
+    32639, 32639, 32639, 32639, 44976, 61424, 65022, 65279, 65022, 65022, 65279, 65279,
+    65536, 65279, 65536, 65279, 57055, 40864, 32639, 32639, 32639, 32639, 32639, 32639,
+    32382, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639,
+    32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639,
+    32639, 32639, 32639, 32639, 32639, 32639, 44976, 57312, 65279, 65022, 65279, 65279,
+    65536, 57312, 47032, 34696, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639,
+    32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639,
+    32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639,
+    32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 36752, 47032, 57312, 64508,
+    36752, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639,
+    32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639,
+    32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639,
+    32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 36495,
+    36752, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639,
+    32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639,
+    32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639,
+    32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 36752,
+    65279, 57312, 47032, 36752, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639,
+    32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639,
+    32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639,
+    32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 34696, 47032, 57312, 65279,
+    65279, 64765, 65536, 65279, 57312, 44976, 32639, 32639, 32639, 32639, 32639, 32639,
+    32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639,
+    32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639,
+    32639, 32639, 32639, 32639, 32639, 32639, 40864, 57312, 65022, 65022, 65279, 65279,
+    65536, 65279, 65279, 65536, 65536, 65022, 61424, 44719, 32639, 32639, 32639, 32639,
+    32382, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639,
+    32639, 32382, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639,
+    32639, 32639, 32639, 32639, 44719, 61167, 65279, 65279, 65022, 65022, 65279, 65279,
+    65279, 65022, 65279, 65279, 65536, 65536, 65279, 65022, 61424, 36752, 32639, 32639,
+    32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639,
+    32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639,
+    32639, 32639, 40864, 57312, 65279, 65279, 65279, 65279, 65279, 65279, 65279, 65279,
+    65279, 65279, 65279, 65279, 65536, 65536, 65536, 65279, 65536, 65279, 49088, 32639,
+    32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639,
+    32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639,
+    34439, 50887, 65279, 65279, 65279, 65279, 65279, 65279, 65279, 65279, 65279, 65279,
+    65279, 65279, 65536, 65279, 65536, 65279, 65536, 65536, 65536, 65022, 65536, 61424,
+    36495, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32382, 32639, 32639, 32639,
+    32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 36752,
+    59368, 65279, 65279, 65279, 65022, 65022, 65279, 65279, 65022, 65022, 65279, 65279,
+    65279, 65279, 65536, 65279, 65536, 65279, 65536, 65279, 65536, 65536, 65536, 65536,
+    61424, 38808, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639,
+    32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 40864, 63480,
+    65279, 65279, 65279, 65279, 65022, 65022, 65279, 65279, 65022, 65022, 65279, 65279,
+    65279, 65279, 65279, 65279, 65022, 65279, 65279, 65279, 65536, 65536, 65536, 65536,
+    65279, 65279, 44976, 32639, 32639, 32639, 32639, 32639, 32639, 32382, 32639, 32639,
+    32639, 32639, 32639, 32639, 32382, 32382, 32639, 32639, 32639, 44976, 64765, 64765,
+    65022, 65279, 65022, 65022, 65279, 65279, 64765, 64765, 65022, 65022, 65279, 65536,
+    65279, 65279, 65536, 65279, 65279, 65279, 65279, 65536, 65536, 65536, 65536, 65279,
+    65279, 65022, 65279, 44976, 32639, 32639, 32382, 32639, 32639, 32382, 32639, 32639,
+    32639, 32639, 32639, 32639, 32382, 32382, 32639, 32639, 44976, 65279, 64508, 64508,
+    65022, 65022, 65022, 65022, 65279, 65279, 64765, 64765, 65279, 65022, 65279, 65279,
+    65279, 65279, 65022, 65022, 65279, 65022, 64765, 64765, 65022, 65022, 65022, 65022,
+    65279, 65279, 65279, 65279, 40607, 32639, 32639, 32639, 32639, 32639, 32639, 32639,
+    32639, 32639, 32639, 32639, 32639, 32639, 32639, 38808, 65022, 65022, 64765, 64765,
+    65279, 65536, 65279, 65022, 65022, 65022, 64765, 64765, 65279, 65279, 64765, 64765,
+    65279, 65279, 65022, 65022, 65279, 65279, 64508, 64765, 65022, 64765, 65022, 64765,
+    65279, 65279, 65279, 65279, 62966, 36495, 32639, 32639, 32639, 32639, 32639, 32639,
+    32382, 32639, 32639, 32639, 32639, 32639, 36752, 61424, 65022, 64765, 64765, 64765,
+    65279, 65279, 65279, 65022, 65022, 65022, 64508, 64765, 65536, 65279, 64765, 64765,
+    65022, 65022, 65022, 65279, 65022, 65022, 65536, 65536, 65022, 64765, 65022, 64765,
+    65022, 65022, 65536, 65279, 65022, 59111, 34696, 32639, 32639, 32639, 32639, 32639,
+    32639, 32639, 32639, 32639, 32639, 32639, 61424, 65536, 65022, 65022, 65536, 65536,
+    65279, 65279, 65022, 64765, 65022, 65279, 65536, 65536, 65279, 65279, 65279, 65279,
+    65022, 65022, 65022, 65022, 64765, 65022, 65279, 65279, 65022, 65022, 65022, 65022,
+    65022, 65022, 65279, 65279, 65022, 65022, 51144, 32639, 32639, 32639, 32639, 32639,
+    32639, 32639, 32639, 32639, 32639, 49088, 65279, 65279, 64765, 65022, 65279, 65536,
+    65279, 65279, 64765, 64765, 65279, 65022, 65279, 65536, 65536, 65536, 65279, 65279,
+    65022, 65279, 65279, 65279, 65279, 65279, 65279, 65279, 65279, 65279, 65279, 65279,
+    65536, 65279, 65022, 65022, 65022, 65022, 65536, 40864, 32639, 32639, 32639, 32639,
+    32639, 32639, 32639, 32639, 36752, 65279, 65279, 65279, 65022, 65022, 65536, 65022,
+    65279, 65279, 65022, 65279, 65279, 65536, 65279, 65536, 65536, 65279, 65279, 65279,
+    65022, 65022, 65279, 65279, 65279, 65279, 65279, 65279, 65279, 65279, 65279, 65279,
+    65279, 65279, 65022, 65022, 64765, 65022, 65279, 57312, 32639, 32639, 32639, 32639,
+    32639, 32639, 32639, 32639, 61424, 65279, 65279, 65536, 65022, 65022, 65279, 65022,
+    65279, 65279, 65279, 65279, 65279, 65022, 65279, 65279, 65279, 65279, 65279, 65279,
+    65279, 65279, 65279, 65279, 65279, 65279, 65279, 65279, 65022, 65022, 65536, 65536,
+    65279, 65536, 65022, 65022, 65022, 65279, 65279, 65536, 44976, 32639, 32639, 32639,
+    32639, 32639, 32639, 44976, 65279, 65279, 65279, 65279, 65022, 64765, 65536, 65279,
+    65279, 65279, 65279, 65279, 65279, 65279, 65022, 65022, 65279, 65279, 65279, 65279,
+    65279, 65279, 65279, 65279, 65279, 65279, 65279, 65279, 65022, 65022, 65536, 65279,
+    65279, 65022, 65022, 65022, 65279, 65279, 65536, 65279, 61424, 32639, 32639, 32639,
+    32639, 32639, 32639, 61424, 65279, 65279, 65279, 65279, 65022, 65022, 65022, 65279,
+    65279, 65279, 65279, 65279, 65279, 65279, 65022, 65022, 65279, 65279, 65279, 65279,
+    65022, 65022, 65022, 65022, 65022, 65022, 65279, 65279, 65279, 65022, 65279, 65279,
+    65279, 65022, 65022, 65279, 65279, 65279, 65279, 65279, 65536, 40607, 32382, 32382,
+    32639, 32639, 44976, 65279, 65022, 65022, 65022, 65279, 65279, 65279, 65279, 65279,
+    65022, 65022, 65279, 65279, 65279, 65279, 65279, 65279, 65022, 65022, 65279, 65279,
+    65022, 65022, 65022, 65022, 65022, 65022, 65279, 65279, 65279, 65279, 65279, 65536,
+    65022, 65022, 65279, 65536, 65279, 65279, 65022, 64765, 65279, 57312, 32382, 32639,
+    32639, 32639, 57312, 65279, 65022, 65022, 65536, 65279, 65279, 65279, 65279, 65279,
+    65022, 65022, 65279, 65279, 65279, 65279, 65279, 65279, 65022, 65022, 65279, 65279,
+    65022, 65022, 65022, 65022, 65279, 65279, 65022, 65279, 65279, 65279, 65279, 65279,
+    65022, 65022, 65022, 65022, 65536, 65536, 65022, 65022, 65279, 65279, 34439, 32639,
+    32639, 36752, 65279, 65279, 65022, 64765, 65279, 65279, 65022, 65022, 65536, 65536,
+    65279, 65279, 65279, 65279, 65279, 65279, 65279, 65279, 65022, 65022, 65279, 65279,
+    65022, 65022, 65022, 65022, 65279, 65536, 65022, 65022, 65279, 65279, 65279, 65279,
+    65022, 65022, 65022, 65022, 65279, 65279, 65022, 65022, 65279, 65279, 46775, 32639,
+    32639, 46775, 65279, 65279, 65022, 65022, 65279, 65279, 65279, 65022, 65279, 65279,
+    65279, 65279, 65279, 65279, 65279, 65279, 65279, 65279, 65022, 65022, 65279, 65279,
+    65279, 65279, 65279, 65279, 65022, 65022, 65279, 65279, 65022, 65279, 65022, 65279,
+    65536, 65279, 64765, 64765, 65279, 65536, 65279, 65279, 65022, 65022, 57312, 32639,
+    32639, 57055, 65279, 65279, 65022, 65022, 65022, 65022, 65536, 65279, 65536, 65279,
+    65022, 65022, 65279, 65279, 65022, 65022, 65279, 65279, 65022, 65022, 65279, 65279,
+    65279, 65279, 65279, 65279, 65022, 65022, 65279, 65279, 65279, 65536, 65279, 65279,
+    65279, 65279, 65279, 65022, 65279, 65279, 65279, 65536, 64765, 65022, 65279, 36752,
+    36752, 65279, 65279, 65279, 65022, 65022, 65022, 65022, 65279, 65536, 65279, 65536,
+    65022, 65022, 65279, 65279, 65022, 65022, 65279, 65279, 65022, 65022, 65279, 65279,
+};
+
+inline constexpr int32_t blend_add_offset_48[48 * 48] = {
+    163840, 98304, 98304, 32768, 32768, 32768, 32768, 98304, 32768, 32768, 32768, 32768,
+    98304, 98304, 32768, 32768, 98304, 98304, 98304, 32768, 32768, 98304, 32768, 7438337,
+    7372801, 98304, 98304, 98304, 98304, 98304, 163840, 98304, 98304, 163840, 98304, 98304,
+    163840, 229376, 98304, 98304, 98304, 98304, 163840, 98304, 229376, 163840, 98304, 98304,
+    32768, 32768, 32768, 32768, 32768, 32768, 98304, 98304, 32768, 32768, 32768, 32768,
+    32768, 98304, 98304, 98304, 32768, 32768, 32768, 98304, 32768, 98304, 2195456, 8421376,
+    8421376, 2129920, 32768, 163840, 32768, 98304, 98304, 98304, 98304, 98304, 98304, 163840,
+    163840, 163840, 98304, 98304, 98304, 98304, 98304, 163840, 163840, 229376, 98304, 98304,
+    98304, 32768, 32768, 32768, 32768, 32768, 32768, 98304, 32768, 98304, 163840, 163840,
+    98304, 32768, 32768, 163840, 98304, 32768, 32768, 98304, 32768, 98304, 4751360, 8421376,
+    8421376, 4751360, 32768, 98304, 32768, 98304, 98304, 98304, 163840, 163840, 32768, 163840,
+    229376, 229376, 98304, 98304, 163840, 163840, 163840, 229376, 98304, 98304, 98304, 98304,
+    98304, 163840, 32768, 32768, 98304, 32768, 32768, 98304, 32768, 98304, 98304, 98304,
+    98304, 98304, 98304, 98304, 98304, 163840, 98304, 98304, 32768, 98304, 7372801, 8421376,
+    8421376, 7897089, 32768, 98304, 98304, 98304, 163840, 98304, 163840, 229376, 98304, 98304,
+    163840, 163840, 98304, 98304, 163840, 163840, 163840, 98304, 98304, 98304, 163840, 163840,
+    32768, 32768, 32768, 32768, 32768, 32768, 32768, 98304, 32768, 32768, 98304, 98304,
+    32768, 32768, 98304, 32768, 32768, 32768, 32768, 98304, 32768, 2129920, 8421376, 8421376,
+    8421376, 8421376, 2129920, 32768, 32768, 98304, 163840, 32768, 163840, 163840, 98304, 98304,
+    98304, 32768, 229376, 229376, 163840, 163840, 98304, 98304, 98304, 98304, 98304, 98304,
+    32768, 163840, 32768, 32768, 98304, 32768, 98304, 98304, 98304, 98304, 32768, 32768,
+    98304, 32768, 32768, 32768, 32768, 98304, 32768, 32768, 98304, 5275648, 8421376, 8421376,
+    8421376, 8421376, 6324225, 32768, 32768, 98304, 32768, 98304, 163840, 163840, 32768, 98304,
+    98304, 98304, 163840, 229376, 229376, 229376, 98304, 98304, 32768, 32768, 98304, 98304,
+    98304, 32768, 32768, 32768, 98304, 32768, 229376, 98304, 98304, 98304, 32768, 32768,
+    98304, 98304, 98304, 163840, 163840, 32768, 32768, 163840, 1146880, 8421376, 8421376, 8421376,
+    8421376, 8421376, 8421376, 1081344, 32768, 98304, 32768, 32768, 32768, 98304, 163840, 163840,
+    98304, 98304, 98304, 98304, 98304, 98304, 98304, 98304, 98304, 98304, 98304, 98304,
+    32768, 32768, 32768, 32768, 163840, 32768, 98304, 163840, 98304, 98304, 32768, 32768,
+    98304, 229376, 98304, 98304, 98304, 32768, 98304, 98304, 5275648, 8421376, 8421376, 8421376,
+    8421376, 8421376, 8421376, 5341184, 98304, 163840, 32768, 98304, 98304, 98304, 229376, 163840,
+    98304, 98304, 163840, 163840, 98304, 98304, 98304, 98304, 98304, 98304, 98304, 98304,
+    163840, 32768, 32768, 98304, 163840, 98304, 163840, 98304, 98304, 163840, 163840, 98304,
+    98304, 98304, 163840, 98304, 163840, 163840, 98304, 1146880, 8421376, 8421376, 8421376, 8486912,
+    8421376, 8421376, 8421376, 8421376, 2129920, 163840, 98304, 163840, 32768, 98304, 163840, 98304,
+    229376, 163840, 163840, 229376, 229376, 229376, 163840, 163840, 98304, 98304, 163840, 163840,
+    98304, 32768, 32768, 98304, 98304, 98304, 32768, 163840, 98304, 32768, 98304, 98304,
+    32768, 98304, 32768, 98304, 32768, 98304, 98304, 7372801, 8421376, 8421376, 8421376, 8421376,
+    8421376, 8421376, 8421376, 8421376, 6324225, 98304, 98304, 98304, 98304, 98304, 98304, 98304,
+    98304, 98304, 229376, 229376, 229376, 163840, 229376, 163840, 98304, 98304, 163840, 163840,
+    163840, 98304, 32768, 32768, 98304, 163840, 32768, 98304, 98304, 32768, 32768, 32768,
+    163840, 98304, 98304, 163840, 32768, 98304, 4227072, 8421376, 8421376, 8421376, 8421376, 8421376,
+    8421376, 8421376, 8421376, 8421376, 8421376, 3702784, 32768, 32768, 163840, 163840, 229376, 98304,
+    163840, 163840, 98304, 163840, 163840, 163840, 98304, 98304, 163840, 163840, 98304, 98304,
+    32768, 32768, 98304, 32768, 32768, 98304, 98304, 229376, 32768, 98304, 163840, 32768,
+    163840, 32768, 163840, 98304, 32768, 1081344, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376,
+    8421376, 8421376, 8421376, 8421376, 8421376, 7897089, 1605632, 98304, 163840, 229376, 163840, 163840,
+    163840, 163840, 32768, 98304, 98304, 98304, 98304, 163840, 163840, 163840, 98304, 98304,
+    98304, 32768, 98304, 98304, 32768, 32768, 32768, 98304, 32768, 98304, 98304, 98304,
+    32768, 229376, 163840, 98304, 1081344, 7372801, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376,
+    8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 7372801, 557056, 98304, 98304, 32768, 98304,
+    98304, 98304, 163840, 163840, 98304, 98304, 163840, 163840, 163840, 163840, 98304, 163840,
+    98304, 32768, 98304, 32768, 32768, 98304, 32768, 98304, 32768, 98304, 32768, 98304,
+    98304, 98304, 98304, 98304, 6914049, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376,
+    8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 6324225, 163840, 98304, 98304, 98304,
+    98304, 98304, 163840, 163840, 98304, 98304, 163840, 163840, 163840, 163840, 98304, 163840,
+    98304, 98304, 98304, 32768, 32768, 98304, 32768, 32768, 32768, 32768, 98304, 32768,
+    163840, 98304, 98304, 5341184, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376,
+    8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 5275648, 98304, 32768, 98304,
+    98304, 98304, 229376, 98304, 98304, 98304, 98304, 163840, 163840, 163840, 98304, 98304,
+    32768, 32768, 32768, 98304, 98304, 32768, 32768, 98304, 32768, 98304, 32768, 32768,
+    98304, 98304, 5275648, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376,
+    8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 5275648, 32768, 98304,
+    98304, 98304, 229376, 98304, 98304, 98304, 98304, 98304, 163840, 163840, 98304, 98304,
+    32768, 163840, 32768, 98304, 98304, 32768, 32768, 98304, 32768, 32768, 32768, 98304,
+    557056, 6324225, 8421376, 8421376, 8421376, 8421376, 8486912, 8421376, 8421376, 8421376, 8421376, 8421376,
+    8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 6848513, 1081344,
+    163840, 163840, 98304, 98304, 98304, 98304, 229376, 294912, 229376, 163840, 32768, 98304,
+    98304, 32768, 98304, 98304, 32768, 98304, 98304, 98304, 98304, 32768, 32768, 1605632,
+    7372801, 8421376, 8421376, 8421376, 8421376, 8421376, 8486912, 8421376, 8421376, 8421376, 8421376, 8421376,
+    8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 7372801,
+    1146880, 294912, 163840, 98304, 98304, 98304, 163840, 98304, 163840, 163840, 98304, 98304,
+    98304, 32768, 32768, 98304, 98304, 32768, 32768, 98304, 32768, 32768, 3702784, 7897089,
+    8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376,
+    8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376,
+    8421376, 4358144, 98304, 98304, 163840, 229376, 163840, 229376, 229376, 98304, 98304, 32768,
+    163840, 98304, 32768, 98304, 32768, 32768, 163840, 98304, 2129920, 6324225, 8421376, 8421376,
+    8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376,
+    8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376,
+    8421376, 8421376, 7372801, 1081344, 163840, 229376, 163840, 163840, 163840, 163840, 98304, 98304,
+    32768, 98304, 32768, 32768, 32768, 32768, 1081344, 5341184, 8421376, 8421376, 8421376, 8421376,
+    8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376,
+    8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8486912, 8421376, 8421376, 8421376, 8421376, 8421376,
+    8421376, 8421376, 8421376, 8421376, 5275648, 1081344, 163840, 98304, 163840, 163840, 98304, 98304,
+    32768, 98304, 32768, 98304, 2195456, 6324225, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376,
+    8486912, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376,
+    8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376,
+    8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 5275648, 2129920, 98304, 163840, 98304, 98304,
+    32768, 2129920, 4751360, 7897089, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376,
+    8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376,
+    8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376,
+    8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 7372801, 4751360, 2129920, 294912,
+    7372801, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376,
+    8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376,
+    8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376,
+    8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 7438337,
+    7372801, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376,
+    8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376,
+    8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376,
+    8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 7372801,
+    98304, 2129920, 4751360, 7372801, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376,
+    8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376,
+    8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376,
+    8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 7897089, 4751360, 2129920, 98304,
+    98304, 229376, 32768, 98304, 2129920, 5275648, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376,
+    8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376,
+    8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376,
+    8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 6324225, 2129920, 163840, 163840, 98304, 98304,
+    32768, 98304, 98304, 32768, 32768, 163840, 1081344, 5341184, 8421376, 8421376, 8421376, 8421376,
+    8486912, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376,
+    8421376, 8486912, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376,
+    8421376, 8421376, 8421376, 8421376, 5341184, 1146880, 98304, 98304, 163840, 163840, 98304, 98304,
+    98304, 163840, 98304, 98304, 32768, 32768, 98304, 163840, 1081344, 7372801, 8421376, 8421376,
+    8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376,
+    8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376,
+    8421376, 8421376, 6324225, 2129920, 98304, 98304, 98304, 98304, 98304, 98304, 98304, 98304,
+    98304, 98304, 98304, 98304, 32768, 32768, 32768, 98304, 32768, 98304, 4227072, 8421376,
+    8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376,
+    8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376,
+    7962625, 3768320, 98304, 98304, 98304, 98304, 98304, 98304, 98304, 98304, 98304, 98304,
+    98304, 98304, 32768, 98304, 32768, 98304, 32768, 32768, 32768, 163840, 32768, 1081344,
+    7438337, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8486912, 8421376, 8421376, 8421376,
+    8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 7372801,
+    1605632, 98304, 98304, 98304, 163840, 163840, 98304, 98304, 163840, 163840, 98304, 98304,
+    98304, 98304, 32768, 98304, 32768, 98304, 32768, 98304, 32768, 32768, 32768, 32768,
+    1081344, 6848513, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376,
+    8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 6324225, 557056,
+    98304, 98304, 98304, 98304, 163840, 163840, 98304, 98304, 163840, 163840, 98304, 98304,
+    98304, 98304, 98304, 98304, 163840, 98304, 98304, 98304, 32768, 32768, 32768, 32768,
+    98304, 98304, 5275648, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8486912, 8421376, 8421376,
+    8421376, 8421376, 8421376, 8421376, 8486912, 8486912, 8421376, 8421376, 8421376, 5275648, 229376, 229376,
+    163840, 98304, 163840, 163840, 98304, 98304, 229376, 229376, 163840, 163840, 98304, 32768,
+    98304, 98304, 32768, 98304, 98304, 98304, 98304, 32768, 32768, 32768, 32768, 98304,
+    98304, 163840, 98304, 5275648, 8421376, 8421376, 8486912, 8421376, 8421376, 8486912, 8421376, 8421376,
+    8421376, 8421376, 8421376, 8421376, 8486912, 8486912, 8421376, 8421376, 5275648, 98304, 294912, 294912,
+    163840, 163840, 163840, 163840, 98304, 98304, 229376, 229376, 98304, 163840, 98304, 98304,
+    98304, 98304, 163840, 163840, 98304, 163840, 229376, 229376, 163840, 163840, 163840, 163840,
+    98304, 98304, 98304, 98304, 6389761, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376,
+    8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 6848513, 163840, 163840, 229376, 229376,
+    98304, 32768, 98304, 163840, 163840, 163840, 229376, 229376, 98304, 98304, 229376, 229376,
+    98304, 98304, 163840, 163840, 98304, 98304, 294912, 229376, 163840, 229376, 163840, 229376,
+    98304, 98304, 98304, 98304, 688128, 7438337, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376,
+    8486912, 8421376, 8421376, 8421376, 8421376, 8421376, 7372801, 1081344, 163840, 229376, 229376, 229376,
+    98304, 98304, 98304, 163840, 163840, 163840, 294912, 229376, 32768, 98304, 229376, 229376,
+    163840, 163840, 163840, 98304, 163840, 163840, 32768, 32768, 163840, 229376, 163840, 229376,
+    163840, 163840, 32768, 98304, 163840, 1671168, 7897089, 8421376, 8421376, 8421376, 8421376, 8421376,
+    8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 1081344, 32768, 163840, 163840, 32768, 32768,
+    98304, 98304, 163840, 229376, 163840, 98304, 32768, 32768, 98304, 98304, 98304, 98304,
+    163840, 163840, 163840, 163840, 229376, 163840, 98304, 98304, 163840, 163840, 163840, 163840,
+    163840, 163840, 98304, 98304, 163840, 163840, 3702784, 8421376, 8421376, 8421376, 8421376, 8421376,
+    8421376, 8421376, 8421376, 8421376, 8421376, 4227072, 98304, 98304, 229376, 163840, 98304, 32768,
+    98304, 98304, 229376, 229376, 98304, 163840, 98304, 32768, 32768, 32768, 98304, 98304,
+    163840, 98304, 98304, 98304, 98304, 98304, 98304, 98304, 98304, 98304, 98304, 98304,
+    32768, 98304, 163840, 163840, 163840, 163840, 32768, 6324225, 8421376, 8421376, 8421376, 8421376,
+    8421376, 8421376, 8421376, 8421376, 7372801, 98304, 98304, 98304, 163840, 163840, 32768, 163840,
+    98304, 98304, 163840, 98304, 98304, 32768, 98304, 32768, 32768, 98304, 98304, 98304,
+    163840, 163840, 98304, 98304, 98304, 98304, 98304, 98304, 98304, 98304, 98304, 98304,
+    98304, 98304, 163840, 163840, 229376, 163840, 98304, 2129920, 8421376, 8421376, 8421376, 8421376,
+    8421376, 8421376, 8421376, 8421376, 1081344, 98304, 98304, 32768, 163840, 163840, 98304, 163840,
+    98304, 98304, 98304, 98304, 98304, 163840, 98304, 98304, 98304, 98304, 98304, 98304,
+    98304, 98304, 98304, 98304, 98304, 98304, 98304, 98304, 163840, 163840, 32768, 32768,
+    98304, 32768, 163840, 163840, 163840, 98304, 98304, 32768, 5275648, 8421376, 8421376, 8421376,
+    8421376, 8421376, 8421376, 5275648, 98304, 98304, 98304, 98304, 163840, 229376, 32768, 98304,
+    98304, 98304, 98304, 98304, 98304, 98304, 163840, 163840, 98304, 98304, 98304, 98304,
+    98304, 98304, 98304, 98304, 98304, 98304, 98304, 98304, 163840, 163840, 32768, 98304,
+    98304, 163840, 163840, 163840, 98304, 98304, 32768, 98304, 1081344, 8421376, 8421376, 8421376,
+    8421376, 8421376, 8421376, 1081344, 98304, 98304, 98304, 98304, 163840, 163840, 163840, 98304,
+    98304, 98304, 98304, 98304, 98304, 98304, 163840, 163840, 98304, 98304, 98304, 98304,
+    163840, 163840, 163840, 163840, 163840, 163840, 98304, 98304, 98304, 163840, 98304, 98304,
+    98304, 163840, 163840, 98304, 98304, 98304, 98304, 98304, 32768, 6389761, 8486912, 8486912,
+    8421376, 8421376, 5275648, 98304, 163840, 163840, 163840, 98304, 98304, 98304, 98304, 98304,
+    163840, 163840, 98304, 98304, 98304, 98304, 98304, 98304, 163840, 163840, 98304, 98304,
+    163840, 163840, 163840, 163840, 163840, 163840, 98304, 98304, 98304, 98304, 98304, 32768,
+    163840, 163840, 98304, 32768, 98304, 98304, 163840, 229376, 98304, 2129920, 8486912, 8421376,
+    8421376, 8421376, 2129920, 98304, 163840, 163840, 32768, 98304, 98304, 98304, 98304, 98304,
+    163840, 163840, 98304, 98304, 98304, 98304, 98304, 98304, 163840, 163840, 98304, 98304,
+    163840, 163840, 163840, 163840, 98304, 98304, 163840, 98304, 98304, 98304, 98304, 98304,
+    163840, 163840, 163840, 163840, 32768, 32768, 163840, 163840, 98304, 98304, 7962625, 8421376,
+    8421376, 7372801, 98304, 98304, 163840, 229376, 98304, 98304, 163840, 163840, 32768, 32768,
+    98304, 98304, 98304, 98304, 98304, 98304, 98304, 98304, 163840, 163840, 98304, 98304,
+    163840, 163840, 163840, 163840, 98304, 32768, 163840, 163840, 98304, 98304, 98304, 98304,
+    163840, 163840, 163840, 163840, 98304, 98304, 163840, 163840, 98304, 98304, 4816896, 8421376,
+    8421376, 4816896, 98304, 98304, 163840, 163840, 98304, 98304, 98304, 163840, 98304, 98304,
+    98304, 98304, 98304, 98304, 98304, 98304, 98304, 98304, 163840, 163840, 98304, 98304,
+    98304, 98304, 98304, 98304, 163840, 163840, 98304, 98304, 163840, 98304, 163840, 98304,
+    32768, 98304, 229376, 229376, 98304, 32768, 98304, 98304, 163840, 163840, 2129920, 8421376,
+    8421376, 2195456, 98304, 98304, 163840, 163840, 163840, 163840, 32768, 98304, 32768, 98304,
+    163840, 163840, 98304, 98304, 163840, 163840, 98304, 98304, 163840, 163840, 98304, 98304,
+    98304, 98304, 98304, 98304, 163840, 163840, 98304, 98304, 98304, 32768, 98304, 98304,
+    98304, 98304, 98304, 163840, 98304, 98304, 98304, 32768, 229376, 163840, 98304, 7372801,
+    7372801, 98304, 98304, 98304, 163840, 163840, 163840, 163840, 98304, 32768, 98304, 32768,
+    163840, 163840, 98304, 98304, 163840, 163840, 98304, 98304, 163840, 163840, 98304, 98304,
+};
+
+// alpha_map_96 (96x96)
+inline constexpr int alpha_map_96_size = 96;
+
+alignas(64) inline constexpr float alpha_map_96[96 * 96] = {
+    0.0156862754f, 0.011764707f, 0.0156862754f, 0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f, 0.0156862754f,
+    0.0f, 0.011764707f, 0.011764707f, 0.0156862754f, 0.011764707f, 0.00784313772f, 0.0196078438f, 0.00784313772f,
+    0.00784313772f, 0.00784313772f, 0.0f, 0.00784313772f, 0.00392156886f, 0.00392156886f, 0.00392156886f, 0.00392156886f,
+    0.011764707f, 0.00784313772f, 0.011764707f, 0.0156862754f, 0.00784313772f, 0.011764707f, 0.011764707f, 0.011764707f,
+    0.011764707f, 0.011764707f, 0.011764707f, 0.00784313772f, 0.011764707f, 0.00784313772f, 0.0f, 0.00392156886f,
+    0.00392156886f, 0.00392156886f, 0.00392156886f, 0.00392156886f, 0.00784313772f, 0.00784313772f, 0.223529428f, 0.474509835f,
+    0.443137288f, 0.231372565f, 0.00392156886f, 0.011764707f, 0.0f, 0.00784313772f, 0.00392156886f, 0.00784313772f,
+    0.0156862754f, 0.0156862754f, 0.00784313772f, 0.0156862754f, 0.011764707f, 0.011764707f, 0.0156862754f, 0.011764707f,
+    0.011764707f, 0.011764707f, 0.00784313772f, 0.0156862754f, 0.0156862754f, 0.0156862754f, 0.00784313772f, 0.011764707f,
+    0.00392156886f, 0.011764707f, 0.00784313772f, 0.00784313772f, 0.00392156886f, 0.00784313772f, 0.011764707f, 0.011764707f,
+    0.00784313772f, 0.011764707f, 0.011764707f, 0.0156862754f, 0.011764707f, 0.011764707f, 0.0156862754f, 0.0156862754f,
+    0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f, 0.0156862754f, 0.0196078438f, 0.0156862754f, 0.0156862754f,
+    0.011764707f, 0.0156862754f, 0.00784313772f, 0.011764707f, 0.00392156886f, 0.011764707f, 0.011764707f, 0.0156862754f,
+    0.00784313772f, 0.00784313772f, 0.011764707f, 0.011764707f, 0.00392156886f, 0.00784313772f, 0.0156862754f, 0.011764707f,
+    0.00784313772f, 0.00784313772f, 0.00392156886f, 0.00392156886f, 0.0f, 0.00392156886f, 0.0f, 0.0f,
+    0.00784313772f, 0.00784313772f, 0.011764707f, 0.011764707f, 0.00392156886f, 0.011764707f, 0.011764707f, 0.00784313772f,
+    0.011764707f, 0.0196078438f, 0.011764707f, 0.011764707f, 0.00392156886f, 0.0f, 0.0f, 0.0f,
+    0.00392156886f, 0.0f, 0.0f, 0.0f, 0.00784313772f, 0.0627451017f, 0.501960814f, 0.501960814f,
+    0.505882382f, 0.505882382f, 0.0352941193f, 0.00784313772f, 0.0f, 0.00392156886f, 0.00784313772f, 0.00784313772f,
+    0.00784313772f, 0.011764707f, 0.011764707f, 0.00784313772f, 0.00784313772f, 0.00784313772f, 0.011764707f, 0.0156862754f,
+    0.011764707f, 0.011764707f, 0.00392156886f, 0.00392156886f, 0.00784313772f, 0.00784313772f, 0.00784313772f, 0.00392156886f,
+    0.00784313772f, 0.0f, 0.00784313772f, 0.0f, 0.00392156886f, 0.00392156886f, 0.0156862754f, 0.0156862754f,
+    0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f, 0.00784313772f, 0.011764707f, 0.0156862754f, 0.011764707f,
+    0.011764707f, 0.011764707f, 0.0235294141f, 0.0196078438f, 0.0156862754f, 0.0196078438f, 0.0156862754f, 0.0196078438f,
+    0.00392156886f, 0.0f, 0.00784313772f, 0.00392156886f, 0.00784313772f, 0.0156862754f, 0.011764707f, 0.00784313772f,
+    0.0f, 0.00392156886f, 0.00392156886f, 0.011764707f, 0.00392156886f, 0.00392156886f, 0.00392156886f, 0.00392156886f,
+    0.00784313772f, 0.00784313772f, 0.00392156886f, 0.0f, 0.00392156886f, 0.00392156886f, 0.0f, 0.00392156886f,
+    0.00392156886f, 0.00392156886f, 0.0f, 0.00392156886f, 0.00784313772f, 0.00784313772f, 0.00784313772f, 0.011764707f,
+    0.011764707f, 0.0156862754f, 0.011764707f, 0.011764707f, 0.0f, 0.00392156886f, 0.0f, 0.00392156886f,
+    0.0f, 0.0f, 0.00392156886f, 0.00784313772f, 0.00784313772f, 0.160784319f, 0.501960814f, 0.501960814f,
+    0.505882382f, 0.501960814f, 0.192156881f, 0.0f, 0.0f, 0.00392156886f, 0.00784313772f, 0.00392156886f,
+    0.0f, 0.0f, 0.00392156886f, 0.00392156886f, 0.00784313772f, 0.0196078438f, 0.0156862754f, 0.011764707f,
+    0.0156862754f, 0.0156862754f, 0.00784313772f, 0.0f, 0.00392156886f, 0.00784313772f, 0.00784313772f, 0.011764707f,
+    0.0156862754f, 0.0156862754f, 0.00784313772f, 0.011764707f, 0.0196078438f, 0.011764707f, 0.00784313772f, 0.00784313772f,
+    0.0156862754f, 0.0156862754f, 0.011764707f, 0.011764707f, 0.011764707f, 0.0156862754f, 0.0156862754f, 0.0156862754f,
+    0.011764707f, 0.00784313772f, 0.0156862754f, 0.011764707f, 0.0156862754f, 0.0156862754f, 0.011764707f, 0.011764707f,
+    0.0f, 0.00392156886f, 0.00392156886f, 0.00784313772f, 0.00784313772f, 0.0196078438f, 0.00784313772f, 0.011764707f,
+    0.0f, 0.00392156886f, 0.00784313772f, 0.00784313772f, 0.0f, 0.0f, 0.0f, 0.00784313772f,
+    0.00784313772f, 0.00392156886f, 0.0f, 0.00392156886f, 0.0f, 0.00392156886f, 0.00392156886f, 0.0f,
+    0.00392156886f, 0.00784313772f, 0.00392156886f, 0.00392156886f, 0.0f, 0.00392156886f, 0.0156862754f, 0.011764707f,
+    0.00784313772f, 0.0156862754f, 0.00392156886f, 0.00784313772f, 0.0f, 0.00392156886f, 0.0f, 0.0f,
+    0.0f, 0.00392156886f, 0.00784313772f, 0.00784313772f, 0.011764707f, 0.321568638f, 0.501960814f, 0.501960814f,
+    0.505882382f, 0.505882382f, 0.313725501f, 0.00392156886f, 0.00392156886f, 0.00392156886f, 0.00392156886f, 0.00392156886f,
+    0.0f, 0.0f, 0.00392156886f, 0.00784313772f, 0.0156862754f, 0.0156862754f, 0.011764707f, 0.00784313772f,
+    0.011764707f, 0.0156862754f, 0.0156862754f, 0.00784313772f, 0.00784313772f, 0.011764707f, 0.00784313772f, 0.011764707f,
+    0.0156862754f, 0.0156862754f, 0.0156862754f, 0.0156862754f, 0.011764707f, 0.0156862754f, 0.00784313772f, 0.011764707f,
+    0.0156862754f, 0.0196078438f, 0.0156862754f, 0.00784313772f, 0.00392156886f, 0.011764707f, 0.011764707f, 0.0196078438f,
+    0.0156862754f, 0.011764707f, 0.0156862754f, 0.011764707f, 0.0196078438f, 0.0156862754f, 0.011764707f, 0.011764707f,
+    0.0f, 0.0f, 0.00392156886f, 0.011764707f, 0.0196078438f, 0.0156862754f, 0.0156862754f, 0.011764707f,
+    0.00392156886f, 0.00784313772f, 0.00392156886f, 0.00392156886f, 0.0f, 0.0f, 0.011764707f, 0.00392156886f,
+    0.011764707f, 0.011764707f, 0.0f, 0.00784313772f, 0.00392156886f, 0.00392156886f, 0.0f, 0.00784313772f,
+    0.0f, 0.00392156886f, 0.0f, 0.0f, 0.0f, 0.00784313772f, 0.0156862754f, 0.011764707f,
+    0.00784313772f, 0.00784313772f, 0.011764707f, 0.00784313772f, 0.00784313772f, 0.00392156886f, 0.0156862754f, 0.011764707f,
+    0.0f, 0.00392156886f, 0.0f, 0.00392156886f, 0.011764707f, 0.447058856f, 0.501960814f, 0.501960814f,
+    0.501960814f, 0.501960814f, 0.474509835f, 0.00784313772f, 0.011764707f, 0.00392156886f, 0.00784313772f, 0.011764707f,
+    0.00392156886f, 0.00784313772f, 0.011764707f, 0.011764707f, 0.0156862754f, 0.0156862754f, 0.0156862754f, 0.011764707f,
+    0.0156862754f, 0.0156862754f, 0.011764707f, 0.00784313772f, 0.00392156886f, 0.00392156886f, 0.011764707f, 0.0156862754f,
+    0.0196078438f, 0.0156862754f, 0.0156862754f, 0.0156862754f, 0.0156862754f, 0.0156862754f, 0.0156862754f, 0.011764707f,
+    0.011764707f, 0.011764707f, 0.00392156886f, 0.0f, 0.011764707f, 0.00784313772f, 0.011764707f, 0.0156862754f,
+    0.011764707f, 0.011764707f, 0.00784313772f, 0.0196078438f, 0.0156862754f, 0.0196078438f, 0.0156862754f, 0.011764707f,
+    0.00392156886f, 0.0f, 0.011764707f, 0.011764707f, 0.011764707f, 0.0156862754f, 0.0156862754f, 0.0156862754f,
+    0.011764707f, 0.00784313772f, 0.0156862754f, 0.0156862754f, 0.0f, 0.00392156886f, 0.00392156886f, 0.00392156886f,
+    0.00784313772f, 0.011764707f, 0.00784313772f, 0.00392156886f, 0.0f, 0.00784313772f, 0.00784313772f, 0.00392156886f,
+    0.00392156886f, 0.00392156886f, 0.00392156886f, 0.0f, 0.00392156886f, 0.00784313772f, 0.0156862754f, 0.0156862754f,
+    0.0156862754f, 0.0156862754f, 0.00392156886f, 0.0156862754f, 0.0196078438f, 0.00784313772f, 0.0156862754f, 0.0f,
+    0.00784313772f, 0.0156862754f, 0.00784313772f, 0.00784313772f, 0.129411772f, 0.505882382f, 0.501960814f, 0.501960814f,
+    0.501960814f, 0.501960814f, 0.501960814f, 0.13333334f, 0.00784313772f, 0.00784313772f, 0.00784313772f, 0.011764707f,
+    0.011764707f, 0.00784313772f, 0.00392156886f, 0.00784313772f, 0.011764707f, 0.0156862754f, 0.011764707f, 0.011764707f,
+    0.011764707f, 0.0156862754f, 0.011764707f, 0.00784313772f, 0.00784313772f, 0.00392156886f, 0.011764707f, 0.011764707f,
+    0.011764707f, 0.0156862754f, 0.0156862754f, 0.0156862754f, 0.0196078438f, 0.011764707f, 0.00784313772f, 0.011764707f,
+    0.0156862754f, 0.0156862754f, 0.00784313772f, 0.00392156886f, 0.011764707f, 0.0156862754f, 0.011764707f, 0.011764707f,
+    0.011764707f, 0.011764707f, 0.0156862754f, 0.0156862754f, 0.011764707f, 0.0156862754f, 0.011764707f, 0.011764707f,
+    0.00392156886f, 0.00784313772f, 0.00392156886f, 0.00392156886f, 0.0156862754f, 0.0156862754f, 0.011764707f, 0.011764707f,
+    0.0156862754f, 0.011764707f, 0.0f, 0.00392156886f, 0.0f, 0.00784313772f, 0.00784313772f, 0.00392156886f,
+    0.00392156886f, 0.011764707f, 0.00392156886f, 0.00392156886f, 0.00784313772f, 0.011764707f, 0.011764707f, 0.011764707f,
+    0.011764707f, 0.00784313772f, 0.0f, 0.00392156886f, 0.00784313772f, 0.011764707f, 0.00784313772f, 0.00784313772f,
+    0.00784313772f, 0.011764707f, 0.00784313772f, 0.00392156886f, 0.0156862754f, 0.00784313772f, 0.00392156886f, 0.00784313772f,
+    0.00392156886f, 0.00784313772f, 0.00784313772f, 0.00784313772f, 0.321568638f, 0.505882382f, 0.501960814f, 0.501960814f,
+    0.501960814f, 0.505882382f, 0.501960814f, 0.286274523f, 0.00784313772f, 0.00784313772f, 0.00784313772f, 0.00784313772f,
+    0.0156862754f, 0.011764707f, 0.00784313772f, 0.00392156886f, 0.00784313772f, 0.00784313772f, 0.011764707f, 0.011764707f,
+    0.0196078438f, 0.011764707f, 0.0156862754f, 0.00784313772f, 0.00784313772f, 0.011764707f, 0.00784313772f, 0.011764707f,
+    0.011764707f, 0.011764707f, 0.011764707f, 0.0156862754f, 0.011764707f, 0.00784313772f, 0.00784313772f, 0.011764707f,
+    0.011764707f, 0.011764707f, 0.00784313772f, 0.011764707f, 0.00784313772f, 0.011764707f, 0.0235294141f, 0.0196078438f,
+    0.0156862754f, 0.0156862754f, 0.011764707f, 0.011764707f, 0.011764707f, 0.0156862754f, 0.011764707f, 0.011764707f,
+    0.00392156886f, 0.011764707f, 0.00784313772f, 0.00784313772f, 0.011764707f, 0.011764707f, 0.00784313772f, 0.0156862754f,
+    0.0156862754f, 0.00784313772f, 0.00784313772f, 0.00392156886f, 0.00784313772f, 0.011764707f, 0.0156862754f, 0.00392156886f,
+    0.00392156886f, 0.0f, 0.00784313772f, 0.011764707f, 0.011764707f, 0.011764707f, 0.00392156886f, 0.00784313772f,
+    0.011764707f, 0.0f, 0.00784313772f, 0.00784313772f, 0.00784313772f, 0.00784313772f, 0.00392156886f, 0.00392156886f,
+    0.011764707f, 0.00392156886f, 0.00392156886f, 0.00392156886f, 0.0f, 0.00392156886f, 0.00392156886f, 0.00392156886f,
+    0.00392156886f, 0.00784313772f, 0.00784313772f, 0.00392156886f, 0.443137288f, 0.505882382f, 0.501960814f, 0.501960814f,
+    0.505882382f, 0.501960814f, 0.501960814f, 0.474509835f, 0.00784313772f, 0.00784313772f, 0.00784313772f, 0.00784313772f,
+    0.0156862754f, 0.011764707f, 0.011764707f, 0.0156862754f, 0.011764707f, 0.00784313772f, 0.011764707f, 0.00784313772f,
+    0.011764707f, 0.011764707f, 0.00392156886f, 0.00784313772f, 0.00784313772f, 0.00784313772f, 0.00784313772f, 0.00392156886f,
+    0.011764707f, 0.0156862754f, 0.011764707f, 0.011764707f, 0.0156862754f, 0.00784313772f, 0.00392156886f, 0.011764707f,
+    0.011764707f, 0.00784313772f, 0.011764707f, 0.0156862754f, 0.011764707f, 0.0156862754f, 0.011764707f, 0.0196078438f,
+    0.0196078438f, 0.0156862754f, 0.0156862754f, 0.0156862754f, 0.011764707f, 0.0156862754f, 0.011764707f, 0.011764707f,
+    0.011764707f, 0.00784313772f, 0.00784313772f, 0.00784313772f, 0.00392156886f, 0.00784313772f, 0.0156862754f, 0.011764707f,
+    0.00392156886f, 0.011764707f, 0.00784313772f, 0.011764707f, 0.00784313772f, 0.00784313772f, 0.0156862754f, 0.00392156886f,
+    0.00392156886f, 0.00784313772f, 0.011764707f, 0.0156862754f, 0.00392156886f, 0.00784313772f, 0.00784313772f, 0.00784313772f,
+    0.00784313772f, 0.0f, 0.00784313772f, 0.00784313772f, 0.00784313772f, 0.011764707f, 0.00784313772f, 0.011764707f,
+    0.0156862754f, 0.011764707f, 0.00784313772f, 0.00392156886f, 0.00392156886f, 0.00392156886f, 0.00784313772f, 0.00392156886f,
+    0.0156862754f, 0.011764707f, 0.011764707f, 0.164705887f, 0.501960814f, 0.505882382f, 0.501960814f, 0.501960814f,
+    0.505882382f, 0.505882382f, 0.501960814f, 0.501960814f, 0.129411772f, 0.011764707f, 0.00784313772f, 0.00392156886f,
+    0.011764707f, 0.011764707f, 0.00784313772f, 0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f,
+    0.00784313772f, 0.011764707f, 0.00784313772f, 0.00392156886f, 0.00392156886f, 0.00392156886f, 0.00392156886f, 0.011764707f,
+    0.011764707f, 0.00784313772f, 0.0156862754f, 0.00784313772f, 0.00392156886f, 0.0f, 0.00392156886f, 0.00392156886f,
+    0.0156862754f, 0.011764707f, 0.011764707f, 0.0156862754f, 0.011764707f, 0.00784313772f, 0.0156862754f, 0.0196078438f,
+    0.0156862754f, 0.00784313772f, 0.00784313772f, 0.0156862754f, 0.0156862754f, 0.0196078438f, 0.0156862754f, 0.0156862754f,
+    0.00392156886f, 0.011764707f, 0.00392156886f, 0.00392156886f, 0.0f, 0.00392156886f, 0.011764707f, 0.00784313772f,
+    0.00392156886f, 0.011764707f, 0.00392156886f, 0.00784313772f, 0.00784313772f, 0.011764707f, 0.00784313772f, 0.00784313772f,
+    0.00392156886f, 0.00784313772f, 0.011764707f, 0.0156862754f, 0.00784313772f, 0.011764707f, 0.0f, 0.00392156886f,
+    0.0f, 0.00784313772f, 0.00784313772f, 0.00784313772f, 0.00784313772f, 0.00784313772f, 0.00784313772f, 0.00784313772f,
+    0.011764707f, 0.011764707f, 0.00392156886f, 0.00392156886f, 0.0f, 0.00392156886f, 0.00392156886f, 0.00392156886f,
+    0.00784313772f, 0.011764707f, 0.011764707f, 0.349019617f, 0.505882382f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.505882382f, 0.505882382f, 0.501960814f, 0.501960814f, 0.380392194f, 0.00784313772f, 0.0f, 0.00392156886f,
+    0.011764707f, 0.0156862754f, 0.0156862754f, 0.011764707f, 0.011764707f, 0.011764707f, 0.00784313772f, 0.00784313772f,
+    0.011764707f, 0.00784313772f, 0.00392156886f, 0.00392156886f, 0.0f, 0.00784313772f, 0.00784313772f, 0.011764707f,
+    0.00784313772f, 0.011764707f, 0.00784313772f, 0.0156862754f, 0.0f, 0.00392156886f, 0.00784313772f, 0.00784313772f,
+    0.011764707f, 0.0156862754f, 0.0156862754f, 0.0156862754f, 0.0156862754f, 0.0156862754f, 0.0196078438f, 0.0156862754f,
+    0.00784313772f, 0.0156862754f, 0.011764707f, 0.011764707f, 0.011764707f, 0.0235294141f, 0.0156862754f, 0.0156862754f,
+    0.011764707f, 0.00784313772f, 0.0156862754f, 0.011764707f, 0.00392156886f, 0.00392156886f, 0.00392156886f, 0.00392156886f,
+    0.011764707f, 0.011764707f, 0.00784313772f, 0.00784313772f, 0.00392156886f, 0.00392156886f, 0.00392156886f, 0.00784313772f,
+    0.011764707f, 0.011764707f, 0.00784313772f, 0.0156862754f, 0.00392156886f, 0.00392156886f, 0.00392156886f, 0.00392156886f,
+    0.00392156886f, 0.011764707f, 0.00784313772f, 0.0156862754f, 0.00784313772f, 0.00784313772f, 0.00392156886f, 0.0156862754f,
+    0.011764707f, 0.011764707f, 0.00392156886f, 0.00392156886f, 0.0f, 0.00392156886f, 0.0f, 0.00392156886f,
+    0.00784313772f, 0.0156862754f, 0.0666666701f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.501960814f, 0.505882382f, 0.501960814f, 0.501960814f, 0.501960814f, 0.0666666701f, 0.00392156886f, 0.00784313772f,
+    0.00784313772f, 0.00784313772f, 0.011764707f, 0.00392156886f, 0.00784313772f, 0.00784313772f, 0.00784313772f, 0.00392156886f,
+    0.00392156886f, 0.00392156886f, 0.00392156886f, 0.011764707f, 0.00392156886f, 0.00392156886f, 0.00392156886f, 0.00784313772f,
+    0.00784313772f, 0.00392156886f, 0.00784313772f, 0.00784313772f, 0.00784313772f, 0.0156862754f, 0.0156862754f, 0.011764707f,
+    0.011764707f, 0.011764707f, 0.011764707f, 0.00784313772f, 0.0156862754f, 0.0156862754f, 0.011764707f, 0.00784313772f,
+    0.011764707f, 0.011764707f, 0.011764707f, 0.0156862754f, 0.00784313772f, 0.011764707f, 0.00784313772f, 0.011764707f,
+    0.011764707f, 0.00784313772f, 0.011764707f, 0.011764707f, 0.00392156886f, 0.00392156886f, 0.00392156886f, 0.00392156886f,
+    0.00784313772f, 0.011764707f, 0.00392156886f, 0.00784313772f, 0.00784313772f, 0.00392156886f, 0.00392156886f, 0.00784313772f,
+    0.011764707f, 0.011764707f, 0.00784313772f, 0.00784313772f, 0.00392156886f, 0.011764707f, 0.00392156886f, 0.0f,
+    0.00784313772f, 0.0156862754f, 0.011764707f, 0.011764707f, 0.00784313772f, 0.00784313772f, 0.011764707f, 0.011764707f,
+    0.00784313772f, 0.011764707f, 0.00392156886f, 0.00784313772f, 0.00392156886f, 0.00392156886f, 0.00392156886f, 0.00392156886f,
+    0.00784313772f, 0.011764707f, 0.313725501f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.505882382f,
+    0.501960814f, 0.505882382f, 0.501960814f, 0.501960814f, 0.501960814f, 0.258823544f, 0.00784313772f, 0.00784313772f,
+    0.00392156886f, 0.0f, 0.00784313772f, 0.0156862754f, 0.011764707f, 0.0156862754f, 0.00784313772f, 0.00784313772f,
+    0.00784313772f, 0.00784313772f, 0.00392156886f, 0.00784313772f, 0.00392156886f, 0.00392156886f, 0.011764707f, 0.00784313772f,
+    0.00784313772f, 0.011764707f, 0.0f, 0.00784313772f, 0.00392156886f, 0.0156862754f, 0.0156862754f, 0.0156862754f,
+    0.011764707f, 0.011764707f, 0.00784313772f, 0.00784313772f, 0.011764707f, 0.0156862754f, 0.00392156886f, 0.011764707f,
+    0.00392156886f, 0.011764707f, 0.00784313772f, 0.011764707f, 0.011764707f, 0.011764707f, 0.0156862754f, 0.0196078438f,
+    0.00392156886f, 0.00392156886f, 0.00392156886f, 0.00784313772f, 0.0f, 0.00392156886f, 0.00784313772f, 0.00784313772f,
+    0.00784313772f, 0.0f, 0.0f, 0.00392156886f, 0.00784313772f, 0.011764707f, 0.0f, 0.00784313772f,
+    0.00392156886f, 0.00784313772f, 0.00392156886f, 0.0f, 0.011764707f, 0.011764707f, 0.011764707f, 0.0f,
+    0.0f, 0.00392156886f, 0.011764707f, 0.00784313772f, 0.011764707f, 0.011764707f, 0.011764707f, 0.00784313772f,
+    0.0f, 0.00392156886f, 0.00784313772f, 0.00392156886f, 0.00784313772f, 0.0f, 0.0f, 0.00784313772f,
+    0.0f, 0.0666666701f, 0.505882382f, 0.505882382f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.501960814f, 0.505882382f, 0.501960814f, 0.501960814f, 0.501960814f, 0.474509835f, 0.0313725509f, 0.00392156886f,
+    0.00392156886f, 0.00784313772f, 0.00784313772f, 0.00784313772f, 0.00784313772f, 0.00784313772f, 0.00784313772f, 0.00392156886f,
+    0.0f, 0.011764707f, 0.00784313772f, 0.00392156886f, 0.00784313772f, 0.00392156886f, 0.0156862754f, 0.011764707f,
+    0.011764707f, 0.00784313772f, 0.00392156886f, 0.00784313772f, 0.00392156886f, 0.0156862754f, 0.011764707f, 0.00784313772f,
+    0.00784313772f, 0.00784313772f, 0.011764707f, 0.011764707f, 0.00784313772f, 0.0156862754f, 0.0156862754f, 0.0156862754f,
+    0.011764707f, 0.0156862754f, 0.0156862754f, 0.0235294141f, 0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f,
+    0.00392156886f, 0.00784313772f, 0.0f, 0.00784313772f, 0.00392156886f, 0.0f, 0.00784313772f, 0.011764707f,
+    0.00784313772f, 0.00392156886f, 0.0f, 0.00784313772f, 0.011764707f, 0.011764707f, 0.00784313772f, 0.00784313772f,
+    0.00784313772f, 0.00784313772f, 0.00392156886f, 0.00784313772f, 0.00784313772f, 0.011764707f, 0.0f, 0.0f,
+    0.00392156886f, 0.00784313772f, 0.011764707f, 0.00784313772f, 0.011764707f, 0.00784313772f, 0.011764707f, 0.011764707f,
+    0.00784313772f, 0.00392156886f, 0.00392156886f, 0.00392156886f, 0.0f, 0.00784313772f, 0.00392156886f, 0.00784313772f,
+    0.011764707f, 0.254901975f, 0.501960814f, 0.505882382f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.505882382f, 0.505882382f, 0.505882382f, 0.501960814f, 0.501960814f, 0.501960814f, 0.254901975f, 0.00784313772f,
+    0.00784313772f, 0.00784313772f, 0.00392156886f, 0.0156862754f, 0.0156862754f, 0.0156862754f, 0.00784313772f, 0.00392156886f,
+    0.00392156886f, 0.00784313772f, 0.011764707f, 0.00392156886f, 0.00392156886f, 0.00784313772f, 0.0156862754f, 0.011764707f,
+    0.0156862754f, 0.011764707f, 0.00784313772f, 0.00392156886f, 0.00392156886f, 0.00392156886f, 0.00784313772f, 0.00784313772f,
+    0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f, 0.00784313772f, 0.011764707f, 0.011764707f, 0.011764707f,
+    0.00784313772f, 0.0156862754f, 0.0156862754f, 0.0196078438f, 0.0156862754f, 0.011764707f, 0.011764707f, 0.011764707f,
+    0.00784313772f, 0.00392156886f, 0.00392156886f, 0.00392156886f, 0.011764707f, 0.0156862754f, 0.00392156886f, 0.00392156886f,
+    0.00392156886f, 0.00784313772f, 0.00392156886f, 0.00784313772f, 0.011764707f, 0.0156862754f, 0.00784313772f, 0.00392156886f,
+    0.00784313772f, 0.00784313772f, 0.00784313772f, 0.00392156886f, 0.011764707f, 0.0156862754f, 0.0f, 0.0f,
+    0.00392156886f, 0.00784313772f, 0.011764707f, 0.011764707f, 0.011764707f, 0.0156862754f, 0.011764707f, 0.011764707f,
+    0.0f, 0.00392156886f, 0.0f, 0.00392156886f, 0.0f, 0.0f, 0.0156862754f, 0.0156862754f,
+    0.0705882385f, 0.443137288f, 0.505882382f, 0.505882382f, 0.501960814f, 0.501960814f, 0.501960814f, 0.505882382f,
+    0.505882382f, 0.505882382f, 0.509803951f, 0.505882382f, 0.505882382f, 0.501960814f, 0.474509835f, 0.0352941193f,
+    0.00784313772f, 0.0196078438f, 0.0156862754f, 0.0156862754f, 0.011764707f, 0.00784313772f, 0.0156862754f, 0.0156862754f,
+    0.00784313772f, 0.011764707f, 0.00784313772f, 0.0156862754f, 0.00392156886f, 0.011764707f, 0.0156862754f, 0.0156862754f,
+    0.0156862754f, 0.00784313772f, 0.00784313772f, 0.00784313772f, 0.00784313772f, 0.011764707f, 0.011764707f, 0.011764707f,
+    0.0156862754f, 0.0156862754f, 0.011764707f, 0.011764707f, 0.0156862754f, 0.0156862754f, 0.0196078438f, 0.0156862754f,
+    0.0196078438f, 0.0235294141f, 0.0156862754f, 0.00784313772f, 0.0156862754f, 0.0156862754f, 0.011764707f, 0.011764707f,
+    0.00784313772f, 0.011764707f, 0.00784313772f, 0.00784313772f, 0.011764707f, 0.0196078438f, 0.011764707f, 0.00392156886f,
+    0.00784313772f, 0.00392156886f, 0.00392156886f, 0.0f, 0.00784313772f, 0.00392156886f, 0.00784313772f, 0.00392156886f,
+    0.011764707f, 0.011764707f, 0.00784313772f, 0.00784313772f, 0.011764707f, 0.00784313772f, 0.00784313772f, 0.00392156886f,
+    0.00784313772f, 0.00784313772f, 0.011764707f, 0.00392156886f, 0.00784313772f, 0.0156862754f, 0.0156862754f, 0.011764707f,
+    0.00784313772f, 0.00392156886f, 0.00392156886f, 0.00784313772f, 0.00784313772f, 0.00784313772f, 0.011764707f, 0.0156862754f,
+    0.321568638f, 0.505882382f, 0.505882382f, 0.505882382f, 0.501960814f, 0.501960814f, 0.505882382f, 0.505882382f,
+    0.505882382f, 0.509803951f, 0.501960814f, 0.505882382f, 0.505882382f, 0.505882382f, 0.505882382f, 0.258823544f,
+    0.011764707f, 0.00392156886f, 0.011764707f, 0.0156862754f, 0.00784313772f, 0.011764707f, 0.0235294141f, 0.011764707f,
+    0.00784313772f, 0.00392156886f, 0.00392156886f, 0.00784313772f, 0.011764707f, 0.0156862754f, 0.011764707f, 0.0156862754f,
+    0.0156862754f, 0.00784313772f, 0.00784313772f, 0.00392156886f, 0.011764707f, 0.011764707f, 0.011764707f, 0.0156862754f,
+    0.011764707f, 0.0156862754f, 0.011764707f, 0.0156862754f, 0.0196078438f, 0.0235294141f, 0.011764707f, 0.0156862754f,
+    0.00784313772f, 0.0196078438f, 0.011764707f, 0.0156862754f, 0.011764707f, 0.0196078438f, 0.011764707f, 0.011764707f,
+    0.011764707f, 0.011764707f, 0.00784313772f, 0.011764707f, 0.011764707f, 0.011764707f, 0.0196078438f, 0.011764707f,
+    0.00784313772f, 0.00784313772f, 0.0f, 0.00392156886f, 0.00784313772f, 0.00392156886f, 0.0156862754f, 0.0156862754f,
+    0.011764707f, 0.011764707f, 0.00784313772f, 0.011764707f, 0.00392156886f, 0.00784313772f, 0.00392156886f, 0.011764707f,
+    0.011764707f, 0.00784313772f, 0.011764707f, 0.00784313772f, 0.00392156886f, 0.011764707f, 0.0156862754f, 0.0196078438f,
+    0.00784313772f, 0.011764707f, 0.00784313772f, 0.011764707f, 0.00392156886f, 0.00784313772f, 0.011764707f, 0.0705882385f,
+    0.505882382f, 0.505882382f, 0.505882382f, 0.505882382f, 0.505882382f, 0.505882382f, 0.501960814f, 0.501960814f,
+    0.501960814f, 0.501960814f, 0.501960814f, 0.505882382f, 0.505882382f, 0.505882382f, 0.501960814f, 0.474509835f,
+    0.0666666701f, 0.011764707f, 0.011764707f, 0.00784313772f, 0.011764707f, 0.011764707f, 0.011764707f, 0.0156862754f,
+    0.011764707f, 0.00784313772f, 0.00392156886f, 0.0156862754f, 0.00784313772f, 0.011764707f, 0.011764707f, 0.011764707f,
+    0.00784313772f, 0.00784313772f, 0.00392156886f, 0.00784313772f, 0.00784313772f, 0.011764707f, 0.0156862754f, 0.00784313772f,
+    0.00392156886f, 0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f, 0.0156862754f,
+    0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f, 0.00784313772f, 0.011764707f, 0.011764707f, 0.00392156886f,
+    0.00784313772f, 0.011764707f, 0.011764707f, 0.011764707f, 0.0196078438f, 0.0156862754f, 0.011764707f, 0.0156862754f,
+    0.00784313772f, 0.00784313772f, 0.00392156886f, 0.00392156886f, 0.00784313772f, 0.00392156886f, 0.0156862754f, 0.0156862754f,
+    0.0156862754f, 0.0156862754f, 0.0f, 0.00784313772f, 0.011764707f, 0.011764707f, 0.00784313772f, 0.011764707f,
+    0.00392156886f, 0.00784313772f, 0.00392156886f, 0.00392156886f, 0.00784313772f, 0.011764707f, 0.00392156886f, 0.0f,
+    0.00784313772f, 0.0156862754f, 0.0156862754f, 0.011764707f, 0.011764707f, 0.011764707f, 0.00784313772f, 0.321568638f,
+    0.505882382f, 0.501960814f, 0.505882382f, 0.501960814f, 0.501960814f, 0.505882382f, 0.505882382f, 0.501960814f,
+    0.501960814f, 0.501960814f, 0.505882382f, 0.505882382f, 0.501960814f, 0.505882382f, 0.501960814f, 0.501960814f,
+    0.349019617f, 0.0156862754f, 0.00784313772f, 0.00784313772f, 0.00784313772f, 0.011764707f, 0.011764707f, 0.00784313772f,
+    0.00784313772f, 0.00784313772f, 0.00392156886f, 0.011764707f, 0.0156862754f, 0.00392156886f, 0.0f, 0.011764707f,
+    0.00392156886f, 0.00392156886f, 0.00784313772f, 0.011764707f, 0.011764707f, 0.0156862754f, 0.0156862754f, 0.011764707f,
+    0.00784313772f, 0.011764707f, 0.00784313772f, 0.011764707f, 0.0156862754f, 0.011764707f, 0.0156862754f, 0.0196078438f,
+    0.011764707f, 0.011764707f, 0.011764707f, 0.00784313772f, 0.011764707f, 0.0156862754f, 0.011764707f, 0.0156862754f,
+    0.00784313772f, 0.011764707f, 0.0156862754f, 0.011764707f, 0.00784313772f, 0.00784313772f, 0.011764707f, 0.011764707f,
+    0.0156862754f, 0.00784313772f, 0.00392156886f, 0.00392156886f, 0.0f, 0.00784313772f, 0.011764707f, 0.0196078438f,
+    0.0156862754f, 0.011764707f, 0.00392156886f, 0.011764707f, 0.00392156886f, 0.00392156886f, 0.00784313772f, 0.011764707f,
+    0.0156862754f, 0.00784313772f, 0.0156862754f, 0.0156862754f, 0.011764707f, 0.00784313772f, 0.0156862754f, 0.0156862754f,
+    0.011764707f, 0.0156862754f, 0.0196078438f, 0.0156862754f, 0.0156862754f, 0.011764707f, 0.160784319f, 0.501960814f,
+    0.505882382f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.513725519f, 0.505882382f,
+    0.501960814f, 0.501960814f, 0.501960814f, 0.505882382f, 0.505882382f, 0.505882382f, 0.501960814f, 0.501960814f,
+    0.505882382f, 0.13333334f, 0.00392156886f, 0.00392156886f, 0.00784313772f, 0.0156862754f, 0.00784313772f, 0.00392156886f,
+    0.00784313772f, 0.00784313772f, 0.0f, 0.00784313772f, 0.00784313772f, 0.00784313772f, 0.00784313772f, 0.00784313772f,
+    0.011764707f, 0.00784313772f, 0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f, 0.0156862754f, 0.011764707f,
+    0.011764707f, 0.011764707f, 0.0156862754f, 0.0156862754f, 0.011764707f, 0.00784313772f, 0.00784313772f, 0.00784313772f,
+    0.0156862754f, 0.011764707f, 0.00784313772f, 0.011764707f, 0.00784313772f, 0.011764707f, 0.0156862754f, 0.00784313772f,
+    0.00784313772f, 0.0156862754f, 0.0156862754f, 0.00784313772f, 0.0156862754f, 0.011764707f, 0.00784313772f, 0.011764707f,
+    0.0196078438f, 0.0196078438f, 0.0156862754f, 0.00784313772f, 0.00392156886f, 0.0f, 0.011764707f, 0.0156862754f,
+    0.0156862754f, 0.011764707f, 0.00392156886f, 0.00784313772f, 0.00784313772f, 0.00392156886f, 0.00784313772f, 0.011764707f,
+    0.00784313772f, 0.00784313772f, 0.00392156886f, 0.0156862754f, 0.00784313772f, 0.00784313772f, 0.0f, 0.00784313772f,
+    0.011764707f, 0.011764707f, 0.00784313772f, 0.011764707f, 0.011764707f, 0.011764707f, 0.443137288f, 0.505882382f,
+    0.501960814f, 0.505882382f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.505882382f, 0.501960814f,
+    0.501960814f, 0.501960814f, 0.505882382f, 0.509803951f, 0.501960814f, 0.505882382f, 0.501960814f, 0.501960814f,
+    0.505882382f, 0.443137288f, 0.0352941193f, 0.011764707f, 0.011764707f, 0.011764707f, 0.00784313772f, 0.00784313772f,
+    0.00392156886f, 0.00392156886f, 0.00392156886f, 0.00784313772f, 0.011764707f, 0.011764707f, 0.00784313772f, 0.00784313772f,
+    0.011764707f, 0.00784313772f, 0.011764707f, 0.011764707f, 0.00784313772f, 0.011764707f, 0.011764707f, 0.011764707f,
+    0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f, 0.0156862754f, 0.00784313772f, 0.00784313772f, 0.011764707f,
+    0.00784313772f, 0.011764707f, 0.0196078438f, 0.011764707f, 0.011764707f, 0.011764707f, 0.00784313772f, 0.00784313772f,
+    0.011764707f, 0.0156862754f, 0.011764707f, 0.00784313772f, 0.00392156886f, 0.011764707f, 0.00392156886f, 0.00784313772f,
+    0.00784313772f, 0.00784313772f, 0.011764707f, 0.00392156886f, 0.00784313772f, 0.00784313772f, 0.00784313772f, 0.011764707f,
+    0.011764707f, 0.00784313772f, 0.00784313772f, 0.011764707f, 0.0f, 0.00784313772f, 0.011764707f, 0.0156862754f,
+    0.011764707f, 0.011764707f, 0.0156862754f, 0.011764707f, 0.00784313772f, 0.00784313772f, 0.00392156886f, 0.00392156886f,
+    0.00392156886f, 0.00392156886f, 0.00392156886f, 0.011764707f, 0.0156862754f, 0.258823544f, 0.501960814f, 0.505882382f,
+    0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.501960814f, 0.505882382f, 0.505882382f, 0.505882382f, 0.501960814f, 0.505882382f, 0.505882382f, 0.505882382f,
+    0.505882382f, 0.501960814f, 0.286274523f, 0.00784313772f, 0.011764707f, 0.011764707f, 0.00784313772f, 0.0156862754f,
+    0.00392156886f, 0.00392156886f, 0.00392156886f, 0.00392156886f, 0.011764707f, 0.011764707f, 0.00784313772f, 0.011764707f,
+    0.00784313772f, 0.011764707f, 0.00784313772f, 0.011764707f, 0.011764707f, 0.011764707f, 0.00392156886f, 0.0156862754f,
+    0.0156862754f, 0.0156862754f, 0.00784313772f, 0.0156862754f, 0.0196078438f, 0.0156862754f, 0.00784313772f, 0.011764707f,
+    0.00392156886f, 0.00784313772f, 0.00784313772f, 0.00784313772f, 0.00784313772f, 0.0196078438f, 0.00784313772f, 0.00784313772f,
+    0.0156862754f, 0.0156862754f, 0.00784313772f, 0.011764707f, 0.00784313772f, 0.011764707f, 0.00392156886f, 0.00784313772f,
+    0.00392156886f, 0.00784313772f, 0.00784313772f, 0.00784313772f, 0.00784313772f, 0.00784313772f, 0.00784313772f, 0.00784313772f,
+    0.011764707f, 0.00392156886f, 0.00784313772f, 0.00392156886f, 0.00392156886f, 0.00784313772f, 0.011764707f, 0.011764707f,
+    0.00784313772f, 0.0156862754f, 0.011764707f, 0.00784313772f, 0.00784313772f, 0.00784313772f, 0.00392156886f, 0.00392156886f,
+    0.00784313772f, 0.0f, 0.011764707f, 0.0156862754f, 0.105882362f, 0.505882382f, 0.505882382f, 0.505882382f,
+    0.505882382f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.505882382f,
+    0.505882382f, 0.505882382f, 0.505882382f, 0.505882382f, 0.505882382f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.509803951f, 0.505882382f, 0.501960814f, 0.129411772f, 0.011764707f, 0.011764707f, 0.0156862754f, 0.0156862754f,
+    0.00784313772f, 0.00392156886f, 0.011764707f, 0.011764707f, 0.011764707f, 0.0156862754f, 0.011764707f, 0.0156862754f,
+    0.0156862754f, 0.011764707f, 0.00784313772f, 0.0156862754f, 0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f,
+    0.0196078438f, 0.0156862754f, 0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f, 0.00784313772f,
+    0.00784313772f, 0.00784313772f, 0.00784313772f, 0.0156862754f, 0.0156862754f, 0.0156862754f, 0.0156862754f, 0.00784313772f,
+    0.011764707f, 0.011764707f, 0.00392156886f, 0.00392156886f, 0.00392156886f, 0.00392156886f, 0.00392156886f, 0.00392156886f,
+    0.00784313772f, 0.00784313772f, 0.00392156886f, 0.0f, 0.0f, 0.0f, 0.0196078438f, 0.0156862754f,
+    0.00784313772f, 0.00784313772f, 0.00784313772f, 0.00392156886f, 0.011764707f, 0.011764707f, 0.011764707f, 0.00784313772f,
+    0.0156862754f, 0.011764707f, 0.00392156886f, 0.00392156886f, 0.00784313772f, 0.011764707f, 0.0196078438f, 0.011764707f,
+    0.0f, 0.00392156886f, 0.00784313772f, 0.0666666701f, 0.447058856f, 0.505882382f, 0.501960814f, 0.505882382f,
+    0.505882382f, 0.505882382f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.505882382f,
+    0.505882382f, 0.505882382f, 0.509803951f, 0.505882382f, 0.505882382f, 0.501960814f, 0.505882382f, 0.505882382f,
+    0.505882382f, 0.505882382f, 0.501960814f, 0.443137288f, 0.0431372561f, 0.0156862754f, 0.0196078438f, 0.0196078438f,
+    0.011764707f, 0.00784313772f, 0.0f, 0.00784313772f, 0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f,
+    0.0156862754f, 0.0156862754f, 0.011764707f, 0.011764707f, 0.011764707f, 0.0156862754f, 0.011764707f, 0.011764707f,
+    0.011764707f, 0.0196078438f, 0.00784313772f, 0.011764707f, 0.00784313772f, 0.011764707f, 0.011764707f, 0.0156862754f,
+    0.011764707f, 0.011764707f, 0.011764707f, 0.0156862754f, 0.00784313772f, 0.011764707f, 0.00784313772f, 0.00392156886f,
+    0.011764707f, 0.011764707f, 0.0f, 0.0f, 0.0f, 0.00392156886f, 0.0f, 0.0f,
+    0.0f, 0.00392156886f, 0.0f, 0.0f, 0.0f, 0.00392156886f, 0.011764707f, 0.0156862754f,
+    0.00784313772f, 0.00392156886f, 0.00784313772f, 0.00784313772f, 0.00784313772f, 0.011764707f, 0.00784313772f, 0.011764707f,
+    0.0156862754f, 0.011764707f, 0.011764707f, 0.00784313772f, 0.00784313772f, 0.011764707f, 0.00784313772f, 0.011764707f,
+    0.00784313772f, 0.00784313772f, 0.00784313772f, 0.31764707f, 0.501960814f, 0.501960814f, 0.501960814f, 0.505882382f,
+    0.505882382f, 0.501960814f, 0.501960814f, 0.505882382f, 0.501960814f, 0.501960814f, 0.505882382f, 0.505882382f,
+    0.501960814f, 0.505882382f, 0.501960814f, 0.501960814f, 0.505882382f, 0.501960814f, 0.501960814f, 0.505882382f,
+    0.505882382f, 0.505882382f, 0.505882382f, 0.505882382f, 0.349019617f, 0.011764707f, 0.011764707f, 0.0156862754f,
+    0.011764707f, 0.011764707f, 0.00784313772f, 0.00784313772f, 0.011764707f, 0.0156862754f, 0.00784313772f, 0.0156862754f,
+    0.011764707f, 0.0196078438f, 0.0156862754f, 0.011764707f, 0.0156862754f, 0.0196078438f, 0.0196078438f, 0.011764707f,
+    0.00784313772f, 0.0156862754f, 0.011764707f, 0.011764707f, 0.00784313772f, 0.011764707f, 0.00784313772f, 0.00784313772f,
+    0.0156862754f, 0.0156862754f, 0.011764707f, 0.00784313772f, 0.00392156886f, 0.00784313772f, 0.011764707f, 0.00784313772f,
+    0.011764707f, 0.011764707f, 0.0f, 0.0f, 0.0f, 0.00392156886f, 0.011764707f, 0.011764707f,
+    0.00392156886f, 0.00784313772f, 0.00392156886f, 0.00392156886f, 0.0f, 0.0f, 0.00392156886f, 0.00784313772f,
+    0.0f, 0.00784313772f, 0.011764707f, 0.00784313772f, 0.00784313772f, 0.00392156886f, 0.00784313772f, 0.011764707f,
+    0.011764707f, 0.011764707f, 0.00392156886f, 0.00784313772f, 0.00784313772f, 0.00784313772f, 0.011764707f, 0.00392156886f,
+    0.0156862754f, 0.011764707f, 0.258823544f, 0.505882382f, 0.501960814f, 0.501960814f, 0.501960814f, 0.505882382f,
+    0.505882382f, 0.505882382f, 0.501960814f, 0.505882382f, 0.509803951f, 0.505882382f, 0.505882382f, 0.505882382f,
+    0.505882382f, 0.501960814f, 0.505882382f, 0.501960814f, 0.501960814f, 0.505882382f, 0.501960814f, 0.501960814f,
+    0.505882382f, 0.505882382f, 0.505882382f, 0.505882382f, 0.501960814f, 0.223529428f, 0.00784313772f, 0.00392156886f,
+    0.0156862754f, 0.0156862754f, 0.00392156886f, 0.011764707f, 0.0156862754f, 0.00784313772f, 0.011764707f, 0.00392156886f,
+    0.0156862754f, 0.0156862754f, 0.0156862754f, 0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f,
+    0.011764707f, 0.011764707f, 0.011764707f, 0.0196078438f, 0.00784313772f, 0.011764707f, 0.011764707f, 0.00784313772f,
+    0.011764707f, 0.011764707f, 0.011764707f, 0.0156862754f, 0.00784313772f, 0.011764707f, 0.00784313772f, 0.0f,
+    0.00784313772f, 0.00392156886f, 0.00392156886f, 0.0f, 0.0f, 0.00392156886f, 0.00784313772f, 0.00784313772f,
+    0.011764707f, 0.00392156886f, 0.0f, 0.0f, 0.00392156886f, 0.00392156886f, 0.0f, 0.00392156886f,
+    0.00392156886f, 0.0f, 0.011764707f, 0.011764707f, 0.00784313772f, 0.00784313772f, 0.00784313772f, 0.011764707f,
+    0.0156862754f, 0.0156862754f, 0.00392156886f, 0.00392156886f, 0.00392156886f, 0.00392156886f, 0.00392156886f, 0.00392156886f,
+    0.00784313772f, 0.137254909f, 0.505882382f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.505882382f, 0.505882382f, 0.505882382f, 0.509803951f, 0.505882382f, 0.505882382f, 0.505882382f, 0.505882382f,
+    0.501960814f, 0.501960814f, 0.501960814f, 0.505882382f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.501960814f, 0.505882382f, 0.509803951f, 0.505882382f, 0.501960814f, 0.501960814f, 0.125490203f, 0.00392156886f,
+    0.0156862754f, 0.0156862754f, 0.00784313772f, 0.00784313772f, 0.0156862754f, 0.00392156886f, 0.00784313772f, 0.0196078438f,
+    0.011764707f, 0.0156862754f, 0.0156862754f, 0.00392156886f, 0.0156862754f, 0.0156862754f, 0.0156862754f, 0.0156862754f,
+    0.00784313772f, 0.0196078438f, 0.0156862754f, 0.011764707f, 0.0156862754f, 0.0196078438f, 0.011764707f, 0.0156862754f,
+    0.0156862754f, 0.0156862754f, 0.011764707f, 0.011764707f, 0.00392156886f, 0.011764707f, 0.00392156886f, 0.00784313772f,
+    0.00392156886f, 0.00784313772f, 0.00392156886f, 0.00392156886f, 0.00784313772f, 0.00784313772f, 0.00784313772f, 0.011764707f,
+    0.0156862754f, 0.011764707f, 0.00392156886f, 0.0f, 0.00392156886f, 0.00392156886f, 0.00784313772f, 0.00392156886f,
+    0.00784313772f, 0.011764707f, 0.00392156886f, 0.00392156886f, 0.00392156886f, 0.00392156886f, 0.00392156886f, 0.00784313772f,
+    0.011764707f, 0.00784313772f, 0.011764707f, 0.00784313772f, 0.00392156886f, 0.0f, 0.011764707f, 0.00784313772f,
+    0.0666666701f, 0.474509835f, 0.505882382f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.505882382f, 0.505882382f, 0.501960814f, 0.501960814f, 0.505882382f, 0.505882382f, 0.505882382f, 0.505882382f,
+    0.501960814f, 0.505882382f, 0.501960814f, 0.501960814f, 0.505882382f, 0.505882382f, 0.501960814f, 0.501960814f,
+    0.505882382f, 0.501960814f, 0.505882382f, 0.501960814f, 0.501960814f, 0.501960814f, 0.470588267f, 0.0705882385f,
+    0.00784313772f, 0.0156862754f, 0.00784313772f, 0.00784313772f, 0.00784313772f, 0.00784313772f, 0.00392156886f, 0.00784313772f,
+    0.0156862754f, 0.0156862754f, 0.00784313772f, 0.00784313772f, 0.0156862754f, 0.0156862754f, 0.011764707f, 0.011764707f,
+    0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f, 0.00784313772f, 0.00784313772f, 0.011764707f, 0.00392156886f,
+    0.011764707f, 0.011764707f, 0.00784313772f, 0.0156862754f, 0.011764707f, 0.011764707f, 0.0196078438f, 0.011764707f,
+    0.00784313772f, 0.00784313772f, 0.0f, 0.00392156886f, 0.00784313772f, 0.00784313772f, 0.011764707f, 0.011764707f,
+    0.00784313772f, 0.00784313772f, 0.00392156886f, 0.00784313772f, 0.00784313772f, 0.00392156886f, 0.00392156886f, 0.00392156886f,
+    0.00784313772f, 0.011764707f, 0.00784313772f, 0.00784313772f, 0.00392156886f, 0.00784313772f, 0.00392156886f, 0.011764707f,
+    0.011764707f, 0.011764707f, 0.0f, 0.00392156886f, 0.00392156886f, 0.00392156886f, 0.00392156886f, 0.0627451017f,
+    0.43921572f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.501960814f, 0.505882382f, 0.501960814f, 0.501960814f, 0.505882382f, 0.505882382f, 0.505882382f, 0.501960814f,
+    0.505882382f, 0.505882382f, 0.501960814f, 0.505882382f, 0.505882382f, 0.505882382f, 0.501960814f, 0.501960814f,
+    0.501960814f, 0.505882382f, 0.501960814f, 0.505882382f, 0.501960814f, 0.501960814f, 0.501960814f, 0.443137288f,
+    0.0666666701f, 0.011764707f, 0.00392156886f, 0.00392156886f, 0.0156862754f, 0.011764707f, 0.00784313772f, 0.00784313772f,
+    0.00392156886f, 0.011764707f, 0.00392156886f, 0.00784313772f, 0.011764707f, 0.0156862754f, 0.0196078438f, 0.011764707f,
+    0.011764707f, 0.0156862754f, 0.00784313772f, 0.0156862754f, 0.011764707f, 0.011764707f, 0.011764707f, 0.0156862754f,
+    0.011764707f, 0.00784313772f, 0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f, 0.0156862754f, 0.00784313772f,
+    0.011764707f, 0.00784313772f, 0.00392156886f, 0.00392156886f, 0.00784313772f, 0.0156862754f, 0.00784313772f, 0.011764707f,
+    0.00784313772f, 0.0156862754f, 0.00784313772f, 0.00784313772f, 0.00392156886f, 0.00392156886f, 0.00392156886f, 0.00784313772f,
+    0.0156862754f, 0.011764707f, 0.011764707f, 0.00784313772f, 0.0f, 0.00392156886f, 0.011764707f, 0.00392156886f,
+    0.011764707f, 0.00392156886f, 0.0f, 0.00392156886f, 0.00784313772f, 0.011764707f, 0.0705882385f, 0.443137288f,
+    0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.505882382f, 0.505882382f, 0.505882382f, 0.501960814f, 0.505882382f, 0.505882382f, 0.505882382f, 0.505882382f,
+    0.505882382f, 0.501960814f, 0.501960814f, 0.501960814f, 0.505882382f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.501960814f, 0.505882382f, 0.501960814f, 0.505882382f, 0.501960814f, 0.501960814f, 0.501960814f, 0.505882382f,
+    0.443137288f, 0.0627451017f, 0.00392156886f, 0.00392156886f, 0.0196078438f, 0.011764707f, 0.00784313772f, 0.00784313772f,
+    0.00784313772f, 0.011764707f, 0.00784313772f, 0.00784313772f, 0.011764707f, 0.0196078438f, 0.0156862754f, 0.011764707f,
+    0.011764707f, 0.011764707f, 0.011764707f, 0.0156862754f, 0.011764707f, 0.00784313772f, 0.00784313772f, 0.011764707f,
+    0.0156862754f, 0.0196078438f, 0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f, 0.00784313772f, 0.00784313772f,
+    0.011764707f, 0.00784313772f, 0.00784313772f, 0.00784313772f, 0.011764707f, 0.0196078438f, 0.011764707f, 0.011764707f,
+    0.011764707f, 0.011764707f, 0.00392156886f, 0.00392156886f, 0.00392156886f, 0.00784313772f, 0.00784313772f, 0.00784313772f,
+    0.00784313772f, 0.00784313772f, 0.011764707f, 0.011764707f, 0.0f, 0.00784313772f, 0.00784313772f, 0.00784313772f,
+    0.00392156886f, 0.00784313772f, 0.00392156886f, 0.00784313772f, 0.00784313772f, 0.0431372561f, 0.443137288f, 0.505882382f,
+    0.501960814f, 0.505882382f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.505882382f, 0.505882382f, 0.505882382f, 0.505882382f, 0.505882382f, 0.505882382f, 0.501960814f, 0.509803951f,
+    0.501960814f, 0.501960814f, 0.505882382f, 0.501960814f, 0.501960814f, 0.505882382f, 0.501960814f, 0.505882382f,
+    0.501960814f, 0.505882382f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.505882382f, 0.505882382f,
+    0.505882382f, 0.411764741f, 0.0313725509f, 0.011764707f, 0.00784313772f, 0.0156862754f, 0.00392156886f, 0.0f,
+    0.00392156886f, 0.011764707f, 0.00784313772f, 0.00784313772f, 0.00784313772f, 0.0156862754f, 0.011764707f, 0.011764707f,
+    0.011764707f, 0.00784313772f, 0.011764707f, 0.011764707f, 0.011764707f, 0.00784313772f, 0.00784313772f, 0.011764707f,
+    0.0156862754f, 0.0156862754f, 0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f, 0.00784313772f, 0.00784313772f,
+    0.011764707f, 0.00392156886f, 0.00392156886f, 0.00784313772f, 0.011764707f, 0.00784313772f, 0.0156862754f, 0.011764707f,
+    0.00784313772f, 0.00392156886f, 0.011764707f, 0.0f, 0.00392156886f, 0.00784313772f, 0.00784313772f, 0.00784313772f,
+    0.011764707f, 0.011764707f, 0.011764707f, 0.00784313772f, 0.00784313772f, 0.00392156886f, 0.0f, 0.00784313772f,
+    0.00392156886f, 0.00392156886f, 0.00784313772f, 0.00784313772f, 0.0745098069f, 0.415686309f, 0.501960814f, 0.501960814f,
+    0.501960814f, 0.505882382f, 0.501960814f, 0.501960814f, 0.501960814f, 0.505882382f, 0.505882382f, 0.505882382f,
+    0.505882382f, 0.505882382f, 0.505882382f, 0.501960814f, 0.501960814f, 0.505882382f, 0.505882382f, 0.501960814f,
+    0.505882382f, 0.505882382f, 0.501960814f, 0.505882382f, 0.505882382f, 0.505882382f, 0.501960814f, 0.501960814f,
+    0.505882382f, 0.509803951f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.505882382f, 0.509803951f,
+    0.505882382f, 0.505882382f, 0.443137288f, 0.0784313753f, 0.0156862754f, 0.0235294141f, 0.00784313772f, 0.00784313772f,
+    0.00392156886f, 0.00784313772f, 0.011764707f, 0.0156862754f, 0.011764707f, 0.00392156886f, 0.0156862754f, 0.0156862754f,
+    0.00784313772f, 0.00784313772f, 0.00784313772f, 0.011764707f, 0.011764707f, 0.0156862754f, 0.011764707f, 0.0156862754f,
+    0.0156862754f, 0.0196078438f, 0.0196078438f, 0.011764707f, 0.011764707f, 0.0156862754f, 0.00392156886f, 0.00784313772f,
+    0.011764707f, 0.011764707f, 0.00784313772f, 0.00392156886f, 0.011764707f, 0.011764707f, 0.00784313772f, 0.00392156886f,
+    0.00392156886f, 0.011764707f, 0.00784313772f, 0.00784313772f, 0.00784313772f, 0.011764707f, 0.00784313772f, 0.00392156886f,
+    0.011764707f, 0.011764707f, 0.00392156886f, 0.011764707f, 0.00392156886f, 0.011764707f, 0.00784313772f, 0.011764707f,
+    0.00784313772f, 0.00784313772f, 0.00392156886f, 0.0705882385f, 0.447058856f, 0.505882382f, 0.505882382f, 0.501960814f,
+    0.501960814f, 0.505882382f, 0.501960814f, 0.501960814f, 0.505882382f, 0.501960814f, 0.505882382f, 0.505882382f,
+    0.505882382f, 0.505882382f, 0.505882382f, 0.501960814f, 0.505882382f, 0.505882382f, 0.501960814f, 0.505882382f,
+    0.501960814f, 0.505882382f, 0.505882382f, 0.505882382f, 0.509803951f, 0.509803951f, 0.501960814f, 0.505882382f,
+    0.505882382f, 0.505882382f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.505882382f,
+    0.509803951f, 0.501960814f, 0.501960814f, 0.443137288f, 0.0666666701f, 0.00784313772f, 0.0f, 0.0f,
+    0.011764707f, 0.00784313772f, 0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f,
+    0.00784313772f, 0.00784313772f, 0.00784313772f, 0.00784313772f, 0.011764707f, 0.0156862754f, 0.0156862754f, 0.0156862754f,
+    0.011764707f, 0.0156862754f, 0.0156862754f, 0.0156862754f, 0.011764707f, 0.011764707f, 0.00784313772f, 0.011764707f,
+    0.0156862754f, 0.011764707f, 0.0f, 0.00784313772f, 0.011764707f, 0.011764707f, 0.00392156886f, 0.00392156886f,
+    0.00392156886f, 0.011764707f, 0.00784313772f, 0.00392156886f, 0.00784313772f, 0.0156862754f, 0.011764707f, 0.00784313772f,
+    0.00392156886f, 0.00392156886f, 0.00392156886f, 0.00784313772f, 0.011764707f, 0.0156862754f, 0.00784313772f, 0.00784313772f,
+    0.00784313772f, 0.00784313772f, 0.0705882385f, 0.447058856f, 0.505882382f, 0.505882382f, 0.509803951f, 0.501960814f,
+    0.501960814f, 0.505882382f, 0.501960814f, 0.505882382f, 0.505882382f, 0.505882382f, 0.505882382f, 0.505882382f,
+    0.505882382f, 0.505882382f, 0.501960814f, 0.501960814f, 0.505882382f, 0.505882382f, 0.505882382f, 0.505882382f,
+    0.505882382f, 0.505882382f, 0.505882382f, 0.505882382f, 0.505882382f, 0.505882382f, 0.505882382f, 0.505882382f,
+    0.501960814f, 0.505882382f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.505882382f, 0.505882382f,
+    0.505882382f, 0.501960814f, 0.501960814f, 0.501960814f, 0.443137288f, 0.0627451017f, 0.00392156886f, 0.00392156886f,
+    0.00392156886f, 0.00784313772f, 0.011764707f, 0.0196078438f, 0.011764707f, 0.011764707f, 0.011764707f, 0.0196078438f,
+    0.00784313772f, 0.00784313772f, 0.011764707f, 0.00784313772f, 0.011764707f, 0.0156862754f, 0.00784313772f, 0.011764707f,
+    0.0156862754f, 0.0156862754f, 0.011764707f, 0.0156862754f, 0.0156862754f, 0.0156862754f, 0.00784313772f, 0.00784313772f,
+    0.0156862754f, 0.0156862754f, 0.00392156886f, 0.0f, 0.011764707f, 0.011764707f, 0.00392156886f, 0.00392156886f,
+    0.00392156886f, 0.0156862754f, 0.011764707f, 0.00784313772f, 0.011764707f, 0.011764707f, 0.0156862754f, 0.011764707f,
+    0.00392156886f, 0.00392156886f, 0.0f, 0.00784313772f, 0.00784313772f, 0.0196078438f, 0.011764707f, 0.00392156886f,
+    0.00392156886f, 0.13333334f, 0.474509835f, 0.501960814f, 0.505882382f, 0.505882382f, 0.509803951f, 0.501960814f,
+    0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.505882382f,
+    0.501960814f, 0.501960814f, 0.501960814f, 0.505882382f, 0.505882382f, 0.505882382f, 0.501960814f, 0.505882382f,
+    0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.505882382f,
+    0.505882382f, 0.505882382f, 0.505882382f, 0.501960814f, 0.501960814f, 0.470588267f, 0.129411772f, 0.00392156886f,
+    0.00392156886f, 0.00392156886f, 0.00784313772f, 0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f,
+    0.00392156886f, 0.00784313772f, 0.00784313772f, 0.011764707f, 0.0156862754f, 0.0156862754f, 0.00784313772f, 0.011764707f,
+    0.011764707f, 0.0156862754f, 0.011764707f, 0.011764707f, 0.011764707f, 0.00784313772f, 0.00784313772f, 0.011764707f,
+    0.0235294141f, 0.0196078438f, 0.0f, 0.00784313772f, 0.011764707f, 0.011764707f, 0.00392156886f, 0.00392156886f,
+    0.00784313772f, 0.00784313772f, 0.00784313772f, 0.00784313772f, 0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f,
+    0.00392156886f, 0.00392156886f, 0.00392156886f, 0.00784313772f, 0.0156862754f, 0.011764707f, 0.011764707f, 0.00392156886f,
+    0.223529428f, 0.505882382f, 0.505882382f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.505882382f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.505882382f,
+    0.505882382f, 0.505882382f, 0.501960814f, 0.501960814f, 0.501960814f, 0.505882382f, 0.501960814f, 0.501960814f,
+    0.501960814f, 0.505882382f, 0.505882382f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.250980407f,
+    0.00784313772f, 0.00784313772f, 0.011764707f, 0.011764707f, 0.00392156886f, 0.0156862754f, 0.011764707f, 0.00784313772f,
+    0.00784313772f, 0.0156862754f, 0.0156862754f, 0.0156862754f, 0.0156862754f, 0.0156862754f, 0.0156862754f, 0.0156862754f,
+    0.0156862754f, 0.0156862754f, 0.011764707f, 0.011764707f, 0.00784313772f, 0.011764707f, 0.0235294141f, 0.0196078438f,
+    0.0156862754f, 0.011764707f, 0.0f, 0.00392156886f, 0.0156862754f, 0.0156862754f, 0.00784313772f, 0.00784313772f,
+    0.00392156886f, 0.0156862754f, 0.00784313772f, 0.00392156886f, 0.011764707f, 0.011764707f, 0.00784313772f, 0.011764707f,
+    0.00784313772f, 0.00392156886f, 0.00392156886f, 0.00784313772f, 0.00784313772f, 0.011764707f, 0.0313725509f, 0.345098048f,
+    0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.505882382f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.501960814f, 0.501960814f, 0.501960814f, 0.505882382f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.505882382f, 0.501960814f, 0.505882382f, 0.505882382f,
+    0.509803951f, 0.505882382f, 0.501960814f, 0.501960814f, 0.501960814f, 0.505882382f, 0.505882382f, 0.501960814f,
+    0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.505882382f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.31764707f, 0.0705882385f, 0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f, 0.0156862754f, 0.0156862754f,
+    0.0156862754f, 0.0156862754f, 0.0156862754f, 0.0156862754f, 0.0156862754f, 0.0156862754f, 0.011764707f, 0.011764707f,
+    0.0156862754f, 0.0196078438f, 0.011764707f, 0.011764707f, 0.011764707f, 0.0156862754f, 0.0156862754f, 0.0196078438f,
+    0.00784313772f, 0.011764707f, 0.00392156886f, 0.00392156886f, 0.00392156886f, 0.00784313772f, 0.00784313772f, 0.011764707f,
+    0.00392156886f, 0.00392156886f, 0.011764707f, 0.00784313772f, 0.00784313772f, 0.011764707f, 0.011764707f, 0.011764707f,
+    0.011764707f, 0.00784313772f, 0.0f, 0.00784313772f, 0.011764707f, 0.13333334f, 0.43921572f, 0.501960814f,
+    0.501960814f, 0.505882382f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.505882382f, 0.505882382f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.505882382f,
+    0.501960814f, 0.505882382f, 0.501960814f, 0.505882382f, 0.505882382f, 0.505882382f, 0.501960814f, 0.505882382f,
+    0.505882382f, 0.505882382f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.505882382f,
+    0.501960814f, 0.501960814f, 0.501960814f, 0.505882382f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.501960814f, 0.443137288f, 0.101960793f, 0.011764707f, 0.00392156886f, 0.0156862754f, 0.00784313772f, 0.00784313772f,
+    0.0156862754f, 0.011764707f, 0.011764707f, 0.011764707f, 0.00784313772f, 0.00784313772f, 0.011764707f, 0.011764707f,
+    0.0156862754f, 0.0156862754f, 0.011764707f, 0.011764707f, 0.011764707f, 0.0156862754f, 0.00784313772f, 0.00784313772f,
+    0.00392156886f, 0.00784313772f, 0.00392156886f, 0.00392156886f, 0.0f, 0.00784313772f, 0.011764707f, 0.011764707f,
+    0.00392156886f, 0.00784313772f, 0.0156862754f, 0.0196078438f, 0.0156862754f, 0.011764707f, 0.011764707f, 0.0156862754f,
+    0.00784313772f, 0.00784313772f, 0.00784313772f, 0.0313725509f, 0.286274523f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.501960814f, 0.505882382f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.505882382f, 0.501960814f,
+    0.505882382f, 0.505882382f, 0.501960814f, 0.501960814f, 0.501960814f, 0.505882382f, 0.505882382f, 0.509803951f,
+    0.501960814f, 0.501960814f, 0.501960814f, 0.505882382f, 0.505882382f, 0.505882382f, 0.501960814f, 0.501960814f,
+    0.501960814f, 0.505882382f, 0.505882382f, 0.505882382f, 0.501960814f, 0.505882382f, 0.505882382f, 0.501960814f,
+    0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.505882382f, 0.505882382f, 0.501960814f, 0.501960814f,
+    0.501960814f, 0.501960814f, 0.501960814f, 0.258823544f, 0.011764707f, 0.00784313772f, 0.00392156886f, 0.00784313772f,
+    0.0156862754f, 0.011764707f, 0.011764707f, 0.011764707f, 0.00784313772f, 0.00784313772f, 0.0156862754f, 0.011764707f,
+    0.0156862754f, 0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f, 0.00784313772f, 0.00392156886f,
+    0.0156862754f, 0.0196078438f, 0.011764707f, 0.00392156886f, 0.0f, 0.011764707f, 0.00784313772f, 0.011764707f,
+    0.00784313772f, 0.011764707f, 0.011764707f, 0.0156862754f, 0.011764707f, 0.0156862754f, 0.011764707f, 0.0156862754f,
+    0.0156862754f, 0.011764707f, 0.13333334f, 0.443137288f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.505882382f, 0.505882382f, 0.501960814f, 0.501960814f, 0.505882382f, 0.505882382f, 0.501960814f, 0.505882382f,
+    0.505882382f, 0.501960814f, 0.501960814f, 0.505882382f, 0.501960814f, 0.505882382f, 0.505882382f, 0.501960814f,
+    0.505882382f, 0.505882382f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.505882382f, 0.505882382f,
+    0.505882382f, 0.505882382f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.501960814f, 0.505882382f, 0.505882382f, 0.505882382f, 0.505882382f, 0.505882382f, 0.505882382f, 0.505882382f,
+    0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.505882382f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.447058856f, 0.164705887f, 0.00784313772f, 0.011764707f,
+    0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f, 0.0156862754f, 0.011764707f,
+    0.0156862754f, 0.011764707f, 0.011764707f, 0.0156862754f, 0.00784313772f, 0.00784313772f, 0.00784313772f, 0.00784313772f,
+    0.011764707f, 0.0156862754f, 0.00784313772f, 0.00784313772f, 0.00392156886f, 0.00784313772f, 0.00392156886f, 0.011764707f,
+    0.011764707f, 0.011764707f, 0.011764707f, 0.0196078438f, 0.00784313772f, 0.00784313772f, 0.0156862754f, 0.011764707f,
+    0.0666666701f, 0.349019617f, 0.501960814f, 0.505882382f, 0.505882382f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.505882382f, 0.505882382f, 0.501960814f, 0.505882382f, 0.501960814f, 0.505882382f, 0.501960814f, 0.501960814f,
+    0.501960814f, 0.505882382f, 0.501960814f, 0.505882382f, 0.505882382f, 0.505882382f, 0.505882382f, 0.505882382f,
+    0.505882382f, 0.505882382f, 0.501960814f, 0.501960814f, 0.501960814f, 0.509803951f, 0.505882382f, 0.509803951f,
+    0.509803951f, 0.505882382f, 0.501960814f, 0.501960814f, 0.501960814f, 0.505882382f, 0.501960814f, 0.501960814f,
+    0.505882382f, 0.505882382f, 0.505882382f, 0.505882382f, 0.501960814f, 0.505882382f, 0.501960814f, 0.505882382f,
+    0.505882382f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.505882382f, 0.501960814f, 0.505882382f,
+    0.505882382f, 0.505882382f, 0.501960814f, 0.501960814f, 0.505882382f, 0.505882382f, 0.321568638f, 0.0666666701f,
+    0.011764707f, 0.011764707f, 0.0156862754f, 0.011764707f, 0.0156862754f, 0.0156862754f, 0.011764707f, 0.011764707f,
+    0.0156862754f, 0.011764707f, 0.011764707f, 0.011764707f, 0.00784313772f, 0.011764707f, 0.00784313772f, 0.011764707f,
+    0.0235294141f, 0.0156862754f, 0.011764707f, 0.0156862754f, 0.00392156886f, 0.00784313772f, 0.00784313772f, 0.011764707f,
+    0.00784313772f, 0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f, 0.0313725509f, 0.254901975f,
+    0.474509835f, 0.505882382f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.505882382f, 0.505882382f, 0.501960814f, 0.505882382f, 0.501960814f, 0.501960814f, 0.505882382f, 0.501960814f,
+    0.505882382f, 0.501960814f, 0.501960814f, 0.505882382f, 0.505882382f, 0.505882382f, 0.501960814f, 0.501960814f,
+    0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.505882382f, 0.505882382f, 0.505882382f,
+    0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.505882382f, 0.505882382f, 0.505882382f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.505882382f, 0.501960814f, 0.501960814f, 0.501960814f, 0.505882382f, 0.505882382f, 0.501960814f, 0.501960814f,
+    0.505882382f, 0.505882382f, 0.505882382f, 0.501960814f, 0.509803951f, 0.505882382f, 0.505882382f, 0.505882382f,
+    0.321568638f, 0.0705882385f, 0.00784313772f, 0.0196078438f, 0.0156862754f, 0.011764707f, 0.0156862754f, 0.011764707f,
+    0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f, 0.0156862754f, 0.0156862754f,
+    0.011764707f, 0.0156862754f, 0.011764707f, 0.0156862754f, 0.00784313772f, 0.00784313772f, 0.0156862754f, 0.011764707f,
+    0.00784313772f, 0.011764707f, 0.00784313772f, 0.00784313772f, 0.0352941193f, 0.258823544f, 0.474509835f, 0.501960814f,
+    0.505882382f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.505882382f, 0.505882382f, 0.501960814f, 0.501960814f, 0.505882382f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.505882382f, 0.501960814f, 0.501960814f, 0.505882382f, 0.505882382f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.505882382f, 0.501960814f, 0.501960814f, 0.505882382f,
+    0.505882382f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.505882382f, 0.505882382f, 0.505882382f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.505882382f, 0.505882382f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.505882382f, 0.505882382f, 0.501960814f, 0.501960814f, 0.505882382f, 0.509803951f, 0.505882382f, 0.505882382f,
+    0.505882382f, 0.443137288f, 0.258823544f, 0.0745098069f, 0.0156862754f, 0.0196078438f, 0.011764707f, 0.011764707f,
+    0.011764707f, 0.011764707f, 0.0156862754f, 0.011764707f, 0.011764707f, 0.011764707f, 0.0156862754f, 0.0196078438f,
+    0.011764707f, 0.011764707f, 0.00392156886f, 0.0f, 0.00784313772f, 0.011764707f, 0.00784313772f, 0.00784313772f,
+    0.00392156886f, 0.00784313772f, 0.0627451017f, 0.258823544f, 0.474509835f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.501960814f, 0.505882382f, 0.501960814f, 0.501960814f, 0.505882382f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.505882382f, 0.505882382f, 0.501960814f, 0.501960814f,
+    0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.505882382f, 0.501960814f, 0.505882382f,
+    0.505882382f, 0.505882382f, 0.505882382f, 0.505882382f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.501960814f, 0.505882382f, 0.505882382f, 0.505882382f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.501960814f, 0.505882382f, 0.501960814f, 0.501960814f, 0.505882382f, 0.505882382f, 0.505882382f, 0.505882382f,
+    0.505882382f, 0.505882382f, 0.501960814f, 0.505882382f, 0.31764707f, 0.0666666701f, 0.00784313772f, 0.0156862754f,
+    0.00784313772f, 0.0156862754f, 0.00784313772f, 0.00784313772f, 0.00784313772f, 0.00784313772f, 0.00784313772f, 0.011764707f,
+    0.00784313772f, 0.00784313772f, 0.00392156886f, 0.011764707f, 0.011764707f, 0.0156862754f, 0.00784313772f, 0.00784313772f,
+    0.129411772f, 0.380392194f, 0.501960814f, 0.501960814f, 0.501960814f, 0.505882382f, 0.505882382f, 0.501960814f,
+    0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.505882382f, 0.505882382f,
+    0.505882382f, 0.505882382f, 0.501960814f, 0.501960814f, 0.501960814f, 0.505882382f, 0.501960814f, 0.501960814f,
+    0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.505882382f, 0.505882382f, 0.501960814f, 0.501960814f,
+    0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.505882382f,
+    0.505882382f, 0.513725519f, 0.501960814f, 0.509803951f, 0.505882382f, 0.501960814f, 0.505882382f, 0.505882382f,
+    0.505882382f, 0.505882382f, 0.505882382f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.501960814f, 0.501960814f, 0.505882382f, 0.505882382f, 0.501960814f, 0.501960814f, 0.505882382f, 0.505882382f,
+    0.505882382f, 0.505882382f, 0.505882382f, 0.505882382f, 0.505882382f, 0.505882382f, 0.345098048f, 0.160784319f,
+    0.011764707f, 0.011764707f, 0.00392156886f, 0.0156862754f, 0.00784313772f, 0.011764707f, 0.011764707f, 0.011764707f,
+    0.00784313772f, 0.011764707f, 0.00784313772f, 0.00784313772f, 0.00392156886f, 0.125490203f, 0.282352954f, 0.474509835f,
+    0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.505882382f, 0.501960814f, 0.505882382f, 0.501960814f,
+    0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.505882382f,
+    0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.505882382f,
+    0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.505882382f, 0.505882382f, 0.505882382f, 0.505882382f,
+    0.501960814f, 0.505882382f, 0.501960814f, 0.501960814f, 0.505882382f, 0.505882382f, 0.505882382f, 0.505882382f,
+    0.505882382f, 0.505882382f, 0.505882382f, 0.505882382f, 0.505882382f, 0.501960814f, 0.505882382f, 0.505882382f,
+    0.505882382f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.501960814f, 0.505882382f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.505882382f,
+    0.505882382f, 0.505882382f, 0.501960814f, 0.505882382f, 0.501960814f, 0.505882382f, 0.505882382f, 0.505882382f,
+    0.501960814f, 0.505882382f, 0.505882382f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.509803951f,
+    0.443137288f, 0.31764707f, 0.141176477f, 0.0156862754f, 0.0156862754f, 0.011764707f, 0.011764707f, 0.0156862754f,
+    0.011764707f, 0.0392156877f, 0.192156881f, 0.31764707f, 0.474509835f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.505882382f, 0.505882382f, 0.501960814f,
+    0.505882382f, 0.505882382f, 0.505882382f, 0.505882382f, 0.501960814f, 0.501960814f, 0.509803951f, 0.505882382f,
+    0.505882382f, 0.505882382f, 0.501960814f, 0.505882382f, 0.501960814f, 0.501960814f, 0.501960814f, 0.505882382f,
+    0.505882382f, 0.505882382f, 0.501960814f, 0.501960814f, 0.505882382f, 0.505882382f, 0.505882382f, 0.509803951f,
+    0.509803951f, 0.505882382f, 0.501960814f, 0.501960814f, 0.505882382f, 0.509803951f, 0.509803951f, 0.505882382f,
+    0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.505882382f, 0.505882382f, 0.505882382f,
+    0.505882382f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.505882382f, 0.505882382f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.505882382f,
+    0.505882382f, 0.501960814f, 0.501960814f, 0.501960814f, 0.505882382f, 0.505882382f, 0.501960814f, 0.505882382f,
+    0.505882382f, 0.505882382f, 0.505882382f, 0.505882382f, 0.501960814f, 0.501960814f, 0.505882382f, 0.505882382f,
+    0.505882382f, 0.509803951f, 0.505882382f, 0.447058856f, 0.321568638f, 0.168627456f, 0.0705882385f, 0.00784313772f,
+    0.227450997f, 0.505882382f, 0.505882382f, 0.505882382f, 0.501960814f, 0.505882382f, 0.505882382f, 0.505882382f,
+    0.505882382f, 0.505882382f, 0.501960814f, 0.505882382f, 0.509803951f, 0.505882382f, 0.505882382f, 0.505882382f,
+    0.501960814f, 0.505882382f, 0.505882382f, 0.505882382f, 0.505882382f, 0.505882382f, 0.505882382f, 0.509803951f,
+    0.505882382f, 0.505882382f, 0.501960814f, 0.501960814f, 0.501960814f, 0.505882382f, 0.505882382f, 0.505882382f,
+    0.505882382f, 0.505882382f, 0.501960814f, 0.501960814f, 0.505882382f, 0.501960814f, 0.501960814f, 0.505882382f,
+    0.505882382f, 0.505882382f, 0.501960814f, 0.505882382f, 0.501960814f, 0.501960814f, 0.505882382f, 0.505882382f,
+    0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.505882382f,
+    0.501960814f, 0.501960814f, 0.501960814f, 0.505882382f, 0.505882382f, 0.505882382f, 0.501960814f, 0.501960814f,
+    0.505882382f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.505882382f,
+    0.505882382f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.505882382f, 0.505882382f, 0.505882382f,
+    0.505882382f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.505882382f, 0.505882382f, 0.505882382f,
+    0.505882382f, 0.505882382f, 0.505882382f, 0.505882382f, 0.501960814f, 0.505882382f, 0.501960814f, 0.227450997f,
+    0.443137288f, 0.505882382f, 0.505882382f, 0.505882382f, 0.509803951f, 0.505882382f, 0.505882382f, 0.505882382f,
+    0.505882382f, 0.505882382f, 0.505882382f, 0.505882382f, 0.505882382f, 0.509803951f, 0.505882382f, 0.505882382f,
+    0.501960814f, 0.505882382f, 0.509803951f, 0.501960814f, 0.505882382f, 0.505882382f, 0.505882382f, 0.505882382f,
+    0.505882382f, 0.505882382f, 0.505882382f, 0.505882382f, 0.501960814f, 0.501960814f, 0.505882382f, 0.505882382f,
+    0.509803951f, 0.501960814f, 0.501960814f, 0.501960814f, 0.505882382f, 0.505882382f, 0.505882382f, 0.501960814f,
+    0.505882382f, 0.505882382f, 0.501960814f, 0.505882382f, 0.505882382f, 0.505882382f, 0.505882382f, 0.501960814f,
+    0.501960814f, 0.501960814f, 0.505882382f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.505882382f,
+    0.505882382f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.505882382f, 0.505882382f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.505882382f, 0.509803951f,
+    0.505882382f, 0.505882382f, 0.501960814f, 0.501960814f, 0.501960814f, 0.505882382f, 0.505882382f, 0.505882382f,
+    0.505882382f, 0.505882382f, 0.505882382f, 0.501960814f, 0.505882382f, 0.501960814f, 0.501960814f, 0.505882382f,
+    0.505882382f, 0.501960814f, 0.505882382f, 0.505882382f, 0.501960814f, 0.501960814f, 0.505882382f, 0.474509835f,
+    0.474509835f, 0.505882382f, 0.505882382f, 0.505882382f, 0.505882382f, 0.505882382f, 0.501960814f, 0.501960814f,
+    0.501960814f, 0.505882382f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.505882382f, 0.505882382f, 0.501960814f, 0.501960814f,
+    0.505882382f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.505882382f, 0.505882382f, 0.505882382f,
+    0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.505882382f, 0.505882382f, 0.501960814f, 0.501960814f,
+    0.505882382f, 0.501960814f, 0.501960814f, 0.501960814f, 0.505882382f, 0.505882382f, 0.505882382f, 0.505882382f,
+    0.505882382f, 0.505882382f, 0.501960814f, 0.505882382f, 0.505882382f, 0.505882382f, 0.501960814f, 0.501960814f,
+    0.505882382f, 0.505882382f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.505882382f, 0.501960814f, 0.501960814f, 0.505882382f, 0.501960814f, 0.505882382f, 0.505882382f, 0.501960814f,
+    0.505882382f, 0.505882382f, 0.505882382f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.505882382f, 0.505882382f, 0.505882382f, 0.505882382f, 0.505882382f, 0.505882382f, 0.501960814f, 0.501960814f,
+    0.505882382f, 0.505882382f, 0.501960814f, 0.505882382f, 0.505882382f, 0.505882382f, 0.505882382f, 0.447058856f,
+    0.227450997f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.501960814f, 0.505882382f, 0.501960814f, 0.505882382f, 0.501960814f, 0.505882382f, 0.501960814f, 0.501960814f,
+    0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.505882382f, 0.505882382f, 0.501960814f, 0.501960814f,
+    0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.505882382f, 0.505882382f, 0.501960814f,
+    0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.509803951f, 0.505882382f, 0.505882382f, 0.505882382f,
+    0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.505882382f, 0.501960814f, 0.501960814f,
+    0.505882382f, 0.505882382f, 0.505882382f, 0.505882382f, 0.505882382f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.501960814f, 0.505882382f, 0.505882382f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.505882382f, 0.509803951f, 0.505882382f, 0.501960814f,
+    0.501960814f, 0.501960814f, 0.505882382f, 0.505882382f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.505882382f, 0.505882382f, 0.505882382f, 0.505882382f, 0.505882382f, 0.501960814f, 0.501960814f, 0.505882382f,
+    0.505882382f, 0.501960814f, 0.505882382f, 0.505882382f, 0.505882382f, 0.505882382f, 0.505882382f, 0.231372565f,
+    0.011764707f, 0.0823529437f, 0.156862751f, 0.321568638f, 0.443137288f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.501960814f, 0.501960814f, 0.505882382f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.505882382f,
+    0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.505882382f, 0.505882382f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.505882382f, 0.501960814f, 0.505882382f, 0.505882382f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.501960814f, 0.501960814f, 0.501960814f, 0.505882382f, 0.505882382f, 0.505882382f, 0.501960814f, 0.501960814f,
+    0.505882382f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.505882382f, 0.505882382f,
+    0.505882382f, 0.505882382f, 0.505882382f, 0.505882382f, 0.501960814f, 0.501960814f, 0.505882382f, 0.505882382f,
+    0.505882382f, 0.505882382f, 0.505882382f, 0.501960814f, 0.501960814f, 0.501960814f, 0.505882382f, 0.505882382f,
+    0.501960814f, 0.505882382f, 0.505882382f, 0.478431404f, 0.31764707f, 0.192156881f, 0.0352941193f, 0.00784313772f,
+    0.011764707f, 0.0156862754f, 0.011764707f, 0.011764707f, 0.00784313772f, 0.129411772f, 0.313725501f, 0.443137288f,
+    0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.505882382f, 0.501960814f,
+    0.501960814f, 0.505882382f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.501960814f, 0.501960814f, 0.505882382f, 0.501960814f, 0.505882382f, 0.505882382f, 0.501960814f, 0.501960814f,
+    0.505882382f, 0.505882382f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.501960814f, 0.505882382f, 0.501960814f, 0.505882382f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.501960814f, 0.505882382f, 0.505882382f, 0.505882382f, 0.505882382f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.505882382f, 0.501960814f, 0.501960814f, 0.501960814f, 0.505882382f, 0.505882382f, 0.505882382f, 0.505882382f,
+    0.505882382f, 0.505882382f, 0.505882382f, 0.505882382f, 0.501960814f, 0.501960814f, 0.505882382f, 0.505882382f,
+    0.505882382f, 0.501960814f, 0.505882382f, 0.501960814f, 0.501960814f, 0.505882382f, 0.505882382f, 0.505882382f,
+    0.474509835f, 0.290196091f, 0.13333334f, 0.0156862754f, 0.011764707f, 0.00784313772f, 0.00392156886f, 0.00784313772f,
+    0.011764707f, 0.0156862754f, 0.00784313772f, 0.00392156886f, 0.00784313772f, 0.00392156886f, 0.00784313772f, 0.00784313772f,
+    0.160784319f, 0.352941185f, 0.501960814f, 0.501960814f, 0.505882382f, 0.501960814f, 0.505882382f, 0.501960814f,
+    0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.505882382f, 0.501960814f, 0.501960814f,
+    0.501960814f, 0.505882382f, 0.505882382f, 0.501960814f, 0.501960814f, 0.501960814f, 0.505882382f, 0.501960814f,
+    0.505882382f, 0.501960814f, 0.505882382f, 0.505882382f, 0.505882382f, 0.505882382f, 0.505882382f, 0.505882382f,
+    0.501960814f, 0.509803951f, 0.501960814f, 0.501960814f, 0.501960814f, 0.505882382f, 0.501960814f, 0.501960814f,
+    0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.505882382f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.501960814f, 0.505882382f, 0.505882382f, 0.505882382f, 0.505882382f, 0.505882382f, 0.505882382f, 0.505882382f,
+    0.505882382f, 0.505882382f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.505882382f, 0.505882382f,
+    0.505882382f, 0.505882382f, 0.505882382f, 0.505882382f, 0.505882382f, 0.505882382f, 0.505882382f, 0.505882382f,
+    0.505882382f, 0.505882382f, 0.501960814f, 0.501960814f, 0.505882382f, 0.505882382f, 0.380392194f, 0.13333334f,
+    0.0156862754f, 0.0196078438f, 0.011764707f, 0.011764707f, 0.00392156886f, 0.00784313772f, 0.00784313772f, 0.00392156886f,
+    0.0156862754f, 0.0156862754f, 0.011764707f, 0.011764707f, 0.00784313772f, 0.00784313772f, 0.00784313772f, 0.00784313772f,
+    0.0156862754f, 0.011764707f, 0.0627451017f, 0.31764707f, 0.501960814f, 0.501960814f, 0.501960814f, 0.509803951f,
+    0.509803951f, 0.501960814f, 0.501960814f, 0.505882382f, 0.505882382f, 0.505882382f, 0.501960814f, 0.505882382f,
+    0.501960814f, 0.501960814f, 0.505882382f, 0.501960814f, 0.505882382f, 0.501960814f, 0.501960814f, 0.505882382f,
+    0.505882382f, 0.501960814f, 0.509803951f, 0.505882382f, 0.505882382f, 0.505882382f, 0.505882382f, 0.509803951f,
+    0.509803951f, 0.505882382f, 0.501960814f, 0.501960814f, 0.501960814f, 0.505882382f, 0.501960814f, 0.501960814f,
+    0.505882382f, 0.501960814f, 0.501960814f, 0.501960814f, 0.505882382f, 0.505882382f, 0.501960814f, 0.501960814f,
+    0.501960814f, 0.501960814f, 0.505882382f, 0.505882382f, 0.505882382f, 0.505882382f, 0.505882382f, 0.505882382f,
+    0.505882382f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.505882382f, 0.505882382f,
+    0.505882382f, 0.505882382f, 0.505882382f, 0.501960814f, 0.505882382f, 0.505882382f, 0.505882382f, 0.505882382f,
+    0.501960814f, 0.505882382f, 0.501960814f, 0.474509835f, 0.258823544f, 0.0745098069f, 0.011764707f, 0.011764707f,
+    0.0235294141f, 0.0235294141f, 0.011764707f, 0.011764707f, 0.00784313772f, 0.0156862754f, 0.00784313772f, 0.00784313772f,
+    0.0156862754f, 0.011764707f, 0.011764707f, 0.011764707f, 0.0196078438f, 0.0156862754f, 0.0156862754f, 0.011764707f,
+    0.0156862754f, 0.0156862754f, 0.00784313772f, 0.00784313772f, 0.0705882385f, 0.258823544f, 0.443137288f, 0.505882382f,
+    0.505882382f, 0.505882382f, 0.501960814f, 0.505882382f, 0.509803951f, 0.505882382f, 0.501960814f, 0.501960814f,
+    0.505882382f, 0.505882382f, 0.505882382f, 0.505882382f, 0.505882382f, 0.505882382f, 0.505882382f, 0.505882382f,
+    0.505882382f, 0.501960814f, 0.501960814f, 0.505882382f, 0.501960814f, 0.505882382f, 0.505882382f, 0.509803951f,
+    0.505882382f, 0.505882382f, 0.505882382f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.501960814f, 0.505882382f, 0.505882382f, 0.501960814f, 0.505882382f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.501960814f, 0.505882382f, 0.501960814f, 0.505882382f, 0.505882382f, 0.505882382f, 0.505882382f, 0.505882382f,
+    0.505882382f, 0.505882382f, 0.501960814f, 0.501960814f, 0.501960814f, 0.505882382f, 0.505882382f, 0.505882382f,
+    0.505882382f, 0.505882382f, 0.501960814f, 0.505882382f, 0.505882382f, 0.505882382f, 0.505882382f, 0.505882382f,
+    0.505882382f, 0.474509835f, 0.254901975f, 0.0352941193f, 0.00784313772f, 0.00784313772f, 0.00784313772f, 0.0156862754f,
+    0.0156862754f, 0.0196078438f, 0.011764707f, 0.00784313772f, 0.0156862754f, 0.011764707f, 0.00392156886f, 0.00784313772f,
+    0.0156862754f, 0.00784313772f, 0.011764707f, 0.0156862754f, 0.0196078438f, 0.0156862754f, 0.00784313772f, 0.011764707f,
+    0.0196078438f, 0.0196078438f, 0.00784313772f, 0.011764707f, 0.00784313772f, 0.0156862754f, 0.0627451017f, 0.31764707f,
+    0.505882382f, 0.501960814f, 0.501960814f, 0.505882382f, 0.509803951f, 0.509803951f, 0.505882382f, 0.505882382f,
+    0.505882382f, 0.509803951f, 0.505882382f, 0.505882382f, 0.505882382f, 0.505882382f, 0.505882382f, 0.505882382f,
+    0.505882382f, 0.501960814f, 0.501960814f, 0.505882382f, 0.501960814f, 0.501960814f, 0.505882382f, 0.505882382f,
+    0.505882382f, 0.505882382f, 0.505882382f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.505882382f, 0.505882382f, 0.505882382f, 0.505882382f, 0.505882382f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.505882382f, 0.505882382f, 0.501960814f, 0.505882382f, 0.505882382f, 0.505882382f, 0.501960814f, 0.505882382f,
+    0.505882382f, 0.505882382f, 0.501960814f, 0.501960814f, 0.505882382f, 0.505882382f, 0.501960814f, 0.505882382f,
+    0.505882382f, 0.505882382f, 0.501960814f, 0.505882382f, 0.505882382f, 0.505882382f, 0.505882382f, 0.478431404f,
+    0.258823544f, 0.0392156877f, 0.0156862754f, 0.00784313772f, 0.00784313772f, 0.00784313772f, 0.00784313772f, 0.00784313772f,
+    0.0156862754f, 0.0196078438f, 0.0156862754f, 0.011764707f, 0.0156862754f, 0.011764707f, 0.00784313772f, 0.00784313772f,
+    0.011764707f, 0.011764707f, 0.011764707f, 0.0156862754f, 0.011764707f, 0.00784313772f, 0.0156862754f, 0.0156862754f,
+    0.011764707f, 0.0196078438f, 0.0156862754f, 0.00784313772f, 0.00784313772f, 0.00784313772f, 0.0f, 0.00784313772f,
+    0.0666666701f, 0.325490206f, 0.501960814f, 0.505882382f, 0.509803951f, 0.505882382f, 0.501960814f, 0.505882382f,
+    0.501960814f, 0.501960814f, 0.505882382f, 0.501960814f, 0.509803951f, 0.505882382f, 0.505882382f, 0.505882382f,
+    0.505882382f, 0.505882382f, 0.501960814f, 0.501960814f, 0.505882382f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.501960814f, 0.501960814f, 0.505882382f, 0.505882382f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.505882382f, 0.505882382f, 0.505882382f, 0.505882382f, 0.505882382f, 0.505882382f, 0.505882382f, 0.505882382f,
+    0.505882382f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.501960814f, 0.501960814f, 0.501960814f, 0.505882382f, 0.505882382f, 0.505882382f, 0.505882382f, 0.505882382f,
+    0.505882382f, 0.505882382f, 0.505882382f, 0.505882382f, 0.505882382f, 0.505882382f, 0.349019617f, 0.0705882385f,
+    0.0156862754f, 0.011764707f, 0.011764707f, 0.00784313772f, 0.0156862754f, 0.0156862754f, 0.0156862754f, 0.011764707f,
+    0.0156862754f, 0.0156862754f, 0.0156862754f, 0.011764707f, 0.011764707f, 0.00784313772f, 0.011764707f, 0.0156862754f,
+    0.011764707f, 0.011764707f, 0.00784313772f, 0.011764707f, 0.00784313772f, 0.00784313772f, 0.011764707f, 0.0156862754f,
+    0.011764707f, 0.0156862754f, 0.00392156886f, 0.00392156886f, 0.00392156886f, 0.00784313772f, 0.0f, 0.00392156886f,
+    0.011764707f, 0.011764707f, 0.156862751f, 0.43921572f, 0.501960814f, 0.505882382f, 0.501960814f, 0.501960814f,
+    0.505882382f, 0.501960814f, 0.501960814f, 0.501960814f, 0.505882382f, 0.509803951f, 0.505882382f, 0.505882382f,
+    0.509803951f, 0.505882382f, 0.501960814f, 0.501960814f, 0.505882382f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.501960814f, 0.501960814f, 0.505882382f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.501960814f, 0.505882382f, 0.505882382f, 0.505882382f, 0.501960814f, 0.501960814f, 0.501960814f, 0.505882382f,
+    0.505882382f, 0.505882382f, 0.501960814f, 0.501960814f, 0.501960814f, 0.505882382f, 0.501960814f, 0.501960814f,
+    0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.505882382f, 0.505882382f, 0.505882382f, 0.505882382f,
+    0.501960814f, 0.505882382f, 0.505882382f, 0.505882382f, 0.447058856f, 0.13333334f, 0.0156862754f, 0.011764707f,
+    0.011764707f, 0.011764707f, 0.0156862754f, 0.011764707f, 0.011764707f, 0.00784313772f, 0.011764707f, 0.011764707f,
+    0.0156862754f, 0.0156862754f, 0.011764707f, 0.011764707f, 0.00392156886f, 0.00784313772f, 0.011764707f, 0.011764707f,
+    0.011764707f, 0.00784313772f, 0.011764707f, 0.00784313772f, 0.011764707f, 0.011764707f, 0.011764707f, 0.0156862754f,
+    0.011764707f, 0.0156862754f, 0.0196078438f, 0.0156862754f, 0.011764707f, 0.00784313772f, 0.00392156886f, 0.00784313772f,
+    0.00784313772f, 0.00784313772f, 0.0f, 0.00784313772f, 0.254901975f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.505882382f, 0.505882382f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.505882382f,
+    0.505882382f, 0.505882382f, 0.505882382f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.501960814f, 0.505882382f, 0.501960814f, 0.501960814f, 0.501960814f, 0.505882382f, 0.501960814f, 0.501960814f,
+    0.505882382f, 0.505882382f, 0.501960814f, 0.501960814f, 0.505882382f, 0.501960814f, 0.501960814f, 0.505882382f,
+    0.509803951f, 0.505882382f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.505882382f,
+    0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.505882382f, 0.505882382f, 0.505882382f, 0.505882382f,
+    0.505882382f, 0.505882382f, 0.505882382f, 0.290196091f, 0.0431372561f, 0.011764707f, 0.011764707f, 0.011764707f,
+    0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f,
+    0.0196078438f, 0.011764707f, 0.00392156886f, 0.011764707f, 0.00392156886f, 0.00784313772f, 0.00392156886f, 0.00784313772f,
+    0.0156862754f, 0.0156862754f, 0.011764707f, 0.0156862754f, 0.011764707f, 0.0156862754f, 0.011764707f, 0.011764707f,
+    0.011764707f, 0.011764707f, 0.011764707f, 0.0156862754f, 0.011764707f, 0.0156862754f, 0.0f, 0.00784313772f,
+    0.0f, 0.00784313772f, 0.00392156886f, 0.00392156886f, 0.0f, 0.0941176564f, 0.443137288f, 0.505882382f,
+    0.505882382f, 0.505882382f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.505882382f,
+    0.505882382f, 0.505882382f, 0.501960814f, 0.505882382f, 0.505882382f, 0.505882382f, 0.501960814f, 0.505882382f,
+    0.501960814f, 0.505882382f, 0.501960814f, 0.501960814f, 0.505882382f, 0.505882382f, 0.501960814f, 0.505882382f,
+    0.509803951f, 0.505882382f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.505882382f, 0.505882382f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.505882382f, 0.505882382f,
+    0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.505882382f, 0.505882382f, 0.505882382f, 0.505882382f,
+    0.505882382f, 0.443137288f, 0.13333334f, 0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f,
+    0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f, 0.0156862754f,
+    0.0196078438f, 0.0156862754f, 0.011764707f, 0.011764707f, 0.00392156886f, 0.00392156886f, 0.00392156886f, 0.00392156886f,
+    0.011764707f, 0.011764707f, 0.0156862754f, 0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f,
+    0.011764707f, 0.0156862754f, 0.00784313772f, 0.00784313772f, 0.011764707f, 0.00784313772f, 0.0f, 0.00392156886f,
+    0.011764707f, 0.00784313772f, 0.0f, 0.0f, 0.011764707f, 0.00392156886f, 0.0666666701f, 0.31764707f,
+    0.505882382f, 0.501960814f, 0.501960814f, 0.501960814f, 0.505882382f, 0.505882382f, 0.501960814f, 0.505882382f,
+    0.505882382f, 0.505882382f, 0.505882382f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.505882382f,
+    0.501960814f, 0.505882382f, 0.501960814f, 0.501960814f, 0.501960814f, 0.505882382f, 0.501960814f, 0.509803951f,
+    0.505882382f, 0.505882382f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.505882382f, 0.501960814f,
+    0.505882382f, 0.505882382f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.505882382f, 0.505882382f,
+    0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.505882382f, 0.505882382f, 0.505882382f, 0.505882382f,
+    0.349019617f, 0.0392156877f, 0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f,
+    0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f,
+    0.0196078438f, 0.0156862754f, 0.011764707f, 0.011764707f, 0.00784313772f, 0.011764707f, 0.00784313772f, 0.00784313772f,
+    0.011764707f, 0.0156862754f, 0.0156862754f, 0.0156862754f, 0.011764707f, 0.011764707f, 0.0156862754f, 0.011764707f,
+    0.011764707f, 0.011764707f, 0.011764707f, 0.0156862754f, 0.011764707f, 0.011764707f, 0.00392156886f, 0.00392156886f,
+    0.00392156886f, 0.00392156886f, 0.00784313772f, 0.00392156886f, 0.0156862754f, 0.00784313772f, 0.00392156886f, 0.0156862754f,
+    0.258823544f, 0.505882382f, 0.505882382f, 0.505882382f, 0.505882382f, 0.509803951f, 0.505882382f, 0.505882382f,
+    0.505882382f, 0.505882382f, 0.505882382f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.505882382f,
+    0.509803951f, 0.505882382f, 0.505882382f, 0.501960814f, 0.501960814f, 0.505882382f, 0.505882382f, 0.505882382f,
+    0.505882382f, 0.505882382f, 0.501960814f, 0.501960814f, 0.501960814f, 0.505882382f, 0.505882382f, 0.505882382f,
+    0.501960814f, 0.505882382f, 0.505882382f, 0.505882382f, 0.501960814f, 0.505882382f, 0.505882382f, 0.505882382f,
+    0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.505882382f, 0.505882382f, 0.505882382f, 0.223529428f,
+    0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f, 0.0156862754f, 0.011764707f, 0.011764707f, 0.011764707f,
+    0.011764707f, 0.011764707f, 0.00784313772f, 0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f,
+    0.0156862754f, 0.0196078438f, 0.011764707f, 0.00784313772f, 0.00392156886f, 0.00784313772f, 0.00392156886f, 0.00784313772f,
+    0.011764707f, 0.011764707f, 0.011764707f, 0.00784313772f, 0.011764707f, 0.011764707f, 0.0196078438f, 0.0156862754f,
+    0.011764707f, 0.0156862754f, 0.0156862754f, 0.011764707f, 0.00784313772f, 0.011764707f, 0.00784313772f, 0.00784313772f,
+    0.0156862754f, 0.011764707f, 0.00784313772f, 0.011764707f, 0.00392156886f, 0.011764707f, 0.00392156886f, 0.00784313772f,
+    0.00784313772f, 0.13333334f, 0.474509835f, 0.505882382f, 0.501960814f, 0.505882382f, 0.505882382f, 0.509803951f,
+    0.505882382f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.505882382f,
+    0.505882382f, 0.505882382f, 0.501960814f, 0.505882382f, 0.501960814f, 0.505882382f, 0.501960814f, 0.501960814f,
+    0.501960814f, 0.505882382f, 0.505882382f, 0.505882382f, 0.501960814f, 0.505882382f, 0.505882382f, 0.505882382f,
+    0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.505882382f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.501960814f, 0.505882382f, 0.501960814f, 0.501960814f, 0.501960814f, 0.470588267f, 0.13333334f, 0.011764707f,
+    0.00784313772f, 0.011764707f, 0.011764707f, 0.011764707f, 0.0156862754f, 0.011764707f, 0.0156862754f, 0.011764707f,
+    0.011764707f, 0.011764707f, 0.00784313772f, 0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f,
+    0.0196078438f, 0.0156862754f, 0.0156862754f, 0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f,
+    0.011764707f, 0.0156862754f, 0.00784313772f, 0.011764707f, 0.011764707f, 0.011764707f, 0.0156862754f, 0.0156862754f,
+    0.011764707f, 0.0196078438f, 0.0156862754f, 0.0156862754f, 0.0156862754f, 0.0156862754f, 0.011764707f, 0.011764707f,
+    0.011764707f, 0.011764707f, 0.00784313772f, 0.00784313772f, 0.00392156886f, 0.011764707f, 0.00784313772f, 0.011764707f,
+    0.0156862754f, 0.011764707f, 0.0745098069f, 0.443137288f, 0.501960814f, 0.505882382f, 0.505882382f, 0.501960814f,
+    0.505882382f, 0.501960814f, 0.505882382f, 0.505882382f, 0.501960814f, 0.501960814f, 0.501960814f, 0.505882382f,
+    0.505882382f, 0.505882382f, 0.505882382f, 0.501960814f, 0.505882382f, 0.505882382f, 0.501960814f, 0.501960814f,
+    0.501960814f, 0.505882382f, 0.505882382f, 0.505882382f, 0.501960814f, 0.501960814f, 0.505882382f, 0.505882382f,
+    0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.505882382f,
+    0.505882382f, 0.505882382f, 0.501960814f, 0.501960814f, 0.443137288f, 0.0666666701f, 0.011764707f, 0.011764707f,
+    0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f,
+    0.011764707f, 0.0196078438f, 0.011764707f, 0.0156862754f, 0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f,
+    0.0156862754f, 0.0156862754f, 0.0196078438f, 0.011764707f, 0.011764707f, 0.011764707f, 0.0156862754f, 0.011764707f,
+    0.0156862754f, 0.0156862754f, 0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f,
+    0.0156862754f, 0.0156862754f, 0.011764707f, 0.0156862754f, 0.011764707f, 0.011764707f, 0.011764707f, 0.00392156886f,
+    0.011764707f, 0.011764707f, 0.011764707f, 0.0156862754f, 0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f,
+    0.0156862754f, 0.0156862754f, 0.0156862754f, 0.0705882385f, 0.443137288f, 0.505882382f, 0.501960814f, 0.501960814f,
+    0.505882382f, 0.505882382f, 0.505882382f, 0.505882382f, 0.501960814f, 0.505882382f, 0.501960814f, 0.505882382f,
+    0.505882382f, 0.501960814f, 0.505882382f, 0.505882382f, 0.501960814f, 0.505882382f, 0.505882382f, 0.505882382f,
+    0.505882382f, 0.505882382f, 0.505882382f, 0.505882382f, 0.501960814f, 0.505882382f, 0.501960814f, 0.505882382f,
+    0.501960814f, 0.501960814f, 0.505882382f, 0.505882382f, 0.501960814f, 0.501960814f, 0.505882382f, 0.505882382f,
+    0.505882382f, 0.505882382f, 0.501960814f, 0.443137288f, 0.0705882385f, 0.00784313772f, 0.00784313772f, 0.011764707f,
+    0.00784313772f, 0.00784313772f, 0.011764707f, 0.011764707f, 0.011764707f, 0.0156862754f, 0.0196078438f, 0.011764707f,
+    0.0156862754f, 0.0196078438f, 0.0156862754f, 0.0156862754f, 0.0196078438f, 0.011764707f, 0.011764707f, 0.011764707f,
+    0.0156862754f, 0.0156862754f, 0.011764707f, 0.00784313772f, 0.0156862754f, 0.00784313772f, 0.00784313772f, 0.00392156886f,
+    0.0156862754f, 0.0156862754f, 0.00784313772f, 0.011764707f, 0.011764707f, 0.0156862754f, 0.011764707f, 0.0156862754f,
+    0.0196078438f, 0.0196078438f, 0.011764707f, 0.0156862754f, 0.011764707f, 0.00784313772f, 0.011764707f, 0.00784313772f,
+    0.00392156886f, 0.0156862754f, 0.0156862754f, 0.0156862754f, 0.0156862754f, 0.011764707f, 0.0156862754f, 0.0156862754f,
+    0.00784313772f, 0.011764707f, 0.011764707f, 0.011764707f, 0.0705882385f, 0.443137288f, 0.505882382f, 0.505882382f,
+    0.505882382f, 0.505882382f, 0.505882382f, 0.505882382f, 0.509803951f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.505882382f, 0.505882382f, 0.505882382f, 0.509803951f, 0.505882382f, 0.505882382f, 0.509803951f, 0.505882382f,
+    0.509803951f, 0.509803951f, 0.505882382f, 0.505882382f, 0.501960814f, 0.505882382f, 0.501960814f, 0.501960814f,
+    0.501960814f, 0.505882382f, 0.505882382f, 0.505882382f, 0.501960814f, 0.501960814f, 0.505882382f, 0.505882382f,
+    0.505882382f, 0.505882382f, 0.411764741f, 0.0705882385f, 0.011764707f, 0.011764707f, 0.011764707f, 0.0156862754f,
+    0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f, 0.0156862754f, 0.0156862754f, 0.011764707f,
+    0.0156862754f, 0.0156862754f, 0.0156862754f, 0.0156862754f, 0.0156862754f, 0.011764707f, 0.011764707f, 0.00784313772f,
+    0.0156862754f, 0.0156862754f, 0.00784313772f, 0.00784313772f, 0.00784313772f, 0.00784313772f, 0.00784313772f, 0.00784313772f,
+    0.0156862754f, 0.0156862754f, 0.011764707f, 0.011764707f, 0.011764707f, 0.0156862754f, 0.011764707f, 0.0156862754f,
+    0.0156862754f, 0.0196078438f, 0.011764707f, 0.0156862754f, 0.011764707f, 0.00392156886f, 0.00784313772f, 0.00784313772f,
+    0.011764707f, 0.0156862754f, 0.0156862754f, 0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f,
+    0.0156862754f, 0.011764707f, 0.0156862754f, 0.0156862754f, 0.00784313772f, 0.0392156877f, 0.411764741f, 0.505882382f,
+    0.505882382f, 0.505882382f, 0.505882382f, 0.505882382f, 0.505882382f, 0.505882382f, 0.501960814f, 0.501960814f,
+    0.501960814f, 0.505882382f, 0.505882382f, 0.509803951f, 0.505882382f, 0.505882382f, 0.505882382f, 0.505882382f,
+    0.505882382f, 0.505882382f, 0.505882382f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.505882382f, 0.505882382f, 0.505882382f, 0.505882382f, 0.501960814f, 0.501960814f, 0.505882382f, 0.501960814f,
+    0.505882382f, 0.443137288f, 0.0431372561f, 0.0156862754f, 0.00392156886f, 0.011764707f, 0.011764707f, 0.00784313772f,
+    0.00784313772f, 0.011764707f, 0.0f, 0.00784313772f, 0.0156862754f, 0.011764707f, 0.011764707f, 0.011764707f,
+    0.011764707f, 0.011764707f, 0.0156862754f, 0.0156862754f, 0.011764707f, 0.00784313772f, 0.011764707f, 0.011764707f,
+    0.0156862754f, 0.0196078438f, 0.00784313772f, 0.011764707f, 0.00784313772f, 0.00784313772f, 0.00784313772f, 0.00784313772f,
+    0.0156862754f, 0.0156862754f, 0.0156862754f, 0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f,
+    0.011764707f, 0.0156862754f, 0.011764707f, 0.0156862754f, 0.00784313772f, 0.0156862754f, 0.00784313772f, 0.00784313772f,
+    0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f, 0.0156862754f,
+    0.011764707f, 0.00392156886f, 0.00784313772f, 0.011764707f, 0.011764707f, 0.011764707f, 0.0745098069f, 0.447058856f,
+    0.505882382f, 0.505882382f, 0.505882382f, 0.505882382f, 0.505882382f, 0.505882382f, 0.501960814f, 0.501960814f,
+    0.505882382f, 0.505882382f, 0.505882382f, 0.505882382f, 0.505882382f, 0.505882382f, 0.505882382f, 0.505882382f,
+    0.501960814f, 0.505882382f, 0.501960814f, 0.501960814f, 0.501960814f, 0.505882382f, 0.501960814f, 0.505882382f,
+    0.509803951f, 0.509803951f, 0.501960814f, 0.501960814f, 0.501960814f, 0.505882382f, 0.505882382f, 0.501960814f,
+    0.443137288f, 0.0705882385f, 0.0156862754f, 0.00784313772f, 0.011764707f, 0.0156862754f, 0.011764707f, 0.0156862754f,
+    0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f, 0.00784313772f, 0.011764707f, 0.0156862754f, 0.011764707f,
+    0.00784313772f, 0.0156862754f, 0.0156862754f, 0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f, 0.0156862754f,
+    0.0156862754f, 0.0156862754f, 0.011764707f, 0.00784313772f, 0.011764707f, 0.00784313772f, 0.00784313772f, 0.00784313772f,
+    0.011764707f, 0.0156862754f, 0.011764707f, 0.011764707f, 0.00784313772f, 0.011764707f, 0.00784313772f, 0.011764707f,
+    0.011764707f, 0.011764707f, 0.00784313772f, 0.00784313772f, 0.00784313772f, 0.00784313772f, 0.00784313772f, 0.00392156886f,
+    0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f, 0.00784313772f, 0.00784313772f, 0.011764707f, 0.011764707f,
+    0.011764707f, 0.0156862754f, 0.00392156886f, 0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f, 0.0705882385f,
+    0.443137288f, 0.509803951f, 0.505882382f, 0.505882382f, 0.505882382f, 0.505882382f, 0.501960814f, 0.501960814f,
+    0.505882382f, 0.505882382f, 0.505882382f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.505882382f,
+    0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.505882382f, 0.501960814f, 0.505882382f, 0.505882382f,
+    0.509803951f, 0.505882382f, 0.505882382f, 0.505882382f, 0.501960814f, 0.501960814f, 0.509803951f, 0.443137288f,
+    0.0705882385f, 0.00784313772f, 0.00784313772f, 0.0156862754f, 0.011764707f, 0.0156862754f, 0.011764707f, 0.011764707f,
+    0.011764707f, 0.0156862754f, 0.00784313772f, 0.011764707f, 0.00784313772f, 0.0196078438f, 0.0156862754f, 0.011764707f,
+    0.0156862754f, 0.011764707f, 0.00784313772f, 0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f,
+    0.0156862754f, 0.0156862754f, 0.011764707f, 0.011764707f, 0.0156862754f, 0.011764707f, 0.00784313772f, 0.00784313772f,
+    0.011764707f, 0.0156862754f, 0.0156862754f, 0.0156862754f, 0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f,
+    0.00784313772f, 0.0156862754f, 0.00784313772f, 0.00392156886f, 0.00392156886f, 0.00392156886f, 0.00784313772f, 0.00784313772f,
+    0.00784313772f, 0.011764707f, 0.00784313772f, 0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f,
+    0.0196078438f, 0.0156862754f, 0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f, 0.0156862754f, 0.011764707f,
+    0.0666666701f, 0.474509835f, 0.505882382f, 0.505882382f, 0.505882382f, 0.505882382f, 0.509803951f, 0.505882382f,
+    0.505882382f, 0.505882382f, 0.505882382f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.505882382f,
+    0.505882382f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.505882382f, 0.505882382f,
+    0.505882382f, 0.505882382f, 0.509803951f, 0.505882382f, 0.505882382f, 0.505882382f, 0.478431404f, 0.0705882385f,
+    0.0156862754f, 0.011764707f, 0.011764707f, 0.011764707f, 0.00784313772f, 0.011764707f, 0.00784313772f, 0.0156862754f,
+    0.011764707f, 0.0156862754f, 0.011764707f, 0.0156862754f, 0.011764707f, 0.0156862754f, 0.00784313772f, 0.011764707f,
+    0.00784313772f, 0.011764707f, 0.011764707f, 0.011764707f, 0.0156862754f, 0.0196078438f, 0.0196078438f, 0.0196078438f,
+    0.011764707f, 0.0156862754f, 0.011764707f, 0.0156862754f, 0.011764707f, 0.011764707f, 0.00784313772f, 0.00784313772f,
+    0.011764707f, 0.0156862754f, 0.011764707f, 0.0156862754f, 0.00784313772f, 0.0156862754f, 0.011764707f, 0.00784313772f,
+    0.00784313772f, 0.00784313772f, 0.011764707f, 0.00784313772f, 0.00784313772f, 0.00784313772f, 0.00392156886f, 0.00392156886f,
+    0.00784313772f, 0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f, 0.0156862754f, 0.0156862754f, 0.0196078438f,
+    0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f, 0.00784313772f, 0.011764707f,
+    0.00392156886f, 0.129411772f, 0.505882382f, 0.501960814f, 0.501960814f, 0.501960814f, 0.505882382f, 0.505882382f,
+    0.501960814f, 0.505882382f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.505882382f, 0.505882382f, 0.501960814f, 0.501960814f, 0.501960814f, 0.505882382f, 0.505882382f, 0.505882382f,
+    0.509803951f, 0.505882382f, 0.505882382f, 0.505882382f, 0.501960814f, 0.505882382f, 0.137254909f, 0.0196078438f,
+    0.0196078438f, 0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f, 0.00392156886f, 0.0156862754f, 0.00784313772f,
+    0.011764707f, 0.0196078438f, 0.00784313772f, 0.011764707f, 0.0156862754f, 0.0156862754f, 0.011764707f, 0.011764707f,
+    0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f, 0.00784313772f, 0.011764707f,
+    0.011764707f, 0.011764707f, 0.0156862754f, 0.011764707f, 0.011764707f, 0.011764707f, 0.00784313772f, 0.00784313772f,
+    0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f, 0.00784313772f,
+    0.00784313772f, 0.00784313772f, 0.011764707f, 0.00392156886f, 0.00784313772f, 0.00392156886f, 0.00784313772f, 0.00784313772f,
+    0.00784313772f, 0.011764707f, 0.00784313772f, 0.011764707f, 0.011764707f, 0.011764707f, 0.0156862754f, 0.0196078438f,
+    0.0196078438f, 0.011764707f, 0.0156862754f, 0.0156862754f, 0.0156862754f, 0.00784313772f, 0.011764707f, 0.00784313772f,
+    0.00784313772f, 0.00784313772f, 0.223529428f, 0.501960814f, 0.501960814f, 0.501960814f, 0.505882382f, 0.501960814f,
+    0.501960814f, 0.505882382f, 0.505882382f, 0.501960814f, 0.501960814f, 0.501960814f, 0.505882382f, 0.501960814f,
+    0.505882382f, 0.505882382f, 0.505882382f, 0.505882382f, 0.505882382f, 0.501960814f, 0.505882382f, 0.505882382f,
+    0.505882382f, 0.505882382f, 0.505882382f, 0.505882382f, 0.505882382f, 0.254901975f, 0.0156862754f, 0.0196078438f,
+    0.0156862754f, 0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f, 0.0156862754f, 0.00784313772f, 0.00784313772f,
+    0.0156862754f, 0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f, 0.0156862754f, 0.011764707f, 0.011764707f,
+    0.011764707f, 0.0156862754f, 0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f, 0.00784313772f, 0.011764707f,
+    0.011764707f, 0.011764707f, 0.0156862754f, 0.011764707f, 0.011764707f, 0.0156862754f, 0.00784313772f, 0.00784313772f,
+    0.00784313772f, 0.0196078438f, 0.0156862754f, 0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f, 0.0235294141f,
+    0.00784313772f, 0.011764707f, 0.00784313772f, 0.011764707f, 0.00784313772f, 0.00784313772f, 0.00784313772f, 0.00784313772f,
+    0.011764707f, 0.00784313772f, 0.011764707f, 0.011764707f, 0.0196078438f, 0.0196078438f, 0.0196078438f, 0.0156862754f,
+    0.0156862754f, 0.00784313772f, 0.011764707f, 0.011764707f, 0.011764707f, 0.00784313772f, 0.0f, 0.00784313772f,
+    0.00784313772f, 0.00392156886f, 0.011764707f, 0.349019617f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.501960814f, 0.501960814f, 0.505882382f, 0.505882382f, 0.501960814f, 0.505882382f, 0.501960814f, 0.501960814f,
+    0.501960814f, 0.505882382f, 0.505882382f, 0.509803951f, 0.505882382f, 0.505882382f, 0.505882382f, 0.505882382f,
+    0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.313725501f, 0.00392156886f, 0.00784313772f, 0.00392156886f,
+    0.0156862754f, 0.011764707f, 0.011764707f, 0.011764707f, 0.00784313772f, 0.00392156886f, 0.00784313772f, 0.00784313772f,
+    0.0156862754f, 0.011764707f, 0.011764707f, 0.011764707f, 0.00784313772f, 0.00784313772f, 0.0156862754f, 0.011764707f,
+    0.011764707f, 0.0156862754f, 0.011764707f, 0.00784313772f, 0.0156862754f, 0.00784313772f, 0.00784313772f, 0.0156862754f,
+    0.0156862754f, 0.0156862754f, 0.011764707f, 0.00784313772f, 0.011764707f, 0.011764707f, 0.00392156886f, 0.0196078438f,
+    0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f, 0.0156862754f, 0.011764707f, 0.011764707f,
+    0.011764707f, 0.0156862754f, 0.00784313772f, 0.00784313772f, 0.00784313772f, 0.011764707f, 0.0f, 0.011764707f,
+    0.011764707f, 0.00784313772f, 0.0156862754f, 0.0156862754f, 0.0196078438f, 0.0196078438f, 0.0196078438f, 0.0156862754f,
+    0.011764707f, 0.0156862754f, 0.0156862754f, 0.011764707f, 0.011764707f, 0.0156862754f, 0.00784313772f, 0.011764707f,
+    0.00392156886f, 0.00784313772f, 0.011764707f, 0.0313725509f, 0.43921572f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.501960814f, 0.505882382f, 0.509803951f, 0.505882382f, 0.505882382f, 0.505882382f, 0.501960814f, 0.501960814f,
+    0.505882382f, 0.505882382f, 0.505882382f, 0.505882382f, 0.505882382f, 0.505882382f, 0.501960814f, 0.501960814f,
+    0.501960814f, 0.501960814f, 0.501960814f, 0.443137288f, 0.0705882385f, 0.00784313772f, 0.00392156886f, 0.011764707f,
+    0.011764707f, 0.0156862754f, 0.0196078438f, 0.011764707f, 0.00392156886f, 0.011764707f, 0.0156862754f, 0.011764707f,
+    0.00784313772f, 0.0156862754f, 0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f,
+    0.011764707f, 0.00784313772f, 0.011764707f, 0.0156862754f, 0.011764707f, 0.0156862754f, 0.00784313772f, 0.011764707f,
+    0.011764707f, 0.0156862754f, 0.011764707f, 0.00392156886f, 0.011764707f, 0.00784313772f, 0.00784313772f, 0.011764707f,
+    0.00392156886f, 0.00784313772f, 0.00392156886f, 0.0156862754f, 0.011764707f, 0.0156862754f, 0.00784313772f, 0.011764707f,
+    0.011764707f, 0.011764707f, 0.011764707f, 0.00392156886f, 0.011764707f, 0.011764707f, 0.00784313772f, 0.011764707f,
+    0.011764707f, 0.011764707f, 0.0156862754f, 0.011764707f, 0.0156862754f, 0.0156862754f, 0.00784313772f, 0.011764707f,
+    0.0156862754f, 0.0156862754f, 0.011764707f, 0.011764707f, 0.011764707f, 0.00784313772f, 0.0156862754f, 0.0156862754f,
+    0.011764707f, 0.011764707f, 0.011764707f, 0.00784313772f, 0.125490203f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.505882382f, 0.505882382f, 0.501960814f, 0.505882382f, 0.505882382f, 0.505882382f, 0.501960814f, 0.501960814f,
+    0.505882382f, 0.505882382f, 0.501960814f, 0.505882382f, 0.505882382f, 0.501960814f, 0.505882382f, 0.501960814f,
+    0.501960814f, 0.505882382f, 0.505882382f, 0.101960793f, 0.0156862754f, 0.0156862754f, 0.011764707f, 0.0156862754f,
+    0.0156862754f, 0.011764707f, 0.011764707f, 0.0156862754f, 0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f,
+    0.00784313772f, 0.0156862754f, 0.0196078438f, 0.0156862754f, 0.00784313772f, 0.011764707f, 0.00784313772f, 0.011764707f,
+    0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f, 0.0156862754f, 0.00784313772f, 0.0156862754f,
+    0.011764707f, 0.00784313772f, 0.00784313772f, 0.011764707f, 0.00784313772f, 0.011764707f, 0.0156862754f, 0.00784313772f,
+    0.00392156886f, 0.00392156886f, 0.00784313772f, 0.00392156886f, 0.00784313772f, 0.011764707f, 0.011764707f, 0.0156862754f,
+    0.011764707f, 0.011764707f, 0.00784313772f, 0.00784313772f, 0.00784313772f, 0.00784313772f, 0.00784313772f, 0.00784313772f,
+    0.0156862754f, 0.011764707f, 0.011764707f, 0.011764707f, 0.00784313772f, 0.00784313772f, 0.0156862754f, 0.0156862754f,
+    0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f, 0.00784313772f, 0.011764707f, 0.011764707f,
+    0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f, 0.00784313772f, 0.286274523f, 0.501960814f, 0.501960814f,
+    0.505882382f, 0.509803951f, 0.501960814f, 0.505882382f, 0.505882382f, 0.505882382f, 0.501960814f, 0.501960814f,
+    0.505882382f, 0.505882382f, 0.505882382f, 0.505882382f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.501960814f, 0.505882382f, 0.258823544f, 0.00784313772f, 0.0156862754f, 0.0156862754f, 0.011764707f, 0.00784313772f,
+    0.011764707f, 0.0156862754f, 0.011764707f, 0.0156862754f, 0.0156862754f, 0.0156862754f, 0.0156862754f, 0.0156862754f,
+    0.00784313772f, 0.0156862754f, 0.00392156886f, 0.0156862754f, 0.0156862754f, 0.011764707f, 0.011764707f, 0.011764707f,
+    0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f, 0.0156862754f, 0.0156862754f, 0.00784313772f,
+    0.00784313772f, 0.011764707f, 0.011764707f, 0.00784313772f, 0.011764707f, 0.00784313772f, 0.00392156886f, 0.00784313772f,
+    0.00784313772f, 0.011764707f, 0.00392156886f, 0.011764707f, 0.00784313772f, 0.011764707f, 0.011764707f, 0.011764707f,
+    0.00784313772f, 0.011764707f, 0.00784313772f, 0.0156862754f, 0.00784313772f, 0.011764707f, 0.00784313772f, 0.00784313772f,
+    0.0156862754f, 0.00784313772f, 0.011764707f, 0.011764707f, 0.0156862754f, 0.0156862754f, 0.011764707f, 0.00784313772f,
+    0.0196078438f, 0.00784313772f, 0.00392156886f, 0.011764707f, 0.011764707f, 0.011764707f, 0.00784313772f, 0.011764707f,
+    0.011764707f, 0.011764707f, 0.011764707f, 0.0156862754f, 0.00392156886f, 0.0352941193f, 0.443137288f, 0.501960814f,
+    0.509803951f, 0.505882382f, 0.505882382f, 0.509803951f, 0.505882382f, 0.505882382f, 0.501960814f, 0.505882382f,
+    0.505882382f, 0.505882382f, 0.505882382f, 0.505882382f, 0.505882382f, 0.501960814f, 0.501960814f, 0.501960814f,
+    0.505882382f, 0.447058856f, 0.0156862754f, 0.011764707f, 0.0196078438f, 0.0156862754f, 0.011764707f, 0.011764707f,
+    0.011764707f, 0.0196078438f, 0.0156862754f, 0.00784313772f, 0.011764707f, 0.0196078438f, 0.011764707f, 0.011764707f,
+    0.011764707f, 0.011764707f, 0.00784313772f, 0.011764707f, 0.011764707f, 0.011764707f, 0.00784313772f, 0.0156862754f,
+    0.0156862754f, 0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f, 0.00784313772f, 0.00784313772f,
+    0.00784313772f, 0.011764707f, 0.011764707f, 0.0156862754f, 0.0196078438f, 0.011764707f, 0.011764707f, 0.0156862754f,
+    0.00784313772f, 0.0156862754f, 0.00784313772f, 0.0196078438f, 0.00784313772f, 0.011764707f, 0.011764707f, 0.011764707f,
+    0.00784313772f, 0.011764707f, 0.011764707f, 0.0156862754f, 0.011764707f, 0.0156862754f, 0.011764707f, 0.00784313772f,
+    0.0156862754f, 0.011764707f, 0.011764707f, 0.011764707f, 0.0156862754f, 0.0156862754f, 0.0156862754f, 0.011764707f,
+    0.0156862754f, 0.0156862754f, 0.00784313772f, 0.00784313772f, 0.00784313772f, 0.0156862754f, 0.011764707f, 0.011764707f,
+    0.011764707f, 0.011764707f, 0.0156862754f, 0.011764707f, 0.00784313772f, 0.00784313772f, 0.13333334f, 0.505882382f,
+    0.505882382f, 0.509803951f, 0.505882382f, 0.509803951f, 0.505882382f, 0.509803951f, 0.501960814f, 0.505882382f,
+    0.505882382f, 0.505882382f, 0.505882382f, 0.505882382f, 0.505882382f, 0.505882382f, 0.501960814f, 0.505882382f,
+    0.505882382f, 0.164705887f, 0.00784313772f, 0.00784313772f, 0.00784313772f, 0.00784313772f, 0.0156862754f, 0.0156862754f,
+    0.00784313772f, 0.0156862754f, 0.00392156886f, 0.011764707f, 0.00784313772f, 0.011764707f, 0.00784313772f, 0.00784313772f,
+    0.0156862754f, 0.00784313772f, 0.00392156886f, 0.00784313772f, 0.00784313772f, 0.0156862754f, 0.011764707f, 0.011764707f,
+    0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f, 0.00784313772f, 0.011764707f, 0.00784313772f, 0.011764707f,
+    0.00784313772f, 0.00784313772f, 0.00784313772f, 0.011764707f, 0.0156862754f, 0.011764707f, 0.0156862754f, 0.00392156886f,
+    0.011764707f, 0.0196078438f, 0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f,
+    0.0156862754f, 0.0156862754f, 0.00392156886f, 0.011764707f, 0.00784313772f, 0.00392156886f, 0.011764707f, 0.0156862754f,
+    0.0196078438f, 0.0156862754f, 0.0156862754f, 0.011764707f, 0.011764707f, 0.0156862754f, 0.011764707f, 0.011764707f,
+    0.011764707f, 0.00784313772f, 0.011764707f, 0.011764707f, 0.011764707f, 0.0156862754f, 0.00784313772f, 0.00784313772f,
+    0.011764707f, 0.011764707f, 0.0f, 0.00784313772f, 0.00392156886f, 0.00784313772f, 0.00392156886f, 0.349019617f,
+    0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.505882382f, 0.509803951f, 0.501960814f, 0.505882382f,
+    0.505882382f, 0.505882382f, 0.505882382f, 0.505882382f, 0.505882382f, 0.505882382f, 0.501960814f, 0.505882382f,
+    0.321568638f, 0.0156862754f, 0.011764707f, 0.011764707f, 0.011764707f, 0.0196078438f, 0.0156862754f, 0.0156862754f,
+    0.011764707f, 0.011764707f, 0.0156862754f, 0.011764707f, 0.011764707f, 0.0156862754f, 0.011764707f, 0.011764707f,
+    0.00784313772f, 0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f, 0.0156862754f,
+    0.0156862754f, 0.0156862754f, 0.00784313772f, 0.00784313772f, 0.00784313772f, 0.00392156886f, 0.011764707f, 0.0156862754f,
+    0.011764707f, 0.011764707f, 0.0156862754f, 0.0156862754f, 0.011764707f, 0.00784313772f, 0.00784313772f, 0.00784313772f,
+    0.011764707f, 0.0196078438f, 0.011764707f, 0.011764707f, 0.00784313772f, 0.00784313772f, 0.011764707f, 0.0156862754f,
+    0.0156862754f, 0.0156862754f, 0.00784313772f, 0.00784313772f, 0.00392156886f, 0.00784313772f, 0.0156862754f, 0.011764707f,
+    0.0156862754f, 0.0196078438f, 0.0156862754f, 0.00784313772f, 0.011764707f, 0.0156862754f, 0.011764707f, 0.0156862754f,
+    0.011764707f, 0.00784313772f, 0.011764707f, 0.0196078438f, 0.0156862754f, 0.0156862754f, 0.00784313772f, 0.00784313772f,
+    0.011764707f, 0.011764707f, 0.0156862754f, 0.011764707f, 0.00784313772f, 0.00784313772f, 0.00784313772f, 0.0666666701f,
+    0.470588267f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.505882382f, 0.505882382f, 0.505882382f,
+    0.509803951f, 0.509803951f, 0.505882382f, 0.505882382f, 0.505882382f, 0.505882382f, 0.505882382f, 0.505882382f,
+    0.0666666701f, 0.011764707f, 0.011764707f, 0.011764707f, 0.00392156886f, 0.0156862754f, 0.00784313772f, 0.011764707f,
+    0.011764707f, 0.0196078438f, 0.011764707f, 0.011764707f, 0.00784313772f, 0.0156862754f, 0.011764707f, 0.0196078438f,
+    0.011764707f, 0.00784313772f, 0.011764707f, 0.011764707f, 0.011764707f, 0.0156862754f, 0.011764707f, 0.011764707f,
+    0.0156862754f, 0.0156862754f, 0.0156862754f, 0.00784313772f, 0.00392156886f, 0.00392156886f, 0.011764707f, 0.011764707f,
+    0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f, 0.00784313772f, 0.00784313772f,
+    0.00784313772f, 0.0156862754f, 0.0156862754f, 0.0156862754f, 0.00784313772f, 0.011764707f, 0.0156862754f, 0.0156862754f,
+    0.011764707f, 0.0196078438f, 0.011764707f, 0.011764707f, 0.0156862754f, 0.0156862754f, 0.011764707f, 0.00784313772f,
+    0.011764707f, 0.00784313772f, 0.00784313772f, 0.0156862754f, 0.00784313772f, 0.011764707f, 0.00784313772f, 0.00784313772f,
+    0.00392156886f, 0.011764707f, 0.011764707f, 0.011764707f, 0.00784313772f, 0.011764707f, 0.011764707f, 0.011764707f,
+    0.0156862754f, 0.011764707f, 0.011764707f, 0.0156862754f, 0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f,
+    0.254901975f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.501960814f, 0.505882382f, 0.509803951f,
+    0.505882382f, 0.505882382f, 0.505882382f, 0.505882382f, 0.509803951f, 0.505882382f, 0.505882382f, 0.321568638f,
+    0.0156862754f, 0.0156862754f, 0.0156862754f, 0.011764707f, 0.011764707f, 0.0196078438f, 0.011764707f, 0.011764707f,
+    0.00784313772f, 0.011764707f, 0.00784313772f, 0.011764707f, 0.00784313772f, 0.011764707f, 0.00392156886f, 0.00784313772f,
+    0.00784313772f, 0.00784313772f, 0.011764707f, 0.011764707f, 0.00784313772f, 0.011764707f, 0.0196078438f, 0.011764707f,
+    0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f,
+    0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f, 0.0156862754f, 0.011764707f, 0.0156862754f, 0.0156862754f,
+    0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f, 0.0156862754f, 0.011764707f,
+    0.0156862754f, 0.0156862754f, 0.00784313772f, 0.0156862754f, 0.011764707f, 0.0156862754f, 0.00784313772f, 0.0156862754f,
+    0.00784313772f, 0.00784313772f, 0.0f, 0.00784313772f, 0.00784313772f, 0.011764707f, 0.00784313772f, 0.0156862754f,
+    0.00784313772f, 0.00784313772f, 0.011764707f, 0.011764707f, 0.00784313772f, 0.0156862754f, 0.011764707f, 0.011764707f,
+    0.011764707f, 0.011764707f, 0.0196078438f, 0.0156862754f, 0.011764707f, 0.0156862754f, 0.0156862754f, 0.0156862754f,
+    0.0352941193f, 0.474509835f, 0.501960814f, 0.501960814f, 0.509803951f, 0.505882382f, 0.501960814f, 0.505882382f,
+    0.509803951f, 0.505882382f, 0.505882382f, 0.505882382f, 0.505882382f, 0.505882382f, 0.443137288f, 0.0745098069f,
+    0.011764707f, 0.011764707f, 0.0196078438f, 0.0156862754f, 0.0156862754f, 0.011764707f, 0.011764707f, 0.011764707f,
+    0.00784313772f, 0.011764707f, 0.011764707f, 0.0156862754f, 0.00784313772f, 0.00784313772f, 0.0196078438f, 0.011764707f,
+    0.0156862754f, 0.0196078438f, 0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f, 0.00784313772f,
+    0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f, 0.0156862754f, 0.011764707f, 0.011764707f, 0.011764707f,
+    0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f, 0.00784313772f, 0.011764707f, 0.0156862754f, 0.0156862754f,
+    0.011764707f, 0.011764707f, 0.011764707f, 0.0156862754f, 0.00784313772f, 0.011764707f, 0.011764707f, 0.0156862754f,
+    0.011764707f, 0.00784313772f, 0.011764707f, 0.011764707f, 0.00784313772f, 0.011764707f, 0.00392156886f, 0.00784313772f,
+    0.00784313772f, 0.00784313772f, 0.0f, 0.011764707f, 0.011764707f, 0.011764707f, 0.0f, 0.00784313772f,
+    0.00784313772f, 0.00784313772f, 0.00784313772f, 0.00784313772f, 0.00392156886f, 0.00784313772f, 0.00784313772f, 0.011764707f,
+    0.011764707f, 0.0156862754f, 0.0156862754f, 0.0156862754f, 0.0156862754f, 0.0156862754f, 0.011764707f, 0.011764707f,
+    0.00784313772f, 0.254901975f, 0.505882382f, 0.505882382f, 0.505882382f, 0.505882382f, 0.501960814f, 0.505882382f,
+    0.505882382f, 0.505882382f, 0.501960814f, 0.505882382f, 0.505882382f, 0.505882382f, 0.254901975f, 0.011764707f,
+    0.0196078438f, 0.0196078438f, 0.0156862754f, 0.011764707f, 0.0156862754f, 0.011764707f, 0.00784313772f, 0.00784313772f,
+    0.011764707f, 0.011764707f, 0.00784313772f, 0.0196078438f, 0.011764707f, 0.011764707f, 0.011764707f, 0.00784313772f,
+    0.011764707f, 0.011764707f, 0.011764707f, 0.0156862754f, 0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f,
+    0.0156862754f, 0.0156862754f, 0.011764707f, 0.011764707f, 0.0156862754f, 0.011764707f, 0.011764707f, 0.011764707f,
+    0.0156862754f, 0.0156862754f, 0.011764707f, 0.011764707f, 0.0156862754f, 0.011764707f, 0.00392156886f, 0.00784313772f,
+    0.011764707f, 0.011764707f, 0.011764707f, 0.0156862754f, 0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f,
+    0.011764707f, 0.0196078438f, 0.00784313772f, 0.00784313772f, 0.00784313772f, 0.00392156886f, 0.00392156886f, 0.00392156886f,
+    0.011764707f, 0.00392156886f, 0.00392156886f, 0.00784313772f, 0.00784313772f, 0.011764707f, 0.011764707f, 0.00392156886f,
+    0.011764707f, 0.011764707f, 0.0156862754f, 0.00784313772f, 0.00392156886f, 0.00784313772f, 0.00784313772f, 0.011764707f,
+    0.011764707f, 0.0156862754f, 0.0156862754f, 0.0156862754f, 0.0196078438f, 0.0156862754f, 0.011764707f, 0.0156862754f,
+    0.00784313772f, 0.0392156877f, 0.474509835f, 0.505882382f, 0.505882382f, 0.505882382f, 0.501960814f, 0.505882382f,
+    0.505882382f, 0.505882382f, 0.501960814f, 0.501960814f, 0.505882382f, 0.505882382f, 0.0745098069f, 0.00784313772f,
+    0.0156862754f, 0.0196078438f, 0.0156862754f, 0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f, 0.00784313772f,
+    0.00784313772f, 0.011764707f, 0.0156862754f, 0.0156862754f, 0.011764707f, 0.0196078438f, 0.00392156886f, 0.011764707f,
+    0.0156862754f, 0.011764707f, 0.0156862754f, 0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f, 0.0156862754f,
+    0.0156862754f, 0.0156862754f, 0.0156862754f, 0.011764707f, 0.0156862754f, 0.00784313772f, 0.011764707f, 0.011764707f,
+    0.011764707f, 0.0156862754f, 0.00784313772f, 0.011764707f, 0.011764707f, 0.0156862754f, 0.00784313772f, 0.00784313772f,
+    0.011764707f, 0.011764707f, 0.011764707f, 0.00784313772f, 0.0156862754f, 0.011764707f, 0.011764707f, 0.011764707f,
+    0.0156862754f, 0.00784313772f, 0.00784313772f, 0.00392156886f, 0.00784313772f, 0.00784313772f, 0.00784313772f, 0.00784313772f,
+    0.00784313772f, 0.0156862754f, 0.00784313772f, 0.00392156886f, 0.00392156886f, 0.011764707f, 0.011764707f, 0.00784313772f,
+    0.00784313772f, 0.011764707f, 0.011764707f, 0.0156862754f, 0.00784313772f, 0.00784313772f, 0.00784313772f, 0.00784313772f,
+    0.011764707f, 0.011764707f, 0.0156862754f, 0.0156862754f, 0.0156862754f, 0.0156862754f, 0.011764707f, 0.011764707f,
+    0.00784313772f, 0.00784313772f, 0.258823544f, 0.505882382f, 0.501960814f, 0.505882382f, 0.501960814f, 0.505882382f,
+    0.505882382f, 0.501960814f, 0.505882382f, 0.501960814f, 0.505882382f, 0.321568638f, 0.0156862754f, 0.0156862754f,
+    0.011764707f, 0.0156862754f, 0.011764707f, 0.011764707f, 0.0156862754f, 0.0156862754f, 0.0156862754f, 0.011764707f,
+    0.00784313772f, 0.011764707f, 0.00784313772f, 0.00392156886f, 0.00392156886f, 0.011764707f, 0.00392156886f, 0.00784313772f,
+    0.0156862754f, 0.00784313772f, 0.00784313772f, 0.0156862754f, 0.011764707f, 0.0156862754f, 0.011764707f, 0.0156862754f,
+    0.0156862754f, 0.011764707f, 0.0156862754f, 0.0156862754f, 0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f,
+    0.011764707f, 0.0196078438f, 0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f, 0.00392156886f, 0.00784313772f,
+    0.0156862754f, 0.011764707f, 0.011764707f, 0.011764707f, 0.00784313772f, 0.011764707f, 0.011764707f, 0.0156862754f,
+    0.0235294141f, 0.011764707f, 0.011764707f, 0.011764707f, 0.0f, 0.00784313772f, 0.011764707f, 0.0f,
+    0.00784313772f, 0.0156862754f, 0.00784313772f, 0.00392156886f, 0.011764707f, 0.0196078438f, 0.0156862754f, 0.00784313772f,
+    0.011764707f, 0.00784313772f, 0.0f, 0.00784313772f, 0.011764707f, 0.00784313772f, 0.00392156886f, 0.00784313772f,
+    0.011764707f, 0.011764707f, 0.0156862754f, 0.0156862754f, 0.0156862754f, 0.0156862754f, 0.011764707f, 0.00784313772f,
+    0.00784313772f, 0.00784313772f, 0.0705882385f, 0.505882382f, 0.505882382f, 0.505882382f, 0.505882382f, 0.505882382f,
+    0.505882382f, 0.505882382f, 0.505882382f, 0.505882382f, 0.505882382f, 0.0705882385f, 0.011764707f, 0.0156862754f,
+    0.0156862754f, 0.0156862754f, 0.0196078438f, 0.011764707f, 0.011764707f, 0.0196078438f, 0.011764707f, 0.011764707f,
+    0.011764707f, 0.00392156886f, 0.00392156886f, 0.00784313772f, 0.0156862754f, 0.00784313772f, 0.00784313772f, 0.00392156886f,
+    0.00392156886f, 0.0156862754f, 0.00784313772f, 0.0156862754f, 0.0156862754f, 0.011764707f, 0.011764707f, 0.011764707f,
+    0.0156862754f, 0.011764707f, 0.0156862754f, 0.0156862754f, 0.0156862754f, 0.011764707f, 0.0156862754f, 0.011764707f,
+    0.011764707f, 0.0156862754f, 0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f, 0.00784313772f, 0.00784313772f,
+    0.011764707f, 0.011764707f, 0.00784313772f, 0.011764707f, 0.011764707f, 0.00784313772f, 0.00392156886f, 0.011764707f,
+    0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f, 0.00392156886f, 0.00392156886f, 0.011764707f, 0.00784313772f,
+    0.00784313772f, 0.00784313772f, 0.00392156886f, 0.00784313772f, 0.011764707f, 0.011764707f, 0.00784313772f, 0.00784313772f,
+    0.011764707f, 0.011764707f, 0.00392156886f, 0.00392156886f, 0.011764707f, 0.00784313772f, 0.0f, 0.00784313772f,
+    0.00784313772f, 0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f,
+    0.011764707f, 0.011764707f, 0.00784313772f, 0.380392194f, 0.501960814f, 0.501960814f, 0.505882382f, 0.505882382f,
+    0.505882382f, 0.505882382f, 0.501960814f, 0.505882382f, 0.349019617f, 0.0156862754f, 0.011764707f, 0.0156862754f,
+    0.0156862754f, 0.0156862754f, 0.0156862754f, 0.0156862754f, 0.0196078438f, 0.0196078438f, 0.0156862754f, 0.0156862754f,
+    0.00392156886f, 0.011764707f, 0.00784313772f, 0.011764707f, 0.00784313772f, 0.00784313772f, 0.00392156886f, 0.011764707f,
+    0.00784313772f, 0.011764707f, 0.011764707f, 0.00784313772f, 0.011764707f, 0.011764707f, 0.0156862754f, 0.0156862754f,
+    0.00784313772f, 0.011764707f, 0.0156862754f, 0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f,
+    0.011764707f, 0.0156862754f, 0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f, 0.00392156886f, 0.00784313772f,
+    0.011764707f, 0.011764707f, 0.0156862754f, 0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f,
+    0.011764707f, 0.011764707f, 0.0156862754f, 0.0156862754f, 0.00784313772f, 0.00784313772f, 0.00784313772f, 0.011764707f,
+    0.00392156886f, 0.00784313772f, 0.00784313772f, 0.011764707f, 0.0156862754f, 0.011764707f, 0.011764707f, 0.011764707f,
+    0.011764707f, 0.011764707f, 0.00784313772f, 0.00784313772f, 0.00392156886f, 0.00784313772f, 0.00392156886f, 0.00784313772f,
+    0.011764707f, 0.00784313772f, 0.00784313772f, 0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f,
+    0.0156862754f, 0.0156862754f, 0.00784313772f, 0.125490203f, 0.501960814f, 0.501960814f, 0.505882382f, 0.505882382f,
+    0.505882382f, 0.509803951f, 0.501960814f, 0.505882382f, 0.160784319f, 0.011764707f, 0.011764707f, 0.00784313772f,
+    0.00784313772f, 0.0156862754f, 0.0196078438f, 0.00392156886f, 0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f,
+    0.0196078438f, 0.0156862754f, 0.00392156886f, 0.00784313772f, 0.0f, 0.00392156886f, 0.00784313772f, 0.011764707f,
+    0.00784313772f, 0.0156862754f, 0.0f, 0.00784313772f, 0.011764707f, 0.0156862754f, 0.011764707f, 0.011764707f,
+    0.011764707f, 0.00784313772f, 0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f,
+    0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f,
+    0.011764707f, 0.011764707f, 0.00784313772f, 0.00784313772f, 0.00784313772f, 0.0156862754f, 0.0196078438f, 0.011764707f,
+    0.00784313772f, 0.00784313772f, 0.011764707f, 0.011764707f, 0.00784313772f, 0.00392156886f, 0.00784313772f, 0.011764707f,
+    0.00392156886f, 0.00784313772f, 0.00784313772f, 0.00784313772f, 0.00784313772f, 0.00784313772f, 0.00784313772f, 0.011764707f,
+    0.00784313772f, 0.011764707f, 0.00784313772f, 0.00784313772f, 0.00784313772f, 0.00784313772f, 0.00784313772f, 0.00784313772f,
+    0.0156862754f, 0.011764707f, 0.0156862754f, 0.0156862754f, 0.0156862754f, 0.0156862754f, 0.011764707f, 0.011764707f,
+    0.00784313772f, 0.0196078438f, 0.011764707f, 0.011764707f, 0.474509835f, 0.505882382f, 0.505882382f, 0.505882382f,
+    0.505882382f, 0.509803951f, 0.505882382f, 0.443137288f, 0.0156862754f, 0.011764707f, 0.011764707f, 0.011764707f,
+    0.011764707f, 0.0156862754f, 0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f,
+    0.0196078438f, 0.0156862754f, 0.00392156886f, 0.00392156886f, 0.00784313772f, 0.00784313772f, 0.00392156886f, 0.00784313772f,
+    0.00392156886f, 0.00784313772f, 0.011764707f, 0.011764707f, 0.00784313772f, 0.00784313772f, 0.011764707f, 0.00784313772f,
+    0.011764707f, 0.0156862754f, 0.011764707f, 0.011764707f, 0.011764707f, 0.00784313772f, 0.00784313772f, 0.011764707f,
+    0.00784313772f, 0.00784313772f, 0.00784313772f, 0.00392156886f, 0.011764707f, 0.00784313772f, 0.00784313772f, 0.00784313772f,
+    0.011764707f, 0.0196078438f, 0.00784313772f, 0.0156862754f, 0.0156862754f, 0.0196078438f, 0.0196078438f, 0.0156862754f,
+    0.011764707f, 0.0156862754f, 0.011764707f, 0.011764707f, 0.00784313772f, 0.00784313772f, 0.00784313772f, 0.011764707f,
+    0.0f, 0.011764707f, 0.011764707f, 0.00392156886f, 0.00392156886f, 0.00784313772f, 0.0156862754f, 0.00784313772f,
+    0.011764707f, 0.00784313772f, 0.00392156886f, 0.00784313772f, 0.011764707f, 0.00392156886f, 0.00392156886f, 0.00392156886f,
+    0.011764707f, 0.011764707f, 0.011764707f, 0.0156862754f, 0.0156862754f, 0.0156862754f, 0.011764707f, 0.0196078438f,
+    0.011764707f, 0.011764707f, 0.011764707f, 0.00784313772f, 0.290196091f, 0.505882382f, 0.505882382f, 0.505882382f,
+    0.505882382f, 0.505882382f, 0.505882382f, 0.321568638f, 0.0156862754f, 0.0156862754f, 0.011764707f, 0.011764707f,
+    0.0196078438f, 0.0156862754f, 0.0156862754f, 0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f, 0.00784313772f,
+    0.0156862754f, 0.0156862754f, 0.00784313772f, 0.00784313772f, 0.00784313772f, 0.0156862754f, 0.00784313772f, 0.011764707f,
+    0.00784313772f, 0.00392156886f, 0.011764707f, 0.0196078438f, 0.0156862754f, 0.0156862754f, 0.00784313772f, 0.00784313772f,
+    0.011764707f, 0.0156862754f, 0.0156862754f, 0.011764707f, 0.0156862754f, 0.0156862754f, 0.00784313772f, 0.0196078438f,
+    0.00784313772f, 0.011764707f, 0.011764707f, 0.011764707f, 0.00784313772f, 0.00784313772f, 0.00784313772f, 0.00784313772f,
+    0.0156862754f, 0.0156862754f, 0.011764707f, 0.0156862754f, 0.011764707f, 0.011764707f, 0.0156862754f, 0.0156862754f,
+    0.0156862754f, 0.0156862754f, 0.011764707f, 0.011764707f, 0.00784313772f, 0.011764707f, 0.00392156886f, 0.00784313772f,
+    0.00392156886f, 0.00784313772f, 0.00784313772f, 0.00784313772f, 0.011764707f, 0.00784313772f, 0.00784313772f, 0.0156862754f,
+    0.011764707f, 0.00784313772f, 0.0f, 0.00784313772f, 0.00784313772f, 0.00784313772f, 0.00784313772f, 0.00784313772f,
+    0.00392156886f, 0.011764707f, 0.0156862754f, 0.0156862754f, 0.00784313772f, 0.00784313772f, 0.011764707f, 0.00784313772f,
+    0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f, 0.13333334f, 0.505882382f, 0.505882382f, 0.505882382f,
+    0.501960814f, 0.505882382f, 0.501960814f, 0.13333334f, 0.00784313772f, 0.0156862754f, 0.00784313772f, 0.011764707f,
+    0.0156862754f, 0.011764707f, 0.0156862754f, 0.0156862754f, 0.0156862754f, 0.0156862754f, 0.011764707f, 0.00784313772f,
+    0.00784313772f, 0.011764707f, 0.00392156886f, 0.00392156886f, 0.00392156886f, 0.00784313772f, 0.00784313772f, 0.00784313772f,
+    0.00784313772f, 0.011764707f, 0.00784313772f, 0.011764707f, 0.00784313772f, 0.00784313772f, 0.00392156886f, 0.00784313772f,
+    0.0196078438f, 0.00392156886f, 0.00392156886f, 0.0f, 0.00392156886f, 0.00392156886f, 0.00392156886f, 0.00784313772f,
+    0.0f, 0.00784313772f, 0.00392156886f, 0.00392156886f, 0.011764707f, 0.0156862754f, 0.00784313772f, 0.00784313772f,
+    0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f, 0.00784313772f, 0.0156862754f, 0.0156862754f, 0.0156862754f,
+    0.0156862754f, 0.0156862754f, 0.011764707f, 0.0196078438f, 0.011764707f, 0.0156862754f, 0.00784313772f, 0.011764707f,
+    0.011764707f, 0.00784313772f, 0.0f, 0.00392156886f, 0.0156862754f, 0.011764707f, 0.0f, 0.00784313772f,
+    0.011764707f, 0.00392156886f, 0.00784313772f, 0.00784313772f, 0.00784313772f, 0.011764707f, 0.00784313772f, 0.00784313772f,
+    0.00784313772f, 0.00392156886f, 0.00784313772f, 0.0156862754f, 0.00392156886f, 0.011764707f, 0.00784313772f, 0.011764707f,
+    0.011764707f, 0.00784313772f, 0.011764707f, 0.011764707f, 0.00784313772f, 0.474509835f, 0.501960814f, 0.505882382f,
+    0.505882382f, 0.505882382f, 0.443137288f, 0.00784313772f, 0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f,
+    0.0156862754f, 0.0156862754f, 0.0196078438f, 0.0156862754f, 0.0156862754f, 0.0156862754f, 0.00392156886f, 0.00392156886f,
+    0.011764707f, 0.00784313772f, 0.00784313772f, 0.00784313772f, 0.00392156886f, 0.00784313772f, 0.00392156886f, 0.0f,
+    0.0f, 0.011764707f, 0.00784313772f, 0.00784313772f, 0.00392156886f, 0.00784313772f, 0.00784313772f, 0.00784313772f,
+    0.00784313772f, 0.011764707f, 0.00392156886f, 0.00392156886f, 0.00784313772f, 0.011764707f, 0.0f, 0.00784313772f,
+    0.00392156886f, 0.00392156886f, 0.00784313772f, 0.011764707f, 0.011764707f, 0.00784313772f, 0.011764707f, 0.00784313772f,
+    0.0156862754f, 0.0156862754f, 0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f,
+    0.00784313772f, 0.011764707f, 0.011764707f, 0.011764707f, 0.0156862754f, 0.011764707f, 0.011764707f, 0.011764707f,
+    0.011764707f, 0.00784313772f, 0.00784313772f, 0.0196078438f, 0.00784313772f, 0.011764707f, 0.00784313772f, 0.00784313772f,
+    0.00784313772f, 0.011764707f, 0.00784313772f, 0.00784313772f, 0.00784313772f, 0.00392156886f, 0.011764707f, 0.0156862754f,
+    0.011764707f, 0.00784313772f, 0.0f, 0.00784313772f, 0.00784313772f, 0.011764707f, 0.011764707f, 0.011764707f,
+    0.011764707f, 0.0156862754f, 0.011764707f, 0.011764707f, 0.00784313772f, 0.321568638f, 0.505882382f, 0.505882382f,
+    0.505882382f, 0.505882382f, 0.313725501f, 0.00784313772f, 0.011764707f, 0.0196078438f, 0.0156862754f, 0.00784313772f,
+    0.0156862754f, 0.0156862754f, 0.011764707f, 0.0156862754f, 0.0196078438f, 0.00784313772f, 0.00784313772f, 0.00784313772f,
+    0.011764707f, 0.011764707f, 0.0196078438f, 0.0156862754f, 0.00392156886f, 0.0156862754f, 0.00784313772f, 0.00784313772f,
+    0.011764707f, 0.0156862754f, 0.0196078438f, 0.011764707f, 0.00784313772f, 0.0196078438f, 0.00784313772f, 0.00784313772f,
+    0.00392156886f, 0.00784313772f, 0.00784313772f, 0.00784313772f, 0.00784313772f, 0.00784313772f, 0.00784313772f, 0.00784313772f,
+    0.00784313772f, 0.011764707f, 0.00784313772f, 0.011764707f, 0.00784313772f, 0.00784313772f, 0.00784313772f, 0.011764707f,
+    0.011764707f, 0.0156862754f, 0.00784313772f, 0.011764707f, 0.00784313772f, 0.011764707f, 0.00784313772f, 0.00784313772f,
+    0.011764707f, 0.00784313772f, 0.011764707f, 0.0156862754f, 0.00784313772f, 0.0156862754f, 0.0156862754f, 0.011764707f,
+    0.011764707f, 0.0f, 0.00392156886f, 0.011764707f, 0.00784313772f, 0.00392156886f, 0.0f, 0.00784313772f,
+    0.00784313772f, 0.00784313772f, 0.00784313772f, 0.00784313772f, 0.00392156886f, 0.011764707f, 0.011764707f, 0.011764707f,
+    0.011764707f, 0.00784313772f, 0.00784313772f, 0.00392156886f, 0.011764707f, 0.011764707f, 0.011764707f, 0.00784313772f,
+    0.011764707f, 0.0156862754f, 0.011764707f, 0.011764707f, 0.011764707f, 0.192156881f, 0.505882382f, 0.505882382f,
+    0.505882382f, 0.505882382f, 0.164705887f, 0.011764707f, 0.0156862754f, 0.0156862754f, 0.011764707f, 0.00784313772f,
+    0.011764707f, 0.0156862754f, 0.0156862754f, 0.0156862754f, 0.011764707f, 0.011764707f, 0.0156862754f, 0.0156862754f,
+    0.00784313772f, 0.00784313772f, 0.0156862754f, 0.011764707f, 0.00392156886f, 0.011764707f, 0.00784313772f, 0.00784313772f,
+    0.011764707f, 0.00784313772f, 0.011764707f, 0.011764707f, 0.00392156886f, 0.00784313772f, 0.00392156886f, 0.00784313772f,
+    0.00784313772f, 0.00784313772f, 0.00392156886f, 0.00784313772f, 0.00784313772f, 0.00392156886f, 0.00784313772f, 0.00784313772f,
+    0.00784313772f, 0.00784313772f, 0.00392156886f, 0.00392156886f, 0.00784313772f, 0.00784313772f, 0.00392156886f, 0.00784313772f,
+    0.00784313772f, 0.011764707f, 0.011764707f, 0.00784313772f, 0.00784313772f, 0.0156862754f, 0.011764707f, 0.011764707f,
+    0.011764707f, 0.011764707f, 0.0156862754f, 0.011764707f, 0.0156862754f, 0.011764707f, 0.011764707f, 0.011764707f,
+    0.0156862754f, 0.011764707f, 0.011764707f, 0.00784313772f, 0.011764707f, 0.00392156886f, 0.00784313772f, 0.011764707f,
+    0.00784313772f, 0.00784313772f, 0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f,
+    0.011764707f, 0.0156862754f, 0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f, 0.0156862754f, 0.0156862754f,
+    0.011764707f, 0.011764707f, 0.011764707f, 0.00784313772f, 0.00784313772f, 0.0352941193f, 0.501960814f, 0.505882382f,
+    0.505882382f, 0.505882382f, 0.0666666701f, 0.0156862754f, 0.0156862754f, 0.0156862754f, 0.011764707f, 0.0156862754f,
+    0.00784313772f, 0.0156862754f, 0.011764707f, 0.00784313772f, 0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f,
+    0.00784313772f, 0.00784313772f, 0.00784313772f, 0.00784313772f, 0.00392156886f, 0.00784313772f, 0.011764707f, 0.00392156886f,
+    0.00392156886f, 0.00392156886f, 0.0f, 0.00392156886f, 0.00784313772f, 0.00784313772f, 0.011764707f, 0.00784313772f,
+    0.00784313772f, 0.00392156886f, 0.00784313772f, 0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f,
+    0.00784313772f, 0.00392156886f, 0.00784313772f, 0.0156862754f, 0.00392156886f, 0.00784313772f, 0.0f, 0.00784313772f,
+    0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f, 0.00784313772f, 0.011764707f, 0.011764707f, 0.0156862754f,
+    0.00784313772f, 0.011764707f, 0.0156862754f, 0.011764707f, 0.011764707f, 0.0196078438f, 0.00784313772f, 0.011764707f,
+    0.00784313772f, 0.011764707f, 0.0f, 0.00784313772f, 0.00392156886f, 0.00784313772f, 0.011764707f, 0.00784313772f,
+    0.00784313772f, 0.00784313772f, 0.00784313772f, 0.011764707f, 0.00784313772f, 0.011764707f, 0.0156862754f, 0.00784313772f,
+    0.00392156886f, 0.011764707f, 0.0156862754f, 0.0156862754f, 0.00784313772f, 0.011764707f, 0.0156862754f, 0.0156862754f,
+    0.011764707f, 0.0156862754f, 0.011764707f, 0.011764707f, 0.00784313772f, 0.011764707f, 0.223529428f, 0.43921572f,
+    0.474509835f, 0.227450997f, 0.011764707f, 0.0156862754f, 0.0156862754f, 0.011764707f, 0.00784313772f, 0.00392156886f,
+    0.011764707f, 0.011764707f, 0.00784313772f, 0.0156862754f, 0.011764707f, 0.00784313772f, 0.0156862754f, 0.011764707f,
+    0.011764707f, 0.00784313772f, 0.00784313772f, 0.00784313772f, 0.00784313772f, 0.00784313772f, 0.00392156886f, 0.011764707f,
+    0.011764707f, 0.00392156886f, 0.00784313772f, 0.00784313772f, 0.00392156886f, 0.00784313772f, 0.011764707f, 0.0156862754f,
+    0.00392156886f, 0.00392156886f, 0.00784313772f, 0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f, 0.011764707f,
+    0.00392156886f, 0.00392156886f, 0.0156862754f, 0.011764707f, 0.00392156886f, 0.00784313772f, 0.00784313772f, 0.00784313772f,
+};
+
+inline constexpr int32_t blend_remove_scale_96[96 * 96] = {
+    66580, 66316, 66580, 66316, 66316, 66316, 66316, 66580, 65536, 66316, 66316, 66580,
+    66316, 66054, 66847, 66054, 66054, 66054, 65536, 66054, 65794, 65794, 65794, 65794,
+    66316, 66054, 66316, 66580, 66054, 66316, 66316, 66316, 66316, 66316, 66316, 66054,
+    66316, 66054, 65536, 65794, 65794, 65794, 65794, 65794, 66054, 66054, 84402, 124714,
+    117688, 85264, 65794, 66316, 65536, 66054, 65794, 66054, 66580, 66580, 66054, 66580,
+    66316, 66316, 66580, 66316, 66316, 66316, 66054, 66580, 66580, 66580, 66054, 66316,
+    65794, 66316, 66054, 66054, 65794, 66054, 66316, 66316, 66054, 66316, 66316, 66580,
+    66316, 66316, 66580, 66580, 66316, 66316, 66316, 66316, 66580, 66847, 66580, 66580,
+    66316, 66580, 66054, 66316, 65794, 66316, 66316, 66580, 66054, 66054, 66316, 66316,
+    65794, 66054, 66580, 66316, 66054, 66054, 65794, 65794, 65536, 65794, 65536, 65536,
+    66054, 66054, 66316, 66316, 65794, 66316, 66316, 66054, 66316, 66847, 66316, 66316,
+    65794, 65536, 65536, 65536, 65794, 65536, 65536, 65536, 66054, 69923, 131588, 131588,
+    132632, 132632, 67934, 66054, 65536, 65794, 66054, 66054, 66054, 66316, 66316, 66054,
+    66054, 66054, 66316, 66580, 66316, 66316, 65794, 65794, 66054, 66054, 66054, 65794,
+    66054, 65536, 66054, 65536, 65794, 65794, 66580, 66580, 66316, 66316, 66316, 66316,
+    66054, 66316, 66580, 66316, 66316, 66316, 67115, 66847, 66580, 66847, 66580, 66847,
+    65794, 65536, 66054, 65794, 66054, 66580, 66316, 66054, 65536, 65794, 65794, 66316,
+    65794, 65794, 65794, 65794, 66054, 66054, 65794, 65536, 65794, 65794, 65536, 65794,
+    65794, 65794, 65536, 65794, 66054, 66054, 66054, 66316, 66316, 66580, 66316, 66316,
+    65536, 65794, 65536, 65794, 65536, 65536, 65794, 66054, 66054, 78092, 131588, 131588,
+    132632, 131588, 81125, 65536, 65536, 65794, 66054, 65794, 65536, 65536, 65794, 65794,
+    66054, 66847, 66580, 66316, 66580, 66580, 66054, 65536, 65794, 66054, 66054, 66316,
+    66580, 66580, 66054, 66316, 66847, 66316, 66054, 66054, 66580, 66580, 66316, 66316,
+    66316, 66580, 66580, 66580, 66316, 66054, 66580, 66316, 66580, 66580, 66316, 66316,
+    65536, 65794, 65794, 66054, 66054, 66847, 66054, 66316, 65536, 65794, 66054, 66054,
+    65536, 65536, 65536, 66054, 66054, 65794, 65536, 65794, 65536, 65794, 65794, 65536,
+    65794, 66054, 65794, 65794, 65536, 65794, 66580, 66316, 66054, 66580, 65794, 66054,
+    65536, 65794, 65536, 65536, 65536, 65794, 66054, 66054, 66316, 96599, 131588, 131588,
+    132632, 132632, 95495, 65794, 65794, 65794, 65794, 65794, 65536, 65536, 65794, 66054,
+    66580, 66580, 66316, 66054, 66316, 66580, 66580, 66054, 66054, 66316, 66054, 66316,
+    66580, 66580, 66580, 66580, 66316, 66580, 66054, 66316, 66580, 66847, 66580, 66054,
+    65794, 66316, 66316, 66847, 66580, 66316, 66580, 66316, 66847, 66580, 66316, 66316,
+    65536, 65536, 65794, 66316, 66847, 66580, 66580, 66316, 65794, 66054, 65794, 65794,
+    65536, 65536, 66316, 65794, 66316, 66316, 65536, 66054, 65794, 65794, 65536, 66054,
+    65536, 65794, 65536, 65536, 65536, 66054, 66580, 66316, 66054, 66054, 66316, 66054,
+    66054, 65794, 66580, 66316, 65536, 65794, 65536, 65794, 66316, 118523, 131588, 131588,
+    131588, 131588, 124714, 66054, 66316, 65794, 66054, 66316, 65794, 66054, 66316, 66316,
+    66580, 66580, 66580, 66316, 66580, 66580, 66316, 66054, 65794, 65794, 66316, 66580,
+    66847, 66580, 66580, 66580, 66580, 66580, 66580, 66316, 66316, 66316, 65794, 65536,
+    66316, 66054, 66316, 66580, 66316, 66316, 66054, 66847, 66580, 66847, 66580, 66316,
+    65794, 65536, 66316, 66316, 66316, 66580, 66580, 66580, 66316, 66054, 66580, 66580,
+    65536, 65794, 65794, 65794, 66054, 66316, 66054, 65794, 65536, 66054, 66054, 65794,
+    65794, 65794, 65794, 65536, 65794, 66054, 66580, 66580, 66580, 66580, 65794, 66580,
+    66847, 66054, 66580, 65536, 66054, 66580, 66054, 66054, 75278, 132632, 131588, 131588,
+    131588, 131588, 131588, 75618, 66054, 66054, 66054, 66316, 66316, 66054, 65794, 66054,
+    66316, 66580, 66316, 66316, 66316, 66580, 66316, 66054, 66054, 65794, 66316, 66316,
+    66316, 66580, 66580, 66580, 66847, 66316, 66054, 66316, 66580, 66580, 66054, 65794,
+    66316, 66580, 66316, 66316, 66316, 66316, 66580, 66580, 66316, 66580, 66316, 66316,
+    65794, 66054, 65794, 65794, 66580, 66580, 66316, 66316, 66580, 66316, 65536, 65794,
+    65536, 66054, 66054, 65794, 65794, 66316, 65794, 65794, 66054, 66316, 66316, 66316,
+    66316, 66054, 65536, 65794, 66054, 66316, 66054, 66054, 66054, 66316, 66054, 65794,
+    66580, 66054, 65794, 66054, 65794, 66054, 66054, 66054, 96599, 132632, 131588, 131588,
+    131588, 132632, 131588, 91822, 66054, 66054, 66054, 66054, 66580, 66316, 66054, 65794,
+    66054, 66054, 66316, 66316, 66847, 66316, 66580, 66054, 66054, 66316, 66054, 66316,
+    66316, 66316, 66316, 66580, 66316, 66054, 66054, 66316, 66316, 66316, 66054, 66316,
+    66054, 66316, 67115, 66847, 66580, 66580, 66316, 66316, 66316, 66580, 66316, 66316,
+    65794, 66316, 66054, 66054, 66316, 66316, 66054, 66580, 66580, 66054, 66054, 65794,
+    66054, 66316, 66580, 65794, 65794, 65536, 66054, 66316, 66316, 66316, 65794, 66054,
+    66316, 65536, 66054, 66054, 66054, 66054, 65794, 65794, 66316, 65794, 65794, 65794,
+    65536, 65794, 65794, 65794, 65794, 66054, 66054, 65794, 117688, 132632, 131588, 131588,
+    132632, 131588, 131588, 124714, 66054, 66054, 66054, 66054, 66580, 66316, 66316, 66580,
+    66316, 66054, 66316, 66054, 66316, 66316, 65794, 66054, 66054, 66054, 66054, 65794,
+    66316, 66580, 66316, 66316, 66580, 66054, 65794, 66316, 66316, 66054, 66316, 66580,
+    66316, 66580, 66316, 66847, 66847, 66580, 66580, 66580, 66316, 66580, 66316, 66316,
+    66316, 66054, 66054, 66054, 65794, 66054, 66580, 66316, 65794, 66316, 66054, 66316,
+    66054, 66054, 66580, 65794, 65794, 66054, 66316, 66580, 65794, 66054, 66054, 66054,
+    66054, 65536, 66054, 66054, 66054, 66316, 66054, 66316, 66580, 66316, 66054, 65794,
+    65794, 65794, 66054, 65794, 66580, 66316, 66316, 78459, 131588, 132632, 131588, 131588,
+    132632, 132632, 131588, 131588, 75278, 66316, 66054, 65794, 66316, 66316, 66054, 66316,
+    66316, 66316, 66316, 66316, 66054, 66316, 66054, 65794, 65794, 65794, 65794, 66316,
+    66316, 66054, 66580, 66054, 65794, 65536, 65794, 65794, 66580, 66316, 66316, 66580,
+    66316, 66054, 66580, 66847, 66580, 66054, 66054, 66580, 66580, 66847, 66580, 66580,
+    65794, 66316, 65794, 65794, 65536, 65794, 66316, 66054, 65794, 66316, 65794, 66054,
+    66054, 66316, 66054, 66054, 65794, 66054, 66316, 66580, 66054, 66316, 65536, 65794,
+    65536, 66054, 66054, 66054, 66054, 66054, 66054, 66054, 66316, 66316, 65794, 65794,
+    65536, 65794, 65794, 65794, 66054, 66316, 66316, 100673, 132632, 131588, 131588, 131588,
+    132632, 132632, 131588, 131588, 105770, 66054, 65536, 65794, 66316, 66580, 66580, 66316,
+    66316, 66316, 66054, 66054, 66316, 66054, 65794, 65794, 65536, 66054, 66054, 66316,
+    66054, 66316, 66054, 66580, 65536, 65794, 66054, 66054, 66316, 66580, 66580, 66580,
+    66580, 66580, 66847, 66580, 66054, 66580, 66316, 66316, 66316, 67115, 66580, 66580,
+    66316, 66054, 66580, 66316, 65794, 65794, 65794, 65794, 66316, 66316, 66054, 66054,
+    65794, 65794, 65794, 66054, 66316, 66316, 66054, 66580, 65794, 65794, 65794, 65794,
+    65794, 66316, 66054, 66580, 66054, 66054, 65794, 66580, 66316, 66316, 65794, 65794,
+    65536, 65794, 65536, 65794, 66054, 66580, 70217, 131588, 131588, 131588, 131588, 131588,
+    131588, 132632, 131588, 131588, 131588, 70217, 65794, 66054, 66054, 66054, 66316, 65794,
+    66054, 66054, 66054, 65794, 65794, 65794, 65794, 66316, 65794, 65794, 65794, 66054,
+    66054, 65794, 66054, 66054, 66054, 66580, 66580, 66316, 66316, 66316, 66316, 66054,
+    66580, 66580, 66316, 66054, 66316, 66316, 66316, 66580, 66054, 66316, 66054, 66316,
+    66316, 66054, 66316, 66316, 65794, 65794, 65794, 65794, 66054, 66316, 65794, 66054,
+    66054, 65794, 65794, 66054, 66316, 66316, 66054, 66054, 65794, 66316, 65794, 65536,
+    66054, 66580, 66316, 66316, 66054, 66054, 66316, 66316, 66054, 66316, 65794, 66054,
+    65794, 65794, 65794, 65794, 66054, 66316, 95495, 131588, 131588, 131588, 131588, 132632,
+    131588, 132632, 131588, 131588, 131588, 88422, 66054, 66054, 65794, 65536, 66054, 66580,
+    66316, 66580, 66054, 66054, 66054, 66054, 65794, 66054, 65794, 65794, 66316, 66054,
+    66054, 66316, 65536, 66054, 65794, 66580, 66580, 66580, 66316, 66316, 66054, 66054,
+    66316, 66580, 65794, 66316, 65794, 66316, 66054, 66316, 66316, 66316, 66580, 66847,
+    65794, 65794, 65794, 66054, 65536, 65794, 66054, 66054, 66054, 65536, 65536, 65794,
+    66054, 66316, 65536, 66054, 65794, 66054, 65794, 65536, 66316, 66316, 66316, 65536,
+    65536, 65794, 66316, 66054, 66316, 66316, 66316, 66054, 65536, 65794, 66054, 65794,
+    66054, 65536, 65536, 66054, 65536, 70217, 132632, 132632, 131588, 131588, 131588, 131588,
+    131588, 132632, 131588, 131588, 131588, 124714, 67659, 65794, 65794, 66054, 66054, 66054,
+    66054, 66054, 66054, 65794, 65536, 66316, 66054, 65794, 66054, 65794, 66580, 66316,
+    66316, 66054, 65794, 66054, 65794, 66580, 66316, 66054, 66054, 66054, 66316, 66316,
+    66054, 66580, 66580, 66580, 66316, 66580, 66580, 67115, 66316, 66316, 66316, 66316,
+    65794, 66054, 65536, 66054, 65794, 65536, 66054, 66316, 66054, 65794, 65536, 66054,
+    66316, 66316, 66054, 66054, 66054, 66054, 65794, 66054, 66054, 66316, 65536, 65536,
+    65794, 66054, 66316, 66054, 66316, 66054, 66316, 66316, 66054, 65794, 65794, 65794,
+    65536, 66054, 65794, 66054, 66316, 87956, 131588, 132632, 131588, 131588, 131588, 131588,
+    132632, 132632, 132632, 131588, 131588, 131588, 87956, 66054, 66054, 66054, 65794, 66580,
+    66580, 66580, 66054, 65794, 65794, 66054, 66316, 65794, 65794, 66054, 66580, 66316,
+    66580, 66316, 66054, 65794, 65794, 65794, 66054, 66054, 66316, 66316, 66316, 66316,
+    66054, 66316, 66316, 66316, 66054, 66580, 66580, 66847, 66580, 66316, 66316, 66316,
+    66054, 65794, 65794, 65794, 66316, 66580, 65794, 65794, 65794, 66054, 65794, 66054,
+    66316, 66580, 66054, 65794, 66054, 66054, 66054, 65794, 66316, 66580, 65536, 65536,
+    65794, 66054, 66316, 66316, 66316, 66580, 66316, 66316, 65536, 65794, 65536, 65794,
+    65536, 65536, 66580, 66580, 70513, 117688, 132632, 132632, 131588, 131588, 131588, 132632,
+    132632, 132632, 133693, 132632, 132632, 131588, 124714, 67934, 66054, 66847, 66580, 66580,
+    66316, 66054, 66580, 66580, 66054, 66316, 66054, 66580, 65794, 66316, 66580, 66580,
+    66580, 66054, 66054, 66054, 66054, 66316, 66316, 66316, 66580, 66580, 66316, 66316,
+    66580, 66580, 66847, 66580, 66847, 67115, 66580, 66054, 66580, 66580, 66316, 66316,
+    66054, 66316, 66054, 66054, 66316, 66847, 66316, 65794, 66054, 65794, 65794, 65536,
+    66054, 65794, 66054, 65794, 66316, 66316, 66054, 66054, 66316, 66054, 66054, 65794,
+    66054, 66054, 66316, 65794, 66054, 66580, 66580, 66316, 66054, 65794, 65794, 66054,
+    66054, 66054, 66316, 66580, 96599, 132632, 132632, 132632, 131588, 131588, 132632, 132632,
+    132632, 133693, 131588, 132632, 132632, 132632, 132632, 88422, 66316, 65794, 66316, 66580,
+    66054, 66316, 67115, 66316, 66054, 65794, 65794, 66054, 66316, 66580, 66316, 66580,
+    66580, 66054, 66054, 65794, 66316, 66316, 66316, 66580, 66316, 66580, 66316, 66580,
+    66847, 67115, 66316, 66580, 66054, 66847, 66316, 66580, 66316, 66847, 66316, 66316,
+    66316, 66316, 66054, 66316, 66316, 66316, 66847, 66316, 66054, 66054, 65536, 65794,
+    66054, 65794, 66580, 66580, 66316, 66316, 66054, 66316, 65794, 66054, 65794, 66316,
+    66316, 66054, 66316, 66054, 65794, 66316, 66580, 66847, 66054, 66316, 66054, 66316,
+    65794, 66054, 66316, 70513, 132632, 132632, 132632, 132632, 132632, 132632, 131588, 131588,
+    131588, 131588, 131588, 132632, 132632, 132632, 131588, 124714, 70217, 66316, 66316, 66054,
+    66316, 66316, 66316, 66580, 66316, 66054, 65794, 66580, 66054, 66316, 66316, 66316,
+    66054, 66054, 65794, 66054, 66054, 66316, 66580, 66054, 65794, 66316, 66316, 66316,
+    66316, 66316, 66316, 66580, 66316, 66316, 66316, 66316, 66054, 66316, 66316, 65794,
+    66054, 66316, 66316, 66316, 66847, 66580, 66316, 66580, 66054, 66054, 65794, 65794,
+    66054, 65794, 66580, 66580, 66580, 66580, 65536, 66054, 66316, 66316, 66054, 66316,
+    65794, 66054, 65794, 65794, 66054, 66316, 65794, 65536, 66054, 66580, 66580, 66316,
+    66316, 66316, 66054, 96599, 132632, 131588, 132632, 131588, 131588, 132632, 132632, 131588,
+    131588, 131588, 132632, 132632, 131588, 132632, 131588, 131588, 100673, 66580, 66054, 66054,
+    66054, 66316, 66316, 66054, 66054, 66054, 65794, 66316, 66580, 65794, 65536, 66316,
+    65794, 65794, 66054, 66316, 66316, 66580, 66580, 66316, 66054, 66316, 66054, 66316,
+    66580, 66316, 66580, 66847, 66316, 66316, 66316, 66054, 66316, 66580, 66316, 66580,
+    66054, 66316, 66580, 66316, 66054, 66054, 66316, 66316, 66580, 66054, 65794, 65794,
+    65536, 66054, 66316, 66847, 66580, 66316, 65794, 66316, 65794, 65794, 66054, 66316,
+    66580, 66054, 66580, 66580, 66316, 66054, 66580, 66580, 66316, 66580, 66847, 66580,
+    66580, 66316, 78092, 131588, 132632, 131588, 131588, 131588, 131588, 131588, 134772, 132632,
+    131588, 131588, 131588, 132632, 132632, 132632, 131588, 131588, 132632, 75618, 65794, 65794,
+    66054, 66580, 66054, 65794, 66054, 66054, 65536, 66054, 66054, 66054, 66054, 66054,
+    66316, 66054, 66316, 66316, 66316, 66316, 66580, 66316, 66316, 66316, 66580, 66580,
+    66316, 66054, 66054, 66054, 66580, 66316, 66054, 66316, 66054, 66316, 66580, 66054,
+    66054, 66580, 66580, 66054, 66580, 66316, 66054, 66316, 66847, 66847, 66580, 66054,
+    65794, 65536, 66316, 66580, 66580, 66316, 65794, 66054, 66054, 65794, 66054, 66316,
+    66054, 66054, 65794, 66580, 66054, 66054, 65536, 66054, 66316, 66316, 66054, 66316,
+    66316, 66316, 117688, 132632, 131588, 132632, 131588, 131588, 131588, 131588, 132632, 131588,
+    131588, 131588, 132632, 133693, 131588, 132632, 131588, 131588, 132632, 117688, 67934, 66316,
+    66316, 66316, 66054, 66054, 65794, 65794, 65794, 66054, 66316, 66316, 66054, 66054,
+    66316, 66054, 66316, 66316, 66054, 66316, 66316, 66316, 66316, 66316, 66316, 66316,
+    66580, 66054, 66054, 66316, 66054, 66316, 66847, 66316, 66316, 66316, 66054, 66054,
+    66316, 66580, 66316, 66054, 65794, 66316, 65794, 66054, 66054, 66054, 66316, 65794,
+    66054, 66054, 66054, 66316, 66316, 66054, 66054, 66316, 65536, 66054, 66316, 66580,
+    66316, 66316, 66580, 66316, 66054, 66054, 65794, 65794, 65794, 65794, 65794, 66316,
+    66580, 88422, 131588, 132632, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588,
+    131588, 132632, 132632, 132632, 131588, 132632, 132632, 132632, 132632, 131588, 91822, 66054,
+    66316, 66316, 66054, 66580, 65794, 65794, 65794, 65794, 66316, 66316, 66054, 66316,
+    66054, 66316, 66054, 66316, 66316, 66316, 65794, 66580, 66580, 66580, 66054, 66580,
+    66847, 66580, 66054, 66316, 65794, 66054, 66054, 66054, 66054, 66847, 66054, 66054,
+    66580, 66580, 66054, 66316, 66054, 66316, 65794, 66054, 65794, 66054, 66054, 66054,
+    66054, 66054, 66054, 66054, 66316, 65794, 66054, 65794, 65794, 66054, 66316, 66316,
+    66054, 66580, 66316, 66054, 66054, 66054, 65794, 65794, 66054, 65536, 66316, 66580,
+    73297, 132632, 132632, 132632, 132632, 131588, 131588, 131588, 131588, 131588, 131588, 132632,
+    132632, 132632, 132632, 132632, 132632, 131588, 131588, 131588, 133693, 132632, 131588, 75278,
+    66316, 66316, 66580, 66580, 66054, 65794, 66316, 66316, 66316, 66580, 66316, 66580,
+    66580, 66316, 66054, 66580, 66316, 66316, 66316, 66316, 66847, 66580, 66316, 66316,
+    66316, 66316, 66316, 66054, 66054, 66054, 66054, 66580, 66580, 66580, 66580, 66054,
+    66316, 66316, 65794, 65794, 65794, 65794, 65794, 65794, 66054, 66054, 65794, 65536,
+    65536, 65536, 66847, 66580, 66054, 66054, 66054, 65794, 66316, 66316, 66316, 66054,
+    66580, 66316, 65794, 65794, 66054, 66316, 66847, 66316, 65536, 65794, 66054, 70217,
+    118523, 132632, 131588, 132632, 132632, 132632, 131588, 131588, 131588, 131588, 131588, 132632,
+    132632, 132632, 133693, 132632, 132632, 131588, 132632, 132632, 132632, 132632, 131588, 117688,
+    68490, 66580, 66847, 66847, 66316, 66054, 65536, 66054, 66316, 66316, 66316, 66316,
+    66580, 66580, 66316, 66316, 66316, 66580, 66316, 66316, 66316, 66847, 66054, 66316,
+    66054, 66316, 66316, 66580, 66316, 66316, 66316, 66580, 66054, 66316, 66054, 65794,
+    66316, 66316, 65536, 65536, 65536, 65794, 65536, 65536, 65536, 65794, 65536, 65536,
+    65536, 65794, 66316, 66580, 66054, 65794, 66054, 66054, 66054, 66316, 66054, 66316,
+    66580, 66316, 66316, 66054, 66054, 66316, 66054, 66316, 66054, 66054, 66054, 96044,
+    131588, 131588, 131588, 132632, 132632, 131588, 131588, 132632, 131588, 131588, 132632, 132632,
+    131588, 132632, 131588, 131588, 132632, 131588, 131588, 132632, 132632, 132632, 132632, 132632,
+    100673, 66316, 66316, 66580, 66316, 66316, 66054, 66054, 66316, 66580, 66054, 66580,
+    66316, 66847, 66580, 66316, 66580, 66847, 66847, 66316, 66054, 66580, 66316, 66316,
+    66054, 66316, 66054, 66054, 66580, 66580, 66316, 66054, 65794, 66054, 66316, 66054,
+    66316, 66316, 65536, 65536, 65536, 65794, 66316, 66316, 65794, 66054, 65794, 65794,
+    65536, 65536, 65794, 66054, 65536, 66054, 66316, 66054, 66054, 65794, 66054, 66316,
+    66316, 66316, 65794, 66054, 66054, 66054, 66316, 65794, 66580, 66316, 88422, 132632,
+    131588, 131588, 131588, 132632, 132632, 132632, 131588, 132632, 133693, 132632, 132632, 132632,
+    132632, 131588, 132632, 131588, 131588, 132632, 131588, 131588, 132632, 132632, 132632, 132632,
+    131588, 84402, 66054, 65794, 66580, 66580, 65794, 66316, 66580, 66054, 66316, 65794,
+    66580, 66580, 66580, 66316, 66316, 66316, 66316, 66316, 66316, 66316, 66316, 66847,
+    66054, 66316, 66316, 66054, 66316, 66316, 66316, 66580, 66054, 66316, 66054, 65536,
+    66054, 65794, 65794, 65536, 65536, 65794, 66054, 66054, 66316, 65794, 65536, 65536,
+    65794, 65794, 65536, 65794, 65794, 65536, 66316, 66316, 66054, 66054, 66054, 66316,
+    66580, 66580, 65794, 65794, 65794, 65794, 65794, 65794, 66054, 75962, 132632, 131588,
+    131588, 131588, 131588, 131588, 132632, 132632, 132632, 133693, 132632, 132632, 132632, 132632,
+    131588, 131588, 131588, 132632, 131588, 131588, 131588, 131588, 131588, 132632, 133693, 132632,
+    131588, 131588, 74940, 65794, 66580, 66580, 66054, 66054, 66580, 65794, 66054, 66847,
+    66316, 66580, 66580, 65794, 66580, 66580, 66580, 66580, 66054, 66847, 66580, 66316,
+    66580, 66847, 66316, 66580, 66580, 66580, 66316, 66316, 65794, 66316, 65794, 66054,
+    65794, 66054, 65794, 65794, 66054, 66054, 66054, 66316, 66580, 66316, 65794, 65536,
+    65794, 65794, 66054, 65794, 66054, 66316, 65794, 65794, 65794, 65794, 65794, 66054,
+    66316, 66054, 66316, 66054, 65794, 65536, 66316, 66054, 70217, 124714, 132632, 131588,
+    131588, 131588, 131588, 131588, 132632, 132632, 131588, 131588, 132632, 132632, 132632, 132632,
+    131588, 132632, 131588, 131588, 132632, 132632, 131588, 131588, 132632, 131588, 132632, 131588,
+    131588, 131588, 123790, 70513, 66054, 66580, 66054, 66054, 66054, 66054, 65794, 66054,
+    66580, 66580, 66054, 66054, 66580, 66580, 66316, 66316, 66316, 66316, 66316, 66316,
+    66054, 66054, 66316, 65794, 66316, 66316, 66054, 66580, 66316, 66316, 66847, 66316,
+    66054, 66054, 65536, 65794, 66054, 66054, 66316, 66316, 66054, 66054, 65794, 66054,
+    66054, 65794, 65794, 65794, 66054, 66316, 66054, 66054, 65794, 66054, 65794, 66316,
+    66316, 66316, 65536, 65794, 65794, 65794, 65794, 69923, 116865, 131588, 131588, 131588,
+    131588, 131588, 131588, 131588, 131588, 132632, 131588, 131588, 132632, 132632, 132632, 131588,
+    132632, 132632, 131588, 132632, 132632, 132632, 131588, 131588, 131588, 132632, 131588, 132632,
+    131588, 131588, 131588, 117688, 70217, 66316, 65794, 65794, 66580, 66316, 66054, 66054,
+    65794, 66316, 65794, 66054, 66316, 66580, 66847, 66316, 66316, 66580, 66054, 66580,
+    66316, 66316, 66316, 66580, 66316, 66054, 66316, 66316, 66316, 66316, 66580, 66054,
+    66316, 66054, 65794, 65794, 66054, 66580, 66054, 66316, 66054, 66580, 66054, 66054,
+    65794, 65794, 65794, 66054, 66580, 66316, 66316, 66054, 65536, 65794, 66316, 65794,
+    66316, 65794, 65536, 65794, 66054, 66316, 70513, 117688, 131588, 131588, 131588, 131588,
+    131588, 131588, 131588, 131588, 132632, 132632, 132632, 131588, 132632, 132632, 132632, 132632,
+    132632, 131588, 131588, 131588, 132632, 131588, 131588, 131588, 131588, 132632, 131588, 132632,
+    131588, 131588, 131588, 132632, 117688, 69923, 65794, 65794, 66847, 66316, 66054, 66054,
+    66054, 66316, 66054, 66054, 66316, 66847, 66580, 66316, 66316, 66316, 66316, 66580,
+    66316, 66054, 66054, 66316, 66580, 66847, 66316, 66316, 66316, 66316, 66054, 66054,
+    66316, 66054, 66054, 66054, 66316, 66847, 66316, 66316, 66316, 66316, 65794, 65794,
+    65794, 66054, 66054, 66054, 66054, 66054, 66316, 66316, 65536, 66054, 66054, 66054,
+    65794, 66054, 65794, 66054, 66054, 68490, 117688, 132632, 131588, 132632, 131588, 131588,
+    131588, 131588, 131588, 131588, 132632, 132632, 132632, 132632, 132632, 132632, 131588, 133693,
+    131588, 131588, 132632, 131588, 131588, 132632, 131588, 132632, 131588, 132632, 131588, 131588,
+    131588, 131588, 132632, 132632, 132632, 111411, 67659, 66316, 66054, 66580, 65794, 65536,
+    65794, 66316, 66054, 66054, 66054, 66580, 66316, 66316, 66316, 66054, 66316, 66316,
+    66316, 66054, 66054, 66316, 66580, 66580, 66316, 66316, 66316, 66316, 66054, 66054,
+    66316, 65794, 65794, 66054, 66316, 66054, 66580, 66316, 66054, 65794, 66316, 65536,
+    65794, 66054, 66054, 66054, 66316, 66316, 66316, 66054, 66054, 65794, 65536, 66054,
+    65794, 65794, 66054, 66054, 70812, 112159, 131588, 131588, 131588, 132632, 131588, 131588,
+    131588, 132632, 132632, 132632, 132632, 132632, 132632, 131588, 131588, 132632, 132632, 131588,
+    132632, 132632, 131588, 132632, 132632, 132632, 131588, 131588, 132632, 133693, 131588, 131588,
+    131588, 131588, 132632, 133693, 132632, 132632, 117688, 71114, 66580, 67115, 66054, 66054,
+    65794, 66054, 66316, 66580, 66316, 65794, 66580, 66580, 66054, 66054, 66054, 66316,
+    66316, 66580, 66316, 66580, 66580, 66847, 66847, 66316, 66316, 66580, 65794, 66054,
+    66316, 66316, 66054, 65794, 66316, 66316, 66054, 65794, 65794, 66316, 66054, 66054,
+    66054, 66316, 66054, 65794, 66316, 66316, 65794, 66316, 65794, 66316, 66054, 66316,
+    66054, 66054, 65794, 70513, 118523, 132632, 132632, 131588, 131588, 132632, 131588, 131588,
+    132632, 131588, 132632, 132632, 132632, 132632, 132632, 131588, 132632, 132632, 131588, 132632,
+    131588, 132632, 132632, 132632, 133693, 133693, 131588, 132632, 132632, 132632, 131588, 131588,
+    131588, 131588, 131588, 132632, 133693, 131588, 131588, 117688, 70217, 66054, 65536, 65536,
+    66316, 66054, 66316, 66316, 66316, 66316, 66316, 66316, 66054, 66054, 66054, 66054,
+    66316, 66580, 66580, 66580, 66316, 66580, 66580, 66580, 66316, 66316, 66054, 66316,
+    66580, 66316, 65536, 66054, 66316, 66316, 65794, 65794, 65794, 66316, 66054, 65794,
+    66054, 66580, 66316, 66054, 65794, 65794, 65794, 66054, 66316, 66580, 66054, 66054,
+    66054, 66054, 70513, 118523, 132632, 132632, 133693, 131588, 131588, 132632, 131588, 132632,
+    132632, 132632, 132632, 132632, 132632, 132632, 131588, 131588, 132632, 132632, 132632, 132632,
+    132632, 132632, 132632, 132632, 132632, 132632, 132632, 132632, 131588, 132632, 131588, 131588,
+    131588, 131588, 132632, 132632, 132632, 131588, 131588, 131588, 117688, 69923, 65794, 65794,
+    65794, 66054, 66316, 66847, 66316, 66316, 66316, 66847, 66054, 66054, 66316, 66054,
+    66316, 66580, 66054, 66316, 66580, 66580, 66316, 66580, 66580, 66580, 66054, 66054,
+    66580, 66580, 65794, 65536, 66316, 66316, 65794, 65794, 65794, 66580, 66316, 66054,
+    66316, 66316, 66580, 66316, 65794, 65794, 65536, 66054, 66054, 66847, 66316, 65794,
+    65794, 75618, 124714, 131588, 132632, 132632, 133693, 131588, 131588, 131588, 131588, 131588,
+    131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 132632,
+    131588, 131588, 131588, 132632, 132632, 132632, 131588, 132632, 131588, 131588, 131588, 131588,
+    131588, 131588, 131588, 132632, 132632, 132632, 132632, 131588, 131588, 123790, 75278, 65794,
+    65794, 65794, 66054, 66316, 66316, 66316, 66316, 66316, 65794, 66054, 66054, 66316,
+    66580, 66580, 66054, 66316, 66316, 66580, 66316, 66316, 66316, 66054, 66054, 66316,
+    67115, 66847, 65536, 66054, 66316, 66316, 65794, 65794, 66054, 66054, 66054, 66054,
+    66316, 66316, 66316, 66316, 65794, 65794, 65794, 66054, 66580, 66316, 66316, 65794,
+    84402, 132632, 132632, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588,
+    131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588,
+    132632, 131588, 131588, 131588, 131588, 131588, 131588, 132632, 132632, 132632, 131588, 131588,
+    131588, 132632, 131588, 131588, 131588, 132632, 132632, 131588, 131588, 131588, 131588, 87496,
+    66054, 66054, 66316, 66316, 65794, 66580, 66316, 66054, 66054, 66580, 66580, 66580,
+    66580, 66580, 66580, 66580, 66580, 66580, 66316, 66316, 66054, 66316, 67115, 66847,
+    66580, 66316, 65536, 65794, 66580, 66580, 66054, 66054, 65794, 66580, 66054, 65794,
+    66316, 66316, 66054, 66316, 66054, 65794, 65794, 66054, 66054, 66316, 67659, 100070,
+    131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 132632, 131588, 131588, 131588,
+    131588, 131588, 131588, 131588, 131588, 131588, 131588, 132632, 131588, 131588, 131588, 131588,
+    131588, 131588, 131588, 131588, 132632, 131588, 132632, 132632, 133693, 132632, 131588, 131588,
+    131588, 132632, 132632, 131588, 131588, 131588, 131588, 131588, 132632, 131588, 131588, 131588,
+    96044, 70513, 66316, 66316, 66316, 66316, 66580, 66580, 66580, 66580, 66580, 66580,
+    66580, 66580, 66316, 66316, 66580, 66847, 66316, 66316, 66316, 66580, 66580, 66847,
+    66054, 66316, 65794, 65794, 65794, 66054, 66054, 66316, 65794, 65794, 66316, 66054,
+    66054, 66316, 66316, 66316, 66316, 66054, 65536, 66054, 66316, 75618, 116865, 131588,
+    131588, 132632, 131588, 131588, 131588, 131588, 131588, 131588, 132632, 132632, 131588, 131588,
+    131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 132632,
+    131588, 132632, 131588, 132632, 132632, 132632, 131588, 132632, 132632, 132632, 131588, 131588,
+    131588, 131588, 131588, 132632, 131588, 131588, 131588, 132632, 131588, 131588, 131588, 131588,
+    131588, 117688, 72977, 66316, 65794, 66580, 66054, 66054, 66580, 66316, 66316, 66316,
+    66054, 66054, 66316, 66316, 66580, 66580, 66316, 66316, 66316, 66580, 66054, 66054,
+    65794, 66054, 65794, 65794, 65536, 66054, 66316, 66316, 65794, 66054, 66580, 66847,
+    66580, 66316, 66316, 66580, 66054, 66054, 66054, 67659, 91822, 131588, 131588, 131588,
+    131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 132632, 131588, 131588,
+    131588, 131588, 132632, 131588, 132632, 132632, 131588, 131588, 131588, 132632, 132632, 133693,
+    131588, 131588, 131588, 132632, 132632, 132632, 131588, 131588, 131588, 132632, 132632, 132632,
+    131588, 132632, 132632, 131588, 131588, 131588, 131588, 131588, 132632, 132632, 131588, 131588,
+    131588, 131588, 131588, 88422, 66316, 66054, 65794, 66054, 66580, 66316, 66316, 66316,
+    66054, 66054, 66580, 66316, 66580, 66316, 66316, 66316, 66316, 66316, 66054, 65794,
+    66580, 66847, 66316, 65794, 65536, 66316, 66054, 66316, 66054, 66316, 66316, 66580,
+    66316, 66580, 66316, 66580, 66580, 66316, 75618, 117688, 131588, 131588, 131588, 131588,
+    132632, 132632, 131588, 131588, 132632, 132632, 131588, 132632, 132632, 131588, 131588, 132632,
+    131588, 132632, 132632, 131588, 132632, 132632, 131588, 131588, 131588, 131588, 132632, 132632,
+    132632, 132632, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 132632, 132632, 132632,
+    132632, 132632, 132632, 132632, 131588, 131588, 131588, 131588, 132632, 131588, 131588, 131588,
+    131588, 131588, 131588, 131588, 118523, 78459, 66054, 66316, 66316, 66316, 66316, 66316,
+    66316, 66316, 66580, 66316, 66580, 66316, 66316, 66580, 66054, 66054, 66054, 66054,
+    66316, 66580, 66054, 66054, 65794, 66054, 65794, 66316, 66316, 66316, 66316, 66847,
+    66054, 66054, 66580, 66316, 70217, 100673, 131588, 132632, 132632, 131588, 131588, 131588,
+    132632, 132632, 131588, 132632, 131588, 132632, 131588, 131588, 131588, 132632, 131588, 132632,
+    132632, 132632, 132632, 132632, 132632, 132632, 131588, 131588, 131588, 133693, 132632, 133693,
+    133693, 132632, 131588, 131588, 131588, 132632, 131588, 131588, 132632, 132632, 132632, 132632,
+    131588, 132632, 131588, 132632, 132632, 131588, 131588, 131588, 131588, 132632, 131588, 132632,
+    132632, 132632, 131588, 131588, 132632, 132632, 96599, 70217, 66316, 66316, 66580, 66316,
+    66580, 66580, 66316, 66316, 66580, 66316, 66316, 66316, 66054, 66316, 66054, 66316,
+    67115, 66580, 66316, 66580, 65794, 66054, 66054, 66316, 66054, 66316, 66316, 66316,
+    66316, 66316, 67659, 87956, 124714, 132632, 131588, 131588, 131588, 131588, 131588, 131588,
+    132632, 132632, 131588, 132632, 131588, 131588, 132632, 131588, 132632, 131588, 131588, 132632,
+    132632, 132632, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 132632, 132632, 132632,
+    131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 132632, 132632, 132632, 131588,
+    131588, 131588, 131588, 131588, 132632, 131588, 131588, 131588, 132632, 132632, 131588, 131588,
+    132632, 132632, 132632, 131588, 133693, 132632, 132632, 132632, 96599, 70513, 66054, 66847,
+    66580, 66316, 66580, 66316, 66316, 66316, 66316, 66316, 66316, 66316, 66580, 66580,
+    66316, 66580, 66316, 66580, 66054, 66054, 66580, 66316, 66054, 66316, 66054, 66054,
+    67934, 88422, 124714, 131588, 132632, 131588, 131588, 131588, 131588, 131588, 131588, 131588,
+    132632, 132632, 131588, 131588, 132632, 131588, 131588, 131588, 132632, 131588, 131588, 132632,
+    132632, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 132632, 131588, 131588, 132632,
+    132632, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 132632, 132632, 132632, 131588,
+    131588, 131588, 131588, 131588, 132632, 132632, 131588, 131588, 131588, 131588, 131588, 131588,
+    132632, 132632, 131588, 131588, 132632, 133693, 132632, 132632, 132632, 117688, 88422, 70812,
+    66580, 66847, 66316, 66316, 66316, 66316, 66580, 66316, 66316, 66316, 66580, 66847,
+    66316, 66316, 65794, 65536, 66054, 66316, 66054, 66054, 65794, 66054, 69923, 88422,
+    124714, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588,
+    131588, 132632, 131588, 131588, 132632, 131588, 131588, 131588, 131588, 131588, 131588, 131588,
+    132632, 132632, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 132632, 131588, 132632,
+    132632, 132632, 132632, 132632, 131588, 131588, 131588, 131588, 131588, 132632, 132632, 132632,
+    131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588,
+    131588, 132632, 131588, 131588, 132632, 132632, 132632, 132632, 132632, 132632, 131588, 132632,
+    96044, 70217, 66054, 66580, 66054, 66580, 66054, 66054, 66054, 66054, 66054, 66316,
+    66054, 66054, 65794, 66316, 66316, 66580, 66054, 66054, 75278, 105770, 131588, 131588,
+    131588, 132632, 132632, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 132632, 132632,
+    132632, 132632, 131588, 131588, 131588, 132632, 131588, 131588, 131588, 131588, 131588, 131588,
+    132632, 132632, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 132632,
+    132632, 134772, 131588, 133693, 132632, 131588, 132632, 132632, 132632, 132632, 132632, 131588,
+    131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588,
+    131588, 131588, 132632, 132632, 131588, 131588, 132632, 132632, 132632, 132632, 132632, 132632,
+    132632, 132632, 100070, 78092, 66316, 66316, 65794, 66580, 66054, 66316, 66316, 66316,
+    66054, 66316, 66054, 66054, 65794, 74940, 91321, 124714, 131588, 131588, 131588, 131588,
+    132632, 131588, 132632, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 132632,
+    131588, 131588, 131588, 131588, 131588, 131588, 131588, 132632, 131588, 131588, 131588, 131588,
+    132632, 132632, 132632, 132632, 131588, 132632, 131588, 131588, 132632, 132632, 132632, 132632,
+    132632, 132632, 132632, 132632, 132632, 131588, 132632, 132632, 132632, 131588, 131588, 131588,
+    131588, 131588, 131588, 131588, 131588, 132632, 131588, 131588, 131588, 131588, 131588, 132632,
+    132632, 132632, 131588, 132632, 131588, 132632, 132632, 132632, 131588, 132632, 132632, 131588,
+    131588, 131588, 131588, 133693, 117688, 96044, 76309, 66580, 66580, 66316, 66316, 66580,
+    66316, 68211, 81125, 96044, 124714, 131588, 131588, 131588, 131588, 131588, 131588, 131588,
+    131588, 132632, 132632, 131588, 132632, 132632, 132632, 132632, 131588, 131588, 133693, 132632,
+    132632, 132632, 131588, 132632, 131588, 131588, 131588, 132632, 132632, 132632, 131588, 131588,
+    132632, 132632, 132632, 133693, 133693, 132632, 131588, 131588, 132632, 133693, 133693, 132632,
+    131588, 131588, 131588, 131588, 131588, 132632, 132632, 132632, 132632, 131588, 131588, 131588,
+    131588, 131588, 131588, 131588, 132632, 132632, 131588, 131588, 131588, 131588, 131588, 132632,
+    132632, 131588, 131588, 131588, 132632, 132632, 131588, 132632, 132632, 132632, 132632, 132632,
+    131588, 131588, 132632, 132632, 132632, 133693, 132632, 118523, 96599, 78829, 70513, 66054,
+    84831, 132632, 132632, 132632, 131588, 132632, 132632, 132632, 132632, 132632, 131588, 132632,
+    133693, 132632, 132632, 132632, 131588, 132632, 132632, 132632, 132632, 132632, 132632, 133693,
+    132632, 132632, 131588, 131588, 131588, 132632, 132632, 132632, 132632, 132632, 131588, 131588,
+    132632, 131588, 131588, 132632, 132632, 132632, 131588, 132632, 131588, 131588, 132632, 132632,
+    131588, 131588, 131588, 131588, 131588, 131588, 131588, 132632, 131588, 131588, 131588, 132632,
+    132632, 132632, 131588, 131588, 132632, 131588, 131588, 131588, 131588, 131588, 131588, 132632,
+    132632, 131588, 131588, 131588, 131588, 132632, 132632, 132632, 132632, 131588, 131588, 131588,
+    131588, 132632, 132632, 132632, 132632, 132632, 132632, 132632, 131588, 132632, 131588, 84831,
+    117688, 132632, 132632, 132632, 133693, 132632, 132632, 132632, 132632, 132632, 132632, 132632,
+    132632, 133693, 132632, 132632, 131588, 132632, 133693, 131588, 132632, 132632, 132632, 132632,
+    132632, 132632, 132632, 132632, 131588, 131588, 132632, 132632, 133693, 131588, 131588, 131588,
+    132632, 132632, 132632, 131588, 132632, 132632, 131588, 132632, 132632, 132632, 132632, 131588,
+    131588, 131588, 132632, 131588, 131588, 131588, 131588, 132632, 132632, 131588, 131588, 131588,
+    131588, 131588, 131588, 131588, 132632, 132632, 131588, 131588, 131588, 131588, 132632, 133693,
+    132632, 132632, 131588, 131588, 131588, 132632, 132632, 132632, 132632, 132632, 132632, 131588,
+    132632, 131588, 131588, 132632, 132632, 131588, 132632, 132632, 131588, 131588, 132632, 124714,
+    124714, 132632, 132632, 132632, 132632, 132632, 131588, 131588, 131588, 132632, 131588, 131588,
+    131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 132632, 132632, 131588, 131588,
+    132632, 131588, 131588, 131588, 131588, 132632, 132632, 132632, 131588, 131588, 131588, 131588,
+    132632, 132632, 131588, 131588, 132632, 131588, 131588, 131588, 132632, 132632, 132632, 132632,
+    132632, 132632, 131588, 132632, 132632, 132632, 131588, 131588, 132632, 132632, 131588, 131588,
+    131588, 131588, 131588, 131588, 132632, 131588, 131588, 132632, 131588, 132632, 132632, 131588,
+    132632, 132632, 132632, 131588, 131588, 131588, 131588, 131588, 132632, 132632, 132632, 132632,
+    132632, 132632, 131588, 131588, 132632, 132632, 131588, 132632, 132632, 132632, 132632, 118523,
+    84831, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 132632, 131588, 132632,
+    131588, 132632, 131588, 131588, 131588, 131588, 131588, 131588, 132632, 132632, 131588, 131588,
+    131588, 131588, 131588, 131588, 131588, 132632, 132632, 131588, 131588, 131588, 131588, 131588,
+    133693, 132632, 132632, 132632, 131588, 131588, 131588, 131588, 131588, 132632, 131588, 131588,
+    132632, 132632, 132632, 132632, 132632, 131588, 131588, 131588, 131588, 132632, 132632, 131588,
+    131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 132632, 133693, 132632, 131588,
+    131588, 131588, 132632, 132632, 131588, 131588, 131588, 131588, 132632, 132632, 132632, 132632,
+    132632, 131588, 131588, 132632, 132632, 131588, 132632, 132632, 132632, 132632, 132632, 85264,
+    66316, 71417, 77729, 96599, 117688, 131588, 131588, 131588, 131588, 131588, 132632, 131588,
+    131588, 131588, 131588, 132632, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588,
+    131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588,
+    131588, 131588, 131588, 131588, 132632, 132632, 131588, 131588, 131588, 131588, 131588, 131588,
+    132632, 131588, 132632, 132632, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 132632,
+    132632, 132632, 131588, 131588, 132632, 131588, 131588, 131588, 131588, 131588, 132632, 132632,
+    132632, 132632, 132632, 132632, 131588, 131588, 132632, 132632, 132632, 132632, 132632, 131588,
+    131588, 131588, 132632, 132632, 131588, 132632, 132632, 125652, 96044, 81125, 67934, 66054,
+    66316, 66580, 66316, 66316, 66054, 75278, 95495, 117688, 131588, 131588, 131588, 131588,
+    131588, 131588, 132632, 131588, 131588, 132632, 131588, 131588, 131588, 131588, 131588, 131588,
+    131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 131588, 132632, 131588,
+    132632, 132632, 131588, 131588, 132632, 132632, 131588, 131588, 131588, 131588, 131588, 131588,
+    131588, 132632, 131588, 132632, 131588, 131588, 131588, 131588, 131588, 132632, 132632, 132632,
+    132632, 131588, 131588, 131588, 132632, 131588, 131588, 131588, 132632, 132632, 132632, 132632,
+    132632, 132632, 132632, 132632, 131588, 131588, 132632, 132632, 132632, 131588, 132632, 131588,
+    131588, 132632, 132632, 132632, 124714, 92330, 75618, 66580, 66316, 66054, 65794, 66054,
+    66316, 66580, 66054, 65794, 66054, 65794, 66054, 66054, 78092, 101283, 131588, 131588,
+    132632, 131588, 132632, 131588, 131588, 131588, 131588, 131588, 131588, 132632, 131588, 131588,
+    131588, 132632, 132632, 131588, 131588, 131588, 132632, 131588, 132632, 131588, 132632, 132632,
+    132632, 132632, 132632, 132632, 131588, 133693, 131588, 131588, 131588, 132632, 131588, 131588,
+    131588, 131588, 131588, 131588, 132632, 131588, 131588, 131588, 131588, 132632, 132632, 132632,
+    132632, 132632, 132632, 132632, 132632, 132632, 131588, 131588, 131588, 131588, 132632, 132632,
+    132632, 132632, 132632, 132632, 132632, 132632, 132632, 132632, 132632, 132632, 131588, 131588,
+    132632, 132632, 105770, 75618, 66580, 66847, 66316, 66316, 65794, 66054, 66054, 65794,
+    66580, 66580, 66316, 66316, 66054, 66054, 66054, 66054, 66580, 66316, 69923, 96044,
+    131588, 131588, 131588, 133693, 133693, 131588, 131588, 132632, 132632, 132632, 131588, 132632,
+    131588, 131588, 132632, 131588, 132632, 131588, 131588, 132632, 132632, 131588, 133693, 132632,
+    132632, 132632, 132632, 133693, 133693, 132632, 131588, 131588, 131588, 132632, 131588, 131588,
+    132632, 131588, 131588, 131588, 132632, 132632, 131588, 131588, 131588, 131588, 132632, 132632,
+    132632, 132632, 132632, 132632, 132632, 131588, 131588, 131588, 131588, 131588, 132632, 132632,
+    132632, 132632, 132632, 131588, 132632, 132632, 132632, 132632, 131588, 132632, 131588, 124714,
+    88422, 70812, 66316, 66316, 67115, 67115, 66316, 66316, 66054, 66580, 66054, 66054,
+    66580, 66316, 66316, 66316, 66847, 66580, 66580, 66316, 66580, 66580, 66054, 66054,
+    70513, 88422, 117688, 132632, 132632, 132632, 131588, 132632, 133693, 132632, 131588, 131588,
+    132632, 132632, 132632, 132632, 132632, 132632, 132632, 132632, 132632, 131588, 131588, 132632,
+    131588, 132632, 132632, 133693, 132632, 132632, 132632, 131588, 131588, 131588, 131588, 131588,
+    131588, 132632, 132632, 131588, 132632, 131588, 131588, 131588, 131588, 132632, 131588, 132632,
+    132632, 132632, 132632, 132632, 132632, 132632, 131588, 131588, 131588, 132632, 132632, 132632,
+    132632, 132632, 131588, 132632, 132632, 132632, 132632, 132632, 132632, 124714, 87956, 67934,
+    66054, 66054, 66054, 66580, 66580, 66847, 66316, 66054, 66580, 66316, 65794, 66054,
+    66580, 66054, 66316, 66580, 66847, 66580, 66054, 66316, 66847, 66847, 66054, 66316,
+    66054, 66580, 69923, 96044, 132632, 131588, 131588, 132632, 133693, 133693, 132632, 132632,
+    132632, 133693, 132632, 132632, 132632, 132632, 132632, 132632, 132632, 131588, 131588, 132632,
+    131588, 131588, 132632, 132632, 132632, 132632, 132632, 131588, 131588, 131588, 131588, 131588,
+    132632, 132632, 132632, 132632, 132632, 131588, 131588, 131588, 132632, 132632, 131588, 132632,
+    132632, 132632, 131588, 132632, 132632, 132632, 131588, 131588, 132632, 132632, 131588, 132632,
+    132632, 132632, 131588, 132632, 132632, 132632, 132632, 125652, 88422, 68211, 66580, 66054,
+    66054, 66054, 66054, 66054, 66580, 66847, 66580, 66316, 66580, 66316, 66054, 66054,
+    66316, 66316, 66316, 66580, 66316, 66054, 66580, 66580, 66316, 66847, 66580, 66054,
+    66054, 66054, 65536, 66054, 70217, 97161, 131588, 132632, 133693, 132632, 131588, 132632,
+    131588, 131588, 132632, 131588, 133693, 132632, 132632, 132632, 132632, 132632, 131588, 131588,
+    132632, 131588, 131588, 131588, 131588, 131588, 132632, 132632, 131588, 131588, 131588, 131588,
+    132632, 132632, 132632, 132632, 132632, 132632, 132632, 132632, 132632, 131588, 131588, 131588,
+    131588, 131588, 131588, 131588, 131588, 131588, 131588, 132632, 132632, 132632, 132632, 132632,
+    132632, 132632, 132632, 132632, 132632, 132632, 100673, 70513, 66580, 66316, 66316, 66054,
+    66580, 66580, 66580, 66316, 66580, 66580, 66580, 66316, 66316, 66054, 66316, 66580,
+    66316, 66316, 66054, 66316, 66054, 66054, 66316, 66580, 66316, 66580, 65794, 65794,
+    65794, 66054, 65536, 65794, 66316, 66316, 77729, 116865, 131588, 132632, 131588, 131588,
+    132632, 131588, 131588, 131588, 132632, 133693, 132632, 132632, 133693, 132632, 131588, 131588,
+    132632, 131588, 131588, 131588, 131588, 131588, 132632, 131588, 131588, 131588, 131588, 131588,
+    131588, 132632, 132632, 132632, 131588, 131588, 131588, 132632, 132632, 132632, 131588, 131588,
+    131588, 132632, 131588, 131588, 131588, 131588, 131588, 131588, 132632, 132632, 132632, 132632,
+    131588, 132632, 132632, 132632, 118523, 75618, 66580, 66316, 66316, 66316, 66580, 66316,
+    66316, 66054, 66316, 66316, 66580, 66580, 66316, 66316, 65794, 66054, 66316, 66316,
+    66316, 66054, 66316, 66054, 66316, 66316, 66316, 66580, 66316, 66580, 66847, 66580,
+    66316, 66054, 65794, 66054, 66054, 66054, 65536, 66054, 87956, 131588, 131588, 131588,
+    132632, 132632, 131588, 131588, 131588, 131588, 131588, 132632, 132632, 132632, 132632, 131588,
+    131588, 131588, 131588, 131588, 131588, 132632, 131588, 131588, 131588, 132632, 131588, 131588,
+    132632, 132632, 131588, 131588, 132632, 131588, 131588, 132632, 133693, 132632, 131588, 131588,
+    131588, 131588, 131588, 132632, 131588, 131588, 131588, 131588, 132632, 132632, 132632, 132632,
+    132632, 132632, 132632, 92330, 68490, 66316, 66316, 66316, 66316, 66316, 66316, 66316,
+    66316, 66316, 66316, 66316, 66847, 66316, 65794, 66316, 65794, 66054, 65794, 66054,
+    66580, 66580, 66316, 66580, 66316, 66580, 66316, 66316, 66316, 66316, 66316, 66580,
+    66316, 66580, 65536, 66054, 65536, 66054, 65794, 65794, 65536, 72345, 117688, 132632,
+    132632, 132632, 131588, 131588, 131588, 131588, 131588, 132632, 132632, 132632, 131588, 132632,
+    132632, 132632, 131588, 132632, 131588, 132632, 131588, 131588, 132632, 132632, 131588, 132632,
+    133693, 132632, 131588, 131588, 131588, 131588, 131588, 131588, 132632, 132632, 131588, 131588,
+    131588, 131588, 132632, 132632, 131588, 131588, 131588, 131588, 132632, 132632, 132632, 132632,
+    132632, 117688, 75618, 66316, 66316, 66316, 66316, 66316, 66316, 66316, 66316, 66316,
+    66316, 66316, 66316, 66580, 66847, 66580, 66316, 66316, 65794, 65794, 65794, 65794,
+    66316, 66316, 66580, 66316, 66316, 66316, 66316, 66316, 66316, 66580, 66054, 66054,
+    66316, 66054, 65536, 65794, 66316, 66054, 65536, 65536, 66316, 65794, 70217, 96044,
+    132632, 131588, 131588, 131588, 132632, 132632, 131588, 132632, 132632, 132632, 132632, 131588,
+    131588, 131588, 131588, 132632, 131588, 132632, 131588, 131588, 131588, 132632, 131588, 133693,
+    132632, 132632, 131588, 131588, 131588, 131588, 132632, 131588, 132632, 132632, 131588, 131588,
+    131588, 131588, 132632, 132632, 131588, 131588, 131588, 131588, 132632, 132632, 132632, 132632,
+    100673, 68211, 66316, 66316, 66316, 66316, 66316, 66316, 66316, 66316, 66316, 66316,
+    66316, 66316, 66316, 66316, 66847, 66580, 66316, 66316, 66054, 66316, 66054, 66054,
+    66316, 66580, 66580, 66580, 66316, 66316, 66580, 66316, 66316, 66316, 66316, 66580,
+    66316, 66316, 65794, 65794, 65794, 65794, 66054, 65794, 66580, 66054, 65794, 66580,
+    88422, 132632, 132632, 132632, 132632, 133693, 132632, 132632, 132632, 132632, 132632, 131588,
+    131588, 131588, 131588, 132632, 133693, 132632, 132632, 131588, 131588, 132632, 132632, 132632,
+    132632, 132632, 131588, 131588, 131588, 132632, 132632, 132632, 131588, 132632, 132632, 132632,
+    131588, 132632, 132632, 132632, 131588, 131588, 131588, 131588, 132632, 132632, 132632, 84402,
+    66316, 66316, 66316, 66316, 66580, 66316, 66316, 66316, 66316, 66316, 66054, 66316,
+    66316, 66316, 66316, 66316, 66580, 66847, 66316, 66054, 65794, 66054, 65794, 66054,
+    66316, 66316, 66316, 66054, 66316, 66316, 66847, 66580, 66316, 66580, 66580, 66316,
+    66054, 66316, 66054, 66054, 66580, 66316, 66054, 66316, 65794, 66316, 65794, 66054,
+    66054, 75618, 124714, 132632, 131588, 132632, 132632, 133693, 132632, 131588, 131588, 131588,
+    131588, 131588, 131588, 132632, 132632, 132632, 131588, 132632, 131588, 132632, 131588, 131588,
+    131588, 132632, 132632, 132632, 131588, 132632, 132632, 132632, 131588, 131588, 131588, 131588,
+    132632, 131588, 131588, 131588, 131588, 132632, 131588, 131588, 131588, 123790, 75618, 66316,
+    66054, 66316, 66316, 66316, 66580, 66316, 66580, 66316, 66316, 66316, 66054, 66316,
+    66316, 66316, 66316, 66316, 66847, 66580, 66580, 66316, 66316, 66316, 66316, 66316,
+    66316, 66580, 66054, 66316, 66316, 66316, 66580, 66580, 66316, 66847, 66580, 66580,
+    66580, 66580, 66316, 66316, 66316, 66316, 66054, 66054, 65794, 66316, 66054, 66316,
+    66580, 66316, 70812, 117688, 131588, 132632, 132632, 131588, 132632, 131588, 132632, 132632,
+    131588, 131588, 131588, 132632, 132632, 132632, 132632, 131588, 132632, 132632, 131588, 131588,
+    131588, 132632, 132632, 132632, 131588, 131588, 132632, 132632, 131588, 131588, 131588, 131588,
+    131588, 131588, 131588, 132632, 132632, 132632, 131588, 131588, 117688, 70217, 66316, 66316,
+    66316, 66316, 66316, 66316, 66316, 66316, 66316, 66316, 66316, 66847, 66316, 66580,
+    66316, 66316, 66316, 66316, 66580, 66580, 66847, 66316, 66316, 66316, 66580, 66316,
+    66580, 66580, 66316, 66316, 66316, 66316, 66316, 66316, 66580, 66580, 66316, 66580,
+    66316, 66316, 66316, 65794, 66316, 66316, 66316, 66580, 66316, 66316, 66316, 66316,
+    66580, 66580, 66580, 70513, 117688, 132632, 131588, 131588, 132632, 132632, 132632, 132632,
+    131588, 132632, 131588, 132632, 132632, 131588, 132632, 132632, 131588, 132632, 132632, 132632,
+    132632, 132632, 132632, 132632, 131588, 132632, 131588, 132632, 131588, 131588, 132632, 132632,
+    131588, 131588, 132632, 132632, 132632, 132632, 131588, 117688, 70513, 66054, 66054, 66316,
+    66054, 66054, 66316, 66316, 66316, 66580, 66847, 66316, 66580, 66847, 66580, 66580,
+    66847, 66316, 66316, 66316, 66580, 66580, 66316, 66054, 66580, 66054, 66054, 65794,
+    66580, 66580, 66054, 66316, 66316, 66580, 66316, 66580, 66847, 66847, 66316, 66580,
+    66316, 66054, 66316, 66054, 65794, 66580, 66580, 66580, 66580, 66316, 66580, 66580,
+    66054, 66316, 66316, 66316, 70513, 117688, 132632, 132632, 132632, 132632, 132632, 132632,
+    133693, 131588, 131588, 131588, 132632, 132632, 132632, 133693, 132632, 132632, 133693, 132632,
+    133693, 133693, 132632, 132632, 131588, 132632, 131588, 131588, 131588, 132632, 132632, 132632,
+    131588, 131588, 132632, 132632, 132632, 132632, 111411, 70513, 66316, 66316, 66316, 66580,
+    66316, 66316, 66316, 66316, 66316, 66580, 66580, 66316, 66580, 66580, 66580, 66580,
+    66580, 66316, 66316, 66054, 66580, 66580, 66054, 66054, 66054, 66054, 66054, 66054,
+    66580, 66580, 66316, 66316, 66316, 66580, 66316, 66580, 66580, 66847, 66316, 66580,
+    66316, 65794, 66054, 66054, 66316, 66580, 66580, 66316, 66316, 66316, 66316, 66316,
+    66580, 66316, 66580, 66580, 66054, 68211, 111411, 132632, 132632, 132632, 132632, 132632,
+    132632, 132632, 131588, 131588, 131588, 132632, 132632, 133693, 132632, 132632, 132632, 132632,
+    132632, 132632, 132632, 131588, 131588, 131588, 131588, 131588, 132632, 132632, 132632, 132632,
+    131588, 131588, 132632, 131588, 132632, 117688, 68490, 66580, 65794, 66316, 66316, 66054,
+    66054, 66316, 65536, 66054, 66580, 66316, 66316, 66316, 66316, 66316, 66580, 66580,
+    66316, 66054, 66316, 66316, 66580, 66847, 66054, 66316, 66054, 66054, 66054, 66054,
+    66580, 66580, 66580, 66316, 66316, 66316, 66316, 66316, 66316, 66580, 66316, 66580,
+    66054, 66580, 66054, 66054, 66316, 66316, 66316, 66316, 66316, 66316, 66316, 66580,
+    66316, 65794, 66054, 66316, 66316, 66316, 70812, 118523, 132632, 132632, 132632, 132632,
+    132632, 132632, 131588, 131588, 132632, 132632, 132632, 132632, 132632, 132632, 132632, 132632,
+    131588, 132632, 131588, 131588, 131588, 132632, 131588, 132632, 133693, 133693, 131588, 131588,
+    131588, 132632, 132632, 131588, 117688, 70513, 66580, 66054, 66316, 66580, 66316, 66580,
+    66316, 66316, 66316, 66316, 66054, 66316, 66580, 66316, 66054, 66580, 66580, 66316,
+    66316, 66316, 66316, 66580, 66580, 66580, 66316, 66054, 66316, 66054, 66054, 66054,
+    66316, 66580, 66316, 66316, 66054, 66316, 66054, 66316, 66316, 66316, 66054, 66054,
+    66054, 66054, 66054, 65794, 66316, 66316, 66316, 66316, 66054, 66054, 66316, 66316,
+    66316, 66580, 65794, 66316, 66316, 66316, 66316, 70513, 117688, 133693, 132632, 132632,
+    132632, 132632, 131588, 131588, 132632, 132632, 132632, 131588, 131588, 131588, 131588, 132632,
+    131588, 131588, 131588, 131588, 132632, 131588, 132632, 132632, 133693, 132632, 132632, 132632,
+    131588, 131588, 133693, 117688, 70513, 66054, 66054, 66580, 66316, 66580, 66316, 66316,
+    66316, 66580, 66054, 66316, 66054, 66847, 66580, 66316, 66580, 66316, 66054, 66316,
+    66316, 66316, 66316, 66316, 66580, 66580, 66316, 66316, 66580, 66316, 66054, 66054,
+    66316, 66580, 66580, 66580, 66316, 66316, 66316, 66316, 66054, 66580, 66054, 65794,
+    65794, 65794, 66054, 66054, 66054, 66316, 66054, 66316, 66316, 66316, 66316, 66316,
+    66847, 66580, 66316, 66316, 66316, 66316, 66580, 66316, 70217, 124714, 132632, 132632,
+    132632, 132632, 133693, 132632, 132632, 132632, 132632, 131588, 131588, 131588, 131588, 132632,
+    132632, 131588, 131588, 131588, 131588, 131588, 132632, 132632, 132632, 132632, 133693, 132632,
+    132632, 132632, 125652, 70513, 66580, 66316, 66316, 66316, 66054, 66316, 66054, 66580,
+    66316, 66580, 66316, 66580, 66316, 66580, 66054, 66316, 66054, 66316, 66316, 66316,
+    66580, 66847, 66847, 66847, 66316, 66580, 66316, 66580, 66316, 66316, 66054, 66054,
+    66316, 66580, 66316, 66580, 66054, 66580, 66316, 66054, 66054, 66054, 66316, 66054,
+    66054, 66054, 65794, 65794, 66054, 66316, 66316, 66316, 66316, 66580, 66580, 66847,
+    66316, 66316, 66316, 66316, 66316, 66316, 66054, 66316, 65794, 75278, 132632, 131588,
+    131588, 131588, 132632, 132632, 131588, 132632, 131588, 131588, 131588, 131588, 131588, 131588,
+    132632, 132632, 131588, 131588, 131588, 132632, 132632, 132632, 133693, 132632, 132632, 132632,
+    131588, 132632, 75962, 66847, 66847, 66316, 66316, 66316, 66316, 65794, 66580, 66054,
+    66316, 66847, 66054, 66316, 66580, 66580, 66316, 66316, 66316, 66316, 66316, 66316,
+    66316, 66316, 66054, 66316, 66316, 66316, 66580, 66316, 66316, 66316, 66054, 66054,
+    66316, 66316, 66316, 66316, 66316, 66316, 66316, 66054, 66054, 66054, 66316, 65794,
+    66054, 65794, 66054, 66054, 66054, 66316, 66054, 66316, 66316, 66316, 66580, 66847,
+    66847, 66316, 66580, 66580, 66580, 66054, 66316, 66054, 66054, 66054, 84402, 131588,
+    131588, 131588, 132632, 131588, 131588, 132632, 132632, 131588, 131588, 131588, 132632, 131588,
+    132632, 132632, 132632, 132632, 132632, 131588, 132632, 132632, 132632, 132632, 132632, 132632,
+    132632, 87956, 66580, 66847, 66580, 66316, 66316, 66316, 66316, 66580, 66054, 66054,
+    66580, 66316, 66316, 66316, 66316, 66580, 66316, 66316, 66316, 66580, 66316, 66316,
+    66316, 66316, 66054, 66316, 66316, 66316, 66580, 66316, 66316, 66580, 66054, 66054,
+    66054, 66847, 66580, 66316, 66316, 66316, 66316, 67115, 66054, 66316, 66054, 66316,
+    66054, 66054, 66054, 66054, 66316, 66054, 66316, 66316, 66847, 66847, 66847, 66580,
+    66580, 66054, 66316, 66316, 66316, 66054, 65536, 66054, 66054, 65794, 66316, 100673,
+    131588, 131588, 131588, 131588, 131588, 131588, 132632, 132632, 131588, 132632, 131588, 131588,
+    131588, 132632, 132632, 133693, 132632, 132632, 132632, 132632, 131588, 131588, 131588, 131588,
+    95495, 65794, 66054, 65794, 66580, 66316, 66316, 66316, 66054, 65794, 66054, 66054,
+    66580, 66316, 66316, 66316, 66054, 66054, 66580, 66316, 66316, 66580, 66316, 66054,
+    66580, 66054, 66054, 66580, 66580, 66580, 66316, 66054, 66316, 66316, 65794, 66847,
+    66316, 66316, 66316, 66316, 66316, 66580, 66316, 66316, 66316, 66580, 66054, 66054,
+    66054, 66316, 65536, 66316, 66316, 66054, 66580, 66580, 66847, 66847, 66847, 66580,
+    66316, 66580, 66580, 66316, 66316, 66580, 66054, 66316, 65794, 66054, 66316, 67659,
+    116865, 131588, 131588, 131588, 131588, 132632, 133693, 132632, 132632, 132632, 131588, 131588,
+    132632, 132632, 132632, 132632, 132632, 132632, 131588, 131588, 131588, 131588, 131588, 117688,
+    70513, 66054, 65794, 66316, 66316, 66580, 66847, 66316, 65794, 66316, 66580, 66316,
+    66054, 66580, 66316, 66316, 66316, 66316, 66316, 66316, 66316, 66054, 66316, 66580,
+    66316, 66580, 66054, 66316, 66316, 66580, 66316, 65794, 66316, 66054, 66054, 66316,
+    65794, 66054, 65794, 66580, 66316, 66580, 66054, 66316, 66316, 66316, 66316, 65794,
+    66316, 66316, 66054, 66316, 66316, 66316, 66580, 66316, 66580, 66580, 66054, 66316,
+    66580, 66580, 66316, 66316, 66316, 66054, 66580, 66580, 66316, 66316, 66316, 66054,
+    74940, 131588, 131588, 131588, 132632, 132632, 131588, 132632, 132632, 132632, 131588, 131588,
+    132632, 132632, 131588, 132632, 132632, 131588, 132632, 131588, 131588, 132632, 132632, 72977,
+    66580, 66580, 66316, 66580, 66580, 66316, 66316, 66580, 66316, 66316, 66316, 66316,
+    66054, 66580, 66847, 66580, 66054, 66316, 66054, 66316, 66316, 66316, 66316, 66316,
+    66316, 66580, 66054, 66580, 66316, 66054, 66054, 66316, 66054, 66316, 66580, 66054,
+    65794, 65794, 66054, 65794, 66054, 66316, 66316, 66580, 66316, 66316, 66054, 66054,
+    66054, 66054, 66054, 66054, 66580, 66316, 66316, 66316, 66054, 66054, 66580, 66580,
+    66316, 66316, 66316, 66316, 66316, 66054, 66316, 66316, 66316, 66316, 66316, 66316,
+    66054, 91822, 131588, 131588, 132632, 133693, 131588, 132632, 132632, 132632, 131588, 131588,
+    132632, 132632, 132632, 132632, 131588, 131588, 131588, 131588, 131588, 132632, 88422, 66054,
+    66580, 66580, 66316, 66054, 66316, 66580, 66316, 66580, 66580, 66580, 66580, 66580,
+    66054, 66580, 65794, 66580, 66580, 66316, 66316, 66316, 66316, 66316, 66316, 66316,
+    66316, 66580, 66580, 66054, 66054, 66316, 66316, 66054, 66316, 66054, 65794, 66054,
+    66054, 66316, 65794, 66316, 66054, 66316, 66316, 66316, 66054, 66316, 66054, 66580,
+    66054, 66316, 66054, 66054, 66580, 66054, 66316, 66316, 66580, 66580, 66316, 66054,
+    66847, 66054, 65794, 66316, 66316, 66316, 66054, 66316, 66316, 66316, 66316, 66580,
+    65794, 67934, 117688, 131588, 133693, 132632, 132632, 133693, 132632, 132632, 131588, 132632,
+    132632, 132632, 132632, 132632, 132632, 131588, 131588, 131588, 132632, 118523, 66580, 66316,
+    66847, 66580, 66316, 66316, 66316, 66847, 66580, 66054, 66316, 66847, 66316, 66316,
+    66316, 66316, 66054, 66316, 66316, 66316, 66054, 66580, 66580, 66316, 66316, 66316,
+    66316, 66316, 66054, 66054, 66054, 66316, 66316, 66580, 66847, 66316, 66316, 66580,
+    66054, 66580, 66054, 66847, 66054, 66316, 66316, 66316, 66054, 66316, 66316, 66580,
+    66316, 66580, 66316, 66054, 66580, 66316, 66316, 66316, 66580, 66580, 66580, 66316,
+    66580, 66580, 66054, 66054, 66054, 66580, 66316, 66316, 66316, 66316, 66580, 66316,
+    66054, 66054, 75618, 132632, 132632, 133693, 132632, 133693, 132632, 133693, 131588, 132632,
+    132632, 132632, 132632, 132632, 132632, 132632, 131588, 132632, 132632, 78459, 66054, 66054,
+    66054, 66054, 66580, 66580, 66054, 66580, 65794, 66316, 66054, 66316, 66054, 66054,
+    66580, 66054, 65794, 66054, 66054, 66580, 66316, 66316, 66316, 66316, 66316, 66316,
+    66054, 66316, 66054, 66316, 66054, 66054, 66054, 66316, 66580, 66316, 66580, 65794,
+    66316, 66847, 66316, 66316, 66316, 66316, 66316, 66316, 66580, 66580, 65794, 66316,
+    66054, 65794, 66316, 66580, 66847, 66580, 66580, 66316, 66316, 66580, 66316, 66316,
+    66316, 66054, 66316, 66316, 66316, 66580, 66054, 66054, 66316, 66316, 65536, 66054,
+    65794, 66054, 65794, 100673, 131588, 131588, 131588, 131588, 132632, 133693, 131588, 132632,
+    132632, 132632, 132632, 132632, 132632, 132632, 131588, 132632, 96599, 66580, 66316, 66316,
+    66316, 66847, 66580, 66580, 66316, 66316, 66580, 66316, 66316, 66580, 66316, 66316,
+    66054, 66316, 66316, 66316, 66316, 66316, 66316, 66580, 66580, 66580, 66054, 66054,
+    66054, 65794, 66316, 66580, 66316, 66316, 66580, 66580, 66316, 66054, 66054, 66054,
+    66316, 66847, 66316, 66316, 66054, 66054, 66316, 66580, 66580, 66580, 66054, 66054,
+    65794, 66054, 66580, 66316, 66580, 66847, 66580, 66054, 66316, 66580, 66316, 66580,
+    66316, 66054, 66316, 66847, 66580, 66580, 66054, 66054, 66316, 66316, 66580, 66316,
+    66054, 66054, 66054, 70217, 123790, 131588, 131588, 131588, 131588, 132632, 132632, 132632,
+    133693, 133693, 132632, 132632, 132632, 132632, 132632, 132632, 70217, 66316, 66316, 66316,
+    65794, 66580, 66054, 66316, 66316, 66847, 66316, 66316, 66054, 66580, 66316, 66847,
+    66316, 66054, 66316, 66316, 66316, 66580, 66316, 66316, 66580, 66580, 66580, 66054,
+    65794, 65794, 66316, 66316, 66316, 66316, 66316, 66316, 66316, 66316, 66054, 66054,
+    66054, 66580, 66580, 66580, 66054, 66316, 66580, 66580, 66316, 66847, 66316, 66316,
+    66580, 66580, 66316, 66054, 66316, 66054, 66054, 66580, 66054, 66316, 66054, 66054,
+    65794, 66316, 66316, 66316, 66054, 66316, 66316, 66316, 66580, 66316, 66316, 66580,
+    66316, 66316, 66316, 66316, 87956, 131588, 131588, 131588, 131588, 131588, 132632, 133693,
+    132632, 132632, 132632, 132632, 133693, 132632, 132632, 96599, 66580, 66580, 66580, 66316,
+    66316, 66847, 66316, 66316, 66054, 66316, 66054, 66316, 66054, 66316, 65794, 66054,
+    66054, 66054, 66316, 66316, 66054, 66316, 66847, 66316, 66316, 66316, 66316, 66316,
+    66316, 66316, 66316, 66316, 66316, 66316, 66316, 66316, 66580, 66316, 66580, 66580,
+    66316, 66316, 66316, 66316, 66316, 66316, 66580, 66316, 66580, 66580, 66054, 66580,
+    66316, 66580, 66054, 66580, 66054, 66054, 65536, 66054, 66054, 66316, 66054, 66580,
+    66054, 66054, 66316, 66316, 66054, 66580, 66316, 66316, 66316, 66316, 66847, 66580,
+    66316, 66580, 66580, 66580, 67934, 124714, 131588, 131588, 133693, 132632, 131588, 132632,
+    133693, 132632, 132632, 132632, 132632, 132632, 117688, 70812, 66316, 66316, 66847, 66580,
+    66580, 66316, 66316, 66316, 66054, 66316, 66316, 66580, 66054, 66054, 66847, 66316,
+    66580, 66847, 66316, 66316, 66316, 66316, 66316, 66054, 66316, 66316, 66316, 66316,
+    66580, 66316, 66316, 66316, 66316, 66316, 66316, 66316, 66054, 66316, 66580, 66580,
+    66316, 66316, 66316, 66580, 66054, 66316, 66316, 66580, 66316, 66054, 66316, 66316,
+    66054, 66316, 65794, 66054, 66054, 66054, 65536, 66316, 66316, 66316, 65536, 66054,
+    66054, 66054, 66054, 66054, 65794, 66054, 66054, 66316, 66316, 66580, 66580, 66580,
+    66580, 66580, 66316, 66316, 66054, 87956, 132632, 132632, 132632, 132632, 131588, 132632,
+    132632, 132632, 131588, 132632, 132632, 132632, 87956, 66316, 66847, 66847, 66580, 66316,
+    66580, 66316, 66054, 66054, 66316, 66316, 66054, 66847, 66316, 66316, 66316, 66054,
+    66316, 66316, 66316, 66580, 66316, 66316, 66316, 66316, 66580, 66580, 66316, 66316,
+    66580, 66316, 66316, 66316, 66580, 66580, 66316, 66316, 66580, 66316, 65794, 66054,
+    66316, 66316, 66316, 66580, 66316, 66316, 66316, 66316, 66316, 66847, 66054, 66054,
+    66054, 65794, 65794, 65794, 66316, 65794, 65794, 66054, 66054, 66316, 66316, 65794,
+    66316, 66316, 66580, 66054, 65794, 66054, 66054, 66316, 66316, 66580, 66580, 66580,
+    66847, 66580, 66316, 66580, 66054, 68211, 124714, 132632, 132632, 132632, 131588, 132632,
+    132632, 132632, 131588, 131588, 132632, 132632, 70812, 66054, 66580, 66847, 66580, 66316,
+    66316, 66316, 66316, 66054, 66054, 66316, 66580, 66580, 66316, 66847, 65794, 66316,
+    66580, 66316, 66580, 66316, 66316, 66316, 66316, 66580, 66580, 66580, 66580, 66316,
+    66580, 66054, 66316, 66316, 66316, 66580, 66054, 66316, 66316, 66580, 66054, 66054,
+    66316, 66316, 66316, 66054, 66580, 66316, 66316, 66316, 66580, 66054, 66054, 65794,
+    66054, 66054, 66054, 66054, 66054, 66580, 66054, 65794, 65794, 66316, 66316, 66054,
+    66054, 66316, 66316, 66580, 66054, 66054, 66054, 66054, 66316, 66316, 66580, 66580,
+    66580, 66580, 66316, 66316, 66054, 66054, 88422, 132632, 131588, 132632, 131588, 132632,
+    132632, 131588, 132632, 131588, 132632, 96599, 66580, 66580, 66316, 66580, 66316, 66316,
+    66580, 66580, 66580, 66316, 66054, 66316, 66054, 65794, 65794, 66316, 65794, 66054,
+    66580, 66054, 66054, 66580, 66316, 66580, 66316, 66580, 66580, 66316, 66580, 66580,
+    66316, 66316, 66316, 66316, 66316, 66847, 66316, 66316, 66316, 66316, 65794, 66054,
+    66580, 66316, 66316, 66316, 66054, 66316, 66316, 66580, 67115, 66316, 66316, 66316,
+    65536, 66054, 66316, 65536, 66054, 66580, 66054, 65794, 66316, 66847, 66580, 66054,
+    66316, 66054, 65536, 66054, 66316, 66054, 65794, 66054, 66316, 66316, 66580, 66580,
+    66580, 66580, 66316, 66054, 66054, 66054, 70513, 132632, 132632, 132632, 132632, 132632,
+    132632, 132632, 132632, 132632, 132632, 70513, 66316, 66580, 66580, 66580, 66847, 66316,
+    66316, 66847, 66316, 66316, 66316, 65794, 65794, 66054, 66580, 66054, 66054, 65794,
+    65794, 66580, 66054, 66580, 66580, 66316, 66316, 66316, 66580, 66316, 66580, 66580,
+    66580, 66316, 66580, 66316, 66316, 66580, 66316, 66316, 66316, 66316, 66054, 66054,
+    66316, 66316, 66054, 66316, 66316, 66054, 65794, 66316, 66316, 66316, 66316, 66316,
+    65794, 65794, 66316, 66054, 66054, 66054, 65794, 66054, 66316, 66316, 66054, 66054,
+    66316, 66316, 65794, 65794, 66316, 66054, 65536, 66054, 66054, 66316, 66316, 66316,
+    66316, 66316, 66316, 66316, 66316, 66316, 66054, 105770, 131588, 131588, 132632, 132632,
+    132632, 132632, 131588, 132632, 100673, 66580, 66316, 66580, 66580, 66580, 66580, 66580,
+    66847, 66847, 66580, 66580, 65794, 66316, 66054, 66316, 66054, 66054, 65794, 66316,
+    66054, 66316, 66316, 66054, 66316, 66316, 66580, 66580, 66054, 66316, 66580, 66316,
+    66316, 66316, 66316, 66316, 66316, 66580, 66316, 66316, 66316, 66316, 65794, 66054,
+    66316, 66316, 66580, 66316, 66316, 66316, 66316, 66316, 66316, 66316, 66580, 66580,
+    66054, 66054, 66054, 66316, 65794, 66054, 66054, 66316, 66580, 66316, 66316, 66316,
+    66316, 66316, 66054, 66054, 65794, 66054, 65794, 66054, 66316, 66054, 66054, 66316,
+    66316, 66316, 66316, 66316, 66580, 66580, 66054, 74940, 131588, 131588, 132632, 132632,
+    132632, 133693, 131588, 132632, 78092, 66316, 66316, 66054, 66054, 66580, 66847, 65794,
+    66316, 66316, 66316, 66316, 66847, 66580, 65794, 66054, 65536, 65794, 66054, 66316,
+    66054, 66580, 65536, 66054, 66316, 66580, 66316, 66316, 66316, 66054, 66316, 66316,
+    66316, 66316, 66316, 66316, 66316, 66316, 66316, 66316, 66316, 66316, 66316, 66316,
+    66316, 66316, 66054, 66054, 66054, 66580, 66847, 66316, 66054, 66054, 66316, 66316,
+    66054, 65794, 66054, 66316, 65794, 66054, 66054, 66054, 66054, 66054, 66054, 66316,
+    66054, 66316, 66054, 66054, 66054, 66054, 66054, 66054, 66580, 66316, 66580, 66580,
+    66580, 66580, 66316, 66316, 66054, 66847, 66316, 66316, 124714, 132632, 132632, 132632,
+    132632, 133693, 132632, 117688, 66580, 66316, 66316, 66316, 66316, 66580, 66316, 66316,
+    66316, 66316, 66316, 66316, 66847, 66580, 65794, 65794, 66054, 66054, 65794, 66054,
+    65794, 66054, 66316, 66316, 66054, 66054, 66316, 66054, 66316, 66580, 66316, 66316,
+    66316, 66054, 66054, 66316, 66054, 66054, 66054, 65794, 66316, 66054, 66054, 66054,
+    66316, 66847, 66054, 66580, 66580, 66847, 66847, 66580, 66316, 66580, 66316, 66316,
+    66054, 66054, 66054, 66316, 65536, 66316, 66316, 65794, 65794, 66054, 66580, 66054,
+    66316, 66054, 65794, 66054, 66316, 65794, 65794, 65794, 66316, 66316, 66316, 66580,
+    66580, 66580, 66316, 66847, 66316, 66316, 66316, 66054, 92330, 132632, 132632, 132632,
+    132632, 132632, 132632, 96599, 66580, 66580, 66316, 66316, 66847, 66580, 66580, 66316,
+    66316, 66316, 66316, 66054, 66580, 66580, 66054, 66054, 66054, 66580, 66054, 66316,
+    66054, 65794, 66316, 66847, 66580, 66580, 66054, 66054, 66316, 66580, 66580, 66316,
+    66580, 66580, 66054, 66847, 66054, 66316, 66316, 66316, 66054, 66054, 66054, 66054,
+    66580, 66580, 66316, 66580, 66316, 66316, 66580, 66580, 66580, 66580, 66316, 66316,
+    66054, 66316, 65794, 66054, 65794, 66054, 66054, 66054, 66316, 66054, 66054, 66580,
+    66316, 66054, 65536, 66054, 66054, 66054, 66054, 66054, 65794, 66316, 66580, 66580,
+    66054, 66054, 66316, 66054, 66316, 66316, 66316, 66316, 75618, 132632, 132632, 132632,
+    131588, 132632, 131588, 75618, 66054, 66580, 66054, 66316, 66580, 66316, 66580, 66580,
+    66580, 66580, 66316, 66054, 66054, 66316, 65794, 65794, 65794, 66054, 66054, 66054,
+    66054, 66316, 66054, 66316, 66054, 66054, 65794, 66054, 66847, 65794, 65794, 65536,
+    65794, 65794, 65794, 66054, 65536, 66054, 65794, 65794, 66316, 66580, 66054, 66054,
+    66316, 66316, 66316, 66316, 66054, 66580, 66580, 66580, 66580, 66580, 66316, 66847,
+    66316, 66580, 66054, 66316, 66316, 66054, 65536, 65794, 66580, 66316, 65536, 66054,
+    66316, 65794, 66054, 66054, 66054, 66316, 66054, 66054, 66054, 65794, 66054, 66580,
+    65794, 66316, 66054, 66316, 66316, 66054, 66316, 66316, 66054, 124714, 131588, 132632,
+    132632, 132632, 117688, 66054, 66316, 66316, 66316, 66316, 66580, 66580, 66847, 66580,
+    66580, 66580, 65794, 65794, 66316, 66054, 66054, 66054, 65794, 66054, 65794, 65536,
+    65536, 66316, 66054, 66054, 65794, 66054, 66054, 66054, 66054, 66316, 65794, 65794,
+    66054, 66316, 65536, 66054, 65794, 65794, 66054, 66316, 66316, 66054, 66316, 66054,
+    66580, 66580, 66316, 66316, 66316, 66316, 66316, 66316, 66054, 66316, 66316, 66316,
+    66580, 66316, 66316, 66316, 66316, 66054, 66054, 66847, 66054, 66316, 66054, 66054,
+    66054, 66316, 66054, 66054, 66054, 65794, 66316, 66580, 66316, 66054, 65536, 66054,
+    66054, 66316, 66316, 66316, 66316, 66580, 66316, 66316, 66054, 96599, 132632, 132632,
+    132632, 132632, 95495, 66054, 66316, 66847, 66580, 66054, 66580, 66580, 66316, 66580,
+    66847, 66054, 66054, 66054, 66316, 66316, 66847, 66580, 65794, 66580, 66054, 66054,
+    66316, 66580, 66847, 66316, 66054, 66847, 66054, 66054, 65794, 66054, 66054, 66054,
+    66054, 66054, 66054, 66054, 66054, 66316, 66054, 66316, 66054, 66054, 66054, 66316,
+    66316, 66580, 66054, 66316, 66054, 66316, 66054, 66054, 66316, 66054, 66316, 66580,
+    66054, 66580, 66580, 66316, 66316, 65536, 65794, 66316, 66054, 65794, 65536, 66054,
+    66054, 66054, 66054, 66054, 65794, 66316, 66316, 66316, 66316, 66054, 66054, 65794,
+    66316, 66316, 66316, 66054, 66316, 66580, 66316, 66316, 66316, 81125, 132632, 132632,
+    132632, 132632, 78459, 66316, 66580, 66580, 66316, 66054, 66316, 66580, 66580, 66580,
+    66316, 66316, 66580, 66580, 66054, 66054, 66580, 66316, 65794, 66316, 66054, 66054,
+    66316, 66054, 66316, 66316, 65794, 66054, 65794, 66054, 66054, 66054, 65794, 66054,
+    66054, 65794, 66054, 66054, 66054, 66054, 65794, 65794, 66054, 66054, 65794, 66054,
+    66054, 66316, 66316, 66054, 66054, 66580, 66316, 66316, 66316, 66316, 66580, 66316,
+    66580, 66316, 66316, 66316, 66580, 66316, 66316, 66054, 66316, 65794, 66054, 66316,
+    66054, 66054, 66316, 66316, 66316, 66316, 66316, 66316, 66316, 66580, 66316, 66316,
+    66316, 66316, 66580, 66580, 66316, 66316, 66316, 66054, 66054, 67934, 131588, 132632,
+    132632, 132632, 70217, 66580, 66580, 66580, 66316, 66580, 66054, 66580, 66316, 66054,
+    66316, 66316, 66316, 66316, 66054, 66054, 66054, 66054, 65794, 66054, 66316, 65794,
+    65794, 65794, 65536, 65794, 66054, 66054, 66316, 66054, 66054, 65794, 66054, 66316,
+    66316, 66316, 66316, 66316, 66054, 65794, 66054, 66580, 65794, 66054, 65536, 66054,
+    66316, 66316, 66316, 66316, 66054, 66316, 66316, 66580, 66054, 66316, 66580, 66316,
+    66316, 66847, 66054, 66316, 66054, 66316, 65536, 66054, 65794, 66054, 66316, 66054,
+    66054, 66054, 66054, 66316, 66054, 66316, 66580, 66054, 65794, 66316, 66580, 66580,
+    66054, 66316, 66580, 66580, 66316, 66580, 66316, 66316, 66054, 66316, 84402, 116865,
+    124714, 84831, 66316, 66580, 66580, 66316, 66054, 65794, 66316, 66316, 66054, 66580,
+    66316, 66054, 66580, 66316, 66316, 66054, 66054, 66054, 66054, 66054, 65794, 66316,
+    66316, 65794, 66054, 66054, 65794, 66054, 66316, 66580, 65794, 65794, 66054, 66316,
+    66316, 66316, 66316, 66316, 65794, 65794, 66580, 66316, 65794, 66054, 66054, 66054,
+};
+
+inline constexpr int32_t blend_remove_offset_96[96 * 96] = {
+    -233554, -166181, -233554, -166181, -166181, -166181, -166181, -233554, 32768, -166181, -166181, -233554,
+    -166181, -99340, -301466, -99340, -99340, -99340, 32768, -99340, -33026, -33026, -33026, -33026,
+    -166181, -99340, -166181, -233554, -99340, -166181, -166181, -166181, -166181, -166181, -166181, -99340,
+    -166181, -99340, 32768, -33026, -33026, -33026, -33026, -33026, -99340, -99340, -4778171, -15057632,
+    -13265965, -4997789, -33026, -166181, 32768, -99340, -33026, -99340, -233554, -233554, -99340, -233554,
+    -166181, -166181, -233554, -166181, -166181, -166181, -99340, -233554, -233554, -233554, -99340, -166181,
+    -33026, -166181, -99340, -99340, -33026, -99340, -166181, -166181, -99340, -166181, -166181, -233554,
+    -166181, -166181, -233554, -233554, -166181, -166181, -166181, -166181, -233554, -301466, -233554, -233554,
+    -166181, -233554, -99340, -166181, -33026, -166181, -166181, -233554, -99340, -99340, -166181, -166181,
+    -33026, -99340, -233554, -166181, -99340, -99340, -33026, -33026, 32768, -33026, 32768, 32768,
+    -99340, -99340, -166181, -166181, -33026, -166181, -166181, -99340, -166181, -301466, -166181, -166181,
+    -33026, 32768, 32768, 32768, -33026, 32768, 32768, 32768, -99340, -1086006, -16810502, -16810502,
+    -17076811, -17076811, -578635, -99340, 32768, -33026, -99340, -99340, -99340, -166181, -166181, -99340,
+    -99340, -99340, -166181, -233554, -166181, -166181, -33026, -33026, -99340, -99340, -99340, -33026,
+    -99340, 32768, -99340, 32768, -33026, -33026, -233554, -233554, -166181, -166181, -166181, -166181,
+    -99340, -166181, -233554, -166181, -166181, -166181, -369923, -301466, -233554, -301466, -233554, -301466,
+    -33026, 32768, -99340, -33026, -99340, -233554, -166181, -99340, 32768, -33026, -33026, -166181,
+    -33026, -33026, -33026, -33026, -99340, -99340, -33026, 32768, -33026, -33026, 32768, -33026,
+    -33026, -33026, 32768, -33026, -99340, -99340, -99340, -166181, -166181, -233554, -166181, -166181,
+    32768, -33026, 32768, -33026, 32768, 32768, -33026, -99340, -99340, -3169003, -16810502, -16810502,
+    -17076811, -16810502, -3942341, 32768, 32768, -33026, -99340, -33026, 32768, 32768, -33026, -33026,
+    -99340, -301466, -233554, -166181, -233554, -233554, -99340, 32768, -33026, -99340, -99340, -166181,
+    -233554, -233554, -99340, -166181, -301466, -166181, -99340, -99340, -233554, -233554, -166181, -166181,
+    -166181, -233554, -233554, -233554, -166181, -99340, -233554, -166181, -233554, -233554, -166181, -166181,
+    32768, -33026, -33026, -99340, -99340, -301466, -99340, -166181, 32768, -33026, -99340, -99340,
+    32768, 32768, 32768, -99340, -99340, -33026, 32768, -33026, 32768, -33026, -33026, 32768,
+    -33026, -99340, -33026, -33026, 32768, -33026, -233554, -166181, -99340, -233554, -33026, -99340,
+    32768, -33026, 32768, 32768, 32768, -33026, -99340, -99340, -166181, -7888376, -16810502, -16810502,
+    -17076811, -17076811, -7606858, -33026, -33026, -33026, -33026, -33026, 32768, 32768, -33026, -99340,
+    -233554, -233554, -166181, -99340, -166181, -233554, -233554, -99340, -99340, -166181, -99340, -166181,
+    -233554, -233554, -233554, -233554, -166181, -233554, -99340, -166181, -233554, -301466, -233554, -99340,
+    -33026, -166181, -166181, -301466, -233554, -166181, -233554, -166181, -301466, -233554, -166181, -166181,
+    32768, 32768, -33026, -166181, -301466, -233554, -233554, -166181, -33026, -99340, -33026, -33026,
+    32768, 32768, -166181, -33026, -166181, -166181, 32768, -99340, -33026, -33026, 32768, -99340,
+    32768, -33026, 32768, 32768, 32768, -99340, -233554, -166181, -99340, -99340, -166181, -99340,
+    -99340, -33026, -233554, -166181, 32768, -33026, 32768, -33026, -166181, -13478805, -16810502, -16810502,
+    -16810502, -16810502, -15057632, -99340, -166181, -33026, -99340, -166181, -33026, -99340, -166181, -166181,
+    -233554, -233554, -233554, -166181, -233554, -233554, -166181, -99340, -33026, -33026, -166181, -233554,
+    -301466, -233554, -233554, -233554, -233554, -233554, -233554, -166181, -166181, -166181, -33026, 32768,
+    -166181, -99340, -166181, -233554, -166181, -166181, -99340, -301466, -233554, -301466, -233554, -166181,
+    -33026, 32768, -166181, -166181, -166181, -233554, -233554, -233554, -166181, -99340, -233554, -233554,
+    32768, -33026, -33026, -33026, -99340, -166181, -99340, -33026, 32768, -99340, -99340, -33026,
+    -33026, -33026, -33026, 32768, -33026, -99340, -233554, -233554, -233554, -233554, -33026, -233554,
+    -301466, -99340, -233554, 32768, -99340, -233554, -99340, -99340, -2451401, -17076811, -16810502, -16810502,
+    -16810502, -16810502, -16810502, -2538260, -99340, -99340, -99340, -166181, -166181, -99340, -33026, -99340,
+    -166181, -233554, -166181, -166181, -166181, -233554, -166181, -99340, -99340, -33026, -166181, -166181,
+    -166181, -233554, -233554, -233554, -301466, -166181, -99340, -166181, -233554, -233554, -99340, -33026,
+    -166181, -233554, -166181, -166181, -166181, -166181, -233554, -233554, -166181, -233554, -166181, -166181,
+    -33026, -99340, -33026, -33026, -233554, -233554, -166181, -166181, -233554, -166181, 32768, -33026,
+    32768, -99340, -99340, -33026, -33026, -166181, -33026, -33026, -99340, -166181, -166181, -166181,
+    -166181, -99340, 32768, -33026, -99340, -166181, -99340, -99340, -99340, -166181, -99340, -33026,
+    -233554, -99340, -33026, -99340, -33026, -99340, -99340, -99340, -7888376, -17076811, -16810502, -16810502,
+    -16810502, -17076811, -16810502, -6670269, -99340, -99340, -99340, -99340, -233554, -166181, -99340, -33026,
+    -99340, -99340, -166181, -166181, -301466, -166181, -233554, -99340, -99340, -166181, -99340, -166181,
+    -166181, -166181, -166181, -233554, -166181, -99340, -99340, -166181, -166181, -166181, -99340, -166181,
+    -99340, -166181, -369923, -301466, -233554, -233554, -166181, -166181, -166181, -233554, -166181, -166181,
+    -33026, -166181, -99340, -99340, -166181, -166181, -99340, -233554, -233554, -99340, -99340, -33026,
+    -99340, -166181, -233554, -33026, -33026, 32768, -99340, -166181, -166181, -166181, -33026, -99340,
+    -166181, 32768, -99340, -99340, -99340, -99340, -33026, -33026, -166181, -33026, -33026, -33026,
+    32768, -33026, -33026, -33026, -33026, -99340, -99340, -33026, -13265965, -17076811, -16810502, -16810502,
+    -17076811, -16810502, -16810502, -15057632, -99340, -99340, -99340, -99340, -233554, -166181, -166181, -233554,
+    -166181, -99340, -166181, -99340, -166181, -166181, -33026, -99340, -99340, -99340, -99340, -33026,
+    -166181, -233554, -166181, -166181, -233554, -99340, -33026, -166181, -166181, -99340, -166181, -233554,
+    -166181, -233554, -166181, -301466, -301466, -233554, -233554, -233554, -166181, -233554, -166181, -166181,
+    -166181, -99340, -99340, -99340, -33026, -99340, -233554, -166181, -33026, -166181, -99340, -166181,
+    -99340, -99340, -233554, -33026, -33026, -99340, -166181, -233554, -33026, -99340, -99340, -99340,
+    -99340, 32768, -99340, -99340, -99340, -166181, -99340, -166181, -233554, -166181, -99340, -33026,
+    -33026, -33026, -99340, -33026, -233554, -166181, -166181, -3262493, -16810502, -17076811, -16810502, -16810502,
+    -17076811, -17076811, -16810502, -16810502, -2451401, -166181, -99340, -33026, -166181, -166181, -99340, -166181,
+    -166181, -166181, -166181, -166181, -99340, -166181, -99340, -33026, -33026, -33026, -33026, -166181,
+    -166181, -99340, -233554, -99340, -33026, 32768, -33026, -33026, -233554, -166181, -166181, -233554,
+    -166181, -99340, -233554, -301466, -233554, -99340, -99340, -233554, -233554, -301466, -233554, -233554,
+    -33026, -166181, -33026, -33026, 32768, -33026, -166181, -99340, -33026, -166181, -33026, -99340,
+    -99340, -166181, -99340, -99340, -33026, -99340, -166181, -233554, -99340, -166181, 32768, -33026,
+    32768, -99340, -99340, -99340, -99340, -99340, -99340, -99340, -166181, -166181, -33026, -33026,
+    32768, -33026, -33026, -33026, -99340, -166181, -166181, -8927109, -17076811, -16810502, -16810502, -16810502,
+    -17076811, -17076811, -16810502, -16810502, -10226936, -99340, 32768, -33026, -166181, -233554, -233554, -166181,
+    -166181, -166181, -99340, -99340, -166181, -99340, -33026, -33026, 32768, -99340, -99340, -166181,
+    -99340, -166181, -99340, -233554, 32768, -33026, -99340, -99340, -166181, -233554, -233554, -233554,
+    -233554, -233554, -301466, -233554, -99340, -233554, -166181, -166181, -166181, -369923, -233554, -233554,
+    -166181, -99340, -233554, -166181, -33026, -33026, -33026, -33026, -166181, -166181, -99340, -99340,
+    -33026, -33026, -33026, -99340, -166181, -166181, -99340, -233554, -33026, -33026, -33026, -33026,
+    -33026, -166181, -99340, -233554, -99340, -99340, -33026, -233554, -166181, -166181, -33026, -33026,
+    32768, -33026, 32768, -33026, -99340, -233554, -1160923, -16810502, -16810502, -16810502, -16810502, -16810502,
+    -16810502, -17076811, -16810502, -16810502, -16810502, -1160923, -33026, -99340, -99340, -99340, -166181, -33026,
+    -99340, -99340, -99340, -33026, -33026, -33026, -33026, -166181, -33026, -33026, -33026, -99340,
+    -99340, -33026, -99340, -99340, -99340, -233554, -233554, -166181, -166181, -166181, -166181, -99340,
+    -233554, -233554, -166181, -99340, -166181, -166181, -166181, -233554, -99340, -166181, -99340, -166181,
+    -166181, -99340, -166181, -166181, -33026, -33026, -33026, -33026, -99340, -166181, -33026, -99340,
+    -99340, -33026, -33026, -99340, -166181, -166181, -99340, -99340, -33026, -166181, -33026, 32768,
+    -99340, -233554, -166181, -166181, -99340, -99340, -166181, -166181, -99340, -166181, -33026, -99340,
+    -33026, -33026, -33026, -33026, -99340, -166181, -7606858, -16810502, -16810502, -16810502, -16810502, -17076811,
+    -16810502, -17076811, -16810502, -16810502, -16810502, -5803057, -99340, -99340, -33026, 32768, -99340, -233554,
+    -166181, -233554, -99340, -99340, -99340, -99340, -33026, -99340, -33026, -33026, -166181, -99340,
+    -99340, -166181, 32768, -99340, -33026, -233554, -233554, -233554, -166181, -166181, -99340, -99340,
+    -166181, -233554, -33026, -166181, -33026, -166181, -99340, -166181, -166181, -166181, -233554, -301466,
+    -33026, -33026, -33026, -99340, 32768, -33026, -99340, -99340, -99340, 32768, 32768, -33026,
+    -99340, -166181, 32768, -99340, -33026, -99340, -33026, 32768, -166181, -166181, -166181, 32768,
+    32768, -33026, -166181, -99340, -166181, -166181, -166181, -99340, 32768, -33026, -99340, -33026,
+    -99340, 32768, 32768, -99340, 32768, -1160923, -17076811, -17076811, -16810502, -16810502, -16810502, -16810502,
+    -16810502, -17076811, -16810502, -16810502, -16810502, -15057632, -508501, -33026, -33026, -99340, -99340, -99340,
+    -99340, -99340, -99340, -33026, 32768, -166181, -99340, -33026, -99340, -33026, -233554, -166181,
+    -166181, -99340, -33026, -99340, -33026, -233554, -166181, -99340, -99340, -99340, -166181, -166181,
+    -99340, -233554, -233554, -233554, -166181, -233554, -233554, -369923, -166181, -166181, -166181, -166181,
+    -33026, -99340, 32768, -99340, -33026, 32768, -99340, -166181, -99340, -33026, 32768, -99340,
+    -166181, -166181, -99340, -99340, -99340, -99340, -33026, -99340, -99340, -166181, 32768, 32768,
+    -33026, -99340, -166181, -99340, -166181, -99340, -166181, -166181, -99340, -33026, -33026, -33026,
+    32768, -99340, -33026, -99340, -166181, -5684386, -16810502, -17076811, -16810502, -16810502, -16810502, -16810502,
+    -17076811, -17076811, -17076811, -16810502, -16810502, -16810502, -5684386, -99340, -99340, -99340, -33026, -233554,
+    -233554, -233554, -99340, -33026, -33026, -99340, -166181, -33026, -33026, -99340, -233554, -166181,
+    -233554, -166181, -99340, -33026, -33026, -33026, -99340, -99340, -166181, -166181, -166181, -166181,
+    -99340, -166181, -166181, -166181, -99340, -233554, -233554, -301466, -233554, -166181, -166181, -166181,
+    -99340, -33026, -33026, -33026, -166181, -233554, -33026, -33026, -33026, -99340, -33026, -99340,
+    -166181, -233554, -99340, -33026, -99340, -99340, -99340, -33026, -166181, -233554, 32768, 32768,
+    -33026, -99340, -166181, -166181, -166181, -233554, -166181, -166181, 32768, -33026, 32768, -33026,
+    32768, 32768, -233554, -233554, -1236474, -13265965, -17076811, -17076811, -16810502, -16810502, -16810502, -17076811,
+    -17076811, -17076811, -17347381, -17076811, -17076811, -16810502, -15057632, -578635, -99340, -301466, -233554, -233554,
+    -166181, -99340, -233554, -233554, -99340, -166181, -99340, -233554, -33026, -166181, -233554, -233554,
+    -233554, -99340, -99340, -99340, -99340, -166181, -166181, -166181, -233554, -233554, -166181, -166181,
+    -233554, -233554, -301466, -233554, -301466, -369923, -233554, -99340, -233554, -233554, -166181, -166181,
+    -99340, -166181, -99340, -99340, -166181, -301466, -166181, -33026, -99340, -33026, -33026, 32768,
+    -99340, -33026, -99340, -33026, -166181, -166181, -99340, -99340, -166181, -99340, -99340, -33026,
+    -99340, -99340, -166181, -33026, -99340, -233554, -233554, -166181, -99340, -33026, -33026, -99340,
+    -99340, -99340, -166181, -233554, -7888376, -17076811, -17076811, -17076811, -16810502, -16810502, -17076811, -17076811,
+    -17076811, -17347381, -16810502, -17076811, -17076811, -17076811, -17076811, -5803057, -166181, -33026, -166181, -233554,
+    -99340, -166181, -369923, -166181, -99340, -33026, -33026, -99340, -166181, -233554, -166181, -233554,
+    -233554, -99340, -99340, -33026, -166181, -166181, -166181, -233554, -166181, -233554, -166181, -233554,
+    -301466, -369923, -166181, -233554, -99340, -301466, -166181, -233554, -166181, -301466, -166181, -166181,
+    -166181, -166181, -99340, -166181, -166181, -166181, -301466, -166181, -99340, -99340, 32768, -33026,
+    -99340, -33026, -233554, -233554, -166181, -166181, -99340, -166181, -33026, -99340, -33026, -166181,
+    -166181, -99340, -166181, -99340, -33026, -166181, -233554, -301466, -99340, -166181, -99340, -166181,
+    -33026, -99340, -166181, -1236474, -17076811, -17076811, -17076811, -17076811, -17076811, -17076811, -16810502, -16810502,
+    -16810502, -16810502, -16810502, -17076811, -17076811, -17076811, -16810502, -15057632, -1160923, -166181, -166181, -99340,
+    -166181, -166181, -166181, -233554, -166181, -99340, -33026, -233554, -99340, -166181, -166181, -166181,
+    -99340, -99340, -33026, -99340, -99340, -166181, -233554, -99340, -33026, -166181, -166181, -166181,
+    -166181, -166181, -166181, -233554, -166181, -166181, -166181, -166181, -99340, -166181, -166181, -33026,
+    -99340, -166181, -166181, -166181, -301466, -233554, -166181, -233554, -99340, -99340, -33026, -33026,
+    -99340, -33026, -233554, -233554, -233554, -233554, 32768, -99340, -166181, -166181, -99340, -166181,
+    -33026, -99340, -33026, -33026, -99340, -166181, -33026, 32768, -99340, -233554, -233554, -166181,
+    -166181, -166181, -99340, -7888376, -17076811, -16810502, -17076811, -16810502, -16810502, -17076811, -17076811, -16810502,
+    -16810502, -16810502, -17076811, -17076811, -16810502, -17076811, -16810502, -16810502, -8927109, -233554, -99340, -99340,
+    -99340, -166181, -166181, -99340, -99340, -99340, -33026, -166181, -233554, -33026, 32768, -166181,
+    -33026, -33026, -99340, -166181, -166181, -233554, -233554, -166181, -99340, -166181, -99340, -166181,
+    -233554, -166181, -233554, -301466, -166181, -166181, -166181, -99340, -166181, -233554, -166181, -233554,
+    -99340, -166181, -233554, -166181, -99340, -99340, -166181, -166181, -233554, -99340, -33026, -33026,
+    32768, -99340, -166181, -301466, -233554, -166181, -33026, -166181, -33026, -33026, -99340, -166181,
+    -233554, -99340, -233554, -233554, -166181, -99340, -233554, -233554, -166181, -233554, -301466, -233554,
+    -233554, -166181, -3169003, -16810502, -17076811, -16810502, -16810502, -16810502, -16810502, -16810502, -17622315, -17076811,
+    -16810502, -16810502, -16810502, -17076811, -17076811, -17076811, -16810502, -16810502, -17076811, -2538260, -33026, -33026,
+    -99340, -233554, -99340, -33026, -99340, -99340, 32768, -99340, -99340, -99340, -99340, -99340,
+    -166181, -99340, -166181, -166181, -166181, -166181, -233554, -166181, -166181, -166181, -233554, -233554,
+    -166181, -99340, -99340, -99340, -233554, -166181, -99340, -166181, -99340, -166181, -233554, -99340,
+    -99340, -233554, -233554, -99340, -233554, -166181, -99340, -166181, -301466, -301466, -233554, -99340,
+    -33026, 32768, -166181, -233554, -233554, -166181, -33026, -99340, -99340, -33026, -99340, -166181,
+    -99340, -99340, -33026, -233554, -99340, -99340, 32768, -99340, -166181, -166181, -99340, -166181,
+    -166181, -166181, -13265965, -17076811, -16810502, -17076811, -16810502, -16810502, -16810502, -16810502, -17076811, -16810502,
+    -16810502, -16810502, -17076811, -17347381, -16810502, -17076811, -16810502, -16810502, -17076811, -13265965, -578635, -166181,
+    -166181, -166181, -99340, -99340, -33026, -33026, -33026, -99340, -166181, -166181, -99340, -99340,
+    -166181, -99340, -166181, -166181, -99340, -166181, -166181, -166181, -166181, -166181, -166181, -166181,
+    -233554, -99340, -99340, -166181, -99340, -166181, -301466, -166181, -166181, -166181, -99340, -99340,
+    -166181, -233554, -166181, -99340, -33026, -166181, -33026, -99340, -99340, -99340, -166181, -33026,
+    -99340, -99340, -99340, -166181, -166181, -99340, -99340, -166181, 32768, -99340, -166181, -233554,
+    -166181, -166181, -233554, -166181, -99340, -99340, -33026, -33026, -33026, -33026, -33026, -166181,
+    -233554, -5803057, -16810502, -17076811, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502,
+    -16810502, -17076811, -17076811, -17076811, -16810502, -17076811, -17076811, -17076811, -17076811, -16810502, -6670269, -99340,
+    -166181, -166181, -99340, -233554, -33026, -33026, -33026, -33026, -166181, -166181, -99340, -166181,
+    -99340, -166181, -99340, -166181, -166181, -166181, -33026, -233554, -233554, -233554, -99340, -233554,
+    -301466, -233554, -99340, -166181, -33026, -99340, -99340, -99340, -99340, -301466, -99340, -99340,
+    -233554, -233554, -99340, -166181, -99340, -166181, -33026, -99340, -33026, -99340, -99340, -99340,
+    -99340, -99340, -99340, -99340, -166181, -33026, -99340, -33026, -33026, -99340, -166181, -166181,
+    -99340, -233554, -166181, -99340, -99340, -99340, -33026, -33026, -99340, 32768, -166181, -233554,
+    -1946247, -17076811, -17076811, -17076811, -17076811, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -17076811,
+    -17076811, -17076811, -17076811, -17076811, -17076811, -16810502, -16810502, -16810502, -17347381, -17076811, -16810502, -2451401,
+    -166181, -166181, -233554, -233554, -99340, -33026, -166181, -166181, -166181, -233554, -166181, -233554,
+    -233554, -166181, -99340, -233554, -166181, -166181, -166181, -166181, -301466, -233554, -166181, -166181,
+    -166181, -166181, -166181, -99340, -99340, -99340, -99340, -233554, -233554, -233554, -233554, -99340,
+    -166181, -166181, -33026, -33026, -33026, -33026, -33026, -33026, -99340, -99340, -33026, 32768,
+    32768, 32768, -301466, -233554, -99340, -99340, -99340, -33026, -166181, -166181, -166181, -99340,
+    -233554, -166181, -33026, -33026, -99340, -166181, -301466, -166181, 32768, -33026, -99340, -1160923,
+    -13478805, -17076811, -16810502, -17076811, -17076811, -17076811, -16810502, -16810502, -16810502, -16810502, -16810502, -17076811,
+    -17076811, -17076811, -17347381, -17076811, -17076811, -16810502, -17076811, -17076811, -17076811, -17076811, -16810502, -13265965,
+    -720627, -233554, -301466, -301466, -166181, -99340, 32768, -99340, -166181, -166181, -166181, -166181,
+    -233554, -233554, -166181, -166181, -166181, -233554, -166181, -166181, -166181, -301466, -99340, -166181,
+    -99340, -166181, -166181, -233554, -166181, -166181, -166181, -233554, -99340, -166181, -99340, -33026,
+    -166181, -166181, 32768, 32768, 32768, -33026, 32768, 32768, 32768, -33026, 32768, 32768,
+    32768, -33026, -166181, -233554, -99340, -33026, -99340, -99340, -99340, -166181, -99340, -166181,
+    -233554, -166181, -166181, -99340, -99340, -166181, -99340, -166181, -99340, -99340, -99340, -7746808,
+    -16810502, -16810502, -16810502, -17076811, -17076811, -16810502, -16810502, -17076811, -16810502, -16810502, -17076811, -17076811,
+    -16810502, -17076811, -16810502, -16810502, -17076811, -16810502, -16810502, -17076811, -17076811, -17076811, -17076811, -17076811,
+    -8927109, -166181, -166181, -233554, -166181, -166181, -99340, -99340, -166181, -233554, -99340, -233554,
+    -166181, -301466, -233554, -166181, -233554, -301466, -301466, -166181, -99340, -233554, -166181, -166181,
+    -99340, -166181, -99340, -99340, -233554, -233554, -166181, -99340, -33026, -99340, -166181, -99340,
+    -166181, -166181, 32768, 32768, 32768, -33026, -166181, -166181, -33026, -99340, -33026, -33026,
+    32768, 32768, -33026, -99340, 32768, -99340, -166181, -99340, -99340, -33026, -99340, -166181,
+    -166181, -166181, -33026, -99340, -99340, -99340, -166181, -33026, -233554, -166181, -5803057, -17076811,
+    -16810502, -16810502, -16810502, -17076811, -17076811, -17076811, -16810502, -17076811, -17347381, -17076811, -17076811, -17076811,
+    -17076811, -16810502, -17076811, -16810502, -16810502, -17076811, -16810502, -16810502, -17076811, -17076811, -17076811, -17076811,
+    -16810502, -4778171, -99340, -33026, -233554, -233554, -33026, -166181, -233554, -99340, -166181, -33026,
+    -233554, -233554, -233554, -166181, -166181, -166181, -166181, -166181, -166181, -166181, -166181, -301466,
+    -99340, -166181, -166181, -99340, -166181, -166181, -166181, -233554, -99340, -166181, -99340, 32768,
+    -99340, -33026, -33026, 32768, 32768, -33026, -99340, -99340, -166181, -33026, 32768, 32768,
+    -33026, -33026, 32768, -33026, -33026, 32768, -166181, -166181, -99340, -99340, -99340, -166181,
+    -233554, -233554, -33026, -33026, -33026, -33026, -33026, -33026, -99340, -2625909, -17076811, -16810502,
+    -16810502, -16810502, -16810502, -16810502, -17076811, -17076811, -17076811, -17347381, -17076811, -17076811, -17076811, -17076811,
+    -16810502, -16810502, -16810502, -17076811, -16810502, -16810502, -16810502, -16810502, -16810502, -17076811, -17347381, -17076811,
+    -16810502, -16810502, -2365321, -33026, -233554, -233554, -99340, -99340, -233554, -33026, -99340, -301466,
+    -166181, -233554, -233554, -33026, -233554, -233554, -233554, -233554, -99340, -301466, -233554, -166181,
+    -233554, -301466, -166181, -233554, -233554, -233554, -166181, -166181, -33026, -166181, -33026, -99340,
+    -33026, -99340, -33026, -33026, -99340, -99340, -99340, -166181, -233554, -166181, -33026, 32768,
+    -33026, -33026, -99340, -33026, -99340, -166181, -33026, -33026, -33026, -33026, -33026, -99340,
+    -166181, -99340, -166181, -99340, -33026, 32768, -166181, -99340, -1160923, -15057632, -17076811, -16810502,
+    -16810502, -16810502, -16810502, -16810502, -17076811, -17076811, -16810502, -16810502, -17076811, -17076811, -17076811, -17076811,
+    -16810502, -17076811, -16810502, -16810502, -17076811, -17076811, -16810502, -16810502, -17076811, -16810502, -17076811, -16810502,
+    -16810502, -16810502, -14822061, -1236474, -99340, -233554, -99340, -99340, -99340, -99340, -33026, -99340,
+    -233554, -233554, -99340, -99340, -233554, -233554, -166181, -166181, -166181, -166181, -166181, -166181,
+    -99340, -99340, -166181, -33026, -166181, -166181, -99340, -233554, -166181, -166181, -301466, -166181,
+    -99340, -99340, 32768, -33026, -99340, -99340, -166181, -166181, -99340, -99340, -33026, -99340,
+    -99340, -33026, -33026, -33026, -99340, -166181, -99340, -99340, -33026, -99340, -33026, -166181,
+    -166181, -166181, 32768, -33026, -33026, -33026, -33026, -1086006, -13056102, -16810502, -16810502, -16810502,
+    -16810502, -16810502, -16810502, -16810502, -16810502, -17076811, -16810502, -16810502, -17076811, -17076811, -17076811, -16810502,
+    -17076811, -17076811, -16810502, -17076811, -17076811, -17076811, -16810502, -16810502, -16810502, -17076811, -16810502, -17076811,
+    -16810502, -16810502, -16810502, -13265965, -1160923, -166181, -33026, -33026, -233554, -166181, -99340, -99340,
+    -33026, -166181, -33026, -99340, -166181, -233554, -301466, -166181, -166181, -233554, -99340, -233554,
+    -166181, -166181, -166181, -233554, -166181, -99340, -166181, -166181, -166181, -166181, -233554, -99340,
+    -166181, -99340, -33026, -33026, -99340, -233554, -99340, -166181, -99340, -233554, -99340, -99340,
+    -33026, -33026, -33026, -99340, -233554, -166181, -166181, -99340, 32768, -33026, -166181, -33026,
+    -166181, -33026, 32768, -33026, -99340, -166181, -1236474, -13265965, -16810502, -16810502, -16810502, -16810502,
+    -16810502, -16810502, -16810502, -16810502, -17076811, -17076811, -17076811, -16810502, -17076811, -17076811, -17076811, -17076811,
+    -17076811, -16810502, -16810502, -16810502, -17076811, -16810502, -16810502, -16810502, -16810502, -17076811, -16810502, -17076811,
+    -16810502, -16810502, -16810502, -17076811, -13265965, -1086006, -33026, -33026, -301466, -166181, -99340, -99340,
+    -99340, -166181, -99340, -99340, -166181, -301466, -233554, -166181, -166181, -166181, -166181, -233554,
+    -166181, -99340, -99340, -166181, -233554, -301466, -166181, -166181, -166181, -166181, -99340, -99340,
+    -166181, -99340, -99340, -99340, -166181, -301466, -166181, -166181, -166181, -166181, -33026, -33026,
+    -33026, -99340, -99340, -99340, -99340, -99340, -166181, -166181, 32768, -99340, -99340, -99340,
+    -33026, -99340, -33026, -99340, -99340, -720627, -13265965, -17076811, -16810502, -17076811, -16810502, -16810502,
+    -16810502, -16810502, -16810502, -16810502, -17076811, -17076811, -17076811, -17076811, -17076811, -17076811, -16810502, -17347381,
+    -16810502, -16810502, -17076811, -16810502, -16810502, -17076811, -16810502, -17076811, -16810502, -17076811, -16810502, -16810502,
+    -16810502, -16810502, -17076811, -17076811, -17076811, -11665410, -508501, -166181, -99340, -233554, -33026, 32768,
+    -33026, -166181, -99340, -99340, -99340, -233554, -166181, -166181, -166181, -99340, -166181, -166181,
+    -166181, -99340, -99340, -166181, -233554, -233554, -166181, -166181, -166181, -166181, -99340, -99340,
+    -166181, -33026, -33026, -99340, -166181, -99340, -233554, -166181, -99340, -33026, -166181, 32768,
+    -33026, -99340, -99340, -99340, -166181, -166181, -166181, -99340, -99340, -33026, 32768, -99340,
+    -33026, -33026, -99340, -99340, -1312664, -11856080, -16810502, -16810502, -16810502, -17076811, -16810502, -16810502,
+    -16810502, -17076811, -17076811, -17076811, -17076811, -17076811, -17076811, -16810502, -16810502, -17076811, -17076811, -16810502,
+    -17076811, -17076811, -16810502, -17076811, -17076811, -17076811, -16810502, -16810502, -17076811, -17347381, -16810502, -16810502,
+    -16810502, -16810502, -17076811, -17347381, -17076811, -17076811, -13265965, -1389503, -233554, -369923, -99340, -99340,
+    -33026, -99340, -166181, -233554, -166181, -33026, -233554, -233554, -99340, -99340, -99340, -166181,
+    -166181, -233554, -166181, -233554, -233554, -301466, -301466, -166181, -166181, -233554, -33026, -99340,
+    -166181, -166181, -99340, -33026, -166181, -166181, -99340, -33026, -33026, -166181, -99340, -99340,
+    -99340, -166181, -99340, -33026, -166181, -166181, -33026, -166181, -33026, -166181, -99340, -166181,
+    -99340, -99340, -33026, -1236474, -13478805, -17076811, -17076811, -16810502, -16810502, -17076811, -16810502, -16810502,
+    -17076811, -16810502, -17076811, -17076811, -17076811, -17076811, -17076811, -16810502, -17076811, -17076811, -16810502, -17076811,
+    -16810502, -17076811, -17076811, -17076811, -17347381, -17347381, -16810502, -17076811, -17076811, -17076811, -16810502, -16810502,
+    -16810502, -16810502, -16810502, -17076811, -17347381, -16810502, -16810502, -13265965, -1160923, -99340, 32768, 32768,
+    -166181, -99340, -166181, -166181, -166181, -166181, -166181, -166181, -99340, -99340, -99340, -99340,
+    -166181, -233554, -233554, -233554, -166181, -233554, -233554, -233554, -166181, -166181, -99340, -166181,
+    -233554, -166181, 32768, -99340, -166181, -166181, -33026, -33026, -33026, -166181, -99340, -33026,
+    -99340, -233554, -166181, -99340, -33026, -33026, -33026, -99340, -166181, -233554, -99340, -99340,
+    -99340, -99340, -1236474, -13478805, -17076811, -17076811, -17347381, -16810502, -16810502, -17076811, -16810502, -17076811,
+    -17076811, -17076811, -17076811, -17076811, -17076811, -17076811, -16810502, -16810502, -17076811, -17076811, -17076811, -17076811,
+    -17076811, -17076811, -17076811, -17076811, -17076811, -17076811, -17076811, -17076811, -16810502, -17076811, -16810502, -16810502,
+    -16810502, -16810502, -17076811, -17076811, -17076811, -16810502, -16810502, -16810502, -13265965, -1086006, -33026, -33026,
+    -33026, -99340, -166181, -301466, -166181, -166181, -166181, -301466, -99340, -99340, -166181, -99340,
+    -166181, -233554, -99340, -166181, -233554, -233554, -166181, -233554, -233554, -233554, -99340, -99340,
+    -233554, -233554, -33026, 32768, -166181, -166181, -33026, -33026, -33026, -233554, -166181, -99340,
+    -166181, -166181, -233554, -166181, -33026, -33026, 32768, -99340, -99340, -301466, -166181, -33026,
+    -33026, -2538260, -15057632, -16810502, -17076811, -17076811, -17347381, -16810502, -16810502, -16810502, -16810502, -16810502,
+    -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -17076811,
+    -16810502, -16810502, -16810502, -17076811, -17076811, -17076811, -16810502, -17076811, -16810502, -16810502, -16810502, -16810502,
+    -16810502, -16810502, -16810502, -17076811, -17076811, -17076811, -17076811, -16810502, -16810502, -14822061, -2451401, -33026,
+    -33026, -33026, -99340, -166181, -166181, -166181, -166181, -166181, -33026, -99340, -99340, -166181,
+    -233554, -233554, -99340, -166181, -166181, -233554, -166181, -166181, -166181, -99340, -99340, -166181,
+    -369923, -301466, 32768, -99340, -166181, -166181, -33026, -33026, -99340, -99340, -99340, -99340,
+    -166181, -166181, -166181, -166181, -33026, -33026, -33026, -99340, -233554, -166181, -166181, -33026,
+    -4778171, -17076811, -17076811, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502,
+    -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502,
+    -17076811, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -17076811, -17076811, -17076811, -16810502, -16810502,
+    -16810502, -17076811, -16810502, -16810502, -16810502, -17076811, -17076811, -16810502, -16810502, -16810502, -16810502, -5566958,
+    -99340, -99340, -166181, -166181, -33026, -233554, -166181, -99340, -99340, -233554, -233554, -233554,
+    -233554, -233554, -233554, -233554, -233554, -233554, -166181, -166181, -99340, -166181, -369923, -301466,
+    -233554, -166181, 32768, -33026, -233554, -233554, -99340, -99340, -33026, -233554, -99340, -33026,
+    -166181, -166181, -99340, -166181, -99340, -33026, -33026, -99340, -99340, -166181, -508501, -8773387,
+    -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -17076811, -16810502, -16810502, -16810502,
+    -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -17076811, -16810502, -16810502, -16810502, -16810502,
+    -16810502, -16810502, -16810502, -16810502, -17076811, -16810502, -17076811, -17076811, -17347381, -17076811, -16810502, -16810502,
+    -16810502, -17076811, -17076811, -16810502, -16810502, -16810502, -16810502, -16810502, -17076811, -16810502, -16810502, -16810502,
+    -7746808, -1236474, -166181, -166181, -166181, -166181, -233554, -233554, -233554, -233554, -233554, -233554,
+    -233554, -233554, -166181, -166181, -233554, -301466, -166181, -166181, -166181, -233554, -233554, -301466,
+    -99340, -166181, -33026, -33026, -33026, -99340, -99340, -166181, -33026, -33026, -166181, -99340,
+    -99340, -166181, -166181, -166181, -166181, -99340, 32768, -99340, -166181, -2538260, -13056102, -16810502,
+    -16810502, -17076811, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -17076811, -17076811, -16810502, -16810502,
+    -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -17076811,
+    -16810502, -17076811, -16810502, -17076811, -17076811, -17076811, -16810502, -17076811, -17076811, -17076811, -16810502, -16810502,
+    -16810502, -16810502, -16810502, -17076811, -16810502, -16810502, -16810502, -17076811, -16810502, -16810502, -16810502, -16810502,
+    -16810502, -13265965, -1864628, -166181, -33026, -233554, -99340, -99340, -233554, -166181, -166181, -166181,
+    -99340, -99340, -166181, -166181, -233554, -233554, -166181, -166181, -166181, -233554, -99340, -99340,
+    -33026, -99340, -33026, -33026, 32768, -99340, -166181, -166181, -33026, -99340, -233554, -301466,
+    -233554, -166181, -166181, -233554, -99340, -99340, -99340, -508501, -6670269, -16810502, -16810502, -16810502,
+    -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -17076811, -16810502, -16810502,
+    -16810502, -16810502, -17076811, -16810502, -17076811, -17076811, -16810502, -16810502, -16810502, -17076811, -17076811, -17347381,
+    -16810502, -16810502, -16810502, -17076811, -17076811, -17076811, -16810502, -16810502, -16810502, -17076811, -17076811, -17076811,
+    -16810502, -17076811, -17076811, -16810502, -16810502, -16810502, -16810502, -16810502, -17076811, -17076811, -16810502, -16810502,
+    -16810502, -16810502, -16810502, -5803057, -166181, -99340, -33026, -99340, -233554, -166181, -166181, -166181,
+    -99340, -99340, -233554, -166181, -233554, -166181, -166181, -166181, -166181, -166181, -99340, -33026,
+    -233554, -301466, -166181, -33026, 32768, -166181, -99340, -166181, -99340, -166181, -166181, -233554,
+    -166181, -233554, -166181, -233554, -233554, -166181, -2538260, -13265965, -16810502, -16810502, -16810502, -16810502,
+    -17076811, -17076811, -16810502, -16810502, -17076811, -17076811, -16810502, -17076811, -17076811, -16810502, -16810502, -17076811,
+    -16810502, -17076811, -17076811, -16810502, -17076811, -17076811, -16810502, -16810502, -16810502, -16810502, -17076811, -17076811,
+    -17076811, -17076811, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -17076811, -17076811, -17076811,
+    -17076811, -17076811, -17076811, -17076811, -16810502, -16810502, -16810502, -16810502, -17076811, -16810502, -16810502, -16810502,
+    -16810502, -16810502, -16810502, -16810502, -13478805, -3262493, -99340, -166181, -166181, -166181, -166181, -166181,
+    -166181, -166181, -233554, -166181, -233554, -166181, -166181, -233554, -99340, -99340, -99340, -99340,
+    -166181, -233554, -99340, -99340, -33026, -99340, -33026, -166181, -166181, -166181, -166181, -301466,
+    -99340, -99340, -233554, -166181, -1160923, -8927109, -16810502, -17076811, -17076811, -16810502, -16810502, -16810502,
+    -17076811, -17076811, -16810502, -17076811, -16810502, -17076811, -16810502, -16810502, -16810502, -17076811, -16810502, -17076811,
+    -17076811, -17076811, -17076811, -17076811, -17076811, -17076811, -16810502, -16810502, -16810502, -17347381, -17076811, -17347381,
+    -17347381, -17076811, -16810502, -16810502, -16810502, -17076811, -16810502, -16810502, -17076811, -17076811, -17076811, -17076811,
+    -16810502, -17076811, -16810502, -17076811, -17076811, -16810502, -16810502, -16810502, -16810502, -17076811, -16810502, -17076811,
+    -17076811, -17076811, -16810502, -16810502, -17076811, -17076811, -7888376, -1160923, -166181, -166181, -233554, -166181,
+    -233554, -233554, -166181, -166181, -233554, -166181, -166181, -166181, -99340, -166181, -99340, -166181,
+    -369923, -233554, -166181, -233554, -33026, -99340, -99340, -166181, -99340, -166181, -166181, -166181,
+    -166181, -166181, -508501, -5684386, -15057632, -17076811, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502,
+    -17076811, -17076811, -16810502, -17076811, -16810502, -16810502, -17076811, -16810502, -17076811, -16810502, -16810502, -17076811,
+    -17076811, -17076811, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -17076811, -17076811, -17076811,
+    -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -17076811, -17076811, -17076811, -16810502,
+    -16810502, -16810502, -16810502, -16810502, -17076811, -16810502, -16810502, -16810502, -17076811, -17076811, -16810502, -16810502,
+    -17076811, -17076811, -17076811, -16810502, -17347381, -17076811, -17076811, -17076811, -7888376, -1236474, -99340, -301466,
+    -233554, -166181, -233554, -166181, -166181, -166181, -166181, -166181, -166181, -166181, -233554, -233554,
+    -166181, -233554, -166181, -233554, -99340, -99340, -233554, -166181, -99340, -166181, -99340, -99340,
+    -578635, -5803057, -15057632, -16810502, -17076811, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502,
+    -17076811, -17076811, -16810502, -16810502, -17076811, -16810502, -16810502, -16810502, -17076811, -16810502, -16810502, -17076811,
+    -17076811, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -17076811, -16810502, -16810502, -17076811,
+    -17076811, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -17076811, -17076811, -17076811, -16810502,
+    -16810502, -16810502, -16810502, -16810502, -17076811, -17076811, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502,
+    -17076811, -17076811, -16810502, -16810502, -17076811, -17347381, -17076811, -17076811, -17076811, -13265965, -5803057, -1312664,
+    -233554, -301466, -166181, -166181, -166181, -166181, -233554, -166181, -166181, -166181, -233554, -301466,
+    -166181, -166181, -33026, 32768, -99340, -166181, -99340, -99340, -33026, -99340, -1086006, -5803057,
+    -15057632, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502,
+    -16810502, -17076811, -16810502, -16810502, -17076811, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502,
+    -17076811, -17076811, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -17076811, -16810502, -17076811,
+    -17076811, -17076811, -17076811, -17076811, -16810502, -16810502, -16810502, -16810502, -16810502, -17076811, -17076811, -17076811,
+    -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502,
+    -16810502, -17076811, -16810502, -16810502, -17076811, -17076811, -17076811, -17076811, -17076811, -17076811, -16810502, -17076811,
+    -7746808, -1160923, -99340, -233554, -99340, -233554, -99340, -99340, -99340, -99340, -99340, -166181,
+    -99340, -99340, -33026, -166181, -166181, -233554, -99340, -99340, -2451401, -10226936, -16810502, -16810502,
+    -16810502, -17076811, -17076811, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -17076811, -17076811,
+    -17076811, -17076811, -16810502, -16810502, -16810502, -17076811, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502,
+    -17076811, -17076811, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -17076811,
+    -17076811, -17622315, -16810502, -17347381, -17076811, -16810502, -17076811, -17076811, -17076811, -17076811, -17076811, -16810502,
+    -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502,
+    -16810502, -16810502, -17076811, -17076811, -16810502, -16810502, -17076811, -17076811, -17076811, -17076811, -17076811, -17076811,
+    -17076811, -17076811, -8773387, -3169003, -166181, -166181, -33026, -233554, -99340, -166181, -166181, -166181,
+    -99340, -166181, -99340, -99340, -33026, -2365321, -6542320, -15057632, -16810502, -16810502, -16810502, -16810502,
+    -17076811, -16810502, -17076811, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -17076811,
+    -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -17076811, -16810502, -16810502, -16810502, -16810502,
+    -17076811, -17076811, -17076811, -17076811, -16810502, -17076811, -16810502, -16810502, -17076811, -17076811, -17076811, -17076811,
+    -17076811, -17076811, -17076811, -17076811, -17076811, -16810502, -17076811, -17076811, -17076811, -16810502, -16810502, -16810502,
+    -16810502, -16810502, -16810502, -16810502, -16810502, -17076811, -16810502, -16810502, -16810502, -16810502, -16810502, -17076811,
+    -17076811, -17076811, -16810502, -17076811, -16810502, -17076811, -17076811, -17076811, -16810502, -17076811, -17076811, -16810502,
+    -16810502, -16810502, -16810502, -17347381, -13265965, -7746808, -2714358, -233554, -233554, -166181, -166181, -233554,
+    -166181, -649341, -3942341, -7746808, -15057632, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502,
+    -16810502, -17076811, -17076811, -16810502, -17076811, -17076811, -17076811, -17076811, -16810502, -16810502, -17347381, -17076811,
+    -17076811, -17076811, -16810502, -17076811, -16810502, -16810502, -16810502, -17076811, -17076811, -17076811, -16810502, -16810502,
+    -17076811, -17076811, -17076811, -17347381, -17347381, -17076811, -16810502, -16810502, -17076811, -17347381, -17347381, -17076811,
+    -16810502, -16810502, -16810502, -16810502, -16810502, -17076811, -17076811, -17076811, -17076811, -16810502, -16810502, -16810502,
+    -16810502, -16810502, -16810502, -16810502, -17076811, -17076811, -16810502, -16810502, -16810502, -16810502, -16810502, -17076811,
+    -17076811, -16810502, -16810502, -16810502, -17076811, -17076811, -16810502, -17076811, -17076811, -17076811, -17076811, -17076811,
+    -16810502, -16810502, -17076811, -17076811, -17076811, -17347381, -17076811, -13478805, -7888376, -3356865, -1236474, -99340,
+    -4887423, -17076811, -17076811, -17076811, -16810502, -17076811, -17076811, -17076811, -17076811, -17076811, -16810502, -17076811,
+    -17347381, -17076811, -17076811, -17076811, -16810502, -17076811, -17076811, -17076811, -17076811, -17076811, -17076811, -17347381,
+    -17076811, -17076811, -16810502, -16810502, -16810502, -17076811, -17076811, -17076811, -17076811, -17076811, -16810502, -16810502,
+    -17076811, -16810502, -16810502, -17076811, -17076811, -17076811, -16810502, -17076811, -16810502, -16810502, -17076811, -17076811,
+    -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -17076811, -16810502, -16810502, -16810502, -17076811,
+    -17076811, -17076811, -16810502, -16810502, -17076811, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -17076811,
+    -17076811, -16810502, -16810502, -16810502, -16810502, -17076811, -17076811, -17076811, -17076811, -16810502, -16810502, -16810502,
+    -16810502, -17076811, -17076811, -17076811, -17076811, -17076811, -17076811, -17076811, -16810502, -17076811, -16810502, -4887423,
+    -13265965, -17076811, -17076811, -17076811, -17347381, -17076811, -17076811, -17076811, -17076811, -17076811, -17076811, -17076811,
+    -17076811, -17347381, -17076811, -17076811, -16810502, -17076811, -17347381, -16810502, -17076811, -17076811, -17076811, -17076811,
+    -17076811, -17076811, -17076811, -17076811, -16810502, -16810502, -17076811, -17076811, -17347381, -16810502, -16810502, -16810502,
+    -17076811, -17076811, -17076811, -16810502, -17076811, -17076811, -16810502, -17076811, -17076811, -17076811, -17076811, -16810502,
+    -16810502, -16810502, -17076811, -16810502, -16810502, -16810502, -16810502, -17076811, -17076811, -16810502, -16810502, -16810502,
+    -16810502, -16810502, -16810502, -16810502, -17076811, -17076811, -16810502, -16810502, -16810502, -16810502, -17076811, -17347381,
+    -17076811, -17076811, -16810502, -16810502, -16810502, -17076811, -17076811, -17076811, -17076811, -17076811, -17076811, -16810502,
+    -17076811, -16810502, -16810502, -17076811, -17076811, -16810502, -17076811, -17076811, -16810502, -16810502, -17076811, -15057632,
+    -15057632, -17076811, -17076811, -17076811, -17076811, -17076811, -16810502, -16810502, -16810502, -17076811, -16810502, -16810502,
+    -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -17076811, -17076811, -16810502, -16810502,
+    -17076811, -16810502, -16810502, -16810502, -16810502, -17076811, -17076811, -17076811, -16810502, -16810502, -16810502, -16810502,
+    -17076811, -17076811, -16810502, -16810502, -17076811, -16810502, -16810502, -16810502, -17076811, -17076811, -17076811, -17076811,
+    -17076811, -17076811, -16810502, -17076811, -17076811, -17076811, -16810502, -16810502, -17076811, -17076811, -16810502, -16810502,
+    -16810502, -16810502, -16810502, -16810502, -17076811, -16810502, -16810502, -17076811, -16810502, -17076811, -17076811, -16810502,
+    -17076811, -17076811, -17076811, -16810502, -16810502, -16810502, -16810502, -16810502, -17076811, -17076811, -17076811, -17076811,
+    -17076811, -17076811, -16810502, -16810502, -17076811, -17076811, -16810502, -17076811, -17076811, -17076811, -17076811, -13478805,
+    -4887423, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -17076811, -16810502, -17076811,
+    -16810502, -17076811, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -17076811, -17076811, -16810502, -16810502,
+    -16810502, -16810502, -16810502, -16810502, -16810502, -17076811, -17076811, -16810502, -16810502, -16810502, -16810502, -16810502,
+    -17347381, -17076811, -17076811, -17076811, -16810502, -16810502, -16810502, -16810502, -16810502, -17076811, -16810502, -16810502,
+    -17076811, -17076811, -17076811, -17076811, -17076811, -16810502, -16810502, -16810502, -16810502, -17076811, -17076811, -16810502,
+    -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -17076811, -17347381, -17076811, -16810502,
+    -16810502, -16810502, -17076811, -17076811, -16810502, -16810502, -16810502, -16810502, -17076811, -17076811, -17076811, -17076811,
+    -17076811, -16810502, -16810502, -17076811, -17076811, -16810502, -17076811, -17076811, -17076811, -17076811, -17076811, -4997789,
+    -166181, -1466998, -3076382, -7888376, -13265965, -16810502, -16810502, -16810502, -16810502, -16810502, -17076811, -16810502,
+    -16810502, -16810502, -16810502, -17076811, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502,
+    -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502,
+    -16810502, -16810502, -16810502, -16810502, -17076811, -17076811, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502,
+    -17076811, -16810502, -17076811, -17076811, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -17076811,
+    -17076811, -17076811, -16810502, -16810502, -17076811, -16810502, -16810502, -16810502, -16810502, -16810502, -17076811, -17076811,
+    -17076811, -17076811, -17076811, -17076811, -16810502, -16810502, -17076811, -17076811, -17076811, -17076811, -17076811, -16810502,
+    -16810502, -16810502, -17076811, -17076811, -16810502, -17076811, -17076811, -15296745, -7746808, -3942341, -578635, -99340,
+    -166181, -233554, -166181, -166181, -99340, -2451401, -7606858, -13265965, -16810502, -16810502, -16810502, -16810502,
+    -16810502, -16810502, -17076811, -16810502, -16810502, -17076811, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502,
+    -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -17076811, -16810502,
+    -17076811, -17076811, -16810502, -16810502, -17076811, -17076811, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502,
+    -16810502, -17076811, -16810502, -17076811, -16810502, -16810502, -16810502, -16810502, -16810502, -17076811, -17076811, -17076811,
+    -17076811, -16810502, -16810502, -16810502, -17076811, -16810502, -16810502, -16810502, -17076811, -17076811, -17076811, -17076811,
+    -17076811, -17076811, -17076811, -17076811, -16810502, -16810502, -17076811, -17076811, -17076811, -16810502, -17076811, -16810502,
+    -16810502, -17076811, -17076811, -17076811, -15057632, -6799632, -2538260, -233554, -166181, -99340, -33026, -99340,
+    -166181, -233554, -99340, -33026, -99340, -33026, -99340, -99340, -3169003, -9082694, -16810502, -16810502,
+    -17076811, -16810502, -17076811, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -17076811, -16810502, -16810502,
+    -16810502, -17076811, -17076811, -16810502, -16810502, -16810502, -17076811, -16810502, -17076811, -16810502, -17076811, -17076811,
+    -17076811, -17076811, -17076811, -17076811, -16810502, -17347381, -16810502, -16810502, -16810502, -17076811, -16810502, -16810502,
+    -16810502, -16810502, -16810502, -16810502, -17076811, -16810502, -16810502, -16810502, -16810502, -17076811, -17076811, -17076811,
+    -17076811, -17076811, -17076811, -17076811, -17076811, -17076811, -16810502, -16810502, -16810502, -16810502, -17076811, -17076811,
+    -17076811, -17076811, -17076811, -17076811, -17076811, -17076811, -17076811, -17076811, -17076811, -17076811, -16810502, -16810502,
+    -17076811, -17076811, -10226936, -2538260, -233554, -301466, -166181, -166181, -33026, -99340, -99340, -33026,
+    -233554, -233554, -166181, -166181, -99340, -99340, -99340, -99340, -233554, -166181, -1086006, -7746808,
+    -16810502, -16810502, -16810502, -17347381, -17347381, -16810502, -16810502, -17076811, -17076811, -17076811, -16810502, -17076811,
+    -16810502, -16810502, -17076811, -16810502, -17076811, -16810502, -16810502, -17076811, -17076811, -16810502, -17347381, -17076811,
+    -17076811, -17076811, -17076811, -17347381, -17347381, -17076811, -16810502, -16810502, -16810502, -17076811, -16810502, -16810502,
+    -17076811, -16810502, -16810502, -16810502, -17076811, -17076811, -16810502, -16810502, -16810502, -16810502, -17076811, -17076811,
+    -17076811, -17076811, -17076811, -17076811, -17076811, -16810502, -16810502, -16810502, -16810502, -16810502, -17076811, -17076811,
+    -17076811, -17076811, -17076811, -16810502, -17076811, -17076811, -17076811, -17076811, -16810502, -17076811, -16810502, -15057632,
+    -5803057, -1312664, -166181, -166181, -369923, -369923, -166181, -166181, -99340, -233554, -99340, -99340,
+    -233554, -166181, -166181, -166181, -301466, -233554, -233554, -166181, -233554, -233554, -99340, -99340,
+    -1236474, -5803057, -13265965, -17076811, -17076811, -17076811, -16810502, -17076811, -17347381, -17076811, -16810502, -16810502,
+    -17076811, -17076811, -17076811, -17076811, -17076811, -17076811, -17076811, -17076811, -17076811, -16810502, -16810502, -17076811,
+    -16810502, -17076811, -17076811, -17347381, -17076811, -17076811, -17076811, -16810502, -16810502, -16810502, -16810502, -16810502,
+    -16810502, -17076811, -17076811, -16810502, -17076811, -16810502, -16810502, -16810502, -16810502, -17076811, -16810502, -17076811,
+    -17076811, -17076811, -17076811, -17076811, -17076811, -17076811, -16810502, -16810502, -16810502, -17076811, -17076811, -17076811,
+    -17076811, -17076811, -16810502, -17076811, -17076811, -17076811, -17076811, -17076811, -17076811, -15057632, -5684386, -578635,
+    -99340, -99340, -99340, -233554, -233554, -301466, -166181, -99340, -233554, -166181, -33026, -99340,
+    -233554, -99340, -166181, -233554, -301466, -233554, -99340, -166181, -301466, -301466, -99340, -166181,
+    -99340, -233554, -1086006, -7746808, -17076811, -16810502, -16810502, -17076811, -17347381, -17347381, -17076811, -17076811,
+    -17076811, -17347381, -17076811, -17076811, -17076811, -17076811, -17076811, -17076811, -17076811, -16810502, -16810502, -17076811,
+    -16810502, -16810502, -17076811, -17076811, -17076811, -17076811, -17076811, -16810502, -16810502, -16810502, -16810502, -16810502,
+    -17076811, -17076811, -17076811, -17076811, -17076811, -16810502, -16810502, -16810502, -17076811, -17076811, -16810502, -17076811,
+    -17076811, -17076811, -16810502, -17076811, -17076811, -17076811, -16810502, -16810502, -17076811, -17076811, -16810502, -17076811,
+    -17076811, -17076811, -16810502, -17076811, -17076811, -17076811, -17076811, -15296745, -5803057, -649341, -233554, -99340,
+    -99340, -99340, -99340, -99340, -233554, -301466, -233554, -166181, -233554, -166181, -99340, -99340,
+    -166181, -166181, -166181, -233554, -166181, -99340, -233554, -233554, -166181, -301466, -233554, -99340,
+    -99340, -99340, 32768, -99340, -1160923, -8031590, -16810502, -17076811, -17347381, -17076811, -16810502, -17076811,
+    -16810502, -16810502, -17076811, -16810502, -17347381, -17076811, -17076811, -17076811, -17076811, -17076811, -16810502, -16810502,
+    -17076811, -16810502, -16810502, -16810502, -16810502, -16810502, -17076811, -17076811, -16810502, -16810502, -16810502, -16810502,
+    -17076811, -17076811, -17076811, -17076811, -17076811, -17076811, -17076811, -17076811, -17076811, -16810502, -16810502, -16810502,
+    -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -17076811, -17076811, -17076811, -17076811, -17076811,
+    -17076811, -17076811, -17076811, -17076811, -17076811, -17076811, -8927109, -1236474, -233554, -166181, -166181, -99340,
+    -233554, -233554, -233554, -166181, -233554, -233554, -233554, -166181, -166181, -99340, -166181, -233554,
+    -166181, -166181, -99340, -166181, -99340, -99340, -166181, -233554, -166181, -233554, -33026, -33026,
+    -33026, -99340, 32768, -33026, -166181, -166181, -3076382, -13056102, -16810502, -17076811, -16810502, -16810502,
+    -17076811, -16810502, -16810502, -16810502, -17076811, -17347381, -17076811, -17076811, -17347381, -17076811, -16810502, -16810502,
+    -17076811, -16810502, -16810502, -16810502, -16810502, -16810502, -17076811, -16810502, -16810502, -16810502, -16810502, -16810502,
+    -16810502, -17076811, -17076811, -17076811, -16810502, -16810502, -16810502, -17076811, -17076811, -17076811, -16810502, -16810502,
+    -16810502, -17076811, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -17076811, -17076811, -17076811, -17076811,
+    -16810502, -17076811, -17076811, -17076811, -13478805, -2538260, -233554, -166181, -166181, -166181, -233554, -166181,
+    -166181, -99340, -166181, -166181, -233554, -233554, -166181, -166181, -33026, -99340, -166181, -166181,
+    -166181, -99340, -166181, -99340, -166181, -166181, -166181, -233554, -166181, -233554, -301466, -233554,
+    -166181, -99340, -33026, -99340, -99340, -99340, 32768, -99340, -5684386, -16810502, -16810502, -16810502,
+    -17076811, -17076811, -16810502, -16810502, -16810502, -16810502, -16810502, -17076811, -17076811, -17076811, -17076811, -16810502,
+    -16810502, -16810502, -16810502, -16810502, -16810502, -17076811, -16810502, -16810502, -16810502, -17076811, -16810502, -16810502,
+    -17076811, -17076811, -16810502, -16810502, -17076811, -16810502, -16810502, -17076811, -17347381, -17076811, -16810502, -16810502,
+    -16810502, -16810502, -16810502, -17076811, -16810502, -16810502, -16810502, -16810502, -17076811, -17076811, -17076811, -17076811,
+    -17076811, -17076811, -17076811, -6799632, -720627, -166181, -166181, -166181, -166181, -166181, -166181, -166181,
+    -166181, -166181, -166181, -166181, -301466, -166181, -33026, -166181, -33026, -99340, -33026, -99340,
+    -233554, -233554, -166181, -233554, -166181, -233554, -166181, -166181, -166181, -166181, -166181, -233554,
+    -166181, -233554, 32768, -99340, 32768, -99340, -33026, -33026, 32768, -1703511, -13265965, -17076811,
+    -17076811, -17076811, -16810502, -16810502, -16810502, -16810502, -16810502, -17076811, -17076811, -17076811, -16810502, -17076811,
+    -17076811, -17076811, -16810502, -17076811, -16810502, -17076811, -16810502, -16810502, -17076811, -17076811, -16810502, -17076811,
+    -17347381, -17076811, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -17076811, -17076811, -16810502, -16810502,
+    -16810502, -16810502, -17076811, -17076811, -16810502, -16810502, -16810502, -16810502, -17076811, -17076811, -17076811, -17076811,
+    -17076811, -13265965, -2538260, -166181, -166181, -166181, -166181, -166181, -166181, -166181, -166181, -166181,
+    -166181, -166181, -166181, -233554, -301466, -233554, -166181, -166181, -33026, -33026, -33026, -33026,
+    -166181, -166181, -233554, -166181, -166181, -166181, -166181, -166181, -166181, -233554, -99340, -99340,
+    -166181, -99340, 32768, -33026, -166181, -99340, 32768, 32768, -166181, -33026, -1160923, -7746808,
+    -17076811, -16810502, -16810502, -16810502, -17076811, -17076811, -16810502, -17076811, -17076811, -17076811, -17076811, -16810502,
+    -16810502, -16810502, -16810502, -17076811, -16810502, -17076811, -16810502, -16810502, -16810502, -17076811, -16810502, -17347381,
+    -17076811, -17076811, -16810502, -16810502, -16810502, -16810502, -17076811, -16810502, -17076811, -17076811, -16810502, -16810502,
+    -16810502, -16810502, -17076811, -17076811, -16810502, -16810502, -16810502, -16810502, -17076811, -17076811, -17076811, -17076811,
+    -8927109, -649341, -166181, -166181, -166181, -166181, -166181, -166181, -166181, -166181, -166181, -166181,
+    -166181, -166181, -166181, -166181, -301466, -233554, -166181, -166181, -99340, -166181, -99340, -99340,
+    -166181, -233554, -233554, -233554, -166181, -166181, -233554, -166181, -166181, -166181, -166181, -233554,
+    -166181, -166181, -33026, -33026, -33026, -33026, -99340, -33026, -233554, -99340, -33026, -233554,
+    -5803057, -17076811, -17076811, -17076811, -17076811, -17347381, -17076811, -17076811, -17076811, -17076811, -17076811, -16810502,
+    -16810502, -16810502, -16810502, -17076811, -17347381, -17076811, -17076811, -16810502, -16810502, -17076811, -17076811, -17076811,
+    -17076811, -17076811, -16810502, -16810502, -16810502, -17076811, -17076811, -17076811, -16810502, -17076811, -17076811, -17076811,
+    -16810502, -17076811, -17076811, -17076811, -16810502, -16810502, -16810502, -16810502, -17076811, -17076811, -17076811, -4778171,
+    -166181, -166181, -166181, -166181, -233554, -166181, -166181, -166181, -166181, -166181, -99340, -166181,
+    -166181, -166181, -166181, -166181, -233554, -301466, -166181, -99340, -33026, -99340, -33026, -99340,
+    -166181, -166181, -166181, -99340, -166181, -166181, -301466, -233554, -166181, -233554, -233554, -166181,
+    -99340, -166181, -99340, -99340, -233554, -166181, -99340, -166181, -33026, -166181, -33026, -99340,
+    -99340, -2538260, -15057632, -17076811, -16810502, -17076811, -17076811, -17347381, -17076811, -16810502, -16810502, -16810502,
+    -16810502, -16810502, -16810502, -17076811, -17076811, -17076811, -16810502, -17076811, -16810502, -17076811, -16810502, -16810502,
+    -16810502, -17076811, -17076811, -17076811, -16810502, -17076811, -17076811, -17076811, -16810502, -16810502, -16810502, -16810502,
+    -17076811, -16810502, -16810502, -16810502, -16810502, -17076811, -16810502, -16810502, -16810502, -14822061, -2538260, -166181,
+    -99340, -166181, -166181, -166181, -233554, -166181, -233554, -166181, -166181, -166181, -99340, -166181,
+    -166181, -166181, -166181, -166181, -301466, -233554, -233554, -166181, -166181, -166181, -166181, -166181,
+    -166181, -233554, -99340, -166181, -166181, -166181, -233554, -233554, -166181, -301466, -233554, -233554,
+    -233554, -233554, -166181, -166181, -166181, -166181, -99340, -99340, -33026, -166181, -99340, -166181,
+    -233554, -166181, -1312664, -13265965, -16810502, -17076811, -17076811, -16810502, -17076811, -16810502, -17076811, -17076811,
+    -16810502, -16810502, -16810502, -17076811, -17076811, -17076811, -17076811, -16810502, -17076811, -17076811, -16810502, -16810502,
+    -16810502, -17076811, -17076811, -17076811, -16810502, -16810502, -17076811, -17076811, -16810502, -16810502, -16810502, -16810502,
+    -16810502, -16810502, -16810502, -17076811, -17076811, -17076811, -16810502, -16810502, -13265965, -1160923, -166181, -166181,
+    -166181, -166181, -166181, -166181, -166181, -166181, -166181, -166181, -166181, -301466, -166181, -233554,
+    -166181, -166181, -166181, -166181, -233554, -233554, -301466, -166181, -166181, -166181, -233554, -166181,
+    -233554, -233554, -166181, -166181, -166181, -166181, -166181, -166181, -233554, -233554, -166181, -233554,
+    -166181, -166181, -166181, -33026, -166181, -166181, -166181, -233554, -166181, -166181, -166181, -166181,
+    -233554, -233554, -233554, -1236474, -13265965, -17076811, -16810502, -16810502, -17076811, -17076811, -17076811, -17076811,
+    -16810502, -17076811, -16810502, -17076811, -17076811, -16810502, -17076811, -17076811, -16810502, -17076811, -17076811, -17076811,
+    -17076811, -17076811, -17076811, -17076811, -16810502, -17076811, -16810502, -17076811, -16810502, -16810502, -17076811, -17076811,
+    -16810502, -16810502, -17076811, -17076811, -17076811, -17076811, -16810502, -13265965, -1236474, -99340, -99340, -166181,
+    -99340, -99340, -166181, -166181, -166181, -233554, -301466, -166181, -233554, -301466, -233554, -233554,
+    -301466, -166181, -166181, -166181, -233554, -233554, -166181, -99340, -233554, -99340, -99340, -33026,
+    -233554, -233554, -99340, -166181, -166181, -233554, -166181, -233554, -301466, -301466, -166181, -233554,
+    -166181, -99340, -166181, -99340, -33026, -233554, -233554, -233554, -233554, -166181, -233554, -233554,
+    -99340, -166181, -166181, -166181, -1236474, -13265965, -17076811, -17076811, -17076811, -17076811, -17076811, -17076811,
+    -17347381, -16810502, -16810502, -16810502, -17076811, -17076811, -17076811, -17347381, -17076811, -17076811, -17347381, -17076811,
+    -17347381, -17347381, -17076811, -17076811, -16810502, -17076811, -16810502, -16810502, -16810502, -17076811, -17076811, -17076811,
+    -16810502, -16810502, -17076811, -17076811, -17076811, -17076811, -11665410, -1236474, -166181, -166181, -166181, -233554,
+    -166181, -166181, -166181, -166181, -166181, -233554, -233554, -166181, -233554, -233554, -233554, -233554,
+    -233554, -166181, -166181, -99340, -233554, -233554, -99340, -99340, -99340, -99340, -99340, -99340,
+    -233554, -233554, -166181, -166181, -166181, -233554, -166181, -233554, -233554, -301466, -166181, -233554,
+    -166181, -33026, -99340, -99340, -166181, -233554, -233554, -166181, -166181, -166181, -166181, -166181,
+    -233554, -166181, -233554, -233554, -99340, -649341, -11665410, -17076811, -17076811, -17076811, -17076811, -17076811,
+    -17076811, -17076811, -16810502, -16810502, -16810502, -17076811, -17076811, -17347381, -17076811, -17076811, -17076811, -17076811,
+    -17076811, -17076811, -17076811, -16810502, -16810502, -16810502, -16810502, -16810502, -17076811, -17076811, -17076811, -17076811,
+    -16810502, -16810502, -17076811, -16810502, -17076811, -13265965, -720627, -233554, -33026, -166181, -166181, -99340,
+    -99340, -166181, 32768, -99340, -233554, -166181, -166181, -166181, -166181, -166181, -233554, -233554,
+    -166181, -99340, -166181, -166181, -233554, -301466, -99340, -166181, -99340, -99340, -99340, -99340,
+    -233554, -233554, -233554, -166181, -166181, -166181, -166181, -166181, -166181, -233554, -166181, -233554,
+    -99340, -233554, -99340, -99340, -166181, -166181, -166181, -166181, -166181, -166181, -166181, -233554,
+    -166181, -33026, -99340, -166181, -166181, -166181, -1312664, -13478805, -17076811, -17076811, -17076811, -17076811,
+    -17076811, -17076811, -16810502, -16810502, -17076811, -17076811, -17076811, -17076811, -17076811, -17076811, -17076811, -17076811,
+    -16810502, -17076811, -16810502, -16810502, -16810502, -17076811, -16810502, -17076811, -17347381, -17347381, -16810502, -16810502,
+    -16810502, -17076811, -17076811, -16810502, -13265965, -1236474, -233554, -99340, -166181, -233554, -166181, -233554,
+    -166181, -166181, -166181, -166181, -99340, -166181, -233554, -166181, -99340, -233554, -233554, -166181,
+    -166181, -166181, -166181, -233554, -233554, -233554, -166181, -99340, -166181, -99340, -99340, -99340,
+    -166181, -233554, -166181, -166181, -99340, -166181, -99340, -166181, -166181, -166181, -99340, -99340,
+    -99340, -99340, -99340, -33026, -166181, -166181, -166181, -166181, -99340, -99340, -166181, -166181,
+    -166181, -233554, -33026, -166181, -166181, -166181, -166181, -1236474, -13265965, -17347381, -17076811, -17076811,
+    -17076811, -17076811, -16810502, -16810502, -17076811, -17076811, -17076811, -16810502, -16810502, -16810502, -16810502, -17076811,
+    -16810502, -16810502, -16810502, -16810502, -17076811, -16810502, -17076811, -17076811, -17347381, -17076811, -17076811, -17076811,
+    -16810502, -16810502, -17347381, -13265965, -1236474, -99340, -99340, -233554, -166181, -233554, -166181, -166181,
+    -166181, -233554, -99340, -166181, -99340, -301466, -233554, -166181, -233554, -166181, -99340, -166181,
+    -166181, -166181, -166181, -166181, -233554, -233554, -166181, -166181, -233554, -166181, -99340, -99340,
+    -166181, -233554, -233554, -233554, -166181, -166181, -166181, -166181, -99340, -233554, -99340, -33026,
+    -33026, -33026, -99340, -99340, -99340, -166181, -99340, -166181, -166181, -166181, -166181, -166181,
+    -301466, -233554, -166181, -166181, -166181, -166181, -233554, -166181, -1160923, -15057632, -17076811, -17076811,
+    -17076811, -17076811, -17347381, -17076811, -17076811, -17076811, -17076811, -16810502, -16810502, -16810502, -16810502, -17076811,
+    -17076811, -16810502, -16810502, -16810502, -16810502, -16810502, -17076811, -17076811, -17076811, -17076811, -17347381, -17076811,
+    -17076811, -17076811, -15296745, -1236474, -233554, -166181, -166181, -166181, -99340, -166181, -99340, -233554,
+    -166181, -233554, -166181, -233554, -166181, -233554, -99340, -166181, -99340, -166181, -166181, -166181,
+    -233554, -301466, -301466, -301466, -166181, -233554, -166181, -233554, -166181, -166181, -99340, -99340,
+    -166181, -233554, -166181, -233554, -99340, -233554, -166181, -99340, -99340, -99340, -166181, -99340,
+    -99340, -99340, -33026, -33026, -99340, -166181, -166181, -166181, -166181, -233554, -233554, -301466,
+    -166181, -166181, -166181, -166181, -166181, -166181, -99340, -166181, -33026, -2451401, -17076811, -16810502,
+    -16810502, -16810502, -17076811, -17076811, -16810502, -17076811, -16810502, -16810502, -16810502, -16810502, -16810502, -16810502,
+    -17076811, -17076811, -16810502, -16810502, -16810502, -17076811, -17076811, -17076811, -17347381, -17076811, -17076811, -17076811,
+    -16810502, -17076811, -2625909, -301466, -301466, -166181, -166181, -166181, -166181, -33026, -233554, -99340,
+    -166181, -301466, -99340, -166181, -233554, -233554, -166181, -166181, -166181, -166181, -166181, -166181,
+    -166181, -166181, -99340, -166181, -166181, -166181, -233554, -166181, -166181, -166181, -99340, -99340,
+    -166181, -166181, -166181, -166181, -166181, -166181, -166181, -99340, -99340, -99340, -166181, -33026,
+    -99340, -33026, -99340, -99340, -99340, -166181, -99340, -166181, -166181, -166181, -233554, -301466,
+    -301466, -166181, -233554, -233554, -233554, -99340, -166181, -99340, -99340, -99340, -4778171, -16810502,
+    -16810502, -16810502, -17076811, -16810502, -16810502, -17076811, -17076811, -16810502, -16810502, -16810502, -17076811, -16810502,
+    -17076811, -17076811, -17076811, -17076811, -17076811, -16810502, -17076811, -17076811, -17076811, -17076811, -17076811, -17076811,
+    -17076811, -5684386, -233554, -301466, -233554, -166181, -166181, -166181, -166181, -233554, -99340, -99340,
+    -233554, -166181, -166181, -166181, -166181, -233554, -166181, -166181, -166181, -233554, -166181, -166181,
+    -166181, -166181, -99340, -166181, -166181, -166181, -233554, -166181, -166181, -233554, -99340, -99340,
+    -99340, -301466, -233554, -166181, -166181, -166181, -166181, -369923, -99340, -166181, -99340, -166181,
+    -99340, -99340, -99340, -99340, -166181, -99340, -166181, -166181, -301466, -301466, -301466, -233554,
+    -233554, -99340, -166181, -166181, -166181, -99340, 32768, -99340, -99340, -33026, -166181, -8927109,
+    -16810502, -16810502, -16810502, -16810502, -16810502, -16810502, -17076811, -17076811, -16810502, -17076811, -16810502, -16810502,
+    -16810502, -17076811, -17076811, -17347381, -17076811, -17076811, -17076811, -17076811, -16810502, -16810502, -16810502, -16810502,
+    -7606858, -33026, -99340, -33026, -233554, -166181, -166181, -166181, -99340, -33026, -99340, -99340,
+    -233554, -166181, -166181, -166181, -99340, -99340, -233554, -166181, -166181, -233554, -166181, -99340,
+    -233554, -99340, -99340, -233554, -233554, -233554, -166181, -99340, -166181, -166181, -33026, -301466,
+    -166181, -166181, -166181, -166181, -166181, -233554, -166181, -166181, -166181, -233554, -99340, -99340,
+    -99340, -166181, 32768, -166181, -166181, -99340, -233554, -233554, -301466, -301466, -301466, -233554,
+    -166181, -233554, -233554, -166181, -166181, -233554, -99340, -166181, -33026, -99340, -166181, -508501,
+    -13056102, -16810502, -16810502, -16810502, -16810502, -17076811, -17347381, -17076811, -17076811, -17076811, -16810502, -16810502,
+    -17076811, -17076811, -17076811, -17076811, -17076811, -17076811, -16810502, -16810502, -16810502, -16810502, -16810502, -13265965,
+    -1236474, -99340, -33026, -166181, -166181, -233554, -301466, -166181, -33026, -166181, -233554, -166181,
+    -99340, -233554, -166181, -166181, -166181, -166181, -166181, -166181, -166181, -99340, -166181, -233554,
+    -166181, -233554, -99340, -166181, -166181, -233554, -166181, -33026, -166181, -99340, -99340, -166181,
+    -33026, -99340, -33026, -233554, -166181, -233554, -99340, -166181, -166181, -166181, -166181, -33026,
+    -166181, -166181, -99340, -166181, -166181, -166181, -233554, -166181, -233554, -233554, -99340, -166181,
+    -233554, -233554, -166181, -166181, -166181, -99340, -233554, -233554, -166181, -166181, -166181, -99340,
+    -2365321, -16810502, -16810502, -16810502, -17076811, -17076811, -16810502, -17076811, -17076811, -17076811, -16810502, -16810502,
+    -17076811, -17076811, -16810502, -17076811, -17076811, -16810502, -17076811, -16810502, -16810502, -17076811, -17076811, -1864628,
+    -233554, -233554, -166181, -233554, -233554, -166181, -166181, -233554, -166181, -166181, -166181, -166181,
+    -99340, -233554, -301466, -233554, -99340, -166181, -99340, -166181, -166181, -166181, -166181, -166181,
+    -166181, -233554, -99340, -233554, -166181, -99340, -99340, -166181, -99340, -166181, -233554, -99340,
+    -33026, -33026, -99340, -33026, -99340, -166181, -166181, -233554, -166181, -166181, -99340, -99340,
+    -99340, -99340, -99340, -99340, -233554, -166181, -166181, -166181, -99340, -99340, -233554, -233554,
+    -166181, -166181, -166181, -166181, -166181, -99340, -166181, -166181, -166181, -166181, -166181, -166181,
+    -99340, -6670269, -16810502, -16810502, -17076811, -17347381, -16810502, -17076811, -17076811, -17076811, -16810502, -16810502,
+    -17076811, -17076811, -17076811, -17076811, -16810502, -16810502, -16810502, -16810502, -16810502, -17076811, -5803057, -99340,
+    -233554, -233554, -166181, -99340, -166181, -233554, -166181, -233554, -233554, -233554, -233554, -233554,
+    -99340, -233554, -33026, -233554, -233554, -166181, -166181, -166181, -166181, -166181, -166181, -166181,
+    -166181, -233554, -233554, -99340, -99340, -166181, -166181, -99340, -166181, -99340, -33026, -99340,
+    -99340, -166181, -33026, -166181, -99340, -166181, -166181, -166181, -99340, -166181, -99340, -233554,
+    -99340, -166181, -99340, -99340, -233554, -99340, -166181, -166181, -233554, -233554, -166181, -99340,
+    -301466, -99340, -33026, -166181, -166181, -166181, -99340, -166181, -166181, -166181, -166181, -233554,
+    -33026, -578635, -13265965, -16810502, -17347381, -17076811, -17076811, -17347381, -17076811, -17076811, -16810502, -17076811,
+    -17076811, -17076811, -17076811, -17076811, -17076811, -16810502, -16810502, -16810502, -17076811, -13478805, -233554, -166181,
+    -301466, -233554, -166181, -166181, -166181, -301466, -233554, -99340, -166181, -301466, -166181, -166181,
+    -166181, -166181, -99340, -166181, -166181, -166181, -99340, -233554, -233554, -166181, -166181, -166181,
+    -166181, -166181, -99340, -99340, -99340, -166181, -166181, -233554, -301466, -166181, -166181, -233554,
+    -99340, -233554, -99340, -301466, -99340, -166181, -166181, -166181, -99340, -166181, -166181, -233554,
+    -166181, -233554, -166181, -99340, -233554, -166181, -166181, -166181, -233554, -233554, -233554, -166181,
+    -233554, -233554, -99340, -99340, -99340, -233554, -166181, -166181, -166181, -166181, -233554, -166181,
+    -99340, -99340, -2538260, -17076811, -17076811, -17347381, -17076811, -17347381, -17076811, -17347381, -16810502, -17076811,
+    -17076811, -17076811, -17076811, -17076811, -17076811, -17076811, -16810502, -17076811, -17076811, -3262493, -99340, -99340,
+    -99340, -99340, -233554, -233554, -99340, -233554, -33026, -166181, -99340, -166181, -99340, -99340,
+    -233554, -99340, -33026, -99340, -99340, -233554, -166181, -166181, -166181, -166181, -166181, -166181,
+    -99340, -166181, -99340, -166181, -99340, -99340, -99340, -166181, -233554, -166181, -233554, -33026,
+    -166181, -301466, -166181, -166181, -166181, -166181, -166181, -166181, -233554, -233554, -33026, -166181,
+    -99340, -33026, -166181, -233554, -301466, -233554, -233554, -166181, -166181, -233554, -166181, -166181,
+    -166181, -99340, -166181, -166181, -166181, -233554, -99340, -99340, -166181, -166181, 32768, -99340,
+    -33026, -99340, -33026, -8927109, -16810502, -16810502, -16810502, -16810502, -17076811, -17347381, -16810502, -17076811,
+    -17076811, -17076811, -17076811, -17076811, -17076811, -17076811, -16810502, -17076811, -7888376, -233554, -166181, -166181,
+    -166181, -301466, -233554, -233554, -166181, -166181, -233554, -166181, -166181, -233554, -166181, -166181,
+    -99340, -166181, -166181, -166181, -166181, -166181, -166181, -233554, -233554, -233554, -99340, -99340,
+    -99340, -33026, -166181, -233554, -166181, -166181, -233554, -233554, -166181, -99340, -99340, -99340,
+    -166181, -301466, -166181, -166181, -99340, -99340, -166181, -233554, -233554, -233554, -99340, -99340,
+    -33026, -99340, -233554, -166181, -233554, -301466, -233554, -99340, -166181, -233554, -166181, -233554,
+    -166181, -99340, -166181, -301466, -233554, -233554, -99340, -99340, -166181, -166181, -233554, -166181,
+    -99340, -99340, -99340, -1160923, -14822061, -16810502, -16810502, -16810502, -16810502, -17076811, -17076811, -17076811,
+    -17347381, -17347381, -17076811, -17076811, -17076811, -17076811, -17076811, -17076811, -1160923, -166181, -166181, -166181,
+    -33026, -233554, -99340, -166181, -166181, -301466, -166181, -166181, -99340, -233554, -166181, -301466,
+    -166181, -99340, -166181, -166181, -166181, -233554, -166181, -166181, -233554, -233554, -233554, -99340,
+    -33026, -33026, -166181, -166181, -166181, -166181, -166181, -166181, -166181, -166181, -99340, -99340,
+    -99340, -233554, -233554, -233554, -99340, -166181, -233554, -233554, -166181, -301466, -166181, -166181,
+    -233554, -233554, -166181, -99340, -166181, -99340, -99340, -233554, -99340, -166181, -99340, -99340,
+    -33026, -166181, -166181, -166181, -99340, -166181, -166181, -166181, -233554, -166181, -166181, -233554,
+    -166181, -166181, -166181, -166181, -5684386, -16810502, -16810502, -16810502, -16810502, -16810502, -17076811, -17347381,
+    -17076811, -17076811, -17076811, -17076811, -17347381, -17076811, -17076811, -7888376, -233554, -233554, -233554, -166181,
+    -166181, -301466, -166181, -166181, -99340, -166181, -99340, -166181, -99340, -166181, -33026, -99340,
+    -99340, -99340, -166181, -166181, -99340, -166181, -301466, -166181, -166181, -166181, -166181, -166181,
+    -166181, -166181, -166181, -166181, -166181, -166181, -166181, -166181, -233554, -166181, -233554, -233554,
+    -166181, -166181, -166181, -166181, -166181, -166181, -233554, -166181, -233554, -233554, -99340, -233554,
+    -166181, -233554, -99340, -233554, -99340, -99340, 32768, -99340, -99340, -166181, -99340, -233554,
+    -99340, -99340, -166181, -166181, -99340, -233554, -166181, -166181, -166181, -166181, -301466, -233554,
+    -166181, -233554, -233554, -233554, -578635, -15057632, -16810502, -16810502, -17347381, -17076811, -16810502, -17076811,
+    -17347381, -17076811, -17076811, -17076811, -17076811, -17076811, -13265965, -1312664, -166181, -166181, -301466, -233554,
+    -233554, -166181, -166181, -166181, -99340, -166181, -166181, -233554, -99340, -99340, -301466, -166181,
+    -233554, -301466, -166181, -166181, -166181, -166181, -166181, -99340, -166181, -166181, -166181, -166181,
+    -233554, -166181, -166181, -166181, -166181, -166181, -166181, -166181, -99340, -166181, -233554, -233554,
+    -166181, -166181, -166181, -233554, -99340, -166181, -166181, -233554, -166181, -99340, -166181, -166181,
+    -99340, -166181, -33026, -99340, -99340, -99340, 32768, -166181, -166181, -166181, 32768, -99340,
+    -99340, -99340, -99340, -99340, -33026, -99340, -99340, -166181, -166181, -233554, -233554, -233554,
+    -233554, -233554, -166181, -166181, -99340, -5684386, -17076811, -17076811, -17076811, -17076811, -16810502, -17076811,
+    -17076811, -17076811, -16810502, -17076811, -17076811, -17076811, -5684386, -166181, -301466, -301466, -233554, -166181,
+    -233554, -166181, -99340, -99340, -166181, -166181, -99340, -301466, -166181, -166181, -166181, -99340,
+    -166181, -166181, -166181, -233554, -166181, -166181, -166181, -166181, -233554, -233554, -166181, -166181,
+    -233554, -166181, -166181, -166181, -233554, -233554, -166181, -166181, -233554, -166181, -33026, -99340,
+    -166181, -166181, -166181, -233554, -166181, -166181, -166181, -166181, -166181, -301466, -99340, -99340,
+    -99340, -33026, -33026, -33026, -166181, -33026, -33026, -99340, -99340, -166181, -166181, -33026,
+    -166181, -166181, -233554, -99340, -33026, -99340, -99340, -166181, -166181, -233554, -233554, -233554,
+    -301466, -233554, -166181, -233554, -99340, -649341, -15057632, -17076811, -17076811, -17076811, -16810502, -17076811,
+    -17076811, -17076811, -16810502, -16810502, -17076811, -17076811, -1312664, -99340, -233554, -301466, -233554, -166181,
+    -166181, -166181, -166181, -99340, -99340, -166181, -233554, -233554, -166181, -301466, -33026, -166181,
+    -233554, -166181, -233554, -166181, -166181, -166181, -166181, -233554, -233554, -233554, -233554, -166181,
+    -233554, -99340, -166181, -166181, -166181, -233554, -99340, -166181, -166181, -233554, -99340, -99340,
+    -166181, -166181, -166181, -99340, -233554, -166181, -166181, -166181, -233554, -99340, -99340, -33026,
+    -99340, -99340, -99340, -99340, -99340, -233554, -99340, -33026, -33026, -166181, -166181, -99340,
+    -99340, -166181, -166181, -233554, -99340, -99340, -99340, -99340, -166181, -166181, -233554, -233554,
+    -233554, -233554, -166181, -166181, -99340, -99340, -5803057, -17076811, -16810502, -17076811, -16810502, -17076811,
+    -17076811, -16810502, -17076811, -16810502, -17076811, -7888376, -233554, -233554, -166181, -233554, -166181, -166181,
+    -233554, -233554, -233554, -166181, -99340, -166181, -99340, -33026, -33026, -166181, -33026, -99340,
+    -233554, -99340, -99340, -233554, -166181, -233554, -166181, -233554, -233554, -166181, -233554, -233554,
+    -166181, -166181, -166181, -166181, -166181, -301466, -166181, -166181, -166181, -166181, -33026, -99340,
+    -233554, -166181, -166181, -166181, -99340, -166181, -166181, -233554, -369923, -166181, -166181, -166181,
+    32768, -99340, -166181, 32768, -99340, -233554, -99340, -33026, -166181, -301466, -233554, -99340,
+    -166181, -99340, 32768, -99340, -166181, -99340, -33026, -99340, -166181, -166181, -233554, -233554,
+    -233554, -233554, -166181, -99340, -99340, -99340, -1236474, -17076811, -17076811, -17076811, -17076811, -17076811,
+    -17076811, -17076811, -17076811, -17076811, -17076811, -1236474, -166181, -233554, -233554, -233554, -301466, -166181,
+    -166181, -301466, -166181, -166181, -166181, -33026, -33026, -99340, -233554, -99340, -99340, -33026,
+    -33026, -233554, -99340, -233554, -233554, -166181, -166181, -166181, -233554, -166181, -233554, -233554,
+    -233554, -166181, -233554, -166181, -166181, -233554, -166181, -166181, -166181, -166181, -99340, -99340,
+    -166181, -166181, -99340, -166181, -166181, -99340, -33026, -166181, -166181, -166181, -166181, -166181,
+    -33026, -33026, -166181, -99340, -99340, -99340, -33026, -99340, -166181, -166181, -99340, -99340,
+    -166181, -166181, -33026, -33026, -166181, -99340, 32768, -99340, -99340, -166181, -166181, -166181,
+    -166181, -166181, -166181, -166181, -166181, -166181, -99340, -10226936, -16810502, -16810502, -17076811, -17076811,
+    -17076811, -17076811, -16810502, -17076811, -8927109, -233554, -166181, -233554, -233554, -233554, -233554, -233554,
+    -301466, -301466, -233554, -233554, -33026, -166181, -99340, -166181, -99340, -99340, -33026, -166181,
+    -99340, -166181, -166181, -99340, -166181, -166181, -233554, -233554, -99340, -166181, -233554, -166181,
+    -166181, -166181, -166181, -166181, -166181, -233554, -166181, -166181, -166181, -166181, -33026, -99340,
+    -166181, -166181, -233554, -166181, -166181, -166181, -166181, -166181, -166181, -166181, -233554, -233554,
+    -99340, -99340, -99340, -166181, -33026, -99340, -99340, -166181, -233554, -166181, -166181, -166181,
+    -166181, -166181, -99340, -99340, -33026, -99340, -33026, -99340, -166181, -99340, -99340, -166181,
+    -166181, -166181, -166181, -166181, -233554, -233554, -99340, -2365321, -16810502, -16810502, -17076811, -17076811,
+    -17076811, -17347381, -16810502, -17076811, -3169003, -166181, -166181, -99340, -99340, -233554, -301466, -33026,
+    -166181, -166181, -166181, -166181, -301466, -233554, -33026, -99340, 32768, -33026, -99340, -166181,
+    -99340, -233554, 32768, -99340, -166181, -233554, -166181, -166181, -166181, -99340, -166181, -166181,
+    -166181, -166181, -166181, -166181, -166181, -166181, -166181, -166181, -166181, -166181, -166181, -166181,
+    -166181, -166181, -99340, -99340, -99340, -233554, -301466, -166181, -99340, -99340, -166181, -166181,
+    -99340, -33026, -99340, -166181, -33026, -99340, -99340, -99340, -99340, -99340, -99340, -166181,
+    -99340, -166181, -99340, -99340, -99340, -99340, -99340, -99340, -233554, -166181, -233554, -233554,
+    -233554, -233554, -166181, -166181, -99340, -301466, -166181, -166181, -15057632, -17076811, -17076811, -17076811,
+    -17076811, -17347381, -17076811, -13265965, -233554, -166181, -166181, -166181, -166181, -233554, -166181, -166181,
+    -166181, -166181, -166181, -166181, -301466, -233554, -33026, -33026, -99340, -99340, -33026, -99340,
+    -33026, -99340, -166181, -166181, -99340, -99340, -166181, -99340, -166181, -233554, -166181, -166181,
+    -166181, -99340, -99340, -166181, -99340, -99340, -99340, -33026, -166181, -99340, -99340, -99340,
+    -166181, -301466, -99340, -233554, -233554, -301466, -301466, -233554, -166181, -233554, -166181, -166181,
+    -99340, -99340, -99340, -166181, 32768, -166181, -166181, -33026, -33026, -99340, -233554, -99340,
+    -166181, -99340, -33026, -99340, -166181, -33026, -33026, -33026, -166181, -166181, -166181, -233554,
+    -233554, -233554, -166181, -301466, -166181, -166181, -166181, -99340, -6799632, -17076811, -17076811, -17076811,
+    -17076811, -17076811, -17076811, -7888376, -233554, -233554, -166181, -166181, -301466, -233554, -233554, -166181,
+    -166181, -166181, -166181, -99340, -233554, -233554, -99340, -99340, -99340, -233554, -99340, -166181,
+    -99340, -33026, -166181, -301466, -233554, -233554, -99340, -99340, -166181, -233554, -233554, -166181,
+    -233554, -233554, -99340, -301466, -99340, -166181, -166181, -166181, -99340, -99340, -99340, -99340,
+    -233554, -233554, -166181, -233554, -166181, -166181, -233554, -233554, -233554, -233554, -166181, -166181,
+    -99340, -166181, -33026, -99340, -33026, -99340, -99340, -99340, -166181, -99340, -99340, -233554,
+    -166181, -99340, 32768, -99340, -99340, -99340, -99340, -99340, -33026, -166181, -233554, -233554,
+    -99340, -99340, -166181, -99340, -166181, -166181, -166181, -166181, -2538260, -17076811, -17076811, -17076811,
+    -16810502, -17076811, -16810502, -2538260, -99340, -233554, -99340, -166181, -233554, -166181, -233554, -233554,
+    -233554, -233554, -166181, -99340, -99340, -166181, -33026, -33026, -33026, -99340, -99340, -99340,
+    -99340, -166181, -99340, -166181, -99340, -99340, -33026, -99340, -301466, -33026, -33026, 32768,
+    -33026, -33026, -33026, -99340, 32768, -99340, -33026, -33026, -166181, -233554, -99340, -99340,
+    -166181, -166181, -166181, -166181, -99340, -233554, -233554, -233554, -233554, -233554, -166181, -301466,
+    -166181, -233554, -99340, -166181, -166181, -99340, 32768, -33026, -233554, -166181, 32768, -99340,
+    -166181, -33026, -99340, -99340, -99340, -166181, -99340, -99340, -99340, -33026, -99340, -233554,
+    -33026, -166181, -99340, -166181, -166181, -99340, -166181, -166181, -99340, -15057632, -16810502, -17076811,
+    -17076811, -17076811, -13265965, -99340, -166181, -166181, -166181, -166181, -233554, -233554, -301466, -233554,
+    -233554, -233554, -33026, -33026, -166181, -99340, -99340, -99340, -33026, -99340, -33026, 32768,
+    32768, -166181, -99340, -99340, -33026, -99340, -99340, -99340, -99340, -166181, -33026, -33026,
+    -99340, -166181, 32768, -99340, -33026, -33026, -99340, -166181, -166181, -99340, -166181, -99340,
+    -233554, -233554, -166181, -166181, -166181, -166181, -166181, -166181, -99340, -166181, -166181, -166181,
+    -233554, -166181, -166181, -166181, -166181, -99340, -99340, -301466, -99340, -166181, -99340, -99340,
+    -99340, -166181, -99340, -99340, -99340, -33026, -166181, -233554, -166181, -99340, 32768, -99340,
+    -99340, -166181, -166181, -166181, -166181, -233554, -166181, -166181, -99340, -7888376, -17076811, -17076811,
+    -17076811, -17076811, -7606858, -99340, -166181, -301466, -233554, -99340, -233554, -233554, -166181, -233554,
+    -301466, -99340, -99340, -99340, -166181, -166181, -301466, -233554, -33026, -233554, -99340, -99340,
+    -166181, -233554, -301466, -166181, -99340, -301466, -99340, -99340, -33026, -99340, -99340, -99340,
+    -99340, -99340, -99340, -99340, -99340, -166181, -99340, -166181, -99340, -99340, -99340, -166181,
+    -166181, -233554, -99340, -166181, -99340, -166181, -99340, -99340, -166181, -99340, -166181, -233554,
+    -99340, -233554, -233554, -166181, -166181, 32768, -33026, -166181, -99340, -33026, 32768, -99340,
+    -99340, -99340, -99340, -99340, -33026, -166181, -166181, -166181, -166181, -99340, -99340, -33026,
+    -166181, -166181, -166181, -99340, -166181, -233554, -166181, -166181, -166181, -3942341, -17076811, -17076811,
+    -17076811, -17076811, -3262493, -166181, -233554, -233554, -166181, -99340, -166181, -233554, -233554, -233554,
+    -166181, -166181, -233554, -233554, -99340, -99340, -233554, -166181, -33026, -166181, -99340, -99340,
+    -166181, -99340, -166181, -166181, -33026, -99340, -33026, -99340, -99340, -99340, -33026, -99340,
+    -99340, -33026, -99340, -99340, -99340, -99340, -33026, -33026, -99340, -99340, -33026, -99340,
+    -99340, -166181, -166181, -99340, -99340, -233554, -166181, -166181, -166181, -166181, -233554, -166181,
+    -233554, -166181, -166181, -166181, -233554, -166181, -166181, -99340, -166181, -33026, -99340, -166181,
+    -99340, -99340, -166181, -166181, -166181, -166181, -166181, -166181, -166181, -233554, -166181, -166181,
+    -166181, -166181, -233554, -233554, -166181, -166181, -166181, -99340, -99340, -578635, -16810502, -17076811,
+    -17076811, -17076811, -1160923, -233554, -233554, -233554, -166181, -233554, -99340, -233554, -166181, -99340,
+    -166181, -166181, -166181, -166181, -99340, -99340, -99340, -99340, -33026, -99340, -166181, -33026,
+    -33026, -33026, 32768, -33026, -99340, -99340, -166181, -99340, -99340, -33026, -99340, -166181,
+    -166181, -166181, -166181, -166181, -99340, -33026, -99340, -233554, -33026, -99340, 32768, -99340,
+    -166181, -166181, -166181, -166181, -99340, -166181, -166181, -233554, -99340, -166181, -233554, -166181,
+    -166181, -301466, -99340, -166181, -99340, -166181, 32768, -99340, -33026, -99340, -166181, -99340,
+    -99340, -99340, -99340, -166181, -99340, -166181, -233554, -99340, -33026, -166181, -233554, -233554,
+    -99340, -166181, -233554, -233554, -166181, -233554, -166181, -166181, -99340, -166181, -4778171, -13056102,
+    -15057632, -4887423, -166181, -233554, -233554, -166181, -99340, -33026, -166181, -166181, -99340, -233554,
+    -166181, -99340, -233554, -166181, -166181, -99340, -99340, -99340, -99340, -99340, -33026, -166181,
+    -166181, -33026, -99340, -99340, -33026, -99340, -166181, -233554, -33026, -33026, -99340, -166181,
+    -166181, -166181, -166181, -166181, -33026, -33026, -233554, -166181, -33026, -99340, -99340, -99340,
+};
+
+inline constexpr int32_t blend_add_scale_96[96 * 96] = {
+    64508, 64765, 64508, 64765, 64765, 64765, 64765, 64508, 65536, 64765, 64765, 64508,
+    64765, 65022, 64251, 65022, 65022, 65022, 65536, 65022, 65279, 65279, 65279, 65279,
+    64765, 65022, 64765, 64508, 65022, 64765, 64765, 64765, 64765, 64765, 64765, 65022,
+    64765, 65022, 65536, 65279, 65279, 65279, 65279, 65279, 65022, 65022, 50887, 34439,
+    36495, 50373, 65279, 64765, 65536, 65022, 65279, 65022, 64508, 64508, 65022, 64508,
+    64765, 64765, 64508, 64765, 64765, 64765, 65022, 64508, 64508, 64508, 65022, 64765,
+    65279, 64765, 65022, 65022, 65279, 65022, 64765, 64765, 65022, 64765, 64765, 64508,
+    64765, 64765, 64508, 64508, 64765, 64765, 64765, 64765, 64508, 64251, 64508, 64508,
+    64765, 64508, 65022, 64765, 65279, 64765, 64765, 64508, 65022, 65022, 64765, 64765,
+    65279, 65022, 64508, 64765, 65022, 65022, 65279, 65279, 65536, 65279, 65536, 65536,
+    65022, 65022, 64765, 64765, 65279, 64765, 64765, 65022, 64765, 64251, 64765, 64765,
+    65279, 65536, 65536, 65536, 65279, 65536, 65536, 65536, 65022, 61424, 32639, 32639,
+    32382, 32382, 63223, 65022, 65536, 65279, 65022, 65022, 65022, 64765, 64765, 65022,
+    65022, 65022, 64765, 64508, 64765, 64765, 65279, 65279, 65022, 65022, 65022, 65279,
+    65022, 65536, 65022, 65536, 65279, 65279, 64508, 64508, 64765, 64765, 64765, 64765,
+    65022, 64765, 64508, 64765, 64765, 64765, 63994, 64251, 64508, 64251, 64508, 64251,
+    65279, 65536, 65022, 65279, 65022, 64508, 64765, 65022, 65536, 65279, 65279, 64765,
+    65279, 65279, 65279, 65279, 65022, 65022, 65279, 65536, 65279, 65279, 65536, 65279,
+    65279, 65279, 65536, 65279, 65022, 65022, 65022, 64765, 64765, 64508, 64765, 64765,
+    65536, 65279, 65536, 65279, 65536, 65536, 65279, 65022, 65022, 54999, 32639, 32639,
+    32382, 32639, 52943, 65536, 65536, 65279, 65022, 65279, 65536, 65536, 65279, 65279,
+    65022, 64251, 64508, 64765, 64508, 64508, 65022, 65536, 65279, 65022, 65022, 64765,
+    64508, 64508, 65022, 64765, 64251, 64765, 65022, 65022, 64508, 64508, 64765, 64765,
+    64765, 64508, 64508, 64508, 64765, 65022, 64508, 64765, 64508, 64508, 64765, 64765,
+    65536, 65279, 65279, 65022, 65022, 64251, 65022, 64765, 65536, 65279, 65022, 65022,
+    65536, 65536, 65536, 65022, 65022, 65279, 65536, 65279, 65536, 65279, 65279, 65536,
+    65279, 65022, 65279, 65279, 65536, 65279, 64508, 64765, 65022, 64508, 65279, 65022,
+    65536, 65279, 65536, 65536, 65536, 65279, 65022, 65022, 64765, 44462, 32639, 32639,
+    32382, 32382, 44976, 65279, 65279, 65279, 65279, 65279, 65536, 65536, 65279, 65022,
+    64508, 64508, 64765, 65022, 64765, 64508, 64508, 65022, 65022, 64765, 65022, 64765,
+    64508, 64508, 64508, 64508, 64765, 64508, 65022, 64765, 64508, 64251, 64508, 65022,
+    65279, 64765, 64765, 64251, 64508, 64765, 64508, 64765, 64251, 64508, 64765, 64765,
+    65536, 65536, 65279, 64765, 64251, 64508, 64508, 64765, 65279, 65022, 65279, 65279,
+    65536, 65536, 64765, 65279, 64765, 64765, 65536, 65022, 65279, 65279, 65536, 65022,
+    65536, 65279, 65536, 65536, 65536, 65022, 64508, 64765, 65022, 65022, 64765, 65022,
+    65022, 65279, 64508, 64765, 65536, 65279, 65536, 65279, 64765, 36238, 32639, 32639,
+    32639, 32639, 34439, 65022, 64765, 65279, 65022, 64765, 65279, 65022, 64765, 64765,
+    64508, 64508, 64508, 64765, 64508, 64508, 64765, 65022, 65279, 65279, 64765, 64508,
+    64251, 64508, 64508, 64508, 64508, 64508, 64508, 64765, 64765, 64765, 65279, 65536,
+    64765, 65022, 64765, 64508, 64765, 64765, 65022, 64251, 64508, 64251, 64508, 64765,
+    65279, 65536, 64765, 64765, 64765, 64508, 64508, 64508, 64765, 65022, 64508, 64508,
+    65536, 65279, 65279, 65279, 65022, 64765, 65022, 65279, 65536, 65022, 65022, 65279,
+    65279, 65279, 65279, 65536, 65279, 65022, 64508, 64508, 64508, 64508, 65279, 64508,
+    64251, 65022, 64508, 65536, 65022, 64508, 65022, 65022, 57055, 32382, 32639, 32639,
+    32639, 32639, 32639, 56798, 65022, 65022, 65022, 64765, 64765, 65022, 65279, 65022,
+    64765, 64508, 64765, 64765, 64765, 64508, 64765, 65022, 65022, 65279, 64765, 64765,
+    64765, 64508, 64508, 64508, 64251, 64765, 65022, 64765, 64508, 64508, 65022, 65279,
+    64765, 64508, 64765, 64765, 64765, 64765, 64508, 64508, 64765, 64508, 64765, 64765,
+    65279, 65022, 65279, 65279, 64508, 64508, 64765, 64765, 64508, 64765, 65536, 65279,
+    65536, 65022, 65022, 65279, 65279, 64765, 65279, 65279, 65022, 64765, 64765, 64765,
+    64765, 65022, 65536, 65279, 65022, 64765, 65022, 65022, 65022, 64765, 65022, 65279,
+    64508, 65022, 65279, 65022, 65279, 65022, 65022, 65022, 44462, 32382, 32639, 32639,
+    32639, 32382, 32639, 46775, 65022, 65022, 65022, 65022, 64508, 64765, 65022, 65279,
+    65022, 65022, 64765, 64765, 64251, 64765, 64508, 65022, 65022, 64765, 65022, 64765,
+    64765, 64765, 64765, 64508, 64765, 65022, 65022, 64765, 64765, 64765, 65022, 64765,
+    65022, 64765, 63994, 64251, 64508, 64508, 64765, 64765, 64765, 64508, 64765, 64765,
+    65279, 64765, 65022, 65022, 64765, 64765, 65022, 64508, 64508, 65022, 65022, 65279,
+    65022, 64765, 64508, 65279, 65279, 65536, 65022, 64765, 64765, 64765, 65279, 65022,
+    64765, 65536, 65022, 65022, 65022, 65022, 65279, 65279, 64765, 65279, 65279, 65279,
+    65536, 65279, 65279, 65279, 65279, 65022, 65022, 65279, 36495, 32382, 32639, 32639,
+    32382, 32639, 32639, 34439, 65022, 65022, 65022, 65022, 64508, 64765, 64765, 64508,
+    64765, 65022, 64765, 65022, 64765, 64765, 65279, 65022, 65022, 65022, 65022, 65279,
+    64765, 64508, 64765, 64765, 64508, 65022, 65279, 64765, 64765, 65022, 64765, 64508,
+    64765, 64508, 64765, 64251, 64251, 64508, 64508, 64508, 64765, 64508, 64765, 64765,
+    64765, 65022, 65022, 65022, 65279, 65022, 64508, 64765, 65279, 64765, 65022, 64765,
+    65022, 65022, 64508, 65279, 65279, 65022, 64765, 64508, 65279, 65022, 65022, 65022,
+    65022, 65536, 65022, 65022, 65022, 64765, 65022, 64765, 64508, 64765, 65022, 65279,
+    65279, 65279, 65022, 65279, 64508, 64765, 64765, 54742, 32639, 32382, 32639, 32639,
+    32382, 32382, 32639, 32639, 57055, 64765, 65022, 65279, 64765, 64765, 65022, 64765,
+    64765, 64765, 64765, 64765, 65022, 64765, 65022, 65279, 65279, 65279, 65279, 64765,
+    64765, 65022, 64508, 65022, 65279, 65536, 65279, 65279, 64508, 64765, 64765, 64508,
+    64765, 65022, 64508, 64251, 64508, 65022, 65022, 64508, 64508, 64251, 64508, 64508,
+    65279, 64765, 65279, 65279, 65536, 65279, 64765, 65022, 65279, 64765, 65279, 65022,
+    65022, 64765, 65022, 65022, 65279, 65022, 64765, 64508, 65022, 64765, 65536, 65279,
+    65536, 65022, 65022, 65022, 65022, 65022, 65022, 65022, 64765, 64765, 65279, 65279,
+    65536, 65279, 65279, 65279, 65022, 64765, 64765, 42663, 32382, 32639, 32639, 32639,
+    32382, 32382, 32639, 32639, 40607, 65022, 65536, 65279, 64765, 64508, 64508, 64765,
+    64765, 64765, 65022, 65022, 64765, 65022, 65279, 65279, 65536, 65022, 65022, 64765,
+    65022, 64765, 65022, 64508, 65536, 65279, 65022, 65022, 64765, 64508, 64508, 64508,
+    64508, 64508, 64251, 64508, 65022, 64508, 64765, 64765, 64765, 63994, 64508, 64508,
+    64765, 65022, 64508, 64765, 65279, 65279, 65279, 65279, 64765, 64765, 65022, 65022,
+    65279, 65279, 65279, 65022, 64765, 64765, 65022, 64508, 65279, 65279, 65279, 65279,
+    65279, 64765, 65022, 64508, 65022, 65022, 65279, 64508, 64765, 64765, 65279, 65279,
+    65536, 65279, 65536, 65279, 65022, 64508, 61167, 32639, 32639, 32639, 32639, 32639,
+    32639, 32382, 32639, 32639, 32639, 61167, 65279, 65022, 65022, 65022, 64765, 65279,
+    65022, 65022, 65022, 65279, 65279, 65279, 65279, 64765, 65279, 65279, 65279, 65022,
+    65022, 65279, 65022, 65022, 65022, 64508, 64508, 64765, 64765, 64765, 64765, 65022,
+    64508, 64508, 64765, 65022, 64765, 64765, 64765, 64508, 65022, 64765, 65022, 64765,
+    64765, 65022, 64765, 64765, 65279, 65279, 65279, 65279, 65022, 64765, 65279, 65022,
+    65022, 65279, 65279, 65022, 64765, 64765, 65022, 65022, 65279, 64765, 65279, 65536,
+    65022, 64508, 64765, 64765, 65022, 65022, 64765, 64765, 65022, 64765, 65279, 65022,
+    65279, 65279, 65279, 65279, 65022, 64765, 44976, 32639, 32639, 32639, 32639, 32382,
+    32639, 32382, 32639, 32639, 32639, 48574, 65022, 65022, 65279, 65536, 65022, 64508,
+    64765, 64508, 65022, 65022, 65022, 65022, 65279, 65022, 65279, 65279, 64765, 65022,
+    65022, 64765, 65536, 65022, 65279, 64508, 64508, 64508, 64765, 64765, 65022, 65022,
+    64765, 64508, 65279, 64765, 65279, 64765, 65022, 64765, 64765, 64765, 64508, 64251,
+    65279, 65279, 65279, 65022, 65536, 65279, 65022, 65022, 65022, 65536, 65536, 65279,
+    65022, 64765, 65536, 65022, 65279, 65022, 65279, 65536, 64765, 64765, 64765, 65536,
+    65536, 65279, 64765, 65022, 64765, 64765, 64765, 65022, 65536, 65279, 65022, 65279,
+    65022, 65536, 65536, 65022, 65536, 61167, 32382, 32382, 32639, 32639, 32639, 32639,
+    32639, 32382, 32639, 32639, 32639, 34439, 63480, 65279, 65279, 65022, 65022, 65022,
+    65022, 65022, 65022, 65279, 65536, 64765, 65022, 65279, 65022, 65279, 64508, 64765,
+    64765, 65022, 65279, 65022, 65279, 64508, 64765, 65022, 65022, 65022, 64765, 64765,
+    65022, 64508, 64508, 64508, 64765, 64508, 64508, 63994, 64765, 64765, 64765, 64765,
+    65279, 65022, 65536, 65022, 65279, 65536, 65022, 64765, 65022, 65279, 65536, 65022,
+    64765, 64765, 65022, 65022, 65022, 65022, 65279, 65022, 65022, 64765, 65536, 65536,
+    65279, 65022, 64765, 65022, 64765, 65022, 64765, 64765, 65022, 65279, 65279, 65279,
+    65536, 65022, 65279, 65022, 64765, 48831, 32639, 32382, 32639, 32639, 32639, 32639,
+    32382, 32382, 32382, 32639, 32639, 32639, 48831, 65022, 65022, 65022, 65279, 64508,
+    64508, 64508, 65022, 65279, 65279, 65022, 64765, 65279, 65279, 65022, 64508, 64765,
+    64508, 64765, 65022, 65279, 65279, 65279, 65022, 65022, 64765, 64765, 64765, 64765,
+    65022, 64765, 64765, 64765, 65022, 64508, 64508, 64251, 64508, 64765, 64765, 64765,
+    65022, 65279, 65279, 65279, 64765, 64508, 65279, 65279, 65279, 65022, 65279, 65022,
+    64765, 64508, 65022, 65279, 65022, 65022, 65022, 65279, 64765, 64508, 65536, 65536,
+    65279, 65022, 64765, 64765, 64765, 64508, 64765, 64765, 65536, 65279, 65536, 65279,
+    65536, 65536, 64508, 64508, 60910, 36495, 32382, 32382, 32639, 32639, 32639, 32382,
+    32382, 32382, 32125, 32382, 32382, 32639, 34439, 63223, 65022, 64251, 64508, 64508,
+    64765, 65022, 64508, 64508, 65022, 64765, 65022, 64508, 65279, 64765, 64508, 64508,
+    64508, 65022, 65022, 65022, 65022, 64765, 64765, 64765, 64508, 64508, 64765, 64765,
+    64508, 64508, 64251, 64508, 64251, 63994, 64508, 65022, 64508, 64508, 64765, 64765,
+    65022, 64765, 65022, 65022, 64765, 64251, 64765, 65279, 65022, 65279, 65279, 65536,
+    65022, 65279, 65022, 65279, 64765, 64765, 65022, 65022, 64765, 65022, 65022, 65279,
+    65022, 65022, 64765, 65279, 65022, 64508, 64508, 64765, 65022, 65279, 65279, 65022,
+    65022, 65022, 64765, 64508, 44462, 32382, 32382, 32382, 32639, 32639, 32382, 32382,
+    32382, 32125, 32639, 32382, 32382, 32382, 32382, 48574, 64765, 65279, 64765, 64508,
+    65022, 64765, 63994, 64765, 65022, 65279, 65279, 65022, 64765, 64508, 64765, 64508,
+    64508, 65022, 65022, 65279, 64765, 64765, 64765, 64508, 64765, 64508, 64765, 64508,
+    64251, 63994, 64765, 64508, 65022, 64251, 64765, 64508, 64765, 64251, 64765, 64765,
+    64765, 64765, 65022, 64765, 64765, 64765, 64251, 64765, 65022, 65022, 65536, 65279,
+    65022, 65279, 64508, 64508, 64765, 64765, 65022, 64765, 65279, 65022, 65279, 64765,
+    64765, 65022, 64765, 65022, 65279, 64765, 64508, 64251, 65022, 64765, 65022, 64765,
+    65279, 65022, 64765, 60910, 32382, 32382, 32382, 32382, 32382, 32382, 32639, 32639,
+    32639, 32639, 32639, 32382, 32382, 32382, 32639, 34439, 61167, 64765, 64765, 65022,
+    64765, 64765, 64765, 64508, 64765, 65022, 65279, 64508, 65022, 64765, 64765, 64765,
+    65022, 65022, 65279, 65022, 65022, 64765, 64508, 65022, 65279, 64765, 64765, 64765,
+    64765, 64765, 64765, 64508, 64765, 64765, 64765, 64765, 65022, 64765, 64765, 65279,
+    65022, 64765, 64765, 64765, 64251, 64508, 64765, 64508, 65022, 65022, 65279, 65279,
+    65022, 65279, 64508, 64508, 64508, 64508, 65536, 65022, 64765, 64765, 65022, 64765,
+    65279, 65022, 65279, 65279, 65022, 64765, 65279, 65536, 65022, 64508, 64508, 64765,
+    64765, 64765, 65022, 44462, 32382, 32639, 32382, 32639, 32639, 32382, 32382, 32639,
+    32639, 32639, 32382, 32382, 32639, 32382, 32639, 32639, 42663, 64508, 65022, 65022,
+    65022, 64765, 64765, 65022, 65022, 65022, 65279, 64765, 64508, 65279, 65536, 64765,
+    65279, 65279, 65022, 64765, 64765, 64508, 64508, 64765, 65022, 64765, 65022, 64765,
+    64508, 64765, 64508, 64251, 64765, 64765, 64765, 65022, 64765, 64508, 64765, 64508,
+    65022, 64765, 64508, 64765, 65022, 65022, 64765, 64765, 64508, 65022, 65279, 65279,
+    65536, 65022, 64765, 64251, 64508, 64765, 65279, 64765, 65279, 65279, 65022, 64765,
+    64508, 65022, 64508, 64508, 64765, 65022, 64508, 64508, 64765, 64508, 64251, 64508,
+    64508, 64765, 54999, 32639, 32382, 32639, 32639, 32639, 32639, 32639, 31868, 32382,
+    32639, 32639, 32639, 32382, 32382, 32382, 32639, 32639, 32382, 56798, 65279, 65279,
+    65022, 64508, 65022, 65279, 65022, 65022, 65536, 65022, 65022, 65022, 65022, 65022,
+    64765, 65022, 64765, 64765, 64765, 64765, 64508, 64765, 64765, 64765, 64508, 64508,
+    64765, 65022, 65022, 65022, 64508, 64765, 65022, 64765, 65022, 64765, 64508, 65022,
+    65022, 64508, 64508, 65022, 64508, 64765, 65022, 64765, 64251, 64251, 64508, 65022,
+    65279, 65536, 64765, 64508, 64508, 64765, 65279, 65022, 65022, 65279, 65022, 64765,
+    65022, 65022, 65279, 64508, 65022, 65022, 65536, 65022, 64765, 64765, 65022, 64765,
+    64765, 64765, 36495, 32382, 32639, 32382, 32639, 32639, 32639, 32639, 32382, 32639,
+    32639, 32639, 32382, 32125, 32639, 32382, 32639, 32639, 32382, 36495, 63223, 64765,
+    64765, 64765, 65022, 65022, 65279, 65279, 65279, 65022, 64765, 64765, 65022, 65022,
+    64765, 65022, 64765, 64765, 65022, 64765, 64765, 64765, 64765, 64765, 64765, 64765,
+    64508, 65022, 65022, 64765, 65022, 64765, 64251, 64765, 64765, 64765, 65022, 65022,
+    64765, 64508, 64765, 65022, 65279, 64765, 65279, 65022, 65022, 65022, 64765, 65279,
+    65022, 65022, 65022, 64765, 64765, 65022, 65022, 64765, 65536, 65022, 64765, 64508,
+    64765, 64765, 64508, 64765, 65022, 65022, 65279, 65279, 65279, 65279, 65279, 64765,
+    64508, 48574, 32639, 32382, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639,
+    32639, 32382, 32382, 32382, 32639, 32382, 32382, 32382, 32382, 32639, 46775, 65022,
+    64765, 64765, 65022, 64508, 65279, 65279, 65279, 65279, 64765, 64765, 65022, 64765,
+    65022, 64765, 65022, 64765, 64765, 64765, 65279, 64508, 64508, 64508, 65022, 64508,
+    64251, 64508, 65022, 64765, 65279, 65022, 65022, 65022, 65022, 64251, 65022, 65022,
+    64508, 64508, 65022, 64765, 65022, 64765, 65279, 65022, 65279, 65022, 65022, 65022,
+    65022, 65022, 65022, 65022, 64765, 65279, 65022, 65279, 65279, 65022, 64765, 64765,
+    65022, 64508, 64765, 65022, 65022, 65022, 65279, 65279, 65022, 65536, 64765, 64508,
+    58597, 32382, 32382, 32382, 32382, 32639, 32639, 32639, 32639, 32639, 32639, 32382,
+    32382, 32382, 32382, 32382, 32382, 32639, 32639, 32639, 32125, 32382, 32639, 57055,
+    64765, 64765, 64508, 64508, 65022, 65279, 64765, 64765, 64765, 64508, 64765, 64508,
+    64508, 64765, 65022, 64508, 64765, 64765, 64765, 64765, 64251, 64508, 64765, 64765,
+    64765, 64765, 64765, 65022, 65022, 65022, 65022, 64508, 64508, 64508, 64508, 65022,
+    64765, 64765, 65279, 65279, 65279, 65279, 65279, 65279, 65022, 65022, 65279, 65536,
+    65536, 65536, 64251, 64508, 65022, 65022, 65022, 65279, 64765, 64765, 64765, 65022,
+    64508, 64765, 65279, 65279, 65022, 64765, 64251, 64765, 65536, 65279, 65022, 61167,
+    36238, 32382, 32639, 32382, 32382, 32382, 32639, 32639, 32639, 32639, 32639, 32382,
+    32382, 32382, 32125, 32382, 32382, 32639, 32382, 32382, 32382, 32382, 32639, 36495,
+    62709, 64508, 64251, 64251, 64765, 65022, 65536, 65022, 64765, 64765, 64765, 64765,
+    64508, 64508, 64765, 64765, 64765, 64508, 64765, 64765, 64765, 64251, 65022, 64765,
+    65022, 64765, 64765, 64508, 64765, 64765, 64765, 64508, 65022, 64765, 65022, 65279,
+    64765, 64765, 65536, 65536, 65536, 65279, 65536, 65536, 65536, 65279, 65536, 65536,
+    65536, 65279, 64765, 64508, 65022, 65279, 65022, 65022, 65022, 64765, 65022, 64765,
+    64508, 64765, 64765, 65022, 65022, 64765, 65022, 64765, 65022, 65022, 65022, 44719,
+    32639, 32639, 32639, 32382, 32382, 32639, 32639, 32382, 32639, 32639, 32382, 32382,
+    32639, 32382, 32639, 32639, 32382, 32639, 32639, 32382, 32382, 32382, 32382, 32382,
+    42663, 64765, 64765, 64508, 64765, 64765, 65022, 65022, 64765, 64508, 65022, 64508,
+    64765, 64251, 64508, 64765, 64508, 64251, 64251, 64765, 65022, 64508, 64765, 64765,
+    65022, 64765, 65022, 65022, 64508, 64508, 64765, 65022, 65279, 65022, 64765, 65022,
+    64765, 64765, 65536, 65536, 65536, 65279, 64765, 64765, 65279, 65022, 65279, 65279,
+    65536, 65536, 65279, 65022, 65536, 65022, 64765, 65022, 65022, 65279, 65022, 64765,
+    64765, 64765, 65279, 65022, 65022, 65022, 64765, 65279, 64508, 64765, 48574, 32382,
+    32639, 32639, 32639, 32382, 32382, 32382, 32639, 32382, 32125, 32382, 32382, 32382,
+    32382, 32639, 32382, 32639, 32639, 32382, 32639, 32639, 32382, 32382, 32382, 32382,
+    32639, 50887, 65022, 65279, 64508, 64508, 65279, 64765, 64508, 65022, 64765, 65279,
+    64508, 64508, 64508, 64765, 64765, 64765, 64765, 64765, 64765, 64765, 64765, 64251,
+    65022, 64765, 64765, 65022, 64765, 64765, 64765, 64508, 65022, 64765, 65022, 65536,
+    65022, 65279, 65279, 65536, 65536, 65279, 65022, 65022, 64765, 65279, 65536, 65536,
+    65279, 65279, 65536, 65279, 65279, 65536, 64765, 64765, 65022, 65022, 65022, 64765,
+    64508, 64508, 65279, 65279, 65279, 65279, 65279, 65279, 65022, 56541, 32382, 32639,
+    32639, 32639, 32639, 32639, 32382, 32382, 32382, 32125, 32382, 32382, 32382, 32382,
+    32639, 32639, 32639, 32382, 32639, 32639, 32639, 32639, 32639, 32382, 32125, 32382,
+    32639, 32639, 57312, 65279, 64508, 64508, 65022, 65022, 64508, 65279, 65022, 64251,
+    64765, 64508, 64508, 65279, 64508, 64508, 64508, 64508, 65022, 64251, 64508, 64765,
+    64508, 64251, 64765, 64508, 64508, 64508, 64765, 64765, 65279, 64765, 65279, 65022,
+    65279, 65022, 65279, 65279, 65022, 65022, 65022, 64765, 64508, 64765, 65279, 65536,
+    65279, 65279, 65022, 65279, 65022, 64765, 65279, 65279, 65279, 65279, 65279, 65022,
+    64765, 65022, 64765, 65022, 65279, 65536, 64765, 65022, 61167, 34439, 32382, 32639,
+    32639, 32639, 32639, 32639, 32382, 32382, 32639, 32639, 32382, 32382, 32382, 32382,
+    32639, 32382, 32639, 32639, 32382, 32382, 32639, 32639, 32382, 32639, 32382, 32639,
+    32639, 32639, 34696, 60910, 65022, 64508, 65022, 65022, 65022, 65022, 65279, 65022,
+    64508, 64508, 65022, 65022, 64508, 64508, 64765, 64765, 64765, 64765, 64765, 64765,
+    65022, 65022, 64765, 65279, 64765, 64765, 65022, 64508, 64765, 64765, 64251, 64765,
+    65022, 65022, 65536, 65279, 65022, 65022, 64765, 64765, 65022, 65022, 65279, 65022,
+    65022, 65279, 65279, 65279, 65022, 64765, 65022, 65022, 65279, 65022, 65279, 64765,
+    64765, 64765, 65536, 65279, 65279, 65279, 65279, 61424, 36752, 32639, 32639, 32639,
+    32639, 32639, 32639, 32639, 32639, 32382, 32639, 32639, 32382, 32382, 32382, 32639,
+    32382, 32382, 32639, 32382, 32382, 32382, 32639, 32639, 32639, 32382, 32639, 32382,
+    32639, 32639, 32639, 36495, 61167, 64765, 65279, 65279, 64508, 64765, 65022, 65022,
+    65279, 64765, 65279, 65022, 64765, 64508, 64251, 64765, 64765, 64508, 65022, 64508,
+    64765, 64765, 64765, 64508, 64765, 65022, 64765, 64765, 64765, 64765, 64508, 65022,
+    64765, 65022, 65279, 65279, 65022, 64508, 65022, 64765, 65022, 64508, 65022, 65022,
+    65279, 65279, 65279, 65022, 64508, 64765, 64765, 65022, 65536, 65279, 64765, 65279,
+    64765, 65279, 65536, 65279, 65022, 64765, 60910, 36495, 32639, 32639, 32639, 32639,
+    32639, 32639, 32639, 32639, 32382, 32382, 32382, 32639, 32382, 32382, 32382, 32382,
+    32382, 32639, 32639, 32639, 32382, 32639, 32639, 32639, 32639, 32382, 32639, 32382,
+    32639, 32639, 32639, 32382, 36495, 61424, 65279, 65279, 64251, 64765, 65022, 65022,
+    65022, 64765, 65022, 65022, 64765, 64251, 64508, 64765, 64765, 64765, 64765, 64508,
+    64765, 65022, 65022, 64765, 64508, 64251, 64765, 64765, 64765, 64765, 65022, 65022,
+    64765, 65022, 65022, 65022, 64765, 64251, 64765, 64765, 64765, 64765, 65279, 65279,
+    65279, 65022, 65022, 65022, 65022, 65022, 64765, 64765, 65536, 65022, 65022, 65022,
+    65279, 65022, 65279, 65022, 65022, 62709, 36495, 32382, 32639, 32382, 32639, 32639,
+    32639, 32639, 32639, 32639, 32382, 32382, 32382, 32382, 32382, 32382, 32639, 32125,
+    32639, 32639, 32382, 32639, 32639, 32382, 32639, 32382, 32639, 32382, 32639, 32639,
+    32639, 32639, 32382, 32382, 32382, 38551, 63480, 64765, 65022, 64508, 65279, 65536,
+    65279, 64765, 65022, 65022, 65022, 64508, 64765, 64765, 64765, 65022, 64765, 64765,
+    64765, 65022, 65022, 64765, 64508, 64508, 64765, 64765, 64765, 64765, 65022, 65022,
+    64765, 65279, 65279, 65022, 64765, 65022, 64508, 64765, 65022, 65279, 64765, 65536,
+    65279, 65022, 65022, 65022, 64765, 64765, 64765, 65022, 65022, 65279, 65536, 65022,
+    65279, 65279, 65022, 65022, 60653, 38294, 32639, 32639, 32639, 32382, 32639, 32639,
+    32639, 32382, 32382, 32382, 32382, 32382, 32382, 32639, 32639, 32382, 32382, 32639,
+    32382, 32382, 32639, 32382, 32382, 32382, 32639, 32639, 32382, 32125, 32639, 32639,
+    32639, 32639, 32382, 32125, 32382, 32382, 36495, 60396, 64508, 63994, 65022, 65022,
+    65279, 65022, 64765, 64508, 64765, 65279, 64508, 64508, 65022, 65022, 65022, 64765,
+    64765, 64508, 64765, 64508, 64508, 64251, 64251, 64765, 64765, 64508, 65279, 65022,
+    64765, 64765, 65022, 65279, 64765, 64765, 65022, 65279, 65279, 64765, 65022, 65022,
+    65022, 64765, 65022, 65279, 64765, 64765, 65279, 64765, 65279, 64765, 65022, 64765,
+    65022, 65022, 65279, 60910, 36238, 32382, 32382, 32639, 32639, 32382, 32639, 32639,
+    32382, 32639, 32382, 32382, 32382, 32382, 32382, 32639, 32382, 32382, 32639, 32382,
+    32639, 32382, 32382, 32382, 32125, 32125, 32639, 32382, 32382, 32382, 32639, 32639,
+    32639, 32639, 32639, 32382, 32125, 32639, 32639, 36495, 61167, 65022, 65536, 65536,
+    64765, 65022, 64765, 64765, 64765, 64765, 64765, 64765, 65022, 65022, 65022, 65022,
+    64765, 64508, 64508, 64508, 64765, 64508, 64508, 64508, 64765, 64765, 65022, 64765,
+    64508, 64765, 65536, 65022, 64765, 64765, 65279, 65279, 65279, 64765, 65022, 65279,
+    65022, 64508, 64765, 65022, 65279, 65279, 65279, 65022, 64765, 64508, 65022, 65022,
+    65022, 65022, 60910, 36238, 32382, 32382, 32125, 32639, 32639, 32382, 32639, 32382,
+    32382, 32382, 32382, 32382, 32382, 32382, 32639, 32639, 32382, 32382, 32382, 32382,
+    32382, 32382, 32382, 32382, 32382, 32382, 32382, 32382, 32639, 32382, 32639, 32639,
+    32639, 32639, 32382, 32382, 32382, 32639, 32639, 32639, 36495, 61424, 65279, 65279,
+    65279, 65022, 64765, 64251, 64765, 64765, 64765, 64251, 65022, 65022, 64765, 65022,
+    64765, 64508, 65022, 64765, 64508, 64508, 64765, 64508, 64508, 64508, 65022, 65022,
+    64508, 64508, 65279, 65536, 64765, 64765, 65279, 65279, 65279, 64508, 64765, 65022,
+    64765, 64765, 64508, 64765, 65279, 65279, 65536, 65022, 65022, 64251, 64765, 65279,
+    65279, 56798, 34439, 32639, 32382, 32382, 32125, 32639, 32639, 32639, 32639, 32639,
+    32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32382,
+    32639, 32639, 32639, 32382, 32382, 32382, 32639, 32382, 32639, 32639, 32639, 32639,
+    32639, 32639, 32639, 32382, 32382, 32382, 32382, 32639, 32639, 34696, 57055, 65279,
+    65279, 65279, 65022, 64765, 64765, 64765, 64765, 64765, 65279, 65022, 65022, 64765,
+    64508, 64508, 65022, 64765, 64765, 64508, 64765, 64765, 64765, 65022, 65022, 64765,
+    63994, 64251, 65536, 65022, 64765, 64765, 65279, 65279, 65022, 65022, 65022, 65022,
+    64765, 64765, 64765, 64765, 65279, 65279, 65279, 65022, 64508, 64765, 64765, 65279,
+    50887, 32382, 32382, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639,
+    32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639,
+    32382, 32639, 32639, 32639, 32639, 32639, 32639, 32382, 32382, 32382, 32639, 32639,
+    32639, 32382, 32639, 32639, 32639, 32382, 32382, 32639, 32639, 32639, 32639, 49088,
+    65022, 65022, 64765, 64765, 65279, 64508, 64765, 65022, 65022, 64508, 64508, 64508,
+    64508, 64508, 64508, 64508, 64508, 64508, 64765, 64765, 65022, 64765, 63994, 64251,
+    64508, 64765, 65536, 65279, 64508, 64508, 65022, 65022, 65279, 64508, 65022, 65279,
+    64765, 64765, 65022, 64765, 65022, 65279, 65279, 65022, 65022, 64765, 63480, 42920,
+    32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32382, 32639, 32639, 32639,
+    32639, 32639, 32639, 32639, 32639, 32639, 32639, 32382, 32639, 32639, 32639, 32639,
+    32639, 32639, 32639, 32639, 32382, 32639, 32382, 32382, 32125, 32382, 32639, 32639,
+    32639, 32382, 32382, 32639, 32639, 32639, 32639, 32639, 32382, 32639, 32639, 32639,
+    44719, 60910, 64765, 64765, 64765, 64765, 64508, 64508, 64508, 64508, 64508, 64508,
+    64508, 64508, 64765, 64765, 64508, 64251, 64765, 64765, 64765, 64508, 64508, 64251,
+    65022, 64765, 65279, 65279, 65279, 65022, 65022, 64765, 65279, 65279, 64765, 65022,
+    65022, 64765, 64765, 64765, 64765, 65022, 65536, 65022, 64765, 56798, 36752, 32639,
+    32639, 32382, 32639, 32639, 32639, 32639, 32639, 32639, 32382, 32382, 32639, 32639,
+    32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32382,
+    32639, 32382, 32639, 32382, 32382, 32382, 32639, 32382, 32382, 32382, 32639, 32639,
+    32639, 32639, 32639, 32382, 32639, 32639, 32639, 32382, 32639, 32639, 32639, 32639,
+    32639, 36495, 58854, 64765, 65279, 64508, 65022, 65022, 64508, 64765, 64765, 64765,
+    65022, 65022, 64765, 64765, 64508, 64508, 64765, 64765, 64765, 64508, 65022, 65022,
+    65279, 65022, 65279, 65279, 65536, 65022, 64765, 64765, 65279, 65022, 64508, 64251,
+    64508, 64765, 64765, 64508, 65022, 65022, 65022, 63480, 46775, 32639, 32639, 32639,
+    32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32382, 32639, 32639,
+    32639, 32639, 32382, 32639, 32382, 32382, 32639, 32639, 32639, 32382, 32382, 32125,
+    32639, 32639, 32639, 32382, 32382, 32382, 32639, 32639, 32639, 32382, 32382, 32382,
+    32639, 32382, 32382, 32639, 32639, 32639, 32639, 32639, 32382, 32382, 32639, 32639,
+    32639, 32639, 32639, 48574, 64765, 65022, 65279, 65022, 64508, 64765, 64765, 64765,
+    65022, 65022, 64508, 64765, 64508, 64765, 64765, 64765, 64765, 64765, 65022, 65279,
+    64508, 64251, 64765, 65279, 65536, 64765, 65022, 64765, 65022, 64765, 64765, 64508,
+    64765, 64508, 64765, 64508, 64508, 64765, 56798, 36495, 32639, 32639, 32639, 32639,
+    32382, 32382, 32639, 32639, 32382, 32382, 32639, 32382, 32382, 32639, 32639, 32382,
+    32639, 32382, 32382, 32639, 32382, 32382, 32639, 32639, 32639, 32639, 32382, 32382,
+    32382, 32382, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32382, 32382, 32382,
+    32382, 32382, 32382, 32382, 32639, 32639, 32639, 32639, 32382, 32639, 32639, 32639,
+    32639, 32639, 32639, 32639, 36238, 54742, 65022, 64765, 64765, 64765, 64765, 64765,
+    64765, 64765, 64508, 64765, 64508, 64765, 64765, 64508, 65022, 65022, 65022, 65022,
+    64765, 64508, 65022, 65022, 65279, 65022, 65279, 64765, 64765, 64765, 64765, 64251,
+    65022, 65022, 64508, 64765, 61167, 42663, 32639, 32382, 32382, 32639, 32639, 32639,
+    32382, 32382, 32639, 32382, 32639, 32382, 32639, 32639, 32639, 32382, 32639, 32382,
+    32382, 32382, 32382, 32382, 32382, 32382, 32639, 32639, 32639, 32125, 32382, 32125,
+    32125, 32382, 32639, 32639, 32639, 32382, 32639, 32639, 32382, 32382, 32382, 32382,
+    32639, 32382, 32639, 32382, 32382, 32639, 32639, 32639, 32639, 32382, 32639, 32382,
+    32382, 32382, 32639, 32639, 32382, 32382, 44462, 61167, 64765, 64765, 64508, 64765,
+    64508, 64508, 64765, 64765, 64508, 64765, 64765, 64765, 65022, 64765, 65022, 64765,
+    63994, 64508, 64765, 64508, 65279, 65022, 65022, 64765, 65022, 64765, 64765, 64765,
+    64765, 64765, 63480, 48831, 34439, 32382, 32639, 32639, 32639, 32639, 32639, 32639,
+    32382, 32382, 32639, 32382, 32639, 32639, 32382, 32639, 32382, 32639, 32639, 32382,
+    32382, 32382, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32382, 32382, 32382,
+    32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32382, 32382, 32382, 32639,
+    32639, 32639, 32639, 32639, 32382, 32639, 32639, 32639, 32382, 32382, 32639, 32639,
+    32382, 32382, 32382, 32639, 32125, 32382, 32382, 32382, 44462, 60910, 65022, 64251,
+    64508, 64765, 64508, 64765, 64765, 64765, 64765, 64765, 64765, 64765, 64508, 64508,
+    64765, 64508, 64765, 64508, 65022, 65022, 64508, 64765, 65022, 64765, 65022, 65022,
+    63223, 48574, 34439, 32639, 32382, 32639, 32639, 32639, 32639, 32639, 32639, 32639,
+    32382, 32382, 32639, 32639, 32382, 32639, 32639, 32639, 32382, 32639, 32639, 32382,
+    32382, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32382, 32639, 32639, 32382,
+    32382, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32382, 32382, 32382, 32639,
+    32639, 32639, 32639, 32639, 32382, 32382, 32639, 32639, 32639, 32639, 32639, 32639,
+    32382, 32382, 32639, 32639, 32382, 32125, 32382, 32382, 32382, 36495, 48574, 60653,
+    64508, 64251, 64765, 64765, 64765, 64765, 64508, 64765, 64765, 64765, 64508, 64251,
+    64765, 64765, 65279, 65536, 65022, 64765, 65022, 65022, 65279, 65022, 61424, 48574,
+    34439, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639,
+    32639, 32382, 32639, 32639, 32382, 32639, 32639, 32639, 32639, 32639, 32639, 32639,
+    32382, 32382, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32382, 32639, 32382,
+    32382, 32382, 32382, 32382, 32639, 32639, 32639, 32639, 32639, 32382, 32382, 32382,
+    32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639,
+    32639, 32382, 32639, 32639, 32382, 32382, 32382, 32382, 32382, 32382, 32639, 32382,
+    44719, 61167, 65022, 64508, 65022, 64508, 65022, 65022, 65022, 65022, 65022, 64765,
+    65022, 65022, 65279, 64765, 64765, 64508, 65022, 65022, 57055, 40607, 32639, 32639,
+    32639, 32382, 32382, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32382, 32382,
+    32382, 32382, 32639, 32639, 32639, 32382, 32639, 32639, 32639, 32639, 32639, 32639,
+    32382, 32382, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32382,
+    32382, 31868, 32639, 32125, 32382, 32639, 32382, 32382, 32382, 32382, 32382, 32639,
+    32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639,
+    32639, 32639, 32382, 32382, 32639, 32639, 32382, 32382, 32382, 32382, 32382, 32382,
+    32382, 32382, 42920, 54999, 64765, 64765, 65279, 64508, 65022, 64765, 64765, 64765,
+    65022, 64765, 65022, 65022, 65279, 57312, 47032, 34439, 32639, 32639, 32639, 32639,
+    32382, 32639, 32382, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32382,
+    32639, 32639, 32639, 32639, 32639, 32639, 32639, 32382, 32639, 32639, 32639, 32639,
+    32382, 32382, 32382, 32382, 32639, 32382, 32639, 32639, 32382, 32382, 32382, 32382,
+    32382, 32382, 32382, 32382, 32382, 32639, 32382, 32382, 32382, 32639, 32639, 32639,
+    32639, 32639, 32639, 32639, 32639, 32382, 32639, 32639, 32639, 32639, 32639, 32382,
+    32382, 32382, 32639, 32382, 32639, 32382, 32382, 32382, 32639, 32382, 32382, 32639,
+    32639, 32639, 32639, 32125, 36495, 44719, 56284, 64508, 64508, 64765, 64765, 64508,
+    64765, 62966, 52943, 44719, 34439, 32639, 32639, 32639, 32639, 32639, 32639, 32639,
+    32639, 32382, 32382, 32639, 32382, 32382, 32382, 32382, 32639, 32639, 32125, 32382,
+    32382, 32382, 32639, 32382, 32639, 32639, 32639, 32382, 32382, 32382, 32639, 32639,
+    32382, 32382, 32382, 32125, 32125, 32382, 32639, 32639, 32382, 32125, 32125, 32382,
+    32639, 32639, 32639, 32639, 32639, 32382, 32382, 32382, 32382, 32639, 32639, 32639,
+    32639, 32639, 32639, 32639, 32382, 32382, 32639, 32639, 32639, 32639, 32639, 32382,
+    32382, 32639, 32639, 32639, 32382, 32382, 32639, 32382, 32382, 32382, 32382, 32382,
+    32639, 32639, 32382, 32382, 32382, 32125, 32382, 36238, 44462, 54485, 60910, 65022,
+    50630, 32382, 32382, 32382, 32639, 32382, 32382, 32382, 32382, 32382, 32639, 32382,
+    32125, 32382, 32382, 32382, 32639, 32382, 32382, 32382, 32382, 32382, 32382, 32125,
+    32382, 32382, 32639, 32639, 32639, 32382, 32382, 32382, 32382, 32382, 32639, 32639,
+    32382, 32639, 32639, 32382, 32382, 32382, 32639, 32382, 32639, 32639, 32382, 32382,
+    32639, 32639, 32639, 32639, 32639, 32639, 32639, 32382, 32639, 32639, 32639, 32382,
+    32382, 32382, 32639, 32639, 32382, 32639, 32639, 32639, 32639, 32639, 32639, 32382,
+    32382, 32639, 32639, 32639, 32639, 32382, 32382, 32382, 32382, 32639, 32639, 32639,
+    32639, 32382, 32382, 32382, 32382, 32382, 32382, 32382, 32639, 32382, 32639, 50630,
+    36495, 32382, 32382, 32382, 32125, 32382, 32382, 32382, 32382, 32382, 32382, 32382,
+    32382, 32125, 32382, 32382, 32639, 32382, 32125, 32639, 32382, 32382, 32382, 32382,
+    32382, 32382, 32382, 32382, 32639, 32639, 32382, 32382, 32125, 32639, 32639, 32639,
+    32382, 32382, 32382, 32639, 32382, 32382, 32639, 32382, 32382, 32382, 32382, 32639,
+    32639, 32639, 32382, 32639, 32639, 32639, 32639, 32382, 32382, 32639, 32639, 32639,
+    32639, 32639, 32639, 32639, 32382, 32382, 32639, 32639, 32639, 32639, 32382, 32125,
+    32382, 32382, 32639, 32639, 32639, 32382, 32382, 32382, 32382, 32382, 32382, 32639,
+    32382, 32639, 32639, 32382, 32382, 32639, 32382, 32382, 32639, 32639, 32382, 34439,
+    34439, 32382, 32382, 32382, 32382, 32382, 32639, 32639, 32639, 32382, 32639, 32639,
+    32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32382, 32382, 32639, 32639,
+    32382, 32639, 32639, 32639, 32639, 32382, 32382, 32382, 32639, 32639, 32639, 32639,
+    32382, 32382, 32639, 32639, 32382, 32639, 32639, 32639, 32382, 32382, 32382, 32382,
+    32382, 32382, 32639, 32382, 32382, 32382, 32639, 32639, 32382, 32382, 32639, 32639,
+    32639, 32639, 32639, 32639, 32382, 32639, 32639, 32382, 32639, 32382, 32382, 32639,
+    32382, 32382, 32382, 32639, 32639, 32639, 32639, 32639, 32382, 32382, 32382, 32382,
+    32382, 32382, 32639, 32639, 32382, 32382, 32639, 32382, 32382, 32382, 32382, 36238,
+    50630, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32382, 32639, 32382,
+    32639, 32382, 32639, 32639, 32639, 32639, 32639, 32639, 32382, 32382, 32639, 32639,
+    32639, 32639, 32639, 32639, 32639, 32382, 32382, 32639, 32639, 32639, 32639, 32639,
+    32125, 32382, 32382, 32382, 32639, 32639, 32639, 32639, 32639, 32382, 32639, 32639,
+    32382, 32382, 32382, 32382, 32382, 32639, 32639, 32639, 32639, 32382, 32382, 32639,
+    32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32382, 32125, 32382, 32639,
+    32639, 32639, 32382, 32382, 32639, 32639, 32639, 32639, 32382, 32382, 32382, 32382,
+    32382, 32639, 32639, 32382, 32382, 32639, 32382, 32382, 32382, 32382, 32382, 50373,
+    64765, 60139, 55256, 44462, 36495, 32639, 32639, 32639, 32639, 32639, 32382, 32639,
+    32639, 32639, 32639, 32382, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639,
+    32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639,
+    32639, 32639, 32639, 32639, 32382, 32382, 32639, 32639, 32639, 32639, 32639, 32639,
+    32382, 32639, 32382, 32382, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32382,
+    32382, 32382, 32639, 32639, 32382, 32639, 32639, 32639, 32639, 32639, 32382, 32382,
+    32382, 32382, 32382, 32382, 32639, 32639, 32382, 32382, 32382, 32382, 32382, 32639,
+    32639, 32639, 32382, 32382, 32639, 32382, 32382, 34182, 44719, 52943, 63223, 65022,
+    64765, 64508, 64765, 64765, 65022, 57055, 44976, 36495, 32639, 32639, 32639, 32639,
+    32639, 32639, 32382, 32639, 32639, 32382, 32639, 32639, 32639, 32639, 32639, 32639,
+    32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32639, 32382, 32639,
+    32382, 32382, 32639, 32639, 32382, 32382, 32639, 32639, 32639, 32639, 32639, 32639,
+    32639, 32382, 32639, 32382, 32639, 32639, 32639, 32639, 32639, 32382, 32382, 32382,
+    32382, 32639, 32639, 32639, 32382, 32639, 32639, 32639, 32382, 32382, 32382, 32382,
+    32382, 32382, 32382, 32382, 32639, 32639, 32382, 32382, 32382, 32639, 32382, 32639,
+    32639, 32382, 32382, 32382, 34439, 46518, 56798, 64508, 64765, 65022, 65279, 65022,
+    64765, 64508, 65022, 65279, 65022, 65279, 65022, 65022, 54999, 42406, 32639, 32639,
+    32382, 32639, 32382, 32639, 32639, 32639, 32639, 32639, 32639, 32382, 32639, 32639,
+    32639, 32382, 32382, 32639, 32639, 32639, 32382, 32639, 32382, 32639, 32382, 32382,
+    32382, 32382, 32382, 32382, 32639, 32125, 32639, 32639, 32639, 32382, 32639, 32639,
+    32639, 32639, 32639, 32639, 32382, 32639, 32639, 32639, 32639, 32382, 32382, 32382,
+    32382, 32382, 32382, 32382, 32382, 32382, 32639, 32639, 32639, 32639, 32382, 32382,
+    32382, 32382, 32382, 32382, 32382, 32382, 32382, 32382, 32382, 32382, 32639, 32639,
+    32382, 32382, 40607, 56798, 64508, 64251, 64765, 64765, 65279, 65022, 65022, 65279,
+    64508, 64508, 64765, 64765, 65022, 65022, 65022, 65022, 64508, 64765, 61424, 44719,
+    32639, 32639, 32639, 32125, 32125, 32639, 32639, 32382, 32382, 32382, 32639, 32382,
+    32639, 32639, 32382, 32639, 32382, 32639, 32639, 32382, 32382, 32639, 32125, 32382,
+    32382, 32382, 32382, 32125, 32125, 32382, 32639, 32639, 32639, 32382, 32639, 32639,
+    32382, 32639, 32639, 32639, 32382, 32382, 32639, 32639, 32639, 32639, 32382, 32382,
+    32382, 32382, 32382, 32382, 32382, 32639, 32639, 32639, 32639, 32639, 32382, 32382,
+    32382, 32382, 32382, 32639, 32382, 32382, 32382, 32382, 32639, 32382, 32639, 34439,
+    48574, 60653, 64765, 64765, 63994, 63994, 64765, 64765, 65022, 64508, 65022, 65022,
+    64508, 64765, 64765, 64765, 64251, 64508, 64508, 64765, 64508, 64508, 65022, 65022,
+    60910, 48574, 36495, 32382, 32382, 32382, 32639, 32382, 32125, 32382, 32639, 32639,
+    32382, 32382, 32382, 32382, 32382, 32382, 32382, 32382, 32382, 32639, 32639, 32382,
+    32639, 32382, 32382, 32125, 32382, 32382, 32382, 32639, 32639, 32639, 32639, 32639,
+    32639, 32382, 32382, 32639, 32382, 32639, 32639, 32639, 32639, 32382, 32639, 32382,
+    32382, 32382, 32382, 32382, 32382, 32382, 32639, 32639, 32639, 32382, 32382, 32382,
+    32382, 32382, 32639, 32382, 32382, 32382, 32382, 32382, 32382, 34439, 48831, 63223,
+    65022, 65022, 65022, 64508, 64508, 64251, 64765, 65022, 64508, 64765, 65279, 65022,
+    64508, 65022, 64765, 64508, 64251, 64508, 65022, 64765, 64251, 64251, 65022, 64765,
+    65022, 64508, 61424, 44719, 32382, 32639, 32639, 32382, 32125, 32125, 32382, 32382,
+    32382, 32125, 32382, 32382, 32382, 32382, 32382, 32382, 32382, 32639, 32639, 32382,
+    32639, 32639, 32382, 32382, 32382, 32382, 32382, 32639, 32639, 32639, 32639, 32639,
+    32382, 32382, 32382, 32382, 32382, 32639, 32639, 32639, 32382, 32382, 32639, 32382,
+    32382, 32382, 32639, 32382, 32382, 32382, 32639, 32639, 32382, 32382, 32639, 32382,
+    32382, 32382, 32639, 32382, 32382, 32382, 32382, 34182, 48574, 62966, 64508, 65022,
+    65022, 65022, 65022, 65022, 64508, 64251, 64508, 64765, 64508, 64765, 65022, 65022,
+    64765, 64765, 64765, 64508, 64765, 65022, 64508, 64508, 64765, 64251, 64508, 65022,
+    65022, 65022, 65536, 65022, 61167, 44205, 32639, 32382, 32125, 32382, 32639, 32382,
+    32639, 32639, 32382, 32639, 32125, 32382, 32382, 32382, 32382, 32382, 32639, 32639,
+    32382, 32639, 32639, 32639, 32639, 32639, 32382, 32382, 32639, 32639, 32639, 32639,
+    32382, 32382, 32382, 32382, 32382, 32382, 32382, 32382, 32382, 32639, 32639, 32639,
+    32639, 32639, 32639, 32639, 32639, 32639, 32639, 32382, 32382, 32382, 32382, 32382,
+    32382, 32382, 32382, 32382, 32382, 32382, 42663, 60910, 64508, 64765, 64765, 65022,
+    64508, 64508, 64508, 64765, 64508, 64508, 64508, 64765, 64765, 65022, 64765, 64508,
+    64765, 64765, 65022, 64765, 65022, 65022, 64765, 64508, 64765, 64508, 65279, 65279,
+    65279, 65022, 65536, 65279, 64765, 64765, 55256, 36752, 32639, 32382, 32639, 32639,
+    32382, 32639, 32639, 32639, 32382, 32125, 32382, 32382, 32125, 32382, 32639, 32639,
+    32382, 32639, 32639, 32639, 32639, 32639, 32382, 32639, 32639, 32639, 32639, 32639,
+    32639, 32382, 32382, 32382, 32639, 32639, 32639, 32382, 32382, 32382, 32639, 32639,
+    32639, 32382, 32639, 32639, 32639, 32639, 32639, 32639, 32382, 32382, 32382, 32382,
+    32639, 32382, 32382, 32382, 36238, 56798, 64508, 64765, 64765, 64765, 64508, 64765,
+    64765, 65022, 64765, 64765, 64508, 64508, 64765, 64765, 65279, 65022, 64765, 64765,
+    64765, 65022, 64765, 65022, 64765, 64765, 64765, 64508, 64765, 64508, 64251, 64508,
+    64765, 65022, 65279, 65022, 65022, 65022, 65536, 65022, 48831, 32639, 32639, 32639,
+    32382, 32382, 32639, 32639, 32639, 32639, 32639, 32382, 32382, 32382, 32382, 32639,
+    32639, 32639, 32639, 32639, 32639, 32382, 32639, 32639, 32639, 32382, 32639, 32639,
+    32382, 32382, 32639, 32639, 32382, 32639, 32639, 32382, 32125, 32382, 32639, 32639,
+    32639, 32639, 32639, 32382, 32639, 32639, 32639, 32639, 32382, 32382, 32382, 32382,
+    32382, 32382, 32382, 46518, 62709, 64765, 64765, 64765, 64765, 64765, 64765, 64765,
+    64765, 64765, 64765, 64765, 64251, 64765, 65279, 64765, 65279, 65022, 65279, 65022,
+    64508, 64508, 64765, 64508, 64765, 64508, 64765, 64765, 64765, 64765, 64765, 64508,
+    64765, 64508, 65536, 65022, 65536, 65022, 65279, 65279, 65536, 59368, 36495, 32382,
+    32382, 32382, 32639, 32639, 32639, 32639, 32639, 32382, 32382, 32382, 32639, 32382,
+    32382, 32382, 32639, 32382, 32639, 32382, 32639, 32639, 32382, 32382, 32639, 32382,
+    32125, 32382, 32639, 32639, 32639, 32639, 32639, 32639, 32382, 32382, 32639, 32639,
+    32639, 32639, 32382, 32382, 32639, 32639, 32639, 32639, 32382, 32382, 32382, 32382,
+    32382, 36495, 56798, 64765, 64765, 64765, 64765, 64765, 64765, 64765, 64765, 64765,
+    64765, 64765, 64765, 64508, 64251, 64508, 64765, 64765, 65279, 65279, 65279, 65279,
+    64765, 64765, 64508, 64765, 64765, 64765, 64765, 64765, 64765, 64508, 65022, 65022,
+    64765, 65022, 65536, 65279, 64765, 65022, 65536, 65536, 64765, 65279, 61167, 44719,
+    32382, 32639, 32639, 32639, 32382, 32382, 32639, 32382, 32382, 32382, 32382, 32639,
+    32639, 32639, 32639, 32382, 32639, 32382, 32639, 32639, 32639, 32382, 32639, 32125,
+    32382, 32382, 32639, 32639, 32639, 32639, 32382, 32639, 32382, 32382, 32639, 32639,
+    32639, 32639, 32382, 32382, 32639, 32639, 32639, 32639, 32382, 32382, 32382, 32382,
+    42663, 62966, 64765, 64765, 64765, 64765, 64765, 64765, 64765, 64765, 64765, 64765,
+    64765, 64765, 64765, 64765, 64251, 64508, 64765, 64765, 65022, 64765, 65022, 65022,
+    64765, 64508, 64508, 64508, 64765, 64765, 64508, 64765, 64765, 64765, 64765, 64508,
+    64765, 64765, 65279, 65279, 65279, 65279, 65022, 65279, 64508, 65022, 65279, 64508,
+    48574, 32382, 32382, 32382, 32382, 32125, 32382, 32382, 32382, 32382, 32382, 32639,
+    32639, 32639, 32639, 32382, 32125, 32382, 32382, 32639, 32639, 32382, 32382, 32382,
+    32382, 32382, 32639, 32639, 32639, 32382, 32382, 32382, 32639, 32382, 32382, 32382,
+    32639, 32382, 32382, 32382, 32639, 32639, 32639, 32639, 32382, 32382, 32382, 50887,
+    64765, 64765, 64765, 64765, 64508, 64765, 64765, 64765, 64765, 64765, 65022, 64765,
+    64765, 64765, 64765, 64765, 64508, 64251, 64765, 65022, 65279, 65022, 65279, 65022,
+    64765, 64765, 64765, 65022, 64765, 64765, 64251, 64508, 64765, 64508, 64508, 64765,
+    65022, 64765, 65022, 65022, 64508, 64765, 65022, 64765, 65279, 64765, 65279, 65022,
+    65022, 56798, 34439, 32382, 32639, 32382, 32382, 32125, 32382, 32639, 32639, 32639,
+    32639, 32639, 32639, 32382, 32382, 32382, 32639, 32382, 32639, 32382, 32639, 32639,
+    32639, 32382, 32382, 32382, 32639, 32382, 32382, 32382, 32639, 32639, 32639, 32639,
+    32382, 32639, 32639, 32639, 32639, 32382, 32639, 32639, 32639, 34696, 56798, 64765,
+    65022, 64765, 64765, 64765, 64508, 64765, 64508, 64765, 64765, 64765, 65022, 64765,
+    64765, 64765, 64765, 64765, 64251, 64508, 64508, 64765, 64765, 64765, 64765, 64765,
+    64765, 64508, 65022, 64765, 64765, 64765, 64508, 64508, 64765, 64251, 64508, 64508,
+    64508, 64508, 64765, 64765, 64765, 64765, 65022, 65022, 65279, 64765, 65022, 64765,
+    64508, 64765, 60653, 36495, 32639, 32382, 32382, 32639, 32382, 32639, 32382, 32382,
+    32639, 32639, 32639, 32382, 32382, 32382, 32382, 32639, 32382, 32382, 32639, 32639,
+    32639, 32382, 32382, 32382, 32639, 32639, 32382, 32382, 32639, 32639, 32639, 32639,
+    32639, 32639, 32639, 32382, 32382, 32382, 32639, 32639, 36495, 61167, 64765, 64765,
+    64765, 64765, 64765, 64765, 64765, 64765, 64765, 64765, 64765, 64251, 64765, 64508,
+    64765, 64765, 64765, 64765, 64508, 64508, 64251, 64765, 64765, 64765, 64508, 64765,
+    64508, 64508, 64765, 64765, 64765, 64765, 64765, 64765, 64508, 64508, 64765, 64508,
+    64765, 64765, 64765, 65279, 64765, 64765, 64765, 64508, 64765, 64765, 64765, 64765,
+    64508, 64508, 64508, 60910, 36495, 32382, 32639, 32639, 32382, 32382, 32382, 32382,
+    32639, 32382, 32639, 32382, 32382, 32639, 32382, 32382, 32639, 32382, 32382, 32382,
+    32382, 32382, 32382, 32382, 32639, 32382, 32639, 32382, 32639, 32639, 32382, 32382,
+    32639, 32639, 32382, 32382, 32382, 32382, 32639, 36495, 60910, 65022, 65022, 64765,
+    65022, 65022, 64765, 64765, 64765, 64508, 64251, 64765, 64508, 64251, 64508, 64508,
+    64251, 64765, 64765, 64765, 64508, 64508, 64765, 65022, 64508, 65022, 65022, 65279,
+    64508, 64508, 65022, 64765, 64765, 64508, 64765, 64508, 64251, 64251, 64765, 64508,
+    64765, 65022, 64765, 65022, 65279, 64508, 64508, 64508, 64508, 64765, 64508, 64508,
+    65022, 64765, 64765, 64765, 60910, 36495, 32382, 32382, 32382, 32382, 32382, 32382,
+    32125, 32639, 32639, 32639, 32382, 32382, 32382, 32125, 32382, 32382, 32125, 32382,
+    32125, 32125, 32382, 32382, 32639, 32382, 32639, 32639, 32639, 32382, 32382, 32382,
+    32639, 32639, 32382, 32382, 32382, 32382, 38551, 60910, 64765, 64765, 64765, 64508,
+    64765, 64765, 64765, 64765, 64765, 64508, 64508, 64765, 64508, 64508, 64508, 64508,
+    64508, 64765, 64765, 65022, 64508, 64508, 65022, 65022, 65022, 65022, 65022, 65022,
+    64508, 64508, 64765, 64765, 64765, 64508, 64765, 64508, 64508, 64251, 64765, 64508,
+    64765, 65279, 65022, 65022, 64765, 64508, 64508, 64765, 64765, 64765, 64765, 64765,
+    64508, 64765, 64508, 64508, 65022, 62966, 38551, 32382, 32382, 32382, 32382, 32382,
+    32382, 32382, 32639, 32639, 32639, 32382, 32382, 32125, 32382, 32382, 32382, 32382,
+    32382, 32382, 32382, 32639, 32639, 32639, 32639, 32639, 32382, 32382, 32382, 32382,
+    32639, 32639, 32382, 32639, 32382, 36495, 62709, 64508, 65279, 64765, 64765, 65022,
+    65022, 64765, 65536, 65022, 64508, 64765, 64765, 64765, 64765, 64765, 64508, 64508,
+    64765, 65022, 64765, 64765, 64508, 64251, 65022, 64765, 65022, 65022, 65022, 65022,
+    64508, 64508, 64508, 64765, 64765, 64765, 64765, 64765, 64765, 64508, 64765, 64508,
+    65022, 64508, 65022, 65022, 64765, 64765, 64765, 64765, 64765, 64765, 64765, 64508,
+    64765, 65279, 65022, 64765, 64765, 64765, 60653, 36238, 32382, 32382, 32382, 32382,
+    32382, 32382, 32639, 32639, 32382, 32382, 32382, 32382, 32382, 32382, 32382, 32382,
+    32639, 32382, 32639, 32639, 32639, 32382, 32639, 32382, 32125, 32125, 32639, 32639,
+    32639, 32382, 32382, 32639, 36495, 60910, 64508, 65022, 64765, 64508, 64765, 64508,
+    64765, 64765, 64765, 64765, 65022, 64765, 64508, 64765, 65022, 64508, 64508, 64765,
+    64765, 64765, 64765, 64508, 64508, 64508, 64765, 65022, 64765, 65022, 65022, 65022,
+    64765, 64508, 64765, 64765, 65022, 64765, 65022, 64765, 64765, 64765, 65022, 65022,
+    65022, 65022, 65022, 65279, 64765, 64765, 64765, 64765, 65022, 65022, 64765, 64765,
+    64765, 64508, 65279, 64765, 64765, 64765, 64765, 60910, 36495, 32125, 32382, 32382,
+    32382, 32382, 32639, 32639, 32382, 32382, 32382, 32639, 32639, 32639, 32639, 32382,
+    32639, 32639, 32639, 32639, 32382, 32639, 32382, 32382, 32125, 32382, 32382, 32382,
+    32639, 32639, 32125, 36495, 60910, 65022, 65022, 64508, 64765, 64508, 64765, 64765,
+    64765, 64508, 65022, 64765, 65022, 64251, 64508, 64765, 64508, 64765, 65022, 64765,
+    64765, 64765, 64765, 64765, 64508, 64508, 64765, 64765, 64508, 64765, 65022, 65022,
+    64765, 64508, 64508, 64508, 64765, 64765, 64765, 64765, 65022, 64508, 65022, 65279,
+    65279, 65279, 65022, 65022, 65022, 64765, 65022, 64765, 64765, 64765, 64765, 64765,
+    64251, 64508, 64765, 64765, 64765, 64765, 64508, 64765, 61167, 34439, 32382, 32382,
+    32382, 32382, 32125, 32382, 32382, 32382, 32382, 32639, 32639, 32639, 32639, 32382,
+    32382, 32639, 32639, 32639, 32639, 32639, 32382, 32382, 32382, 32382, 32125, 32382,
+    32382, 32382, 34182, 60910, 64508, 64765, 64765, 64765, 65022, 64765, 65022, 64508,
+    64765, 64508, 64765, 64508, 64765, 64508, 65022, 64765, 65022, 64765, 64765, 64765,
+    64508, 64251, 64251, 64251, 64765, 64508, 64765, 64508, 64765, 64765, 65022, 65022,
+    64765, 64508, 64765, 64508, 65022, 64508, 64765, 65022, 65022, 65022, 64765, 65022,
+    65022, 65022, 65279, 65279, 65022, 64765, 64765, 64765, 64765, 64508, 64508, 64251,
+    64765, 64765, 64765, 64765, 64765, 64765, 65022, 64765, 65279, 57055, 32382, 32639,
+    32639, 32639, 32382, 32382, 32639, 32382, 32639, 32639, 32639, 32639, 32639, 32639,
+    32382, 32382, 32639, 32639, 32639, 32382, 32382, 32382, 32125, 32382, 32382, 32382,
+    32639, 32382, 56541, 64251, 64251, 64765, 64765, 64765, 64765, 65279, 64508, 65022,
+    64765, 64251, 65022, 64765, 64508, 64508, 64765, 64765, 64765, 64765, 64765, 64765,
+    64765, 64765, 65022, 64765, 64765, 64765, 64508, 64765, 64765, 64765, 65022, 65022,
+    64765, 64765, 64765, 64765, 64765, 64765, 64765, 65022, 65022, 65022, 64765, 65279,
+    65022, 65279, 65022, 65022, 65022, 64765, 65022, 64765, 64765, 64765, 64508, 64251,
+    64251, 64765, 64508, 64508, 64508, 65022, 64765, 65022, 65022, 65022, 50887, 32639,
+    32639, 32639, 32382, 32639, 32639, 32382, 32382, 32639, 32639, 32639, 32382, 32639,
+    32382, 32382, 32382, 32382, 32382, 32639, 32382, 32382, 32382, 32382, 32382, 32382,
+    32382, 48831, 64508, 64251, 64508, 64765, 64765, 64765, 64765, 64508, 65022, 65022,
+    64508, 64765, 64765, 64765, 64765, 64508, 64765, 64765, 64765, 64508, 64765, 64765,
+    64765, 64765, 65022, 64765, 64765, 64765, 64508, 64765, 64765, 64508, 65022, 65022,
+    65022, 64251, 64508, 64765, 64765, 64765, 64765, 63994, 65022, 64765, 65022, 64765,
+    65022, 65022, 65022, 65022, 64765, 65022, 64765, 64765, 64251, 64251, 64251, 64508,
+    64508, 65022, 64765, 64765, 64765, 65022, 65536, 65022, 65022, 65279, 64765, 42663,
+    32639, 32639, 32639, 32639, 32639, 32639, 32382, 32382, 32639, 32382, 32639, 32639,
+    32639, 32382, 32382, 32125, 32382, 32382, 32382, 32382, 32639, 32639, 32639, 32639,
+    44976, 65279, 65022, 65279, 64508, 64765, 64765, 64765, 65022, 65279, 65022, 65022,
+    64508, 64765, 64765, 64765, 65022, 65022, 64508, 64765, 64765, 64508, 64765, 65022,
+    64508, 65022, 65022, 64508, 64508, 64508, 64765, 65022, 64765, 64765, 65279, 64251,
+    64765, 64765, 64765, 64765, 64765, 64508, 64765, 64765, 64765, 64508, 65022, 65022,
+    65022, 64765, 65536, 64765, 64765, 65022, 64508, 64508, 64251, 64251, 64251, 64508,
+    64765, 64508, 64508, 64765, 64765, 64508, 65022, 64765, 65279, 65022, 64765, 63480,
+    36752, 32639, 32639, 32639, 32639, 32382, 32125, 32382, 32382, 32382, 32639, 32639,
+    32382, 32382, 32382, 32382, 32382, 32382, 32639, 32639, 32639, 32639, 32639, 36495,
+    60910, 65022, 65279, 64765, 64765, 64508, 64251, 64765, 65279, 64765, 64508, 64765,
+    65022, 64508, 64765, 64765, 64765, 64765, 64765, 64765, 64765, 65022, 64765, 64508,
+    64765, 64508, 65022, 64765, 64765, 64508, 64765, 65279, 64765, 65022, 65022, 64765,
+    65279, 65022, 65279, 64508, 64765, 64508, 65022, 64765, 64765, 64765, 64765, 65279,
+    64765, 64765, 65022, 64765, 64765, 64765, 64508, 64765, 64508, 64508, 65022, 64765,
+    64508, 64508, 64765, 64765, 64765, 65022, 64508, 64508, 64765, 64765, 64765, 65022,
+    57312, 32639, 32639, 32639, 32382, 32382, 32639, 32382, 32382, 32382, 32639, 32639,
+    32382, 32382, 32639, 32382, 32382, 32639, 32382, 32639, 32639, 32382, 32382, 58854,
+    64508, 64508, 64765, 64508, 64508, 64765, 64765, 64508, 64765, 64765, 64765, 64765,
+    65022, 64508, 64251, 64508, 65022, 64765, 65022, 64765, 64765, 64765, 64765, 64765,
+    64765, 64508, 65022, 64508, 64765, 65022, 65022, 64765, 65022, 64765, 64508, 65022,
+    65279, 65279, 65022, 65279, 65022, 64765, 64765, 64508, 64765, 64765, 65022, 65022,
+    65022, 65022, 65022, 65022, 64508, 64765, 64765, 64765, 65022, 65022, 64508, 64508,
+    64765, 64765, 64765, 64765, 64765, 65022, 64765, 64765, 64765, 64765, 64765, 64765,
+    65022, 46775, 32639, 32639, 32382, 32125, 32639, 32382, 32382, 32382, 32639, 32639,
+    32382, 32382, 32382, 32382, 32639, 32639, 32639, 32639, 32639, 32382, 48574, 65022,
+    64508, 64508, 64765, 65022, 64765, 64508, 64765, 64508, 64508, 64508, 64508, 64508,
+    65022, 64508, 65279, 64508, 64508, 64765, 64765, 64765, 64765, 64765, 64765, 64765,
+    64765, 64508, 64508, 65022, 65022, 64765, 64765, 65022, 64765, 65022, 65279, 65022,
+    65022, 64765, 65279, 64765, 65022, 64765, 64765, 64765, 65022, 64765, 65022, 64508,
+    65022, 64765, 65022, 65022, 64508, 65022, 64765, 64765, 64508, 64508, 64765, 65022,
+    64251, 65022, 65279, 64765, 64765, 64765, 65022, 64765, 64765, 64765, 64765, 64508,
+    65279, 63223, 36495, 32639, 32125, 32382, 32382, 32125, 32382, 32382, 32639, 32382,
+    32382, 32382, 32382, 32382, 32382, 32639, 32639, 32639, 32382, 36238, 64508, 64765,
+    64251, 64508, 64765, 64765, 64765, 64251, 64508, 65022, 64765, 64251, 64765, 64765,
+    64765, 64765, 65022, 64765, 64765, 64765, 65022, 64508, 64508, 64765, 64765, 64765,
+    64765, 64765, 65022, 65022, 65022, 64765, 64765, 64508, 64251, 64765, 64765, 64508,
+    65022, 64508, 65022, 64251, 65022, 64765, 64765, 64765, 65022, 64765, 64765, 64508,
+    64765, 64508, 64765, 65022, 64508, 64765, 64765, 64765, 64508, 64508, 64508, 64765,
+    64508, 64508, 65022, 65022, 65022, 64508, 64765, 64765, 64765, 64765, 64508, 64765,
+    65022, 65022, 56798, 32382, 32382, 32125, 32382, 32125, 32382, 32125, 32639, 32382,
+    32382, 32382, 32382, 32382, 32382, 32382, 32639, 32382, 32382, 54742, 65022, 65022,
+    65022, 65022, 64508, 64508, 65022, 64508, 65279, 64765, 65022, 64765, 65022, 65022,
+    64508, 65022, 65279, 65022, 65022, 64508, 64765, 64765, 64765, 64765, 64765, 64765,
+    65022, 64765, 65022, 64765, 65022, 65022, 65022, 64765, 64508, 64765, 64508, 65279,
+    64765, 64251, 64765, 64765, 64765, 64765, 64765, 64765, 64508, 64508, 65279, 64765,
+    65022, 65279, 64765, 64508, 64251, 64508, 64508, 64765, 64765, 64508, 64765, 64765,
+    64765, 65022, 64765, 64765, 64765, 64508, 65022, 65022, 64765, 64765, 65536, 65022,
+    65279, 65022, 65279, 42663, 32639, 32639, 32639, 32639, 32382, 32125, 32639, 32382,
+    32382, 32382, 32382, 32382, 32382, 32382, 32639, 32382, 44462, 64508, 64765, 64765,
+    64765, 64251, 64508, 64508, 64765, 64765, 64508, 64765, 64765, 64508, 64765, 64765,
+    65022, 64765, 64765, 64765, 64765, 64765, 64765, 64508, 64508, 64508, 65022, 65022,
+    65022, 65279, 64765, 64508, 64765, 64765, 64508, 64508, 64765, 65022, 65022, 65022,
+    64765, 64251, 64765, 64765, 65022, 65022, 64765, 64508, 64508, 64508, 65022, 65022,
+    65279, 65022, 64508, 64765, 64508, 64251, 64508, 65022, 64765, 64508, 64765, 64508,
+    64765, 65022, 64765, 64251, 64508, 64508, 65022, 65022, 64765, 64765, 64508, 64765,
+    65022, 65022, 65022, 61167, 34696, 32639, 32639, 32639, 32639, 32382, 32382, 32382,
+    32125, 32125, 32382, 32382, 32382, 32382, 32382, 32382, 61167, 64765, 64765, 64765,
+    65279, 64508, 65022, 64765, 64765, 64251, 64765, 64765, 65022, 64508, 64765, 64251,
+    64765, 65022, 64765, 64765, 64765, 64508, 64765, 64765, 64508, 64508, 64508, 65022,
+    65279, 65279, 64765, 64765, 64765, 64765, 64765, 64765, 64765, 64765, 65022, 65022,
+    65022, 64508, 64508, 64508, 65022, 64765, 64508, 64508, 64765, 64251, 64765, 64765,
+    64508, 64508, 64765, 65022, 64765, 65022, 65022, 64508, 65022, 64765, 65022, 65022,
+    65279, 64765, 64765, 64765, 65022, 64765, 64765, 64765, 64508, 64765, 64765, 64508,
+    64765, 64765, 64765, 64765, 48831, 32639, 32639, 32639, 32639, 32639, 32382, 32125,
+    32382, 32382, 32382, 32382, 32125, 32382, 32382, 44462, 64508, 64508, 64508, 64765,
+    64765, 64251, 64765, 64765, 65022, 64765, 65022, 64765, 65022, 64765, 65279, 65022,
+    65022, 65022, 64765, 64765, 65022, 64765, 64251, 64765, 64765, 64765, 64765, 64765,
+    64765, 64765, 64765, 64765, 64765, 64765, 64765, 64765, 64508, 64765, 64508, 64508,
+    64765, 64765, 64765, 64765, 64765, 64765, 64508, 64765, 64508, 64508, 65022, 64508,
+    64765, 64508, 65022, 64508, 65022, 65022, 65536, 65022, 65022, 64765, 65022, 64508,
+    65022, 65022, 64765, 64765, 65022, 64508, 64765, 64765, 64765, 64765, 64251, 64508,
+    64765, 64508, 64508, 64508, 63223, 34439, 32639, 32639, 32125, 32382, 32639, 32382,
+    32125, 32382, 32382, 32382, 32382, 32382, 36495, 60653, 64765, 64765, 64251, 64508,
+    64508, 64765, 64765, 64765, 65022, 64765, 64765, 64508, 65022, 65022, 64251, 64765,
+    64508, 64251, 64765, 64765, 64765, 64765, 64765, 65022, 64765, 64765, 64765, 64765,
+    64508, 64765, 64765, 64765, 64765, 64765, 64765, 64765, 65022, 64765, 64508, 64508,
+    64765, 64765, 64765, 64508, 65022, 64765, 64765, 64508, 64765, 65022, 64765, 64765,
+    65022, 64765, 65279, 65022, 65022, 65022, 65536, 64765, 64765, 64765, 65536, 65022,
+    65022, 65022, 65022, 65022, 65279, 65022, 65022, 64765, 64765, 64508, 64508, 64508,
+    64508, 64508, 64765, 64765, 65022, 48831, 32382, 32382, 32382, 32382, 32639, 32382,
+    32382, 32382, 32639, 32382, 32382, 32382, 48831, 64765, 64251, 64251, 64508, 64765,
+    64508, 64765, 65022, 65022, 64765, 64765, 65022, 64251, 64765, 64765, 64765, 65022,
+    64765, 64765, 64765, 64508, 64765, 64765, 64765, 64765, 64508, 64508, 64765, 64765,
+    64508, 64765, 64765, 64765, 64508, 64508, 64765, 64765, 64508, 64765, 65279, 65022,
+    64765, 64765, 64765, 64508, 64765, 64765, 64765, 64765, 64765, 64251, 65022, 65022,
+    65022, 65279, 65279, 65279, 64765, 65279, 65279, 65022, 65022, 64765, 64765, 65279,
+    64765, 64765, 64508, 65022, 65279, 65022, 65022, 64765, 64765, 64508, 64508, 64508,
+    64251, 64508, 64765, 64508, 65022, 62966, 34439, 32382, 32382, 32382, 32639, 32382,
+    32382, 32382, 32639, 32639, 32382, 32382, 60653, 65022, 64508, 64251, 64508, 64765,
+    64765, 64765, 64765, 65022, 65022, 64765, 64508, 64508, 64765, 64251, 65279, 64765,
+    64508, 64765, 64508, 64765, 64765, 64765, 64765, 64508, 64508, 64508, 64508, 64765,
+    64508, 65022, 64765, 64765, 64765, 64508, 65022, 64765, 64765, 64508, 65022, 65022,
+    64765, 64765, 64765, 65022, 64508, 64765, 64765, 64765, 64508, 65022, 65022, 65279,
+    65022, 65022, 65022, 65022, 65022, 64508, 65022, 65279, 65279, 64765, 64765, 65022,
+    65022, 64765, 64765, 64508, 65022, 65022, 65022, 65022, 64765, 64765, 64508, 64508,
+    64508, 64508, 64765, 64765, 65022, 65022, 48574, 32382, 32639, 32382, 32639, 32382,
+    32382, 32639, 32382, 32639, 32382, 44462, 64508, 64508, 64765, 64508, 64765, 64765,
+    64508, 64508, 64508, 64765, 65022, 64765, 65022, 65279, 65279, 64765, 65279, 65022,
+    64508, 65022, 65022, 64508, 64765, 64508, 64765, 64508, 64508, 64765, 64508, 64508,
+    64765, 64765, 64765, 64765, 64765, 64251, 64765, 64765, 64765, 64765, 65279, 65022,
+    64508, 64765, 64765, 64765, 65022, 64765, 64765, 64508, 63994, 64765, 64765, 64765,
+    65536, 65022, 64765, 65536, 65022, 64508, 65022, 65279, 64765, 64251, 64508, 65022,
+    64765, 65022, 65536, 65022, 64765, 65022, 65279, 65022, 64765, 64765, 64508, 64508,
+    64508, 64508, 64765, 65022, 65022, 65022, 60910, 32382, 32382, 32382, 32382, 32382,
+    32382, 32382, 32382, 32382, 32382, 60910, 64765, 64508, 64508, 64508, 64251, 64765,
+    64765, 64251, 64765, 64765, 64765, 65279, 65279, 65022, 64508, 65022, 65022, 65279,
+    65279, 64508, 65022, 64508, 64508, 64765, 64765, 64765, 64508, 64765, 64508, 64508,
+    64508, 64765, 64508, 64765, 64765, 64508, 64765, 64765, 64765, 64765, 65022, 65022,
+    64765, 64765, 65022, 64765, 64765, 65022, 65279, 64765, 64765, 64765, 64765, 64765,
+    65279, 65279, 64765, 65022, 65022, 65022, 65279, 65022, 64765, 64765, 65022, 65022,
+    64765, 64765, 65279, 65279, 64765, 65022, 65536, 65022, 65022, 64765, 64765, 64765,
+    64765, 64765, 64765, 64765, 64765, 64765, 65022, 40607, 32639, 32639, 32382, 32382,
+    32382, 32382, 32639, 32382, 42663, 64508, 64765, 64508, 64508, 64508, 64508, 64508,
+    64251, 64251, 64508, 64508, 65279, 64765, 65022, 64765, 65022, 65022, 65279, 64765,
+    65022, 64765, 64765, 65022, 64765, 64765, 64508, 64508, 65022, 64765, 64508, 64765,
+    64765, 64765, 64765, 64765, 64765, 64508, 64765, 64765, 64765, 64765, 65279, 65022,
+    64765, 64765, 64508, 64765, 64765, 64765, 64765, 64765, 64765, 64765, 64508, 64508,
+    65022, 65022, 65022, 64765, 65279, 65022, 65022, 64765, 64508, 64765, 64765, 64765,
+    64765, 64765, 65022, 65022, 65279, 65022, 65279, 65022, 64765, 65022, 65022, 64765,
+    64765, 64765, 64765, 64765, 64508, 64508, 65022, 57312, 32639, 32639, 32382, 32382,
+    32382, 32125, 32639, 32382, 54999, 64765, 64765, 65022, 65022, 64508, 64251, 65279,
+    64765, 64765, 64765, 64765, 64251, 64508, 65279, 65022, 65536, 65279, 65022, 64765,
+    65022, 64508, 65536, 65022, 64765, 64508, 64765, 64765, 64765, 65022, 64765, 64765,
+    64765, 64765, 64765, 64765, 64765, 64765, 64765, 64765, 64765, 64765, 64765, 64765,
+    64765, 64765, 65022, 65022, 65022, 64508, 64251, 64765, 65022, 65022, 64765, 64765,
+    65022, 65279, 65022, 64765, 65279, 65022, 65022, 65022, 65022, 65022, 65022, 64765,
+    65022, 64765, 65022, 65022, 65022, 65022, 65022, 65022, 64508, 64765, 64508, 64508,
+    64508, 64508, 64765, 64765, 65022, 64251, 64765, 64765, 34439, 32382, 32382, 32382,
+    32382, 32125, 32382, 36495, 64508, 64765, 64765, 64765, 64765, 64508, 64765, 64765,
+    64765, 64765, 64765, 64765, 64251, 64508, 65279, 65279, 65022, 65022, 65279, 65022,
+    65279, 65022, 64765, 64765, 65022, 65022, 64765, 65022, 64765, 64508, 64765, 64765,
+    64765, 65022, 65022, 64765, 65022, 65022, 65022, 65279, 64765, 65022, 65022, 65022,
+    64765, 64251, 65022, 64508, 64508, 64251, 64251, 64508, 64765, 64508, 64765, 64765,
+    65022, 65022, 65022, 64765, 65536, 64765, 64765, 65279, 65279, 65022, 64508, 65022,
+    64765, 65022, 65279, 65022, 64765, 65279, 65279, 65279, 64765, 64765, 64765, 64508,
+    64508, 64508, 64765, 64251, 64765, 64765, 64765, 65022, 46518, 32382, 32382, 32382,
+    32382, 32382, 32382, 44462, 64508, 64508, 64765, 64765, 64251, 64508, 64508, 64765,
+    64765, 64765, 64765, 65022, 64508, 64508, 65022, 65022, 65022, 64508, 65022, 64765,
+    65022, 65279, 64765, 64251, 64508, 64508, 65022, 65022, 64765, 64508, 64508, 64765,
+    64508, 64508, 65022, 64251, 65022, 64765, 64765, 64765, 65022, 65022, 65022, 65022,
+    64508, 64508, 64765, 64508, 64765, 64765, 64508, 64508, 64508, 64508, 64765, 64765,
+    65022, 64765, 65279, 65022, 65279, 65022, 65022, 65022, 64765, 65022, 65022, 64508,
+    64765, 65022, 65536, 65022, 65022, 65022, 65022, 65022, 65279, 64765, 64508, 64508,
+    65022, 65022, 64765, 65022, 64765, 64765, 64765, 64765, 56798, 32382, 32382, 32382,
+    32639, 32382, 32639, 56798, 65022, 64508, 65022, 64765, 64508, 64765, 64508, 64508,
+    64508, 64508, 64765, 65022, 65022, 64765, 65279, 65279, 65279, 65022, 65022, 65022,
+    65022, 64765, 65022, 64765, 65022, 65022, 65279, 65022, 64251, 65279, 65279, 65536,
+    65279, 65279, 65279, 65022, 65536, 65022, 65279, 65279, 64765, 64508, 65022, 65022,
+    64765, 64765, 64765, 64765, 65022, 64508, 64508, 64508, 64508, 64508, 64765, 64251,
+    64765, 64508, 65022, 64765, 64765, 65022, 65536, 65279, 64508, 64765, 65536, 65022,
+    64765, 65279, 65022, 65022, 65022, 64765, 65022, 65022, 65022, 65279, 65022, 64508,
+    65279, 64765, 65022, 64765, 64765, 65022, 64765, 64765, 65022, 34439, 32639, 32382,
+    32382, 32382, 36495, 65022, 64765, 64765, 64765, 64765, 64508, 64508, 64251, 64508,
+    64508, 64508, 65279, 65279, 64765, 65022, 65022, 65022, 65279, 65022, 65279, 65536,
+    65536, 64765, 65022, 65022, 65279, 65022, 65022, 65022, 65022, 64765, 65279, 65279,
+    65022, 64765, 65536, 65022, 65279, 65279, 65022, 64765, 64765, 65022, 64765, 65022,
+    64508, 64508, 64765, 64765, 64765, 64765, 64765, 64765, 65022, 64765, 64765, 64765,
+    64508, 64765, 64765, 64765, 64765, 65022, 65022, 64251, 65022, 64765, 65022, 65022,
+    65022, 64765, 65022, 65022, 65022, 65279, 64765, 64508, 64765, 65022, 65536, 65022,
+    65022, 64765, 64765, 64765, 64765, 64508, 64765, 64765, 65022, 44462, 32382, 32382,
+    32382, 32382, 44976, 65022, 64765, 64251, 64508, 65022, 64508, 64508, 64765, 64508,
+    64251, 65022, 65022, 65022, 64765, 64765, 64251, 64508, 65279, 64508, 65022, 65022,
+    64765, 64508, 64251, 64765, 65022, 64251, 65022, 65022, 65279, 65022, 65022, 65022,
+    65022, 65022, 65022, 65022, 65022, 64765, 65022, 64765, 65022, 65022, 65022, 64765,
+    64765, 64508, 65022, 64765, 65022, 64765, 65022, 65022, 64765, 65022, 64765, 64508,
+    65022, 64508, 64508, 64765, 64765, 65536, 65279, 64765, 65022, 65279, 65536, 65022,
+    65022, 65022, 65022, 65022, 65279, 64765, 64765, 64765, 64765, 65022, 65022, 65279,
+    64765, 64765, 64765, 65022, 64765, 64508, 64765, 64765, 64765, 52943, 32382, 32382,
+    32382, 32382, 54742, 64765, 64508, 64508, 64765, 65022, 64765, 64508, 64508, 64508,
+    64765, 64765, 64508, 64508, 65022, 65022, 64508, 64765, 65279, 64765, 65022, 65022,
+    64765, 65022, 64765, 64765, 65279, 65022, 65279, 65022, 65022, 65022, 65279, 65022,
+    65022, 65279, 65022, 65022, 65022, 65022, 65279, 65279, 65022, 65022, 65279, 65022,
+    65022, 64765, 64765, 65022, 65022, 64508, 64765, 64765, 64765, 64765, 64508, 64765,
+    64508, 64765, 64765, 64765, 64508, 64765, 64765, 65022, 64765, 65279, 65022, 64765,
+    65022, 65022, 64765, 64765, 64765, 64765, 64765, 64765, 64765, 64508, 64765, 64765,
+    64765, 64765, 64508, 64508, 64765, 64765, 64765, 65022, 65022, 63223, 32639, 32382,
+    32382, 32382, 61167, 64508, 64508, 64508, 64765, 64508, 65022, 64508, 64765, 65022,
+    64765, 64765, 64765, 64765, 65022, 65022, 65022, 65022, 65279, 65022, 64765, 65279,
+    65279, 65279, 65536, 65279, 65022, 65022, 64765, 65022, 65022, 65279, 65022, 64765,
+    64765, 64765, 64765, 64765, 65022, 65279, 65022, 64508, 65279, 65022, 65536, 65022,
+    64765, 64765, 64765, 64765, 65022, 64765, 64765, 64508, 65022, 64765, 64508, 64765,
+    64765, 64251, 65022, 64765, 65022, 64765, 65536, 65022, 65279, 65022, 64765, 65022,
+    65022, 65022, 65022, 64765, 65022, 64765, 64508, 65022, 65279, 64765, 64508, 64508,
+    65022, 64765, 64508, 64508, 64765, 64508, 64765, 64765, 65022, 64765, 50887, 36752,
+    34439, 50630, 64765, 64508, 64508, 64765, 65022, 65279, 64765, 64765, 65022, 64508,
+    64765, 65022, 64508, 64765, 64765, 65022, 65022, 65022, 65022, 65022, 65279, 64765,
+    64765, 65279, 65022, 65022, 65279, 65022, 64765, 64508, 65279, 65279, 65022, 64765,
+    64765, 64765, 64765, 64765, 65279, 65279, 64508, 64765, 65279, 65022, 65022, 65022,
+};
+
+inline constexpr int32_t blend_add_offset_96[96 * 96] = {
+    294912, 229376, 294912, 229376, 229376, 229376, 229376, 294912, 32768, 229376, 229376, 294912,
+    229376, 163840, 360448, 163840, 163840, 163840, 32768, 163840, 98304, 98304, 98304, 98304,
+    229376, 163840, 229376, 294912, 163840, 229376, 229376, 229376, 229376, 229376, 229376, 163840,
+    229376, 163840, 32768, 98304, 98304, 98304, 98304, 98304, 163840, 163840, 3768320, 7962625,
+    7438337, 3899392, 98304, 229376, 32768, 163840, 98304, 163840, 294912, 294912, 163840, 294912,
+    229376, 229376, 294912, 229376, 229376, 229376, 163840, 294912, 294912, 294912, 163840, 229376,
+    98304, 229376, 163840, 163840, 98304, 163840, 229376, 229376, 163840, 229376, 229376, 294912,
+    229376, 229376, 294912, 294912, 229376, 229376, 229376, 229376, 294912, 360448, 294912, 294912,
+    229376, 294912, 163840, 229376, 98304, 229376, 229376, 294912, 163840, 163840, 229376, 229376,
+    98304, 163840, 294912, 229376, 163840, 163840, 98304, 98304, 32768, 98304, 32768, 32768,
+    163840, 163840, 229376, 229376, 98304, 229376, 229376, 163840, 229376, 360448, 229376, 229376,
+    98304, 32768, 32768, 32768, 98304, 32768, 32768, 32768, 163840, 1081344, 8421376, 8421376,
+    8486912, 8486912, 622592, 163840, 32768, 98304, 163840, 163840, 163840, 229376, 229376, 163840,
+    163840, 163840, 229376, 294912, 229376, 229376, 98304, 98304, 163840, 163840, 163840, 98304,
+    163840, 32768, 163840, 32768, 98304, 98304, 294912, 294912, 229376, 229376, 229376, 229376,
+    163840, 229376, 294912, 229376, 229376, 229376, 425984, 360448, 294912, 360448, 294912, 360448,
+    98304, 32768, 163840, 98304, 163840, 294912, 229376, 163840, 32768, 98304, 98304, 229376,
+    98304, 98304, 98304, 98304, 163840, 163840, 98304, 32768, 98304, 98304, 32768, 98304,
+    98304, 98304, 32768, 98304, 163840, 163840, 163840, 229376, 229376, 294912, 229376, 229376,
+    32768, 98304, 32768, 98304, 32768, 32768, 98304, 163840, 163840, 2719744, 8421376, 8421376,
+    8486912, 8421376, 3244032, 32768, 32768, 98304, 163840, 98304, 32768, 32768, 98304, 98304,
+    163840, 360448, 294912, 229376, 294912, 294912, 163840, 32768, 98304, 163840, 163840, 229376,
+    294912, 294912, 163840, 229376, 360448, 229376, 163840, 163840, 294912, 294912, 229376, 229376,
+    229376, 294912, 294912, 294912, 229376, 163840, 294912, 229376, 294912, 294912, 229376, 229376,
+    32768, 98304, 98304, 163840, 163840, 360448, 163840, 229376, 32768, 98304, 163840, 163840,
+    32768, 32768, 32768, 163840, 163840, 98304, 32768, 98304, 32768, 98304, 98304, 32768,
+    98304, 163840, 98304, 98304, 32768, 98304, 294912, 229376, 163840, 294912, 98304, 163840,
+    32768, 98304, 32768, 32768, 32768, 98304, 163840, 163840, 229376, 5406720, 8421376, 8421376,
+    8486912, 8486912, 5275648, 98304, 98304, 98304, 98304, 98304, 32768, 32768, 98304, 163840,
+    294912, 294912, 229376, 163840, 229376, 294912, 294912, 163840, 163840, 229376, 163840, 229376,
+    294912, 294912, 294912, 294912, 229376, 294912, 163840, 229376, 294912, 360448, 294912, 163840,
+    98304, 229376, 229376, 360448, 294912, 229376, 294912, 229376, 360448, 294912, 229376, 229376,
+    32768, 32768, 98304, 229376, 360448, 294912, 294912, 229376, 98304, 163840, 98304, 98304,
+    32768, 32768, 229376, 98304, 229376, 229376, 32768, 163840, 98304, 98304, 32768, 163840,
+    32768, 98304, 32768, 32768, 32768, 163840, 294912, 229376, 163840, 163840, 229376, 163840,
+    163840, 98304, 294912, 229376, 32768, 98304, 32768, 98304, 229376, 7503873, 8421376, 8421376,
+    8421376, 8421376, 7962625, 163840, 229376, 98304, 163840, 229376, 98304, 163840, 229376, 229376,
+    294912, 294912, 294912, 229376, 294912, 294912, 229376, 163840, 98304, 98304, 229376, 294912,
+    360448, 294912, 294912, 294912, 294912, 294912, 294912, 229376, 229376, 229376, 98304, 32768,
+    229376, 163840, 229376, 294912, 229376, 229376, 163840, 360448, 294912, 360448, 294912, 229376,
+    98304, 32768, 229376, 229376, 229376, 294912, 294912, 294912, 229376, 163840, 294912, 294912,
+    32768, 98304, 98304, 98304, 163840, 229376, 163840, 98304, 32768, 163840, 163840, 98304,
+    98304, 98304, 98304, 32768, 98304, 163840, 294912, 294912, 294912, 294912, 98304, 294912,
+    360448, 163840, 294912, 32768, 163840, 294912, 163840, 163840, 2195456, 8486912, 8421376, 8421376,
+    8421376, 8421376, 8421376, 2260992, 163840, 163840, 163840, 229376, 229376, 163840, 98304, 163840,
+    229376, 294912, 229376, 229376, 229376, 294912, 229376, 163840, 163840, 98304, 229376, 229376,
+    229376, 294912, 294912, 294912, 360448, 229376, 163840, 229376, 294912, 294912, 163840, 98304,
+    229376, 294912, 229376, 229376, 229376, 229376, 294912, 294912, 229376, 294912, 229376, 229376,
+    98304, 163840, 98304, 98304, 294912, 294912, 229376, 229376, 294912, 229376, 32768, 98304,
+    32768, 163840, 163840, 98304, 98304, 229376, 98304, 98304, 163840, 229376, 229376, 229376,
+    229376, 163840, 32768, 98304, 163840, 229376, 163840, 163840, 163840, 229376, 163840, 98304,
+    294912, 163840, 98304, 163840, 98304, 163840, 163840, 163840, 5406720, 8486912, 8421376, 8421376,
+    8421376, 8486912, 8421376, 4816896, 163840, 163840, 163840, 163840, 294912, 229376, 163840, 98304,
+    163840, 163840, 229376, 229376, 360448, 229376, 294912, 163840, 163840, 229376, 163840, 229376,
+    229376, 229376, 229376, 294912, 229376, 163840, 163840, 229376, 229376, 229376, 163840, 229376,
+    163840, 229376, 425984, 360448, 294912, 294912, 229376, 229376, 229376, 294912, 229376, 229376,
+    98304, 229376, 163840, 163840, 229376, 229376, 163840, 294912, 294912, 163840, 163840, 98304,
+    163840, 229376, 294912, 98304, 98304, 32768, 163840, 229376, 229376, 229376, 98304, 163840,
+    229376, 32768, 163840, 163840, 163840, 163840, 98304, 98304, 229376, 98304, 98304, 98304,
+    32768, 98304, 98304, 98304, 98304, 163840, 163840, 98304, 7438337, 8486912, 8421376, 8421376,
+    8486912, 8421376, 8421376, 7962625, 163840, 163840, 163840, 163840, 294912, 229376, 229376, 294912,
+    229376, 163840, 229376, 163840, 229376, 229376, 98304, 163840, 163840, 163840, 163840, 98304,
+    229376, 294912, 229376, 229376, 294912, 163840, 98304, 229376, 229376, 163840, 229376, 294912,
+    229376, 294912, 229376, 360448, 360448, 294912, 294912, 294912, 229376, 294912, 229376, 229376,
+    229376, 163840, 163840, 163840, 98304, 163840, 294912, 229376, 98304, 229376, 163840, 229376,
+    163840, 163840, 294912, 98304, 98304, 163840, 229376, 294912, 98304, 163840, 163840, 163840,
+    163840, 32768, 163840, 163840, 163840, 229376, 163840, 229376, 294912, 229376, 163840, 98304,
+    98304, 98304, 163840, 98304, 294912, 229376, 229376, 2785280, 8421376, 8486912, 8421376, 8421376,
+    8486912, 8486912, 8421376, 8421376, 2195456, 229376, 163840, 98304, 229376, 229376, 163840, 229376,
+    229376, 229376, 229376, 229376, 163840, 229376, 163840, 98304, 98304, 98304, 98304, 229376,
+    229376, 163840, 294912, 163840, 98304, 32768, 98304, 98304, 294912, 229376, 229376, 294912,
+    229376, 163840, 294912, 360448, 294912, 163840, 163840, 294912, 294912, 360448, 294912, 294912,
+    98304, 229376, 98304, 98304, 32768, 98304, 229376, 163840, 98304, 229376, 98304, 163840,
+    163840, 229376, 163840, 163840, 98304, 163840, 229376, 294912, 163840, 229376, 32768, 98304,
+    32768, 163840, 163840, 163840, 163840, 163840, 163840, 163840, 229376, 229376, 98304, 98304,
+    32768, 98304, 98304, 98304, 163840, 229376, 229376, 5865472, 8486912, 8421376, 8421376, 8421376,
+    8486912, 8486912, 8421376, 8421376, 6389761, 163840, 32768, 98304, 229376, 294912, 294912, 229376,
+    229376, 229376, 163840, 163840, 229376, 163840, 98304, 98304, 32768, 163840, 163840, 229376,
+    163840, 229376, 163840, 294912, 32768, 98304, 163840, 163840, 229376, 294912, 294912, 294912,
+    294912, 294912, 360448, 294912, 163840, 294912, 229376, 229376, 229376, 425984, 294912, 294912,
+    229376, 163840, 294912, 229376, 98304, 98304, 98304, 98304, 229376, 229376, 163840, 163840,
+    98304, 98304, 98304, 163840, 229376, 229376, 163840, 294912, 98304, 98304, 98304, 98304,
+    98304, 229376, 163840, 294912, 163840, 163840, 98304, 294912, 229376, 229376, 98304, 98304,
+    32768, 98304, 32768, 98304, 163840, 294912, 1146880, 8421376, 8421376, 8421376, 8421376, 8421376,
+    8421376, 8486912, 8421376, 8421376, 8421376, 1146880, 98304, 163840, 163840, 163840, 229376, 98304,
+    163840, 163840, 163840, 98304, 98304, 98304, 98304, 229376, 98304, 98304, 98304, 163840,
+    163840, 98304, 163840, 163840, 163840, 294912, 294912, 229376, 229376, 229376, 229376, 163840,
+    294912, 294912, 229376, 163840, 229376, 229376, 229376, 294912, 163840, 229376, 163840, 229376,
+    229376, 163840, 229376, 229376, 98304, 98304, 98304, 98304, 163840, 229376, 98304, 163840,
+    163840, 98304, 98304, 163840, 229376, 229376, 163840, 163840, 98304, 229376, 98304, 32768,
+    163840, 294912, 229376, 229376, 163840, 163840, 229376, 229376, 163840, 229376, 98304, 163840,
+    98304, 98304, 98304, 98304, 163840, 229376, 5275648, 8421376, 8421376, 8421376, 8421376, 8486912,
+    8421376, 8486912, 8421376, 8421376, 8421376, 4358144, 163840, 163840, 98304, 32768, 163840, 294912,
+    229376, 294912, 163840, 163840, 163840, 163840, 98304, 163840, 98304, 98304, 229376, 163840,
+    163840, 229376, 32768, 163840, 98304, 294912, 294912, 294912, 229376, 229376, 163840, 163840,
+    229376, 294912, 98304, 229376, 98304, 229376, 163840, 229376, 229376, 229376, 294912, 360448,
+    98304, 98304, 98304, 163840, 32768, 98304, 163840, 163840, 163840, 32768, 32768, 98304,
+    163840, 229376, 32768, 163840, 98304, 163840, 98304, 32768, 229376, 229376, 229376, 32768,
+    32768, 98304, 229376, 163840, 229376, 229376, 229376, 163840, 32768, 98304, 163840, 98304,
+    163840, 32768, 32768, 163840, 32768, 1146880, 8486912, 8486912, 8421376, 8421376, 8421376, 8421376,
+    8421376, 8486912, 8421376, 8421376, 8421376, 7962625, 557056, 98304, 98304, 163840, 163840, 163840,
+    163840, 163840, 163840, 98304, 32768, 229376, 163840, 98304, 163840, 98304, 294912, 229376,
+    229376, 163840, 98304, 163840, 98304, 294912, 229376, 163840, 163840, 163840, 229376, 229376,
+    163840, 294912, 294912, 294912, 229376, 294912, 294912, 425984, 229376, 229376, 229376, 229376,
+    98304, 163840, 32768, 163840, 98304, 32768, 163840, 229376, 163840, 98304, 32768, 163840,
+    229376, 229376, 163840, 163840, 163840, 163840, 98304, 163840, 163840, 229376, 32768, 32768,
+    98304, 163840, 229376, 163840, 229376, 163840, 229376, 229376, 163840, 98304, 98304, 98304,
+    32768, 163840, 98304, 163840, 229376, 4292608, 8421376, 8486912, 8421376, 8421376, 8421376, 8421376,
+    8486912, 8486912, 8486912, 8421376, 8421376, 8421376, 4292608, 163840, 163840, 163840, 98304, 294912,
+    294912, 294912, 163840, 98304, 98304, 163840, 229376, 98304, 98304, 163840, 294912, 229376,
+    294912, 229376, 163840, 98304, 98304, 98304, 163840, 163840, 229376, 229376, 229376, 229376,
+    163840, 229376, 229376, 229376, 163840, 294912, 294912, 360448, 294912, 229376, 229376, 229376,
+    163840, 98304, 98304, 98304, 229376, 294912, 98304, 98304, 98304, 163840, 98304, 163840,
+    229376, 294912, 163840, 98304, 163840, 163840, 163840, 98304, 229376, 294912, 32768, 32768,
+    98304, 163840, 229376, 229376, 229376, 294912, 229376, 229376, 32768, 98304, 32768, 98304,
+    32768, 32768, 294912, 294912, 1212416, 7438337, 8486912, 8486912, 8421376, 8421376, 8421376, 8486912,
+    8486912, 8486912, 8552448, 8486912, 8486912, 8421376, 7962625, 622592, 163840, 360448, 294912, 294912,
+    229376, 163840, 294912, 294912, 163840, 229376, 163840, 294912, 98304, 229376, 294912, 294912,
+    294912, 163840, 163840, 163840, 163840, 229376, 229376, 229376, 294912, 294912, 229376, 229376,
+    294912, 294912, 360448, 294912, 360448, 425984, 294912, 163840, 294912, 294912, 229376, 229376,
+    163840, 229376, 163840, 163840, 229376, 360448, 229376, 98304, 163840, 98304, 98304, 32768,
+    163840, 98304, 163840, 98304, 229376, 229376, 163840, 163840, 229376, 163840, 163840, 98304,
+    163840, 163840, 229376, 98304, 163840, 294912, 294912, 229376, 163840, 98304, 98304, 163840,
+    163840, 163840, 229376, 294912, 5406720, 8486912, 8486912, 8486912, 8421376, 8421376, 8486912, 8486912,
+    8486912, 8552448, 8421376, 8486912, 8486912, 8486912, 8486912, 4358144, 229376, 98304, 229376, 294912,
+    163840, 229376, 425984, 229376, 163840, 98304, 98304, 163840, 229376, 294912, 229376, 294912,
+    294912, 163840, 163840, 98304, 229376, 229376, 229376, 294912, 229376, 294912, 229376, 294912,
+    360448, 425984, 229376, 294912, 163840, 360448, 229376, 294912, 229376, 360448, 229376, 229376,
+    229376, 229376, 163840, 229376, 229376, 229376, 360448, 229376, 163840, 163840, 32768, 98304,
+    163840, 98304, 294912, 294912, 229376, 229376, 163840, 229376, 98304, 163840, 98304, 229376,
+    229376, 163840, 229376, 163840, 98304, 229376, 294912, 360448, 163840, 229376, 163840, 229376,
+    98304, 163840, 229376, 1212416, 8486912, 8486912, 8486912, 8486912, 8486912, 8486912, 8421376, 8421376,
+    8421376, 8421376, 8421376, 8486912, 8486912, 8486912, 8421376, 7962625, 1146880, 229376, 229376, 163840,
+    229376, 229376, 229376, 294912, 229376, 163840, 98304, 294912, 163840, 229376, 229376, 229376,
+    163840, 163840, 98304, 163840, 163840, 229376, 294912, 163840, 98304, 229376, 229376, 229376,
+    229376, 229376, 229376, 294912, 229376, 229376, 229376, 229376, 163840, 229376, 229376, 98304,
+    163840, 229376, 229376, 229376, 360448, 294912, 229376, 294912, 163840, 163840, 98304, 98304,
+    163840, 98304, 294912, 294912, 294912, 294912, 32768, 163840, 229376, 229376, 163840, 229376,
+    98304, 163840, 98304, 98304, 163840, 229376, 98304, 32768, 163840, 294912, 294912, 229376,
+    229376, 229376, 163840, 5406720, 8486912, 8421376, 8486912, 8421376, 8421376, 8486912, 8486912, 8421376,
+    8421376, 8421376, 8486912, 8486912, 8421376, 8486912, 8421376, 8421376, 5865472, 294912, 163840, 163840,
+    163840, 229376, 229376, 163840, 163840, 163840, 98304, 229376, 294912, 98304, 32768, 229376,
+    98304, 98304, 163840, 229376, 229376, 294912, 294912, 229376, 163840, 229376, 163840, 229376,
+    294912, 229376, 294912, 360448, 229376, 229376, 229376, 163840, 229376, 294912, 229376, 294912,
+    163840, 229376, 294912, 229376, 163840, 163840, 229376, 229376, 294912, 163840, 98304, 98304,
+    32768, 163840, 229376, 360448, 294912, 229376, 98304, 229376, 98304, 98304, 163840, 229376,
+    294912, 163840, 294912, 294912, 229376, 163840, 294912, 294912, 229376, 294912, 360448, 294912,
+    294912, 229376, 2719744, 8421376, 8486912, 8421376, 8421376, 8421376, 8421376, 8421376, 8617984, 8486912,
+    8421376, 8421376, 8421376, 8486912, 8486912, 8486912, 8421376, 8421376, 8486912, 2260992, 98304, 98304,
+    163840, 294912, 163840, 98304, 163840, 163840, 32768, 163840, 163840, 163840, 163840, 163840,
+    229376, 163840, 229376, 229376, 229376, 229376, 294912, 229376, 229376, 229376, 294912, 294912,
+    229376, 163840, 163840, 163840, 294912, 229376, 163840, 229376, 163840, 229376, 294912, 163840,
+    163840, 294912, 294912, 163840, 294912, 229376, 163840, 229376, 360448, 360448, 294912, 163840,
+    98304, 32768, 229376, 294912, 294912, 229376, 98304, 163840, 163840, 98304, 163840, 229376,
+    163840, 163840, 98304, 294912, 163840, 163840, 32768, 163840, 229376, 229376, 163840, 229376,
+    229376, 229376, 7438337, 8486912, 8421376, 8486912, 8421376, 8421376, 8421376, 8421376, 8486912, 8421376,
+    8421376, 8421376, 8486912, 8552448, 8421376, 8486912, 8421376, 8421376, 8486912, 7438337, 622592, 229376,
+    229376, 229376, 163840, 163840, 98304, 98304, 98304, 163840, 229376, 229376, 163840, 163840,
+    229376, 163840, 229376, 229376, 163840, 229376, 229376, 229376, 229376, 229376, 229376, 229376,
+    294912, 163840, 163840, 229376, 163840, 229376, 360448, 229376, 229376, 229376, 163840, 163840,
+    229376, 294912, 229376, 163840, 98304, 229376, 98304, 163840, 163840, 163840, 229376, 98304,
+    163840, 163840, 163840, 229376, 229376, 163840, 163840, 229376, 32768, 163840, 229376, 294912,
+    229376, 229376, 294912, 229376, 163840, 163840, 98304, 98304, 98304, 98304, 98304, 229376,
+    294912, 4358144, 8421376, 8486912, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376,
+    8421376, 8486912, 8486912, 8486912, 8421376, 8486912, 8486912, 8486912, 8486912, 8421376, 4816896, 163840,
+    229376, 229376, 163840, 294912, 98304, 98304, 98304, 98304, 229376, 229376, 163840, 229376,
+    163840, 229376, 163840, 229376, 229376, 229376, 98304, 294912, 294912, 294912, 163840, 294912,
+    360448, 294912, 163840, 229376, 98304, 163840, 163840, 163840, 163840, 360448, 163840, 163840,
+    294912, 294912, 163840, 229376, 163840, 229376, 98304, 163840, 98304, 163840, 163840, 163840,
+    163840, 163840, 163840, 163840, 229376, 98304, 163840, 98304, 98304, 163840, 229376, 229376,
+    163840, 294912, 229376, 163840, 163840, 163840, 98304, 98304, 163840, 32768, 229376, 294912,
+    1802240, 8486912, 8486912, 8486912, 8486912, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8486912,
+    8486912, 8486912, 8486912, 8486912, 8486912, 8421376, 8421376, 8421376, 8552448, 8486912, 8421376, 2195456,
+    229376, 229376, 294912, 294912, 163840, 98304, 229376, 229376, 229376, 294912, 229376, 294912,
+    294912, 229376, 163840, 294912, 229376, 229376, 229376, 229376, 360448, 294912, 229376, 229376,
+    229376, 229376, 229376, 163840, 163840, 163840, 163840, 294912, 294912, 294912, 294912, 163840,
+    229376, 229376, 98304, 98304, 98304, 98304, 98304, 98304, 163840, 163840, 98304, 32768,
+    32768, 32768, 360448, 294912, 163840, 163840, 163840, 98304, 229376, 229376, 229376, 163840,
+    294912, 229376, 98304, 98304, 163840, 229376, 360448, 229376, 32768, 98304, 163840, 1146880,
+    7503873, 8486912, 8421376, 8486912, 8486912, 8486912, 8421376, 8421376, 8421376, 8421376, 8421376, 8486912,
+    8486912, 8486912, 8552448, 8486912, 8486912, 8421376, 8486912, 8486912, 8486912, 8486912, 8421376, 7438337,
+    753664, 294912, 360448, 360448, 229376, 163840, 32768, 163840, 229376, 229376, 229376, 229376,
+    294912, 294912, 229376, 229376, 229376, 294912, 229376, 229376, 229376, 360448, 163840, 229376,
+    163840, 229376, 229376, 294912, 229376, 229376, 229376, 294912, 163840, 229376, 163840, 98304,
+    229376, 229376, 32768, 32768, 32768, 98304, 32768, 32768, 32768, 98304, 32768, 32768,
+    32768, 98304, 229376, 294912, 163840, 98304, 163840, 163840, 163840, 229376, 163840, 229376,
+    294912, 229376, 229376, 163840, 163840, 229376, 163840, 229376, 163840, 163840, 163840, 5341184,
+    8421376, 8421376, 8421376, 8486912, 8486912, 8421376, 8421376, 8486912, 8421376, 8421376, 8486912, 8486912,
+    8421376, 8486912, 8421376, 8421376, 8486912, 8421376, 8421376, 8486912, 8486912, 8486912, 8486912, 8486912,
+    5865472, 229376, 229376, 294912, 229376, 229376, 163840, 163840, 229376, 294912, 163840, 294912,
+    229376, 360448, 294912, 229376, 294912, 360448, 360448, 229376, 163840, 294912, 229376, 229376,
+    163840, 229376, 163840, 163840, 294912, 294912, 229376, 163840, 98304, 163840, 229376, 163840,
+    229376, 229376, 32768, 32768, 32768, 98304, 229376, 229376, 98304, 163840, 98304, 98304,
+    32768, 32768, 98304, 163840, 32768, 163840, 229376, 163840, 163840, 98304, 163840, 229376,
+    229376, 229376, 98304, 163840, 163840, 163840, 229376, 98304, 294912, 229376, 4358144, 8486912,
+    8421376, 8421376, 8421376, 8486912, 8486912, 8486912, 8421376, 8486912, 8552448, 8486912, 8486912, 8486912,
+    8486912, 8421376, 8486912, 8421376, 8421376, 8486912, 8421376, 8421376, 8486912, 8486912, 8486912, 8486912,
+    8421376, 3768320, 163840, 98304, 294912, 294912, 98304, 229376, 294912, 163840, 229376, 98304,
+    294912, 294912, 294912, 229376, 229376, 229376, 229376, 229376, 229376, 229376, 229376, 360448,
+    163840, 229376, 229376, 163840, 229376, 229376, 229376, 294912, 163840, 229376, 163840, 32768,
+    163840, 98304, 98304, 32768, 32768, 98304, 163840, 163840, 229376, 98304, 32768, 32768,
+    98304, 98304, 32768, 98304, 98304, 32768, 229376, 229376, 163840, 163840, 163840, 229376,
+    294912, 294912, 98304, 98304, 98304, 98304, 98304, 98304, 163840, 2326528, 8486912, 8421376,
+    8421376, 8421376, 8421376, 8421376, 8486912, 8486912, 8486912, 8552448, 8486912, 8486912, 8486912, 8486912,
+    8421376, 8421376, 8421376, 8486912, 8421376, 8421376, 8421376, 8421376, 8421376, 8486912, 8552448, 8486912,
+    8421376, 8421376, 2129920, 98304, 294912, 294912, 163840, 163840, 294912, 98304, 163840, 360448,
+    229376, 294912, 294912, 98304, 294912, 294912, 294912, 294912, 163840, 360448, 294912, 229376,
+    294912, 360448, 229376, 294912, 294912, 294912, 229376, 229376, 98304, 229376, 98304, 163840,
+    98304, 163840, 98304, 98304, 163840, 163840, 163840, 229376, 294912, 229376, 98304, 32768,
+    98304, 98304, 163840, 98304, 163840, 229376, 98304, 98304, 98304, 98304, 98304, 163840,
+    229376, 163840, 229376, 163840, 98304, 32768, 229376, 163840, 1146880, 7962625, 8486912, 8421376,
+    8421376, 8421376, 8421376, 8421376, 8486912, 8486912, 8421376, 8421376, 8486912, 8486912, 8486912, 8486912,
+    8421376, 8486912, 8421376, 8421376, 8486912, 8486912, 8421376, 8421376, 8486912, 8421376, 8486912, 8421376,
+    8421376, 8421376, 7897089, 1212416, 163840, 294912, 163840, 163840, 163840, 163840, 98304, 163840,
+    294912, 294912, 163840, 163840, 294912, 294912, 229376, 229376, 229376, 229376, 229376, 229376,
+    163840, 163840, 229376, 98304, 229376, 229376, 163840, 294912, 229376, 229376, 360448, 229376,
+    163840, 163840, 32768, 98304, 163840, 163840, 229376, 229376, 163840, 163840, 98304, 163840,
+    163840, 98304, 98304, 98304, 163840, 229376, 163840, 163840, 98304, 163840, 98304, 229376,
+    229376, 229376, 32768, 98304, 98304, 98304, 98304, 1081344, 7372801, 8421376, 8421376, 8421376,
+    8421376, 8421376, 8421376, 8421376, 8421376, 8486912, 8421376, 8421376, 8486912, 8486912, 8486912, 8421376,
+    8486912, 8486912, 8421376, 8486912, 8486912, 8486912, 8421376, 8421376, 8421376, 8486912, 8421376, 8486912,
+    8421376, 8421376, 8421376, 7438337, 1146880, 229376, 98304, 98304, 294912, 229376, 163840, 163840,
+    98304, 229376, 98304, 163840, 229376, 294912, 360448, 229376, 229376, 294912, 163840, 294912,
+    229376, 229376, 229376, 294912, 229376, 163840, 229376, 229376, 229376, 229376, 294912, 163840,
+    229376, 163840, 98304, 98304, 163840, 294912, 163840, 229376, 163840, 294912, 163840, 163840,
+    98304, 98304, 98304, 163840, 294912, 229376, 229376, 163840, 32768, 98304, 229376, 98304,
+    229376, 98304, 32768, 98304, 163840, 229376, 1212416, 7438337, 8421376, 8421376, 8421376, 8421376,
+    8421376, 8421376, 8421376, 8421376, 8486912, 8486912, 8486912, 8421376, 8486912, 8486912, 8486912, 8486912,
+    8486912, 8421376, 8421376, 8421376, 8486912, 8421376, 8421376, 8421376, 8421376, 8486912, 8421376, 8486912,
+    8421376, 8421376, 8421376, 8486912, 7438337, 1081344, 98304, 98304, 360448, 229376, 163840, 163840,
+    163840, 229376, 163840, 163840, 229376, 360448, 294912, 229376, 229376, 229376, 229376, 294912,
+    229376, 163840, 163840, 229376, 294912, 360448, 229376, 229376, 229376, 229376, 163840, 163840,
+    229376, 163840, 163840, 163840, 229376, 360448, 229376, 229376, 229376, 229376, 98304, 98304,
+    98304, 163840, 163840, 163840, 163840, 163840, 229376, 229376, 32768, 163840, 163840, 163840,
+    98304, 163840, 98304, 163840, 163840, 753664, 7438337, 8486912, 8421376, 8486912, 8421376, 8421376,
+    8421376, 8421376, 8421376, 8421376, 8486912, 8486912, 8486912, 8486912, 8486912, 8486912, 8421376, 8552448,
+    8421376, 8421376, 8486912, 8421376, 8421376, 8486912, 8421376, 8486912, 8421376, 8486912, 8421376, 8421376,
+    8421376, 8421376, 8486912, 8486912, 8486912, 6914049, 557056, 229376, 163840, 294912, 98304, 32768,
+    98304, 229376, 163840, 163840, 163840, 294912, 229376, 229376, 229376, 163840, 229376, 229376,
+    229376, 163840, 163840, 229376, 294912, 294912, 229376, 229376, 229376, 229376, 163840, 163840,
+    229376, 98304, 98304, 163840, 229376, 163840, 294912, 229376, 163840, 98304, 229376, 32768,
+    98304, 163840, 163840, 163840, 229376, 229376, 229376, 163840, 163840, 98304, 32768, 163840,
+    98304, 98304, 163840, 163840, 1277952, 6979585, 8421376, 8421376, 8421376, 8486912, 8421376, 8421376,
+    8421376, 8486912, 8486912, 8486912, 8486912, 8486912, 8486912, 8421376, 8421376, 8486912, 8486912, 8421376,
+    8486912, 8486912, 8421376, 8486912, 8486912, 8486912, 8421376, 8421376, 8486912, 8552448, 8421376, 8421376,
+    8421376, 8421376, 8486912, 8552448, 8486912, 8486912, 7438337, 1343488, 294912, 425984, 163840, 163840,
+    98304, 163840, 229376, 294912, 229376, 98304, 294912, 294912, 163840, 163840, 163840, 229376,
+    229376, 294912, 229376, 294912, 294912, 360448, 360448, 229376, 229376, 294912, 98304, 163840,
+    229376, 229376, 163840, 98304, 229376, 229376, 163840, 98304, 98304, 229376, 163840, 163840,
+    163840, 229376, 163840, 98304, 229376, 229376, 98304, 229376, 98304, 229376, 163840, 229376,
+    163840, 163840, 98304, 1212416, 7503873, 8486912, 8486912, 8421376, 8421376, 8486912, 8421376, 8421376,
+    8486912, 8421376, 8486912, 8486912, 8486912, 8486912, 8486912, 8421376, 8486912, 8486912, 8421376, 8486912,
+    8421376, 8486912, 8486912, 8486912, 8552448, 8552448, 8421376, 8486912, 8486912, 8486912, 8421376, 8421376,
+    8421376, 8421376, 8421376, 8486912, 8552448, 8421376, 8421376, 7438337, 1146880, 163840, 32768, 32768,
+    229376, 163840, 229376, 229376, 229376, 229376, 229376, 229376, 163840, 163840, 163840, 163840,
+    229376, 294912, 294912, 294912, 229376, 294912, 294912, 294912, 229376, 229376, 163840, 229376,
+    294912, 229376, 32768, 163840, 229376, 229376, 98304, 98304, 98304, 229376, 163840, 98304,
+    163840, 294912, 229376, 163840, 98304, 98304, 98304, 163840, 229376, 294912, 163840, 163840,
+    163840, 163840, 1212416, 7503873, 8486912, 8486912, 8552448, 8421376, 8421376, 8486912, 8421376, 8486912,
+    8486912, 8486912, 8486912, 8486912, 8486912, 8486912, 8421376, 8421376, 8486912, 8486912, 8486912, 8486912,
+    8486912, 8486912, 8486912, 8486912, 8486912, 8486912, 8486912, 8486912, 8421376, 8486912, 8421376, 8421376,
+    8421376, 8421376, 8486912, 8486912, 8486912, 8421376, 8421376, 8421376, 7438337, 1081344, 98304, 98304,
+    98304, 163840, 229376, 360448, 229376, 229376, 229376, 360448, 163840, 163840, 229376, 163840,
+    229376, 294912, 163840, 229376, 294912, 294912, 229376, 294912, 294912, 294912, 163840, 163840,
+    294912, 294912, 98304, 32768, 229376, 229376, 98304, 98304, 98304, 294912, 229376, 163840,
+    229376, 229376, 294912, 229376, 98304, 98304, 32768, 163840, 163840, 360448, 229376, 98304,
+    98304, 2260992, 7962625, 8421376, 8486912, 8486912, 8552448, 8421376, 8421376, 8421376, 8421376, 8421376,
+    8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8486912,
+    8421376, 8421376, 8421376, 8486912, 8486912, 8486912, 8421376, 8486912, 8421376, 8421376, 8421376, 8421376,
+    8421376, 8421376, 8421376, 8486912, 8486912, 8486912, 8486912, 8421376, 8421376, 7897089, 2195456, 98304,
+    98304, 98304, 163840, 229376, 229376, 229376, 229376, 229376, 98304, 163840, 163840, 229376,
+    294912, 294912, 163840, 229376, 229376, 294912, 229376, 229376, 229376, 163840, 163840, 229376,
+    425984, 360448, 32768, 163840, 229376, 229376, 98304, 98304, 163840, 163840, 163840, 163840,
+    229376, 229376, 229376, 229376, 98304, 98304, 98304, 163840, 294912, 229376, 229376, 98304,
+    3768320, 8486912, 8486912, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376,
+    8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376,
+    8486912, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8486912, 8486912, 8486912, 8421376, 8421376,
+    8421376, 8486912, 8421376, 8421376, 8421376, 8486912, 8486912, 8421376, 8421376, 8421376, 8421376, 4227072,
+    163840, 163840, 229376, 229376, 98304, 294912, 229376, 163840, 163840, 294912, 294912, 294912,
+    294912, 294912, 294912, 294912, 294912, 294912, 229376, 229376, 163840, 229376, 425984, 360448,
+    294912, 229376, 32768, 98304, 294912, 294912, 163840, 163840, 98304, 294912, 163840, 98304,
+    229376, 229376, 163840, 229376, 163840, 98304, 98304, 163840, 163840, 229376, 557056, 5799936,
+    8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8486912, 8421376, 8421376, 8421376,
+    8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8486912, 8421376, 8421376, 8421376, 8421376,
+    8421376, 8421376, 8421376, 8421376, 8486912, 8421376, 8486912, 8486912, 8552448, 8486912, 8421376, 8421376,
+    8421376, 8486912, 8486912, 8421376, 8421376, 8421376, 8421376, 8421376, 8486912, 8421376, 8421376, 8421376,
+    5341184, 1212416, 229376, 229376, 229376, 229376, 294912, 294912, 294912, 294912, 294912, 294912,
+    294912, 294912, 229376, 229376, 294912, 360448, 229376, 229376, 229376, 294912, 294912, 360448,
+    163840, 229376, 98304, 98304, 98304, 163840, 163840, 229376, 98304, 98304, 229376, 163840,
+    163840, 229376, 229376, 229376, 229376, 163840, 32768, 163840, 229376, 2260992, 7372801, 8421376,
+    8421376, 8486912, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8486912, 8486912, 8421376, 8421376,
+    8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8486912,
+    8421376, 8486912, 8421376, 8486912, 8486912, 8486912, 8421376, 8486912, 8486912, 8486912, 8421376, 8421376,
+    8421376, 8421376, 8421376, 8486912, 8421376, 8421376, 8421376, 8486912, 8421376, 8421376, 8421376, 8421376,
+    8421376, 7438337, 1736704, 229376, 98304, 294912, 163840, 163840, 294912, 229376, 229376, 229376,
+    163840, 163840, 229376, 229376, 294912, 294912, 229376, 229376, 229376, 294912, 163840, 163840,
+    98304, 163840, 98304, 98304, 32768, 163840, 229376, 229376, 98304, 163840, 294912, 360448,
+    294912, 229376, 229376, 294912, 163840, 163840, 163840, 557056, 4816896, 8421376, 8421376, 8421376,
+    8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8486912, 8421376, 8421376,
+    8421376, 8421376, 8486912, 8421376, 8486912, 8486912, 8421376, 8421376, 8421376, 8486912, 8486912, 8552448,
+    8421376, 8421376, 8421376, 8486912, 8486912, 8486912, 8421376, 8421376, 8421376, 8486912, 8486912, 8486912,
+    8421376, 8486912, 8486912, 8421376, 8421376, 8421376, 8421376, 8421376, 8486912, 8486912, 8421376, 8421376,
+    8421376, 8421376, 8421376, 4358144, 229376, 163840, 98304, 163840, 294912, 229376, 229376, 229376,
+    163840, 163840, 294912, 229376, 294912, 229376, 229376, 229376, 229376, 229376, 163840, 98304,
+    294912, 360448, 229376, 98304, 32768, 229376, 163840, 229376, 163840, 229376, 229376, 294912,
+    229376, 294912, 229376, 294912, 294912, 229376, 2260992, 7438337, 8421376, 8421376, 8421376, 8421376,
+    8486912, 8486912, 8421376, 8421376, 8486912, 8486912, 8421376, 8486912, 8486912, 8421376, 8421376, 8486912,
+    8421376, 8486912, 8486912, 8421376, 8486912, 8486912, 8421376, 8421376, 8421376, 8421376, 8486912, 8486912,
+    8486912, 8486912, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8486912, 8486912, 8486912,
+    8486912, 8486912, 8486912, 8486912, 8421376, 8421376, 8421376, 8421376, 8486912, 8421376, 8421376, 8421376,
+    8421376, 8421376, 8421376, 8421376, 7503873, 2785280, 163840, 229376, 229376, 229376, 229376, 229376,
+    229376, 229376, 294912, 229376, 294912, 229376, 229376, 294912, 163840, 163840, 163840, 163840,
+    229376, 294912, 163840, 163840, 98304, 163840, 98304, 229376, 229376, 229376, 229376, 360448,
+    163840, 163840, 294912, 229376, 1146880, 5865472, 8421376, 8486912, 8486912, 8421376, 8421376, 8421376,
+    8486912, 8486912, 8421376, 8486912, 8421376, 8486912, 8421376, 8421376, 8421376, 8486912, 8421376, 8486912,
+    8486912, 8486912, 8486912, 8486912, 8486912, 8486912, 8421376, 8421376, 8421376, 8552448, 8486912, 8552448,
+    8552448, 8486912, 8421376, 8421376, 8421376, 8486912, 8421376, 8421376, 8486912, 8486912, 8486912, 8486912,
+    8421376, 8486912, 8421376, 8486912, 8486912, 8421376, 8421376, 8421376, 8421376, 8486912, 8421376, 8486912,
+    8486912, 8486912, 8421376, 8421376, 8486912, 8486912, 5406720, 1146880, 229376, 229376, 294912, 229376,
+    294912, 294912, 229376, 229376, 294912, 229376, 229376, 229376, 163840, 229376, 163840, 229376,
+    425984, 294912, 229376, 294912, 98304, 163840, 163840, 229376, 163840, 229376, 229376, 229376,
+    229376, 229376, 557056, 4292608, 7962625, 8486912, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376,
+    8486912, 8486912, 8421376, 8486912, 8421376, 8421376, 8486912, 8421376, 8486912, 8421376, 8421376, 8486912,
+    8486912, 8486912, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8486912, 8486912, 8486912,
+    8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8486912, 8486912, 8486912, 8421376,
+    8421376, 8421376, 8421376, 8421376, 8486912, 8421376, 8421376, 8421376, 8486912, 8486912, 8421376, 8421376,
+    8486912, 8486912, 8486912, 8421376, 8552448, 8486912, 8486912, 8486912, 5406720, 1212416, 163840, 360448,
+    294912, 229376, 294912, 229376, 229376, 229376, 229376, 229376, 229376, 229376, 294912, 294912,
+    229376, 294912, 229376, 294912, 163840, 163840, 294912, 229376, 163840, 229376, 163840, 163840,
+    622592, 4358144, 7962625, 8421376, 8486912, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376,
+    8486912, 8486912, 8421376, 8421376, 8486912, 8421376, 8421376, 8421376, 8486912, 8421376, 8421376, 8486912,
+    8486912, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8486912, 8421376, 8421376, 8486912,
+    8486912, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8486912, 8486912, 8486912, 8421376,
+    8421376, 8421376, 8421376, 8421376, 8486912, 8486912, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376,
+    8486912, 8486912, 8421376, 8421376, 8486912, 8552448, 8486912, 8486912, 8486912, 7438337, 4358144, 1277952,
+    294912, 360448, 229376, 229376, 229376, 229376, 294912, 229376, 229376, 229376, 294912, 360448,
+    229376, 229376, 98304, 32768, 163840, 229376, 163840, 163840, 98304, 163840, 1081344, 4358144,
+    7962625, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376,
+    8421376, 8486912, 8421376, 8421376, 8486912, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376,
+    8486912, 8486912, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8486912, 8421376, 8486912,
+    8486912, 8486912, 8486912, 8486912, 8421376, 8421376, 8421376, 8421376, 8421376, 8486912, 8486912, 8486912,
+    8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376,
+    8421376, 8486912, 8421376, 8421376, 8486912, 8486912, 8486912, 8486912, 8486912, 8486912, 8421376, 8486912,
+    5341184, 1146880, 163840, 294912, 163840, 294912, 163840, 163840, 163840, 163840, 163840, 229376,
+    163840, 163840, 98304, 229376, 229376, 294912, 163840, 163840, 2195456, 6389761, 8421376, 8421376,
+    8421376, 8486912, 8486912, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8486912, 8486912,
+    8486912, 8486912, 8421376, 8421376, 8421376, 8486912, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376,
+    8486912, 8486912, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8486912,
+    8486912, 8617984, 8421376, 8552448, 8486912, 8421376, 8486912, 8486912, 8486912, 8486912, 8486912, 8421376,
+    8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376,
+    8421376, 8421376, 8486912, 8486912, 8421376, 8421376, 8486912, 8486912, 8486912, 8486912, 8486912, 8486912,
+    8486912, 8486912, 5799936, 2719744, 229376, 229376, 98304, 294912, 163840, 229376, 229376, 229376,
+    163840, 229376, 163840, 163840, 98304, 2129920, 4751360, 7962625, 8421376, 8421376, 8421376, 8421376,
+    8486912, 8421376, 8486912, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8486912,
+    8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8486912, 8421376, 8421376, 8421376, 8421376,
+    8486912, 8486912, 8486912, 8486912, 8421376, 8486912, 8421376, 8421376, 8486912, 8486912, 8486912, 8486912,
+    8486912, 8486912, 8486912, 8486912, 8486912, 8421376, 8486912, 8486912, 8486912, 8421376, 8421376, 8421376,
+    8421376, 8421376, 8421376, 8421376, 8421376, 8486912, 8421376, 8421376, 8421376, 8421376, 8421376, 8486912,
+    8486912, 8486912, 8421376, 8486912, 8421376, 8486912, 8486912, 8486912, 8421376, 8486912, 8486912, 8421376,
+    8421376, 8421376, 8421376, 8552448, 7438337, 5341184, 2392064, 294912, 294912, 229376, 229376, 294912,
+    229376, 688128, 3244032, 5341184, 7962625, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376,
+    8421376, 8486912, 8486912, 8421376, 8486912, 8486912, 8486912, 8486912, 8421376, 8421376, 8552448, 8486912,
+    8486912, 8486912, 8421376, 8486912, 8421376, 8421376, 8421376, 8486912, 8486912, 8486912, 8421376, 8421376,
+    8486912, 8486912, 8486912, 8552448, 8552448, 8486912, 8421376, 8421376, 8486912, 8552448, 8552448, 8486912,
+    8421376, 8421376, 8421376, 8421376, 8421376, 8486912, 8486912, 8486912, 8486912, 8421376, 8421376, 8421376,
+    8421376, 8421376, 8421376, 8421376, 8486912, 8486912, 8421376, 8421376, 8421376, 8421376, 8421376, 8486912,
+    8486912, 8421376, 8421376, 8421376, 8486912, 8486912, 8421376, 8486912, 8486912, 8486912, 8486912, 8486912,
+    8421376, 8421376, 8486912, 8486912, 8486912, 8552448, 8486912, 7503873, 5406720, 2850816, 1212416, 163840,
+    3833856, 8486912, 8486912, 8486912, 8421376, 8486912, 8486912, 8486912, 8486912, 8486912, 8421376, 8486912,
+    8552448, 8486912, 8486912, 8486912, 8421376, 8486912, 8486912, 8486912, 8486912, 8486912, 8486912, 8552448,
+    8486912, 8486912, 8421376, 8421376, 8421376, 8486912, 8486912, 8486912, 8486912, 8486912, 8421376, 8421376,
+    8486912, 8421376, 8421376, 8486912, 8486912, 8486912, 8421376, 8486912, 8421376, 8421376, 8486912, 8486912,
+    8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8486912, 8421376, 8421376, 8421376, 8486912,
+    8486912, 8486912, 8421376, 8421376, 8486912, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8486912,
+    8486912, 8421376, 8421376, 8421376, 8421376, 8486912, 8486912, 8486912, 8486912, 8421376, 8421376, 8421376,
+    8421376, 8486912, 8486912, 8486912, 8486912, 8486912, 8486912, 8486912, 8421376, 8486912, 8421376, 3833856,
+    7438337, 8486912, 8486912, 8486912, 8552448, 8486912, 8486912, 8486912, 8486912, 8486912, 8486912, 8486912,
+    8486912, 8552448, 8486912, 8486912, 8421376, 8486912, 8552448, 8421376, 8486912, 8486912, 8486912, 8486912,
+    8486912, 8486912, 8486912, 8486912, 8421376, 8421376, 8486912, 8486912, 8552448, 8421376, 8421376, 8421376,
+    8486912, 8486912, 8486912, 8421376, 8486912, 8486912, 8421376, 8486912, 8486912, 8486912, 8486912, 8421376,
+    8421376, 8421376, 8486912, 8421376, 8421376, 8421376, 8421376, 8486912, 8486912, 8421376, 8421376, 8421376,
+    8421376, 8421376, 8421376, 8421376, 8486912, 8486912, 8421376, 8421376, 8421376, 8421376, 8486912, 8552448,
+    8486912, 8486912, 8421376, 8421376, 8421376, 8486912, 8486912, 8486912, 8486912, 8486912, 8486912, 8421376,
+    8486912, 8421376, 8421376, 8486912, 8486912, 8421376, 8486912, 8486912, 8421376, 8421376, 8486912, 7962625,
+    7962625, 8486912, 8486912, 8486912, 8486912, 8486912, 8421376, 8421376, 8421376, 8486912, 8421376, 8421376,
+    8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8486912, 8486912, 8421376, 8421376,
+    8486912, 8421376, 8421376, 8421376, 8421376, 8486912, 8486912, 8486912, 8421376, 8421376, 8421376, 8421376,
+    8486912, 8486912, 8421376, 8421376, 8486912, 8421376, 8421376, 8421376, 8486912, 8486912, 8486912, 8486912,
+    8486912, 8486912, 8421376, 8486912, 8486912, 8486912, 8421376, 8421376, 8486912, 8486912, 8421376, 8421376,
+    8421376, 8421376, 8421376, 8421376, 8486912, 8421376, 8421376, 8486912, 8421376, 8486912, 8486912, 8421376,
+    8486912, 8486912, 8486912, 8421376, 8421376, 8421376, 8421376, 8421376, 8486912, 8486912, 8486912, 8486912,
+    8486912, 8486912, 8421376, 8421376, 8486912, 8486912, 8421376, 8486912, 8486912, 8486912, 8486912, 7503873,
+    3833856, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8486912, 8421376, 8486912,
+    8421376, 8486912, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8486912, 8486912, 8421376, 8421376,
+    8421376, 8421376, 8421376, 8421376, 8421376, 8486912, 8486912, 8421376, 8421376, 8421376, 8421376, 8421376,
+    8552448, 8486912, 8486912, 8486912, 8421376, 8421376, 8421376, 8421376, 8421376, 8486912, 8421376, 8421376,
+    8486912, 8486912, 8486912, 8486912, 8486912, 8421376, 8421376, 8421376, 8421376, 8486912, 8486912, 8421376,
+    8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8486912, 8552448, 8486912, 8421376,
+    8421376, 8421376, 8486912, 8486912, 8421376, 8421376, 8421376, 8421376, 8486912, 8486912, 8486912, 8486912,
+    8486912, 8421376, 8421376, 8486912, 8486912, 8421376, 8486912, 8486912, 8486912, 8486912, 8486912, 3899392,
+    229376, 1409024, 2654208, 5406720, 7438337, 8421376, 8421376, 8421376, 8421376, 8421376, 8486912, 8421376,
+    8421376, 8421376, 8421376, 8486912, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376,
+    8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376,
+    8421376, 8421376, 8421376, 8421376, 8486912, 8486912, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376,
+    8486912, 8421376, 8486912, 8486912, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8486912,
+    8486912, 8486912, 8421376, 8421376, 8486912, 8421376, 8421376, 8421376, 8421376, 8421376, 8486912, 8486912,
+    8486912, 8486912, 8486912, 8486912, 8421376, 8421376, 8486912, 8486912, 8486912, 8486912, 8486912, 8421376,
+    8421376, 8421376, 8486912, 8486912, 8421376, 8486912, 8486912, 8028161, 5341184, 3244032, 622592, 163840,
+    229376, 294912, 229376, 229376, 163840, 2195456, 5275648, 7438337, 8421376, 8421376, 8421376, 8421376,
+    8421376, 8421376, 8486912, 8421376, 8421376, 8486912, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376,
+    8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8486912, 8421376,
+    8486912, 8486912, 8421376, 8421376, 8486912, 8486912, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376,
+    8421376, 8486912, 8421376, 8486912, 8421376, 8421376, 8421376, 8421376, 8421376, 8486912, 8486912, 8486912,
+    8486912, 8421376, 8421376, 8421376, 8486912, 8421376, 8421376, 8421376, 8486912, 8486912, 8486912, 8486912,
+    8486912, 8486912, 8486912, 8486912, 8421376, 8421376, 8486912, 8486912, 8486912, 8421376, 8486912, 8421376,
+    8421376, 8486912, 8486912, 8486912, 7962625, 4882432, 2260992, 294912, 229376, 163840, 98304, 163840,
+    229376, 294912, 163840, 98304, 163840, 98304, 163840, 163840, 2719744, 5931008, 8421376, 8421376,
+    8486912, 8421376, 8486912, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8486912, 8421376, 8421376,
+    8421376, 8486912, 8486912, 8421376, 8421376, 8421376, 8486912, 8421376, 8486912, 8421376, 8486912, 8486912,
+    8486912, 8486912, 8486912, 8486912, 8421376, 8552448, 8421376, 8421376, 8421376, 8486912, 8421376, 8421376,
+    8421376, 8421376, 8421376, 8421376, 8486912, 8421376, 8421376, 8421376, 8421376, 8486912, 8486912, 8486912,
+    8486912, 8486912, 8486912, 8486912, 8486912, 8486912, 8421376, 8421376, 8421376, 8421376, 8486912, 8486912,
+    8486912, 8486912, 8486912, 8486912, 8486912, 8486912, 8486912, 8486912, 8486912, 8486912, 8421376, 8421376,
+    8486912, 8486912, 6389761, 2260992, 294912, 360448, 229376, 229376, 98304, 163840, 163840, 98304,
+    294912, 294912, 229376, 229376, 163840, 163840, 163840, 163840, 294912, 229376, 1081344, 5341184,
+    8421376, 8421376, 8421376, 8552448, 8552448, 8421376, 8421376, 8486912, 8486912, 8486912, 8421376, 8486912,
+    8421376, 8421376, 8486912, 8421376, 8486912, 8421376, 8421376, 8486912, 8486912, 8421376, 8552448, 8486912,
+    8486912, 8486912, 8486912, 8552448, 8552448, 8486912, 8421376, 8421376, 8421376, 8486912, 8421376, 8421376,
+    8486912, 8421376, 8421376, 8421376, 8486912, 8486912, 8421376, 8421376, 8421376, 8421376, 8486912, 8486912,
+    8486912, 8486912, 8486912, 8486912, 8486912, 8421376, 8421376, 8421376, 8421376, 8421376, 8486912, 8486912,
+    8486912, 8486912, 8486912, 8421376, 8486912, 8486912, 8486912, 8486912, 8421376, 8486912, 8421376, 7962625,
+    4358144, 1277952, 229376, 229376, 425984, 425984, 229376, 229376, 163840, 294912, 163840, 163840,
+    294912, 229376, 229376, 229376, 360448, 294912, 294912, 229376, 294912, 294912, 163840, 163840,
+    1212416, 4358144, 7438337, 8486912, 8486912, 8486912, 8421376, 8486912, 8552448, 8486912, 8421376, 8421376,
+    8486912, 8486912, 8486912, 8486912, 8486912, 8486912, 8486912, 8486912, 8486912, 8421376, 8421376, 8486912,
+    8421376, 8486912, 8486912, 8552448, 8486912, 8486912, 8486912, 8421376, 8421376, 8421376, 8421376, 8421376,
+    8421376, 8486912, 8486912, 8421376, 8486912, 8421376, 8421376, 8421376, 8421376, 8486912, 8421376, 8486912,
+    8486912, 8486912, 8486912, 8486912, 8486912, 8486912, 8421376, 8421376, 8421376, 8486912, 8486912, 8486912,
+    8486912, 8486912, 8421376, 8486912, 8486912, 8486912, 8486912, 8486912, 8486912, 7962625, 4292608, 622592,
+    163840, 163840, 163840, 294912, 294912, 360448, 229376, 163840, 294912, 229376, 98304, 163840,
+    294912, 163840, 229376, 294912, 360448, 294912, 163840, 229376, 360448, 360448, 163840, 229376,
+    163840, 294912, 1081344, 5341184, 8486912, 8421376, 8421376, 8486912, 8552448, 8552448, 8486912, 8486912,
+    8486912, 8552448, 8486912, 8486912, 8486912, 8486912, 8486912, 8486912, 8486912, 8421376, 8421376, 8486912,
+    8421376, 8421376, 8486912, 8486912, 8486912, 8486912, 8486912, 8421376, 8421376, 8421376, 8421376, 8421376,
+    8486912, 8486912, 8486912, 8486912, 8486912, 8421376, 8421376, 8421376, 8486912, 8486912, 8421376, 8486912,
+    8486912, 8486912, 8421376, 8486912, 8486912, 8486912, 8421376, 8421376, 8486912, 8486912, 8421376, 8486912,
+    8486912, 8486912, 8421376, 8486912, 8486912, 8486912, 8486912, 8028161, 4358144, 688128, 294912, 163840,
+    163840, 163840, 163840, 163840, 294912, 360448, 294912, 229376, 294912, 229376, 163840, 163840,
+    229376, 229376, 229376, 294912, 229376, 163840, 294912, 294912, 229376, 360448, 294912, 163840,
+    163840, 163840, 32768, 163840, 1146880, 5472256, 8421376, 8486912, 8552448, 8486912, 8421376, 8486912,
+    8421376, 8421376, 8486912, 8421376, 8552448, 8486912, 8486912, 8486912, 8486912, 8486912, 8421376, 8421376,
+    8486912, 8421376, 8421376, 8421376, 8421376, 8421376, 8486912, 8486912, 8421376, 8421376, 8421376, 8421376,
+    8486912, 8486912, 8486912, 8486912, 8486912, 8486912, 8486912, 8486912, 8486912, 8421376, 8421376, 8421376,
+    8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8486912, 8486912, 8486912, 8486912, 8486912,
+    8486912, 8486912, 8486912, 8486912, 8486912, 8486912, 5865472, 1212416, 294912, 229376, 229376, 163840,
+    294912, 294912, 294912, 229376, 294912, 294912, 294912, 229376, 229376, 163840, 229376, 294912,
+    229376, 229376, 163840, 229376, 163840, 163840, 229376, 294912, 229376, 294912, 98304, 98304,
+    98304, 163840, 32768, 98304, 229376, 229376, 2654208, 7372801, 8421376, 8486912, 8421376, 8421376,
+    8486912, 8421376, 8421376, 8421376, 8486912, 8552448, 8486912, 8486912, 8552448, 8486912, 8421376, 8421376,
+    8486912, 8421376, 8421376, 8421376, 8421376, 8421376, 8486912, 8421376, 8421376, 8421376, 8421376, 8421376,
+    8421376, 8486912, 8486912, 8486912, 8421376, 8421376, 8421376, 8486912, 8486912, 8486912, 8421376, 8421376,
+    8421376, 8486912, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8486912, 8486912, 8486912, 8486912,
+    8421376, 8486912, 8486912, 8486912, 7503873, 2260992, 294912, 229376, 229376, 229376, 294912, 229376,
+    229376, 163840, 229376, 229376, 294912, 294912, 229376, 229376, 98304, 163840, 229376, 229376,
+    229376, 163840, 229376, 163840, 229376, 229376, 229376, 294912, 229376, 294912, 360448, 294912,
+    229376, 163840, 98304, 163840, 163840, 163840, 32768, 163840, 4292608, 8421376, 8421376, 8421376,
+    8486912, 8486912, 8421376, 8421376, 8421376, 8421376, 8421376, 8486912, 8486912, 8486912, 8486912, 8421376,
+    8421376, 8421376, 8421376, 8421376, 8421376, 8486912, 8421376, 8421376, 8421376, 8486912, 8421376, 8421376,
+    8486912, 8486912, 8421376, 8421376, 8486912, 8421376, 8421376, 8486912, 8552448, 8486912, 8421376, 8421376,
+    8421376, 8421376, 8421376, 8486912, 8421376, 8421376, 8421376, 8421376, 8486912, 8486912, 8486912, 8486912,
+    8486912, 8486912, 8486912, 4882432, 753664, 229376, 229376, 229376, 229376, 229376, 229376, 229376,
+    229376, 229376, 229376, 229376, 360448, 229376, 98304, 229376, 98304, 163840, 98304, 163840,
+    294912, 294912, 229376, 294912, 229376, 294912, 229376, 229376, 229376, 229376, 229376, 294912,
+    229376, 294912, 32768, 163840, 32768, 163840, 98304, 98304, 32768, 1605632, 7438337, 8486912,
+    8486912, 8486912, 8421376, 8421376, 8421376, 8421376, 8421376, 8486912, 8486912, 8486912, 8421376, 8486912,
+    8486912, 8486912, 8421376, 8486912, 8421376, 8486912, 8421376, 8421376, 8486912, 8486912, 8421376, 8486912,
+    8552448, 8486912, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8486912, 8486912, 8421376, 8421376,
+    8421376, 8421376, 8486912, 8486912, 8421376, 8421376, 8421376, 8421376, 8486912, 8486912, 8486912, 8486912,
+    8486912, 7438337, 2260992, 229376, 229376, 229376, 229376, 229376, 229376, 229376, 229376, 229376,
+    229376, 229376, 229376, 294912, 360448, 294912, 229376, 229376, 98304, 98304, 98304, 98304,
+    229376, 229376, 294912, 229376, 229376, 229376, 229376, 229376, 229376, 294912, 163840, 163840,
+    229376, 163840, 32768, 98304, 229376, 163840, 32768, 32768, 229376, 98304, 1146880, 5341184,
+    8486912, 8421376, 8421376, 8421376, 8486912, 8486912, 8421376, 8486912, 8486912, 8486912, 8486912, 8421376,
+    8421376, 8421376, 8421376, 8486912, 8421376, 8486912, 8421376, 8421376, 8421376, 8486912, 8421376, 8552448,
+    8486912, 8486912, 8421376, 8421376, 8421376, 8421376, 8486912, 8421376, 8486912, 8486912, 8421376, 8421376,
+    8421376, 8421376, 8486912, 8486912, 8421376, 8421376, 8421376, 8421376, 8486912, 8486912, 8486912, 8486912,
+    5865472, 688128, 229376, 229376, 229376, 229376, 229376, 229376, 229376, 229376, 229376, 229376,
+    229376, 229376, 229376, 229376, 360448, 294912, 229376, 229376, 163840, 229376, 163840, 163840,
+    229376, 294912, 294912, 294912, 229376, 229376, 294912, 229376, 229376, 229376, 229376, 294912,
+    229376, 229376, 98304, 98304, 98304, 98304, 163840, 98304, 294912, 163840, 98304, 294912,
+    4358144, 8486912, 8486912, 8486912, 8486912, 8552448, 8486912, 8486912, 8486912, 8486912, 8486912, 8421376,
+    8421376, 8421376, 8421376, 8486912, 8552448, 8486912, 8486912, 8421376, 8421376, 8486912, 8486912, 8486912,
+    8486912, 8486912, 8421376, 8421376, 8421376, 8486912, 8486912, 8486912, 8421376, 8486912, 8486912, 8486912,
+    8421376, 8486912, 8486912, 8486912, 8421376, 8421376, 8421376, 8421376, 8486912, 8486912, 8486912, 3768320,
+    229376, 229376, 229376, 229376, 294912, 229376, 229376, 229376, 229376, 229376, 163840, 229376,
+    229376, 229376, 229376, 229376, 294912, 360448, 229376, 163840, 98304, 163840, 98304, 163840,
+    229376, 229376, 229376, 163840, 229376, 229376, 360448, 294912, 229376, 294912, 294912, 229376,
+    163840, 229376, 163840, 163840, 294912, 229376, 163840, 229376, 98304, 229376, 98304, 163840,
+    163840, 2260992, 7962625, 8486912, 8421376, 8486912, 8486912, 8552448, 8486912, 8421376, 8421376, 8421376,
+    8421376, 8421376, 8421376, 8486912, 8486912, 8486912, 8421376, 8486912, 8421376, 8486912, 8421376, 8421376,
+    8421376, 8486912, 8486912, 8486912, 8421376, 8486912, 8486912, 8486912, 8421376, 8421376, 8421376, 8421376,
+    8486912, 8421376, 8421376, 8421376, 8421376, 8486912, 8421376, 8421376, 8421376, 7897089, 2260992, 229376,
+    163840, 229376, 229376, 229376, 294912, 229376, 294912, 229376, 229376, 229376, 163840, 229376,
+    229376, 229376, 229376, 229376, 360448, 294912, 294912, 229376, 229376, 229376, 229376, 229376,
+    229376, 294912, 163840, 229376, 229376, 229376, 294912, 294912, 229376, 360448, 294912, 294912,
+    294912, 294912, 229376, 229376, 229376, 229376, 163840, 163840, 98304, 229376, 163840, 229376,
+    294912, 229376, 1277952, 7438337, 8421376, 8486912, 8486912, 8421376, 8486912, 8421376, 8486912, 8486912,
+    8421376, 8421376, 8421376, 8486912, 8486912, 8486912, 8486912, 8421376, 8486912, 8486912, 8421376, 8421376,
+    8421376, 8486912, 8486912, 8486912, 8421376, 8421376, 8486912, 8486912, 8421376, 8421376, 8421376, 8421376,
+    8421376, 8421376, 8421376, 8486912, 8486912, 8486912, 8421376, 8421376, 7438337, 1146880, 229376, 229376,
+    229376, 229376, 229376, 229376, 229376, 229376, 229376, 229376, 229376, 360448, 229376, 294912,
+    229376, 229376, 229376, 229376, 294912, 294912, 360448, 229376, 229376, 229376, 294912, 229376,
+    294912, 294912, 229376, 229376, 229376, 229376, 229376, 229376, 294912, 294912, 229376, 294912,
+    229376, 229376, 229376, 98304, 229376, 229376, 229376, 294912, 229376, 229376, 229376, 229376,
+    294912, 294912, 294912, 1212416, 7438337, 8486912, 8421376, 8421376, 8486912, 8486912, 8486912, 8486912,
+    8421376, 8486912, 8421376, 8486912, 8486912, 8421376, 8486912, 8486912, 8421376, 8486912, 8486912, 8486912,
+    8486912, 8486912, 8486912, 8486912, 8421376, 8486912, 8421376, 8486912, 8421376, 8421376, 8486912, 8486912,
+    8421376, 8421376, 8486912, 8486912, 8486912, 8486912, 8421376, 7438337, 1212416, 163840, 163840, 229376,
+    163840, 163840, 229376, 229376, 229376, 294912, 360448, 229376, 294912, 360448, 294912, 294912,
+    360448, 229376, 229376, 229376, 294912, 294912, 229376, 163840, 294912, 163840, 163840, 98304,
+    294912, 294912, 163840, 229376, 229376, 294912, 229376, 294912, 360448, 360448, 229376, 294912,
+    229376, 163840, 229376, 163840, 98304, 294912, 294912, 294912, 294912, 229376, 294912, 294912,
+    163840, 229376, 229376, 229376, 1212416, 7438337, 8486912, 8486912, 8486912, 8486912, 8486912, 8486912,
+    8552448, 8421376, 8421376, 8421376, 8486912, 8486912, 8486912, 8552448, 8486912, 8486912, 8552448, 8486912,
+    8552448, 8552448, 8486912, 8486912, 8421376, 8486912, 8421376, 8421376, 8421376, 8486912, 8486912, 8486912,
+    8421376, 8421376, 8486912, 8486912, 8486912, 8486912, 6914049, 1212416, 229376, 229376, 229376, 294912,
+    229376, 229376, 229376, 229376, 229376, 294912, 294912, 229376, 294912, 294912, 294912, 294912,
+    294912, 229376, 229376, 163840, 294912, 294912, 163840, 163840, 163840, 163840, 163840, 163840,
+    294912, 294912, 229376, 229376, 229376, 294912, 229376, 294912, 294912, 360448, 229376, 294912,
+    229376, 98304, 163840, 163840, 229376, 294912, 294912, 229376, 229376, 229376, 229376, 229376,
+    294912, 229376, 294912, 294912, 163840, 688128, 6914049, 8486912, 8486912, 8486912, 8486912, 8486912,
+    8486912, 8486912, 8421376, 8421376, 8421376, 8486912, 8486912, 8552448, 8486912, 8486912, 8486912, 8486912,
+    8486912, 8486912, 8486912, 8421376, 8421376, 8421376, 8421376, 8421376, 8486912, 8486912, 8486912, 8486912,
+    8421376, 8421376, 8486912, 8421376, 8486912, 7438337, 753664, 294912, 98304, 229376, 229376, 163840,
+    163840, 229376, 32768, 163840, 294912, 229376, 229376, 229376, 229376, 229376, 294912, 294912,
+    229376, 163840, 229376, 229376, 294912, 360448, 163840, 229376, 163840, 163840, 163840, 163840,
+    294912, 294912, 294912, 229376, 229376, 229376, 229376, 229376, 229376, 294912, 229376, 294912,
+    163840, 294912, 163840, 163840, 229376, 229376, 229376, 229376, 229376, 229376, 229376, 294912,
+    229376, 98304, 163840, 229376, 229376, 229376, 1277952, 7503873, 8486912, 8486912, 8486912, 8486912,
+    8486912, 8486912, 8421376, 8421376, 8486912, 8486912, 8486912, 8486912, 8486912, 8486912, 8486912, 8486912,
+    8421376, 8486912, 8421376, 8421376, 8421376, 8486912, 8421376, 8486912, 8552448, 8552448, 8421376, 8421376,
+    8421376, 8486912, 8486912, 8421376, 7438337, 1212416, 294912, 163840, 229376, 294912, 229376, 294912,
+    229376, 229376, 229376, 229376, 163840, 229376, 294912, 229376, 163840, 294912, 294912, 229376,
+    229376, 229376, 229376, 294912, 294912, 294912, 229376, 163840, 229376, 163840, 163840, 163840,
+    229376, 294912, 229376, 229376, 163840, 229376, 163840, 229376, 229376, 229376, 163840, 163840,
+    163840, 163840, 163840, 98304, 229376, 229376, 229376, 229376, 163840, 163840, 229376, 229376,
+    229376, 294912, 98304, 229376, 229376, 229376, 229376, 1212416, 7438337, 8552448, 8486912, 8486912,
+    8486912, 8486912, 8421376, 8421376, 8486912, 8486912, 8486912, 8421376, 8421376, 8421376, 8421376, 8486912,
+    8421376, 8421376, 8421376, 8421376, 8486912, 8421376, 8486912, 8486912, 8552448, 8486912, 8486912, 8486912,
+    8421376, 8421376, 8552448, 7438337, 1212416, 163840, 163840, 294912, 229376, 294912, 229376, 229376,
+    229376, 294912, 163840, 229376, 163840, 360448, 294912, 229376, 294912, 229376, 163840, 229376,
+    229376, 229376, 229376, 229376, 294912, 294912, 229376, 229376, 294912, 229376, 163840, 163840,
+    229376, 294912, 294912, 294912, 229376, 229376, 229376, 229376, 163840, 294912, 163840, 98304,
+    98304, 98304, 163840, 163840, 163840, 229376, 163840, 229376, 229376, 229376, 229376, 229376,
+    360448, 294912, 229376, 229376, 229376, 229376, 294912, 229376, 1146880, 7962625, 8486912, 8486912,
+    8486912, 8486912, 8552448, 8486912, 8486912, 8486912, 8486912, 8421376, 8421376, 8421376, 8421376, 8486912,
+    8486912, 8421376, 8421376, 8421376, 8421376, 8421376, 8486912, 8486912, 8486912, 8486912, 8552448, 8486912,
+    8486912, 8486912, 8028161, 1212416, 294912, 229376, 229376, 229376, 163840, 229376, 163840, 294912,
+    229376, 294912, 229376, 294912, 229376, 294912, 163840, 229376, 163840, 229376, 229376, 229376,
+    294912, 360448, 360448, 360448, 229376, 294912, 229376, 294912, 229376, 229376, 163840, 163840,
+    229376, 294912, 229376, 294912, 163840, 294912, 229376, 163840, 163840, 163840, 229376, 163840,
+    163840, 163840, 98304, 98304, 163840, 229376, 229376, 229376, 229376, 294912, 294912, 360448,
+    229376, 229376, 229376, 229376, 229376, 229376, 163840, 229376, 98304, 2195456, 8486912, 8421376,
+    8421376, 8421376, 8486912, 8486912, 8421376, 8486912, 8421376, 8421376, 8421376, 8421376, 8421376, 8421376,
+    8486912, 8486912, 8421376, 8421376, 8421376, 8486912, 8486912, 8486912, 8552448, 8486912, 8486912, 8486912,
+    8421376, 8486912, 2326528, 360448, 360448, 229376, 229376, 229376, 229376, 98304, 294912, 163840,
+    229376, 360448, 163840, 229376, 294912, 294912, 229376, 229376, 229376, 229376, 229376, 229376,
+    229376, 229376, 163840, 229376, 229376, 229376, 294912, 229376, 229376, 229376, 163840, 163840,
+    229376, 229376, 229376, 229376, 229376, 229376, 229376, 163840, 163840, 163840, 229376, 98304,
+    163840, 98304, 163840, 163840, 163840, 229376, 163840, 229376, 229376, 229376, 294912, 360448,
+    360448, 229376, 294912, 294912, 294912, 163840, 229376, 163840, 163840, 163840, 3768320, 8421376,
+    8421376, 8421376, 8486912, 8421376, 8421376, 8486912, 8486912, 8421376, 8421376, 8421376, 8486912, 8421376,
+    8486912, 8486912, 8486912, 8486912, 8486912, 8421376, 8486912, 8486912, 8486912, 8486912, 8486912, 8486912,
+    8486912, 4292608, 294912, 360448, 294912, 229376, 229376, 229376, 229376, 294912, 163840, 163840,
+    294912, 229376, 229376, 229376, 229376, 294912, 229376, 229376, 229376, 294912, 229376, 229376,
+    229376, 229376, 163840, 229376, 229376, 229376, 294912, 229376, 229376, 294912, 163840, 163840,
+    163840, 360448, 294912, 229376, 229376, 229376, 229376, 425984, 163840, 229376, 163840, 229376,
+    163840, 163840, 163840, 163840, 229376, 163840, 229376, 229376, 360448, 360448, 360448, 294912,
+    294912, 163840, 229376, 229376, 229376, 163840, 32768, 163840, 163840, 98304, 229376, 5865472,
+    8421376, 8421376, 8421376, 8421376, 8421376, 8421376, 8486912, 8486912, 8421376, 8486912, 8421376, 8421376,
+    8421376, 8486912, 8486912, 8552448, 8486912, 8486912, 8486912, 8486912, 8421376, 8421376, 8421376, 8421376,
+    5275648, 98304, 163840, 98304, 294912, 229376, 229376, 229376, 163840, 98304, 163840, 163840,
+    294912, 229376, 229376, 229376, 163840, 163840, 294912, 229376, 229376, 294912, 229376, 163840,
+    294912, 163840, 163840, 294912, 294912, 294912, 229376, 163840, 229376, 229376, 98304, 360448,
+    229376, 229376, 229376, 229376, 229376, 294912, 229376, 229376, 229376, 294912, 163840, 163840,
+    163840, 229376, 32768, 229376, 229376, 163840, 294912, 294912, 360448, 360448, 360448, 294912,
+    229376, 294912, 294912, 229376, 229376, 294912, 163840, 229376, 98304, 163840, 229376, 557056,
+    7372801, 8421376, 8421376, 8421376, 8421376, 8486912, 8552448, 8486912, 8486912, 8486912, 8421376, 8421376,
+    8486912, 8486912, 8486912, 8486912, 8486912, 8486912, 8421376, 8421376, 8421376, 8421376, 8421376, 7438337,
+    1212416, 163840, 98304, 229376, 229376, 294912, 360448, 229376, 98304, 229376, 294912, 229376,
+    163840, 294912, 229376, 229376, 229376, 229376, 229376, 229376, 229376, 163840, 229376, 294912,
+    229376, 294912, 163840, 229376, 229376, 294912, 229376, 98304, 229376, 163840, 163840, 229376,
+    98304, 163840, 98304, 294912, 229376, 294912, 163840, 229376, 229376, 229376, 229376, 98304,
+    229376, 229376, 163840, 229376, 229376, 229376, 294912, 229376, 294912, 294912, 163840, 229376,
+    294912, 294912, 229376, 229376, 229376, 163840, 294912, 294912, 229376, 229376, 229376, 163840,
+    2129920, 8421376, 8421376, 8421376, 8486912, 8486912, 8421376, 8486912, 8486912, 8486912, 8421376, 8421376,
+    8486912, 8486912, 8421376, 8486912, 8486912, 8421376, 8486912, 8421376, 8421376, 8486912, 8486912, 1736704,
+    294912, 294912, 229376, 294912, 294912, 229376, 229376, 294912, 229376, 229376, 229376, 229376,
+    163840, 294912, 360448, 294912, 163840, 229376, 163840, 229376, 229376, 229376, 229376, 229376,
+    229376, 294912, 163840, 294912, 229376, 163840, 163840, 229376, 163840, 229376, 294912, 163840,
+    98304, 98304, 163840, 98304, 163840, 229376, 229376, 294912, 229376, 229376, 163840, 163840,
+    163840, 163840, 163840, 163840, 294912, 229376, 229376, 229376, 163840, 163840, 294912, 294912,
+    229376, 229376, 229376, 229376, 229376, 163840, 229376, 229376, 229376, 229376, 229376, 229376,
+    163840, 4816896, 8421376, 8421376, 8486912, 8552448, 8421376, 8486912, 8486912, 8486912, 8421376, 8421376,
+    8486912, 8486912, 8486912, 8486912, 8421376, 8421376, 8421376, 8421376, 8421376, 8486912, 4358144, 163840,
+    294912, 294912, 229376, 163840, 229376, 294912, 229376, 294912, 294912, 294912, 294912, 294912,
+    163840, 294912, 98304, 294912, 294912, 229376, 229376, 229376, 229376, 229376, 229376, 229376,
+    229376, 294912, 294912, 163840, 163840, 229376, 229376, 163840, 229376, 163840, 98304, 163840,
+    163840, 229376, 98304, 229376, 163840, 229376, 229376, 229376, 163840, 229376, 163840, 294912,
+    163840, 229376, 163840, 163840, 294912, 163840, 229376, 229376, 294912, 294912, 229376, 163840,
+    360448, 163840, 98304, 229376, 229376, 229376, 163840, 229376, 229376, 229376, 229376, 294912,
+    98304, 622592, 7438337, 8421376, 8552448, 8486912, 8486912, 8552448, 8486912, 8486912, 8421376, 8486912,
+    8486912, 8486912, 8486912, 8486912, 8486912, 8421376, 8421376, 8421376, 8486912, 7503873, 294912, 229376,
+    360448, 294912, 229376, 229376, 229376, 360448, 294912, 163840, 229376, 360448, 229376, 229376,
+    229376, 229376, 163840, 229376, 229376, 229376, 163840, 294912, 294912, 229376, 229376, 229376,
+    229376, 229376, 163840, 163840, 163840, 229376, 229376, 294912, 360448, 229376, 229376, 294912,
+    163840, 294912, 163840, 360448, 163840, 229376, 229376, 229376, 163840, 229376, 229376, 294912,
+    229376, 294912, 229376, 163840, 294912, 229376, 229376, 229376, 294912, 294912, 294912, 229376,
+    294912, 294912, 163840, 163840, 163840, 294912, 229376, 229376, 229376, 229376, 294912, 229376,
+    163840, 163840, 2260992, 8486912, 8486912, 8552448, 8486912, 8552448, 8486912, 8552448, 8421376, 8486912,
+    8486912, 8486912, 8486912, 8486912, 8486912, 8486912, 8421376, 8486912, 8486912, 2785280, 163840, 163840,
+    163840, 163840, 294912, 294912, 163840, 294912, 98304, 229376, 163840, 229376, 163840, 163840,
+    294912, 163840, 98304, 163840, 163840, 294912, 229376, 229376, 229376, 229376, 229376, 229376,
+    163840, 229376, 163840, 229376, 163840, 163840, 163840, 229376, 294912, 229376, 294912, 98304,
+    229376, 360448, 229376, 229376, 229376, 229376, 229376, 229376, 294912, 294912, 98304, 229376,
+    163840, 98304, 229376, 294912, 360448, 294912, 294912, 229376, 229376, 294912, 229376, 229376,
+    229376, 163840, 229376, 229376, 229376, 294912, 163840, 163840, 229376, 229376, 32768, 163840,
+    98304, 163840, 98304, 5865472, 8421376, 8421376, 8421376, 8421376, 8486912, 8552448, 8421376, 8486912,
+    8486912, 8486912, 8486912, 8486912, 8486912, 8486912, 8421376, 8486912, 5406720, 294912, 229376, 229376,
+    229376, 360448, 294912, 294912, 229376, 229376, 294912, 229376, 229376, 294912, 229376, 229376,
+    163840, 229376, 229376, 229376, 229376, 229376, 229376, 294912, 294912, 294912, 163840, 163840,
+    163840, 98304, 229376, 294912, 229376, 229376, 294912, 294912, 229376, 163840, 163840, 163840,
+    229376, 360448, 229376, 229376, 163840, 163840, 229376, 294912, 294912, 294912, 163840, 163840,
+    98304, 163840, 294912, 229376, 294912, 360448, 294912, 163840, 229376, 294912, 229376, 294912,
+    229376, 163840, 229376, 360448, 294912, 294912, 163840, 163840, 229376, 229376, 294912, 229376,
+    163840, 163840, 163840, 1146880, 7897089, 8421376, 8421376, 8421376, 8421376, 8486912, 8486912, 8486912,
+    8552448, 8552448, 8486912, 8486912, 8486912, 8486912, 8486912, 8486912, 1146880, 229376, 229376, 229376,
+    98304, 294912, 163840, 229376, 229376, 360448, 229376, 229376, 163840, 294912, 229376, 360448,
+    229376, 163840, 229376, 229376, 229376, 294912, 229376, 229376, 294912, 294912, 294912, 163840,
+    98304, 98304, 229376, 229376, 229376, 229376, 229376, 229376, 229376, 229376, 163840, 163840,
+    163840, 294912, 294912, 294912, 163840, 229376, 294912, 294912, 229376, 360448, 229376, 229376,
+    294912, 294912, 229376, 163840, 229376, 163840, 163840, 294912, 163840, 229376, 163840, 163840,
+    98304, 229376, 229376, 229376, 163840, 229376, 229376, 229376, 294912, 229376, 229376, 294912,
+    229376, 229376, 229376, 229376, 4292608, 8421376, 8421376, 8421376, 8421376, 8421376, 8486912, 8552448,
+    8486912, 8486912, 8486912, 8486912, 8552448, 8486912, 8486912, 5406720, 294912, 294912, 294912, 229376,
+    229376, 360448, 229376, 229376, 163840, 229376, 163840, 229376, 163840, 229376, 98304, 163840,
+    163840, 163840, 229376, 229376, 163840, 229376, 360448, 229376, 229376, 229376, 229376, 229376,
+    229376, 229376, 229376, 229376, 229376, 229376, 229376, 229376, 294912, 229376, 294912, 294912,
+    229376, 229376, 229376, 229376, 229376, 229376, 294912, 229376, 294912, 294912, 163840, 294912,
+    229376, 294912, 163840, 294912, 163840, 163840, 32768, 163840, 163840, 229376, 163840, 294912,
+    163840, 163840, 229376, 229376, 163840, 294912, 229376, 229376, 229376, 229376, 360448, 294912,
+    229376, 294912, 294912, 294912, 622592, 7962625, 8421376, 8421376, 8552448, 8486912, 8421376, 8486912,
+    8552448, 8486912, 8486912, 8486912, 8486912, 8486912, 7438337, 1277952, 229376, 229376, 360448, 294912,
+    294912, 229376, 229376, 229376, 163840, 229376, 229376, 294912, 163840, 163840, 360448, 229376,
+    294912, 360448, 229376, 229376, 229376, 229376, 229376, 163840, 229376, 229376, 229376, 229376,
+    294912, 229376, 229376, 229376, 229376, 229376, 229376, 229376, 163840, 229376, 294912, 294912,
+    229376, 229376, 229376, 294912, 163840, 229376, 229376, 294912, 229376, 163840, 229376, 229376,
+    163840, 229376, 98304, 163840, 163840, 163840, 32768, 229376, 229376, 229376, 32768, 163840,
+    163840, 163840, 163840, 163840, 98304, 163840, 163840, 229376, 229376, 294912, 294912, 294912,
+    294912, 294912, 229376, 229376, 163840, 4292608, 8486912, 8486912, 8486912, 8486912, 8421376, 8486912,
+    8486912, 8486912, 8421376, 8486912, 8486912, 8486912, 4292608, 229376, 360448, 360448, 294912, 229376,
+    294912, 229376, 163840, 163840, 229376, 229376, 163840, 360448, 229376, 229376, 229376, 163840,
+    229376, 229376, 229376, 294912, 229376, 229376, 229376, 229376, 294912, 294912, 229376, 229376,
+    294912, 229376, 229376, 229376, 294912, 294912, 229376, 229376, 294912, 229376, 98304, 163840,
+    229376, 229376, 229376, 294912, 229376, 229376, 229376, 229376, 229376, 360448, 163840, 163840,
+    163840, 98304, 98304, 98304, 229376, 98304, 98304, 163840, 163840, 229376, 229376, 98304,
+    229376, 229376, 294912, 163840, 98304, 163840, 163840, 229376, 229376, 294912, 294912, 294912,
+    360448, 294912, 229376, 294912, 163840, 688128, 7962625, 8486912, 8486912, 8486912, 8421376, 8486912,
+    8486912, 8486912, 8421376, 8421376, 8486912, 8486912, 1277952, 163840, 294912, 360448, 294912, 229376,
+    229376, 229376, 229376, 163840, 163840, 229376, 294912, 294912, 229376, 360448, 98304, 229376,
+    294912, 229376, 294912, 229376, 229376, 229376, 229376, 294912, 294912, 294912, 294912, 229376,
+    294912, 163840, 229376, 229376, 229376, 294912, 163840, 229376, 229376, 294912, 163840, 163840,
+    229376, 229376, 229376, 163840, 294912, 229376, 229376, 229376, 294912, 163840, 163840, 98304,
+    163840, 163840, 163840, 163840, 163840, 294912, 163840, 98304, 98304, 229376, 229376, 163840,
+    163840, 229376, 229376, 294912, 163840, 163840, 163840, 163840, 229376, 229376, 294912, 294912,
+    294912, 294912, 229376, 229376, 163840, 163840, 4358144, 8486912, 8421376, 8486912, 8421376, 8486912,
+    8486912, 8421376, 8486912, 8421376, 8486912, 5406720, 294912, 294912, 229376, 294912, 229376, 229376,
+    294912, 294912, 294912, 229376, 163840, 229376, 163840, 98304, 98304, 229376, 98304, 163840,
+    294912, 163840, 163840, 294912, 229376, 294912, 229376, 294912, 294912, 229376, 294912, 294912,
+    229376, 229376, 229376, 229376, 229376, 360448, 229376, 229376, 229376, 229376, 98304, 163840,
+    294912, 229376, 229376, 229376, 163840, 229376, 229376, 294912, 425984, 229376, 229376, 229376,
+    32768, 163840, 229376, 32768, 163840, 294912, 163840, 98304, 229376, 360448, 294912, 163840,
+    229376, 163840, 32768, 163840, 229376, 163840, 98304, 163840, 229376, 229376, 294912, 294912,
+    294912, 294912, 229376, 163840, 163840, 163840, 1212416, 8486912, 8486912, 8486912, 8486912, 8486912,
+    8486912, 8486912, 8486912, 8486912, 8486912, 1212416, 229376, 294912, 294912, 294912, 360448, 229376,
+    229376, 360448, 229376, 229376, 229376, 98304, 98304, 163840, 294912, 163840, 163840, 98304,
+    98304, 294912, 163840, 294912, 294912, 229376, 229376, 229376, 294912, 229376, 294912, 294912,
+    294912, 229376, 294912, 229376, 229376, 294912, 229376, 229376, 229376, 229376, 163840, 163840,
+    229376, 229376, 163840, 229376, 229376, 163840, 98304, 229376, 229376, 229376, 229376, 229376,
+    98304, 98304, 229376, 163840, 163840, 163840, 98304, 163840, 229376, 229376, 163840, 163840,
+    229376, 229376, 98304, 98304, 229376, 163840, 32768, 163840, 163840, 229376, 229376, 229376,
+    229376, 229376, 229376, 229376, 229376, 229376, 163840, 6389761, 8421376, 8421376, 8486912, 8486912,
+    8486912, 8486912, 8421376, 8486912, 5865472, 294912, 229376, 294912, 294912, 294912, 294912, 294912,
+    360448, 360448, 294912, 294912, 98304, 229376, 163840, 229376, 163840, 163840, 98304, 229376,
+    163840, 229376, 229376, 163840, 229376, 229376, 294912, 294912, 163840, 229376, 294912, 229376,
+    229376, 229376, 229376, 229376, 229376, 294912, 229376, 229376, 229376, 229376, 98304, 163840,
+    229376, 229376, 294912, 229376, 229376, 229376, 229376, 229376, 229376, 229376, 294912, 294912,
+    163840, 163840, 163840, 229376, 98304, 163840, 163840, 229376, 294912, 229376, 229376, 229376,
+    229376, 229376, 163840, 163840, 98304, 163840, 98304, 163840, 229376, 163840, 163840, 229376,
+    229376, 229376, 229376, 229376, 294912, 294912, 163840, 2129920, 8421376, 8421376, 8486912, 8486912,
+    8486912, 8552448, 8421376, 8486912, 2719744, 229376, 229376, 163840, 163840, 294912, 360448, 98304,
+    229376, 229376, 229376, 229376, 360448, 294912, 98304, 163840, 32768, 98304, 163840, 229376,
+    163840, 294912, 32768, 163840, 229376, 294912, 229376, 229376, 229376, 163840, 229376, 229376,
+    229376, 229376, 229376, 229376, 229376, 229376, 229376, 229376, 229376, 229376, 229376, 229376,
+    229376, 229376, 163840, 163840, 163840, 294912, 360448, 229376, 163840, 163840, 229376, 229376,
+    163840, 98304, 163840, 229376, 98304, 163840, 163840, 163840, 163840, 163840, 163840, 229376,
+    163840, 229376, 163840, 163840, 163840, 163840, 163840, 163840, 294912, 229376, 294912, 294912,
+    294912, 294912, 229376, 229376, 163840, 360448, 229376, 229376, 7962625, 8486912, 8486912, 8486912,
+    8486912, 8552448, 8486912, 7438337, 294912, 229376, 229376, 229376, 229376, 294912, 229376, 229376,
+    229376, 229376, 229376, 229376, 360448, 294912, 98304, 98304, 163840, 163840, 98304, 163840,
+    98304, 163840, 229376, 229376, 163840, 163840, 229376, 163840, 229376, 294912, 229376, 229376,
+    229376, 163840, 163840, 229376, 163840, 163840, 163840, 98304, 229376, 163840, 163840, 163840,
+    229376, 360448, 163840, 294912, 294912, 360448, 360448, 294912, 229376, 294912, 229376, 229376,
+    163840, 163840, 163840, 229376, 32768, 229376, 229376, 98304, 98304, 163840, 294912, 163840,
+    229376, 163840, 98304, 163840, 229376, 98304, 98304, 98304, 229376, 229376, 229376, 294912,
+    294912, 294912, 229376, 360448, 229376, 229376, 229376, 163840, 4882432, 8486912, 8486912, 8486912,
+    8486912, 8486912, 8486912, 5406720, 294912, 294912, 229376, 229376, 360448, 294912, 294912, 229376,
+    229376, 229376, 229376, 163840, 294912, 294912, 163840, 163840, 163840, 294912, 163840, 229376,
+    163840, 98304, 229376, 360448, 294912, 294912, 163840, 163840, 229376, 294912, 294912, 229376,
+    294912, 294912, 163840, 360448, 163840, 229376, 229376, 229376, 163840, 163840, 163840, 163840,
+    294912, 294912, 229376, 294912, 229376, 229376, 294912, 294912, 294912, 294912, 229376, 229376,
+    163840, 229376, 98304, 163840, 98304, 163840, 163840, 163840, 229376, 163840, 163840, 294912,
+    229376, 163840, 32768, 163840, 163840, 163840, 163840, 163840, 98304, 229376, 294912, 294912,
+    163840, 163840, 229376, 163840, 229376, 229376, 229376, 229376, 2260992, 8486912, 8486912, 8486912,
+    8421376, 8486912, 8421376, 2260992, 163840, 294912, 163840, 229376, 294912, 229376, 294912, 294912,
+    294912, 294912, 229376, 163840, 163840, 229376, 98304, 98304, 98304, 163840, 163840, 163840,
+    163840, 229376, 163840, 229376, 163840, 163840, 98304, 163840, 360448, 98304, 98304, 32768,
+    98304, 98304, 98304, 163840, 32768, 163840, 98304, 98304, 229376, 294912, 163840, 163840,
+    229376, 229376, 229376, 229376, 163840, 294912, 294912, 294912, 294912, 294912, 229376, 360448,
+    229376, 294912, 163840, 229376, 229376, 163840, 32768, 98304, 294912, 229376, 32768, 163840,
+    229376, 98304, 163840, 163840, 163840, 229376, 163840, 163840, 163840, 98304, 163840, 294912,
+    98304, 229376, 163840, 229376, 229376, 163840, 229376, 229376, 163840, 7962625, 8421376, 8486912,
+    8486912, 8486912, 7438337, 163840, 229376, 229376, 229376, 229376, 294912, 294912, 360448, 294912,
+    294912, 294912, 98304, 98304, 229376, 163840, 163840, 163840, 98304, 163840, 98304, 32768,
+    32768, 229376, 163840, 163840, 98304, 163840, 163840, 163840, 163840, 229376, 98304, 98304,
+    163840, 229376, 32768, 163840, 98304, 98304, 163840, 229376, 229376, 163840, 229376, 163840,
+    294912, 294912, 229376, 229376, 229376, 229376, 229376, 229376, 163840, 229376, 229376, 229376,
+    294912, 229376, 229376, 229376, 229376, 163840, 163840, 360448, 163840, 229376, 163840, 163840,
+    163840, 229376, 163840, 163840, 163840, 98304, 229376, 294912, 229376, 163840, 32768, 163840,
+    163840, 229376, 229376, 229376, 229376, 294912, 229376, 229376, 163840, 5406720, 8486912, 8486912,
+    8486912, 8486912, 5275648, 163840, 229376, 360448, 294912, 163840, 294912, 294912, 229376, 294912,
+    360448, 163840, 163840, 163840, 229376, 229376, 360448, 294912, 98304, 294912, 163840, 163840,
+    229376, 294912, 360448, 229376, 163840, 360448, 163840, 163840, 98304, 163840, 163840, 163840,
+    163840, 163840, 163840, 163840, 163840, 229376, 163840, 229376, 163840, 163840, 163840, 229376,
+    229376, 294912, 163840, 229376, 163840, 229376, 163840, 163840, 229376, 163840, 229376, 294912,
+    163840, 294912, 294912, 229376, 229376, 32768, 98304, 229376, 163840, 98304, 32768, 163840,
+    163840, 163840, 163840, 163840, 98304, 229376, 229376, 229376, 229376, 163840, 163840, 98304,
+    229376, 229376, 229376, 163840, 229376, 294912, 229376, 229376, 229376, 3244032, 8486912, 8486912,
+    8486912, 8486912, 2785280, 229376, 294912, 294912, 229376, 163840, 229376, 294912, 294912, 294912,
+    229376, 229376, 294912, 294912, 163840, 163840, 294912, 229376, 98304, 229376, 163840, 163840,
+    229376, 163840, 229376, 229376, 98304, 163840, 98304, 163840, 163840, 163840, 98304, 163840,
+    163840, 98304, 163840, 163840, 163840, 163840, 98304, 98304, 163840, 163840, 98304, 163840,
+    163840, 229376, 229376, 163840, 163840, 294912, 229376, 229376, 229376, 229376, 294912, 229376,
+    294912, 229376, 229376, 229376, 294912, 229376, 229376, 163840, 229376, 98304, 163840, 229376,
+    163840, 163840, 229376, 229376, 229376, 229376, 229376, 229376, 229376, 294912, 229376, 229376,
+    229376, 229376, 294912, 294912, 229376, 229376, 229376, 163840, 163840, 622592, 8421376, 8486912,
+    8486912, 8486912, 1146880, 294912, 294912, 294912, 229376, 294912, 163840, 294912, 229376, 163840,
+    229376, 229376, 229376, 229376, 163840, 163840, 163840, 163840, 98304, 163840, 229376, 98304,
+    98304, 98304, 32768, 98304, 163840, 163840, 229376, 163840, 163840, 98304, 163840, 229376,
+    229376, 229376, 229376, 229376, 163840, 98304, 163840, 294912, 98304, 163840, 32768, 163840,
+    229376, 229376, 229376, 229376, 163840, 229376, 229376, 294912, 163840, 229376, 294912, 229376,
+    229376, 360448, 163840, 229376, 163840, 229376, 32768, 163840, 98304, 163840, 229376, 163840,
+    163840, 163840, 163840, 229376, 163840, 229376, 294912, 163840, 98304, 229376, 294912, 294912,
+    163840, 229376, 294912, 294912, 229376, 294912, 229376, 229376, 163840, 229376, 3768320, 7372801,
+    7962625, 3833856, 229376, 294912, 294912, 229376, 163840, 98304, 229376, 229376, 163840, 294912,
+    229376, 163840, 294912, 229376, 229376, 163840, 163840, 163840, 163840, 163840, 98304, 229376,
+    229376, 98304, 163840, 163840, 98304, 163840, 229376, 294912, 98304, 98304, 163840, 229376,
+    229376, 229376, 229376, 229376, 98304, 98304, 294912, 229376, 98304, 163840, 163840, 163840,
+};
+
+} // namespace embedded
+} // namespace gwt
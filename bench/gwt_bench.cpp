@@ -0,0 +1,657 @@
+/**
+ * @file    gwt_bench.cpp
+ * @brief   Gemini Watermark Tool - Benchmark Suite
+ * @author  AllenK (Kwyshell)
+ * @date    2026.10.18
+ * @license MIT
+ *
+ * @details
+ * Self-contained benchmarks for the engine, with no dependency beyond what
+ * the tool already links:
+ *
+ *   engine/         WatermarkEngine construction from the embedded assets
+ *   alpha_map/      calculate_alpha_map() for both capture sizes
+ *   blend/          every available row kernel, remove and add, 48 and 96
+ *   locate/         watermark confidence at the expected position, the
+ *                   --search neighbourhood match and the --search-scale
+ *                   size pyramid, for both logo sizes
+ *   encode/         encode_image_as() per encoder profile (--profile),
+ *                   JPEG/PNG/WebP at each corpus size
+ *   process_image/  end-to-end file processing, JPEG/PNG/WebP at
+ *                   1024^2, 2048^2 and 4096^2
+ *   io/             reading and committing copies of the corpus with the
+ *                   POSIX and io_uring backends (FileLoader, OutputWriter);
+ *                   run with --io-dir on a local SSD and on tmpfs
+ *                   (/dev/shm) to compare both
+ *
+ * Results print as a table, or as JSON in Google Benchmark's layout
+ * (--json) so existing comparison tooling can track them over time.
+ *
+ * The corpus is synthesized: a smooth gradient with fine texture,
+ * watermarked with add_watermark(). --generate writes it to a directory
+ * for use elsewhere; otherwise it is built in a temporary directory.
+ *
+ * Usage:
+ *   gwt_bench                                  (all benchmarks, table)
+ *   gwt_bench --filter blend --json out.json
+ *   gwt_bench --generate corpus_dir --sizes 1024,2048
+ *   gwt_bench --filter io/ --io-dir /mnt/ssd/gwt_io
+ *
+ * @see https://github.com/allenk/GeminiWatermarkTool
+ */
+
+#include "watermark_engine.hpp"
+#include "file_loader.hpp"
+#include "output_writer.hpp"
+#include "blend_modes.hpp"
+#include "blend_kernels.hpp"
+#include "embedded_assets.hpp"
+
+#include <CLI/CLI.hpp>
+#include <spdlog/spdlog.h>
+#include <fmt/core.h>
+#include <opencv2/core.hpp>
+#include <opencv2/imgcodecs.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <ctime>
+#include <filesystem>
+#include <functional>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+namespace fs = std::filesystem;
+
+namespace {
+
+// =============================================================================
+// Runner
+// =============================================================================
+
+struct BenchResult {
+    std::string name;
+    size_t iterations = 0;
+    double mean_ns = 0;
+    double median_ns = 0;
+    double min_ns = 0;
+    double stddev_ns = 0;
+    double cpu_ns = 0;             // Process CPU time (all threads) per call, mean
+    double items_per_second = 0;   // Calls per second at the median time
+};
+
+// CPU time used by the whole process so far, so benchmarks that run
+// worker threads (io/, process_image/) count their work too
+double process_cpu_ns() {
+#ifdef _WIN32
+    FILETIME creation, exit, kernel, user;
+    GetProcessTimes(GetCurrentProcess(), &creation, &exit, &kernel, &user);
+    auto ticks = [](const FILETIME& t) {
+        return (uint64_t(t.dwHighDateTime) << 32) | t.dwLowDateTime;
+    };
+    return static_cast<double>(ticks(kernel) + ticks(user)) * 100.0;   // 100 ns units
+#else
+    timespec ts{};
+    clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &ts);
+    return static_cast<double>(ts.tv_sec) * 1e9 + static_cast<double>(ts.tv_nsec);
+#endif
+}
+
+class BenchRunner {
+public:
+    BenchRunner(std::string filter, double min_time)
+        : filter_(std::move(filter)), min_time_(min_time) {}
+
+    bool selected(const std::string& name) const {
+        return filter_.empty() || name.find(filter_) != std::string::npos;
+    }
+
+    /**
+     * Time fn until min_time has elapsed (at least kMinIterations samples)
+     */
+    void run(const std::string& name, const std::function<void()>& fn) {
+        if (!selected(name)) {
+            return;
+        }
+
+        using clock = std::chrono::steady_clock;
+        fn();  // Warm-up: page in code, fill caches, let the CPU clock up
+
+        // Batch very fast calls so clock overhead stays negligible
+        size_t batch = 1;
+        for (;;) {
+            const auto start = clock::now();
+            for (size_t i = 0; i < batch; ++i) fn();
+            const double ns = std::chrono::duration<double, std::nano>(clock::now() - start).count();
+            if (ns >= 1e5 || batch >= (size_t(1) << 20)) break;
+            batch *= 10;
+        }
+
+        std::vector<double> samples;
+        double total_ns = 0;
+        const double cpu_start = process_cpu_ns();
+        while (samples.size() < kMinIterations || total_ns < min_time_ * 1e9) {
+            const auto start = clock::now();
+            for (size_t i = 0; i < batch; ++i) fn();
+            const double ns = std::chrono::duration<double, std::nano>(clock::now() - start).count();
+            samples.push_back(ns / static_cast<double>(batch));
+            total_ns += ns;
+        }
+
+        BenchResult r;
+        r.name = name;
+        r.iterations = samples.size() * batch;
+        r.cpu_ns = (process_cpu_ns() - cpu_start) / static_cast<double>(r.iterations);
+
+        double sum = 0;
+        for (double s : samples) sum += s;
+        r.mean_ns = sum / static_cast<double>(samples.size());
+
+        double var = 0;
+        for (double s : samples) var += (s - r.mean_ns) * (s - r.mean_ns);
+        r.stddev_ns = std::sqrt(var / static_cast<double>(samples.size()));
+
+        std::sort(samples.begin(), samples.end());
+        r.min_ns = samples.front();
+        r.median_ns = samples[samples.size() / 2];
+        r.items_per_second = 1e9 / r.median_ns;
+
+        fmt::print(stderr, "  {:<44} {:>12} {:>10}\n", name, format_time(r.median_ns),
+                   fmt::format("{:.1f}/s", r.items_per_second));
+        results_.push_back(std::move(r));
+    }
+
+    const std::vector<BenchResult>& results() const { return results_; }
+
+private:
+    static constexpr size_t kMinIterations = 5;
+
+    static std::string format_time(double ns) {
+        if (ns < 1e3) return fmt::format("{:.1f} ns", ns);
+        if (ns < 1e6) return fmt::format("{:.2f} us", ns / 1e3);
+        if (ns < 1e9) return fmt::format("{:.2f} ms", ns / 1e6);
+        return fmt::format("{:.3f} s", ns / 1e9);
+    }
+
+    std::string filter_;
+    double min_time_;
+    std::vector<BenchResult> results_;
+};
+
+std::string json_escape(const std::string& s) {
+    std::string out;
+    for (char c : s) {
+        if (c == '"' || c == '\\') out += '\\';
+        out += c;
+    }
+    return out;
+}
+
+// Google Benchmark's JSON layout (context + benchmarks[]), with the fields
+// its compare.py reads; every benchmark is a single repetition on one
+// calling thread, and cpu_time is process-wide (see process_cpu_ns())
+std::string to_json(const std::vector<BenchResult>& results) {
+    char date[32] = {};
+    const std::time_t now = std::time(nullptr);
+    std::strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%S", std::localtime(&now));
+
+    std::string out = "{\n  \"context\": {\n";
+    out += fmt::format("    \"date\": \"{}\",\n", date);
+    out += fmt::format("    \"executable\": \"gwt_bench\",\n");
+    out += fmt::format("    \"version\": \"{}\",\n", APP_VERSION);
+    out += fmt::format("    \"num_cpus\": {},\n", std::thread::hardware_concurrency());
+    out += fmt::format("    \"blend_kernel\": \"{}\",\n", gwt::blend_kernel_name(gwt::best_blend_kernel()));
+    out += fmt::format("    \"opencv\": \"{}\"\n", CV_VERSION);
+    out += "  },\n  \"benchmarks\": [\n";
+    for (size_t i = 0; i < results.size(); ++i) {
+        const auto& r = results[i];
+        out += "    {\n";
+        out += fmt::format("      \"name\": \"{}\",\n", json_escape(r.name));
+        out += fmt::format("      \"family_index\": {},\n", i);
+        out += fmt::format("      \"per_family_instance_index\": 0,\n");
+        out += fmt::format("      \"run_name\": \"{}\",\n", json_escape(r.name));
+        out += fmt::format("      \"run_type\": \"iteration\",\n");
+        out += fmt::format("      \"repetitions\": 1,\n");
+        out += fmt::format("      \"repetition_index\": 0,\n");
+        out += fmt::format("      \"threads\": 1,\n");
+        out += fmt::format("      \"iterations\": {},\n", r.iterations);
+        out += fmt::format("      \"real_time\": {:.3f},\n", r.median_ns);
+        out += fmt::format("      \"cpu_time\": {:.3f},\n", r.cpu_ns);
+        out += fmt::format("      \"mean_time\": {:.3f},\n", r.mean_ns);
+        out += fmt::format("      \"min_time\": {:.3f},\n", r.min_ns);
+        out += fmt::format("      \"stddev_time\": {:.3f},\n", r.stddev_ns);
+        out += fmt::format("      \"time_unit\": \"ns\",\n");
+        out += fmt::format("      \"items_per_second\": {:.3f}\n", r.items_per_second);
+        out += (i + 1 < results.size()) ? "    },\n" : "    }\n";
+    }
+    out += "  ]\n}\n";
+    return out;
+}
+
+// =============================================================================
+// Synthetic corpus
+// =============================================================================
+
+const char* const kCorpusFormats[] = {".jpg", ".png", ".webp"};
+
+/**
+ * A watermarked test image: diagonal gradient plus fine deterministic
+ * texture, so encoders see something closer to a photo than flat color
+ */
+cv::Mat make_corpus_image(const gwt::WatermarkEngine& engine, int size, unsigned seed) {
+    cv::Mat image(size, size, CV_8UC3);
+    uint32_t state = seed;
+    auto grain = [&state] {
+        state = state * 1664525u + 1013904223u;  // LCG: same corpus on every platform
+        return static_cast<int>(state >> 27);    // 0..31
+    };
+
+    for (int y = 0; y < size; ++y) {
+        auto* row = image.ptr<cv::Vec3b>(y);
+        for (int x = 0; x < size; ++x) {
+            const int t = (x + y) * 200 / (2 * size);
+            row[x][0] = cv::saturate_cast<uchar>(30 + t + grain());
+            row[x][1] = cv::saturate_cast<uchar>(60 + t / 2 + grain());
+            row[x][2] = cv::saturate_cast<uchar>(200 - t + grain());
+        }
+    }
+
+    engine.add_watermark(image);
+    return image;
+}
+
+fs::path corpus_file(const fs::path& dir, int size, const std::string& ext) {
+    return dir / fmt::format("corpus_{}{}", size, ext);
+}
+
+/**
+ * Write the corpus; formats the OpenCV build cannot encode are skipped
+ *
+ * @return  Number of files written
+ */
+size_t generate_corpus(const gwt::WatermarkEngine& engine, const fs::path& dir,
+                       const std::vector<int>& sizes) {
+    fs::create_directories(dir);
+    size_t written = 0;
+    for (int size : sizes) {
+        const cv::Mat image = make_corpus_image(engine, size, static_cast<unsigned>(size));
+        for (const char* ext : kCorpusFormats) {
+            std::vector<unsigned char> buffer;
+            const fs::path path = corpus_file(dir, size, ext);
+            if (!gwt::encode_image(path, image, buffer) || !gwt::write_file(path, buffer)) {
+                spdlog::warn("Skipping {}: encoder unavailable", path.filename().string());
+                continue;
+            }
+            ++written;
+        }
+    }
+    return written;
+}
+
+// =============================================================================
+// Benchmarks
+// =============================================================================
+
+gwt::WatermarkEngine make_engine() {
+    return gwt::WatermarkEngine();
+}
+
+cv::Mat decode_capture(const unsigned char* data, size_t size) {
+    return cv::imdecode(cv::Mat(1, static_cast<int>(size), CV_8UC1, const_cast<unsigned char*>(data)),
+                        cv::IMREAD_COLOR);
+}
+
+void bench_engine(BenchRunner& runner) {
+    runner.run("engine/construct_embedded", [] {
+        auto engine = make_engine();
+        (void)engine;
+    });
+    // Startup cost the built-in maps replace: decode the captures at runtime
+    runner.run("engine/construct_png", [] {
+        gwt::WatermarkEngine engine(
+            gwt::embedded::bg_48_png, gwt::embedded::bg_48_png_size,
+            gwt::embedded::bg_96_png, gwt::embedded::bg_96_png_size
+        );
+        (void)engine;
+    });
+}
+
+void bench_alpha_maps(BenchRunner& runner, const cv::Mat& capture_48, const cv::Mat& capture_96) {
+    runner.run("alpha_map/48", [&] { (void)gwt::calculate_alpha_map(capture_48); });
+    runner.run("alpha_map/96", [&] { (void)gwt::calculate_alpha_map(capture_96); });
+}
+
+void bench_blend(BenchRunner& runner, const cv::Mat& capture_48, const cv::Mat& capture_96) {
+    const struct { int size; cv::Mat alpha; } maps[] = {
+        {48, gwt::calculate_alpha_map(capture_48)},
+        {96, gwt::calculate_alpha_map(capture_96)},
+    };
+    const struct { const char* name; gwt::BlendDirection direction; } directions[] = {
+        {"remove", gwt::BlendDirection::Remove},
+        {"add", gwt::BlendDirection::Add},
+    };
+    const gwt::BlendKernel kernels[] = {
+        gwt::BlendKernel::Scalar, gwt::BlendKernel::SSE41, gwt::BlendKernel::AVX2,
+        gwt::BlendKernel::AVX512, gwt::BlendKernel::NEON,
+    };
+
+    for (const auto& map : maps) {
+        // Kernel timing does not depend on pixel values
+        cv::Mat region(map.size, map.size, CV_8UC3, cv::Scalar(128, 96, 200));
+
+        for (const auto& dir : directions) {
+            const gwt::BlendTable table = gwt::make_blend_table(map.alpha, dir.direction);
+            const size_t row_samples = table.row_samples();
+
+            for (gwt::BlendKernel kernel : kernels) {
+                const gwt::BlendRowFn fn = gwt::get_blend_kernel(kernel);
+                if (!fn) {
+                    continue;
+                }
+                runner.run(fmt::format("blend/{}/{}/{}", dir.name, map.size, gwt::blend_kernel_name(kernel)),
+                           [&] {
+                               for (int y = 0; y < table.height; ++y) {
+                                   fn(region.ptr<uint8_t>(y), table.scale_row(y), table.offset_row(y), row_samples);
+                               }
+                           });
+            }
+
+            // Full entry point: table lookup, clipping and dispatch included
+            runner.run(fmt::format("blend/{}/{}/apply_blend_table", dir.name, map.size), [&] {
+                gwt::apply_blend_table(region, table, cv::Point(0, 0));
+            });
+        }
+    }
+}
+
+void bench_locate(BenchRunner& runner, const gwt::WatermarkEngine& engine) {
+    gwt::WatermarkEngine searching = make_engine();
+    searching.set_search_radius(gwt::kDefaultSearchRadius);
+    gwt::WatermarkEngine scaling = make_engine();
+    scaling.set_search_radius(gwt::kDefaultSearchRadius);
+    scaling.set_scale_search(true);
+
+    const gwt::WatermarkEngine* engines[] = {&engine, &searching, &scaling};
+
+    // 1024^2 carries the 48x48 logo, 2048^2 the 96x96 one
+    for (int size : {1024, 2048}) {
+        const cv::Mat image = make_corpus_image(engine, size, static_cast<unsigned>(size));
+        const cv::Size image_size = image.size();
+
+        for (const gwt::WatermarkEngine* e : engines) {
+            const cv::Rect rect = e->get_processing_rect(image_size) & cv::Rect(0, 0, size, size);
+            const cv::Mat region = image(rect).clone();
+            const char* mode = e->scale_search() ? "scale" : e->search_radius() > 0 ? "search" : "expected";
+            runner.run(fmt::format("locate/{}/{}", mode, size), [&] {
+                (void)e->locate_watermark(region, rect, image_size);
+            });
+        }
+    }
+}
+
+void bench_encode(BenchRunner& runner, const gwt::WatermarkEngine& engine, const std::vector<int>& sizes) {
+    for (int size : sizes) {
+        cv::Mat image;  // Synthesized on first use, since most filters skip these
+        for (gwt::EncodeProfile profile : {gwt::EncodeProfile::Default, gwt::EncodeProfile::Fast,
+                                           gwt::EncodeProfile::Balanced, gwt::EncodeProfile::Archival}) {
+            const gwt::EncoderSettings settings = gwt::encoder_profile(profile);
+            for (const char* ext : kCorpusFormats) {
+                const std::string name = fmt::format("encode/{}/{}/{}",
+                                                     gwt::encode_profile_name(profile), ext + 1, size);
+                if (!runner.selected(name)) {
+                    continue;
+                }
+                if (image.empty()) {
+                    image = make_corpus_image(engine, size, static_cast<unsigned>(size));
+                }
+                std::vector<unsigned char> buffer;
+                runner.run(name, [&] {
+                    if (!gwt::encode_image_as(ext, image, buffer, settings)) {
+                        throw std::runtime_error("encode failed: " + name);
+                    }
+                });
+            }
+        }
+    }
+}
+
+void bench_process_image(BenchRunner& runner, const gwt::WatermarkEngine& engine,
+                         const fs::path& corpus_dir, const std::vector<int>& sizes) {
+    const fs::path out_dir = corpus_dir / "out";
+    fs::create_directories(out_dir);
+
+    for (int size : sizes) {
+        for (const char* ext : kCorpusFormats) {
+            const fs::path input = corpus_file(corpus_dir, size, ext);
+            if (!fs::exists(input)) {
+                continue;
+            }
+            const fs::path output = out_dir / input.filename();
+            const std::string name = fmt::format("process_image/{}/{}", ext + 1, size);
+            runner.run(name, [&] {
+                if (!gwt::process_image(input, output, true, engine)) {
+                    throw std::runtime_error("process_image failed: " + input.string());
+                }
+            });
+        }
+    }
+}
+
+// Files per io/ pass, cycling through the corpus
+constexpr size_t kIoFiles = 64;
+
+// Files read at once by the io_uring loader
+constexpr size_t kIoDepth = 32;
+
+// Drop a file from the page cache so the next read goes to the device
+// (a no-op on tmpfs, whose pages are the file)
+void evict_cached(const fs::path& path) {
+#if !defined(_WIN32) && !defined(__APPLE__)
+    const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd >= 0) {
+        (void)::posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED);
+        ::close(fd);
+    }
+#else
+    (void)path;
+#endif
+}
+
+bool io_selected(const BenchRunner& runner) {
+    for (const char* name : {"io/read/posix", "io/read/io_uring", "io/write/posix", "io/write/io_uring"}) {
+        if (runner.selected(name)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void bench_io(BenchRunner& runner, const fs::path& corpus_dir, const fs::path& io_dir) {
+    std::vector<std::vector<unsigned char>> contents;
+    for (const auto& entry : fs::directory_iterator(corpus_dir)) {
+        std::vector<unsigned char> data;
+        if (entry.is_regular_file() && gwt::read_file(entry.path(), data)) {
+            contents.push_back(std::move(data));
+        }
+    }
+    if (contents.empty()) {
+        return;
+    }
+
+    const fs::path in_dir = io_dir / "in";
+    const fs::path out_dir = io_dir / "out";
+    fs::create_directories(in_dir);
+    std::vector<fs::path> inputs;
+    for (size_t i = 0; i < kIoFiles; ++i) {
+        inputs.push_back(in_dir / fmt::format("file_{:03}.bin", i));
+        if (!gwt::write_file(inputs.back(), contents[i % contents.size()])) {
+            throw std::runtime_error("Failed to write " + inputs.back().string());
+        }
+    }
+
+    std::vector<gwt::IoBackend> backends{gwt::IoBackend::Posix};
+    if (gwt::io_uring_available()) {
+        backends.push_back(gwt::IoBackend::IoUring);
+    } else {
+        fmt::print(stderr, "io_uring unavailable, io/ benchmarks cover posix only\n");
+    }
+
+    for (gwt::IoBackend backend : backends) {
+        const char* name = gwt::io_backend_name(backend);
+
+        gwt::FileLoader loader(backend, kIoDepth);
+        runner.run(fmt::format("io/read/{}", name), [&] {
+            for (const fs::path& input : inputs) {
+                evict_cached(input);
+            }
+            size_t next = 0;
+            size_t loaded = 0;
+            loader.run(
+                [&]() -> std::optional<gwt::LoadRequest> {
+                    if (next >= inputs.size()) {
+                        return std::nullopt;
+                    }
+                    const size_t index = next++;
+                    return gwt::LoadRequest{index, inputs[index]};
+                },
+                [&](gwt::LoadedFile&& file) {
+                    loaded += file.ok ? 1 : 0;
+                    loader.recycle(std::move(file.data));
+                    return true;
+                });
+            if (loaded != inputs.size()) {
+                throw std::runtime_error("io/read: failed to read inputs");
+            }
+        });
+
+        runner.run(fmt::format("io/write/{}", name), [&] {
+            gwt::OutputWriter writer(kIoFiles, backend);
+            for (size_t i = 0; i < kIoFiles; ++i) {
+                writer.submit(out_dir / inputs[i].filename(), std::vector<unsigned char>(contents[i % contents.size()]));
+            }
+            writer.close();
+            if (writer.stats().written != kIoFiles) {
+                throw std::runtime_error("io/write: failed to write outputs");
+            }
+        });
+    }
+
+    std::error_code ec;
+    fs::remove_all(in_dir, ec);
+    fs::remove_all(out_dir, ec);
+}
+
+std::vector<int> parse_sizes(const std::string& list) {
+    std::vector<int> sizes;
+    size_t pos = 0;
+    while (pos < list.size()) {
+        const size_t comma = list.find(',', pos);
+        const std::string item = list.substr(pos, comma == std::string::npos ? std::string::npos : comma - pos);
+        if (!item.empty()) {
+            sizes.push_back(std::stoi(item));
+        }
+        if (comma == std::string::npos) break;
+        pos = comma + 1;
+    }
+    return sizes;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    CLI::App app{"Gemini Watermark Tool - Benchmark Suite"};
+
+    std::string filter;
+    double min_time = 0.5;
+    std::string json_path;
+    std::string generate_dir;
+    std::string corpus_dir;
+    std::string size_list = "1024,2048,4096";
+    std::string io_dir;
+
+    app.add_option("--filter", filter, "Run only benchmarks whose name contains this text");
+    app.add_option("--min-time", min_time, "Minimum seconds to sample each benchmark")
+        ->check(CLI::PositiveNumber);
+    app.add_option("--json", json_path, "Write results as JSON to this file (- = stdout)");
+    app.add_option("--generate", generate_dir, "Write the synthetic corpus to a directory and exit");
+    app.add_option("--corpus", corpus_dir, "Reuse a corpus written by --generate");
+    app.add_option("--sizes", size_list, "Comma-separated corpus image sizes");
+    app.add_option("--io-dir", io_dir, "Directory the io/ benchmarks write to (default: the corpus directory)");
+
+    CLI11_PARSE(app, argc, argv);
+
+    // process_image() logs per file; keep the benchmark output readable
+    spdlog::set_level(spdlog::level::warn);
+
+    try {
+        const std::vector<int> sizes = parse_sizes(size_list);
+        const gwt::WatermarkEngine engine = make_engine();
+
+        if (!generate_dir.empty()) {
+            const size_t written = generate_corpus(engine, generate_dir, sizes);
+            fmt::print("Wrote {} images to {}\n", written, generate_dir);
+            return written > 0 ? 0 : 1;
+        }
+
+        fmt::print(stderr, "gwt_bench {} (blend kernel: {})\n", APP_VERSION,
+                   gwt::blend_kernel_name(gwt::best_blend_kernel()));
+
+        BenchRunner runner(filter, min_time);
+        const cv::Mat capture_48 = decode_capture(gwt::embedded::bg_48_png, gwt::embedded::bg_48_png_size);
+        const cv::Mat capture_96 = decode_capture(gwt::embedded::bg_96_png, gwt::embedded::bg_96_png_size);
+
+        bench_engine(runner);
+        bench_alpha_maps(runner, capture_48, capture_96);
+        bench_blend(runner, capture_48, capture_96);
+        bench_locate(runner, engine);
+        bench_encode(runner, engine, sizes);
+
+        if (runner.selected("process_image/") || io_selected(runner)) {
+            fs::path dir = corpus_dir;
+            const bool temporary = dir.empty();
+            if (temporary) {
+                dir = fs::temp_directory_path() / fmt::format("gwt_bench_{}", std::time(nullptr));
+                generate_corpus(engine, dir, sizes);
+            }
+            bench_process_image(runner, engine, dir, sizes);
+            if (io_selected(runner)) {
+                bench_io(runner, dir, io_dir.empty() ? dir / "io" : fs::path(io_dir));
+            }
+            if (temporary) {
+                std::error_code ec;
+                fs::remove_all(dir, ec);
+            }
+        }
+
+        if (!json_path.empty()) {
+            const std::string json = to_json(runner.results());
+            if (json_path == "-") {
+                fmt::print("{}", json);
+            } else if (!gwt::write_file(json_path, std::vector<unsigned char>(json.begin(), json.end()))) {
+                spdlog::error("Failed to write {}", json_path);
+                return 1;
+            }
+        }
+        return 0;
+
+    } catch (const std::exception& e) {
+        spdlog::error("Benchmark failed: {}", e.what());
+        return 1;
+    }
+}
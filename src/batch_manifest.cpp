@@ -0,0 +1,198 @@
+/**
+ * @file    batch_manifest.cpp
+ * @brief   Gemini Watermark Tool - Incremental Batch Manifest
+ * @author  AllenK (Kwyshell)
+ * @date    2026.10.18
+ * @license MIT
+ *
+ * @details
+ * Unchanged inputs cost one stat() each; only inputs whose size or mtime
+ * moved (e.g. re-synced copies) are read and hashed, at XXH3 speed
+ * (several GB/s, far below decode cost).
+ *
+ * @see https://github.com/allenk/GeminiWatermarkTool
+ */
+
+#include "batch_manifest.hpp"
+#include "mapped_file.hpp"
+
+#include <fmt/core.h>
+#include <spdlog/spdlog.h>
+#include <xxhash.h>
+
+#include <charconv>
+#include <chrono>
+#include <string_view>
+#include <system_error>
+
+namespace gwt {
+
+namespace fs = std::filesystem;
+
+namespace {
+
+constexpr std::string_view kHeader = "# gwt-manifest 1";
+constexpr std::string_view kSettingsPrefix = "# settings ";
+
+template <typename T>
+bool parse_number(std::string_view text, T& value, int base = 10) {
+    const auto [end, ec] = std::from_chars(text.data(), text.data() + text.size(), value, base);
+    return ec == std::errc() && end == text.data() + text.size();
+}
+
+// "<hash>\t<size>\t<mtime>\t<status>\t<key>"
+bool parse_entry(std::string_view line, std::string& key, ManifestEntry& entry) {
+    std::string_view fields[4];
+    for (auto& field : fields) {
+        const size_t tab = line.find('\t');
+        if (tab == std::string_view::npos) {
+            return false;
+        }
+        field = line.substr(0, tab);
+        line.remove_prefix(tab + 1);
+    }
+    if (line.empty() || fields[3].size() != 1 ||
+        !parse_number(fields[0], entry.hash, 16) ||
+        !parse_number(fields[1], entry.stamp.size) ||
+        !parse_number(fields[2], entry.stamp.mtime)) {
+        return false;
+    }
+    switch (fields[3][0]) {
+        case 'w': entry.status = ManifestStatus::Written; break;
+        case 'c': entry.status = ManifestStatus::Clean; break;
+        default: return false;
+    }
+    key.assign(line);
+    return true;
+}
+
+std::string format_entry(const std::string& key, const ManifestEntry& entry) {
+    return fmt::format("{:016x}\t{}\t{}\t{}\t{}\n", entry.hash, entry.stamp.size, entry.stamp.mtime,
+                       entry.status == ManifestStatus::Written ? 'w' : 'c', key);
+}
+
+bool representable(const std::string& key) {
+    return !key.empty() && key.find_first_of("\r\n") == std::string::npos;
+}
+
+} // namespace
+
+std::optional<FileStamp> stat_file(const fs::path& path) {
+    std::error_code ec;
+    const uintmax_t size = fs::file_size(path, ec);
+    if (ec) {
+        return std::nullopt;
+    }
+    const fs::file_time_type mtime = fs::last_write_time(path, ec);
+    if (ec) {
+        return std::nullopt;
+    }
+    FileStamp stamp;
+    stamp.size = static_cast<uint64_t>(size);
+    stamp.mtime = std::chrono::duration_cast<std::chrono::nanoseconds>(mtime.time_since_epoch()).count();
+    return stamp;
+}
+
+std::optional<uint64_t> hash_file(const fs::path& path) {
+    MappedFile file;
+    if (!file.open(path)) {
+        return std::nullopt;
+    }
+    return static_cast<uint64_t>(XXH3_64bits(file.data(), file.size()));
+}
+
+BatchManifest::BatchManifest(const fs::path& output_dir, std::string settings)
+    : path_(output_dir / kFileName), settings_(std::move(settings)) {
+    bool resume = false;
+    bool ends_with_newline = true;
+    {
+        std::ifstream in(path_, std::ios::binary);
+        std::string line;
+        if (in && std::getline(in, line) && line == kHeader &&
+            std::getline(in, line) && line == std::string(kSettingsPrefix) + settings_) {
+            resume = true;
+            std::string key;
+            ManifestEntry entry;
+            while (std::getline(in, line)) {
+                // A line cut short by an interrupted run has no newline; drop it
+                if (in.eof()) {
+                    ends_with_newline = false;
+                    break;
+                }
+                if (parse_entry(line, key, entry)) {
+                    previous_[key] = entry;
+                }
+            }
+        } else if (in) {
+            spdlog::info("Manifest {} is from other settings; processing all files", path_.string());
+        }
+    }
+
+    if (resume) {
+        journal_.open(path_, std::ios::binary | std::ios::app);
+        if (!ends_with_newline) {
+            journal_ << '\n';
+        }
+    } else {
+        journal_.open(path_, std::ios::binary | std::ios::trunc);
+        journal_ << kHeader << '\n' << kSettingsPrefix << settings_ << '\n';
+    }
+    if (!journal_) {
+        spdlog::warn("Cannot write manifest {}", path_.string());
+    }
+    spdlog::debug("Manifest: {} entries from the previous run", previous_.size());
+}
+
+const ManifestEntry* BatchManifest::find(const std::string& key) const {
+    auto it = previous_.find(key);
+    return it == previous_.end() ? nullptr : &it->second;
+}
+
+void BatchManifest::record(const std::string& key, const ManifestEntry& entry) {
+    if (!representable(key)) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    current_[key] = entry;
+    if (journal_.is_open()) {
+        journal_ << format_entry(key, entry);
+    }
+}
+
+void BatchManifest::retain(const std::string& key) {
+    const ManifestEntry* entry = find(key);
+    if (entry == nullptr) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    current_[key] = *entry;
+}
+
+bool BatchManifest::save() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    journal_.close();
+
+    fs::path temp = path_;
+    temp += ".tmp";
+    {
+        std::ofstream out(temp, std::ios::binary | std::ios::trunc);
+        out << kHeader << '\n' << kSettingsPrefix << settings_ << '\n';
+        for (const auto& [key, entry] : current_) {
+            out << format_entry(key, entry);
+        }
+        if (!out.flush()) {
+            spdlog::error("Failed to write manifest {}", temp.string());
+            return false;
+        }
+    }
+
+    std::error_code ec;
+    fs::rename(temp, path_, ec);
+    if (ec) {
+        spdlog::error("Failed to replace manifest {}: {}", path_.string(), ec.message());
+        return false;
+    }
+    return true;
+}
+
+} // namespace gwt
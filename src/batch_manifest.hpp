@@ -0,0 +1,125 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+
+namespace gwt {
+
+/**
+ * Incremental batch runs (--incremental)
+ *
+ * The manifest lives in the output directory and records, per input, the
+ * size, mtime and XXH3-64 hash it had when it was last processed, plus a
+ * settings line (tool version, asset hash, options that change the
+ * output). A later run with the same settings skips inputs that are
+ * unchanged:
+ *
+ *   size and mtime match                -> skipped without reading the file
+ *   size or mtime differ, hash matches  -> skipped (entry refreshed)
+ *   otherwise                           -> processed
+ *
+ * Results are appended as they complete, so an interrupted run keeps what
+ * it finished; save() rewrites the file compacted (and drops inputs that
+ * no longer exist) once the run is over.
+ *
+ * File format (text, one entry per line, later lines win):
+ *
+ *   # gwt-manifest 1
+ *   # settings <settings>
+ *   <hash, 16 hex digits>\t<size>\t<mtime ns>\t<w|c>\t<input path>
+ *
+ * where w = output written, c = skipped as clean (--skip-clean, no output).
+ */
+
+/**
+ * Size and modification time of a file
+ */
+struct FileStamp {
+    uint64_t size = 0;
+    int64_t mtime = 0;      // file_time_type ticks, in nanoseconds
+
+    bool operator==(const FileStamp&) const = default;
+};
+
+/**
+ * Stat a file (nullopt if it cannot be read)
+ */
+std::optional<FileStamp> stat_file(const std::filesystem::path& path);
+
+/**
+ * XXH3-64 of a file's contents (nullopt on read errors)
+ */
+std::optional<uint64_t> hash_file(const std::filesystem::path& path);
+
+enum class ManifestStatus {
+    Written,    // Output file produced
+    Clean,      // No watermark, no output (--skip-clean)
+};
+
+struct ManifestEntry {
+    FileStamp stamp;
+    uint64_t hash = 0;
+    ManifestStatus status = ManifestStatus::Written;
+};
+
+class BatchManifest {
+public:
+    static constexpr const char* kFileName = ".gwt-manifest";
+
+    /**
+     * Load the manifest of an output directory and open it for appending
+     *
+     * Entries recorded under different settings are discarded (and the
+     * file restarted), so changing the tool, assets or options reprocesses
+     * everything once.
+     *
+     * @param output_dir  Batch output directory (must exist)
+     * @param settings    Everything besides the input that affects the output
+     */
+    BatchManifest(const std::filesystem::path& output_dir, std::string settings);
+
+    /**
+     * Entry from the previous run (nullptr if none)
+     *
+     * Thread-safe: the previous run's entries are not modified during a run.
+     */
+    const ManifestEntry* find(const std::string& key) const;
+
+    /**
+     * Record a processed input (thread-safe, appended to the file)
+     */
+    void record(const std::string& key, const ManifestEntry& entry);
+
+    /**
+     * Keep the previous entry of an unchanged input (thread-safe)
+     */
+    void retain(const std::string& key);
+
+    /**
+     * Rewrite the file with only this run's entries (temp file + rename)
+     *
+     * @return  True if successful
+     */
+    bool save();
+
+    /**
+     * Number of entries loaded from the previous run
+     */
+    size_t previous_size() const { return previous_.size(); }
+
+private:
+    std::filesystem::path path_;
+    std::string settings_;
+    std::unordered_map<std::string, ManifestEntry> previous_;
+
+    std::mutex mutex_;
+    std::unordered_map<std::string, ManifestEntry> current_;
+    std::ofstream journal_;
+};
+
+} // namespace gwt
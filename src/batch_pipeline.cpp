@@ -0,0 +1,414 @@
+/**
+ * @file    batch_pipeline.cpp
+ * @brief   Gemini Watermark Tool - Staged Decode / Blend / Encode Pipeline
+ * @author  AllenK (Kwyshell)
+ * @date    2026.10.18
+ * @license MIT
+ *
+ * @see https://github.com/allenk/GeminiWatermarkTool
+ */
+
+#include "batch_pipeline.hpp"
+#include "bounded_queue.hpp"
+#include "file_loader.hpp"
+#include "frame_pool.hpp"
+#include "mapped_file.hpp"
+#include "output_writer.hpp"
+#include "region_reader.hpp"
+#include "stage_stats.hpp"
+#include "thread_pool.hpp"
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+
+namespace gwt {
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+struct DecodedImage {
+    BatchItem item;
+    size_t index = 0;
+    cv::Mat image;
+    SourceFormat source;    // Input parameters for encode_image()
+};
+
+// Busy time and item count of one stage, accumulated by all its threads
+struct StageCounters {
+    std::atomic<size_t> items{0};
+    std::atomic<int64_t> busy_ns{0};
+
+    void add(Clock::duration busy) {
+        items.fetch_add(1, std::memory_order_relaxed);
+        busy_ns.fetch_add(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(busy).count(),
+            std::memory_order_relaxed);
+    }
+
+    double busy_seconds() const {
+        return static_cast<double>(busy_ns.load()) / 1e9;
+    }
+};
+
+} // namespace
+
+PipelineReport run_pipeline(
+    const std::vector<BatchItem>& items,
+    bool remove,
+    const WatermarkEngine& engine,
+    std::optional<WatermarkSize> force_size,
+    const PipelineOptions& options,
+    std::optional<double> skip_clean,
+    const ItemCallback& on_item) {
+    size_t next = 0;
+    ItemSource source = [&]() -> std::optional<BatchItem> {
+        if (next >= items.size()) {
+            return std::nullopt;
+        }
+        return items[next++];
+    };
+    return run_pipeline(source, remove, engine, force_size, options, skip_clean, on_item);
+}
+
+PipelineReport run_pipeline(
+    const ItemSource& next_item,
+    bool remove,
+    const WatermarkEngine& engine,
+    std::optional<WatermarkSize> force_size,
+    const PipelineOptions& options,
+    std::optional<double> skip_clean,
+    const ItemCallback& on_item) {
+    // Auto sizing: decode and encode dominate, blending only touches a corner
+    const size_t cores = ThreadPool::default_thread_count();
+    const size_t readers = options.readers > 0 ? options.readers : std::max<size_t>(1, cores / 2);
+    const size_t blenders = options.blenders > 0 ? options.blenders : 1;
+    const size_t encoders = options.encoders > 0 ? options.encoders : std::max<size_t>(1, cores / 2);
+    const size_t depth = options.queue_depth > 0 ? options.queue_depth : 2 * std::max(readers, encoders);
+
+    const size_t io_depth = options.io_depth > 0 ? options.io_depth : 2 * readers;
+
+    // Reads go through the loader only when io_uring is really there; POSIX
+    // reads from one thread would serialize what the readers do in parallel
+    std::optional<FileLoader> loader;
+    if (options.io_backend == IoBackend::IoUring) {
+        loader.emplace(IoBackend::IoUring, io_depth);
+        if (loader->backend() != IoBackend::IoUring) {
+            loader.reset();
+        }
+    }
+
+    spdlog::info("Pipeline: {} reader(s), {} blender(s), {} encoder(s), queue depth {}, {} I/O",
+                 readers, blenders, encoders, depth,
+                 io_backend_name(loader ? IoBackend::IoUring : IoBackend::Posix));
+
+    BoundedQueue<LoadedFile> loaded(io_depth);
+    BoundedQueue<DecodedImage> decoded(depth);
+    BoundedQueue<DecodedImage> blended(depth);
+
+    // Encoders hand finished frames back to the readers; enough for every
+    // frame that can be in flight at once
+    FramePool frames(2 * depth + readers + blenders + encoders);
+
+    // Encoded files (and patched ones from the readers) are committed to
+    // disk by the writer's I/O thread; items finish when their write does
+    OutputWriter writer(depth, options.io_backend);
+
+    // The source is called by one fetcher at a time. Items then travel
+    // with their work (loading, the queues, the writer's callbacks) and
+    // are dropped once finished, so memory does not grow with file count.
+    std::mutex source_mutex;
+    size_t produced = 0;
+    bool source_done = false;
+    std::atomic<int64_t> source_wait_ns{0};
+
+    // Items the loader has requested, until a reader picks up their data
+    std::mutex loading_mutex;
+    std::unordered_map<size_t, BatchItem> loading;
+
+    std::atomic<size_t> succeeded{0};
+    std::atomic<size_t> failed{0};
+    std::atomic<size_t> skipped{0};
+    StageCounters read_stage, blend_stage, encode_stage;
+
+    auto fetch = [&](size_t& index) -> std::optional<BatchItem> {
+        std::lock_guard<std::mutex> lock(source_mutex);
+        if (source_done) {
+            return std::nullopt;
+        }
+        auto t0 = Clock::now();
+        std::optional<BatchItem> item = next_item();
+        source_wait_ns.fetch_add(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - t0).count(),
+            std::memory_order_relaxed);
+        if (!item) {
+            source_done = true;
+            return std::nullopt;
+        }
+        index = produced++;
+        return item;
+    };
+
+    auto take_loading = [&](size_t index) {
+        std::lock_guard<std::mutex> lock(loading_mutex);
+        auto it = loading.find(index);
+        BatchItem item = std::move(it->second);
+        loading.erase(it);
+        return item;
+    };
+
+    auto finish = [&](size_t index, ItemOutcome outcome) {
+        switch (outcome) {
+            case ItemOutcome::Succeeded: succeeded++; break;
+            case ItemOutcome::Failed:    failed++; break;
+            case ItemOutcome::Skipped:   skipped++; break;
+        }
+        if (on_item) {
+            on_item(index, outcome);
+        }
+    };
+
+    auto start = Clock::now();
+
+    std::vector<std::thread> read_threads, blend_threads, encode_threads;
+
+    // With io_uring one thread reads ahead and the readers only decode
+    std::thread load_thread;
+    int64_t load_ns = 0;
+    size_t load_items = 0;
+    if (loader) {
+        load_thread = std::thread([&] {
+            auto t0 = Clock::now();
+            loader->run(
+                [&]() -> std::optional<LoadRequest> {
+                    size_t index = 0;
+                    std::optional<BatchItem> item = fetch(index);
+                    if (!item) {
+                        return std::nullopt;
+                    }
+                    LoadRequest request{index, item->input};
+                    std::lock_guard<std::mutex> lock(loading_mutex);
+                    loading.emplace(index, std::move(*item));
+                    return request;
+                },
+                [&](LoadedFile&& file) {
+                    load_items++;
+                    return loaded.push(std::move(file));
+                });
+            loaded.close();
+            load_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - t0).count();
+        });
+    }
+
+    for (size_t i = 0; i < readers; ++i) {
+        read_threads.emplace_back([&] {
+            MappedFile mapped;
+            while (true) {
+                size_t index = 0;
+                BatchItem item;
+                std::optional<LoadedFile> input;
+                if (loader) {
+                    input = loaded.pop();
+                    if (!input) break;
+                    index = input->request.index;
+                    item = take_loading(index);
+                } else {
+                    std::optional<BatchItem> next = fetch(index);
+                    if (!next) break;
+                    item = std::move(*next);
+                }
+
+                auto t0 = Clock::now();
+                cv::Mat image;
+                SourceFormat source;
+                std::vector<unsigned char> patch;
+                bool patched = false;
+                bool clean = false;
+                try {
+                    // Clean images and fast-path formats never enter the queues;
+                    // all checks run on the bytes read (or mapped) once here
+                    const bool readable = input ? input->ok : mapped.open(item.input);
+                    if (readable) {
+                        const unsigned char* data = input ? input->data.data() : mapped.data();
+                        const size_t size = input ? input->data.size() : mapped.size();
+                        clean = skip_clean &&
+                                is_clean_image(data, size, item.input, engine, force_size, *skip_clean);
+                        patched = !clean && try_patch_image(data, size, item.input, item.output, patch,
+                                                            remove, engine, force_size);
+                        if (!clean && !patched) {
+                            image = frames.acquire();
+                            if (!decode_image(data, size, image, &source)) {
+                                image.release();
+                            }
+                        }
+                    }
+                } catch (const std::exception& e) {
+                    spdlog::error("Error reading {}: {}", item.input.string(), e.what());
+                }
+                if (input) {
+                    loader->recycle(std::move(input->data));
+                } else {
+                    mapped.close();
+                }
+                read_stage.add(Clock::now() - t0);
+
+                if (clean) {
+                    finish(index, ItemOutcome::Skipped);
+                    continue;
+                }
+
+                if (patched) {
+                    writer.submit(item.output, std::move(patch),
+                                  [&, name = item.output.filename().string(),
+                                   ext = item.input.extension().string(), index](bool ok) {
+                        if (ok) {
+                            spdlog::info("Saved: {} (patched)", name);
+                            record_image(ext);
+                        }
+                        finish(index, ok ? ItemOutcome::Succeeded : ItemOutcome::Failed);
+                    });
+                    continue;
+                }
+
+                if (image.empty()) {
+                    spdlog::error("Failed to load image: {}", item.input.string());
+                    finish(index, ItemOutcome::Failed);
+                    continue;
+                }
+
+                spdlog::info("Processing: {} ({}x{})",
+                             item.input.filename().string(), image.cols, image.rows);
+                if (!decoded.push(DecodedImage{std::move(item), index, std::move(image), std::move(source)})) break;
+            }
+        });
+    }
+
+    for (size_t i = 0; i < blenders; ++i) {
+        blend_threads.emplace_back([&] {
+            while (auto work = decoded.pop()) {
+                auto t0 = Clock::now();
+                bool ok = true;
+                try {
+                    if (remove) {
+                        engine.remove_watermark(work->image, force_size);
+                    } else {
+                        engine.add_watermark(work->image, force_size);
+                    }
+                } catch (const std::exception& e) {
+                    spdlog::error("Error processing {}: {}", work->item.input.string(), e.what());
+                    ok = false;
+                }
+                blend_stage.add(Clock::now() - t0);
+
+                if (!ok) {
+                    frames.release(std::move(work->image));
+                    finish(work->index, ItemOutcome::Failed);
+                    continue;
+                }
+                if (!blended.push(std::move(*work))) break;
+            }
+        });
+    }
+
+    for (size_t i = 0; i < encoders; ++i) {
+        encode_threads.emplace_back([&] {
+            while (auto work = blended.pop()) {
+                const BatchItem& item = work->item;
+                const size_t index = work->index;
+                auto t0 = Clock::now();
+                std::vector<unsigned char> buffer = writer.acquire_buffer();
+                bool ok = false;
+                try {
+                    ok = encode_image(item.output, work->image, buffer, &work->source);
+                    if (!ok) {
+                        spdlog::error("Failed to encode image: {}", item.output.string());
+                    }
+                } catch (const std::exception& e) {
+                    spdlog::error("Error encoding {}: {}", item.output.string(), e.what());
+                }
+                // Recycle the frame before timing stops, it is part of the stage's cost
+                frames.release(std::move(work->image));
+                encode_stage.add(Clock::now() - t0);
+
+                if (!ok) {
+                    finish(index, ItemOutcome::Failed);
+                    continue;
+                }
+                writer.submit(item.output, std::move(buffer),
+                              [&, name = item.output.filename().string(),
+                               ext = item.input.extension().string(), index](bool written) {
+                    if (written) {
+                        spdlog::info("Saved: {}", name);
+                        record_image(ext);
+                    }
+                    finish(index, written ? ItemOutcome::Succeeded : ItemOutcome::Failed);
+                });
+            }
+        });
+    }
+
+    // Shut the stages down in order: each queue closes once its producers exit
+    if (load_thread.joinable()) load_thread.join();
+    for (auto& t : read_threads) t.join();
+    decoded.close();
+    for (auto& t : blend_threads) t.join();
+    blended.close();
+    for (auto& t : encode_threads) t.join();
+    writer.close();
+
+    QueueStats loaded_stats = loaded.stats();
+    QueueStats decoded_stats = decoded.stats();
+    QueueStats blended_stats = blended.stats();
+    const OutputWriterStats write_stats = writer.stats();
+
+    PipelineReport report;
+    report.succeeded = succeeded.load();
+    report.failed = failed.load();
+    report.skipped = skipped.load();
+    report.wall_time = std::chrono::duration<double>(Clock::now() - start).count();
+
+    const double source_wait = static_cast<double>(source_wait_ns.load()) / 1e9;
+    if (loader) {
+        report.stages.push_back(StageReport{
+            "load", 1, load_items,
+            static_cast<double>(load_ns) / 1e9 - source_wait - loaded_stats.push_wait,
+            source_wait, loaded_stats.push_wait});
+        report.stages.push_back(StageReport{
+            "decode", readers, read_stage.items.load(), read_stage.busy_seconds(),
+            loaded_stats.pop_wait, decoded_stats.push_wait});
+    } else {
+        report.stages.push_back(StageReport{
+            "read+decode", readers, read_stage.items.load(), read_stage.busy_seconds(),
+            source_wait, decoded_stats.push_wait});
+    }
+    report.stages.push_back(StageReport{
+        "blend", blenders, blend_stage.items.load(), blend_stage.busy_seconds(),
+        decoded_stats.pop_wait, blended_stats.push_wait});
+    report.stages.push_back(StageReport{
+        "encode", encoders, encode_stage.items.load(), encode_stage.busy_seconds(),
+        blended_stats.pop_wait, write_stats.queue.push_wait});
+    report.stages.push_back(StageReport{
+        "write+sync", 1, write_stats.written + write_stats.failed, write_stats.busy,
+        write_stats.queue.pop_wait, 0.0});
+
+    if (loader) {
+        report.queues.push_back(QueueReport{
+            "loaded", loaded_stats.capacity, loaded_stats.max_depth, loaded_stats.avg_depth});
+    }
+    report.queues.push_back(QueueReport{
+        "decoded", decoded_stats.capacity, decoded_stats.max_depth, decoded_stats.avg_depth});
+    report.queues.push_back(QueueReport{
+        "blended", blended_stats.capacity, blended_stats.max_depth, blended_stats.avg_depth});
+    report.queues.push_back(QueueReport{
+        "encoded", write_stats.queue.capacity, write_stats.queue.max_depth, write_stats.queue.avg_depth});
+
+    return report;
+}
+
+} // namespace gwt
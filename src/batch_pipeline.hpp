@@ -0,0 +1,155 @@
+#pragma once
+
+#include "io_ring.hpp"
+#include "watermark_engine.hpp"
+
+#include <cstddef>
+#include <filesystem>
+#include <functional>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace gwt {
+
+/**
+ * A single unit of batch work
+ */
+struct BatchItem {
+    std::filesystem::path input;
+    std::filesystem::path output;
+};
+
+/**
+ * Thread counts, queue depth and file I/O for the staged pipeline (0 = auto)
+ */
+struct PipelineOptions {
+    size_t readers = 0;         // Read + decode threads
+    size_t blenders = 0;        // Watermark blend threads
+    size_t encoders = 0;        // Encode threads (writes go to one I/O thread)
+    size_t queue_depth = 0;     // Capacity of each inter-stage queue
+    IoBackend io_backend = IoBackend::Posix;
+    size_t io_depth = 0;        // io_uring: input files being read at once
+};
+
+/**
+ * Per-stage timing summary (seconds summed over the stage's threads)
+ */
+struct StageReport {
+    std::string name;
+    size_t threads = 0;
+    size_t items = 0;
+    double busy = 0.0;          // Time spent doing work
+    double starved = 0.0;       // Time waiting on an empty input queue
+    double blocked = 0.0;       // Time waiting on a full output queue
+};
+
+/**
+ * Inter-stage queue occupancy summary
+ */
+struct QueueReport {
+    std::string name;
+    size_t capacity = 0;
+    size_t max_depth = 0;
+    double avg_depth = 0.0;
+};
+
+/**
+ * Outcome of a pipelined batch run
+ */
+struct PipelineReport {
+    size_t succeeded = 0;
+    size_t failed = 0;
+    size_t skipped = 0;
+    double wall_time = 0.0;
+    std::vector<StageReport> stages;
+    std::vector<QueueReport> queues;
+};
+
+/**
+ * How a batch item ended
+ */
+enum class ItemOutcome {
+    Succeeded,
+    Failed,
+    Skipped,    // No watermark (skip_clean)
+};
+
+/**
+ * Called once per item as it finishes (index into the item list, or the
+ * order the source produced it), from whichever stage thread finished it;
+ * must be thread-safe
+ */
+using ItemCallback = std::function<void(size_t index, ItemOutcome outcome)>;
+
+/**
+ * Produces batch items one at a time, nullopt once there are no more.
+ * May block until the next item is known (e.g. during a directory walk).
+ */
+using ItemSource = std::function<std::optional<BatchItem>()>;
+
+/**
+ * Process a list of images with a staged pipeline
+ *
+ *   readers (decode) -> [queue] -> blenders -> [queue] -> encoders -> [queue] -> writer
+ *
+ * With IoBackend::IoUring a FileLoader thread reads the inputs ahead of
+ * the readers, io_depth files at a time (up to twice that many encoded
+ * inputs are held in memory), and the readers only decode from memory;
+ * the writer submits its batches through io_uring too. With
+ * IoBackend::Posix each reader maps its own input.
+ *
+ * Files handled by try_patch_image() are patched by the reader stage and
+ * go straight to the writer; files that skip_clean rejects (see
+ * is_clean_image()) are completed by the reader stage.
+ *
+ * The writer is an OutputWriter: one I/O thread that replaces each output
+ * atomically and syncs them in batches, so in-place runs cannot leave a
+ * truncated file behind. Items count as succeeded once their output is
+ * on disk.
+ *
+ * Stages are connected by bounded queues, so at most
+ * (2 * queue_depth + thread count) decoded images are alive at any time
+ * regardless of how many files are processed, and slow storage reads
+ * overlap with CPU-bound encoding. Encoded frames go back to the readers
+ * through a FramePool, so same-sized images are decoded into recycled
+ * buffers instead of freshly allocated ones.
+ *
+ * @param items        Input/output path pairs
+ * @param remove       Remove watermark (true) or add watermark (false)
+ * @param engine       The watermark engine to use (shared by all stages)
+ * @param force_size   Force a specific watermark size
+ * @param options      Stage thread counts and queue depth
+ * @param skip_clean   Leave images whose watermark confidence is below this untouched
+ * @param on_item      Optional per-item completion callback
+ * @return             Counters plus per-stage / per-queue statistics
+ */
+PipelineReport run_pipeline(
+    const std::vector<BatchItem>& items,
+    bool remove,
+    const WatermarkEngine& engine,
+    std::optional<WatermarkSize> force_size,
+    const PipelineOptions& options = {},
+    std::optional<double> skip_clean = std::nullopt,
+    const ItemCallback& on_item = {}
+);
+
+/**
+ * Process images with a staged pipeline as a source produces them
+ *
+ * Same as above, but the readers pull items from next_item (one call at a
+ * time), so work starts before the full list is known. Time readers spend
+ * waiting on the source is reported as the read stage's starved time.
+ * The n-th item produced has index n in on_item.
+ */
+PipelineReport run_pipeline(
+    const ItemSource& next_item,
+    bool remove,
+    const WatermarkEngine& engine,
+    std::optional<WatermarkSize> force_size,
+    const PipelineOptions& options = {},
+    std::optional<double> skip_clean = std::nullopt,
+    const ItemCallback& on_item = {}
+);
+
+} // namespace gwt
@@ -0,0 +1,405 @@
+/**
+ * @file    batch_runner.cpp
+ * @brief   Gemini Watermark Tool - Parallel Batch Processing
+ * @author  AllenK (Kwyshell)
+ * @date    2026.10.18
+ * @license MIT
+ *
+ * @see https://github.com/allenk/GeminiWatermarkTool
+ */
+
+#include "batch_runner.hpp"
+#include "batch_manifest.hpp"
+#include "bounded_queue.hpp"
+#include "output_writer.hpp"
+#include "region_reader.hpp"
+#include "stage_stats.hpp"
+#include "thread_pool.hpp"
+#include "tree_walker.hpp"
+
+#include <fmt/core.h>
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#ifndef APP_VERSION
+#define APP_VERSION "unknown"
+#endif
+
+namespace gwt {
+
+namespace fs = std::filesystem;
+
+namespace {
+
+// Padded to a cache line so workers never share one when counting
+struct alignas(64) WorkerCounters {
+    size_t succeeded = 0;
+    size_t failed = 0;
+    size_t skipped = 0;
+    size_t unchanged = 0;
+};
+
+// An input to process, with what the manifest records for it afterwards
+struct PendingFile {
+    fs::path input;
+    fs::path output;                        // Same relative path under the output directory
+    std::string key;                        // Manifest key (path relative to the input directory)
+    std::optional<ManifestEntry> entry;     // Unset if the file could not be stat'ed/hashed
+};
+
+// Everything besides the input that changes the output
+std::string manifest_settings(const WatermarkEngine& engine, bool remove, const BatchOptions& options) {
+    const char* size = !options.force_size ? "auto"
+                     : *options.force_size == WatermarkSize::Small ? "small" : "large";
+    const std::string skip_clean = options.skip_clean ? fmt::format("{:.3f}", *options.skip_clean) : "off";
+    return fmt::format("version={} assets={:016x} mode={} size={} search={} scale={} skip-clean={} encoder={}",
+                       APP_VERSION, engine.asset_hash(), remove ? "remove" : "add", size,
+                       engine.search_radius(), engine.scale_search() ? 1 : 0, skip_clean,
+                       describe_encoder_settings(encoder_settings()));
+}
+
+// Whether an input still matches its manifest entry (and its output exists);
+// fills in the entry to record if it has to be processed
+bool is_unchanged(BatchManifest& manifest, PendingFile& file) {
+    const std::optional<FileStamp> stamp = stat_file(file.input);
+    if (!stamp) {
+        return false;
+    }
+
+    const ManifestEntry* previous = manifest.find(file.key);
+    const bool output_current = previous != nullptr &&
+        (previous->status == ManifestStatus::Clean || fs::exists(file.output));
+
+    // Same size and mtime: trusted without reading the file
+    if (output_current && previous->stamp == *stamp) {
+        manifest.retain(file.key);
+        return true;
+    }
+
+    const std::optional<uint64_t> hash = hash_file(file.input);
+    if (!hash) {
+        return false;
+    }
+    ManifestEntry entry{*stamp, *hash, ManifestStatus::Written};
+
+    // Touched but identical content: refresh the stamp
+    if (output_current && previous->hash == *hash) {
+        entry.status = previous->status;
+        manifest.record(file.key, entry);
+        return true;
+    }
+
+    file.entry = entry;
+    return false;
+}
+
+} // namespace
+
+bool is_supported_image(const fs::path& path) {
+    std::string ext = path.extension().string();
+    std::transform(ext.begin(), ext.end(), ext.begin(), ::tolower);
+
+    return ext == ".jpg" || ext == ".jpeg" || ext == ".png" ||
+           ext == ".webp" || ext == ".bmp";
+}
+
+BatchResult run_batch(
+    const fs::path& input_dir,
+    const fs::path& output_dir,
+    bool remove,
+    const WatermarkEngine& engine,
+    const BatchOptions& options) {
+    if (!fs::exists(output_dir)) {
+        fs::create_directories(output_dir);
+    }
+
+    BatchResult result;
+    size_t jobs = options.jobs > 0 ? options.jobs : ThreadPool::default_thread_count();
+
+    auto make_pending = [&](const fs::path& file) {
+        const fs::path relative = file.lexically_relative(input_dir);
+        return PendingFile{file, output_dir / relative, relative.generic_string(), std::nullopt};
+    };
+
+    std::optional<BatchManifest> manifest;
+    if (options.incremental) {
+        manifest.emplace(output_dir, manifest_settings(engine, remove, options));
+    }
+
+    // Record finished inputs so the next run can skip them. Processing in
+    // place replaces the input, so then the output is what gets recorded.
+    std::error_code ec;
+    const bool in_place = manifest && fs::equivalent(input_dir, output_dir, ec);
+    auto record = [&](const PendingFile& file, ManifestStatus status) {
+        if (!manifest || !file.entry) {
+            return;
+        }
+        ManifestEntry entry = *file.entry;
+        entry.status = status;
+        if (in_place && status == ManifestStatus::Written) {
+            const std::optional<FileStamp> stamp = stat_file(file.input);
+            const std::optional<uint64_t> hash = hash_file(file.input);
+            if (!stamp || !hash) {
+                return;
+            }
+            entry.stamp = *stamp;
+            entry.hash = *hash;
+        }
+        manifest->record(file.key, entry);
+    };
+
+    // Worker pools hand their outputs to one I/O thread that replaces them
+    // atomically and syncs in batches (the pipeline runs its own writer).
+    // Its callbacks count written files, and record them only once on disk.
+    WorkerCounters written;
+    std::optional<OutputWriter> writer;
+    if (!options.pipeline) {
+        writer.emplace(std::max<size_t>(16, 2 * jobs), options.pipeline_options.io_backend);
+    }
+
+    auto process = [&](const PendingFile& file, WorkerCounters& counters) {
+        if (options.skip_clean &&
+            is_clean_image(file.input, engine, options.force_size, *options.skip_clean)) {
+            counters.skipped++;
+            record(file, ManifestStatus::Clean);
+            return;
+        }
+        std::vector<unsigned char> buffer = writer->acquire_buffer();
+        bool patched = false;
+        if (!process_image_to_buffer(file.input, file.output, buffer, remove, engine,
+                                     options.force_size, &patched)) {
+            counters.failed++;
+            return;
+        }
+        writer->submit(file.output, std::move(buffer), [&, file, patched](bool ok) {
+            if (!ok) {
+                written.failed++;
+                return;
+            }
+            if (patched) {
+                spdlog::info("Saved: {} (patched)", file.output.filename().string());
+            } else {
+                spdlog::info("Saved: {}", file.output.filename().string());
+            }
+            record_image(file.input.extension().string());
+            written.succeeded++;
+            record(file, ManifestStatus::Written);
+        });
+    };
+
+    // Flat runs collect and sort up front so dispatch order (and logs) are
+    // reproducible; recursive runs stream files in as the walk finds them
+    std::vector<PendingFile> pending;
+    if (!options.recursive) {
+        std::vector<fs::path> files;
+        for (const auto& entry : fs::directory_iterator(input_dir)) {
+            if (!entry.is_regular_file()) continue;
+            if (!is_supported_image(entry.path())) continue;
+            files.push_back(entry.path());
+        }
+        std::sort(files.begin(), files.end());
+        jobs = std::clamp<size_t>(files.size(), 1, jobs);
+
+        pending.reserve(files.size());
+        for (const auto& file : files) {
+            pending.push_back(make_pending(file));
+        }
+
+        // Drop inputs that are current; stat + hash in parallel, since
+        // changed files have to be read in full
+        if (manifest && !pending.empty()) {
+            std::vector<char> unchanged(pending.size(), 0);
+            {
+                ThreadPool pool(jobs);
+                for (size_t i = 0; i < pending.size(); ++i) {
+                    pool.submit([&, i](size_t) {
+                        unchanged[i] = is_unchanged(*manifest, pending[i]);
+                    });
+                }
+                pool.wait();
+            }
+
+            size_t kept = 0;
+            for (size_t i = 0; i < pending.size(); ++i) {
+                if (!unchanged[i]) {
+                    if (kept != i) {
+                        pending[kept] = std::move(pending[i]);
+                    }
+                    ++kept;
+                }
+            }
+            result.unchanged = pending.size() - kept;
+            pending.resize(kept);
+            spdlog::info("Manifest: {} unchanged, {} to process", result.unchanged, pending.size());
+        }
+    }
+
+    // Keep the walk out of an output tree nested in the input tree
+    fs::path output_subtree;
+    if (options.recursive) {
+        std::error_code in_ec, out_ec;
+        const fs::path in_root = fs::weakly_canonical(input_dir, in_ec);
+        const fs::path out_root = fs::weakly_canonical(output_dir, out_ec);
+        const fs::path relative = out_root.lexically_relative(in_root);
+        if (!in_ec && !out_ec && !relative.empty() && relative != "." && *relative.begin() != "..") {
+            output_subtree = relative;
+        }
+    }
+    DirectoryFilter descend;
+    if (!output_subtree.empty()) {
+        descend = [&](const fs::path& dir) {
+            return dir.lexically_relative(input_dir) != output_subtree;
+        };
+    }
+
+    if (options.pipeline) {
+        // Inputs the pipeline is working on, by pipeline index, until they
+        // finish; only kept to record them in the manifest
+        std::mutex dispatched_mutex;
+        std::unordered_map<size_t, PendingFile> dispatched;
+        size_t produced = 0;    // The pipeline calls the source one at a time
+
+        std::atomic<size_t> unchanged{0};
+        BoundedQueue<PendingFile> found(std::max<size_t>(64, 4 * jobs));
+        std::thread walker;
+        if (options.recursive) {
+            spdlog::info("Walking {} with {} thread(s)", input_dir.string(), jobs);
+            walker = std::thread([&] {
+                ThreadPool pool(jobs);
+                walk_tree(pool, input_dir, descend, [&](const fs::path& path, size_t) {
+                    if (!is_supported_image(path)) return;
+                    PendingFile file = make_pending(path);
+                    if (manifest && is_unchanged(*manifest, file)) {
+                        unchanged++;
+                        return;
+                    }
+                    found.push(std::move(file));
+                });
+                try {
+                    pool.wait();
+                } catch (const std::exception& e) {
+                    spdlog::error("Directory walk failed: {}", e.what());
+                }
+                found.close();
+            });
+        }
+
+        size_t next = 0;
+        ItemSource source = [&]() -> std::optional<BatchItem> {
+            std::optional<PendingFile> file;
+            if (options.recursive) {
+                file = found.pop();
+            } else if (next < pending.size()) {
+                file = std::move(pending[next++]);
+            }
+            if (!file) {
+                return std::nullopt;
+            }
+            BatchItem item{file->input, file->output};
+            const size_t index = produced++;
+            if (manifest) {
+                std::lock_guard<std::mutex> lock(dispatched_mutex);
+                dispatched.emplace(index, std::move(*file));
+            }
+            return item;
+        };
+
+        ItemCallback on_item;
+        if (manifest) {
+            on_item = [&](size_t index, ItemOutcome outcome) {
+                PendingFile file;
+                {
+                    std::lock_guard<std::mutex> lock(dispatched_mutex);
+                    auto it = dispatched.find(index);
+                    file = std::move(it->second);
+                    dispatched.erase(it);
+                }
+                if (outcome == ItemOutcome::Succeeded) {
+                    record(file, ManifestStatus::Written);
+                } else if (outcome == ItemOutcome::Skipped) {
+                    record(file, ManifestStatus::Clean);
+                }
+            };
+        }
+
+        if (options.recursive || !pending.empty()) {
+            PipelineReport report = run_pipeline(
+                source, remove, engine, options.force_size, options.pipeline_options, options.skip_clean, on_item);
+            result.succeeded = report.succeeded;
+            result.failed = report.failed;
+            result.skipped = report.skipped;
+            result.pipeline = std::move(report);
+        }
+        if (walker.joinable()) {
+            walker.join();
+        }
+        result.unchanged += unchanged.load();
+    } else if (options.recursive) {
+        spdlog::info("Walking {} with {} worker(s)", input_dir.string(), jobs);
+
+        // Listing tasks and processing tasks share the pool: files found by
+        // a worker queue up behind it, idle workers steal directories
+        std::vector<WorkerCounters> counters(jobs);
+        {
+            ThreadPool pool(jobs);
+            walk_tree(pool, input_dir, descend, [&](const fs::path& path, size_t) {
+                if (!is_supported_image(path)) return;
+                pool.submit([&, file = make_pending(path)](size_t worker) mutable {
+                    if (manifest && is_unchanged(*manifest, file)) {
+                        counters[worker].unchanged++;
+                        return;
+                    }
+                    process(file, counters[worker]);
+                });
+            });
+            pool.wait();
+        }
+
+        for (const auto& c : counters) {
+            result.succeeded += c.succeeded;
+            result.failed += c.failed;
+            result.skipped += c.skipped;
+            result.unchanged += c.unchanged;
+        }
+    } else if (!pending.empty()) {
+        jobs = std::min(jobs, pending.size());
+        spdlog::info("Dispatching {} files to {} worker(s)", pending.size(), jobs);
+
+        std::vector<WorkerCounters> counters(jobs);
+        {
+            ThreadPool pool(jobs);
+            for (const auto& file : pending) {
+                pool.submit([&](size_t worker) {
+                    process(file, counters[worker]);
+                });
+            }
+            pool.wait();
+        }
+
+        for (const auto& c : counters) {
+            result.succeeded += c.succeeded;
+            result.failed += c.failed;
+            result.skipped += c.skipped;
+        }
+    }
+
+    if (writer) {
+        writer->close();
+        result.succeeded += written.succeeded;
+        result.failed += written.failed;
+    }
+
+    if (manifest) {
+        manifest->save();
+    }
+    return result;
+}
+
+} // namespace gwt
@@ -0,0 +1,87 @@
+#pragma once
+
+#include "watermark_engine.hpp"
+#include "batch_pipeline.hpp"
+
+#include <cstddef>
+#include <filesystem>
+#include <optional>
+
+namespace gwt {
+
+/**
+ * Batch processing options
+ */
+struct BatchOptions {
+    size_t jobs = 0;                            // Worker threads (0 = hardware concurrency)
+    std::optional<WatermarkSize> force_size;    // Force a specific watermark size
+    bool pipeline = false;                      // Use staged read/blend/encode pipeline
+    PipelineOptions pipeline_options;           // Stage sizing (pipeline mode only) and I/O backend
+    std::optional<double> skip_clean;           // Leave images scoring below this confidence untouched
+    bool incremental = false;                   // Skip inputs unchanged since the last run (batch_manifest.hpp)
+    bool recursive = false;                     // Include subdirectories, mirrored under output_dir
+};
+
+/**
+ * Batch processing outcome
+ */
+struct BatchResult {
+    size_t succeeded = 0;
+    size_t failed = 0;
+    size_t skipped = 0;                         // No watermark detected (--skip-clean)
+    size_t unchanged = 0;                       // Already current per the manifest (--incremental)
+    std::optional<PipelineReport> pipeline;     // Stage statistics (pipeline mode only)
+};
+
+/**
+ * Check whether a file has a supported image extension
+ * (.jpg, .jpeg, .png, .webp, .bmp; case-insensitive)
+ */
+bool is_supported_image(const std::filesystem::path& path);
+
+/**
+ * Process every supported image in a directory (or directory tree)
+ *
+ * Files are dispatched to a work-stealing thread pool; all workers share
+ * the same read-only engine. Each worker keeps its own success/fail
+ * counters, which are merged once the pool drains, so the result does not
+ * depend on scheduling order.
+ *
+ * Workers only encode: an OutputWriter commits the outputs on its own
+ * I/O thread (atomic replace, batched syncs, through io_uring if
+ * options.pipeline_options.io_backend asks for it), and a file counts as
+ * succeeded once it is on disk.
+ *
+ * With options.pipeline set, files flow through run_pipeline() instead.
+ *
+ * With options.skip_clean set, each file's watermark strip is checked
+ * first (is_clean_image()); clean files are neither decoded in full nor
+ * written, so no output file appears for them.
+ *
+ * With options.incremental set, a manifest in output_dir (see
+ * batch_manifest.hpp) is checked by the workers before any processing,
+ * and inputs that are unchanged since the last run with the same settings
+ * are counted as unchanged instead of being processed again.
+ *
+ * With options.recursive set, subdirectories are processed too and each
+ * output lands at the input's relative path under output_dir. The tree is
+ * listed in parallel (walk_tree()) and files are dispatched as they are
+ * found, so the dispatch order is not reproducible. An output_dir inside
+ * input_dir is not walked.
+ *
+ * @param input_dir    Directory containing input images
+ * @param output_dir   Directory receiving processed images (created if missing)
+ * @param remove       Remove watermark (true) or add watermark (false)
+ * @param engine       The watermark engine to use
+ * @param options      Batch options
+ * @return             Merged success/fail/skip counters
+ */
+BatchResult run_batch(
+    const std::filesystem::path& input_dir,
+    const std::filesystem::path& output_dir,
+    bool remove,
+    const WatermarkEngine& engine,
+    const BatchOptions& options = {}
+);
+
+} // namespace gwt
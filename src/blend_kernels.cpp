@@ -0,0 +1,259 @@
+/**
+ * @file    blend_kernels.cpp
+ * @brief   Gemini Watermark Tool - SIMD Alpha Blend Row Kernels
+ * @author  AllenK (Kwyshell)
+ * @date    2026.10.18
+ * @license MIT
+ *
+ * @details
+ * One translation unit holds every instruction-set variant; the x86 ones
+ * are compiled with per-function target attributes so the binary still
+ * runs on a baseline x86-64 CPU and picks the widest kernel at runtime.
+ *
+ * @see https://github.com/allenk/GeminiWatermarkTool
+ */
+
+#include "blend_kernels.hpp"
+
+#include <algorithm>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+    #define GWT_BLEND_X86 1
+    #include <immintrin.h>
+    #ifdef _MSC_VER
+        #include <intrin.h>
+    #endif
+#elif defined(__aarch64__) || defined(_M_ARM64)
+    #define GWT_BLEND_NEON 1
+    #include <arm_neon.h>
+#endif
+
+// MSVC allows any intrinsic anywhere; GCC/Clang need the ISA enabled per function
+#if defined(GWT_BLEND_X86) && !defined(_MSC_VER)
+    #define GWT_TARGET(isa) __attribute__((target(isa)))
+#else
+    #define GWT_TARGET(isa)
+#endif
+
+namespace gwt {
+
+namespace {
+
+inline uint8_t blend_sample(uint8_t value, int32_t scale, int32_t offset) {
+    const int32_t result = (static_cast<int32_t>(value) * scale + offset) >> kBlendShift;
+    return static_cast<uint8_t>(std::clamp(result, 0, 255));
+}
+
+// =============================================================================
+// x86
+// =============================================================================
+
+#ifdef GWT_BLEND_X86
+
+GWT_TARGET("sse4.1")
+void blend_row_sse41(uint8_t* pixels, const int32_t* scale, const int32_t* offset, size_t count) {
+    size_t i = 0;
+    for (; i + 16 <= count; i += 16) {
+        const __m128i in = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pixels + i));
+
+        // _mm_srli_si128 needs an immediate, so the four quarters are spelled out
+        const __m128i quarters[4] = {
+            in, _mm_srli_si128(in, 4), _mm_srli_si128(in, 8), _mm_srli_si128(in, 12),
+        };
+
+        __m128i r[4];
+        for (int k = 0; k < 4; ++k) {
+            const __m128i v = _mm_cvtepu8_epi32(quarters[k]);
+            const __m128i s = _mm_loadu_si128(reinterpret_cast<const __m128i*>(scale + i + 4 * k));
+            const __m128i o = _mm_loadu_si128(reinterpret_cast<const __m128i*>(offset + i + 4 * k));
+            r[k] = _mm_srai_epi32(_mm_add_epi32(_mm_mullo_epi32(v, s), o), kBlendShift);
+        }
+
+        const __m128i lo = _mm_packs_epi32(r[0], r[1]);
+        const __m128i hi = _mm_packs_epi32(r[2], r[3]);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(pixels + i), _mm_packus_epi16(lo, hi));
+    }
+    for (; i < count; ++i) {
+        pixels[i] = blend_sample(pixels[i], scale[i], offset[i]);
+    }
+}
+
+GWT_TARGET("avx2")
+void blend_row_avx2(uint8_t* pixels, const int32_t* scale, const int32_t* offset, size_t count) {
+    // packs/packus work within 128-bit lanes; this restores element order
+    const __m256i order = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+
+    size_t i = 0;
+    for (; i + 32 <= count; i += 32) {
+        __m256i r[4];
+        for (int k = 0; k < 4; ++k) {
+            const __m128i bytes = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(pixels + i + 8 * k));
+            const __m256i v = _mm256_cvtepu8_epi32(bytes);
+            const __m256i s = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(scale + i + 8 * k));
+            const __m256i o = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(offset + i + 8 * k));
+            r[k] = _mm256_srai_epi32(_mm256_add_epi32(_mm256_mullo_epi32(v, s), o), kBlendShift);
+        }
+
+        const __m256i lo = _mm256_packs_epi32(r[0], r[1]);
+        const __m256i hi = _mm256_packs_epi32(r[2], r[3]);
+        const __m256i packed = _mm256_packus_epi16(lo, hi);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(pixels + i),
+                            _mm256_permutevar8x32_epi32(packed, order));
+    }
+    for (; i < count; ++i) {
+        pixels[i] = blend_sample(pixels[i], scale[i], offset[i]);
+    }
+}
+
+GWT_TARGET("avx512f")
+void blend_row_avx512(uint8_t* pixels, const int32_t* scale, const int32_t* offset, size_t count) {
+    const __m512i zero = _mm512_setzero_si512();
+
+    size_t i = 0;
+    for (; i + 16 <= count; i += 16) {
+        const __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pixels + i));
+        const __m512i v = _mm512_cvtepu8_epi32(bytes);
+        const __m512i s = _mm512_loadu_si512(scale + i);
+        const __m512i o = _mm512_loadu_si512(offset + i);
+        const __m512i r = _mm512_srai_epi32(_mm512_add_epi32(_mm512_mullo_epi32(v, s), o), kBlendShift);
+
+        // vpmovusdb saturates as unsigned, so clamp negatives first
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(pixels + i),
+                         _mm512_cvtusepi32_epi8(_mm512_max_epi32(r, zero)));
+    }
+    for (; i < count; ++i) {
+        pixels[i] = blend_sample(pixels[i], scale[i], offset[i]);
+    }
+}
+
+struct X86Features {
+    bool sse41 = false;
+    bool avx2 = false;
+    bool avx512 = false;
+};
+
+X86Features detect_x86() {
+    X86Features f;
+#ifdef _MSC_VER
+    int regs[4];
+    __cpuid(regs, 0);
+    const int max_leaf = regs[0];
+
+    __cpuid(regs, 1);
+    f.sse41 = (regs[2] & (1 << 19)) != 0;
+    const bool osxsave = (regs[2] & (1 << 27)) != 0;
+    const unsigned long long xcr0 = osxsave ? _xgetbv(0) : 0;
+    const bool os_avx = (xcr0 & 0x6) == 0x6;
+    const bool os_avx512 = (xcr0 & 0xE6) == 0xE6;
+
+    if (max_leaf >= 7) {
+        __cpuidex(regs, 7, 0);
+        f.avx2 = os_avx && (regs[1] & (1 << 5)) != 0;
+        f.avx512 = os_avx512 && (regs[1] & (1 << 16)) != 0;
+    }
+#else
+    __builtin_cpu_init();
+    f.sse41 = __builtin_cpu_supports("sse4.1");
+    f.avx2 = __builtin_cpu_supports("avx2");
+    f.avx512 = __builtin_cpu_supports("avx512f");
+#endif
+    return f;
+}
+
+const X86Features& x86_features() {
+    static const X86Features features = detect_x86();
+    return features;
+}
+
+#endif // GWT_BLEND_X86
+
+// =============================================================================
+// ARM
+// =============================================================================
+
+#ifdef GWT_BLEND_NEON
+
+void blend_row_neon(uint8_t* pixels, const int32_t* scale, const int32_t* offset, size_t count) {
+    size_t i = 0;
+    for (; i + 16 <= count; i += 16) {
+        const uint8x16_t in = vld1q_u8(pixels + i);
+        const uint16x8_t lo16 = vmovl_u8(vget_low_u8(in));
+        const uint16x8_t hi16 = vmovl_u8(vget_high_u8(in));
+        const int32x4_t v[4] = {
+            vreinterpretq_s32_u32(vmovl_u16(vget_low_u16(lo16))),
+            vreinterpretq_s32_u32(vmovl_u16(vget_high_u16(lo16))),
+            vreinterpretq_s32_u32(vmovl_u16(vget_low_u16(hi16))),
+            vreinterpretq_s32_u32(vmovl_u16(vget_high_u16(hi16))),
+        };
+
+        int32x4_t r[4];
+        for (int k = 0; k < 4; ++k) {
+            const int32x4_t s = vld1q_s32(scale + i + 4 * k);
+            const int32x4_t o = vld1q_s32(offset + i + 4 * k);
+            r[k] = vshrq_n_s32(vmlaq_s32(o, v[k], s), kBlendShift);
+        }
+
+        const int16x8_t lo = vcombine_s16(vqmovn_s32(r[0]), vqmovn_s32(r[1]));
+        const int16x8_t hi = vcombine_s16(vqmovn_s32(r[2]), vqmovn_s32(r[3]));
+        vst1q_u8(pixels + i, vcombine_u8(vqmovun_s16(lo), vqmovun_s16(hi)));
+    }
+    for (; i < count; ++i) {
+        pixels[i] = blend_sample(pixels[i], scale[i], offset[i]);
+    }
+}
+
+#endif // GWT_BLEND_NEON
+
+} // namespace
+
+void blend_row_scalar(uint8_t* pixels, const int32_t* scale, const int32_t* offset, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        pixels[i] = blend_sample(pixels[i], scale[i], offset[i]);
+    }
+}
+
+BlendRowFn get_blend_kernel(BlendKernel kernel) {
+    switch (kernel) {
+        case BlendKernel::Scalar:
+            return blend_row_scalar;
+#ifdef GWT_BLEND_X86
+        case BlendKernel::SSE41:
+            return x86_features().sse41 ? blend_row_sse41 : nullptr;
+        case BlendKernel::AVX2:
+            return x86_features().avx2 ? blend_row_avx2 : nullptr;
+        case BlendKernel::AVX512:
+            return x86_features().avx512 ? blend_row_avx512 : nullptr;
+#endif
+#ifdef GWT_BLEND_NEON
+        case BlendKernel::NEON:
+            return blend_row_neon;
+#endif
+        default:
+            return nullptr;
+    }
+}
+
+BlendKernel best_blend_kernel() {
+    static const BlendKernel best = [] {
+        for (BlendKernel k : {BlendKernel::AVX512, BlendKernel::AVX2, BlendKernel::SSE41, BlendKernel::NEON}) {
+            if (get_blend_kernel(k) != nullptr) {
+                return k;
+            }
+        }
+        return BlendKernel::Scalar;
+    }();
+    return best;
+}
+
+const char* blend_kernel_name(BlendKernel kernel) {
+    switch (kernel) {
+        case BlendKernel::Scalar: return "scalar";
+        case BlendKernel::SSE41:  return "SSE4.1";
+        case BlendKernel::AVX2:   return "AVX2";
+        case BlendKernel::AVX512: return "AVX-512";
+        case BlendKernel::NEON:   return "NEON";
+    }
+    return "unknown";
+}
+
+} // namespace gwt
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace gwt {
+
+/**
+ * Row kernels for the alpha blend
+ *
+ * Both blend directions reduce to an affine map per 8-bit sample, evaluated
+ * in Q16 fixed point:
+ *
+ *   out[i] = saturate_u8((in[i] * scale[i] + offset[i]) >> 16)
+ *
+ * with the factors expanded per channel and the rounding term folded into
+ * offset (see BlendTable). Pixels outside the watermark get
+ * scale = 1 << 16, offset = 1 << 15, which reproduces them exactly, so the
+ * kernels have no branches. Integer arithmetic is exact, so every kernel
+ * produces bit-identical output.
+ */
+
+enum class BlendKernel {
+    Scalar,
+    SSE41,
+    AVX2,
+    AVX512,
+    NEON,
+};
+
+constexpr int kBlendShift = 16;
+
+using BlendRowFn = void (*)(uint8_t* pixels, const int32_t* scale, const int32_t* offset, size_t count);
+
+/**
+ * Portable reference implementation
+ */
+void blend_row_scalar(uint8_t* pixels, const int32_t* scale, const int32_t* offset, size_t count);
+
+/**
+ * Get a specific kernel
+ *
+ * @return  The kernel, or nullptr if it is not compiled in or the CPU lacks
+ *          the instruction set
+ */
+BlendRowFn get_blend_kernel(BlendKernel kernel);
+
+/**
+ * The fastest kernel supported by this CPU (detected once)
+ */
+BlendKernel best_blend_kernel();
+
+const char* blend_kernel_name(BlendKernel kernel);
+
+} // namespace gwt
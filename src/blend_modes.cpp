@@ -1,5 +1,7 @@
 #include "blend_modes.hpp"
+#include "blend_kernels.hpp"
 #include <opencv2/imgproc.hpp>
+#include <vector>
 
 namespace gwt {
 
@@ -30,147 +32,189 @@ cv::Mat calculate_alpha_map(const cv::Mat& bg_capture) {
     return alpha_map;
 }
 
-void remove_watermark_alpha_blend(
-    cv::Mat& image,
+cv::Mat resample_alpha_map(
     const cv::Mat& alpha_map,
-    const cv::Point& position,
-    float logo_value ) {
-    CV_Assert(!image.empty() && !alpha_map.empty());
-    CV_Assert(image.channels() == 3);
-    CV_Assert(alpha_map.type() == CV_32FC1);
-
-    // Calculate region of interest
-    int x = position.x;
-    int y = position.y;
-    int w = alpha_map.cols;
-    int h = alpha_map.rows;
-
-    // Clip to image bounds
-    int x1 = std::max(0, x);
-    int y1 = std::max(0, y);
-    int x2 = std::min(image.cols, x + w);
-    int y2 = std::min(image.rows, y + h);
-
-    if (x1 >= x2 || y1 >= y2) return;
-
-    // Get ROIs
-    cv::Rect alpha_roi(x1 - x, y1 - y, x2 - x1, y2 - y1);
-    cv::Rect image_roi(x1, y1, x2 - x1, y2 - y1);
-
-    cv::Mat alpha_region = alpha_map(alpha_roi);
-    cv::Mat image_region = image(image_roi);
+    const cv::Size2d& logo_size,
+    const cv::Point2d& phase) {
+    CV_Assert(!alpha_map.empty() && alpha_map.type() == CV_32FC1);
+    CV_Assert(logo_size.width > 0.0 && logo_size.height > 0.0);
+
+    const int cols = std::max(1, static_cast<int>(std::ceil(phase.x + logo_size.width - 1e-6)));
+    const int rows = std::max(1, static_cast<int>(std::ceil(phase.y + logo_size.height - 1e-6)));
+
+    // Sample on a grid about as fine as the source map, then box-filter down
+    const double sx = logo_size.width / alpha_map.cols;
+    const double sy = logo_size.height / alpha_map.rows;
+    const int supersample = std::max(1, static_cast<int>(std::ceil(1.0 / std::min(sx, sy))));
+
+    // Inverse map, pixel centers: src = ((dst + 0.5) / supersample - phase) / s - 0.5
+    cv::Mat inverse = cv::Mat::zeros(2, 3, CV_64F);
+    inverse.at<double>(0, 0) = 1.0 / (sx * supersample);
+    inverse.at<double>(0, 2) = (0.5 / supersample - phase.x) / sx - 0.5;
+    inverse.at<double>(1, 1) = 1.0 / (sy * supersample);
+    inverse.at<double>(1, 2) = (0.5 / supersample - phase.y) / sy - 0.5;
+
+    cv::Mat fine;
+    cv::warpAffine(alpha_map, fine, inverse, cv::Size(cols * supersample, rows * supersample),
+                   cv::INTER_LINEAR | cv::WARP_INVERSE_MAP, cv::BORDER_CONSTANT, cv::Scalar(0));
+    if (supersample == 1) {
+        return fine;
+    }
 
-    // Convert image to float
-    cv::Mat image_f;
-    image_region.convertTo(image_f, CV_32FC3);
+    cv::Mat resampled;
+    cv::resize(fine, resampled, cv::Size(cols, rows), 0, 0, cv::INTER_AREA);
+    return resampled;
+}
 
-    // Apply reverse alpha blending
-    //
-    // Gemini applies: watermarked = alpha * logo + (1 - alpha) * original
-    // We reverse:     original = (watermarked - alpha * logo) / (1 - alpha)
-    //
-    // Special cases:
-    //   - alpha = 0: no watermark effect, pixel unchanged
-    //   - alpha → 1: unstable, clamp result
+namespace {
 
-    const float alpha_threshold = 0.002f;  // Ignore very small alpha (noise)
-    const float max_alpha = 0.99f;         // Avoid division by near-zero
+const float alpha_threshold = 0.002f;  // Ignore very small alpha (noise)
+const float max_alpha = 0.99f;         // Avoid division by near-zero
 
-    for (int row = 0; row < image_f.rows; ++row) {
-        const float* alpha_ptr = alpha_region.ptr<float>(row);
-        cv::Vec3f* img_ptr = image_f.ptr<cv::Vec3f>(row);
+constexpr double kFixedOne = double(1 << kBlendShift);
+constexpr int32_t kRoundBias = 1 << (kBlendShift - 1);
 
-        for (int col = 0; col < image_f.cols; ++col) {
-            float alpha = alpha_ptr[col];
+} // namespace
 
-            // Skip pixels with negligible watermark effect
-            if (alpha < alpha_threshold) {
-                continue;
+BlendTable make_blend_table(
+    const cv::Mat& alpha_map,
+    BlendDirection direction,
+    float logo_value,
+    int channels) {
+    CV_Assert(!alpha_map.empty() && alpha_map.type() == CV_32FC1);
+    // Keeps 255 * scale + offset within int32 (scale <= 100 in Q16)
+    CV_Assert(logo_value >= 0.0f && logo_value <= 255.0f);
+
+    const size_t pixels = alpha_map.total();
+    std::vector<int32_t> pixel_scale(pixels);
+    std::vector<int32_t> pixel_offset(pixels);
+
+    for (int row = 0; row < alpha_map.rows; ++row) {
+        const float* alpha_ptr = alpha_map.ptr<float>(row);
+        int32_t* scale_ptr = pixel_scale.data() + size_t(row) * alpha_map.cols;
+        int32_t* offset_ptr = pixel_offset.data() + size_t(row) * alpha_map.cols;
+
+        for (int col = 0; col < alpha_map.cols; ++col) {
+            double alpha = alpha_ptr[col];
+            double scale = 1.0;
+            double offset = 0.0;
+
+            // Pixels with negligible watermark effect map to themselves
+            if (alpha >= alpha_threshold) {
+                if (direction == BlendDirection::Remove) {
+                    // original = (watermarked - alpha * logo) / (1 - alpha)
+                    // Clamp alpha to avoid division issues
+                    alpha = std::min(alpha, double(max_alpha));
+                    scale = 1.0 / (1.0 - alpha);
+                    offset = -alpha * logo_value * scale;
+                } else {
+                    // result = alpha * logo + (1 - alpha) * original
+                    scale = 1.0 - alpha;
+                    offset = alpha * logo_value;
+                }
             }
 
-            // Clamp alpha to avoid division issues
-            alpha = std::min(alpha, max_alpha);
-            float one_minus_alpha = 1.0f - alpha;
+            scale_ptr[col] = static_cast<int32_t>(std::lround(scale * kFixedOne));
+            offset_ptr[col] = static_cast<int32_t>(std::lround(offset * kFixedOne)) + kRoundBias;
+        }
+    }
 
-            // Reverse the blending for each channel
-            for (int c = 0; c < 3; ++c) {
-                float watermarked = img_ptr[col][c];
-                float original = (watermarked - alpha * logo_value) / one_minus_alpha;
-                img_ptr[col][c] = std::clamp(original, 0.0f, 255.0f);
-            }
+    return make_blend_table(pixel_scale.data(), pixel_offset.data(),
+                            alpha_map.cols, alpha_map.rows, channels);
+}
+
+BlendTable make_blend_table(
+    const int32_t* pixel_scale,
+    const int32_t* pixel_offset,
+    int width,
+    int height,
+    int channels) {
+    CV_Assert(pixel_scale != nullptr && pixel_offset != nullptr && width > 0 && height > 0);
+    CV_Assert(channels == 1 || channels == 3 || channels == 4);
+
+    // Color samples are blended; a fourth (alpha) sample keeps the identity
+    const int color_channels = std::min(channels, 3);
+    const int32_t identity_scale = 1 << kBlendShift;
+
+    BlendTable table;
+    table.width = width;
+    table.height = height;
+    table.channels = channels;
+    table.scale.resize(table.row_samples() * table.height);
+    table.offset.resize(table.scale.size());
+
+    const size_t pixels = size_t(width) * height;
+    for (size_t i = 0; i < pixels; ++i) {
+        int32_t* scale_ptr = table.scale.data() + i * channels;
+        int32_t* offset_ptr = table.offset.data() + i * channels;
+        for (int c = 0; c < channels; ++c) {
+            const bool color = c < color_channels;
+            scale_ptr[c] = color ? pixel_scale[i] : identity_scale;
+            offset_ptr[c] = color ? pixel_offset[i] : kRoundBias;
         }
     }
 
-    // Convert back to 8-bit
-    cv::Mat result;
-    image_f.convertTo(result, CV_8UC3);
-    result.copyTo(image_region);
+    return table;
 }
 
-void add_watermark_alpha_blend(
+void apply_blend_table(
     cv::Mat& image,
-    const cv::Mat& alpha_map,
-    const cv::Point& position,
-    float logo_value ) {
-    CV_Assert(!image.empty() && !alpha_map.empty());
-    CV_Assert(image.channels() == 3);
-    CV_Assert(alpha_map.type() == CV_32FC1);
-
-    // Calculate region of interest
-    int x = position.x;
-    int y = position.y;
-    int w = alpha_map.cols;
-    int h = alpha_map.rows;
+    const BlendTable& table,
+    const cv::Point& position) {
+    CV_Assert(!image.empty() && !table.empty());
+    CV_Assert(image.type() == CV_8UC(table.channels));
 
     // Clip to image bounds
-    int x1 = std::max(0, x);
-    int y1 = std::max(0, y);
-    int x2 = std::min(image.cols, x + w);
-    int y2 = std::min(image.rows, y + h);
+    int x1 = std::max(0, position.x);
+    int y1 = std::max(0, position.y);
+    int x2 = std::min(image.cols, position.x + table.width);
+    int y2 = std::min(image.rows, position.y + table.height);
 
     if (x1 >= x2 || y1 >= y2) return;
 
-    // Get ROIs
-    cv::Rect alpha_roi(x1 - x, y1 - y, x2 - x1, y2 - y1);
-    cv::Rect image_roi(x1, y1, x2 - x1, y2 - y1);
-
-    cv::Mat alpha_region = alpha_map(alpha_roi);
-    cv::Mat image_region = image(image_roi);
-
-    // Convert image to float
-    cv::Mat image_f;
-    image_region.convertTo(image_f, CV_32FC3);
-
-    // Apply alpha blending (same as Gemini)
-    // Formula: result = alpha * logo + (1 - alpha) * original
+    static const BlendRowFn kernel = get_blend_kernel(best_blend_kernel());
 
-    const float alpha_threshold = 0.002f;
+    const int channels = table.channels;
+    const size_t table_col = size_t(x1 - position.x) * channels;
+    const size_t count = size_t(x2 - x1) * channels;
 
-    for (int row = 0; row < image_f.rows; ++row) {
-        const float* alpha_ptr = alpha_region.ptr<float>(row);
-        cv::Vec3f* img_ptr = image_f.ptr<cv::Vec3f>(row);
-
-        for (int col = 0; col < image_f.cols; ++col) {
-            float alpha = alpha_ptr[col];
+    for (int y = y1; y < y2; ++y) {
+        const int table_row = y - position.y;
+        uint8_t* pixels = image.ptr<uint8_t>(y) + size_t(x1) * channels;
+        kernel(pixels,
+               table.scale_row(table_row) + table_col,
+               table.offset_row(table_row) + table_col,
+               count);
+    }
+}
 
-            if (alpha < alpha_threshold) {
-                continue;
-            }
+void remove_watermark_alpha_blend(
+    cv::Mat& image,
+    const cv::Mat& alpha_map,
+    const cv::Point& position,
+    float logo_value ) {
+    CV_Assert(!image.empty() && !alpha_map.empty());
+    CV_Assert(image.depth() == CV_8U);
+    CV_Assert(alpha_map.type() == CV_32FC1);
 
-            float one_minus_alpha = 1.0f - alpha;
+    // One-off table; WatermarkEngine keeps its tables precomputed
+    apply_blend_table(image,
+                      make_blend_table(alpha_map, BlendDirection::Remove, logo_value, image.channels()),
+                      position);
+}
 
-            for (int c = 0; c < 3; ++c) {
-                float original = img_ptr[col][c];
-                float result = alpha * logo_value + one_minus_alpha * original;
-                img_ptr[col][c] = std::clamp(result, 0.0f, 255.0f);
-            }
-        }
-    }
+void add_watermark_alpha_blend(
+    cv::Mat& image,
+    const cv::Mat& alpha_map,
+    const cv::Point& position,
+    float logo_value ) {
+    CV_Assert(!image.empty() && !alpha_map.empty());
+    CV_Assert(image.depth() == CV_8U);
+    CV_Assert(alpha_map.type() == CV_32FC1);
 
-    // Convert back to 8-bit
-    cv::Mat result;
-    image_f.convertTo(result, CV_8UC3);
-    result.copyTo(image_region);
+    apply_blend_table(image,
+                      make_blend_table(alpha_map, BlendDirection::Add, logo_value, image.channels()),
+                      position);
 }
 
 } // namespace gwt
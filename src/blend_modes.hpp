@@ -3,6 +3,8 @@
 #include <opencv2/core.hpp>
 #include <algorithm>
 #include <cmath>
+#include <cstdint>
+#include <vector>
 
 namespace gwt {
 
@@ -16,6 +18,10 @@ namespace gwt {
  *
  * To remove watermark:
  *   original = (watermarked - alpha * logo) / (1 - alpha)
+ *
+ * Both directions are evaluated directly on the 8-bit rows by the SIMD
+ * kernels in blend_kernels.hpp (selected at runtime), using fixed-point
+ * factors precomputed once per alpha map (BlendTable).
  */
 
 // ============================================================================
@@ -30,6 +36,105 @@ namespace gwt {
  */
 cv::Mat calculate_alpha_map(const cv::Mat& bg_capture);
 
+/**
+ * Resample an alpha map to the footprint of a scaled watermark
+ *
+ * Models a watermarked image that was resized afterwards: the logo covers
+ * logo_size output pixels and starts at a fractional offset (phase, each
+ * component in [0, 1)) inside the returned map. Each output pixel is the
+ * mean of the scaled map over that pixel (box filter, like INTER_AREA),
+ * so downscaled logos keep their soft edges.
+ *
+ * @param alpha_map  Alpha map from calculate_alpha_map()
+ * @param logo_size  Logo width and height in output pixels (> 0; they
+ *                   differ when the aspect ratio was changed)
+ * @param phase      Sub-pixel offset of the logo's top-left corner
+ * @return           Alpha map (CV_32FC1) of ceil(phase + logo_size) pixels
+ */
+cv::Mat resample_alpha_map(
+    const cv::Mat& alpha_map,
+    const cv::Size2d& logo_size,
+    const cv::Point2d& phase = cv::Point2d()
+);
+
+// ============================================================================
+// Precomputed Blend Tables
+// ============================================================================
+
+enum class BlendDirection {
+    Remove,     // original = (watermarked - alpha * logo) / (1 - alpha)
+    Add,        // result = alpha * logo + (1 - alpha) * original
+};
+
+/**
+ * Per-pixel blend factors for one alpha map, in Q16 fixed point
+ *
+ * Each sample becomes out = (in * scale + offset) >> 16, with the rounding
+ * term already folded into offset. Factors are stored per sample
+ * (width * channels per row) so a row maps directly onto gray, BGR or BGRA
+ * bytes; alpha samples get the identity factors and pass through unchanged.
+ */
+struct BlendTable {
+    int width = 0;
+    int height = 0;
+    int channels = 3;           // 1 (gray), 3 (BGR) or 4 (BGRA)
+    std::vector<int32_t> scale;
+    std::vector<int32_t> offset;
+
+    bool empty() const { return width == 0 || height == 0; }
+    size_t row_samples() const { return size_t(width) * channels; }
+    const int32_t* scale_row(int row) const { return scale.data() + size_t(row) * row_samples(); }
+    const int32_t* offset_row(int row) const { return offset.data() + size_t(row) * row_samples(); }
+};
+
+/**
+ * Precompute the blend factors for an alpha map
+ *
+ * @param alpha_map   Alpha map from calculate_alpha_map()
+ * @param direction   Remove or add the watermark
+ * @param logo_value  The logo color value, 0-255 (default: 255 = white)
+ * @param channels    Layout of the images the table is applied to:
+ *                    1 (gray), 3 (BGR) or 4 (BGRA)
+ */
+BlendTable make_blend_table(
+    const cv::Mat& alpha_map,
+    BlendDirection direction,
+    float logo_value = 255.0f,
+    int channels = 3
+);
+
+/**
+ * Expand per-pixel blend factors into a table for a channel layout
+ *
+ * Used for factors computed ahead of time (see embedded_alpha_maps.hpp).
+ *
+ * @param pixel_scale   Q16 scale per pixel, row-major (width * height)
+ * @param pixel_offset  Q16 offset per pixel, rounding term included
+ * @param width         Map width in pixels
+ * @param height        Map height in pixels
+ * @param channels      1 (gray), 3 (BGR) or 4 (BGRA)
+ */
+BlendTable make_blend_table(
+    const int32_t* pixel_scale,
+    const int32_t* pixel_offset,
+    int width,
+    int height,
+    int channels = 3
+);
+
+/**
+ * Apply a precomputed blend table to an image region
+ *
+ * @param image     The image to modify (8-bit, table.channels channels)
+ * @param table     Table from make_blend_table()
+ * @param position  Top-left position of watermark region (may be partly outside)
+ */
+void apply_blend_table(
+    cv::Mat& image,
+    const BlendTable& table,
+    const cv::Point& position
+);
+
 // ============================================================================
 // Watermark Removal (Reverse Alpha Blending)
 // ============================================================================
@@ -42,7 +147,7 @@ cv::Mat calculate_alpha_map(const cv::Mat& bg_capture);
  * Where alpha = 0, the pixel is unchanged (no watermark effect)
  * Where alpha > 0, we reverse the blending to restore original
  *
- * @param image          The image to modify (BGR, 8-bit)
+ * @param image          The image to modify (gray, BGR or BGRA, 8-bit)
  * @param alpha_map      Alpha map from calculate_alpha_map()
  * @param position       Top-left position of watermark region
  * @param logo_value     The logo color value (default: 255 = white)
@@ -63,7 +168,7 @@ void remove_watermark_alpha_blend(
  *
  * Formula: result = alpha * logo + (1 - alpha) * original
  *
- * @param image          The image to modify (BGR, 8-bit)
+ * @param image          The image to modify (gray, BGR or BGRA, 8-bit)
  * @param alpha_map      Alpha map from calculate_alpha_map()
  * @param position       Top-left position of watermark region
  * @param logo_value     The logo color value (default: 255 = white)
@@ -0,0 +1,130 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <optional>
+
+namespace gwt {
+
+/**
+ * Occupancy and stall statistics of a BoundedQueue
+ */
+struct QueueStats {
+    size_t capacity = 0;
+    size_t max_depth = 0;       // Highest depth observed after a push
+    double avg_depth = 0.0;     // Mean depth observed after a push
+    double push_wait = 0.0;     // Seconds producers spent blocked on a full queue
+    double pop_wait = 0.0;      // Seconds consumers spent waiting on an empty queue
+};
+
+/**
+ * Multi-producer / multi-consumer FIFO with a fixed capacity
+ *
+ * push() blocks while the queue is full, pop() blocks while it is empty.
+ * close() wakes everybody up: further pushes fail and pop() returns
+ * nullopt once the remaining items are drained.
+ */
+template <typename T>
+class BoundedQueue {
+public:
+    explicit BoundedQueue(size_t capacity)
+        : capacity_(capacity > 0 ? capacity : 1) {}
+
+    bool push(T item) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        if (items_.size() >= capacity_ && !closed_) {
+            auto start = std::chrono::steady_clock::now();
+            not_full_.wait(lock, [this] { return items_.size() < capacity_ || closed_; });
+            push_wait_ += std::chrono::steady_clock::now() - start;
+        }
+        if (closed_) {
+            return false;
+        }
+
+        items_.push_back(std::move(item));
+        max_depth_ = std::max(max_depth_, items_.size());
+        depth_sum_ += items_.size();
+        push_count_++;
+
+        lock.unlock();
+        not_empty_.notify_one();
+        return true;
+    }
+
+    std::optional<T> pop() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        if (items_.empty() && !closed_) {
+            auto start = std::chrono::steady_clock::now();
+            not_empty_.wait(lock, [this] { return !items_.empty() || closed_; });
+            pop_wait_ += std::chrono::steady_clock::now() - start;
+        }
+        if (items_.empty()) {
+            return std::nullopt;
+        }
+
+        T item = std::move(items_.front());
+        items_.pop_front();
+
+        lock.unlock();
+        not_full_.notify_one();
+        return item;
+    }
+
+    /**
+     * Pop without waiting; nullopt if the queue is empty right now
+     */
+    std::optional<T> try_pop() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        if (items_.empty()) {
+            return std::nullopt;
+        }
+
+        T item = std::move(items_.front());
+        items_.pop_front();
+
+        lock.unlock();
+        not_full_.notify_one();
+        return item;
+    }
+
+    void close() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            closed_ = true;
+        }
+        not_full_.notify_all();
+        not_empty_.notify_all();
+    }
+
+    QueueStats stats() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        QueueStats s;
+        s.capacity = capacity_;
+        s.max_depth = max_depth_;
+        s.avg_depth = push_count_ > 0 ? static_cast<double>(depth_sum_) / push_count_ : 0.0;
+        s.push_wait = std::chrono::duration<double>(push_wait_).count();
+        s.pop_wait = std::chrono::duration<double>(pop_wait_).count();
+        return s;
+    }
+
+private:
+    mutable std::mutex mutex_;
+    std::condition_variable not_full_;
+    std::condition_variable not_empty_;
+    std::deque<T> items_;
+    size_t capacity_;
+    bool closed_ = false;
+
+    size_t max_depth_ = 0;
+    uint64_t depth_sum_ = 0;
+    uint64_t push_count_ = 0;
+    std::chrono::steady_clock::duration push_wait_{0};
+    std::chrono::steady_clock::duration pop_wait_{0};
+};
+
+} // namespace gwt
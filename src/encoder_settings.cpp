@@ -0,0 +1,147 @@
+/**
+ * @file    encoder_settings.cpp
+ * @brief   Gemini Watermark Tool - Encoder Profiles
+ * @author  AllenK (Kwyshell)
+ * @date    2026.10.18
+ * @license MIT
+ *
+ * @details
+ * The historical settings sit at the slow end of every encoder: JPEG
+ * quality 100, zlib level 6 and lossless WebP. Where outputs are
+ * thumbnails or intermediates, encoding then dominates the run; the
+ * profiles trade size (and, for JPEG/WebP, some fidelity) for speed
+ * without having to know each encoder's knobs.
+ *
+ * @see https://github.com/allenk/GeminiWatermarkTool
+ */
+
+#include "encoder_settings.hpp"
+
+#include <fmt/core.h>
+
+#include <algorithm>
+
+namespace gwt {
+
+namespace {
+
+EncoderSettings g_settings;
+
+const char* subsampling_name(ChromaSubsampling subsampling) {
+    switch (subsampling) {
+        case ChromaSubsampling::Auto: return "auto";
+        case ChromaSubsampling::S444: return "444";
+        case ChromaSubsampling::S422: return "422";
+        case ChromaSubsampling::S420: return "420";
+    }
+    return "auto";
+}
+
+const char* strategy_name(PngStrategy strategy) {
+    switch (strategy) {
+        case PngStrategy::Default:     return "default";
+        case PngStrategy::Filtered:    return "filtered";
+        case PngStrategy::HuffmanOnly: return "huffman";
+        case PngStrategy::Rle:         return "rle";
+        case PngStrategy::Fixed:       return "fixed";
+    }
+    return "default";
+}
+
+} // namespace
+
+EncoderSettings encoder_profile(EncodeProfile profile) {
+    EncoderSettings s;
+    s.profile = profile;
+    switch (profile) {
+        case EncodeProfile::Default:
+            break;
+        case EncodeProfile::Fast:
+            // Baseline JPEG with the standard tables, zlib's quickest
+            // matcher, and the single-pass WebP encoder
+            s.jpeg = {85, ChromaSubsampling::S420, false, false};
+            s.png = {1, PngStrategy::Rle};
+            s.webp = {80, 0};
+            break;
+        case EncodeProfile::Balanced:
+            s.jpeg = {92, ChromaSubsampling::S420, true, false};
+            s.png = {4, PngStrategy::Default};
+            s.webp = {90, 4};
+            break;
+        case EncodeProfile::Archival:
+            s.jpeg = {100, ChromaSubsampling::S444, true, false};
+            s.png = {9, PngStrategy::Default};
+            s.webp = {101, 6};
+            break;
+    }
+    return s;
+}
+
+const char* encode_profile_name(EncodeProfile profile) {
+    switch (profile) {
+        case EncodeProfile::Default:  return "default";
+        case EncodeProfile::Fast:     return "fast";
+        case EncodeProfile::Balanced: return "balanced";
+        case EncodeProfile::Archival: return "archival";
+    }
+    return "default";
+}
+
+std::optional<EncodeProfile> parse_encode_profile(const std::string& name) {
+    for (EncodeProfile profile : {EncodeProfile::Default, EncodeProfile::Fast,
+                                  EncodeProfile::Balanced, EncodeProfile::Archival}) {
+        if (name == encode_profile_name(profile)) {
+            return profile;
+        }
+    }
+    return std::nullopt;
+}
+
+std::optional<ChromaSubsampling> parse_chroma_subsampling(const std::string& name) {
+    std::string compact = name;
+    compact.erase(std::remove(compact.begin(), compact.end(), ':'), compact.end());
+    for (ChromaSubsampling subsampling : {ChromaSubsampling::Auto, ChromaSubsampling::S444,
+                                          ChromaSubsampling::S422, ChromaSubsampling::S420}) {
+        if (compact == subsampling_name(subsampling)) {
+            return subsampling;
+        }
+    }
+    return std::nullopt;
+}
+
+std::optional<PngStrategy> parse_png_strategy(const std::string& name) {
+    for (PngStrategy strategy : {PngStrategy::Default, PngStrategy::Filtered, PngStrategy::HuffmanOnly,
+                                 PngStrategy::Rle, PngStrategy::Fixed}) {
+        if (name == strategy_name(strategy)) {
+            return strategy;
+        }
+    }
+    return std::nullopt;
+}
+
+std::string describe_encoder_settings(const EncoderSettings& settings) {
+    const JpegSettings& jpeg = settings.jpeg;
+    std::string jpeg_flags;
+    if (jpeg.optimize) jpeg_flags += "/opt";
+    if (jpeg.progressive) jpeg_flags += "/prog";
+
+    const std::string webp = settings.webp.quality > 100
+        ? fmt::format("lossless/m{}", settings.webp.method)
+        : fmt::format("q{}/m{}", settings.webp.quality, settings.webp.method);
+
+    return fmt::format("{} jpeg=q{}/{}{} png={}/{} webp={} source={}",
+                       encode_profile_name(settings.profile),
+                       jpeg.quality, subsampling_name(jpeg.subsampling), jpeg_flags,
+                       settings.png.level, strategy_name(settings.png.strategy), webp,
+                       settings.preserve_source ? "keep" : "ignore");
+}
+
+void set_encoder_settings(const EncoderSettings& settings) {
+    g_settings = settings;
+}
+
+const EncoderSettings& encoder_settings() {
+    return g_settings;
+}
+
+} // namespace gwt
@@ -0,0 +1,113 @@
+#pragma once
+
+#include <optional>
+#include <string>
+
+namespace gwt {
+
+/**
+ * Named encoder presets (--profile)
+ *
+ *   default   JPEG q100, PNG level 6, lossless WebP (the historical settings)
+ *   fast      JPEG q85 4:2:0, PNG level 1 RLE, lossy WebP q80 method 0
+ *   balanced  JPEG q92 4:2:0 optimized, PNG level 4, lossy WebP q90 method 4
+ *   archival  JPEG q100 4:4:4 optimized, PNG level 9, lossless WebP method 6
+ */
+enum class EncodeProfile {
+    Default,
+    Fast,
+    Balanced,
+    Archival,
+};
+
+/**
+ * JPEG chroma subsampling
+ */
+enum class ChromaSubsampling {
+    Auto,       // Encoder default (4:2:0 with libjpeg)
+    S444,
+    S422,
+    S420,
+};
+
+/**
+ * zlib strategy for PNG output
+ */
+enum class PngStrategy {
+    Default,
+    Filtered,
+    HuffmanOnly,
+    Rle,
+    Fixed,
+};
+
+struct JpegSettings {
+    int quality = 100;                                  // 1-100
+    ChromaSubsampling subsampling = ChromaSubsampling::Auto;
+    bool optimize = false;                              // Optimized Huffman tables
+    bool progressive = false;
+};
+
+struct PngSettings {
+    int level = 6;                                      // zlib level 0-9
+    PngStrategy strategy = PngStrategy::Default;
+};
+
+struct WebpSettings {
+    int quality = 101;                                  // 1-100 lossy, 101 lossless
+    int method = 4;                                     // 0 (fastest) - 6 (smallest); other than 4 needs libwebp
+};
+
+/**
+ * Everything that controls how processed images are encoded
+ */
+struct EncoderSettings {
+    EncodeProfile profile = EncodeProfile::Default;
+    JpegSettings jpeg;
+    PngSettings png;
+    WebpSettings webp;
+    bool preserve_source = true;                        // Follow the input's JPEG quality/subsampling, keep ICC + EXIF
+};
+
+/**
+ * The settings of a named profile
+ */
+EncoderSettings encoder_profile(EncodeProfile profile);
+
+const char* encode_profile_name(EncodeProfile profile);
+
+/**
+ * Parse "default", "fast", "balanced" or "archival"
+ */
+std::optional<EncodeProfile> parse_encode_profile(const std::string& name);
+
+/**
+ * Parse "auto", "444", "422" or "420" (colons allowed: "4:2:0")
+ */
+std::optional<ChromaSubsampling> parse_chroma_subsampling(const std::string& name);
+
+/**
+ * Parse "default", "filtered", "huffman", "rle" or "fixed"
+ */
+std::optional<PngStrategy> parse_png_strategy(const std::string& name);
+
+/**
+ * One-line summary, e.g. "fast jpeg=q85/420 png=1/rle webp=q80/m0 source=keep";
+ * identifies the settings in logs and batch manifests
+ */
+std::string describe_encoder_settings(const EncoderSettings& settings);
+
+/**
+ * Replace the process-wide settings used by encode_image() and the PNG
+ * patch fast path
+ *
+ * Not synchronized with encoding: set them before processing starts.
+ */
+void set_encoder_settings(const EncoderSettings& settings);
+
+/**
+ * The process-wide settings (encoder_profile(EncodeProfile::Default) until set)
+ */
+const EncoderSettings& encoder_settings();
+
+} // namespace gwt
@@ -0,0 +1,318 @@
+/**
+ * @file    file_loader.cpp
+ * @brief   Gemini Watermark Tool - Input Prefetch
+ * @author  AllenK (Kwyshell)
+ * @date    2026.10.18
+ * @license MIT
+ *
+ * @details
+ * With many decode threads each blocking in open()/read() on its own
+ * input, the device sees at most one request per thread and every thread
+ * pays the syscalls. The io_uring loader keeps a fixed number of files in
+ * flight from one thread instead: each slot walks open -> fstat -> read
+ * (repeated for short reads) -> close, and the next file is started in a
+ * slot as soon as the previous one has been delivered.
+ *
+ * @see https://github.com/allenk/GeminiWatermarkTool
+ */
+
+#include "file_loader.hpp"
+#include "stage_stats.hpp"
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <chrono>
+#include <string>
+
+#ifdef _WIN32
+#include <fstream>
+#else
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace gwt {
+
+namespace {
+
+// Largest single read request (Linux caps reads just below 2 GiB anyway)
+constexpr size_t kMaxReadChunk = size_t{1} << 30;
+
+#ifdef _WIN32
+
+bool read_whole_file(const std::filesystem::path& path, std::vector<unsigned char>& buffer) {
+    std::ifstream in(path, std::ios::binary | std::ios::ate);
+    if (!in) {
+        return false;
+    }
+    const std::streamsize size = in.tellg();
+    if (size < 0) {
+        return false;
+    }
+    in.seekg(0, std::ios::beg);
+    buffer.resize(static_cast<size_t>(size));
+    return static_cast<bool>(in.read(reinterpret_cast<char*>(buffer.data()), size));
+}
+
+#else
+
+bool read_whole_file(const std::filesystem::path& path, std::vector<unsigned char>& buffer) {
+    const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return false;
+    }
+    struct stat st;
+    if (::fstat(fd, &st) != 0) {
+        ::close(fd);
+        return false;
+    }
+
+    buffer.resize(static_cast<size_t>(st.st_size));
+    size_t got = 0;
+    while (got < buffer.size()) {
+        const ssize_t n = ::read(fd, buffer.data() + got, std::min(buffer.size() - got, kMaxReadChunk));
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            ::close(fd);
+            return false;
+        }
+        if (n == 0) break;  // Truncated since fstat
+        got += static_cast<size_t>(n);
+    }
+    buffer.resize(got);
+    ::close(fd);
+    return true;
+}
+
+#endif
+
+} // namespace
+
+FileLoader::FileLoader(IoBackend backend, size_t in_flight)
+    : backend_(backend),
+      in_flight_(std::max<size_t>(in_flight, 1)) {
+    if (backend_ == IoBackend::IoUring && !io_uring_available()) {
+        spdlog::warn("io_uring is not available, using POSIX file I/O");
+        backend_ = IoBackend::Posix;
+    }
+}
+
+void FileLoader::run(const LoadSource& next, const LoadSink& deliver) {
+    if (backend_ == IoBackend::IoUring) {
+        run_ring(next, deliver);
+    } else {
+        run_posix(next, deliver);
+    }
+}
+
+void FileLoader::recycle(std::vector<unsigned char>&& buffer) {
+    if (buffer.capacity() == 0) {
+        return;
+    }
+    buffer.clear();
+    std::lock_guard<std::mutex> lock(spare_mutex_);
+    // Enough for every slot plus as many again waiting downstream
+    if (spare_.size() < 2 * in_flight_) {
+        spare_.push_back(std::move(buffer));
+    }
+}
+
+std::vector<unsigned char> FileLoader::take_buffer() {
+    std::lock_guard<std::mutex> lock(spare_mutex_);
+    if (spare_.empty()) {
+        return {};
+    }
+    std::vector<unsigned char> buffer = std::move(spare_.back());
+    spare_.pop_back();
+    return buffer;
+}
+
+void FileLoader::run_posix(const LoadSource& next, const LoadSink& deliver) {
+    while (auto request = next()) {
+        LoadedFile file;
+        file.request = std::move(*request);
+        file.data = take_buffer();
+        {
+            ScopedStageTimer timer(Stage::Read);
+            file.ok = read_whole_file(file.request.path, file.data);
+        }
+        if (!deliver(std::move(file))) break;
+    }
+}
+
+#ifdef GWT_HAVE_IO_URING
+
+void FileLoader::run_ring(const LoadSource& next, const LoadSink& deliver) {
+    using Clock = std::chrono::steady_clock;
+
+    enum class Phase { Idle, Open, Read, Close };
+
+    struct Slot {
+        Phase phase = Phase::Idle;
+        LoadedFile file;
+        std::string path;       // NUL-terminated copy the open reads from
+        int fd = -1;
+        size_t got = 0;
+        Clock::time_point start;
+    };
+
+    // Each slot has at most one operation outstanding, so the ring never fills
+    IoRing ring(static_cast<unsigned>(in_flight_));
+    if (!ring.ready()) {
+        spdlog::warn("io_uring setup failed ({}), using POSIX file I/O", std::strerror(errno));
+        run_posix(next, deliver);
+        return;
+    }
+
+    std::vector<Slot> slots(in_flight_);
+    size_t active = 0;
+    bool accepting = true;
+
+    auto start_slot = [&](size_t tag) {
+        Slot& slot = slots[tag];
+        auto request = accepting ? next() : std::nullopt;
+        if (!request) {
+            accepting = false;
+            slot.phase = Phase::Idle;
+            return;
+        }
+        slot.file = LoadedFile{std::move(*request), take_buffer(), false};
+        slot.path = slot.file.request.path.string();
+        slot.fd = -1;
+        slot.got = 0;
+        slot.start = Clock::now();
+        slot.phase = Phase::Open;
+        ring.openat(slot.path.c_str(), O_RDONLY | O_CLOEXEC, 0, tag);
+        active++;
+    };
+
+    auto read_more = [&](size_t tag) {
+        Slot& slot = slots[tag];
+        const size_t chunk = std::min(slot.file.data.size() - slot.got, kMaxReadChunk);
+        slot.phase = Phase::Read;
+        ring.read(slot.fd, slot.file.data.data() + slot.got, static_cast<unsigned>(chunk), slot.got, tag);
+    };
+
+    auto close_slot = [&](size_t tag) {
+        Slot& slot = slots[tag];
+        slot.phase = Phase::Close;
+        ring.close(slot.fd, tag);
+    };
+
+    // Hand the file over and put the slot to work on the next one
+    auto complete = [&](size_t tag) {
+        Slot& slot = slots[tag];
+        record_stage(Stage::Read,
+                     std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - slot.start));
+        active--;
+        if (!deliver(std::move(slot.file))) {
+            accepting = false;
+        }
+        start_slot(tag);
+    };
+
+    for (size_t tag = 0; tag < slots.size() && accepting; ++tag) {
+        start_slot(tag);
+    }
+
+    IoRing::Completion c;
+    while (active > 0) {
+        if (!ring.wait(c)) {
+            spdlog::error("io_uring wait failed: {}", std::strerror(errno));
+            break;
+        }
+        const size_t tag = static_cast<size_t>(c.tag);
+        Slot& slot = slots[tag];
+
+        switch (slot.phase) {
+            case Phase::Open: {
+                struct stat st;
+                if (c.result < 0) {
+                    complete(tag);
+                    break;
+                }
+                slot.fd = c.result;
+                if (::fstat(slot.fd, &st) != 0) {
+                    close_slot(tag);
+                    break;
+                }
+                slot.file.data.resize(static_cast<size_t>(st.st_size));
+                if (slot.file.data.empty()) {
+                    slot.file.ok = true;
+                    close_slot(tag);
+                } else {
+                    read_more(tag);
+                }
+                break;
+            }
+            case Phase::Read:
+                if (c.result == -EINTR || c.result == -EAGAIN) {
+                    read_more(tag);
+                } else if (c.result < 0) {
+                    close_slot(tag);
+                } else if (c.result == 0) {
+                    // Truncated since fstat
+                    slot.file.data.resize(slot.got);
+                    slot.file.ok = true;
+                    close_slot(tag);
+                } else {
+                    slot.got += static_cast<size_t>(c.result);
+                    if (slot.got < slot.file.data.size()) {
+                        read_more(tag);
+                    } else {
+                        slot.file.ok = true;
+                        close_slot(tag);
+                    }
+                }
+                break;
+            case Phase::Close:
+                complete(tag);
+                break;
+            case Phase::Idle:
+                break;
+        }
+    }
+
+    // Only reached early if the ring itself broke: let what was submitted
+    // finish (noting opened and closed fds), then fail what is left
+    if (active == 0) {
+        return;
+    }
+    const bool drained = ring.drain([&](const IoRing::Completion& done) {
+        Slot& slot = slots[static_cast<size_t>(done.tag)];
+        if (slot.phase == Phase::Open && done.result >= 0) {
+            slot.fd = done.result;
+        } else if (slot.phase == Phase::Close) {
+            slot.fd = -1;
+        }
+    });
+    for (Slot& slot : slots) {
+        if (slot.phase == Phase::Idle) continue;
+        if (drained) {
+            if (slot.fd >= 0) {
+                ::close(slot.fd);
+            }
+            slot.file.ok = false;
+            deliver(std::move(slot.file));
+        } else {
+            // A read may still land in the buffer, and the fd stay in use
+            strand_buffer(std::move(slot.file.data));
+            deliver(LoadedFile{std::move(slot.file.request), {}, false});
+        }
+        slot.phase = Phase::Idle;
+    }
+}
+
+#else
+
+void FileLoader::run_ring(const LoadSource& next, const LoadSink& deliver) {
+    run_posix(next, deliver);
+}
+
+#endif
+
+} // namespace gwt
@@ -0,0 +1,96 @@
+#pragma once
+
+#include "io_ring.hpp"
+
+#include <cstddef>
+#include <filesystem>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+namespace gwt {
+
+/**
+ * A file for FileLoader to read
+ */
+struct LoadRequest {
+    size_t index = 0;           // Caller's identifier, handed back with the contents
+    std::filesystem::path path;
+};
+
+/**
+ * The contents of a requested file
+ */
+struct LoadedFile {
+    LoadRequest request;
+    std::vector<unsigned char> data;
+    bool ok = false;            // False if the file could not be opened or read
+};
+
+/**
+ * Produces the next file to read, nullopt once there are no more
+ */
+using LoadSource = std::function<std::optional<LoadRequest>()>;
+
+/**
+ * Receives each file as its read completes; return false to stop
+ * requesting new files (reads already in flight are still delivered)
+ */
+using LoadSink = std::function<bool(LoadedFile&& file)>;
+
+/**
+ * Reads whole input files into memory from a single thread
+ *
+ * With IoBackend::IoUring, up to in_flight files are open at once, each
+ * stepping through open, read(s) and close on one ring; files are
+ * delivered in completion order, so a slow file does not hold up the
+ * ones behind it. With IoBackend::Posix (or when io_uring is unavailable)
+ * the files are read one after another with blocking calls.
+ *
+ * Delivered buffers can be handed back with recycle() so that steady-state
+ * loading does not allocate.
+ */
+class FileLoader {
+public:
+    /**
+     * @param backend    Requested backend; falls back to Posix (with a
+     *                   warning) if io_uring is unavailable
+     * @param in_flight  Most files being read at once (io_uring only)
+     */
+    FileLoader(IoBackend backend, size_t in_flight);
+
+    /**
+     * The backend actually in use
+     */
+    IoBackend backend() const { return backend_; }
+
+    size_t in_flight() const { return in_flight_; }
+
+    /**
+     * Read every file next produces and pass it to deliver
+     *
+     * Both callbacks run on the calling thread. Returns once next is
+     * exhausted (or deliver returned false) and every read has been
+     * delivered.
+     */
+    void run(const LoadSource& next, const LoadSink& deliver);
+
+    /**
+     * Give a delivered buffer back for reuse; thread-safe
+     */
+    void recycle(std::vector<unsigned char>&& buffer);
+
+private:
+    std::vector<unsigned char> take_buffer();
+    void run_posix(const LoadSource& next, const LoadSink& deliver);
+    void run_ring(const LoadSource& next, const LoadSink& deliver);
+
+    IoBackend backend_;
+    size_t in_flight_;
+
+    std::mutex spare_mutex_;
+    std::vector<std::vector<unsigned char>> spare_;
+};
+
+} // namespace gwt
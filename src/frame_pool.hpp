@@ -0,0 +1,58 @@
+#pragma once
+
+#include <opencv2/core.hpp>
+
+#include <cstddef>
+#include <mutex>
+#include <vector>
+
+namespace gwt {
+
+/**
+ * Recycles decoded frames between the stages of a batch run
+ *
+ * Decoding into a Mat that already has the right size and type reuses its
+ * buffer (cv::imdecode with a destination, see load_image()), so a batch
+ * of same-sized images stops allocating once every in-flight frame has
+ * been around the pipeline once. A frame of another size is reallocated
+ * by the decoder and recycled at its new size.
+ *
+ * Thread-safe. Frames are handed out most recently released first (their
+ * pages are the likeliest to still be in cache).
+ */
+class FramePool {
+public:
+    /**
+     * @param capacity  Most frames kept for reuse; extra released frames
+     *                  are freed (use the number of frames in flight)
+     */
+    explicit FramePool(size_t capacity);
+
+    FramePool(const FramePool&) = delete;
+    FramePool& operator=(const FramePool&) = delete;
+
+    /**
+     * A pooled frame, or an empty Mat if the pool is empty
+     */
+    cv::Mat acquire();
+
+    /**
+     * Return a frame for reuse
+     *
+     * Frames that still share their buffer with another Mat (ROIs, copies
+     * held elsewhere) are freed instead of pooled.
+     */
+    void release(cv::Mat&& frame);
+
+    /**
+     * Frames currently held for reuse
+     */
+    size_t size() const;
+
+private:
+    mutable std::mutex mutex_;
+    std::vector<cv::Mat> frames_;
+    size_t capacity_;
+};
+
+} // namespace gwt
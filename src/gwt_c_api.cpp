@@ -0,0 +1,159 @@
+/**
+ * @file    gwt_c_api.cpp
+ * @brief   Gemini Watermark Tool - C API
+ * @author  AllenK (Kwyshell)
+ * @date    2026.10.18
+ * @license MIT
+ *
+ * @details
+ * Thin wrapper over WatermarkEngine. No exception crosses the C boundary;
+ * failures become a status code plus a per-thread error message.
+ *
+ * @see https://github.com/allenk/GeminiWatermarkTool
+ */
+
+#include "gwt_c_api.h"
+#include "watermark_engine.hpp"
+
+#include <opencv2/core.hpp>
+
+#include <cstdlib>
+#include <cstring>
+#include <exception>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#ifndef APP_VERSION
+#define APP_VERSION "unknown"
+#endif
+
+struct gwt_engine {
+    std::unique_ptr<gwt::WatermarkEngine> engine;
+};
+
+namespace {
+
+thread_local std::string g_last_error;
+
+gwt_status fail(gwt_status status, std::string message) {
+    g_last_error = std::move(message);
+    return status;
+}
+
+std::optional<gwt::WatermarkSize> to_force_size(gwt_size size) {
+    switch (size) {
+        case GWT_SIZE_SMALL: return gwt::WatermarkSize::Small;
+        case GWT_SIZE_LARGE: return gwt::WatermarkSize::Large;
+        default:             return std::nullopt;
+    }
+}
+
+} // namespace
+
+extern "C" {
+
+gwt_engine* gwt_engine_create(void) {
+    try {
+        auto handle = std::make_unique<gwt_engine>();
+        handle->engine = std::make_unique<gwt::WatermarkEngine>();
+        return handle.release();
+    } catch (const std::exception& e) {
+        fail(GWT_ERROR_INTERNAL, e.what());
+        return nullptr;
+    }
+}
+
+void gwt_engine_destroy(gwt_engine* engine) {
+    delete engine;
+}
+
+gwt_status gwt_remove_buffer(
+    const gwt_engine* engine,
+    uint8_t* pixels,
+    int width,
+    int height,
+    size_t stride,
+    int channels,
+    gwt_size size) {
+    if (!engine || !pixels || width <= 0 || height <= 0) {
+        return fail(GWT_ERROR_INVALID_ARGUMENT, "null engine/pixels or empty image");
+    }
+    if (channels != 1 && channels != 3 && channels != 4) {
+        return fail(GWT_ERROR_INVALID_ARGUMENT, "channels must be 1, 3 or 4");
+    }
+
+    const size_t min_stride = size_t(width) * size_t(channels);
+    if (stride == 0) {
+        stride = min_stride;
+    } else if (stride < min_stride) {
+        return fail(GWT_ERROR_INVALID_ARGUMENT, "stride is smaller than width * channels");
+    }
+
+    try {
+        // Wraps the caller's memory; gray, BGR and BGRA are blended in place
+        cv::Mat image(height, width, CV_8UC(channels), pixels, stride);
+        engine->engine->remove_watermark(image, to_force_size(size));
+        return GWT_OK;
+    } catch (const std::exception& e) {
+        return fail(GWT_ERROR_INTERNAL, e.what());
+    }
+}
+
+gwt_status gwt_remove_encoded(
+    const gwt_engine* engine,
+    const uint8_t* data,
+    size_t data_size,
+    const char* format,
+    uint8_t** out_data,
+    size_t* out_size,
+    gwt_size size) {
+    if (!engine || !data || data_size == 0 || !out_data || !out_size) {
+        return fail(GWT_ERROR_INVALID_ARGUMENT, "null argument or empty input");
+    }
+    *out_data = nullptr;
+    *out_size = 0;
+
+    try {
+        const std::string ext = format ? format : "";
+
+        if (gwt::detect_image_extension(data, data_size).empty()) {
+            return fail(GWT_ERROR_DECODE, "unrecognized image format");
+        }
+
+        std::vector<unsigned char> output;
+        bool decode_failed = false;
+        if (!gwt::process_image_buffer(data, data_size, ext, output, true, *engine->engine,
+                                       to_force_size(size), &decode_failed)) {
+            return decode_failed ? fail(GWT_ERROR_DECODE, "failed to decode image")
+                                 : fail(GWT_ERROR_ENCODE, "failed to process or encode image");
+        }
+
+        auto* buffer = static_cast<uint8_t*>(std::malloc(output.empty() ? 1 : output.size()));
+        if (!buffer) {
+            return fail(GWT_ERROR_INTERNAL, "out of memory");
+        }
+        std::memcpy(buffer, output.data(), output.size());
+
+        *out_data = buffer;
+        *out_size = output.size();
+        return GWT_OK;
+    } catch (const std::exception& e) {
+        return fail(GWT_ERROR_INTERNAL, e.what());
+    }
+}
+
+void gwt_buffer_free(uint8_t* buffer) {
+    std::free(buffer);
+}
+
+const char* gwt_last_error(void) {
+    return g_last_error.c_str();
+}
+
+const char* gwt_version(void) {
+    return APP_VERSION;
+}
+
+} // extern "C"
@@ -0,0 +1,135 @@
+/**
+ * @file    gwt_c_api.h
+ * @brief   Gemini Watermark Tool - C API
+ * @author  AllenK (Kwyshell)
+ * @date    2026.10.18
+ * @license MIT
+ *
+ * @details
+ * Stable C ABI over the watermark engine for in-process use (Python ctypes,
+ * cffi, other languages). All buffers are owned by the caller except the
+ * ones returned by gwt_remove_encoded(), which must be released with
+ * gwt_buffer_free().
+ *
+ * An engine is immutable once created; one handle may be used from any
+ * number of threads at the same time.
+ *
+ * @see https://github.com/allenk/GeminiWatermarkTool
+ */
+
+#ifndef GWT_C_API_H
+#define GWT_C_API_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#if defined(GWT_STATIC)
+    #define GWT_API
+#elif defined(_WIN32)
+    #if defined(GWT_BUILDING_LIBRARY)
+        #define GWT_API __declspec(dllexport)
+    #else
+        #define GWT_API __declspec(dllimport)
+    #endif
+#else
+    #define GWT_API __attribute__((visibility("default")))
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct gwt_engine gwt_engine;
+
+/** Return codes */
+typedef enum gwt_status {
+    GWT_OK = 0,
+    GWT_ERROR_INVALID_ARGUMENT = 1,
+    GWT_ERROR_DECODE = 2,
+    GWT_ERROR_ENCODE = 3,
+    GWT_ERROR_INTERNAL = 4
+} gwt_status;
+
+/** Watermark size selection */
+typedef enum gwt_size {
+    GWT_SIZE_AUTO = 0,      /* Pick from the image dimensions (Gemini's rules) */
+    GWT_SIZE_SMALL = 1,     /* Force 48x48 */
+    GWT_SIZE_LARGE = 2      /* Force 96x96 */
+} gwt_size;
+
+/**
+ * Create an engine from the alpha maps embedded in the library
+ *
+ * @return  Engine handle, or NULL on failure (see gwt_last_error())
+ */
+GWT_API gwt_engine* gwt_engine_create(void);
+
+/**
+ * Destroy an engine (NULL is ignored)
+ */
+GWT_API void gwt_engine_destroy(gwt_engine* engine);
+
+/**
+ * Remove the watermark from caller-owned pixels, in place
+ *
+ * Only the watermark corner is touched.
+ *
+ * @param pixels    Top-left pixel; 8-bit samples
+ * @param width     Image width in pixels
+ * @param height    Image height in pixels
+ * @param stride    Bytes between rows (0 = width * channels)
+ * @param channels  1 (gray), 3 (BGR) or 4 (BGRA, alpha left unchanged)
+ * @param size      Watermark size selection
+ */
+GWT_API gwt_status gwt_remove_buffer(
+    const gwt_engine* engine,
+    uint8_t* pixels,
+    int width,
+    int height,
+    size_t stride,
+    int channels,
+    gwt_size size);
+
+/**
+ * Remove the watermark from an encoded image held in memory
+ *
+ * JPEG -> JPEG and PNG -> PNG use the same patch-in-place fast paths as
+ * the command line tool.
+ *
+ * @param data        Encoded input (PNG, JPEG, WebP, BMP)
+ * @param data_size   Input size in bytes
+ * @param format      Output format as an extension (".png", "jpg", ...);
+ *                    NULL or "" keeps the input format
+ * @param out_data    Receives the encoded output; release with gwt_buffer_free()
+ * @param out_size    Receives the output size in bytes
+ * @param size        Watermark size selection
+ */
+GWT_API gwt_status gwt_remove_encoded(
+    const gwt_engine* engine,
+    const uint8_t* data,
+    size_t data_size,
+    const char* format,
+    uint8_t** out_data,
+    size_t* out_size,
+    gwt_size size);
+
+/**
+ * Release a buffer returned by gwt_remove_encoded() (NULL is ignored)
+ */
+GWT_API void gwt_buffer_free(uint8_t* buffer);
+
+/**
+ * Message for the last failed call on the calling thread ("" if none)
+ */
+GWT_API const char* gwt_last_error(void);
+
+/**
+ * Library version string, e.g. "0.1.2"
+ */
+GWT_API const char* gwt_version(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* GWT_C_API_H */
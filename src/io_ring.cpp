@@ -0,0 +1,379 @@
+/**
+ * @file    io_ring.cpp
+ * @brief   Gemini Watermark Tool - io_uring File I/O
+ * @author  AllenK (Kwyshell)
+ * @date    2026.10.18
+ * @license MIT
+ *
+ * @details
+ * A blocking read() or fsync() ties up a whole thread per outstanding
+ * operation, so keeping a device busy takes as many threads as it has
+ * queue slots. io_uring lets one thread keep dozens of opens, reads,
+ * writes and syncs outstanding and hands each result back as it lands.
+ *
+ * The ring is driven with the raw syscalls: the handful of operations used
+ * here do not warrant a dependency, and the library would have to be
+ * present on every build host for an optional backend.
+ *
+ * @see https://github.com/allenk/GeminiWatermarkTool
+ */
+
+#include "io_ring.hpp"
+
+#include <spdlog/spdlog.h>
+
+#include <mutex>
+
+#ifdef GWT_HAVE_IO_URING
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <fcntl.h>
+#include <thread>
+#endif
+
+namespace gwt {
+
+const char* io_backend_name(IoBackend backend) {
+    switch (backend) {
+        case IoBackend::Posix:   return "posix";
+        case IoBackend::IoUring: return "io_uring";
+    }
+    return "unknown";
+}
+
+std::optional<IoBackend> parse_io_backend(const std::string& name) {
+    if (name == "posix") return IoBackend::Posix;
+    if (name == "io_uring" || name == "io-uring" || name == "uring") return IoBackend::IoUring;
+    return std::nullopt;
+}
+
+void strand_buffer(std::vector<unsigned char>&& buffer) {
+    static std::mutex mutex;
+    static auto* stranded = new std::vector<std::vector<unsigned char>>();  // Never freed
+    if (buffer.capacity() == 0) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(mutex);
+    stranded->push_back(std::move(buffer));
+}
+
+#ifdef GWT_HAVE_IO_URING
+
+namespace {
+
+// Consecutive failed waits before drain() gives up on the ring
+constexpr int kDrainAttempts = 100;
+
+int sys_io_uring_setup(unsigned entries, io_uring_params* params) {
+    return static_cast<int>(::syscall(__NR_io_uring_setup, entries, params));
+}
+
+int sys_io_uring_enter(int fd, unsigned to_submit, unsigned min_complete, unsigned flags) {
+    return static_cast<int>(::syscall(__NR_io_uring_enter, fd, to_submit, min_complete, flags,
+                                      nullptr, 0));
+}
+
+int sys_io_uring_register(int fd, unsigned opcode, void* arg, unsigned nr_args) {
+    return static_cast<int>(::syscall(__NR_io_uring_register, fd, opcode, arg, nr_args));
+}
+
+unsigned* ring_field(void* ring, uint32_t offset) {
+    return reinterpret_cast<unsigned*>(static_cast<char*>(ring) + offset);
+}
+
+// Every opcode IoRing issues must be supported (all arrived in Linux 5.6)
+bool supports_required_ops(int ring_fd) {
+    constexpr unsigned kProbeOps = 256;
+    const size_t size = sizeof(io_uring_probe) + kProbeOps * sizeof(io_uring_probe_op);
+    std::vector<unsigned char> storage(size, 0);
+    auto* probe = reinterpret_cast<io_uring_probe*>(storage.data());
+    if (sys_io_uring_register(ring_fd, IORING_REGISTER_PROBE, probe, kProbeOps) < 0) {
+        return false;   // Probing itself is 5.6+
+    }
+    for (unsigned op : {IORING_OP_OPENAT, IORING_OP_READ, IORING_OP_WRITE,
+                        IORING_OP_FSYNC, IORING_OP_CLOSE}) {
+        if (op > probe->last_op || !(probe->ops[op].flags & IO_URING_OP_SUPPORTED)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace
+
+bool io_uring_available() {
+    static const bool available = [] {
+        IoRing ring(4);
+        if (!ring.ready()) {
+            spdlog::debug("io_uring unavailable: {}", std::strerror(errno));
+        }
+        return ring.ready();
+    }();
+    return available;
+}
+
+IoRing::IoRing(unsigned entries) {
+    io_uring_params params;
+    std::memset(&params, 0, sizeof(params));
+    const int fd = sys_io_uring_setup(std::max(entries, 1u), &params);
+    if (fd < 0) {
+        return;
+    }
+    if (!supports_required_ops(fd)) {
+        ::close(fd);
+        errno = EOPNOTSUPP;
+        return;
+    }
+
+    sq_ring_size_ = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+    cq_ring_size_ = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+    const bool single_mmap = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+    if (single_mmap) {
+        sq_ring_size_ = cq_ring_size_ = std::max(sq_ring_size_, cq_ring_size_);
+    }
+
+    sq_ring_ = ::mmap(nullptr, sq_ring_size_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                      fd, IORING_OFF_SQ_RING);
+    if (sq_ring_ == MAP_FAILED) {
+        sq_ring_ = nullptr;
+        ::close(fd);
+        return;
+    }
+    if (single_mmap) {
+        cq_ring_ = sq_ring_;
+    } else {
+        cq_ring_ = ::mmap(nullptr, cq_ring_size_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                          fd, IORING_OFF_CQ_RING);
+        if (cq_ring_ == MAP_FAILED) {
+            cq_ring_ = nullptr;
+            ::munmap(sq_ring_, sq_ring_size_);
+            sq_ring_ = nullptr;
+            ::close(fd);
+            return;
+        }
+    }
+
+    sqes_size_ = params.sq_entries * sizeof(io_uring_sqe);
+    sqes_ = ::mmap(nullptr, sqes_size_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                   fd, IORING_OFF_SQES);
+    if (sqes_ == MAP_FAILED) {
+        sqes_ = nullptr;
+        if (cq_ring_ != sq_ring_) {
+            ::munmap(cq_ring_, cq_ring_size_);
+        }
+        ::munmap(sq_ring_, sq_ring_size_);
+        sq_ring_ = cq_ring_ = nullptr;
+        ::close(fd);
+        return;
+    }
+
+    sq_head_ = ring_field(sq_ring_, params.sq_off.head);
+    sq_tail_ = ring_field(sq_ring_, params.sq_off.tail);
+    sq_mask_ = ring_field(sq_ring_, params.sq_off.ring_mask);
+    sq_array_ = ring_field(sq_ring_, params.sq_off.array);
+    cq_head_ = ring_field(cq_ring_, params.cq_off.head);
+    cq_tail_ = ring_field(cq_ring_, params.cq_off.tail);
+    cq_mask_ = ring_field(cq_ring_, params.cq_off.ring_mask);
+    cqes_ = static_cast<char*>(cq_ring_) + params.cq_off.cqes;
+
+    sq_entries_ = params.sq_entries;
+    sqe_tail_ = submitted_ = reaped_ = *sq_tail_;
+    fd_ = fd;
+}
+
+IoRing::~IoRing() {
+    if (fd_ < 0) {
+        return;
+    }
+    ::munmap(sqes_, sqes_size_);
+    if (cq_ring_ != sq_ring_) {
+        ::munmap(cq_ring_, cq_ring_size_);
+    }
+    ::munmap(sq_ring_, sq_ring_size_);
+    ::close(fd_);
+}
+
+void* IoRing::next_entry() {
+    if (fd_ < 0) {
+        return nullptr;
+    }
+    const unsigned head = __atomic_load_n(sq_head_, __ATOMIC_ACQUIRE);
+    if (sqe_tail_ - head >= sq_entries_) {
+        return nullptr;
+    }
+    const unsigned index = sqe_tail_ & *sq_mask_;
+    auto* sqe = static_cast<io_uring_sqe*>(sqes_) + index;
+    std::memset(sqe, 0, sizeof(*sqe));
+    sq_array_[index] = index;
+    sqe_tail_++;
+    return sqe;
+}
+
+bool IoRing::openat(const char* path, int flags, unsigned mode, uint64_t tag) {
+    auto* sqe = static_cast<io_uring_sqe*>(next_entry());
+    if (sqe == nullptr) return false;
+    sqe->opcode = IORING_OP_OPENAT;
+    sqe->fd = AT_FDCWD;
+    sqe->addr = reinterpret_cast<uint64_t>(path);
+    sqe->len = mode;
+    sqe->open_flags = static_cast<uint32_t>(flags);
+    sqe->user_data = tag;
+    return true;
+}
+
+bool IoRing::read(int fd, void* buffer, unsigned length, uint64_t offset, uint64_t tag) {
+    auto* sqe = static_cast<io_uring_sqe*>(next_entry());
+    if (sqe == nullptr) return false;
+    sqe->opcode = IORING_OP_READ;
+    sqe->fd = fd;
+    sqe->addr = reinterpret_cast<uint64_t>(buffer);
+    sqe->len = length;
+    sqe->off = offset;
+    sqe->user_data = tag;
+    return true;
+}
+
+bool IoRing::write(int fd, const void* buffer, unsigned length, uint64_t offset, uint64_t tag,
+                   bool link) {
+    auto* sqe = static_cast<io_uring_sqe*>(next_entry());
+    if (sqe == nullptr) return false;
+    sqe->opcode = IORING_OP_WRITE;
+    sqe->fd = fd;
+    sqe->addr = reinterpret_cast<uint64_t>(buffer);
+    sqe->len = length;
+    sqe->off = offset;
+    sqe->flags = link ? IOSQE_IO_LINK : 0;
+    sqe->user_data = tag;
+    return true;
+}
+
+bool IoRing::fsync(int fd, bool datasync, uint64_t tag) {
+    auto* sqe = static_cast<io_uring_sqe*>(next_entry());
+    if (sqe == nullptr) return false;
+    sqe->opcode = IORING_OP_FSYNC;
+    sqe->fd = fd;
+    sqe->fsync_flags = datasync ? IORING_FSYNC_DATASYNC : 0;
+    sqe->user_data = tag;
+    return true;
+}
+
+bool IoRing::close(int fd, uint64_t tag) {
+    auto* sqe = static_cast<io_uring_sqe*>(next_entry());
+    if (sqe == nullptr) return false;
+    sqe->opcode = IORING_OP_CLOSE;
+    sqe->fd = fd;
+    sqe->user_data = tag;
+    return true;
+}
+
+bool IoRing::submit() {
+    if (fd_ < 0) {
+        return false;
+    }
+    __atomic_store_n(sq_tail_, sqe_tail_, __ATOMIC_RELEASE);
+    while (submitted_ != sqe_tail_) {
+        const int n = sys_io_uring_enter(fd_, sqe_tail_ - submitted_, 0, 0);
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            // EAGAIN/EBUSY: the completion queue is backed up; the caller
+            // drains it and the rest goes with the next submit
+            return errno == EAGAIN || errno == EBUSY;
+        }
+        submitted_ += static_cast<unsigned>(n);
+        if (n == 0) break;
+    }
+    return true;
+}
+
+bool IoRing::peek(Completion& completion) {
+    if (fd_ < 0) {
+        return false;
+    }
+    const unsigned head = *cq_head_;
+    if (head == __atomic_load_n(cq_tail_, __ATOMIC_ACQUIRE)) {
+        return false;
+    }
+    const auto* cqe = static_cast<const io_uring_cqe*>(cqes_) + (head & *cq_mask_);
+    completion.tag = cqe->user_data;
+    completion.result = cqe->res;
+    __atomic_store_n(cq_head_, head + 1, __ATOMIC_RELEASE);
+    reaped_++;
+    return true;
+}
+
+bool IoRing::drain(const std::function<void(const Completion&)>& on_completion) {
+    if (fd_ < 0) {
+        return false;
+    }
+    // Without SQPOLL the kernel only takes entries inside io_uring_enter(),
+    // so everything past submitted_ can be withdrawn
+    sqe_tail_ = submitted_;
+    __atomic_store_n(sq_tail_, submitted_, __ATOMIC_RELEASE);
+
+    int failures = 0;
+    Completion completion;
+    while (reaped_ != submitted_) {
+        if (peek(completion)) {
+            failures = 0;
+            if (on_completion) {
+                on_completion(completion);
+            }
+            continue;
+        }
+        const int n = sys_io_uring_enter(fd_, 0, 1, IORING_ENTER_GETEVENTS);
+        if (n < 0 && errno != EINTR && errno != EAGAIN && errno != EBUSY) {
+            if (++failures >= kDrainAttempts) {
+                return false;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+    return true;
+}
+
+bool IoRing::wait(Completion& completion) {
+    if (!submit()) {
+        return false;
+    }
+    while (!peek(completion)) {
+        __atomic_store_n(sq_tail_, sqe_tail_, __ATOMIC_RELEASE);
+        const int n = sys_io_uring_enter(fd_, sqe_tail_ - submitted_, 1, IORING_ENTER_GETEVENTS);
+        if (n < 0) {
+            if (errno == EINTR || errno == EAGAIN || errno == EBUSY) continue;
+            return false;
+        }
+        submitted_ += static_cast<unsigned>(n);
+    }
+    return true;
+}
+
+#else // !GWT_HAVE_IO_URING
+
+bool io_uring_available() {
+    return false;
+}
+
+IoRing::IoRing(unsigned) {}
+IoRing::~IoRing() = default;
+
+void* IoRing::next_entry() { return nullptr; }
+bool IoRing::openat(const char*, int, unsigned, uint64_t) { return false; }
+bool IoRing::read(int, void*, unsigned, uint64_t, uint64_t) { return false; }
+bool IoRing::write(int, const void*, unsigned, uint64_t, uint64_t, bool) { return false; }
+bool IoRing::fsync(int, bool, uint64_t) { return false; }
+bool IoRing::close(int, uint64_t) { return false; }
+bool IoRing::submit() { return false; }
+bool IoRing::wait(Completion&) { return false; }
+bool IoRing::peek(Completion&) { return false; }
+bool IoRing::drain(const std::function<void(const Completion&)>&) { return false; }
+
+#endif
+
+} // namespace gwt
@@ -0,0 +1,143 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace gwt {
+
+/**
+ * How batch runs read inputs and write outputs
+ */
+enum class IoBackend {
+    Posix,      // Blocking open/read/write/fsync (mmap for large inputs)
+    IoUring,    // Linux io_uring, a fixed number of operations in flight
+};
+
+const char* io_backend_name(IoBackend backend);
+
+/**
+ * Parse "posix" or "io_uring"
+ */
+std::optional<IoBackend> parse_io_backend(const std::string& name);
+
+/**
+ * Whether io_uring can be used: built with GWT_HAVE_IO_URING, and the
+ * kernel allows it and supports every operation IoRing issues (Linux 5.6+;
+ * container seccomp profiles often block it). Checked once per process.
+ */
+bool io_uring_available();
+
+/**
+ * Keep a buffer allocated for the rest of the process
+ *
+ * For buffers of operations a broken ring could not be drained of (see
+ * IoRing::drain()): the kernel may still read or write them, so they must
+ * be neither reused nor freed.
+ */
+void strand_buffer(std::vector<unsigned char>&& buffer);
+
+/**
+ * Minimal io_uring submission/completion ring
+ *
+ * Talks to the kernel directly (no liburing). Operations are queued with
+ * the typed helpers below, handed to the kernel by submit() or wait(), and
+ * complete in any order; each completion carries the caller's tag. Not
+ * thread-safe: one thread owns a ring.
+ *
+ * Without io_uring support, ready() is false and every call fails.
+ */
+class IoRing {
+public:
+    struct Completion {
+        uint64_t tag = 0;
+        int32_t result = 0;     // Bytes, file descriptor or 0; -errno on failure
+    };
+
+    /**
+     * @param entries  Submission queue size (rounded up to a power of two)
+     */
+    explicit IoRing(unsigned entries);
+    ~IoRing();
+
+    IoRing(const IoRing&) = delete;
+    IoRing& operator=(const IoRing&) = delete;
+
+    bool ready() const { return fd_ >= 0; }
+
+    /**
+     * Submission queue entries; the most operations queued at once
+     */
+    unsigned capacity() const { return sq_entries_; }
+
+    // Queue an operation; false if the submission queue is full (submit
+    // or wait, then retry). link chains the next queued operation to this
+    // one: it starts after this one succeeds and is cancelled otherwise.
+    bool openat(const char* path, int flags, unsigned mode, uint64_t tag);
+    bool read(int fd, void* buffer, unsigned length, uint64_t offset, uint64_t tag);
+    bool write(int fd, const void* buffer, unsigned length, uint64_t offset, uint64_t tag,
+               bool link = false);
+    bool fsync(int fd, bool datasync, uint64_t tag);
+    bool close(int fd, uint64_t tag);
+
+    /**
+     * Hand every queued operation to the kernel
+     *
+     * @return  False on a ring failure
+     */
+    bool submit();
+
+    /**
+     * Submit, then block until a completion is available and take it
+     */
+    bool wait(Completion& completion);
+
+    /**
+     * Take a completion if one is available, without blocking
+     */
+    bool peek(Completion& completion);
+
+    /**
+     * Stop and settle the ring after a failure: drop the queued operations
+     * the kernel has not seen, then wait for every submitted one to
+     * complete, passing each completion to on_completion (if set)
+     *
+     * Until this returns true the kernel may still be using the buffers
+     * and file descriptors of submitted operations.
+     *
+     * @return  False if the ring cannot be waited on at all
+     */
+    bool drain(const std::function<void(const Completion&)>& on_completion = {});
+
+private:
+    void* next_entry();
+
+    int fd_ = -1;
+    unsigned sq_entries_ = 0;
+
+    // Kernel-shared ring state (see io_uring_setup(2))
+    void* sq_ring_ = nullptr;
+    void* cq_ring_ = nullptr;
+    void* sqes_ = nullptr;
+    size_t sq_ring_size_ = 0;
+    size_t cq_ring_size_ = 0;
+    size_t sqes_size_ = 0;
+
+    unsigned* sq_head_ = nullptr;
+    unsigned* sq_tail_ = nullptr;
+    unsigned* sq_mask_ = nullptr;
+    unsigned* sq_array_ = nullptr;
+    unsigned* cq_head_ = nullptr;
+    unsigned* cq_tail_ = nullptr;
+    unsigned* cq_mask_ = nullptr;
+    void* cqes_ = nullptr;
+
+    unsigned sqe_tail_ = 0;     // Entries queued locally, published by submit()
+    unsigned submitted_ = 0;    // Entries the kernel has been told about
+    unsigned reaped_ = 0;       // Completions taken by peek()
+};
+
+} // namespace gwt
@@ -0,0 +1,84 @@
+/**
+ * @file    jpeg_common.cpp
+ * @brief   Gemini Watermark Tool - libjpeg Helpers
+ * @author  AllenK (Kwyshell)
+ * @date    2026.10.18
+ * @license MIT
+ *
+ * @details
+ * Error handling and marker parsing shared by the JPEG patch path and the
+ * partial (strip) reader.
+ *
+ * @see https://github.com/allenk/GeminiWatermarkTool
+ */
+
+#include "jpeg_common.hpp"
+
+#include <spdlog/spdlog.h>
+
+#include <cstring>
+
+namespace gwt::jpeg {
+
+// =============================================================================
+// Error handling
+// =============================================================================
+
+void on_error(j_common_ptr cinfo) {
+    auto* err = reinterpret_cast<ErrorManager*>(cinfo->err);
+    (*cinfo->err->format_message)(cinfo, err->message);
+    std::longjmp(err->jump, 1);
+}
+
+void on_output(j_common_ptr cinfo) {
+    char message[JMSG_LENGTH_MAX];
+    (*cinfo->err->format_message)(cinfo, message);
+    spdlog::debug("libjpeg: {}", message);
+}
+
+// =============================================================================
+// Marker helpers
+// =============================================================================
+
+bool marker_has_prefix(const jpeg_saved_marker_ptr marker, const char* prefix, size_t length) {
+    return marker->data_length >= length &&
+           std::memcmp(marker->data, prefix, length) == 0;
+}
+
+int read_exif_orientation(const jpeg_saved_marker_ptr marker) {
+    if (marker->marker != JPEG_APP0 + 1 || !marker_has_prefix(marker, "Exif\0\0", 6)) {
+        return 1;
+    }
+
+    const unsigned char* tiff = marker->data + 6;
+    const size_t size = marker->data_length - 6;
+    if (size < 8) return 1;
+
+    const bool little = tiff[0] == 'I' && tiff[1] == 'I';
+    auto u16 = [&](size_t off) -> unsigned {
+        return little ? (tiff[off] | (tiff[off + 1] << 8))
+                      : ((tiff[off] << 8) | tiff[off + 1]);
+    };
+    auto u32 = [&](size_t off) -> size_t {
+        return little
+            ? (size_t(tiff[off]) | (size_t(tiff[off + 1]) << 8) |
+               (size_t(tiff[off + 2]) << 16) | (size_t(tiff[off + 3]) << 24))
+            : ((size_t(tiff[off]) << 24) | (size_t(tiff[off + 1]) << 16) |
+               (size_t(tiff[off + 2]) << 8) | size_t(tiff[off + 3]));
+    };
+
+    size_t ifd = u32(4);
+    if (ifd + 2 > size) return 1;
+
+    unsigned count = u16(ifd);
+    for (unsigned i = 0; i < count; ++i) {
+        size_t entry = ifd + 2 + i * 12;
+        if (entry + 12 > size) break;
+        if (u16(entry) == 0x0112) {
+            return static_cast<int>(u16(entry + 8));
+        }
+    }
+    return 1;
+}
+
+} // namespace gwt::jpeg
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <csetjmp>
+#include <cstddef>
+#include <cstdio>
+
+#include <jpeglib.h>
+
+namespace gwt::jpeg {
+
+/**
+ * libjpeg error manager that longjmp's back to the caller
+ *
+ * Usage: point cinfo.err at &pub via jpeg_std_error(), set
+ * pub.error_exit = on_error and pub.output_message = on_output, then
+ * setjmp(jump) before the first libjpeg call.
+ */
+struct ErrorManager {
+    jpeg_error_mgr pub;
+    std::jmp_buf jump;
+    char message[JMSG_LENGTH_MAX];
+};
+
+void on_error(j_common_ptr cinfo);
+void on_output(j_common_ptr cinfo);
+
+bool marker_has_prefix(const jpeg_saved_marker_ptr marker, const char* prefix, size_t length);
+
+/**
+ * Read the EXIF orientation tag (0x0112) from an APP1 marker
+ *
+ * @return  Orientation value, or 1 (normal) if absent/unreadable
+ */
+int read_exif_orientation(const jpeg_saved_marker_ptr marker);
+
+} // namespace gwt::jpeg
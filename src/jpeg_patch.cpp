@@ -0,0 +1,554 @@
+/**
+ * @file    jpeg_patch.cpp
+ * @brief   Gemini Watermark Tool - DCT-Domain JPEG Patching
+ * @author  AllenK (Kwyshell)
+ * @date    2026.10.18
+ * @license MIT
+ *
+ * @details
+ * Lossless-outside-the-watermark JPEG processing.
+ *
+ * The coefficients of every block are read with jpeg_read_coefficients().
+ * Only the MCUs covering the watermark are inverse-transformed, converted
+ * to BGR, blended, and converted back; the blocks that actually intersect
+ * the watermark are then re-quantized with the original tables. All other
+ * coefficients are written out untouched via jpeg_write_coefficients().
+ *
+ * @see https://github.com/allenk/GeminiWatermarkTool
+ */
+
+#include "jpeg_patch.hpp"
+#include "jpeg_common.hpp"
+#include "mapped_file.hpp"
+#include "stage_stats.hpp"
+
+#include <opencv2/core.hpp>
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace gwt {
+
+namespace {
+
+// =============================================================================
+// 8x8 DCT
+// =============================================================================
+
+/**
+ * Orthonormal DCT-II basis: kBasis[x][u] = C(u)/2 * cos((2x+1) u pi / 16)
+ *
+ * With this scaling the forward transform yields exactly the coefficients
+ * JPEG stores (DC = 8 * mean), and the inverse is its transpose.
+ */
+struct DctBasis {
+    float c[8][8];
+
+    DctBasis() {
+        const double pi = 3.14159265358979323846;
+        for (int x = 0; x < 8; ++x) {
+            for (int u = 0; u < 8; ++u) {
+                double cu = (u == 0) ? std::sqrt(0.5) : 1.0;
+                c[x][u] = static_cast<float>(cu / 2.0 * std::cos((2 * x + 1) * u * pi / 16.0));
+            }
+        }
+    }
+};
+
+const DctBasis& dct_basis() {
+    static const DctBasis basis;
+    return basis;
+}
+
+// Dequantize + inverse DCT one block into a float plane (level shift included)
+void idct_block(const JCOEF* coef, const UINT16* quant, float* out, size_t stride) {
+    const auto& b = dct_basis().c;
+
+    // Rows: tmp[v][x] = sum_u F[v][u] * b[x][u]
+    float tmp[8][8];
+    for (int v = 0; v < 8; ++v) {
+        float f[8];
+        for (int u = 0; u < 8; ++u) {
+            f[u] = static_cast<float>(coef[v * 8 + u]) * static_cast<float>(quant[v * 8 + u]);
+        }
+        for (int x = 0; x < 8; ++x) {
+            float sum = 0.0f;
+            for (int u = 0; u < 8; ++u) sum += f[u] * b[x][u];
+            tmp[v][x] = sum;
+        }
+    }
+
+    // Columns: out[y][x] = sum_v tmp[v][x] * b[y][v]
+    for (int y = 0; y < 8; ++y) {
+        float* row = out + y * stride;
+        for (int x = 0; x < 8; ++x) {
+            float sum = 0.0f;
+            for (int v = 0; v < 8; ++v) sum += tmp[v][x] * b[y][v];
+            row[x] = sum + 128.0f;
+        }
+    }
+}
+
+// Forward DCT + quantize one block (input already level-shifted back to 0..255)
+void fdct_block(const float* in, size_t stride, const UINT16* quant, JCOEF* coef) {
+    const auto& b = dct_basis().c;
+
+    // Columns: tmp[v][x] = sum_y (f[y][x] - 128) * b[y][v]
+    float tmp[8][8];
+    for (int v = 0; v < 8; ++v) {
+        for (int x = 0; x < 8; ++x) {
+            float sum = 0.0f;
+            for (int y = 0; y < 8; ++y) sum += (in[y * stride + x] - 128.0f) * b[y][v];
+            tmp[v][x] = sum;
+        }
+    }
+
+    // Rows: F[v][u] = sum_x tmp[v][x] * b[x][u]
+    for (int v = 0; v < 8; ++v) {
+        for (int u = 0; u < 8; ++u) {
+            float sum = 0.0f;
+            for (int x = 0; x < 8; ++x) sum += tmp[v][x] * b[x][u];
+
+            // Same rounding as libjpeg's quantizer (half away from zero)
+            long q = std::lround(sum / static_cast<float>(quant[v * 8 + u]));
+            coef[v * 8 + u] = static_cast<JCOEF>(std::clamp(q, -1023L, 1023L));
+        }
+    }
+}
+
+// =============================================================================
+// Coefficient patching
+// =============================================================================
+
+struct PatchJob {
+    const WatermarkEngine* engine = nullptr;
+    bool remove = true;
+    std::optional<WatermarkSize> force_size;
+
+    std::string unsupported;            // Reason the file was skipped
+    unsigned char* output = nullptr;    // jpeg_mem_dest buffer (malloc'd)
+    unsigned long output_size = 0;
+};
+
+/**
+ * The blocks of one component covering the patch region
+ *
+ * blocks is a copy (from the image pool) of blocks_w x blocks_h blocks in
+ * row-major order, so the pixel work never calls into libjpeg.
+ */
+struct BlockPlane {
+    int sx, sy;             // Subsampling ratio relative to full resolution
+    int bx0, by0;           // First block column/row of the region
+    int blocks_w, blocks_h; // Region size in blocks
+    const UINT16* quant;    // Quantization table (natural order)
+    JBLOCK* blocks;
+};
+
+/**
+ * The watermark's MCU-aligned region and its blocks
+ *
+ * Lives in transcode_jpeg()'s frame, so it must stay trivially
+ * destructible (see there).
+ */
+struct PatchRegion {
+    cv::Size image_size;
+    cv::Rect watermark;     // Watermark rectangle, clipped to the image
+    cv::Rect region;        // watermark expanded to whole MCUs
+    int num_components = 0;
+    BlockPlane planes[3];
+};
+
+static_assert(std::is_trivially_destructible_v<PatchRegion>);
+
+/**
+ * Compute the region to patch and check the layout supports it
+ *
+ * Leaves r.watermark empty if the watermark lies outside the image.
+ *
+ * @return  False if the file layout is not supported (job.unsupported set)
+ */
+bool plan_patch(j_decompress_ptr src, PatchJob& job, PatchRegion& r) {
+    const int max_h = src->max_h_samp_factor;
+    const int max_v = src->max_v_samp_factor;
+    const int mcu_w = 8 * max_h;
+    const int mcu_h = 8 * max_v;
+
+    r.num_components = src->num_components;
+    r.image_size = cv::Size(static_cast<int>(src->image_width),
+                            static_cast<int>(src->image_height));
+    r.watermark = job.engine->get_processing_rect(r.image_size, job.force_size) &
+                  cv::Rect(0, 0, r.image_size.width, r.image_size.height);
+    if (r.watermark.empty()) {
+        return true;    // Nothing to change, coefficients are copied as-is
+    }
+
+    // Expand the watermark rectangle to whole MCUs
+    const int rx0 = r.watermark.x / mcu_w * mcu_w;
+    const int ry0 = r.watermark.y / mcu_h * mcu_h;
+    const int rx1 = (r.watermark.x + r.watermark.width + mcu_w - 1) / mcu_w * mcu_w;
+    const int ry1 = (r.watermark.y + r.watermark.height + mcu_h - 1) / mcu_h * mcu_h;
+    r.region = cv::Rect(rx0, ry0, rx1 - rx0, ry1 - ry0);
+
+    for (int c = 0; c < r.num_components; ++c) {
+        const jpeg_component_info& comp = src->comp_info[c];
+        if (max_h % comp.h_samp_factor != 0 || max_v % comp.v_samp_factor != 0) {
+            job.unsupported = "non-integral chroma sampling ratio";
+            return false;
+        }
+        if (comp.quant_table == nullptr) {
+            job.unsupported = "missing quantization table";
+            return false;
+        }
+
+        BlockPlane& p = r.planes[c];
+        p.sx = max_h / comp.h_samp_factor;
+        p.sy = max_v / comp.v_samp_factor;
+        p.bx0 = r.region.x / p.sx / 8;
+        p.by0 = r.region.y / p.sy / 8;
+        p.blocks_w = r.region.width / p.sx / 8;
+        p.blocks_h = r.region.height / p.sy / 8;
+        p.quant = comp.quant_table->quantval;
+        p.blocks = nullptr;
+
+        // Coefficient arrays are padded to whole MCUs
+        const int rows_in_array = (static_cast<int>(comp.height_in_blocks) + comp.v_samp_factor - 1) /
+                                  comp.v_samp_factor * comp.v_samp_factor;
+        const int cols_in_array = (static_cast<int>(comp.width_in_blocks) + comp.h_samp_factor - 1) /
+                                  comp.h_samp_factor * comp.h_samp_factor;
+        if (p.by0 + p.blocks_h > rows_in_array || p.bx0 + p.blocks_w > cols_in_array) {
+            job.unsupported = "watermark region outside coefficient arrays";
+            return false;
+        }
+    }
+    return true;
+}
+
+// Copy the region's blocks out of the coefficient arrays. May longjmp, so
+// only trivially destructible locals here.
+void read_region_blocks(j_decompress_ptr src, jvirt_barray_ptr* arrays, PatchRegion& r) {
+    for (int c = 0; c < r.num_components; ++c) {
+        BlockPlane& p = r.planes[c];
+        const size_t row_bytes = static_cast<size_t>(p.blocks_w) * sizeof(JBLOCK);
+        p.blocks = static_cast<JBLOCK*>((*src->mem->alloc_large)(
+            reinterpret_cast<j_common_ptr>(src), JPOOL_IMAGE, row_bytes * static_cast<size_t>(p.blocks_h)));
+
+        for (int by = 0; by < p.blocks_h; ++by) {
+            JBLOCKARRAY rows = (*src->mem->access_virt_barray)(
+                reinterpret_cast<j_common_ptr>(src), arrays[c],
+                static_cast<JDIMENSION>(p.by0 + by), 1, FALSE);
+            std::memcpy(p.blocks + by * p.blocks_w, rows[0] + p.bx0, row_bytes);
+        }
+    }
+}
+
+// Copy the (patched) blocks back; blocks outside the watermark are
+// unchanged copies. May longjmp, as above.
+void write_region_blocks(j_decompress_ptr src, jvirt_barray_ptr* arrays, const PatchRegion& r) {
+    for (int c = 0; c < r.num_components; ++c) {
+        const BlockPlane& p = r.planes[c];
+        const size_t row_bytes = static_cast<size_t>(p.blocks_w) * sizeof(JBLOCK);
+
+        for (int by = 0; by < p.blocks_h; ++by) {
+            JBLOCKARRAY rows = (*src->mem->access_virt_barray)(
+                reinterpret_cast<j_common_ptr>(src), arrays[c],
+                static_cast<JDIMENSION>(p.by0 + by), 1, TRUE);
+            std::memcpy(rows[0] + p.bx0, p.blocks + by * p.blocks_w, row_bytes);
+        }
+    }
+}
+
+/**
+ * Rewrite the copied blocks that intersect the watermark
+ *
+ * Pure C++ (no libjpeg calls), so it is free to use containers and may
+ * throw.
+ */
+void patch_region(PatchRegion& r, const PatchJob& job) {
+    const int num_components = r.num_components;
+    const cv::Rect& region = r.region;
+    const cv::Rect& watermark = r.watermark;
+
+    // Decode the region's blocks of every component
+    std::vector<float> planes[3];
+    for (int c = 0; c < num_components; ++c) {
+        const BlockPlane& p = r.planes[c];
+        const size_t stride = static_cast<size_t>(p.blocks_w) * 8;
+        planes[c].resize(stride * static_cast<size_t>(p.blocks_h) * 8);
+
+        for (int by = 0; by < p.blocks_h; ++by) {
+            for (int bx = 0; bx < p.blocks_w; ++bx) {
+                idct_block(p.blocks[by * p.blocks_w + bx], p.quant,
+                           &planes[c][by * 8 * stride + bx * 8], stride);
+            }
+        }
+    }
+
+    // Reconstruct BGR pixels (JFIF YCbCr, nearest-neighbour chroma upsampling)
+    cv::Mat bgr(region.height, region.width, CV_8UC3);
+    for (int y = 0; y < region.height; ++y) {
+        auto* out = bgr.ptr<cv::Vec3b>(y);
+        for (int x = 0; x < region.width; ++x) {
+            float v[3] = {0.0f, 128.0f, 128.0f};
+            for (int c = 0; c < num_components; ++c) {
+                const BlockPlane& p = r.planes[c];
+                v[c] = planes[c][(y / p.sy) * p.blocks_w * 8 + x / p.sx];
+            }
+            const float luma = v[0], cb = v[1] - 128.0f, cr = v[2] - 128.0f;
+            out[x][0] = cv::saturate_cast<uchar>(luma + 1.772f * cb);
+            out[x][1] = cv::saturate_cast<uchar>(luma - 0.344136f * cb - 0.714136f * cr);
+            out[x][2] = cv::saturate_cast<uchar>(luma + 1.402f * cr);
+        }
+    }
+
+    if (job.remove) {
+        job.engine->remove_watermark_region(bgr, region, r.image_size, job.force_size);
+    } else {
+        job.engine->add_watermark_region(bgr, region, r.image_size, job.force_size);
+    }
+
+    // Back to YCbCr at full resolution
+    const size_t region_pixels = static_cast<size_t>(region.width) * region.height;
+    std::vector<float> ycc[3];
+    for (int c = 0; c < num_components; ++c) {
+        ycc[c].resize(region_pixels);
+    }
+    for (int y = 0; y < region.height; ++y) {
+        const auto* in = bgr.ptr<cv::Vec3b>(y);
+        for (int x = 0; x < region.width; ++x) {
+            const float b = in[x][0], g = in[x][1], r = in[x][2];
+            const size_t i = static_cast<size_t>(y) * region.width + x;
+            ycc[0][i] = 0.299f * r + 0.587f * g + 0.114f * b;
+            if (num_components == 3) {
+                ycc[1][i] = -0.168736f * r - 0.331264f * g + 0.5f * b + 128.0f;
+                ycc[2][i] = 0.5f * r - 0.418688f * g - 0.081312f * b + 128.0f;
+            }
+        }
+    }
+
+    // Re-quantize only the blocks that touch the watermark
+    float block[64];
+    for (int c = 0; c < num_components; ++c) {
+        const BlockPlane& p = r.planes[c];
+        const float box = 1.0f / static_cast<float>(p.sx * p.sy);
+
+        for (int by = 0; by < p.blocks_h; ++by) {
+            for (int bx = 0; bx < p.blocks_w; ++bx) {
+                // Block footprint in region (full-resolution) coordinates
+                const cv::Rect footprint(bx * 8 * p.sx, by * 8 * p.sy, 8 * p.sx, 8 * p.sy);
+                const cv::Rect in_image(footprint.x + region.x, footprint.y + region.y,
+                                        footprint.width, footprint.height);
+                if ((in_image & watermark).empty()) continue;
+
+                // Box-downsample the edited pixels into the block
+                for (int y = 0; y < 8; ++y) {
+                    for (int x = 0; x < 8; ++x) {
+                        float sum = 0.0f;
+                        for (int dy = 0; dy < p.sy; ++dy) {
+                            const size_t row = static_cast<size_t>(footprint.y + y * p.sy + dy) * region.width;
+                            for (int dx = 0; dx < p.sx; ++dx) {
+                                sum += ycc[c][row + footprint.x + x * p.sx + dx];
+                            }
+                        }
+                        block[y * 8 + x] = sum * box;
+                    }
+                }
+
+                fdct_block(block, 8, p.quant, p.blocks[by * p.blocks_w + bx]);
+            }
+        }
+    }
+}
+
+/**
+ * Decode coefficients, patch, and re-emit the JPEG into job.output
+ *
+ * libjpeg reports errors by longjmp'ing back to the setjmp below, so this
+ * frame and every frame a libjpeg call runs under hold only trivially
+ * destructible locals. The pixel work (patch_region()) runs between
+ * libjpeg calls, on blocks copied out of and back into the coefficient
+ * arrays.
+ */
+bool transcode_jpeg(const unsigned char* data, size_t size, PatchJob& job) {
+    jpeg_decompress_struct src;
+    jpeg_compress_struct dst;
+    jpeg::ErrorManager err;
+    std::memset(&src, 0, sizeof(src));
+    std::memset(&dst, 0, sizeof(dst));
+
+    src.err = jpeg_std_error(&err.pub);
+    err.pub.error_exit = jpeg::on_error;
+    err.pub.output_message = jpeg::on_output;
+    dst.err = &err.pub;
+
+    if (setjmp(err.jump)) {
+        spdlog::warn("JPEG patch failed: {}", err.message);
+        jpeg_destroy_compress(&dst);
+        jpeg_destroy_decompress(&src);
+        return false;
+    }
+
+    jpeg_create_decompress(&src);
+    jpeg_create_compress(&dst);
+
+    jpeg_mem_src(&src, data, static_cast<unsigned long>(size));
+
+    // Keep every APPn/COM marker so metadata survives
+    jpeg_save_markers(&src, JPEG_COM, 0xFFFF);
+    for (int m = 0; m < 16; ++m) {
+        jpeg_save_markers(&src, JPEG_APP0 + m, 0xFFFF);
+    }
+
+    jpeg_read_header(&src, TRUE);
+
+    bool supported = true;
+    if (src.data_precision != 8) {
+        job.unsupported = "data precision is not 8 bits";
+        supported = false;
+    } else if (!(src.num_components == 1 && src.jpeg_color_space == JCS_GRAYSCALE) &&
+               !(src.num_components == 3 && src.jpeg_color_space == JCS_YCbCr)) {
+        job.unsupported = "color space is not grayscale or YCbCr";
+        supported = false;
+    } else {
+        for (jpeg_saved_marker_ptr m = src.marker_list; m != nullptr; m = m->next) {
+            if (jpeg::read_exif_orientation(m) != 1) {
+                job.unsupported = "EXIF orientation is set";
+                supported = false;
+                break;
+            }
+        }
+    }
+
+    if (!supported) {
+        jpeg_destroy_compress(&dst);
+        jpeg_destroy_decompress(&src);
+        return false;
+    }
+
+    jvirt_barray_ptr* arrays = jpeg_read_coefficients(&src);
+
+    PatchRegion region;
+    supported = plan_patch(&src, job, region);
+    if (supported && !region.watermark.empty()) {
+        read_region_blocks(&src, arrays, region);
+        try {
+            patch_region(region, job);
+        } catch (const std::exception& e) {
+            job.unsupported = e.what();
+            supported = false;
+        }
+        if (supported) {
+            write_region_blocks(&src, arrays, region);
+        }
+    }
+    if (!supported) {
+        jpeg_destroy_compress(&dst);
+        jpeg_destroy_decompress(&src);
+        return false;
+    }
+
+    // Same quantization tables, sampling, entropy coder and scan mode as
+    // the input. libjpeg keeps neither the input's Huffman tables nor its
+    // scan script once the coefficients are read: Huffman tables are
+    // recomputed for these coefficients, and a progressive input gets the
+    // standard progression script rather than its own.
+    jpeg_copy_critical_parameters(&src, &dst);
+    dst.arith_code = src.arith_code;
+    dst.optimize_coding = src.arith_code ? FALSE : TRUE;
+    dst.restart_interval = src.restart_interval;
+    if (src.progressive_mode) {
+        jpeg_simple_progression(&dst);
+    }
+
+    jpeg_mem_dest(&dst, &job.output, &job.output_size);
+    jpeg_write_coefficients(&dst, arrays);
+
+    // Copy saved markers, except the JFIF/Adobe headers libjpeg writes itself
+    for (jpeg_saved_marker_ptr m = src.marker_list; m != nullptr; m = m->next) {
+        if (dst.write_JFIF_header && m->marker == JPEG_APP0 &&
+            jpeg::marker_has_prefix(m, "JFIF\0", 5)) {
+            continue;
+        }
+        if (dst.write_Adobe_marker && m->marker == JPEG_APP0 + 14 &&
+            jpeg::marker_has_prefix(m, "Adobe", 5)) {
+            continue;
+        }
+        jpeg_write_marker(&dst, m->marker, m->data, m->data_length);
+    }
+
+    jpeg_finish_compress(&dst);
+    jpeg_finish_decompress(&src);
+
+    jpeg_destroy_compress(&dst);
+    jpeg_destroy_decompress(&src);
+    return true;
+}
+
+} // namespace
+
+bool patch_jpeg(
+    const unsigned char* data,
+    size_t size,
+    std::vector<unsigned char>& output,
+    bool remove,
+    const WatermarkEngine& engine,
+    std::optional<WatermarkSize> force_size,
+    const std::string& label) {
+    ScopedStageTimer timer(Stage::Patch);
+    if (size < 4 || data[0] != 0xFF || data[1] != 0xD8) {
+        return false;
+    }
+
+    PatchJob job;
+    job.engine = &engine;
+    job.remove = remove;
+    job.force_size = force_size;
+
+    bool ok = transcode_jpeg(data, size, job);
+    if (!ok) {
+        if (!job.unsupported.empty()) {
+            spdlog::debug("JPEG patch not applicable to {}: {}", label, job.unsupported);
+        }
+        std::free(job.output);
+        return false;
+    }
+
+    spdlog::info("Processing: {} (DCT patch)", label);
+
+    output.assign(job.output, job.output + job.output_size);
+    std::free(job.output);
+    return true;
+}
+
+bool patch_jpeg(
+    const std::filesystem::path& input_path,
+    const std::filesystem::path& output_path,
+    bool remove,
+    const WatermarkEngine& engine,
+    std::optional<WatermarkSize> force_size) {
+    MappedFile input;
+    if (!input.open(input_path)) {
+        return false;
+    }
+
+    std::vector<unsigned char> output;
+    if (!patch_jpeg(input.data(), input.size(), output, remove, engine, force_size,
+                    input_path.filename().string())) {
+        return false;
+    }
+    input.close();  // Unmap first: output_path may be input_path
+
+    if (!write_file(output_path, output)) {
+        spdlog::error("Failed to write image: {}", output_path.string());
+        return false;
+    }
+    return true;
+}
+
+} // namespace gwt
@@ -0,0 +1,66 @@
+#pragma once
+
+#include "watermark_engine.hpp"
+
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace gwt {
+
+/**
+ * Patch the watermark corner of a JPEG in the DCT domain
+ *
+ * Instead of decoding the whole frame and re-encoding it at quality 100,
+ * this reads the quantized DCT coefficients, reconstructs pixels only for
+ * the MCUs overlapping the watermark rectangle, applies the blend there,
+ * and re-quantizes just the 8x8 blocks that intersect the watermark using
+ * the file's own quantization tables. Every other block is written back
+ * with its original coefficients, so the rest of the image suffers no
+ * generation loss and the output stays the size of the input.
+ *
+ * Supports 8-bit baseline/progressive grayscale and YCbCr JPEGs. Files with
+ * other color spaces, unusual sampling factors or an EXIF orientation are
+ * left to the regular decode/encode path. The output keeps the input's
+ * entropy coder (Huffman or arithmetic) and scan mode, but Huffman tables
+ * are re-optimized and a progressive input gets libjpeg's standard scan
+ * script.
+ *
+ * @param input_path   Input JPEG path
+ * @param output_path  Output JPEG path (may equal input_path)
+ * @param remove       Remove watermark (true) or add watermark (false)
+ * @param engine       The watermark engine to use
+ * @param force_size   Force a specific watermark size
+ * @return             True if the output was written; false if the file is
+ *                     not supported by this path (nothing is written)
+ */
+bool patch_jpeg(
+    const std::filesystem::path& input_path,
+    const std::filesystem::path& output_path,
+    bool remove,
+    const WatermarkEngine& engine,
+    std::optional<WatermarkSize> force_size = std::nullopt
+);
+
+/**
+ * In-memory variant of patch_jpeg()
+ *
+ * @param data    Encoded JPEG bytes (e.g. a MappedFile view)
+ * @param size    Number of bytes at data
+ * @param output  Receives the patched file
+ * @param label   Name used in log messages
+ * @return        True if output was produced; false if the input is not
+ *                supported by this path
+ */
+bool patch_jpeg(
+    const unsigned char* data,
+    size_t size,
+    std::vector<unsigned char>& output,
+    bool remove,
+    const WatermarkEngine& engine,
+    std::optional<WatermarkSize> force_size = std::nullopt,
+    const std::string& label = "<memory>"
+);
+
+} // namespace gwt
@@ -22,13 +22,22 @@
   *   GeminiWatermarkTool image.jpg                            (standalone: in-place)
   *   GeminiWatermarkTool -i input.jpg -o output.jpg --remove
   *   GeminiWatermarkTool -i input.jpg -o output.jpg --add     (normal mode only)
+  *   GeminiWatermarkTool -i input_dir --analyze               (corner report, no output)
+  *   GeminiWatermarkTool -i in_dir -o out_dir --skip-clean    (leave clean images alone)
+  *   GeminiWatermarkTool -i in_dir -o out_dir --incremental   (only new/changed inputs)
+  *   GeminiWatermarkTool -i in_dir -o out_dir --recursive     (mirror subdirectories)
+  *   GeminiWatermarkTool --serve /run/gwt.sock                (daemon, see serve.hpp)
+  *   cat in.png | GeminiWatermarkTool -i - -o - --format png > out.png
   *
   * @see https://github.com/allenk/GeminiWatermarkTool
   */
 
 #include "watermark_engine.hpp"
+#include "batch_runner.hpp"
+#include "region_reader.hpp"
+#include "serve.hpp"
+#include "stage_stats.hpp"
 #include "ascii_logo.hpp"
-#include "embedded_assets.hpp"
 
 #include <CLI/CLI.hpp>
 #include <spdlog/spdlog.h>
@@ -47,6 +56,8 @@
 // =============================================================================
 #ifdef _WIN32
     #include <windows.h>
+    #include <fcntl.h>
+    #include <io.h>
 #endif
 
 namespace fs = std::filesystem;
@@ -76,6 +87,38 @@ void setup_console() {
     // Unix-like systems (Linux, macOS) support ANSI by default
 }
 
+/**
+ * Switch stdin/stdout to binary mode for image streaming (no-op on Unix)
+ */
+void set_binary_stdio() {
+#ifdef _WIN32
+    _setmode(_fileno(stdin), _O_BINARY);
+    _setmode(_fileno(stdout), _O_BINARY);
+#endif
+}
+
+// "-" as a path means stdin (input) or stdout (output)
+bool is_stdio_path(const std::string& path) {
+    return path == "-";
+}
+
+// True if the command line sends image data to stdout, in which case
+// nothing else may be printed there (checked before CLI parsing so the
+// banner can be suppressed)
+bool writes_image_to_stdout(int argc, char** argv) {
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        if ((arg == "-o" || arg == "--output") && i + 1 < argc && is_stdio_path(argv[i + 1])) {
+            return true;
+        }
+        // Value attached to the option, as CLI11 also accepts
+        if (arg == "--output=-" || arg == "-o-") {
+            return true;
+        }
+    }
+    return false;
+}
+
 // =============================================================================
 // Logo and Banner printing
 // =============================================================================
@@ -93,6 +136,135 @@ void print_banner() {
     fmt::print("\n");
 }
 
+void print_pipeline_report(const gwt::PipelineReport& report) {
+    fmt::print("\nPipeline summary ({:.2f}s wall)\n", report.wall_time);
+    fmt::print("  {:<14} {:>7} {:>7} {:>10} {:>10} {:>10}\n",
+               "stage", "threads", "items", "busy(s)", "starved(s)", "blocked(s)");
+    for (const auto& stage : report.stages) {
+        fmt::print("  {:<14} {:>7} {:>7} {:>10.2f} {:>10.2f} {:>10.2f}\n",
+                   stage.name, stage.threads, stage.items,
+                   stage.busy, stage.starved, stage.blocked);
+    }
+    fmt::print("  {:<14} {:>7} {:>9} {:>9}\n", "queue", "depth", "max", "avg");
+    for (const auto& queue : report.queues) {
+        fmt::print("  {:<14} {:>7} {:>9} {:>9.2f}\n",
+                   queue.name, queue.capacity, queue.max_depth, queue.avg_depth);
+    }
+}
+
+void print_stats_report(const gwt::StatsReport& report, std::FILE* out) {
+    fmt::print(out, "\nStage timings ({:.2f}s wall)\n", report.wall_time);
+    fmt::print(out, "  {:<14} {:>7} {:>10} {:>9} {:>9} {:>9} {:>9}\n",
+               "stage", "count", "total(ms)", "p50(ms)", "p95(ms)", "p99(ms)", "max(ms)");
+    for (const auto& stage : report.stages) {
+        fmt::print(out, "  {:<14} {:>7} {:>10.1f} {:>9.2f} {:>9.2f} {:>9.2f} {:>9.2f}\n",
+                   stage.name, stage.count, stage.total_ms,
+                   stage.p50_ms, stage.p95_ms, stage.p99_ms, stage.max_ms);
+    }
+    fmt::print(out, "  {:<14} {:>7} {:>10}\n", "format", "images", "images/s");
+    for (const auto& format : report.formats) {
+        fmt::print(out, "  {:<14} {:>7} {:>10.2f}\n",
+                   format.format, format.images, format.images_per_second);
+    }
+    if (!report.encodes.empty()) {
+        fmt::print(out, "  {:<14} {:>7} {:>10} {:>9} {:>9} {:>9}\n",
+                   "encode profile", "count", "total(ms)", "p50(ms)", "p95(ms)", "avg(KiB)");
+        for (const auto& encode : report.encodes) {
+            fmt::print(out, "  {:<14} {:>7} {:>10.1f} {:>9.2f} {:>9.2f} {:>9.1f}\n",
+                       encode.profile + " " + encode.format, encode.count, encode.total_ms,
+                       encode.p50_ms, encode.p95_ms, encode.avg_kib);
+        }
+    }
+}
+
+// Analysis mode: report the watermark corner of each image without writing anything.
+// Only the watermark strip is decoded where the format allows it.
+int run_analyze(const fs::path& input, const gwt::WatermarkEngine& engine,
+                std::optional<gwt::WatermarkSize> force_size) {
+    std::vector<fs::path> files;
+    if (fs::is_directory(input)) {
+        for (const auto& entry : fs::directory_iterator(input)) {
+            if (entry.is_regular_file() && gwt::is_supported_image(entry.path())) {
+                files.push_back(entry.path());
+            }
+        }
+        std::sort(files.begin(), files.end());
+    } else {
+        files.push_back(input);
+    }
+
+    int fail_count = 0;
+    for (const auto& file : files) {
+        auto region = gwt::load_watermark_region(file, engine, force_size);
+        if (!region) {
+            spdlog::error("Failed to load image: {}", file.string());
+            ++fail_count;
+            continue;
+        }
+
+        const cv::Scalar mean = region->pixels.empty() ? cv::Scalar() : cv::mean(region->pixels);
+        // A full-decode fallback keeps gray/BGRA; the strip readers return BGR
+        const size_t pixel_bytes = region->pixels.empty() ? 3 : region->pixels.elemSize();
+        const double decoded_kb = static_cast<double>(region->pixels.total() * pixel_bytes) / 1024.0;
+        const double full_kb = static_cast<double>(region->image_size.area()) * pixel_bytes / 1024.0;
+        const gwt::WatermarkMatch match = engine.locate_watermark(
+            region->pixels, region->rect, region->image_size, force_size);
+
+        fmt::print("{}: {}x{}, watermark {}x{} at ({}, {}), corner mean ({:.1f}, {:.1f}, {:.1f}), "
+                   "confidence {:.2f}, {} decode {:.0f} of {:.0f} KB\n",
+                   file.filename().string(),
+                   region->image_size.width, region->image_size.height,
+                   match.rect.width, match.rect.height, match.rect.x, match.rect.y,
+                   mean[0], mean[1], mean[2], match.confidence,
+                   region->partial ? "strip" : "full", decoded_kb, full_kb);
+    }
+
+    return (fail_count > 0) ? 1 : 0;
+}
+
+// Streaming mode: either end may be stdin/stdout ("-"). The image is decoded
+// and encoded in memory; nothing touches the disk except a named input/output.
+int run_stream(const std::string& input_path, const std::string& output_path,
+               const std::string& format, const gwt::WatermarkEngine& engine,
+               std::optional<gwt::WatermarkSize> force_size, std::optional<double> skip_clean) {
+    std::vector<unsigned char> input;
+    const bool input_ok = is_stdio_path(input_path)
+        ? gwt::read_stream(stdin, input)
+        : gwt::read_file(fs::path(input_path), input);
+    if (!input_ok || input.empty()) {
+        spdlog::error("Failed to read input: {}", is_stdio_path(input_path) ? "<stdin>" : input_path);
+        return 1;
+    }
+
+    // Output format: --format, else the output extension, else same as input
+    std::string ext = format;
+    if (ext.empty() && !is_stdio_path(output_path)) {
+        ext = fs::path(output_path).extension().string();
+    }
+
+    // A clean input still has to produce an output: it goes through as is
+    const std::string label = is_stdio_path(input_path) ? "<stdin>" : input_path;
+    const bool clean = skip_clean &&
+        gwt::is_clean_image(input.data(), input.size(), label, engine, force_size, *skip_clean);
+
+    std::vector<unsigned char> output;
+    const bool ok = clean ? gwt::convert_image_buffer(input.data(), input.size(), ext, output)
+                          : gwt::process_image_buffer(input, ext, output, true, engine, force_size);
+    if (!ok) {
+        spdlog::error("Failed to process image from {}", label);
+        return 1;
+    }
+
+    const bool output_ok = is_stdio_path(output_path)
+        ? gwt::write_stream(stdout, output)
+        : gwt::write_file(fs::path(output_path), output);
+    if (!output_ok) {
+        spdlog::error("Failed to write output: {}", is_stdio_path(output_path) ? "<stdout>" : output_path);
+        return 1;
+    }
+    return 0;
+}
+
 // Check if running in simple mode: just a single file argument
 bool is_simple_mode(int argc, char** argv) {
     if (argc == 2) {
@@ -129,11 +301,8 @@ int run_simple_mode(const std::string& filepath) {
     }
 
     try {
-        // Initialize engine with embedded assets
-        gwt::WatermarkEngine engine(
-            gwt::embedded::bg_48_png, gwt::embedded::bg_48_png_size,
-            gwt::embedded::bg_96_png, gwt::embedded::bg_96_png_size
-        );
+        // Initialize engine with the built-in alpha maps
+        gwt::WatermarkEngine engine;
 
         spdlog::info("Processing: {} (in-place)", input.filename().string());
 
@@ -158,9 +327,15 @@ int main(int argc, char** argv) {
     }
     setup_console();
 
+    // stdout carries image bytes in streaming mode; keep it clean
+    const bool image_to_stdout = writes_image_to_stdout(argc, argv);
+
     CLI::App app{"Gemini Watermark Tool (Standalone) - Remove visible watermarks"};
-    app.footer("\nSimple usage: GeminiWatermarkTool <image>  (in-place edit)");
-    print_banner();
+    app.footer("\nSimple usage: GeminiWatermarkTool <image>  (in-place edit)"
+               "\nStreaming:    GeminiWatermarkTool -i - -o - --format png  (stdin -> stdout)");
+    if (!image_to_stdout) {
+        print_banner();
+    }
 
     app.set_version_flag("-V,--version", APP_VERSION);
 
@@ -168,12 +343,15 @@ int main(int argc, char** argv) {
     std::string input_path;
     std::string output_path;
 
-    app.add_option("-i,--input", input_path, "Input image file or directory")
-        ->required()
-        ->check(CLI::ExistingPath);
+    app.add_option("-i,--input", input_path, "Input image file or directory (- = stdin)")
+        ->check(CLI::ExistingPath | CLI::IsMember({"-"}));
+
+    app.add_option("-o,--output", output_path, "Output image file or directory (- = stdout)");
 
-    app.add_option("-o,--output", output_path, "Output image file or directory")
-        ->required();
+    std::string format;
+    app.add_option("--format", format,
+        "Output format when streaming (png, jpg, webp, bmp); "
+        "default: output extension, else the input format");
 
     // Operation mode
     bool remove_mode = false;
@@ -191,6 +369,147 @@ int main(int argc, char** argv) {
     app.add_flag("--force-large", force_large,
         "Force use of 96x96 watermark regardless of image size");
 
+    // Watermark detection
+    bool skip_clean = false;
+    double detect_threshold = gwt::kDefaultDetectThreshold;
+
+    app.add_flag("--skip-clean", skip_clean,
+        "Leave images without a detected watermark untouched (no re-encode, no output written; "
+        "streams and --serve pass the input through)");
+    app.add_option("--detect-threshold", detect_threshold,
+        "Confidence below which --skip-clean treats an image as clean")
+        ->check(CLI::Range(0.0, 1.0))
+        ->capture_default_str();
+
+    // Position search
+    bool search = false;
+    bool search_scale = false;
+    int search_radius = gwt::kDefaultSearchRadius;
+
+    app.add_flag("--search", search,
+        "Locate the watermark (both sizes, nearby offsets) instead of trusting the fixed layout; "
+        "for resized or cropped Gemini images");
+    app.add_option("--search-radius", search_radius,
+        "Pixels around the expected position examined by --search")
+        ->check(CLI::Range(1, 64))
+        ->capture_default_str();
+    app.add_flag("--search-scale", search_scale,
+        "Also match watermarks of images resized after generation (logo size and sub-pixel "
+        "offset); implies --search");
+
+    // Analysis (read-only)
+    bool analyze = false;
+
+    app.add_flag("--analyze", analyze,
+        "Report the watermark corner of each input without writing output "
+        "(decodes only the watermark strip where possible)");
+
+    // Daemon mode
+    std::string serve_path;
+    int idle_timeout = 60;
+
+    app.add_option("--serve", serve_path,
+        "Serve requests on a Unix domain socket until SIGINT/SIGTERM "
+        "(keeps the engine and workers resident)");
+    app.add_option("--idle-timeout", idle_timeout,
+        "Daemon: close connections idle for this many seconds (0 = never)")
+        ->check(CLI::NonNegativeNumber);
+
+    // Batch parallelism
+    size_t jobs = 0;
+
+    app.add_option("-j,--jobs", jobs,
+        "Worker threads for directory processing and --serve (0 = all cores)")
+        ->check(CLI::NonNegativeNumber);
+
+    // Staged pipeline (directory processing)
+    bool pipeline = false;
+    gwt::PipelineOptions pipeline_options;
+
+    app.add_flag("--pipeline", pipeline,
+        "Overlap reading, blending and encoding in separate thread stages");
+    app.add_option("--readers", pipeline_options.readers,
+        "Pipeline read/decode threads (0 = auto)")
+        ->check(CLI::NonNegativeNumber);
+    app.add_option("--blenders", pipeline_options.blenders,
+        "Pipeline blend threads (0 = auto)")
+        ->check(CLI::NonNegativeNumber);
+    app.add_option("--encoders", pipeline_options.encoders,
+        "Pipeline encode threads (0 = auto)")
+        ->check(CLI::NonNegativeNumber);
+    app.add_option("--queue-depth", pipeline_options.queue_depth,
+        "Pipeline inter-stage queue capacity (0 = auto)")
+        ->check(CLI::NonNegativeNumber);
+
+    std::string io_backend = "posix";
+
+    app.add_option("--io-backend", io_backend,
+        "Directory file I/O: posix, or io_uring (Linux; falls back to posix if unavailable)")
+        ->check(CLI::IsMember({"posix", "io_uring"}));
+    app.add_option("--io-depth", pipeline_options.io_depth,
+        "Pipeline input files read at once with io_uring (0 = auto)")
+        ->check(CLI::NonNegativeNumber);
+
+    // Incremental directory runs
+    bool incremental = false;
+
+    app.add_flag("--incremental", incremental,
+        "Skip inputs unchanged since the last run with the same settings "
+        "(manifest kept in the output directory)");
+
+    // Directory trees
+    bool recursive = false;
+
+    app.add_flag("--recursive", recursive,
+        "Process subdirectories too, mirroring the input tree under the output directory");
+
+    // Stage timing
+    bool stats = false;
+    std::string stats_json;
+
+    app.add_flag("--stats", stats,
+        "Print per-stage timings (p50/p95/p99) and images/sec per format when done");
+    app.add_option("--stats-json", stats_json,
+        "Write the --stats report as JSON to this file (implies --stats)");
+
+    // Encoder settings
+    std::string profile = "default";
+    int jpeg_quality = 0;
+    std::string jpeg_subsampling;
+    std::string jpeg_optimize;
+    std::string jpeg_progressive;
+    int png_level = -1;
+    std::string png_strategy;
+    int webp_quality = 0;
+    int webp_method = -1;
+    std::string preserve_source = "on";
+
+    app.add_option("--profile", profile,
+        "Encoder preset: default (JPEG q100, PNG 6, lossless WebP), fast, balanced, archival")
+        ->check(CLI::IsMember({"default", "fast", "balanced", "archival"}))
+        ->capture_default_str();
+    app.add_option("--jpeg-quality", jpeg_quality, "JPEG quality (overrides --profile)")
+        ->check(CLI::Range(1, 100));
+    app.add_option("--jpeg-subsampling", jpeg_subsampling, "JPEG chroma subsampling: auto, 444, 422, 420")
+        ->check(CLI::IsMember({"auto", "444", "422", "420", "4:4:4", "4:2:2", "4:2:0"}));
+    app.add_option("--jpeg-optimize", jpeg_optimize, "JPEG optimized Huffman tables: on, off")
+        ->check(CLI::IsMember({"on", "off"}));
+    app.add_option("--jpeg-progressive", jpeg_progressive, "Progressive JPEG: on, off")
+        ->check(CLI::IsMember({"on", "off"}));
+    app.add_option("--png-level", png_level, "PNG zlib compression level")
+        ->check(CLI::Range(0, 9));
+    app.add_option("--png-strategy", png_strategy, "PNG zlib strategy: default, filtered, huffman, rle, fixed")
+        ->check(CLI::IsMember({"default", "filtered", "huffman", "rle", "fixed"}));
+    app.add_option("--webp-quality", webp_quality, "WebP quality, 101 = lossless")
+        ->check(CLI::Range(1, 101));
+    app.add_option("--webp-method", webp_method,
+        "WebP effort, 0 (fastest) to 6 (smallest); other than 4 needs a libwebp build")
+        ->check(CLI::Range(0, 6));
+    app.add_option("--preserve-source", preserve_source,
+        "Follow a JPEG input's quality (as a cap) and subsampling, keep its ICC profile and EXIF: on, off")
+        ->check(CLI::IsMember({"on", "off"}))
+        ->capture_default_str();
+
     // Verbosity
     bool verbose = false;
     bool quiet = false;
@@ -204,8 +523,8 @@ int main(int argc, char** argv) {
     // Standalone mode: always remove
     remove_mode = true;
 
-    // Configure logging
-    auto logger = spdlog::stdout_color_mt("gwt");
+    // Configure logging (stderr when stdout carries the image)
+    auto logger = image_to_stdout ? spdlog::stderr_color_mt("gwt") : spdlog::stdout_color_mt("gwt");
     spdlog::set_default_logger(logger);
 
     if (quiet) {
@@ -216,6 +535,16 @@ int main(int argc, char** argv) {
         spdlog::set_level(spdlog::level::info);
     }
 
+    const bool serve = !serve_path.empty();
+    if (input_path.empty() && !serve) {
+        spdlog::error("--input is required (or use --serve)");
+        return 1;
+    }
+    if (output_path.empty() && !analyze && !serve) {
+        spdlog::error("--output is required (or use --analyze)");
+        return 1;
+    }
+
     // Determine force size option
     std::optional<gwt::WatermarkSize> force_size;
     if (force_small && force_large) {
@@ -230,11 +559,67 @@ int main(int argc, char** argv) {
     }
 
     try {
-        // Initialize engine with embedded assets
-        gwt::WatermarkEngine engine(
-            gwt::embedded::bg_48_png, gwt::embedded::bg_48_png_size,
-            gwt::embedded::bg_96_png, gwt::embedded::bg_96_png_size
-        );
+        // Initialize engine with the built-in alpha maps
+        gwt::WatermarkEngine engine;
+        if (search || search_scale) {
+            engine.set_search_radius(search_radius);
+            engine.set_scale_search(search_scale);
+        }
+
+        // Encoder profile plus per-format overrides
+        gwt::EncoderSettings encoder = gwt::encoder_profile(*gwt::parse_encode_profile(profile));
+        if (jpeg_quality > 0) encoder.jpeg.quality = jpeg_quality;
+        if (!jpeg_subsampling.empty()) encoder.jpeg.subsampling = *gwt::parse_chroma_subsampling(jpeg_subsampling);
+        if (!jpeg_optimize.empty()) encoder.jpeg.optimize = jpeg_optimize == "on";
+        if (!jpeg_progressive.empty()) encoder.jpeg.progressive = jpeg_progressive == "on";
+        if (png_level >= 0) encoder.png.level = png_level;
+        if (!png_strategy.empty()) encoder.png.strategy = *gwt::parse_png_strategy(png_strategy);
+        if (webp_quality > 0) encoder.webp.quality = webp_quality;
+        if (webp_method >= 0) encoder.webp.method = webp_method;
+        encoder.preserve_source = preserve_source == "on";
+        gwt::set_encoder_settings(encoder);
+        spdlog::debug("Encoder: {}", gwt::describe_encoder_settings(encoder));
+
+        if (stats || !stats_json.empty()) {
+            gwt::enable_stage_stats();
+        }
+
+        // Emit the --stats report after whichever mode ran
+        auto finish = [&](int exit_code) {
+            if (!gwt::stage_stats_enabled()) {
+                return exit_code;
+            }
+            const gwt::StatsReport report = gwt::stage_stats_report();
+            print_stats_report(report, image_to_stdout ? stderr : stdout);
+            if (!stats_json.empty()) {
+                const std::string json = gwt::stats_report_json(report);
+                if (!gwt::write_file(fs::path(stats_json), std::vector<unsigned char>(json.begin(), json.end()))) {
+                    spdlog::error("Failed to write {}", stats_json);
+                    return 1;
+                }
+            }
+            return exit_code;
+        };
+
+        if (serve) {
+            gwt::ServeOptions serve_options;
+            serve_options.jobs = jobs;
+            serve_options.force_size = force_size;
+            serve_options.idle_timeout = std::chrono::seconds(idle_timeout);
+            serve_options.skip_clean = skip_clean;
+            serve_options.detect_threshold = detect_threshold;
+            return finish(gwt::run_server(fs::path(serve_path), engine, serve_options));
+        }
+
+        if (analyze) {
+            return finish(run_analyze(fs::path(input_path), engine, force_size));
+        }
+
+        if (is_stdio_path(input_path) || is_stdio_path(output_path)) {
+            set_binary_stdio();
+            return finish(run_stream(input_path, output_path, format, engine, force_size,
+                                     skip_clean ? std::optional<double>(detect_threshold) : std::nullopt));
+        }
 
         // Check if it's a single file or directory
         fs::path input(input_path);
@@ -245,43 +630,45 @@ int main(int argc, char** argv) {
 
         if (fs::is_directory(input)) {
             // Batch processing
-            if (!fs::exists(output)) {
-                fs::create_directories(output);
-            }
-
             spdlog::info("Batch processing directory: {}", input.string());
 
-            for (const auto& entry : fs::directory_iterator(input)) {
-                if (!entry.is_regular_file()) continue;
-
-                std::string ext = entry.path().extension().string();
-                // Convert to lowercase for comparison
-                std::transform(ext.begin(), ext.end(), ext.begin(), ::tolower);
-
-                if (ext != ".jpg" && ext != ".jpeg" && ext != ".png" &&
-                    ext != ".webp" && ext != ".bmp") {
-                    continue;
-                }
-
-                fs::path out_file = output / entry.path().filename();
-
-                // Pass force_size to process_image
-                if (gwt::process_image(entry.path(), out_file, remove_mode, engine, force_size)) {
-                    success_count++;
-                } else {
-                    fail_count++;
-                }
+            gwt::BatchOptions batch_options;
+            batch_options.jobs = jobs;
+            batch_options.force_size = force_size;
+            batch_options.pipeline = pipeline;
+            batch_options.pipeline_options = pipeline_options;
+            batch_options.pipeline_options.io_backend = *gwt::parse_io_backend(io_backend);
+            if (skip_clean) {
+                batch_options.skip_clean = detect_threshold;
             }
+            batch_options.incremental = incremental;
+            batch_options.recursive = recursive;
+
+            gwt::BatchResult result = gwt::run_batch(input, output, remove_mode, engine, batch_options);
+            success_count = static_cast<int>(result.succeeded);
+            fail_count = static_cast<int>(result.failed);
 
             fmt::print(fmt::fg(fmt::color::green), "\n[OK] Completed: {} succeeded", success_count);
+            if (result.skipped > 0) {
+                fmt::print(fmt::fg(fmt::color::yellow), ", {} skipped (clean)", result.skipped);
+            }
+            if (result.unchanged > 0) {
+                fmt::print(fmt::fg(fmt::color::yellow), ", {} unchanged", result.unchanged);
+            }
             if (fail_count > 0) {
                 fmt::print(fmt::fg(fmt::color::red), ", {} failed", fail_count);
             }
             fmt::print("\n");
 
+            if (result.pipeline) {
+                print_pipeline_report(*result.pipeline);
+            }
+
         } else {
             // Single file processing - pass force_size
-            if (gwt::process_image(input, output, remove_mode, engine, force_size)) {
+            if (skip_clean && gwt::is_clean_image(input, engine, force_size, detect_threshold)) {
+                fmt::print(fmt::fg(fmt::color::yellow), "[OK] Skipped (no watermark): {}\n", input.string());
+            } else if (gwt::process_image(input, output, remove_mode, engine, force_size)) {
                 success_count = 1;
                 fmt::print(fmt::fg(fmt::color::green), "[OK] Success: {}\n", output.string());
             } else {
@@ -289,7 +676,7 @@ int main(int argc, char** argv) {
             }
         }
 
-        return (fail_count > 0) ? 1 : 0;
+        return finish((fail_count > 0) ? 1 : 0);
 
     } catch (const std::exception& e) {
         spdlog::error("Fatal error: {}", e.what());
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <cstddef>
+#include <filesystem>
+#include <vector>
+
+namespace gwt {
+
+/**
+ * Read-only view of a whole input file
+ *
+ * Files of at least kMapThreshold bytes are memory-mapped (mmap with
+ * MADV_SEQUENTIAL on POSIX, a file mapping on Windows) and decoders read
+ * the page cache directly: no copy into a heap buffer, and the pages are
+ * dropped from RSS under pressure instead of being swapped. Smaller files,
+ * and files that cannot be mapped (pipes, some network filesystems), are
+ * read into an owned buffer, since a mapping costs more than the copy.
+ *
+ * The view is valid until the object is destroyed or reopened. Inputs must
+ * not be truncated while mapped (the process would get SIGBUS); batch runs
+ * do not modify inputs until after they have been decoded.
+ */
+class MappedFile {
+public:
+    /**
+     * Files smaller than this are read instead of mapped
+     */
+    static constexpr size_t kMapThreshold = 64 * 1024;
+
+    MappedFile() = default;
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    /**
+     * Map (or read) a file, releasing any previous one
+     *
+     * @return  True if successful; empty files succeed with size() == 0
+     */
+    bool open(const std::filesystem::path& path);
+
+    /**
+     * Release the mapping or buffer
+     */
+    void close();
+
+    const unsigned char* data() const { return data_; }
+    size_t size() const { return size_; }
+    bool empty() const { return size_ == 0; }
+
+    /**
+     * Whether the contents are mapped rather than copied
+     */
+    bool mapped() const { return mapping_ != nullptr; }
+
+private:
+    const unsigned char* data_ = nullptr;
+    size_t size_ = 0;
+    void* mapping_ = nullptr;               // Base of the mapped view, if any
+#ifdef _WIN32
+    void* mapping_handle_ = nullptr;        // File mapping object backing mapping_
+#endif
+    std::vector<unsigned char> buffer_;     // Contents of a file that was read
+};
+
+} // namespace gwt
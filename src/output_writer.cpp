@@ -0,0 +1,511 @@
+/**
+ * @file    output_writer.cpp
+ * @brief   Gemini Watermark Tool - Atomic, Batched Output Writes
+ * @author  AllenK (Kwyshell)
+ * @date    2026.10.18
+ * @license MIT
+ *
+ * @details
+ * rename() is atomic but not durable on its own: after a power loss the
+ * new name can point at data that never reached the disk, so the
+ * temporary is synced before the rename and the directory after it.
+ * An fsync costs a device cache flush (milliseconds on SSDs, far more on
+ * spinning disks); syncing a batch back to back lets the device coalesce
+ * them, and starting writeback while the rest of the batch is still being
+ * written means most of the data is already on its way by then.
+ *
+ * @see https://github.com/allenk/GeminiWatermarkTool
+ */
+
+#include "output_writer.hpp"
+#include "stage_stats.hpp"
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <system_error>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace gwt {
+
+namespace fs = std::filesystem;
+
+namespace {
+
+// Attempts at finding an unused temporary name before giving up
+constexpr int kTempAttempts = 16;
+
+// Larger outputs are written with plain calls (io_uring lengths are 32-bit)
+constexpr size_t kMaxRingWrite = size_t{1} << 30;
+
+// A temporary file that becomes target once committed
+struct TempFile {
+    fs::path path;
+    fs::path target;
+#ifdef _WIN32
+    HANDLE handle = INVALID_HANDLE_VALUE;
+#else
+    int fd = -1;
+#endif
+};
+
+std::atomic<uint64_t> temp_counter{0};
+
+// Hidden, and with an extension batch runs never pick up as input
+fs::path temp_name(const fs::path& target, uint64_t n) {
+#ifdef _WIN32
+    const unsigned long pid = GetCurrentProcessId();
+#else
+    const long pid = static_cast<long>(getpid());
+#endif
+    return target.parent_path() /
+           ("." + target.filename().string() + ".gwt-" + std::to_string(pid) + "-" +
+            std::to_string(n) + ".tmp");
+}
+
+#ifdef _WIN32
+
+bool create_temp(const fs::path& target, TempFile& file) {
+    for (int attempt = 0; attempt < kTempAttempts; ++attempt) {
+        const fs::path path = temp_name(target, temp_counter.fetch_add(1));
+        HANDLE handle = CreateFileW(path.c_str(), GENERIC_WRITE, 0, nullptr, CREATE_NEW,
+                                    FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+        if (handle != INVALID_HANDLE_VALUE) {
+            file.path = path;
+            file.target = target;
+            file.handle = handle;
+            return true;
+        }
+        if (GetLastError() != ERROR_FILE_EXISTS) {
+            return false;
+        }
+    }
+    return false;
+}
+
+bool write_all(TempFile& file, const unsigned char* data, size_t size) {
+    while (size > 0) {
+        const DWORD chunk = static_cast<DWORD>(std::min<size_t>(size, 1u << 30));
+        DWORD written = 0;
+        if (!WriteFile(file.handle, data, chunk, &written, nullptr) || written == 0) {
+            return false;
+        }
+        data += written;
+        size -= written;
+    }
+    return true;
+}
+
+void start_writeback(TempFile&) {}
+
+bool sync_temp(TempFile& file) {
+    return FlushFileBuffers(file.handle) != 0;
+}
+
+void close_temp(TempFile& file) {
+    if (file.handle != INVALID_HANDLE_VALUE) {
+        CloseHandle(file.handle);
+        file.handle = INVALID_HANDLE_VALUE;
+    }
+}
+
+bool rename_temp(TempFile& file) {
+    return MoveFileExW(file.path.c_str(), file.target.c_str(),
+                       MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH) != 0;
+}
+
+// MOVEFILE_WRITE_THROUGH already made the rename durable
+void sync_directory(const fs::path&) {}
+
+#else
+
+bool create_temp(const fs::path& target, TempFile& file) {
+    // Keep the permissions of the file being replaced
+    struct stat st;
+    const bool replacing = ::stat(target.c_str(), &st) == 0;
+
+    for (int attempt = 0; attempt < kTempAttempts; ++attempt) {
+        const fs::path path = temp_name(target, temp_counter.fetch_add(1));
+        const int fd = ::open(path.c_str(), O_WRONLY | O_CREAT | O_EXCL | O_CLOEXEC, 0666);
+        if (fd >= 0) {
+            if (replacing) {
+                (void)::fchmod(fd, st.st_mode & 07777);
+            }
+            file.path = path;
+            file.target = target;
+            file.fd = fd;
+            return true;
+        }
+        if (errno != EEXIST) {
+            return false;
+        }
+    }
+    return false;
+}
+
+bool write_all(TempFile& file, const unsigned char* data, size_t size) {
+    while (size > 0) {
+        const ssize_t written = ::write(file.fd, data, size);
+        if (written < 0) {
+            if (errno == EINTR) continue;
+            return false;
+        }
+        data += written;
+        size -= static_cast<size_t>(written);
+    }
+    return true;
+}
+
+// Queue the dirty pages for writeback without waiting, so the sync that
+// follows mostly finds them written already
+void start_writeback(TempFile& file) {
+#if defined(__linux__) && !defined(__ANDROID__)
+    (void)::sync_file_range(file.fd, 0, 0, SYNC_FILE_RANGE_WRITE);
+#else
+    (void)file;
+#endif
+}
+
+bool sync_temp(TempFile& file) {
+#if defined(__APPLE__)
+    return ::fsync(file.fd) == 0;
+#else
+    return ::fdatasync(file.fd) == 0;
+#endif
+}
+
+void close_temp(TempFile& file) {
+    if (file.fd >= 0) {
+        ::close(file.fd);
+        file.fd = -1;
+    }
+}
+
+bool rename_temp(TempFile& file) {
+    return ::rename(file.path.c_str(), file.target.c_str()) == 0;
+}
+
+void sync_directory(const fs::path& dir) {
+    const fs::path path = dir.empty() ? fs::path(".") : dir;
+    const int fd = ::open(path.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+    if (fd >= 0) {
+        (void)::fsync(fd);
+        ::close(fd);
+    }
+}
+
+#endif
+
+void discard_temp(TempFile& file) {
+    close_temp(file);
+    std::error_code ec;
+    fs::remove(file.path, ec);
+}
+
+// Temporary written and writeback started; false (nothing left behind) on failure
+bool write_temp(const fs::path& target, const unsigned char* data, size_t size, TempFile& file) {
+    if (!create_temp(target, file)) {
+        return false;
+    }
+    if (!write_all(file, data, size)) {
+        discard_temp(file);
+        return false;
+    }
+    start_writeback(file);
+    return true;
+}
+
+// Close and, if the data reached the disk, rename; the temporary is
+// removed on failure
+bool finish_temp(TempFile& file, bool synced) {
+    close_temp(file);
+    if (!synced || !rename_temp(file)) {
+        discard_temp(file);
+        return false;
+    }
+    return true;
+}
+
+// Sync, close and rename
+bool commit_temp(TempFile& file) {
+    return finish_temp(file, sync_temp(file));
+}
+
+} // namespace
+
+bool replace_file(const fs::path& path, const unsigned char* data, size_t size) {
+    TempFile file;
+    {
+        ScopedStageTimer timer(Stage::Write);
+        if (!write_temp(path, data, size, file)) {
+            return false;
+        }
+    }
+    ScopedStageTimer timer(Stage::Sync);
+    if (!commit_temp(file)) {
+        return false;
+    }
+    sync_directory(path.parent_path());
+    return true;
+}
+
+// =============================================================================
+// OutputWriter
+// =============================================================================
+
+struct OutputWriter::Staged {
+    TempFile file;
+    std::vector<unsigned char> data;    // Held until the ring has written it
+    WriteCallback done;
+    bool ok = false;
+    bool in_ring = false;               // Write and sync submitted to the ring
+};
+
+OutputWriter::OutputWriter(size_t queue_depth, IoBackend backend)
+    : queue_(queue_depth),
+      spare_limit_(std::max<size_t>(queue_depth, 1) + kSyncBatch) {
+    if (backend == IoBackend::IoUring) {
+        if (io_uring_available()) {
+            // A write and a sync per file of a full batch
+            ring_ = std::make_unique<IoRing>(static_cast<unsigned>(2 * kSyncBatch));
+        }
+        if (!ring_ || !ring_->ready()) {
+            spdlog::warn("io_uring is not available, writing outputs with POSIX file I/O");
+            ring_.reset();
+        }
+    }
+    thread_ = std::thread([this] { run(); });
+}
+
+OutputWriter::~OutputWriter() {
+    close();
+}
+
+bool OutputWriter::submit(
+    const fs::path& path,
+    std::vector<unsigned char>&& data,
+    WriteCallback done) {
+    return queue_.push(Job{path, std::move(data), std::move(done)});
+}
+
+std::vector<unsigned char> OutputWriter::acquire_buffer() {
+    std::lock_guard<std::mutex> lock(spare_mutex_);
+    if (spare_.empty()) {
+        return {};
+    }
+    std::vector<unsigned char> buffer = std::move(spare_.back());
+    spare_.pop_back();
+    return buffer;
+}
+
+void OutputWriter::close() {
+    std::lock_guard<std::mutex> lock(close_mutex_);
+    queue_.close();
+    if (thread_.joinable()) {
+        thread_.join();
+    }
+}
+
+OutputWriterStats OutputWriter::stats() const {
+    OutputWriterStats s;
+    s.written = written_;
+    s.failed = failed_;
+    s.batches = batches_;
+    s.busy = static_cast<double>(busy_ns_) / 1e9;
+    s.queue = queue_.stats();
+    return s;
+}
+
+void OutputWriter::run() {
+    using Clock = std::chrono::steady_clock;
+
+    std::vector<Staged> batch;
+    batch.reserve(kSyncBatch);
+    while (auto job = queue_.pop()) {
+        const auto t0 = Clock::now();
+        stage(std::move(*job), batch);
+
+        // Whatever else is already waiting joins this batch
+        while (batch.size() < kSyncBatch) {
+            auto next = queue_.try_pop();
+            if (!next) break;
+            stage(std::move(*next), batch);
+        }
+        commit(batch);
+        busy_ns_ += std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - t0).count();
+    }
+}
+
+void OutputWriter::stage(Job&& job, std::vector<Staged>& batch) {
+    Staged staged;
+    staged.done = std::move(job.done);
+
+    const fs::path dir = job.path.parent_path();
+    std::error_code ec;
+    if (!dir.empty()) {
+        ScopedStageTimer timer(Stage::Mkdir);
+        fs::create_directories(dir, ec);
+    }
+
+    {
+        ScopedStageTimer timer(Stage::Write);
+        if (ring_) {
+            // Written together with the rest of the batch by write_ring()
+            staged.ok = !ec && create_temp(job.path, staged.file);
+        } else {
+            staged.ok = !ec && write_temp(job.path, job.data.data(), job.data.size(), staged.file);
+        }
+    }
+    if (!staged.ok) {
+        spdlog::error("Failed to write image: {}", job.path.string());
+    }
+
+    if (ring_ && staged.ok) {
+        staged.data = std::move(job.data);
+    } else {
+        recycle(std::move(job.data));
+    }
+    batch.push_back(std::move(staged));
+}
+
+void OutputWriter::commit(std::vector<Staged>& batch) {
+    std::vector<fs::path> dirs;
+    {
+        ScopedStageTimer timer(Stage::Sync);
+        if (ring_) {
+            write_ring(batch);
+        }
+        for (Staged& staged : batch) {
+            if (!staged.ok) {
+                if (staged.in_ring) {
+                    discard_temp(staged.file);
+                }
+                continue;
+            }
+            staged.ok = staged.in_ring || ring_ ? finish_temp(staged.file, true) : commit_temp(staged.file);
+            if (!staged.ok) {
+                spdlog::error("Failed to write image: {}", staged.file.target.string());
+                continue;
+            }
+            fs::path dir = staged.file.target.parent_path();
+            if (std::find(dirs.begin(), dirs.end(), dir) == dirs.end()) {
+                dirs.push_back(std::move(dir));
+            }
+        }
+        for (const fs::path& dir : dirs) {
+            sync_directory(dir);
+        }
+    }
+    batches_++;
+
+    for (Staged& staged : batch) {
+        recycle(std::move(staged.data));
+        if (staged.ok) {
+            written_++;
+        } else {
+            failed_++;
+        }
+        if (!staged.done) continue;
+        try {
+            staged.done(staged.ok);
+        } catch (const std::exception& e) {
+            spdlog::error("Error finishing {}: {}", staged.file.target.string(), e.what());
+        }
+    }
+    batch.clear();
+}
+
+#ifdef GWT_HAVE_IO_URING
+
+void OutputWriter::write_ring(std::vector<Staged>& batch) {
+    // Tag 2i is file i's write, 2i + 1 the sync linked behind it; a failed
+    // or short write cancels its sync
+    size_t pending = 0;
+    for (size_t i = 0; i < batch.size(); ++i) {
+        Staged& staged = batch[i];
+        if (!staged.ok) continue;
+        if (staged.data.size() > kMaxRingWrite) {
+            staged.ok = write_all(staged.file, staged.data.data(), staged.data.size()) &&
+                        sync_temp(staged.file);
+            continue;
+        }
+        // The ring has room for a write and a sync per file of a full batch
+        ring_->write(staged.file.fd, staged.data.data(), static_cast<unsigned>(staged.data.size()),
+                     0, 2 * i, true);
+        ring_->fsync(staged.file.fd, true, 2 * i + 1);
+        staged.in_ring = true;
+        pending += 2;
+    }
+
+    IoRing::Completion c;
+    while (pending > 0) {
+        if (!ring_->wait(c)) {
+            spdlog::error("io_uring wait failed: {}", std::strerror(errno));
+            if (!ring_->drain()) {
+                // The kernel may still read the buffers and use the fds:
+                // fail those files, unlink their temporaries and leave the
+                // rest alone
+                for (Staged& staged : batch) {
+                    if (!staged.in_ring) continue;
+                    staged.ok = false;
+                    std::error_code ec;
+                    fs::remove(staged.file.path, ec);
+                    staged.file.fd = -1;
+                    strand_buffer(std::move(staged.data));
+                }
+                ring_.reset();
+                return;
+            }
+            // Nothing is in flight any more, but which writes landed is
+            // unknown; redo them with the plain calls
+            for (Staged& staged : batch) {
+                if (!staged.in_ring) continue;
+                staged.ok = write_all(staged.file, staged.data.data(), staged.data.size()) &&
+                            sync_temp(staged.file);
+            }
+            ring_.reset();
+            return;
+        }
+        pending--;
+        Staged& staged = batch[c.tag / 2];
+        const bool is_write = (c.tag % 2) == 0;
+        if (c.result < 0 ||
+            (is_write && static_cast<size_t>(c.result) != staged.data.size())) {
+            staged.ok = false;
+        }
+    }
+}
+
+#else
+
+void OutputWriter::write_ring(std::vector<Staged>&) {}
+
+#endif
+
+void OutputWriter::recycle(std::vector<unsigned char>&& buffer) {
+    if (buffer.capacity() == 0) {
+        return;
+    }
+    buffer.clear();
+    std::lock_guard<std::mutex> lock(spare_mutex_);
+    if (spare_.size() < spare_limit_) {
+        spare_.push_back(std::move(buffer));
+    }
+}
+
+} // namespace gwt
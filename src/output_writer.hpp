@@ -0,0 +1,155 @@
+#pragma once
+
+#include "bounded_queue.hpp"
+#include "io_ring.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace gwt {
+
+/**
+ * Replace a file atomically and durably
+ *
+ * The bytes go to a temporary file next to path, which is flushed to disk
+ * and then renamed over path; the directory is synced after the rename.
+ * A crash at any point leaves either the old file or the complete new
+ * one (plus at worst a stray ".<name>.gwt-*.tmp"), never a truncated
+ * output, which matters when path is the input being processed in place.
+ * An existing file's permission bits are kept.
+ *
+ * The directory must exist.
+ *
+ * @return  True if path now holds the bytes
+ */
+bool replace_file(const std::filesystem::path& path, const unsigned char* data, size_t size);
+
+/**
+ * Called once per submitted write with whether it was committed; runs on
+ * the writer's I/O thread
+ */
+using WriteCallback = std::function<void(bool ok)>;
+
+/**
+ * Totals of an OutputWriter, valid after close()
+ */
+struct OutputWriterStats {
+    size_t written = 0;
+    size_t failed = 0;
+    size_t batches = 0;         // Sync rounds (one flush of up to kSyncBatch files)
+    double busy = 0.0;          // Seconds the I/O thread spent writing and syncing
+    QueueStats queue;
+};
+
+/**
+ * Writes encoded outputs on a dedicated I/O thread
+ *
+ * Each output is written the way replace_file() does it (temporary file,
+ * flush, rename), but the flushes are batched: the thread writes every
+ * queued file to its temporary (starting writeback right away with
+ * sync_file_range on Linux), then syncs the whole batch, renames each file
+ * into place and syncs each directory once. Processing threads only pay
+ * for handing over the buffer, and a crash still never leaves a partial
+ * output behind.
+ *
+ * With IoBackend::IoUring the batch's writes and syncs are all submitted
+ * to an io_uring at once (each sync linked behind its write), so the
+ * device works on the whole batch in parallel instead of one file at a
+ * time; temporaries are still created and renamed with plain calls.
+ *
+ * Thread-safe. Spent buffers are kept and handed out again by
+ * acquire_buffer(), so encoders keep reusing their allocations.
+ */
+class OutputWriter {
+public:
+    /**
+     * Most files written to temporaries before they are synced together
+     */
+    static constexpr size_t kSyncBatch = 32;
+
+    /**
+     * @param queue_depth  Most buffers waiting for the I/O thread; submit()
+     *                     blocks beyond that
+     * @param backend      File I/O backend; falls back to Posix (with a
+     *                     warning) if io_uring is unavailable
+     */
+    explicit OutputWriter(size_t queue_depth, IoBackend backend = IoBackend::Posix);
+
+    /**
+     * Commits everything still queued (see close())
+     */
+    ~OutputWriter();
+
+    OutputWriter(const OutputWriter&) = delete;
+    OutputWriter& operator=(const OutputWriter&) = delete;
+
+    /**
+     * Queue bytes to be stored at path (parent directories are created)
+     *
+     * @param done  Optional completion callback, see WriteCallback
+     * @return      False if the writer is closed (done is not called)
+     */
+    bool submit(
+        const std::filesystem::path& path,
+        std::vector<unsigned char>&& data,
+        WriteCallback done = {}
+    );
+
+    /**
+     * An empty buffer, with the capacity of a previously written one if
+     * any is spare
+     */
+    std::vector<unsigned char> acquire_buffer();
+
+    /**
+     * Write and sync everything queued, then stop the I/O thread
+     *
+     * Every callback has run when this returns. Idempotent.
+     */
+    void close();
+
+    OutputWriterStats stats() const;
+
+    /**
+     * The backend actually in use
+     */
+    IoBackend backend() const { return ring_ ? IoBackend::IoUring : IoBackend::Posix; }
+
+private:
+    struct Job {
+        std::filesystem::path path;
+        std::vector<unsigned char> data;
+        WriteCallback done;
+    };
+    struct Staged;
+
+    void run();
+    void stage(Job&& job, std::vector<Staged>& batch);
+    void commit(std::vector<Staged>& batch);
+    void write_ring(std::vector<Staged>& batch);
+    void recycle(std::vector<unsigned char>&& buffer);
+
+    BoundedQueue<Job> queue_;
+    size_t spare_limit_;
+    std::unique_ptr<IoRing> ring_;  // Only used by the I/O thread
+
+    std::mutex spare_mutex_;
+    std::vector<std::vector<unsigned char>> spare_;
+
+    std::mutex close_mutex_;
+    std::thread thread_;
+
+    // Only touched by the I/O thread until it has been joined
+    size_t written_ = 0;
+    size_t failed_ = 0;
+    size_t batches_ = 0;
+    int64_t busy_ns_ = 0;
+};
+
+} // namespace gwt
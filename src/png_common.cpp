@@ -0,0 +1,218 @@
+/**
+ * @file    png_common.cpp
+ * @brief   Gemini Watermark Tool - PNG Chunk and Scanline Helpers
+ * @author  AllenK (Kwyshell)
+ * @date    2026.10.18
+ * @license MIT
+ *
+ * @details
+ * Minimal PNG plumbing shared by the region-only re-encoder and the
+ * partial (strip) reader: chunk splitting, CRCs, and the five scanline
+ * filters.
+ *
+ * @see https://github.com/allenk/GeminiWatermarkTool
+ */
+
+#include "png_common.hpp"
+
+#include <zlib.h>
+
+#include <cstdlib>
+#include <cstring>
+
+namespace gwt::png {
+
+namespace {
+
+constexpr unsigned char kSignature[8] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+
+unsigned char paeth(int a, int b, int c) {
+    const int p = a + b - c;
+    const int pa = std::abs(p - a), pb = std::abs(p - b), pc = std::abs(p - c);
+    if (pa <= pb && pa <= pc) return static_cast<unsigned char>(a);
+    if (pb <= pc) return static_cast<unsigned char>(b);
+    return static_cast<unsigned char>(c);
+}
+
+} // namespace
+
+// =============================================================================
+// Chunk layout
+// =============================================================================
+
+uint32_t read_be32(const unsigned char* p) {
+    return (uint32_t(p[0]) << 24) | (uint32_t(p[1]) << 16) | (uint32_t(p[2]) << 8) | uint32_t(p[3]);
+}
+
+void append_be32(std::vector<unsigned char>& out, uint32_t v) {
+    out.push_back(static_cast<unsigned char>(v >> 24));
+    out.push_back(static_cast<unsigned char>(v >> 16));
+    out.push_back(static_cast<unsigned char>(v >> 8));
+    out.push_back(static_cast<unsigned char>(v));
+}
+
+bool parse(const unsigned char* data, size_t size, Layout& png, std::string& reason) {
+    if (size < 8 || std::memcmp(data, kSignature, 8) != 0) {
+        reason = "not a PNG file";
+        return false;
+    }
+
+    png.head.assign(data, data + 8);
+
+    enum { BeforeIdat, InIdat, AfterIdat } state = BeforeIdat;
+    size_t pos = 8;
+    while (pos + 12 <= size) {
+        const uint32_t length = read_be32(&data[pos]);
+        const size_t chunk_size = size_t(length) + 12;
+        if (pos + chunk_size > size) {
+            reason = "truncated chunk";
+            return false;
+        }
+
+        const char* type = reinterpret_cast<const char*>(&data[pos + 4]);
+        const unsigned char* payload = &data[pos + 8];
+        const bool is_idat = std::memcmp(type, "IDAT", 4) == 0;
+
+        if (std::memcmp(type, "IHDR", 4) == 0) {
+            if (length != 13) {
+                reason = "bad IHDR";
+                return false;
+            }
+            png.width = static_cast<int>(read_be32(payload));
+            png.height = static_cast<int>(read_be32(payload + 4));
+            const int bit_depth = payload[8];
+            png.color_type = payload[9];
+            const int interlace = payload[12];
+
+            if (bit_depth != 8) {
+                reason = "bit depth is not 8";
+                return false;
+            }
+            if (interlace != 0) {
+                reason = "interlaced";
+                return false;
+            }
+            switch (png.color_type) {
+                case 0: png.channels = 1; break;    // Gray
+                case 2: png.channels = 3; break;    // RGB
+                case 4: png.channels = 2; break;    // Gray + alpha
+                case 6: png.channels = 4; break;    // RGBA
+                default:
+                    reason = "palette color type";
+                    return false;
+            }
+        }
+
+        if (is_idat) {
+            if (state == AfterIdat) {
+                reason = "non-consecutive IDAT chunks";
+                return false;
+            }
+            state = InIdat;
+            png.idat.insert(png.idat.end(), payload, payload + length);
+        } else {
+            if (state == InIdat) state = AfterIdat;
+            auto& out = (state == BeforeIdat) ? png.head : png.tail;
+            out.insert(out.end(), data + pos, data + pos + chunk_size);
+        }
+
+        pos += chunk_size;
+    }
+
+    if (png.channels == 0 || png.idat.size() < 2 || png.width <= 0 || png.height <= 0) {
+        reason = "missing IHDR or IDAT";
+        return false;
+    }
+    return true;
+}
+
+void append_chunk(std::vector<unsigned char>& out, const char* type,
+                  const unsigned char* data, size_t length) {
+    append_be32(out, static_cast<uint32_t>(length));
+    const size_t type_pos = out.size();
+    out.insert(out.end(), type, type + 4);
+    out.insert(out.end(), data, data + length);
+
+    uLong crc = crc32(0L, Z_NULL, 0);
+    crc = crc32(crc, &out[type_pos], static_cast<uInt>(length + 4));
+    append_be32(out, static_cast<uint32_t>(crc));
+}
+
+// =============================================================================
+// Scanline filters
+// =============================================================================
+
+bool unfilter_row(const unsigned char* filtered, const unsigned char* prev,
+                  unsigned char* raw, size_t length, int bpp) {
+    const unsigned char type = filtered[0];
+    const unsigned char* in = filtered + 1;
+
+    for (size_t i = 0; i < length; ++i) {
+        const int a = i >= size_t(bpp) ? raw[i - bpp] : 0;
+        const int b = prev[i];
+        const int c = i >= size_t(bpp) ? prev[i - bpp] : 0;
+        int predictor;
+        switch (type) {
+            case 0: predictor = 0; break;
+            case 1: predictor = a; break;
+            case 2: predictor = b; break;
+            case 3: predictor = (a + b) >> 1; break;
+            case 4: predictor = paeth(a, b, c); break;
+            default: return false;
+        }
+        raw[i] = static_cast<unsigned char>(in[i] + predictor);
+    }
+    return true;
+}
+
+void filter_row(unsigned char type, const unsigned char* raw, const unsigned char* prev,
+                unsigned char* filtered, size_t length, int bpp) {
+    filtered[0] = type;
+    unsigned char* out = filtered + 1;
+
+    for (size_t i = 0; i < length; ++i) {
+        const int a = i >= size_t(bpp) ? raw[i - bpp] : 0;
+        const int b = prev[i];
+        const int c = i >= size_t(bpp) ? prev[i - bpp] : 0;
+        int predictor;
+        switch (type) {
+            case 1: predictor = a; break;
+            case 2: predictor = b; break;
+            case 3: predictor = (a + b) >> 1; break;
+            case 4: predictor = paeth(a, b, c); break;
+            default: predictor = 0; break;
+        }
+        out[i] = static_cast<unsigned char>(raw[i] - predictor);
+    }
+}
+
+// =============================================================================
+// Pixel conversion
+// =============================================================================
+
+void row_to_bgr(const unsigned char* raw, int channels, int x0, int width, cv::Vec3b* bgr) {
+    for (int x = 0; x < width; ++x) {
+        const unsigned char* p = raw + size_t(x0 + x) * channels;
+        if (channels >= 3) {
+            bgr[x] = cv::Vec3b{p[2], p[1], p[0]};
+        } else {
+            bgr[x] = cv::Vec3b{p[0], p[0], p[0]};
+        }
+    }
+}
+
+void bgr_to_row(const cv::Vec3b* bgr, int channels, int x0, int width, unsigned char* raw) {
+    for (int x = 0; x < width; ++x) {
+        unsigned char* p = raw + size_t(x0 + x) * channels;
+        if (channels >= 3) {
+            p[0] = bgr[x][2];
+            p[1] = bgr[x][1];
+            p[2] = bgr[x][0];
+        } else {
+            p[0] = bgr[x][0];
+        }
+        // Alpha (if any) is left untouched
+    }
+}
+
+} // namespace gwt::png
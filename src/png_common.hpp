@@ -0,0 +1,75 @@
+#pragma once
+
+#include <opencv2/core.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace gwt::png {
+
+/**
+ * A PNG split into the parts the patch/region paths care about
+ *
+ * Only 8-bit, non-interlaced, non-palette images are accepted.
+ */
+struct Layout {
+    int width = 0;
+    int height = 0;
+    int channels = 0;                   // Bytes per pixel (8-bit samples)
+    int color_type = 0;
+
+    std::vector<unsigned char> head;    // Signature + chunks before IDAT
+    std::vector<unsigned char> idat;    // Concatenated IDAT payload (zlib stream)
+    std::vector<unsigned char> tail;    // Chunks after the last IDAT
+
+    size_t row_bytes() const { return size_t(width) * channels; }
+    size_t stride() const { return row_bytes() + 1; }     // Filter byte + pixels
+};
+
+/**
+ * Parse a PNG file held in memory
+ *
+ * @param reason  Set to a short explanation when false is returned
+ * @return        False if the data is not a PNG or uses an unsupported layout
+ */
+bool parse(const unsigned char* data, size_t size, Layout& png, std::string& reason);
+
+/**
+ * Append a chunk (length, type, data, CRC) to out
+ */
+void append_chunk(std::vector<unsigned char>& out, const char* type,
+                  const unsigned char* data, size_t length);
+
+uint32_t read_be32(const unsigned char* p);
+void append_be32(std::vector<unsigned char>& out, uint32_t v);
+
+/**
+ * Reconstruct one scanline
+ *
+ * @param filtered  Filter type byte followed by length filtered bytes
+ * @param prev      Reconstructed row above (all zeros for the first row)
+ * @param raw       Output row (length bytes)
+ * @return          False on an invalid filter type
+ */
+bool unfilter_row(const unsigned char* filtered, const unsigned char* prev,
+                  unsigned char* raw, size_t length, int bpp);
+
+/**
+ * Filter one scanline with the given filter type (writes 1 + length bytes)
+ */
+void filter_row(unsigned char type, const unsigned char* raw, const unsigned char* prev,
+                unsigned char* filtered, size_t length, int bpp);
+
+/**
+ * Convert width pixels starting at column x0 of a raw row to BGR (alpha dropped)
+ */
+void row_to_bgr(const unsigned char* raw, int channels, int x0, int width, cv::Vec3b* bgr);
+
+/**
+ * Write BGR pixels back into a raw row; alpha samples are left untouched
+ */
+void bgr_to_row(const cv::Vec3b* bgr, int channels, int x0, int width, unsigned char* raw);
+
+} // namespace gwt::png
@@ -0,0 +1,315 @@
+/**
+ * @file    png_patch.cpp
+ * @brief   Gemini Watermark Tool - Region-Only PNG Re-encoding
+ * @author  AllenK (Kwyshell)
+ * @date    2026.10.18
+ * @license MIT
+ *
+ * @details
+ * Only the tail of the zlib stream that covers the watermark rows is
+ * re-deflated; the rest of the compressed data is spliced in verbatim
+ * (the same technique zlib's gzappend example uses).
+ *
+ * @see https://github.com/allenk/GeminiWatermarkTool
+ */
+
+#include "png_patch.hpp"
+#include "encoder_settings.hpp"
+#include "mapped_file.hpp"
+#include "png_common.hpp"
+#include "stage_stats.hpp"
+
+#include <opencv2/core.hpp>
+#include <spdlog/spdlog.h>
+#include <zlib.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace gwt {
+
+namespace {
+
+constexpr size_t kIdatChunkSize = 1 << 20;
+
+// =============================================================================
+// zlib stream splitting
+// =============================================================================
+
+struct InflatedStream {
+    std::vector<unsigned char> filtered;    // Inflated scanlines (filter byte + pixels)
+    size_t split_in_bits = 0;               // Bit offset of the split point in the zlib stream
+    size_t split_out = 0;                   // Inflated bytes before the split point
+    int window_bits = 15;
+};
+
+/**
+ * Inflate the whole stream and find the last deflate block boundary whose
+ * uncompressed offset is <= limit
+ */
+bool inflate_with_split(const png::Layout& png, size_t limit, InflatedStream& result, std::string& reason) {
+    const unsigned char cmf = png.idat[0];
+    if ((cmf & 0x0F) != Z_DEFLATED || (png.idat[1] & 0x20) != 0) {
+        reason = "unexpected zlib header";
+        return false;
+    }
+    result.window_bits = (cmf >> 4) + 8;
+    if (result.window_bits < 9) {
+        reason = "zlib window too small to re-deflate";
+        return false;
+    }
+
+    const size_t stride = png.stride();
+    result.filtered.resize(stride * png.height);
+
+    z_stream strm;
+    std::memset(&strm, 0, sizeof(strm));
+    if (inflateInit(&strm) != Z_OK) {
+        reason = "inflateInit failed";
+        return false;
+    }
+
+    strm.next_in = const_cast<Bytef*>(png.idat.data());
+    strm.avail_in = static_cast<uInt>(png.idat.size());
+    strm.next_out = result.filtered.data();
+    strm.avail_out = static_cast<uInt>(result.filtered.size());
+
+    int ret;
+    do {
+        // Z_BLOCK stops after each block header / end-of-block code
+        ret = inflate(&strm, Z_BLOCK);
+        if (ret != Z_OK && ret != Z_STREAM_END) {
+            reason = strm.msg ? strm.msg : "corrupt zlib stream";
+            inflateEnd(&strm);
+            return false;
+        }
+
+        // Bit 128: at a block boundary; bit 64: inside the final block
+        const bool at_boundary = (strm.data_type & 128) && !(strm.data_type & 64);
+        if (ret == Z_OK && at_boundary && strm.total_out <= limit) {
+            result.split_in_bits = size_t(strm.total_in) * 8 - (strm.data_type & 7);
+            result.split_out = strm.total_out;
+        }
+    } while (ret != Z_STREAM_END);
+
+    const bool complete = strm.total_out == result.filtered.size();
+    inflateEnd(&strm);
+
+    if (!complete) {
+        reason = "inflated size does not match image size";
+        return false;
+    }
+    return true;
+}
+
+int zlib_strategy(PngStrategy strategy) {
+    switch (strategy) {
+        case PngStrategy::Default:     return Z_DEFAULT_STRATEGY;
+        case PngStrategy::Filtered:    return Z_FILTERED;
+        case PngStrategy::HuffmanOnly: return Z_HUFFMAN_ONLY;
+        case PngStrategy::Rle:         return Z_RLE;
+        case PngStrategy::Fixed:       return Z_FIXED;
+    }
+    return Z_DEFAULT_STRATEGY;
+}
+
+/**
+ * Build the new zlib stream: original bits up to the split, then the new tail
+ */
+bool deflate_tail(const png::Layout& png, const InflatedStream& stream,
+                  const std::vector<unsigned char>& tail, std::vector<unsigned char>& out) {
+    const size_t full_bytes = stream.split_in_bits / 8;
+    const int extra_bits = static_cast<int>(stream.split_in_bits % 8);
+
+    out.assign(png.idat.begin(), png.idat.begin() + full_bytes);
+
+    z_stream strm;
+    std::memset(&strm, 0, sizeof(strm));
+    // Same level and strategy a full PNG encode would use
+    const PngSettings& settings = encoder_settings().png;
+    if (deflateInit2(&strm, settings.level, Z_DEFLATED, -stream.window_bits, 8,
+                     zlib_strategy(settings.strategy)) != Z_OK) {
+        return false;
+    }
+
+    // Let the new blocks reference the data the decoder already has
+    const size_t dict_size = std::min(stream.split_out, size_t(1) << stream.window_bits);
+    if (dict_size > 0) {
+        deflateSetDictionary(&strm, stream.filtered.data() + stream.split_out - dict_size,
+                             static_cast<uInt>(dict_size));
+    }
+
+    // Bits of the last, partially consumed byte belong to the kept prefix
+    if (extra_bits > 0) {
+        const int value = png.idat[full_bytes] & ((1 << extra_bits) - 1);
+        deflatePrime(&strm, extra_bits, value);
+    }
+
+    strm.next_in = const_cast<Bytef*>(tail.data());
+    strm.avail_in = static_cast<uInt>(tail.size());
+
+    int ret;
+    unsigned char chunk[64 * 1024];
+    do {
+        strm.next_out = chunk;
+        strm.avail_out = sizeof(chunk);
+        ret = deflate(&strm, Z_FINISH);
+        if (ret == Z_STREAM_ERROR) {
+            deflateEnd(&strm);
+            return false;
+        }
+        out.insert(out.end(), chunk, chunk + (sizeof(chunk) - strm.avail_out));
+    } while (ret != Z_STREAM_END);
+    deflateEnd(&strm);
+
+    // Adler-32 of the whole uncompressed stream
+    uLong adler_head = adler32(1L, stream.filtered.data(), static_cast<uInt>(stream.split_out));
+    uLong adler_tail = adler32(1L, tail.data(), static_cast<uInt>(tail.size()));
+    png::append_be32(out, static_cast<uint32_t>(
+        adler32_combine(adler_head, adler_tail, static_cast<z_off_t>(tail.size()))));
+    return true;
+}
+
+} // namespace
+
+bool patch_png(
+    const unsigned char* data,
+    size_t size,
+    std::vector<unsigned char>& output,
+    bool remove,
+    const WatermarkEngine& engine,
+    std::optional<WatermarkSize> force_size,
+    const std::string& label) {
+    ScopedStageTimer timer(Stage::Patch);
+
+    png::Layout png;
+    std::string reason;
+    if (!png::parse(data, size, png, reason)) {
+        spdlog::debug("PNG patch not applicable to {}: {}", label, reason);
+        return false;
+    }
+
+    const cv::Size image_size(png.width, png.height);
+    const cv::Rect watermark = engine.get_processing_rect(image_size, force_size) &
+                               cv::Rect(0, 0, png.width, png.height);
+    if (watermark.empty()) {
+        output.assign(data, data + size);
+        return true;
+    }
+
+    const size_t row_bytes = png.row_bytes();
+    const size_t stride = png.stride();
+    const int first_row = watermark.y;
+    const int last_row = std::min(watermark.y + watermark.height, png.height - 1);  // Row below ROI is re-filtered too
+
+    InflatedStream stream;
+    if (!inflate_with_split(png, first_row * stride, stream, reason)) {
+        spdlog::debug("PNG patch not applicable to {}: {}", label, reason);
+        return false;
+    }
+
+    // Reconstruct raw rows [first_row - 1, last_row]
+    std::vector<unsigned char> prev(row_bytes, 0);
+    std::vector<unsigned char> current(row_bytes);
+    std::vector<unsigned char> raw(size_t(last_row - first_row + 2) * row_bytes, 0);
+    auto raw_row = [&](int y) { return &raw[size_t(y - first_row + 1) * row_bytes]; };
+
+    for (int y = 0; y <= last_row; ++y) {
+        unsigned char* dst = (y >= first_row - 1) ? raw_row(y) : current.data();
+        if (!png::unfilter_row(&stream.filtered[size_t(y) * stride], prev.data(), dst, row_bytes, png.channels)) {
+            spdlog::debug("PNG patch not applicable to {}: bad filter type", label);
+            return false;
+        }
+        std::memcpy(prev.data(), dst, row_bytes);
+    }
+
+    spdlog::info("Processing: {} ({}x{}, PNG region re-encode)",
+                 label, png.width, png.height);
+
+    // Blend the watermark rectangle
+    cv::Mat bgr(watermark.height, watermark.width, CV_8UC3);
+    for (int y = 0; y < watermark.height; ++y) {
+        png::row_to_bgr(raw_row(watermark.y + y), png.channels, watermark.x, watermark.width,
+                   bgr.ptr<cv::Vec3b>(y));
+    }
+
+    if (remove) {
+        engine.remove_watermark_region(bgr, watermark, image_size, force_size);
+    } else {
+        engine.add_watermark_region(bgr, watermark, image_size, force_size);
+    }
+
+    for (int y = 0; y < watermark.height; ++y) {
+        png::bgr_to_row(bgr.ptr<cv::Vec3b>(y), png.channels, watermark.x, watermark.width,
+                   raw_row(watermark.y + y));
+    }
+
+    // New uncompressed tail: untouched filtered bytes up to the ROI,
+    // re-filtered ROI rows (+ the row below), untouched bytes after that
+    const size_t roi_begin = size_t(first_row) * stride;
+    const size_t roi_end = size_t(last_row + 1) * stride;
+
+    std::vector<unsigned char> tail;
+    tail.reserve(stream.filtered.size() - stream.split_out);
+    tail.insert(tail.end(), stream.filtered.begin() + stream.split_out, stream.filtered.begin() + roi_begin);
+
+    const size_t refiltered_at = tail.size();
+    tail.resize(refiltered_at + (roi_end - roi_begin));
+    for (int y = first_row; y <= last_row; ++y) {
+        const unsigned char type = stream.filtered[size_t(y) * stride];
+        png::filter_row(type, raw_row(y), raw_row(y - 1),
+                   &tail[refiltered_at + size_t(y - first_row) * stride], row_bytes, png.channels);
+    }
+
+    tail.insert(tail.end(), stream.filtered.begin() + roi_end, stream.filtered.end());
+
+    std::vector<unsigned char> zdata;
+    if (!deflate_tail(png, stream, tail, zdata)) {
+        spdlog::warn("PNG patch failed for {}: deflate error", label);
+        return false;
+    }
+
+    spdlog::debug("PNG patch: kept {} of {} compressed bytes, re-deflated {} of {} bytes",
+                  stream.split_in_bits / 8, png.idat.size(), tail.size(), stream.filtered.size());
+
+    // Reassemble the file
+    output.clear();
+    output.reserve(png.head.size() + zdata.size() + png.tail.size() + 64);
+    output.insert(output.end(), png.head.begin(), png.head.end());
+    for (size_t pos = 0; pos < zdata.size(); pos += kIdatChunkSize) {
+        const size_t length = std::min(kIdatChunkSize, zdata.size() - pos);
+        png::append_chunk(output, "IDAT", zdata.data() + pos, length);
+    }
+    output.insert(output.end(), png.tail.begin(), png.tail.end());
+    return true;
+}
+
+bool patch_png(
+    const std::filesystem::path& input_path,
+    const std::filesystem::path& output_path,
+    bool remove,
+    const WatermarkEngine& engine,
+    std::optional<WatermarkSize> force_size) {
+    MappedFile input;
+    if (!input.open(input_path)) {
+        return false;
+    }
+
+    std::vector<unsigned char> output;
+    if (!patch_png(input.data(), input.size(), output, remove, engine, force_size,
+                   input_path.filename().string())) {
+        return false;
+    }
+    input.close();  // Unmap first: output_path may be input_path
+
+    if (!write_file(output_path, output)) {
+        spdlog::error("Failed to write image: {}", output_path.string());
+        return false;
+    }
+    return true;
+}
+
+} // namespace gwt
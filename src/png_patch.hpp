@@ -0,0 +1,62 @@
+#pragma once
+
+#include "watermark_engine.hpp"
+
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace gwt {
+
+/**
+ * Re-encode only the part of a PNG that contains the watermark
+ *
+ * A PNG's pixel data is one zlib stream of filtered scanlines. The stream
+ * is inflated while recording deflate block boundaries; everything up to
+ * the last boundary before the first watermark row is copied to the output
+ * bit-for-bit, and only the remainder (the watermark rows and the short
+ * tail below them) is re-filtered and re-deflated, primed with the copied
+ * bits and a 32K dictionary so the result is one valid stream again.
+ * Ancillary chunks are copied unchanged.
+ *
+ * Supports non-interlaced 8-bit grayscale, gray+alpha, RGB and RGBA.
+ * Palette, 16-bit and interlaced files are left to the regular path.
+ *
+ * @param input_path   Input PNG path
+ * @param output_path  Output PNG path (may equal input_path)
+ * @param remove       Remove watermark (true) or add watermark (false)
+ * @param engine       The watermark engine to use
+ * @param force_size   Force a specific watermark size
+ * @return             True if the output was written; false if the file is
+ *                     not supported by this path (nothing is written)
+ */
+bool patch_png(
+    const std::filesystem::path& input_path,
+    const std::filesystem::path& output_path,
+    bool remove,
+    const WatermarkEngine& engine,
+    std::optional<WatermarkSize> force_size = std::nullopt
+);
+
+/**
+ * In-memory variant of patch_png()
+ *
+ * @param data    Encoded PNG bytes (e.g. a MappedFile view)
+ * @param size    Number of bytes at data
+ * @param output  Receives the patched file
+ * @param label   Name used in log messages
+ * @return        True if output was produced; false if the input is not
+ *                supported by this path
+ */
+bool patch_png(
+    const unsigned char* data,
+    size_t size,
+    std::vector<unsigned char>& output,
+    bool remove,
+    const WatermarkEngine& engine,
+    std::optional<WatermarkSize> force_size = std::nullopt,
+    const std::string& label = "<memory>"
+);
+
+} // namespace gwt
@@ -0,0 +1,558 @@
+/**
+ * @file    region_reader.cpp
+ * @brief   Gemini Watermark Tool - Partial (Strip) Image Decoding
+ * @author  AllenK (Kwyshell)
+ * @date    2026.10.18
+ * @license MIT
+ *
+ * @details
+ * The watermark lives in a logo-sized square near the bottom-right corner,
+ * so detection and analysis never need the full frame. These readers parse
+ * the header for the dimensions and decode only the rows/columns covering
+ * the requested rectangle, keeping memory proportional to the strip
+ * instead of the image.
+ *
+ * @see https://github.com/allenk/GeminiWatermarkTool
+ */
+
+#include "region_reader.hpp"
+#include "jpeg_common.hpp"
+#include "mapped_file.hpp"
+#include "png_common.hpp"
+
+#include <spdlog/spdlog.h>
+#include <zlib.h>
+
+#ifdef GWT_HAVE_WEBP
+#include <webp/decode.h>
+#endif
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace gwt {
+
+namespace {
+
+enum class ImageFormat { Unknown, Png, Jpeg, Bmp, WebP };
+
+constexpr size_t kHeaderProbeSize = 64;
+
+uint16_t read_le16(const unsigned char* p) {
+    return static_cast<uint16_t>(p[0] | (p[1] << 8));
+}
+
+uint32_t read_le32(const unsigned char* p) {
+    return uint32_t(p[0]) | (uint32_t(p[1]) << 8) | (uint32_t(p[2]) << 16) | (uint32_t(p[3]) << 24);
+}
+
+uint32_t read_le24(const unsigned char* p) {
+    return uint32_t(p[0]) | (uint32_t(p[1]) << 8) | (uint32_t(p[2]) << 16);
+}
+
+/**
+ * Copy the first bytes of an image and identify the format by magic number
+ *
+ * The header is zero-padded, so the size parsers below can read it
+ * without bounds checks.
+ */
+ImageFormat probe_format(const unsigned char* data, size_t size,
+                         std::array<unsigned char, kHeaderProbeSize>& header) {
+    header.fill(0);
+    const size_t got = std::min(size, header.size());
+    if (got > 0) {
+        std::memcpy(header.data(), data, got);
+    }
+
+    if (got >= 24 && png::read_be32(header.data()) == 0x89504E47u) return ImageFormat::Png;
+    if (got >= 3 && header[0] == 0xFF && header[1] == 0xD8 && header[2] == 0xFF) return ImageFormat::Jpeg;
+    if (got >= 34 && header[0] == 'B' && header[1] == 'M') return ImageFormat::Bmp;
+    if (got >= 30 && std::memcmp(header.data(), "RIFF", 4) == 0 &&
+        std::memcmp(header.data() + 8, "WEBP", 4) == 0) {
+        return ImageFormat::WebP;
+    }
+    return ImageFormat::Unknown;
+}
+
+// =============================================================================
+// Header-only size parsing
+// =============================================================================
+
+std::optional<cv::Size> png_size(const std::array<unsigned char, kHeaderProbeSize>& h) {
+    if (std::memcmp(h.data() + 12, "IHDR", 4) != 0) return std::nullopt;
+    return cv::Size(static_cast<int>(png::read_be32(h.data() + 16)),
+                    static_cast<int>(png::read_be32(h.data() + 20)));
+}
+
+struct BmpInfo {
+    int width = 0;
+    int height = 0;
+    bool top_down = false;
+    int bits = 0;
+    uint32_t compression = 0;
+    uint32_t pixel_offset = 0;
+    uint32_t header_size = 0;
+};
+
+std::optional<BmpInfo> parse_bmp(const std::array<unsigned char, kHeaderProbeSize>& h) {
+    BmpInfo info;
+    info.pixel_offset = read_le32(h.data() + 10);
+    info.header_size = read_le32(h.data() + 14);
+
+    if (info.header_size == 12) {
+        // BITMAPCOREHEADER: 16-bit dimensions, always bottom-up
+        info.width = read_le16(h.data() + 18);
+        info.height = read_le16(h.data() + 20);
+        info.bits = read_le16(h.data() + 24);
+        return info;
+    }
+    if (info.header_size < 40) return std::nullopt;
+
+    const auto height = static_cast<int32_t>(read_le32(h.data() + 22));
+    info.width = static_cast<int32_t>(read_le32(h.data() + 18));
+    info.height = height < 0 ? -height : height;
+    info.top_down = height < 0;
+    info.bits = read_le16(h.data() + 28);
+    info.compression = read_le32(h.data() + 30);
+    return info;
+}
+
+std::optional<cv::Size> webp_size(const std::array<unsigned char, kHeaderProbeSize>& h) {
+    const unsigned char* chunk = h.data() + 12;
+    const unsigned char* payload = chunk + 8;
+
+    if (std::memcmp(chunk, "VP8X", 4) == 0) {
+        return cv::Size(static_cast<int>(read_le24(payload + 4)) + 1,
+                        static_cast<int>(read_le24(payload + 7)) + 1);
+    }
+    if (std::memcmp(chunk, "VP8 ", 4) == 0) {
+        // Frame tag (3 bytes) + start code 9D 01 2A + 14-bit width/height
+        if (payload[3] != 0x9D || payload[4] != 0x01 || payload[5] != 0x2A) return std::nullopt;
+        return cv::Size(read_le16(payload + 6) & 0x3FFF, read_le16(payload + 8) & 0x3FFF);
+    }
+    if (std::memcmp(chunk, "VP8L", 4) == 0) {
+        if (payload[0] != 0x2F) return std::nullopt;
+        const uint32_t bits = read_le32(payload + 1);
+        return cv::Size(static_cast<int>(bits & 0x3FFF) + 1,
+                        static_cast<int>((bits >> 14) & 0x3FFF) + 1);
+    }
+    return std::nullopt;
+}
+
+// =============================================================================
+// JPEG
+// =============================================================================
+
+struct JpegRegionJob {
+    cv::Rect roi;               // Requested rectangle (unclipped)
+    cv::Mat* output = nullptr;  // Receives the BGR rectangle (clipped)
+    bool size_only = false;
+    cv::Size size;              // Oriented image size (size_only)
+    const char* unsupported = nullptr;
+};
+
+/**
+ * Decode the rows/columns of job.roi, or just the header when size_only
+ *
+ * Only trivially destructible locals live in this frame: libjpeg reports
+ * errors by longjmp'ing back to the setjmp below.
+ */
+bool decode_jpeg_region(const unsigned char* data, size_t size, JpegRegionJob& job) {
+    jpeg_decompress_struct cinfo;
+    jpeg::ErrorManager err;
+    std::memset(&cinfo, 0, sizeof(cinfo));
+
+    cinfo.err = jpeg_std_error(&err.pub);
+    err.pub.error_exit = jpeg::on_error;
+    err.pub.output_message = jpeg::on_output;
+
+    if (setjmp(err.jump)) {
+        spdlog::debug("JPEG region read failed: {}", err.message);
+        jpeg_destroy_decompress(&cinfo);
+        return false;
+    }
+
+    jpeg_create_decompress(&cinfo);
+    jpeg_mem_src(&cinfo, data, static_cast<unsigned long>(size));
+    jpeg_save_markers(&cinfo, JPEG_APP0 + 1, 0xFFFF);
+    jpeg_read_header(&cinfo, TRUE);
+
+    int orientation = 1;
+    for (jpeg_saved_marker_ptr m = cinfo.marker_list; m != nullptr; m = m->next) {
+        orientation = jpeg::read_exif_orientation(m);
+        if (orientation != 1) break;
+    }
+
+    if (job.size_only) {
+        // cv::imread applies the EXIF rotation; 5..8 swap the axes
+        const bool swap = orientation >= 5 && orientation <= 8;
+        job.size = swap ? cv::Size(static_cast<int>(cinfo.image_height), static_cast<int>(cinfo.image_width))
+                        : cv::Size(static_cast<int>(cinfo.image_width), static_cast<int>(cinfo.image_height));
+        jpeg_destroy_decompress(&cinfo);
+        return true;
+    }
+
+    if (orientation != 1) {
+        job.unsupported = "EXIF orientation is set";
+    } else if (cinfo.num_components != 1 && cinfo.num_components != 3) {
+        job.unsupported = "CMYK/YCCK";
+    }
+    if (job.unsupported) {
+        jpeg_destroy_decompress(&cinfo);
+        return false;
+    }
+
+    const cv::Rect roi = job.roi & cv::Rect(0, 0, static_cast<int>(cinfo.image_width),
+                                            static_cast<int>(cinfo.image_height));
+    if (roi.empty()) {
+        jpeg_destroy_decompress(&cinfo);
+        return false;
+    }
+
+    job.output->create(roi.height, roi.width, CV_8UC3);
+    cinfo.out_color_space = JCS_EXT_BGR;
+    jpeg_start_decompress(&cinfo);
+
+    // Pad by one iMCU on each side so fancy chroma upsampling sees the same
+    // neighbours as a full decode; libjpeg then aligns to iMCU columns
+    const int pad = cinfo.max_h_samp_factor * DCTSIZE;
+    const int left = std::max(roi.x - pad, 0);
+    const int right = std::min(roi.x + roi.width + pad, static_cast<int>(cinfo.image_width));
+    JDIMENSION crop_x = static_cast<JDIMENSION>(left);
+    JDIMENSION crop_width = static_cast<JDIMENSION>(right - left);
+    jpeg_crop_scanline(&cinfo, &crop_x, &crop_width);
+
+    if (roi.y > 0) {
+        jpeg_skip_scanlines(&cinfo, static_cast<JDIMENSION>(roi.y));
+    }
+
+    // From the image pool, so jpeg_destroy_decompress() frees it on the
+    // error path too (a local assigned after setjmp is indeterminate there)
+    JSAMPARRAY row = (*cinfo.mem->alloc_sarray)(
+        reinterpret_cast<j_common_ptr>(&cinfo), JPOOL_IMAGE, cinfo.output_width * 3, 1);
+
+    const size_t offset = size_t(roi.x - static_cast<int>(crop_x)) * 3;
+    for (int y = 0; y < roi.height; ++y) {
+        jpeg_read_scanlines(&cinfo, row, 1);
+        std::memcpy(job.output->ptr(y), row[0] + offset, size_t(roi.width) * 3);
+    }
+
+    // Rows below the rectangle are never decoded
+    jpeg_abort_decompress(&cinfo);
+    jpeg_destroy_decompress(&cinfo);
+    return true;
+}
+
+std::optional<cv::Size> jpeg_size(const unsigned char* data, size_t size) {
+    JpegRegionJob job;
+    job.size_only = true;
+    return decode_jpeg_region(data, size, job) ? std::optional<cv::Size>(job.size) : std::nullopt;
+}
+
+cv::Mat jpeg_region(const unsigned char* data, size_t size, const cv::Rect& roi) {
+    cv::Mat output;
+    JpegRegionJob job;
+    job.roi = roi;
+    job.output = &output;
+    if (!decode_jpeg_region(data, size, job)) {
+        if (job.unsupported) {
+            spdlog::debug("JPEG region read not applicable: {}", job.unsupported);
+        }
+        return {};
+    }
+    return output;
+}
+
+// =============================================================================
+// PNG
+// =============================================================================
+
+cv::Mat png_region(const unsigned char* data, size_t size, const cv::Rect& roi) {
+    png::Layout png;
+    std::string reason;
+    if (!png::parse(data, size, png, reason)) {
+        spdlog::debug("PNG region read not applicable: {}", reason);
+        return {};
+    }
+
+    const cv::Rect clipped = roi & cv::Rect(0, 0, png.width, png.height);
+    if (clipped.empty()) return {};
+
+    // Two rows of state: the filtered input row and the reconstructed row above
+    const size_t row_bytes = png.row_bytes();
+    std::vector<unsigned char> filtered(png.stride());
+    std::vector<unsigned char> prev(row_bytes, 0);
+    std::vector<unsigned char> raw(row_bytes);
+    cv::Mat output(clipped.height, clipped.width, CV_8UC3);
+
+    z_stream strm;
+    std::memset(&strm, 0, sizeof(strm));
+    if (inflateInit(&strm) != Z_OK) return {};
+    strm.next_in = png.idat.data();
+    strm.avail_in = static_cast<uInt>(png.idat.size());
+
+    const int last_row = clipped.y + clipped.height - 1;
+    bool ok = true;
+    for (int y = 0; y <= last_row && ok; ++y) {
+        strm.next_out = filtered.data();
+        strm.avail_out = static_cast<uInt>(filtered.size());
+        while (strm.avail_out > 0) {
+            const int ret = inflate(&strm, Z_NO_FLUSH);
+            if (ret == Z_STREAM_END) {
+                ok = strm.avail_out == 0;
+                break;
+            }
+            if (ret != Z_OK) {
+                ok = false;
+                break;
+            }
+        }
+        if (!ok || !png::unfilter_row(filtered.data(), prev.data(), raw.data(), row_bytes, png.channels)) {
+            ok = false;
+            break;
+        }
+        if (y >= clipped.y) {
+            png::row_to_bgr(raw.data(), png.channels, clipped.x, clipped.width,
+                            output.ptr<cv::Vec3b>(y - clipped.y));
+        }
+        std::swap(prev, raw);
+    }
+    inflateEnd(&strm);
+
+    if (!ok) {
+        spdlog::debug("PNG region read failed: corrupt image data");
+        return {};
+    }
+    return output;
+}
+
+// =============================================================================
+// BMP
+// =============================================================================
+
+cv::Mat bmp_region(const unsigned char* data, size_t size, const cv::Rect& roi, const BmpInfo& info) {
+    // Uncompressed 24-bit, or 32-bit with the default BGRX layout
+    const bool rgb24 = info.bits == 24 && info.compression == 0;
+    const bool rgb32 = info.bits == 32 && info.compression == 0;
+    if (!rgb24 && !rgb32) {
+        spdlog::debug("BMP region read not applicable: {} bpp, compression {}",
+                      info.bits, info.compression);
+        return {};
+    }
+
+    const cv::Rect clipped = roi & cv::Rect(0, 0, info.width, info.height);
+    if (clipped.empty()) return {};
+
+    const size_t bytes_per_pixel = size_t(info.bits) / 8;
+    const size_t stride = (size_t(info.width) * bytes_per_pixel + 3) & ~size_t(3);
+
+    const size_t row_size = size_t(clipped.width) * bytes_per_pixel;
+    cv::Mat output(clipped.height, clipped.width, CV_8UC3);
+
+    for (int y = 0; y < clipped.height; ++y) {
+        const int image_row = clipped.y + y;
+        const size_t file_row = info.top_down ? size_t(image_row) : size_t(info.height - 1 - image_row);
+        const size_t offset = info.pixel_offset + file_row * stride + size_t(clipped.x) * bytes_per_pixel;
+        if (offset > size || size - offset < row_size) return {};
+
+        const unsigned char* row = data + offset;
+        auto* out = output.ptr<cv::Vec3b>(y);
+        for (int x = 0; x < clipped.width; ++x) {
+            const unsigned char* p = &row[size_t(x) * bytes_per_pixel];
+            out[x] = cv::Vec3b{p[0], p[1], p[2]};
+        }
+    }
+    return output;
+}
+
+// =============================================================================
+// WebP
+// =============================================================================
+
+#ifdef GWT_HAVE_WEBP
+cv::Mat webp_region(const unsigned char* data, size_t size, const cv::Rect& roi) {
+    WebPDecoderConfig config;
+    if (!WebPInitDecoderConfig(&config) ||
+        WebPGetFeatures(data, size, &config.input) != VP8_STATUS_OK ||
+        config.input.has_animation) {
+        return {};
+    }
+
+    const cv::Rect clipped = roi & cv::Rect(0, 0, config.input.width, config.input.height);
+    if (clipped.empty()) return {};
+
+    // libwebp may round the crop origin down to even for YUV sources
+    const int left = clipped.x & ~1;
+    const int top = clipped.y & ~1;
+    cv::Mat decoded(clipped.y + clipped.height - top, clipped.x + clipped.width - left, CV_8UC3);
+
+    config.options.use_cropping = 1;
+    config.options.crop_left = left;
+    config.options.crop_top = top;
+    config.options.crop_width = decoded.cols;
+    config.options.crop_height = decoded.rows;
+
+    config.output.colorspace = MODE_BGR;
+    config.output.is_external_memory = 1;
+    config.output.u.RGBA.rgba = decoded.data;
+    config.output.u.RGBA.stride = static_cast<int>(decoded.step);
+    config.output.u.RGBA.size = decoded.step * decoded.rows;
+
+    const VP8StatusCode status = WebPDecode(data, size, &config);
+    WebPFreeDecBuffer(&config.output);
+    if (status != VP8_STATUS_OK) {
+        spdlog::debug("WebP region read failed: status {}", int(status));
+        return {};
+    }
+
+    return decoded(cv::Rect(clipped.x - left, clipped.y - top, clipped.width, clipped.height)).clone();
+}
+#endif
+
+} // namespace
+
+std::optional<cv::Size> read_image_size(const unsigned char* data, size_t size) {
+    std::array<unsigned char, kHeaderProbeSize> header;
+    switch (probe_format(data, size, header)) {
+        case ImageFormat::Png:
+            return png_size(header);
+        case ImageFormat::Jpeg:
+            return jpeg_size(data, size);
+        case ImageFormat::Bmp:
+            if (auto info = parse_bmp(header)) return cv::Size(info->width, info->height);
+            return std::nullopt;
+        case ImageFormat::WebP:
+            return webp_size(header);
+        default:
+            return std::nullopt;
+    }
+}
+
+std::optional<cv::Size> read_image_size(const std::filesystem::path& path) {
+    MappedFile file;
+    if (!file.open(path)) return std::nullopt;
+    return read_image_size(file.data(), file.size());
+}
+
+cv::Mat read_image_region(const unsigned char* data, size_t size, const cv::Rect& roi) {
+    std::array<unsigned char, kHeaderProbeSize> header;
+    switch (probe_format(data, size, header)) {
+        case ImageFormat::Png:
+            return png_region(data, size, roi);
+        case ImageFormat::Jpeg:
+            return jpeg_region(data, size, roi);
+        case ImageFormat::Bmp:
+            if (auto info = parse_bmp(header)) return bmp_region(data, size, roi, *info);
+            return {};
+#ifdef GWT_HAVE_WEBP
+        case ImageFormat::WebP:
+            return webp_region(data, size, roi);
+#endif
+        default:
+            return {};
+    }
+}
+
+cv::Mat read_image_region(const std::filesystem::path& path, const cv::Rect& roi) {
+    MappedFile file;
+    if (!file.open(path)) return {};
+    return read_image_region(file.data(), file.size(), roi);
+}
+
+std::optional<WatermarkRegion> load_watermark_region(
+    const unsigned char* data,
+    size_t size,
+    const WatermarkEngine& engine,
+    std::optional<WatermarkSize> force_size) {
+    WatermarkRegion region;
+
+    if (auto image_size = read_image_size(data, size);
+        image_size && image_size->width > 0 && image_size->height > 0) {
+        region.image_size = *image_size;
+        region.rect = engine.get_processing_rect(*image_size, force_size) &
+                      cv::Rect(0, 0, image_size->width, image_size->height);
+        if (region.rect.empty()) {
+            region.partial = true;
+            return region;
+        }
+
+        region.pixels = read_image_region(data, size, region.rect);
+        if (!region.pixels.empty()) {
+            region.partial = true;
+            return region;
+        }
+    }
+
+    // Full decode fallback
+    cv::Mat image;
+    if (!decode_image(data, size, image)) {
+        return std::nullopt;
+    }
+
+    region.image_size = image.size();
+    region.rect = engine.get_processing_rect(image.size(), force_size) &
+                  cv::Rect(0, 0, image.cols, image.rows);
+    region.pixels = image(region.rect).clone();
+    region.partial = false;
+    return region;
+}
+
+std::optional<WatermarkRegion> load_watermark_region(
+    const std::filesystem::path& path,
+    const WatermarkEngine& engine,
+    std::optional<WatermarkSize> force_size) {
+    MappedFile file;
+    if (!file.open(path)) return std::nullopt;
+    return load_watermark_region(file.data(), file.size(), engine, force_size);
+}
+
+std::optional<double> detect_watermark_data(
+    const unsigned char* data,
+    size_t size,
+    const WatermarkEngine& engine,
+    std::optional<WatermarkSize> force_size) {
+    auto region = load_watermark_region(data, size, engine, force_size);
+    if (!region) {
+        return std::nullopt;
+    }
+    return engine.detect_watermark_region(region->pixels, region->rect, region->image_size, force_size);
+}
+
+std::optional<double> detect_watermark_file(
+    const std::filesystem::path& path,
+    const WatermarkEngine& engine,
+    std::optional<WatermarkSize> force_size) {
+    MappedFile file;
+    if (!file.open(path)) return std::nullopt;
+    return detect_watermark_data(file.data(), file.size(), engine, force_size);
+}
+
+bool is_clean_image(
+    const unsigned char* data,
+    size_t size,
+    const std::filesystem::path& path,
+    const WatermarkEngine& engine,
+    std::optional<WatermarkSize> force_size,
+    double threshold) {
+    const auto confidence = detect_watermark_data(data, size, engine, force_size);
+    if (!confidence || *confidence >= threshold) {
+        return false;
+    }
+    spdlog::info("Skipped: {} (no watermark, confidence {:.2f})", path.filename().string(), *confidence);
+    return true;
+}
+
+bool is_clean_image(
+    const std::filesystem::path& path,
+    const WatermarkEngine& engine,
+    std::optional<WatermarkSize> force_size,
+    double threshold) {
+    MappedFile file;
+    if (!file.open(path)) return false;
+    return is_clean_image(file.data(), file.size(), path, engine, force_size, threshold);
+}
+
+} // namespace gwt
@@ -0,0 +1,138 @@
+#pragma once
+
+#include "watermark_engine.hpp"
+
+#include <opencv2/core.hpp>
+
+#include <filesystem>
+#include <optional>
+
+namespace gwt {
+
+/**
+ * Read image dimensions from the file header without decoding pixels
+ *
+ * Dimensions are reported the way cv::imread would see them, i.e. with a
+ * JPEG EXIF rotation of 90/270 degrees applied.
+ *
+ * @return  Image size, or std::nullopt if the header could not be parsed
+ */
+std::optional<cv::Size> read_image_size(const std::filesystem::path& path);
+
+/**
+ * Read image dimensions from an encoded image in memory (see above)
+ */
+std::optional<cv::Size> read_image_size(const unsigned char* data, size_t size);
+
+/**
+ * Decode only a rectangle of an image
+ *
+ *   PNG   rows are inflated and unfiltered one at a time; decoding stops
+ *         after the last requested row
+ *   JPEG  libjpeg-turbo skips rows above the rectangle and crops each
+ *         scanline to the iMCU columns covering it
+ *   BMP   only the requested rows are read
+ *   WebP  libwebp cropping (when built with libwebp)
+ *
+ * The result is 8-bit BGR, matching cv::imread(IMREAD_COLOR) pixel for
+ * pixel inside the rectangle.
+ *
+ * @param path  Image file
+ * @param roi   Requested rectangle; clipped to the image
+ * @return      BGR pixels of the clipped rectangle, or an empty Mat if the
+ *              format/layout cannot be partially decoded
+ */
+cv::Mat read_image_region(const std::filesystem::path& path, const cv::Rect& roi);
+
+/**
+ * Decode only a rectangle of an encoded image in memory (see above)
+ */
+cv::Mat read_image_region(const unsigned char* data, size_t size, const cv::Rect& roi);
+
+/**
+ * The watermark corner of an image, decoded without the rest of the frame
+ */
+struct WatermarkRegion {
+    cv::Size image_size;    // Full image dimensions
+    cv::Rect rect;          // get_processing_rect() in image coordinates (clipped)
+    cv::Mat pixels;         // 8-bit gray/BGR/BGRA pixels of rect (BGR for strip decodes)
+    bool partial = false;   // True if only the strip was decoded
+};
+
+/**
+ * Load just the watermark rectangle of an image
+ *
+ * Reads the header, computes the rectangle via get_processing_rect() (the
+ * watermark plus any search margin), and decodes only that strip. Falls
+ * back to a full decode + crop for formats that cannot be partially
+ * decoded.
+ *
+ * @return  The region, or std::nullopt if the image cannot be read
+ */
+std::optional<WatermarkRegion> load_watermark_region(
+    const std::filesystem::path& path,
+    const WatermarkEngine& engine,
+    std::optional<WatermarkSize> force_size = std::nullopt
+);
+
+/**
+ * Load just the watermark rectangle of an encoded image in memory (see above)
+ */
+std::optional<WatermarkRegion> load_watermark_region(
+    const unsigned char* data,
+    size_t size,
+    const WatermarkEngine& engine,
+    std::optional<WatermarkSize> force_size = std::nullopt
+);
+
+/**
+ * Watermark confidence of an image file (see WatermarkEngine::detect_watermark)
+ *
+ * Decodes only the watermark strip where the format allows it.
+ *
+ * @return  Confidence in [0, 1], or std::nullopt if the image cannot be read
+ */
+std::optional<double> detect_watermark_file(
+    const std::filesystem::path& path,
+    const WatermarkEngine& engine,
+    std::optional<WatermarkSize> force_size = std::nullopt
+);
+
+/**
+ * Watermark confidence of an encoded image in memory (see detect_watermark_file())
+ */
+std::optional<double> detect_watermark_data(
+    const unsigned char* data,
+    size_t size,
+    const WatermarkEngine& engine,
+    std::optional<WatermarkSize> force_size = std::nullopt
+);
+
+/**
+ * The --skip-clean check: true if the image was read and scored below threshold
+ *
+ * Unreadable images return false so the normal processing path reports them.
+ */
+bool is_clean_image(
+    const std::filesystem::path& path,
+    const WatermarkEngine& engine,
+    std::optional<WatermarkSize> force_size,
+    double threshold
+);
+
+/**
+ * The --skip-clean check on an input already in memory (e.g. read by the
+ * io_uring FileLoader), so the file is not read a second time
+ *
+ * @param path  The input's path, for the log message only
+ */
+bool is_clean_image(
+    const unsigned char* data,
+    size_t size,
+    const std::filesystem::path& path,
+    const WatermarkEngine& engine,
+    std::optional<WatermarkSize> force_size,
+    double threshold
+);
+
+} // namespace gwt
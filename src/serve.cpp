@@ -0,0 +1,403 @@
+/**
+ * @file    serve.cpp
+ * @brief   Gemini Watermark Tool - Unix Socket Daemon
+ * @author  AllenK (Kwyshell)
+ * @date    2026.10.18
+ * @license MIT
+ *
+ * @details
+ * The accept loop polls the listening socket so SIGINT/SIGTERM can stop it
+ * promptly; connections are handed to the shared work-stealing pool. On
+ * shutdown the read side of every open connection is closed, so requests
+ * already being processed still get their response.
+ *
+ * @see https://github.com/allenk/GeminiWatermarkTool
+ */
+
+#include "serve.hpp"
+
+#include <spdlog/spdlog.h>
+
+#ifdef _WIN32
+
+namespace gwt {
+
+int run_server(
+    const std::filesystem::path& socket_path,
+    const WatermarkEngine& /*engine*/,
+    const ServeOptions& /*options*/) {
+    spdlog::error("--serve {} : Unix domain sockets are not supported on Windows", socket_path.string());
+    return 1;
+}
+
+} // namespace gwt
+
+#else
+
+#include "region_reader.hpp"
+#include "thread_pool.hpp"
+
+#include <poll.h>
+#include <signal.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <cerrno>
+#include <cstring>
+#include <mutex>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+namespace gwt {
+
+namespace fs = std::filesystem;
+
+namespace {
+
+constexpr size_t kRequestHeaderSize = 12;
+constexpr size_t kResponseHeaderSize = 12;
+constexpr int kAcceptPollMs = 250;
+
+std::atomic<bool> g_stop_requested{false};
+
+extern "C" void on_stop_signal(int) {
+    g_stop_requested.store(true);
+}
+
+uint32_t load_be32(const unsigned char* p) {
+    return (uint32_t(p[0]) << 24) | (uint32_t(p[1]) << 16) | (uint32_t(p[2]) << 8) | uint32_t(p[3]);
+}
+
+void store_be32(unsigned char* p, uint32_t value) {
+    p[0] = static_cast<unsigned char>(value >> 24);
+    p[1] = static_cast<unsigned char>(value >> 16);
+    p[2] = static_cast<unsigned char>(value >> 8);
+    p[3] = static_cast<unsigned char>(value);
+}
+
+// False on EOF, error or receive timeout
+bool read_exact(int fd, void* data, size_t size) {
+    auto* out = static_cast<unsigned char*>(data);
+    while (size > 0) {
+        const ssize_t got = ::recv(fd, out, size, 0);
+        if (got < 0 && errno == EINTR) {
+            continue;
+        }
+        if (got <= 0) {
+            return false;
+        }
+        out += got;
+        size -= static_cast<size_t>(got);
+    }
+    return true;
+}
+
+bool write_all(int fd, const void* data, size_t size) {
+    const auto* in = static_cast<const unsigned char*>(data);
+    while (size > 0) {
+        const ssize_t sent = ::send(fd, in, size, 0);
+        if (sent < 0 && errno == EINTR) {
+            continue;
+        }
+        if (sent <= 0) {
+            return false;
+        }
+        in += sent;
+        size -= static_cast<size_t>(sent);
+    }
+    return true;
+}
+
+bool send_response(int fd, ServeStatus status, const void* body, size_t size) {
+    unsigned char header[kResponseHeaderSize];
+    store_be32(header, kServeMagic);
+    store_be32(header + 4, static_cast<uint32_t>(status));
+    store_be32(header + 8, static_cast<uint32_t>(size));
+    return write_all(fd, header, sizeof(header)) && write_all(fd, body, size);
+}
+
+bool send_error(int fd, ServeStatus status, const std::string& message) {
+    return send_response(fd, status, message.data(), message.size());
+}
+
+/**
+ * Open connections, so shutdown can stop them waiting for the next request
+ */
+class ConnectionSet {
+public:
+    void add(int fd) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        fds_.insert(fd);
+    }
+
+    void remove(int fd) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        fds_.erase(fd);
+    }
+
+    void shutdown_reads() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (int fd : fds_) {
+            ::shutdown(fd, SHUT_RD);
+        }
+    }
+
+private:
+    std::mutex mutex_;
+    std::unordered_set<int> fds_;
+};
+
+/**
+ * Restores the previous SIGINT/SIGTERM/SIGPIPE dispositions on exit
+ */
+class SignalScope {
+public:
+    SignalScope() {
+        g_stop_requested.store(false);
+
+        struct sigaction stop {};
+        stop.sa_handler = on_stop_signal;
+        sigemptyset(&stop.sa_mask);
+        stop.sa_flags = 0;  // No SA_RESTART: poll() must return on a signal
+        sigaction(SIGINT, &stop, &old_int_);
+        sigaction(SIGTERM, &stop, &old_term_);
+
+        // A client hanging up mid-response must not kill the daemon
+        struct sigaction ignore {};
+        ignore.sa_handler = SIG_IGN;
+        sigemptyset(&ignore.sa_mask);
+        sigaction(SIGPIPE, &ignore, &old_pipe_);
+    }
+
+    ~SignalScope() {
+        sigaction(SIGINT, &old_int_, nullptr);
+        sigaction(SIGTERM, &old_term_, nullptr);
+        sigaction(SIGPIPE, &old_pipe_, nullptr);
+    }
+
+    SignalScope(const SignalScope&) = delete;
+    SignalScope& operator=(const SignalScope&) = delete;
+
+private:
+    struct sigaction old_int_ {};
+    struct sigaction old_term_ {};
+    struct sigaction old_pipe_ {};
+};
+
+std::optional<sockaddr_un> make_address(const fs::path& path) {
+    sockaddr_un address {};
+    address.sun_family = AF_UNIX;
+    const std::string native = path.string();
+    if (native.empty() || native.size() >= sizeof(address.sun_path)) {
+        return std::nullopt;
+    }
+    std::memcpy(address.sun_path, native.c_str(), native.size() + 1);
+    return address;
+}
+
+// Remove a socket file left behind by a daemon that is no longer running
+bool clear_stale_socket(const fs::path& path, const sockaddr_un& address) {
+    std::error_code ec;
+    const fs::file_status status = fs::symlink_status(path, ec);
+    if (ec || !fs::exists(status)) {
+        return true;
+    }
+    if (status.type() != fs::file_type::socket) {
+        spdlog::error("{} exists and is not a socket", path.string());
+        return false;
+    }
+
+    const int probe = ::socket(AF_UNIX, SOCK_STREAM, 0);
+    if (probe < 0) {
+        return false;
+    }
+    const bool live = ::connect(probe, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) == 0;
+    ::close(probe);
+    if (live) {
+        spdlog::error("{} is already served by another process", path.string());
+        return false;
+    }
+
+    fs::remove(path, ec);
+    return !ec;
+}
+
+int open_listener(const fs::path& path) {
+    const auto address = make_address(path);
+    if (!address) {
+        spdlog::error("Socket path is empty or too long: {}", path.string());
+        return -1;
+    }
+    if (!clear_stale_socket(path, *address)) {
+        return -1;
+    }
+
+    const int fd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd < 0) {
+        spdlog::error("socket(): {}", std::strerror(errno));
+        return -1;
+    }
+    if (::bind(fd, reinterpret_cast<const sockaddr*>(&*address), sizeof(*address)) != 0 ||
+        ::listen(fd, SOMAXCONN) != 0) {
+        spdlog::error("Cannot listen on {}: {}", path.string(), std::strerror(errno));
+        ::close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+void serve_connection(
+    int fd,
+    const WatermarkEngine& engine,
+    const ServeOptions& options,
+    std::atomic<size_t>& served) {
+    std::vector<unsigned char> payload;
+    std::vector<unsigned char> output;
+
+    while (true) {
+        unsigned char header[kRequestHeaderSize];
+        if (!read_exact(fd, header, sizeof(header))) {
+            return;  // Client closed, idle timeout, or shutdown
+        }
+
+        const uint32_t magic = load_be32(header);
+        const unsigned size_mode = header[4];
+        const size_t format_length = header[5];
+        const bool skip_clean = options.skip_clean || (header[6] & kServeFlagSkipClean) != 0;
+        const size_t payload_length = load_be32(header + 8);
+
+        if (magic != kServeMagic) {
+            send_error(fd, ServeStatus::BadRequest, "bad magic");
+            return;
+        }
+        if (size_mode > 2) {
+            send_error(fd, ServeStatus::BadRequest, "bad size mode");
+            return;
+        }
+        if (payload_length == 0 || payload_length > kServeMaxPayload) {
+            send_error(fd, ServeStatus::BadRequest, "payload length out of range");
+            return;
+        }
+
+        std::string format(format_length, '\0');
+        payload.resize(payload_length);
+        if (!read_exact(fd, format.data(), format_length) ||
+            !read_exact(fd, payload.data(), payload_length)) {
+            return;
+        }
+
+        std::optional<WatermarkSize> force_size = options.force_size;
+        if (size_mode == 1) {
+            force_size = WatermarkSize::Small;
+        } else if (size_mode == 2) {
+            force_size = WatermarkSize::Large;
+        }
+
+        const auto start = std::chrono::steady_clock::now();
+        bool ok = false;
+        bool clean = false;
+        std::string error = "failed to decode, process or encode image";
+        try {
+            clean = skip_clean && is_clean_image(payload.data(), payload.size(), "<request>",
+                                                 engine, force_size, options.detect_threshold);
+            ok = clean ? convert_image_buffer(payload.data(), payload.size(), format, output)
+                       : process_image_buffer(payload, format, output, true, engine, force_size);
+        } catch (const std::exception& e) {
+            error = e.what();
+        }
+        const double ms = std::chrono::duration<double, std::milli>(
+            std::chrono::steady_clock::now() - start).count();
+
+        const ServeStatus status = clean ? ServeStatus::Clean : ServeStatus::Ok;
+        const bool sent = ok ? send_response(fd, status, output.data(), output.size())
+                             : send_error(fd, ServeStatus::ProcessingFailed, error);
+        if (ok) {
+            served.fetch_add(1, std::memory_order_relaxed);
+            spdlog::debug("Served {} -> {} bytes in {:.1f} ms", payload_length, output.size(), ms);
+        } else {
+            spdlog::warn("Request failed after {:.1f} ms: {}", ms, error);
+        }
+        if (!sent) {
+            return;
+        }
+    }
+}
+
+} // namespace
+
+int run_server(
+    const fs::path& socket_path,
+    const WatermarkEngine& engine,
+    const ServeOptions& options) {
+    SignalScope signals;
+
+    const int listener = open_listener(socket_path);
+    if (listener < 0) {
+        return 1;
+    }
+
+    ConnectionSet connections;
+    std::atomic<size_t> served{0};
+
+    {
+        ThreadPool pool(options.jobs);
+        spdlog::info("Listening on {} ({} workers)", socket_path.string(), pool.size());
+
+        while (!g_stop_requested.load()) {
+            pollfd pfd {};
+            pfd.fd = listener;
+            pfd.events = POLLIN;
+
+            const int ready = ::poll(&pfd, 1, kAcceptPollMs);
+            if (ready <= 0) {
+                if (ready < 0 && errno != EINTR) {
+                    spdlog::error("poll(): {}", std::strerror(errno));
+                    break;
+                }
+                continue;
+            }
+
+            const int client = ::accept(listener, nullptr, nullptr);
+            if (client < 0) {
+                if (errno != EINTR && errno != EAGAIN && errno != ECONNABORTED) {
+                    spdlog::warn("accept(): {}", std::strerror(errno));
+                }
+                continue;
+            }
+
+            timeval timeout {};
+            timeout.tv_sec = static_cast<decltype(timeout.tv_sec)>(options.idle_timeout.count());
+            ::setsockopt(client, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+
+            connections.add(client);
+            pool.submit([&, client](size_t) {
+                try {
+                    serve_connection(client, engine, options, served);
+                } catch (const std::exception& e) {
+                    spdlog::error("Connection error: {}", e.what());
+                }
+                connections.remove(client);
+                ::close(client);
+            });
+        }
+
+        spdlog::info("Shutting down");
+        ::close(listener);
+        std::error_code ec;
+        fs::remove(socket_path, ec);
+
+        connections.shutdown_reads();
+        pool.wait();
+    }
+
+    spdlog::info("Served {} requests", served.load());
+    return 0;
+}
+
+} // namespace gwt
+
+#endif // _WIN32
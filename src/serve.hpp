@@ -0,0 +1,78 @@
+#pragma once
+
+#include "watermark_engine.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+
+namespace gwt {
+
+/**
+ * Daemon mode: serve watermark removal over a Unix domain socket
+ *
+ * The engine and a worker pool stay resident; clients send encoded images
+ * and get encoded images back, so per-request cost is processing only.
+ *
+ * Wire format (all integers big-endian). A connection may carry any number
+ * of request/response pairs, one at a time.
+ *
+ *   Request
+ *     u32  magic          'GWT1'
+ *     u8   size           0 = auto, 1 = force 48x48, 2 = force 96x96
+ *     u8   format_length  Length of the format field (0 = keep input format)
+ *     u8   flags          Bit 0: skip clean images (see ServeStatus::Clean)
+ *     u8   reserved       0
+ *     u32  payload_length
+ *     ...  format         Output extension, e.g. "png" or ".jpg"
+ *     ...  payload        Encoded input image
+ *
+ *   Response
+ *     u32  magic          'GWT1'
+ *     u32  status         ServeStatus
+ *     u32  body_length
+ *     ...  body           Encoded output image, or a UTF-8 error message
+ *
+ * A malformed header closes the connection after the error response.
+ */
+
+constexpr uint32_t kServeMagic = 0x47575431;    // "GWT1"
+constexpr size_t kServeMaxPayload = size_t(256) << 20;
+
+enum class ServeStatus : uint32_t {
+    Ok = 0,
+    BadRequest = 1,         // Malformed header or payload too large
+    ProcessingFailed = 2,   // Image could not be decoded, processed or encoded
+    Clean = 3,              // Skip-clean request and no watermark found: the body is
+                            // the input unchanged (re-encoded only to change format)
+};
+
+constexpr uint8_t kServeFlagSkipClean = 0x01;
+
+struct ServeOptions {
+    size_t jobs = 0;                                    // Worker threads (0 = hardware concurrency)
+    std::optional<WatermarkSize> force_size;            // Default for requests with size = 0
+    std::chrono::seconds idle_timeout{60};              // Close connections idle this long
+    bool skip_clean = false;                            // Skip clean images even without the flag
+    double detect_threshold = kDefaultDetectThreshold;  // Confidence below which an image is clean
+};
+
+/**
+ * Listen on socket_path until SIGINT/SIGTERM
+ *
+ * Each accepted connection is served by one pool worker, so up to
+ * options.jobs requests are processed at the same time; clients that want
+ * more parallelism open more connections. A stale socket file left by a
+ * previous run is replaced; a live one is an error.
+ *
+ * @return  Process exit code
+ */
+int run_server(
+    const std::filesystem::path& socket_path,
+    const WatermarkEngine& engine,
+    const ServeOptions& options = {}
+);
+
+} // namespace gwt
@@ -0,0 +1,382 @@
+/**
+ * @file    source_format.cpp
+ * @brief   Gemini Watermark Tool - Input Format Parameters and Metadata
+ * @author  AllenK (Kwyshell)
+ * @date    2026.10.18
+ * @license MIT
+ *
+ * @details
+ * JPEG quality is not stored in the file; encoders scale the IJG example
+ * tables by a quality factor, so matching the luma table against the
+ * scaled example tables recovers it (exact for libjpeg/libjpeg-turbo
+ * output, the nearest equivalent for other encoders).
+ *
+ * @see https://github.com/allenk/GeminiWatermarkTool
+ */
+
+#include "source_format.hpp"
+#include "png_common.hpp"
+
+#include <zlib.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <utility>
+
+namespace gwt {
+
+namespace {
+
+// JPEG marker segments hold at most this much payload
+constexpr size_t kMaxSegment = 65533;
+
+// APP2 ICC chunk: "ICC_PROFILE\0" + sequence number + chunk count
+constexpr size_t kIccHeader = 14;
+
+// Sanity limit for an inflated iCCP profile
+constexpr size_t kMaxIccSize = 16 << 20;
+
+// IJG example luminance table (natural order)
+constexpr int kStdLuminance[64] = {
+    16, 11, 10, 16,  24,  40,  51,  61,
+    12, 12, 14, 19,  26,  58,  60,  55,
+    14, 13, 16, 24,  40,  57,  69,  56,
+    14, 17, 22, 29,  51,  87,  80,  62,
+    18, 22, 37, 56,  68, 109, 103,  77,
+    24, 35, 55, 64,  81, 104, 113,  92,
+    49, 64, 78, 87, 103, 121, 120, 101,
+    72, 92, 95, 98, 112, 100, 103,  99,
+};
+
+// Zigzag position -> natural position (DQT stores tables in zigzag order)
+constexpr int kNaturalOrder[64] = {
+     0,  1,  8, 16,  9,  2,  3, 10, 17, 24, 32, 25, 18, 11,  4,  5,
+    12, 19, 26, 33, 40, 48, 41, 34, 27, 20, 13,  6,  7, 14, 21, 28,
+    35, 42, 49, 56, 57, 50, 43, 36, 29, 22, 15, 23, 30, 37, 44, 51,
+    58, 59, 52, 45, 38, 31, 39, 46, 53, 60, 61, 54, 47, 55, 62, 63,
+};
+
+unsigned read_be16(const unsigned char* p) {
+    return (unsigned(p[0]) << 8) | p[1];
+}
+
+// The quality whose IJG-scaled example table (jpeg_quality_scaling(),
+// jpeg_add_quant_table()) is closest to table: exact for libjpeg output,
+// including the 8-bit clamping at low qualities
+int estimate_quality(const unsigned* table, unsigned max_value) {
+    int best = 0;
+    uint64_t best_error = UINT64_MAX;
+    for (int quality = 100; quality >= 1; --quality) {
+        const long scale = quality < 50 ? 5000 / quality : 200 - quality * 2;
+        uint64_t error = 0;
+        for (int i = 0; i < 64; ++i) {
+            const long expected = std::clamp((kStdLuminance[kNaturalOrder[i]] * scale + 50) / 100,
+                                             1L, static_cast<long>(max_value));
+            error += static_cast<uint64_t>(std::labs(expected - static_cast<long>(table[i])));
+        }
+        if (error < best_error) {
+            best = quality;
+            best_error = error;
+        }
+    }
+    return best;
+}
+
+ChromaSubsampling subsampling_of(int h, int v) {
+    if (h == 1 && v == 1) return ChromaSubsampling::S444;
+    if (h == 2 && v == 1) return ChromaSubsampling::S422;
+    if (h == 2 && v == 2) return ChromaSubsampling::S420;
+    return ChromaSubsampling::Auto;
+}
+
+bool is_sof(unsigned marker) {
+    // SOF0-SOF15 except DHT (C4), JPG (C8) and DAC (CC)
+    return marker >= 0xC0 && marker <= 0xCF && marker != 0xC4 && marker != 0xC8 && marker != 0xCC;
+}
+
+// Set EXIF orientation (IFD0 tag 0x0112) to 1 in place
+void reset_orientation(std::vector<unsigned char>& tiff) {
+    if (tiff.size() < 8) return;
+    const bool little = tiff[0] == 'I' && tiff[1] == 'I';
+    auto u16 = [&](size_t off) -> unsigned {
+        return little ? (tiff[off] | (tiff[off + 1] << 8)) : ((tiff[off] << 8) | tiff[off + 1]);
+    };
+    auto u32 = [&](size_t off) -> size_t {
+        return little
+            ? (size_t(tiff[off]) | (size_t(tiff[off + 1]) << 8) |
+               (size_t(tiff[off + 2]) << 16) | (size_t(tiff[off + 3]) << 24))
+            : ((size_t(tiff[off]) << 24) | (size_t(tiff[off + 1]) << 16) |
+               (size_t(tiff[off + 2]) << 8) | size_t(tiff[off + 3]));
+    };
+
+    const size_t ifd = u32(4);
+    if (ifd + 2 > tiff.size()) return;
+    const unsigned count = u16(ifd);
+    for (unsigned i = 0; i < count; ++i) {
+        const size_t entry = ifd + 2 + size_t(i) * 12;
+        if (entry + 12 > tiff.size()) break;
+        if (u16(entry) == 0x0112) {
+            tiff[entry + 8] = little ? 1 : 0;
+            tiff[entry + 9] = little ? 0 : 1;
+            return;
+        }
+    }
+}
+
+void read_jpeg(const unsigned char* data, size_t size, SourceFormat& source) {
+    std::vector<std::pair<int, std::vector<unsigned char>>> icc_chunks;
+
+    size_t pos = 2;
+    while (pos + 4 <= size) {
+        if (data[pos] != 0xFF) break;
+        const unsigned marker = data[pos + 1];
+        if (marker == 0xFF) {           // Fill byte
+            pos++;
+            continue;
+        }
+        if (marker == 0xDA || marker == 0xD9) break;    // Entropy-coded data follows
+        if (marker == 0x01 || (marker >= 0xD0 && marker <= 0xD7)) {
+            pos += 2;
+            continue;
+        }
+
+        const size_t length = read_be16(data + pos + 2);
+        if (length < 2 || pos + 2 + length > size) break;
+        const unsigned char* seg = data + pos + 4;
+        const size_t seg_size = length - 2;
+
+        if (marker == 0xDB) {
+            // One or more tables: Pq/Tq byte, then 64 8- or 16-bit values
+            size_t i = 0;
+            while (i < seg_size) {
+                const int precision = seg[i] >> 4;
+                const int id = seg[i] & 0x0F;
+                const size_t bytes = precision ? 128 : 64;
+                if (i + 1 + bytes > seg_size) break;
+                if (id == 0) {
+                    unsigned table[64];
+                    for (int k = 0; k < 64; ++k) {
+                        table[k] = precision ? read_be16(seg + i + 1 + 2 * k) : seg[i + 1 + k];
+                        table[k] = std::max(table[k], 1u);
+                    }
+                    source.jpeg_quality = estimate_quality(table, precision ? 32767 : 255);
+                }
+                i += 1 + bytes;
+            }
+        } else if (is_sof(marker)) {
+            // P, Y, X, Nf, then Nf x (id, HV, Tq); chroma is assumed 1x1
+            if (seg_size >= 6 && seg[5] == 3 && seg_size >= 6 + 9) {
+                source.subsampling = subsampling_of(seg[7] >> 4, seg[7] & 0x0F);
+            }
+        } else if (marker == 0xE1 && seg_size > 6 && std::memcmp(seg, "Exif\0\0", 6) == 0) {
+            if (source.exif.empty()) {
+                source.exif.assign(seg + 6, seg + seg_size);
+                reset_orientation(source.exif);
+            }
+        } else if (marker == 0xE2 && seg_size > kIccHeader && std::memcmp(seg, "ICC_PROFILE\0", 12) == 0) {
+            icc_chunks.emplace_back(seg[12], std::vector<unsigned char>(seg + kIccHeader, seg + seg_size));
+        }
+        pos += 2 + length;
+    }
+
+    // Chunks are numbered from 1; reassemble only a complete, consistent set
+    std::sort(icc_chunks.begin(), icc_chunks.end(),
+              [](const auto& a, const auto& b) { return a.first < b.first; });
+    for (size_t i = 0; i < icc_chunks.size(); ++i) {
+        if (icc_chunks[i].first != static_cast<int>(i + 1)) {
+            source.icc.clear();
+            return;
+        }
+        source.icc.insert(source.icc.end(), icc_chunks[i].second.begin(), icc_chunks[i].second.end());
+    }
+}
+
+bool inflate_all(const unsigned char* data, size_t size, std::vector<unsigned char>& out) {
+    z_stream strm;
+    std::memset(&strm, 0, sizeof(strm));
+    if (inflateInit(&strm) != Z_OK) {
+        return false;
+    }
+    strm.next_in = const_cast<Bytef*>(data);
+    strm.avail_in = static_cast<uInt>(size);
+
+    out.resize(std::max<size_t>(size * 4, 4096));
+    int ret = Z_OK;
+    while (ret == Z_OK) {
+        if (strm.total_out == out.size()) {
+            if (out.size() >= kMaxIccSize) break;
+            out.resize(std::min(out.size() * 2, kMaxIccSize));
+        }
+        strm.next_out = out.data() + strm.total_out;
+        strm.avail_out = static_cast<uInt>(out.size() - strm.total_out);
+        ret = inflate(&strm, Z_NO_FLUSH);
+    }
+    out.resize(strm.total_out);
+    inflateEnd(&strm);
+    return ret == Z_STREAM_END;
+}
+
+void read_png(const unsigned char* data, size_t size, SourceFormat& source) {
+    size_t pos = 8;
+    while (pos + 12 <= size) {
+        const size_t length = png::read_be32(data + pos);
+        const unsigned char* type = data + pos + 4;
+        const unsigned char* body = data + pos + 8;
+        if (length > size - pos - 12) break;
+        if (std::memcmp(type, "IDAT", 4) == 0 || std::memcmp(type, "IEND", 4) == 0) break;
+
+        if (std::memcmp(type, "iCCP", 4) == 0) {
+            // Name (1-79 bytes), NUL, compression method 0, zlib data
+            const unsigned char* nul = static_cast<const unsigned char*>(std::memchr(body, 0, std::min<size_t>(length, 80)));
+            if (nul != nullptr && size_t(nul - body) + 2 <= length && nul[1] == 0) {
+                const size_t offset = size_t(nul - body) + 2;
+                if (!inflate_all(body + offset, length - offset, source.icc)) {
+                    source.icc.clear();
+                }
+            }
+        } else if (std::memcmp(type, "eXIf", 4) == 0) {
+            source.exif.assign(body, body + length);
+        }
+        pos += 12 + length;
+    }
+}
+
+// ICC header bytes 16-19: the data color space the profile maps from
+bool icc_color_space_matches(const std::vector<unsigned char>& icc, int channels) {
+    if (icc.size() < 128) {
+        return false;
+    }
+    const char* expected = channels == 1 ? "GRAY" : "RGB ";
+    return (channels == 1 || channels == 3 || channels == 4) &&
+           std::memcmp(icc.data() + 16, expected, 4) == 0;
+}
+
+} // namespace
+
+void SourceFormat::clear() {
+    format.clear();
+    jpeg_quality = 0;
+    subsampling = ChromaSubsampling::Auto;
+    icc.clear();
+    exif.clear();
+}
+
+bool read_source_format(const unsigned char* data, size_t size, SourceFormat& source) {
+    source.clear();
+    if (size >= 3 && data[0] == 0xFF && data[1] == 0xD8 && data[2] == 0xFF) {
+        source.format = ".jpg";
+        read_jpeg(data, size, source);
+    } else if (size >= 8 && std::memcmp(data, "\x89PNG\r\n\x1a\n", 8) == 0) {
+        source.format = ".png";
+        read_png(data, size, source);
+    } else if (size >= 12 && std::memcmp(data, "RIFF", 4) == 0 && std::memcmp(data + 8, "WEBP", 4) == 0) {
+        source.format = ".webp";
+    } else if (size >= 2 && data[0] == 'B' && data[1] == 'M') {
+        source.format = ".bmp";
+    } else {
+        return false;
+    }
+    return true;
+}
+
+EncoderSettings settings_for_source(
+    const EncoderSettings& settings,
+    const SourceFormat& source,
+    const std::string& output_ext) {
+    EncoderSettings s = settings;
+    const bool jpeg_out = output_ext == ".jpg" || output_ext == ".jpeg";
+    if (jpeg_out && source.format == ".jpg") {
+        if (source.jpeg_quality > 0) {
+            s.jpeg.quality = std::min(s.jpeg.quality, source.jpeg_quality);
+        }
+        if (s.jpeg.subsampling == ChromaSubsampling::Auto) {
+            s.jpeg.subsampling = source.subsampling;
+        }
+    }
+    return s;
+}
+
+void embed_source_metadata(
+    const SourceFormat& source,
+    const std::string& output_ext,
+    int channels,
+    std::vector<unsigned char>& encoded) {
+    // A CMYK/YCCK source is decoded to BGR: its profile does not describe
+    // the output pixels, and viewers render it wrong or reject the file
+    const bool keep_icc = icc_color_space_matches(source.icc, channels);
+    if (!keep_icc && source.exif.empty()) {
+        return;
+    }
+
+    std::vector<unsigned char> insert;
+    size_t at = 0;
+
+    if (output_ext == ".jpg" || output_ext == ".jpeg") {
+        if (encoded.size() < 4 || encoded[0] != 0xFF || encoded[1] != 0xD8) return;
+
+        // After SOI and the JFIF APP0 segment, where readers expect them
+        at = 2;
+        if (encoded[2] == 0xFF && encoded[3] == 0xE0 && encoded.size() >= 6) {
+            at = std::min(encoded.size(), 4 + size_t(read_be16(encoded.data() + 4)));
+        }
+
+        auto append_segment = [&](unsigned char marker, const char* id, size_t id_size,
+                                  const unsigned char* payload, size_t payload_size, int seq, int count) {
+            const size_t extra = seq > 0 ? 2 : 0;
+            const size_t length = 2 + id_size + extra + payload_size;
+            insert.insert(insert.end(), {0xFF, marker,
+                                         static_cast<unsigned char>(length >> 8),
+                                         static_cast<unsigned char>(length & 0xFF)});
+            insert.insert(insert.end(), id, id + id_size);
+            if (seq > 0) {
+                insert.push_back(static_cast<unsigned char>(seq));
+                insert.push_back(static_cast<unsigned char>(count));
+            }
+            insert.insert(insert.end(), payload, payload + payload_size);
+        };
+
+        if (!source.exif.empty() && source.exif.size() + 6 <= kMaxSegment) {
+            append_segment(0xE1, "Exif\0\0", 6, source.exif.data(), source.exif.size(), 0, 0);
+        }
+        if (keep_icc) {
+            const size_t chunk = kMaxSegment - kIccHeader;
+            const size_t count = (source.icc.size() + chunk - 1) / chunk;
+            if (count <= 255) {
+                for (size_t i = 0; i < count; ++i) {
+                    const size_t offset = i * chunk;
+                    const size_t n = std::min(chunk, source.icc.size() - offset);
+                    append_segment(0xE2, "ICC_PROFILE\0", 12, source.icc.data() + offset, n,
+                                   static_cast<int>(i + 1), static_cast<int>(count));
+                }
+            }
+        }
+    } else if (output_ext == ".png") {
+        // Right after IHDR: iCCP must precede PLTE and IDAT, eXIf IDAT
+        if (encoded.size() < 33 || std::memcmp(encoded.data() + 12, "IHDR", 4) != 0) return;
+        at = 8 + 12 + png::read_be32(encoded.data() + 8);
+        if (at > encoded.size()) return;
+
+        if (keep_icc) {
+            std::vector<unsigned char> body = {'I', 'C', 'C', ' ', 'P', 'r', 'o', 'f', 'i', 'l', 'e', 0, 0};
+            uLongf packed = compressBound(static_cast<uLong>(source.icc.size()));
+            const size_t header = body.size();
+            body.resize(header + packed);
+            if (compress2(body.data() + header, &packed, source.icc.data(),
+                          static_cast<uLong>(source.icc.size()), Z_DEFAULT_COMPRESSION) == Z_OK) {
+                body.resize(header + packed);
+                png::append_chunk(insert, "iCCP", body.data(), body.size());
+            }
+        }
+        if (!source.exif.empty()) {
+            png::append_chunk(insert, "eXIf", source.exif.data(), source.exif.size());
+        }
+    }
+
+    if (!insert.empty()) {
+        encoded.insert(encoded.begin() + static_cast<std::ptrdiff_t>(at), insert.begin(), insert.end());
+    }
+}
+
+} // namespace gwt
@@ -0,0 +1,71 @@
+#pragma once
+
+#include "encoder_settings.hpp"
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace gwt {
+
+/**
+ * How an input image was encoded, and the metadata worth carrying over
+ *
+ * Captured from the encoded bytes the reader already holds (headers only,
+ * no pixel decoding), so re-encoding can stay in the input's size class
+ * instead of inflating a quality-85 4:2:0 JPEG to quality 100.
+ */
+struct SourceFormat {
+    std::string format;                 // As detect_image_extension(): ".jpg", ".png", ...
+    int jpeg_quality = 0;               // IJG-equivalent quality of the luma table (0 = unknown)
+    ChromaSubsampling subsampling = ChromaSubsampling::Auto;   // Auto = unknown or unusual
+    std::vector<unsigned char> icc;     // ICC profile
+    std::vector<unsigned char> exif;    // TIFF-structured EXIF (no "Exif\0\0" prefix)
+
+    void clear();
+};
+
+/**
+ * Read the format parameters of an encoded image
+ *
+ * JPEG: quantization tables (quality), SOF sampling factors, APP1 EXIF,
+ * APP2 ICC profile. PNG: iCCP and eXIf. Other formats only set format.
+ * A JPEG's EXIF orientation is reset to 1, since decode_image() applies it
+ * to the pixels.
+ *
+ * @return  False if the data is not a recognized image
+ */
+bool read_source_format(const unsigned char* data, size_t size, SourceFormat& source);
+
+/**
+ * The settings to re-encode an image from source as output_ext
+ *
+ * JPEG to JPEG: the quality is capped at the source's (a higher setting
+ * only makes the file bigger), and the source's subsampling is used
+ * unless settings name one. Everything else is unchanged.
+ */
+EncoderSettings settings_for_source(
+    const EncoderSettings& settings,
+    const SourceFormat& source,
+    const std::string& output_ext
+);
+
+/**
+ * Carry source's ICC profile and EXIF into an encoded JPEG or PNG
+ *
+ * The profile is only kept if its data color space fits the output
+ * ("RGB " for 3/4 channels, "GRAY" for 1), so a CMYK source's profile is
+ * not attached to its BGR decode. Other output formats are left unchanged.
+ *
+ * @param output_ext  Lowercase output extension
+ * @param channels    Channels of the encoded image
+ * @param encoded     Encoder output, modified in place
+ */
+void embed_source_metadata(
+    const SourceFormat& source,
+    const std::string& output_ext,
+    int channels,
+    std::vector<unsigned char>& encoded
+);
+
+} // namespace gwt
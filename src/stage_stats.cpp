@@ -0,0 +1,257 @@
+/**
+ * @file    stage_stats.cpp
+ * @brief   Gemini Watermark Tool - Stage Timing Statistics
+ * @author  AllenK (Kwyshell)
+ * @date    2026.10.18
+ * @license MIT
+ *
+ * @details
+ * Samples arrive a handful of times per image (milliseconds apart), so a
+ * single mutex around the histograms is uncontended in practice.
+ *
+ * @see https://github.com/allenk/GeminiWatermarkTool
+ */
+
+#include "stage_stats.hpp"
+
+#include <fmt/core.h>
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <map>
+#include <mutex>
+#include <utility>
+
+namespace gwt {
+
+namespace {
+
+struct EncodeStats {
+    LatencyHistogram latency;
+    uint64_t bytes = 0;
+};
+
+struct StatsState {
+    std::mutex mutex;
+    std::array<LatencyHistogram, size_t(Stage::Count)> stages;
+    std::map<std::string, uint64_t> images;
+    std::map<std::pair<std::string, std::string>, EncodeStats> encodes;   // (profile, format)
+    std::chrono::steady_clock::time_point start;
+};
+
+std::atomic<bool> g_enabled{false};
+
+StatsState& state() {
+    static StatsState instance;
+    return instance;
+}
+
+double to_ms(uint64_t ns) {
+    return static_cast<double>(ns) / 1e6;
+}
+
+} // namespace
+
+const char* stage_name(Stage stage) {
+    switch (stage) {
+        case Stage::Read:         return "read";
+        case Stage::Decode:       return "decode";
+        case Stage::ColorConvert: return "color-convert";
+        case Stage::Blend:        return "blend";
+        case Stage::Detect:       return "detect";
+        case Stage::Patch:        return "patch";
+        case Stage::Encode:       return "encode";
+        case Stage::Mkdir:        return "mkdir";
+        case Stage::Write:        return "write";
+        case Stage::Sync:         return "sync";
+        case Stage::Count:        break;
+    }
+    return "unknown";
+}
+
+// =============================================================================
+// LatencyHistogram
+// =============================================================================
+
+size_t LatencyHistogram::bucket_of(uint64_t ns) {
+    constexpr uint64_t kSubCount = uint64_t(1) << kSubBits;
+    if (ns < kSubCount) {
+        return static_cast<size_t>(ns);
+    }
+    const int exponent = 63 - std::countl_zero(ns);
+    const uint64_t sub = (ns >> (exponent - kSubBits)) & (kSubCount - 1);
+    return (size_t(exponent - kSubBits + 1) << kSubBits) + static_cast<size_t>(sub);
+}
+
+uint64_t LatencyHistogram::bucket_low(size_t index) {
+    constexpr size_t kSubCount = size_t(1) << kSubBits;
+    if (index < kSubCount) {
+        return index;
+    }
+    const size_t group = index >> kSubBits;
+    const uint64_t sub = index & (kSubCount - 1);
+    return (kSubCount + sub) << (group - 1);
+}
+
+uint64_t LatencyHistogram::bucket_width(size_t index) {
+    const size_t group = index >> kSubBits;
+    return group == 0 ? 1 : uint64_t(1) << (group - 1);
+}
+
+void LatencyHistogram::record(uint64_t ns) {
+    ++buckets_[bucket_of(ns)];
+    ++count_;
+    total_ += ns;
+    max_ = std::max(max_, ns);
+}
+
+uint64_t LatencyHistogram::percentile(double q) const {
+    if (count_ == 0) {
+        return 0;
+    }
+    const uint64_t rank = std::max<uint64_t>(1, static_cast<uint64_t>(q * static_cast<double>(count_) + 0.5));
+    uint64_t seen = 0;
+    for (size_t i = 0; i < kBuckets; ++i) {
+        seen += buckets_[i];
+        if (seen >= rank) {
+            return std::min(max_, bucket_low(i) + bucket_width(i) / 2);
+        }
+    }
+    return max_;
+}
+
+// =============================================================================
+// Collection
+// =============================================================================
+
+void enable_stage_stats() {
+    StatsState& s = state();
+    {
+        std::lock_guard<std::mutex> lock(s.mutex);
+        s.stages = {};
+        s.images.clear();
+        s.encodes.clear();
+        s.start = std::chrono::steady_clock::now();
+    }
+    g_enabled.store(true, std::memory_order_release);
+}
+
+bool stage_stats_enabled() {
+    return g_enabled.load(std::memory_order_relaxed);
+}
+
+void record_stage(Stage stage, std::chrono::nanoseconds elapsed) {
+    if (!stage_stats_enabled()) {
+        return;
+    }
+    StatsState& s = state();
+    std::lock_guard<std::mutex> lock(s.mutex);
+    s.stages[size_t(stage)].record(static_cast<uint64_t>(std::max<int64_t>(0, elapsed.count())));
+}
+
+void record_image(std::string format) {
+    if (!stage_stats_enabled()) {
+        return;
+    }
+    std::transform(format.begin(), format.end(), format.begin(), ::tolower);
+    if (format == ".jpeg") {
+        format = ".jpg";
+    }
+    StatsState& s = state();
+    std::lock_guard<std::mutex> lock(s.mutex);
+    ++s.images[format];
+}
+
+void record_encode(const std::string& profile, std::string format,
+                   std::chrono::nanoseconds elapsed, size_t bytes) {
+    if (!stage_stats_enabled()) {
+        return;
+    }
+    if (format == ".jpeg") {
+        format = ".jpg";
+    }
+    StatsState& s = state();
+    std::lock_guard<std::mutex> lock(s.mutex);
+    EncodeStats& stats = s.encodes[{profile, std::move(format)}];
+    stats.latency.record(static_cast<uint64_t>(std::max<int64_t>(0, elapsed.count())));
+    stats.bytes += bytes;
+}
+
+StatsReport stage_stats_report() {
+    StatsState& s = state();
+    std::lock_guard<std::mutex> lock(s.mutex);
+
+    StatsReport report;
+    report.wall_time = std::chrono::duration<double>(std::chrono::steady_clock::now() - s.start).count();
+
+    for (size_t i = 0; i < size_t(Stage::Count); ++i) {
+        const LatencyHistogram& h = s.stages[i];
+        if (h.count() == 0) {
+            continue;
+        }
+        StageSummary summary;
+        summary.name = stage_name(static_cast<Stage>(i));
+        summary.count = h.count();
+        summary.total_ms = to_ms(h.total());
+        summary.p50_ms = to_ms(h.percentile(0.50));
+        summary.p95_ms = to_ms(h.percentile(0.95));
+        summary.p99_ms = to_ms(h.percentile(0.99));
+        summary.max_ms = to_ms(h.max());
+        report.stages.push_back(std::move(summary));
+    }
+
+    for (const auto& [format, images] : s.images) {
+        FormatSummary summary;
+        summary.format = format;
+        summary.images = images;
+        summary.images_per_second = report.wall_time > 0 ? static_cast<double>(images) / report.wall_time : 0;
+        report.formats.push_back(std::move(summary));
+    }
+
+    for (const auto& [key, stats] : s.encodes) {
+        const LatencyHistogram& h = stats.latency;
+        EncodeSummary summary;
+        summary.profile = key.first;
+        summary.format = key.second;
+        summary.count = h.count();
+        summary.total_ms = to_ms(h.total());
+        summary.p50_ms = to_ms(h.percentile(0.50));
+        summary.p95_ms = to_ms(h.percentile(0.95));
+        summary.avg_kib = h.count() > 0 ? static_cast<double>(stats.bytes) / 1024.0 / h.count() : 0;
+        report.encodes.push_back(std::move(summary));
+    }
+    return report;
+}
+
+std::string stats_report_json(const StatsReport& report) {
+    std::string out = "{\n";
+    out += fmt::format("  \"wall_time_s\": {:.6f},\n", report.wall_time);
+    out += "  \"stages\": [\n";
+    for (size_t i = 0; i < report.stages.size(); ++i) {
+        const StageSummary& st = report.stages[i];
+        out += fmt::format("    {{\"stage\": \"{}\", \"count\": {}, \"total_ms\": {:.3f}, "
+                           "\"p50_ms\": {:.3f}, \"p95_ms\": {:.3f}, \"p99_ms\": {:.3f}, \"max_ms\": {:.3f}}}{}\n",
+                           st.name, st.count, st.total_ms, st.p50_ms, st.p95_ms, st.p99_ms, st.max_ms,
+                           i + 1 < report.stages.size() ? "," : "");
+    }
+    out += "  ],\n  \"formats\": [\n";
+    for (size_t i = 0; i < report.formats.size(); ++i) {
+        const FormatSummary& f = report.formats[i];
+        out += fmt::format("    {{\"format\": \"{}\", \"images\": {}, \"images_per_second\": {:.3f}}}{}\n",
+                           f.format, f.images, f.images_per_second,
+                           i + 1 < report.formats.size() ? "," : "");
+    }
+    out += "  ],\n  \"encodes\": [\n";
+    for (size_t i = 0; i < report.encodes.size(); ++i) {
+        const EncodeSummary& e = report.encodes[i];
+        out += fmt::format("    {{\"profile\": \"{}\", \"format\": \"{}\", \"count\": {}, \"total_ms\": {:.3f}, "
+                           "\"p50_ms\": {:.3f}, \"p95_ms\": {:.3f}, \"avg_kib\": {:.1f}}}{}\n",
+                           e.profile, e.format, e.count, e.total_ms, e.p50_ms, e.p95_ms, e.avg_kib,
+                           i + 1 < report.encodes.size() ? "," : "");
+    }
+    out += "  ]\n}\n";
+    return out;
+}
+
+} // namespace gwt
@@ -0,0 +1,162 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace gwt {
+
+/**
+ * Per-stage timing for image processing (--stats)
+ *
+ * The I/O and processing helpers time themselves with ScopedStageTimer.
+ * Timers cost a single relaxed atomic load until enable_stage_stats() is
+ * called, so they stay compiled in. Samples from all threads go into
+ * per-stage log-linear histograms (16 sub-buckets per power of two, so
+ * percentiles are within ~6%).
+ */
+
+enum class Stage {
+    Read,           // File -> memory
+    Decode,         // cv::imdecode
+    ColorConvert,   // 16 -> 8 bit samples after decode
+    Blend,          // Alpha blend of the watermark region
+    Detect,         // Watermark presence check (--skip-clean, --analyze)
+    Patch,          // JPEG DCT / PNG partial re-encode fast paths (includes their blend)
+    Encode,         // cv::imencode
+    Mkdir,          // Output directory check/creation
+    Write,          // Memory -> file
+    Sync,           // Flush of written outputs to disk + rename into place
+    Count
+};
+
+const char* stage_name(Stage stage);
+
+/**
+ * Latency histogram over nanoseconds
+ */
+class LatencyHistogram {
+public:
+    void record(uint64_t ns);
+
+    uint64_t count() const { return count_; }
+    uint64_t total() const { return total_; }
+    uint64_t max() const { return max_; }
+
+    /**
+     * Value at quantile q (0..1), as the midpoint of its bucket
+     */
+    uint64_t percentile(double q) const;
+
+private:
+    static constexpr int kSubBits = 4;
+    static constexpr size_t kBuckets = (64 - kSubBits + 1) << kSubBits;
+
+    static size_t bucket_of(uint64_t ns);
+    static uint64_t bucket_low(size_t index);
+    static uint64_t bucket_width(size_t index);
+
+    std::array<uint64_t, kBuckets> buckets_{};
+    uint64_t count_ = 0;
+    uint64_t total_ = 0;
+    uint64_t max_ = 0;
+};
+
+/**
+ * Start collecting (and reset anything collected so far)
+ */
+void enable_stage_stats();
+
+bool stage_stats_enabled();
+
+/**
+ * Add one sample (no-op while disabled)
+ */
+void record_stage(Stage stage, std::chrono::nanoseconds elapsed);
+
+/**
+ * Count one finished image, keyed by input extension (case-insensitive)
+ */
+void record_image(std::string format);
+
+/**
+ * Add one encode sample for an encoder profile and output format (no-op
+ * while disabled); recorded alongside the Stage::Encode sample
+ */
+void record_encode(const std::string& profile, std::string format,
+                   std::chrono::nanoseconds elapsed, size_t bytes);
+
+/**
+ * Times the enclosing scope
+ */
+class ScopedStageTimer {
+public:
+    explicit ScopedStageTimer(Stage stage)
+        : stage_(stage), active_(stage_stats_enabled()) {
+        if (active_) {
+            start_ = std::chrono::steady_clock::now();
+        }
+    }
+
+    ~ScopedStageTimer() {
+        if (active_) {
+            record_stage(stage_, std::chrono::steady_clock::now() - start_);
+        }
+    }
+
+    ScopedStageTimer(const ScopedStageTimer&) = delete;
+    ScopedStageTimer& operator=(const ScopedStageTimer&) = delete;
+
+private:
+    Stage stage_;
+    bool active_;
+    std::chrono::steady_clock::time_point start_;
+};
+
+struct StageSummary {
+    std::string name;
+    uint64_t count = 0;
+    double total_ms = 0;
+    double p50_ms = 0;
+    double p95_ms = 0;
+    double p99_ms = 0;
+    double max_ms = 0;
+};
+
+struct FormatSummary {
+    std::string format;
+    uint64_t images = 0;
+    double images_per_second = 0;   // Over the whole run's wall time
+};
+
+struct EncodeSummary {
+    std::string profile;
+    std::string format;             // Output extension
+    uint64_t count = 0;
+    double total_ms = 0;
+    double p50_ms = 0;
+    double p95_ms = 0;
+    double avg_kib = 0;             // Mean output size
+};
+
+struct StatsReport {
+    double wall_time = 0;           // Seconds since enable_stage_stats()
+    std::vector<StageSummary> stages;   // Stages with at least one sample
+    std::vector<FormatSummary> formats;
+    std::vector<EncodeSummary> encodes; // Per encoder profile and output format
+};
+
+/**
+ * Snapshot of everything recorded since enable_stage_stats()
+ */
+StatsReport stage_stats_report();
+
+/**
+ * The report as a JSON document
+ */
+std::string stats_report_json(const StatsReport& report);
+
+} // namespace gwt
@@ -0,0 +1,159 @@
+/**
+ * @file    thread_pool.cpp
+ * @brief   Gemini Watermark Tool - Work-Stealing Thread Pool
+ * @author  AllenK (Kwyshell)
+ * @date    2026.10.18
+ * @license MIT
+ *
+ * @see https://github.com/allenk/GeminiWatermarkTool
+ */
+
+#include "thread_pool.hpp"
+
+namespace gwt {
+
+namespace {
+
+// Identifies the pool (and deque) owned by the current thread, so tasks
+// submitted from a worker go to that worker's own deque.
+thread_local const ThreadPool* tls_pool = nullptr;
+thread_local size_t tls_worker_index = 0;
+
+} // namespace
+
+size_t ThreadPool::default_thread_count() {
+    unsigned int n = std::thread::hardware_concurrency();
+    return n > 0 ? n : 1;
+}
+
+ThreadPool::ThreadPool(size_t num_threads) {
+    if (num_threads == 0) {
+        num_threads = default_thread_count();
+    }
+
+    queues_.reserve(num_threads);
+    for (size_t i = 0; i < num_threads; ++i) {
+        queues_.push_back(std::make_unique<WorkerQueue>());
+    }
+
+    threads_.reserve(num_threads);
+    for (size_t i = 0; i < num_threads; ++i) {
+        threads_.emplace_back([this, i] { worker_loop(i); });
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(state_mutex_);
+        stopping_ = true;
+    }
+    work_cv_.notify_all();
+
+    for (auto& thread : threads_) {
+        thread.join();
+    }
+}
+
+void ThreadPool::submit(Task task) {
+    size_t target;
+    if (tls_pool == this) {
+        target = tls_worker_index;
+    } else {
+        target = next_queue_.fetch_add(1, std::memory_order_relaxed) % queues_.size();
+    }
+
+    // Count the task before it becomes visible: once pushed, another worker
+    // can steal and finish it, and decrementing pending_ first would let
+    // wait() return while the submitting task is still running
+    {
+        std::lock_guard<std::mutex> lock(state_mutex_);
+        ++queued_;
+        ++pending_;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(queues_[target]->mutex);
+        queues_[target]->tasks.push_back(std::move(task));
+    }
+    work_cv_.notify_one();
+}
+
+void ThreadPool::wait() {
+    std::unique_lock<std::mutex> lock(state_mutex_);
+    idle_cv_.wait(lock, [this] { return pending_ == 0; });
+
+    if (first_error_) {
+        std::exception_ptr error = first_error_;
+        first_error_ = nullptr;
+        std::rethrow_exception(error);
+    }
+}
+
+bool ThreadPool::try_pop(size_t index, Task& task) {
+    // Own deque first (LIFO: most recently pushed, hottest in cache)
+    {
+        WorkerQueue& own = *queues_[index];
+        std::lock_guard<std::mutex> lock(own.mutex);
+        if (!own.tasks.empty()) {
+            task = std::move(own.tasks.back());
+            own.tasks.pop_back();
+            return true;
+        }
+    }
+
+    // Steal from the others (FIFO: oldest, typically the largest subtrees)
+    const size_t n = queues_.size();
+    for (size_t offset = 1; offset < n; ++offset) {
+        WorkerQueue& victim = *queues_[(index + offset) % n];
+        std::lock_guard<std::mutex> lock(victim.mutex);
+        if (!victim.tasks.empty()) {
+            task = std::move(victim.tasks.front());
+            victim.tasks.pop_front();
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void ThreadPool::worker_loop(size_t index) {
+    tls_pool = this;
+    tls_worker_index = index;
+
+    while (true) {
+        Task task;
+        if (try_pop(index, task)) {
+            {
+                std::lock_guard<std::mutex> lock(state_mutex_);
+                --queued_;
+            }
+
+            try {
+                task(index);
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(state_mutex_);
+                if (!first_error_) {
+                    first_error_ = std::current_exception();
+                }
+            }
+
+            // Destroy the captures before counting the task finished, so
+            // wait() cannot return while they are still being torn down
+            task = nullptr;
+
+            std::lock_guard<std::mutex> lock(state_mutex_);
+            if (--pending_ == 0) {
+                idle_cv_.notify_all();
+            }
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(state_mutex_);
+        work_cv_.wait(lock, [this] { return stopping_ || queued_ > 0; });
+        if (stopping_ && queued_ == 0) {
+            return;
+        }
+    }
+}
+
+} // namespace gwt
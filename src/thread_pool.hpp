@@ -0,0 +1,89 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace gwt {
+
+/**
+ * Work-stealing thread pool
+ *
+ * Every worker owns a task deque. A worker pops from the back of its own
+ * deque and, when that runs dry, steals from the front of the others.
+ * Tasks submitted from inside a worker land on that worker's deque, so
+ * tasks that fan out (e.g. directory walks) stay cache-local.
+ *
+ * Tasks receive the index of the worker running them, which callers use
+ * to keep per-worker state (counters, scratch buffers) without locking.
+ */
+class ThreadPool {
+public:
+    using Task = std::function<void(size_t worker_index)>;
+
+    /**
+     * Start the worker threads
+     *
+     * @param num_threads  Worker count (0 = hardware concurrency)
+     */
+    explicit ThreadPool(size_t num_threads = 0);
+
+    /**
+     * Drain all queued tasks and join the workers
+     */
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    /**
+     * Queue a task for execution
+     */
+    void submit(Task task);
+
+    /**
+     * Block until every submitted task (including tasks submitted by
+     * tasks) has finished. Rethrows the first exception a task raised.
+     */
+    void wait();
+
+    /**
+     * Number of worker threads
+     */
+    size_t size() const { return threads_.size(); }
+
+    /**
+     * Hardware concurrency, never less than 1
+     */
+    static size_t default_thread_count();
+
+private:
+    struct WorkerQueue {
+        std::mutex mutex;
+        std::deque<Task> tasks;
+    };
+
+    void worker_loop(size_t index);
+    bool try_pop(size_t index, Task& task);
+
+    std::vector<std::unique_ptr<WorkerQueue>> queues_;
+    std::vector<std::thread> threads_;
+    std::atomic<size_t> next_queue_{0};
+
+    std::mutex state_mutex_;
+    std::condition_variable work_cv_;   // Signalled when tasks are queued
+    std::condition_variable idle_cv_;   // Signalled when pending_ drops to 0
+    size_t queued_ = 0;                 // Tasks in (or being pushed to) a deque
+    size_t pending_ = 0;                // Tasks queued or running
+    bool stopping_ = false;
+    std::exception_ptr first_error_;
+};
+
+} // namespace gwt
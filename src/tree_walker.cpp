@@ -0,0 +1,70 @@
+/**
+ * @file    tree_walker.cpp
+ * @brief   Gemini Watermark Tool - Parallel Directory Walk
+ * @author  AllenK (Kwyshell)
+ * @date    2026.10.18
+ * @license MIT
+ *
+ * @details
+ * Entry types come from the directory listing itself (d_type on Linux,
+ * FindNextFile data on Windows), so a walk issues no per-file stat().
+ *
+ * @see https://github.com/allenk/GeminiWatermarkTool
+ */
+
+#include "tree_walker.hpp"
+
+#include <spdlog/spdlog.h>
+
+#include <memory>
+#include <system_error>
+
+namespace gwt {
+
+namespace fs = std::filesystem;
+
+namespace {
+
+struct Walk {
+    ThreadPool& pool;
+    DirectoryFilter descend;
+    FileVisitor on_file;
+};
+
+void list_directory(const std::shared_ptr<const Walk>& walk, const fs::path& dir, size_t worker) {
+    std::error_code ec;
+    fs::directory_iterator it(dir, fs::directory_options::skip_permission_denied, ec);
+    for (; !ec && it != fs::directory_iterator(); it.increment(ec)) {
+        const fs::directory_entry& entry = *it;
+        std::error_code type_ec;
+
+        if (entry.is_directory(type_ec)) {
+            if (entry.is_symlink(type_ec)) continue;
+            if (walk->descend && !walk->descend(entry.path())) continue;
+            // Lands on this worker's deque; idle workers steal it
+            walk->pool.submit([walk, sub = entry.path()](size_t index) {
+                list_directory(walk, sub, index);
+            });
+        } else if (entry.is_regular_file(type_ec)) {
+            walk->on_file(entry.path(), worker);
+        }
+    }
+    if (ec) {
+        spdlog::warn("Cannot list {}: {}", dir.string(), ec.message());
+    }
+}
+
+} // namespace
+
+void walk_tree(
+    ThreadPool& pool,
+    const fs::path& root,
+    const DirectoryFilter& descend,
+    const FileVisitor& on_file) {
+    auto walk = std::make_shared<const Walk>(Walk{pool, descend, on_file});
+    pool.submit([walk, root](size_t index) {
+        list_directory(walk, root, index);
+    });
+}
+
+} // namespace gwt
@@ -0,0 +1,50 @@
+#pragma once
+
+#include "thread_pool.hpp"
+
+#include <cstddef>
+#include <filesystem>
+#include <functional>
+
+namespace gwt {
+
+/**
+ * Decides whether a directory found during a walk is entered
+ */
+using DirectoryFilter = std::function<bool(const std::filesystem::path& dir)>;
+
+/**
+ * Receives each regular file found during a walk, on the pool worker that
+ * listed it; must be thread-safe
+ */
+using FileVisitor = std::function<void(const std::filesystem::path& file, size_t worker_index)>;
+
+/**
+ * Walk a directory tree on a thread pool
+ *
+ * Every directory is listed by its own pool task, so sibling directories
+ * are enumerated concurrently (on network filesystems each listing is a
+ * round trip, and a serial walk leaves the workers idle). Files are handed
+ * to on_file as soon as their directory entry is read; on_file may submit
+ * tasks to the same pool, so processing starts before the walk finishes.
+ *
+ * Symlinked directories are not followed (no cycles); symlinks to files
+ * are visited. Directories that cannot be listed are logged and skipped.
+ *
+ * Returns right away; the walk is done once pool.wait() returns. The
+ * callbacks are copied, but whatever they reference must stay alive
+ * until then.
+ *
+ * @param pool      Pool running the listing tasks
+ * @param root      Directory to walk (not passed to descend)
+ * @param descend   Filter for subdirectories (empty = enter all)
+ * @param on_file   Called for every regular file
+ */
+void walk_tree(
+    ThreadPool& pool,
+    const std::filesystem::path& root,
+    const DirectoryFilter& descend,
+    const FileVisitor& on_file
+);
+
+} // namespace gwt
@@ -0,0 +1,185 @@
+/**
+ * @file    watermark_detector.cpp
+ * @brief   Gemini Watermark Tool - Watermark Presence Detection
+ * @author  AllenK (Kwyshell)
+ * @date    2026.10.18
+ * @license MIT
+ *
+ * @details
+ * Works on at most a 96x96 corner (plus the search margin), so the
+ * gradients are computed with plain loops; a check costs a few
+ * microseconds next to the strip decode that feeds it.
+ *
+ * @see https://github.com/allenk/GeminiWatermarkTool
+ */
+
+#include "watermark_detector.hpp"
+
+#include <opencv2/imgproc.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace gwt {
+
+namespace {
+
+// Mean of the color channels as float (alpha ignored)
+cv::Mat to_luma(const cv::Mat& pixels) {
+    if (pixels.depth() != CV_8U) {
+        throw std::runtime_error("Watermark detection expects 8-bit pixels");
+    }
+
+    const int channels = pixels.channels();
+    const int colors = std::min(channels, 3);
+    const float scale = 1.0f / static_cast<float>(colors);
+
+    cv::Mat luma(pixels.rows, pixels.cols, CV_32FC1);
+    for (int y = 0; y < pixels.rows; ++y) {
+        const uint8_t* src = pixels.ptr<uint8_t>(y);
+        float* dst = luma.ptr<float>(y);
+        for (int x = 0; x < pixels.cols; ++x) {
+            const uint8_t* px = src + x * channels;
+            int sum = 0;
+            for (int c = 0; c < colors; ++c) {
+                sum += px[c];
+            }
+            dst[x] = static_cast<float>(sum) * scale;
+        }
+    }
+    return luma;
+}
+
+// Central differences of a CV_32FC1 image, zero on the border
+void central_gradients(const cv::Mat& src, cv::Mat& gx, cv::Mat& gy) {
+    gx = cv::Mat::zeros(src.size(), CV_32FC1);
+    gy = cv::Mat::zeros(src.size(), CV_32FC1);
+    for (int y = 1; y + 1 < src.rows; ++y) {
+        const float* above = src.ptr<float>(y - 1);
+        const float* row = src.ptr<float>(y);
+        const float* below = src.ptr<float>(y + 1);
+        float* dx = gx.ptr<float>(y);
+        float* dy = gy.ptr<float>(y);
+        for (int x = 1; x + 1 < src.cols; ++x) {
+            dx[x] = 0.5f * (row[x + 1] - row[x - 1]);
+            dy[x] = 0.5f * (below[x] - above[x]);
+        }
+    }
+}
+
+double gradient_energy(const cv::Mat& gx, const cv::Mat& gy) {
+    double energy = 0.0;
+    for (int y = 0; y < gx.rows; ++y) {
+        const float* dx = gx.ptr<float>(y);
+        const float* dy = gy.ptr<float>(y);
+        for (int x = 0; x < gx.cols; ++x) {
+            energy += double(dx[x]) * dx[x] + double(dy[x]) * dy[x];
+        }
+    }
+    return energy;
+}
+
+} // namespace
+
+WatermarkTemplate make_watermark_template(const cv::Mat& alpha_map) {
+    CV_Assert(!alpha_map.empty() && alpha_map.type() == CV_32FC1);
+
+    WatermarkTemplate templ;
+    central_gradients(alpha_map, templ.grad_x, templ.grad_y);
+    templ.energy = gradient_energy(templ.grad_x, templ.grad_y);
+    return templ;
+}
+
+double watermark_confidence(
+    const cv::Mat& pixels,
+    const WatermarkTemplate& templ,
+    const cv::Rect& template_rect) {
+    if (pixels.empty() || templ.empty() || pixels.size() != template_rect.size()) {
+        return 0.0;
+    }
+    const cv::Rect bounds(0, 0, templ.grad_x.cols, templ.grad_x.rows);
+    if ((template_rect & bounds) != template_rect) {
+        return 0.0;
+    }
+
+    cv::Mat gx, gy;
+    central_gradients(to_luma(pixels), gx, gy);
+    const cv::Mat tx = templ.grad_x(template_rect);
+    const cv::Mat ty = templ.grad_y(template_rect);
+
+    double cross = 0.0;
+    double image_energy = 0.0;
+    double template_energy = 0.0;
+    for (int y = 0; y < gx.rows; ++y) {
+        const float* ix = gx.ptr<float>(y);
+        const float* iy = gy.ptr<float>(y);
+        const float* ax = tx.ptr<float>(y);
+        const float* ay = ty.ptr<float>(y);
+        for (int x = 0; x < gx.cols; ++x) {
+            cross += double(ix[x]) * ax[x] + double(iy[x]) * ay[x];
+            image_energy += double(ix[x]) * ix[x] + double(iy[x]) * iy[x];
+            template_energy += double(ax[x]) * ax[x] + double(ay[x]) * ay[x];
+        }
+    }
+
+    const double denom = std::sqrt(image_energy * template_energy);
+    if (denom < 1e-9) {
+        return 0.0;
+    }
+    return std::clamp(cross / denom, 0.0, 1.0);
+}
+
+TemplateMatch match_watermark_template(
+    const cv::Mat& pixels,
+    const WatermarkTemplate& templ) {
+    TemplateMatch best;
+    if (pixels.empty() || templ.empty() || templ.energy <= 0.0 ||
+        pixels.cols < templ.grad_x.cols || pixels.rows < templ.grad_x.rows) {
+        return best;
+    }
+
+    cv::Mat gx, gy;
+    central_gradients(to_luma(pixels), gx, gy);
+
+    // Cross terms for every placement at once
+    cv::Mat cross_x, cross_y;
+    cv::matchTemplate(gx, templ.grad_x, cross_x, cv::TM_CCORR);
+    cv::matchTemplate(gy, templ.grad_y, cross_y, cv::TM_CCORR);
+
+    // Image energy under each placement from an integral image
+    cv::Mat energy(gx.size(), CV_32FC1);
+    for (int y = 0; y < gx.rows; ++y) {
+        const float* dx = gx.ptr<float>(y);
+        const float* dy = gy.ptr<float>(y);
+        float* e = energy.ptr<float>(y);
+        for (int x = 0; x < gx.cols; ++x) {
+            e[x] = dx[x] * dx[x] + dy[x] * dy[x];
+        }
+    }
+    cv::Mat sums;
+    cv::integral(energy, sums, CV_64F);
+
+    const int tw = templ.grad_x.cols;
+    const int th = templ.grad_x.rows;
+    best.confidence = -1.0;
+    for (int y = 0; y < cross_x.rows; ++y) {
+        const float* cx = cross_x.ptr<float>(y);
+        const float* cy = cross_y.ptr<float>(y);
+        const double* top = sums.ptr<double>(y);
+        const double* bottom = sums.ptr<double>(y + th);
+        for (int x = 0; x < cross_x.cols; ++x) {
+            const double window_energy = bottom[x + tw] - bottom[x] - top[x + tw] + top[x];
+            const double denom = std::sqrt(std::max(window_energy, 0.0) * templ.energy);
+            const double score = denom < 1e-9 ? 0.0 : (double(cx[x]) + cy[x]) / denom;
+            if (score > best.confidence) {
+                best.confidence = score;
+                best.offset = cv::Point(x, y);
+            }
+        }
+    }
+    best.confidence = std::clamp(best.confidence, 0.0, 1.0);
+    return best;
+}
+
+} // namespace gwt
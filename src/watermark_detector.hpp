@@ -0,0 +1,92 @@
+#pragma once
+
+#include <opencv2/core.hpp>
+
+namespace gwt {
+
+/**
+ * Watermark presence detection
+ *
+ * The watermark brightens each pixel by alpha * (logo - original), so the
+ * edges of the alpha map show up in the image gradients whatever the
+ * background. Detection correlates the luma gradients of the corner with
+ * the gradients of the alpha map:
+ *
+ *   confidence = sum(gI . gA) / sqrt(sum(|gI|^2) * sum(|gA|^2))
+ *
+ * Plain intensity NCC is thrown off by shading in the background; gradient
+ * correlation only responds to the logo's outline. On natural images a
+ * clean corner stays below ~0.15 and a watermarked one (including after
+ * JPEG re-encoding) scores well above 0.2. Backgrounds close to the logo
+ * color score low, but there the watermark is invisible and removal would
+ * not change the pixels anyway.
+ *
+ * Position search (match_watermark_template) scores every placement in a
+ * small window at once: the cross terms come from cv::matchTemplate
+ * (TM_CCORR, DFT-based for logo-sized templates) and the per-placement
+ * image energy from an integral image, so a +/-8 px search over both logo
+ * sizes stays well under a millisecond.
+ */
+
+/**
+ * Default confidence below which an image counts as clean (--skip-clean)
+ */
+constexpr double kDefaultDetectThreshold = 0.2;
+
+/**
+ * Gradients of an alpha map, precomputed once per size
+ */
+struct WatermarkTemplate {
+    cv::Mat grad_x;     // CV_32FC1, central differences, zero on the border
+    cv::Mat grad_y;
+    double energy = 0.0;    // sum(grad_x^2 + grad_y^2)
+
+    bool empty() const { return grad_x.empty(); }
+};
+
+/**
+ * Precompute the detection template for an alpha map
+ *
+ * @param alpha_map  Alpha map from calculate_alpha_map()
+ */
+WatermarkTemplate make_watermark_template(const cv::Mat& alpha_map);
+
+/**
+ * Correlate pixels against (part of) a detection template
+ *
+ * @param pixels         8-bit gray, BGR or BGRA pixels
+ * @param templ          Template of the expected watermark
+ * @param template_rect  Part of the template the pixels cover (same size as
+ *                       pixels; smaller than the template when the watermark
+ *                       is clipped by the image or crop)
+ * @return               Confidence in [0, 1]; 0 for flat pixels
+ */
+double watermark_confidence(
+    const cv::Mat& pixels,
+    const WatermarkTemplate& templ,
+    const cv::Rect& template_rect
+);
+
+/**
+ * Best placement of a template inside a search window
+ */
+struct TemplateMatch {
+    cv::Point offset;           // Template top-left relative to the window
+    double confidence = 0.0;    // Same measure as watermark_confidence()
+};
+
+/**
+ * Score every placement of the template that fits inside pixels
+ *
+ * @param pixels  8-bit gray, BGR or BGRA search window (at least the
+ *                template size in both dimensions)
+ * @param templ   Template of the expected watermark
+ * @return        The highest-scoring placement (confidence 0 if the window
+ *                is too small or flat)
+ */
+TemplateMatch match_watermark_template(
+    const cv::Mat& pixels,
+    const WatermarkTemplate& templ
+);
+
+} // namespace gwt
@@ -13,14 +13,124 @@
 
 #include "watermark_engine.hpp"
 #include "blend_modes.hpp"
+#include "embedded_alpha_maps.hpp"
+#include "jpeg_patch.hpp"
+#include "mapped_file.hpp"
+#include "output_writer.hpp"
+#include "png_patch.hpp"
+#include "stage_stats.hpp"
+#include "watermark_detector.hpp"
 
 #include <opencv2/imgcodecs.hpp>
 #include <opencv2/imgproc.hpp>
 #include <spdlog/spdlog.h>
+#include <xxhash.h>
+
+#ifdef GWT_HAVE_WEBP
+#include <webp/encode.h>
+#endif
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <limits>
 #include <stdexcept>
 
 namespace gwt {
 
+namespace {
+
+// A searched placement must reach this confidence, and beat the expected
+// placement by this margin, to be used instead of it
+constexpr double kLocateMinConfidence = 0.3;
+constexpr double kLocateMargin = 0.05;
+
+// Scaled matches try ~100 sizes, so chance matches on clean corners reach
+// ~0.35; real (resized) watermarks score 0.9 and above
+constexpr double kScaledMinConfidence = 0.4;
+
+// Coarse pass over every third pyramid level; neighbouring sizes still
+// score well above clean images, so the best coarse level is within one
+// step of the true size
+constexpr int kScaledCoarseStep = 3;
+
+// Sub-pixel refinement: coordinate steps halve from 1/2 to 1/16 px
+constexpr double kRefineStartStep = 0.5;
+constexpr double kRefineEndStep = 1.0 / 16.0;
+
+// The engine blends 8-bit gray, BGR and BGRA pixels as they are
+void check_pixel_format(const cv::Mat& image) {
+    if (image.empty()) {
+        throw std::runtime_error("Empty image provided");
+    }
+    const int channels = image.channels();
+    if (image.depth() != CV_8U || (channels != 1 && channels != 3 && channels != 4)) {
+        throw std::runtime_error("Unsupported pixel format (expected 8-bit gray, BGR or BGRA)");
+    }
+}
+
+// Where a logo of the given size sits when the margin scales with it
+// (Gemini uses a margin of 2/3 of the logo size for both sizes)
+cv::Rect scaled_logo_rect(const cv::Size& image_size, int logo_size) {
+    const int offset = static_cast<int>(std::lround(logo_size * 5.0 / 3.0));
+    return cv::Rect(image_size.width - offset, image_size.height - offset, logo_size, logo_size);
+}
+
+// Place the source map at a sub-pixel origin and size, as pixel-aligned
+// rect + resampled map
+cv::Rect scaled_placement(
+    const cv::Mat& source,
+    const cv::Size2d& logo_size,
+    const cv::Point2d& origin,
+    cv::Mat& alpha_map) {
+    const cv::Point corner(static_cast<int>(std::floor(origin.x)),
+                           static_cast<int>(std::floor(origin.y)));
+    alpha_map = resample_alpha_map(source, logo_size,
+                                   cv::Point2d(origin.x - corner.x, origin.y - corner.y));
+    return cv::Rect(corner, alpha_map.size());
+}
+
+double scaled_confidence(
+    const cv::Mat& region,
+    const cv::Rect& region_rect,
+    const cv::Rect& bounds,
+    const cv::Mat& source,
+    const cv::Size2d& logo_size,
+    const cv::Point2d& origin) {
+    cv::Mat alpha_map;
+    const cv::Rect rect = scaled_placement(source, logo_size, origin, alpha_map);
+    const cv::Rect visible = rect & bounds;
+    if (visible.empty()) {
+        return 0.0;
+    }
+    return watermark_confidence(region(visible - region_rect.tl()),
+                                make_watermark_template(alpha_map),
+                                visible - rect.tl());
+}
+
+// Per-pixel Q16 blend factors of a built-in alpha map (white logo)
+struct PixelFactors {
+    const int32_t* scale;
+    const int32_t* offset;
+    int size;
+};
+
+PixelFactors embedded_factors(WatermarkSize size, BlendDirection direction) {
+    const bool remove = direction == BlendDirection::Remove;
+    if (size == WatermarkSize::Small) {
+        return remove
+            ? PixelFactors{embedded::blend_remove_scale_48, embedded::blend_remove_offset_48, embedded::alpha_map_48_size}
+            : PixelFactors{embedded::blend_add_scale_48, embedded::blend_add_offset_48, embedded::alpha_map_48_size};
+    }
+    return remove
+        ? PixelFactors{embedded::blend_remove_scale_96, embedded::blend_remove_offset_96, embedded::alpha_map_96_size}
+        : PixelFactors{embedded::blend_add_scale_96, embedded::blend_add_offset_96, embedded::alpha_map_96_size};
+}
+
+} // namespace
+
 WatermarkPosition get_watermark_config(int image_width, int image_height) {
     // Gemini's rules:
     // - Large (96x96, 64px margin): BOTH width AND height > 1024
@@ -41,6 +151,13 @@ WatermarkPosition get_watermark_config(int image_width, int image_height) {
     }
 }
 
+WatermarkPosition get_watermark_config(WatermarkSize size) {
+    if (size == WatermarkSize::Small) {
+        return WatermarkPosition{32, 32, 48};
+    }
+    return WatermarkPosition{64, 64, 96};
+}
+
 WatermarkSize get_watermark_size(int image_width, int image_height) {
     // Large (96x96) only when BOTH dimensions >= 1024
     // 1024x1024 is Small
@@ -81,6 +198,48 @@ void WatermarkEngine::init_alpha_maps(const cv::Mat& bg_small, const cv::Mat& bg
     double min_val, max_val;
     cv::minMaxLoc(alpha_map_large_, &min_val, &max_val);
     spdlog::debug("Large alpha map range: {:.4f} - {:.4f}", min_val, max_val);
+
+    init_derived_state(false);
+}
+
+void WatermarkEngine::init_derived_state(bool pixel_factors) {
+    // The maps never change, so the per-pixel blend factors are computed once
+    for (WatermarkSize size : {WatermarkSize::Small, WatermarkSize::Large}) {
+        for (BlendDirection direction : {BlendDirection::Remove, BlendDirection::Add}) {
+            for (int channels : {1, 3, 4}) {
+                BlendTable& table = blend_tables_[blend_table_index(size, direction, channels)];
+                if (pixel_factors) {
+                    const PixelFactors factors = embedded_factors(size, direction);
+                    table = make_blend_table(factors.scale, factors.offset,
+                                             factors.size, factors.size, channels);
+                } else {
+                    table = make_blend_table(get_alpha_map(size), direction, logo_value_, channels);
+                }
+            }
+        }
+    }
+
+    detect_template_small_ = make_watermark_template(alpha_map_small_);
+    detect_template_large_ = make_watermark_template(alpha_map_large_);
+
+    // Both maps are freshly allocated or static arrays, hence continuous
+    XXH64_hash_t hash = XXH3_64bits(&logo_value_, sizeof(logo_value_));
+    hash = XXH3_64bits_withSeed(alpha_map_small_.data, alpha_map_small_.total() * alpha_map_small_.elemSize(), hash);
+    hash = XXH3_64bits_withSeed(alpha_map_large_.data, alpha_map_large_.total() * alpha_map_large_.elemSize(), hash);
+    asset_hash_ = static_cast<uint64_t>(hash);
+}
+
+WatermarkEngine::WatermarkEngine(float logo_value)
+    : logo_value_(logo_value) {
+    // Headers over the static maps; the engine never writes to its maps
+    alpha_map_small_ = cv::Mat(embedded::alpha_map_48_size, embedded::alpha_map_48_size, CV_32FC1,
+                               const_cast<float*>(embedded::alpha_map_48));
+    alpha_map_large_ = cv::Mat(embedded::alpha_map_96_size, embedded::alpha_map_96_size, CV_32FC1,
+                               const_cast<float*>(embedded::alpha_map_96));
+
+    // The embedded factors only hold for the logo value they were made for
+    init_derived_state(logo_value_ == embedded::alpha_maps_logo_value);
+    spdlog::info("Loaded built-in alpha maps (standalone mode)");
 }
 
 WatermarkEngine::WatermarkEngine(
@@ -130,95 +289,899 @@ WatermarkEngine::WatermarkEngine(
 
 void WatermarkEngine::remove_watermark(
     cv::Mat& image,
-    std::optional<WatermarkSize> force_size) {
-    if (image.empty()) {
-        throw std::runtime_error("Empty image provided");
-    }
+    std::optional<WatermarkSize> force_size) const {
+    // Gray, BGR and BGRA are blended in place, so there is no full-frame
+    // conversion (the region function checks the pixel format)
+    remove_watermark_region(image, cv::Rect(0, 0, image.cols, image.rows),
+                            image.size(), force_size);
+}
 
-    // Ensure BGR format
-    if (image.channels() == 4) {
-        cv::cvtColor(image, image, cv::COLOR_BGRA2BGR);
-    } else if (image.channels() == 1) {
-        cv::cvtColor(image, image, cv::COLOR_GRAY2BGR);
-    }
 
+void WatermarkEngine::add_watermark(
+    cv::Mat& image,
+    std::optional<WatermarkSize> force_size) const {
+    // Gray, BGR and BGRA are blended in place, so there is no full-frame
+    // conversion (the region function checks the pixel format)
+    add_watermark_region(image, cv::Rect(0, 0, image.cols, image.rows),
+                         image.size(), force_size);
+}
+
+cv::Rect WatermarkEngine::get_watermark_rect(
+    const cv::Size& image_size,
+    std::optional<WatermarkSize> force_size) const {
     // Determine watermark size
     WatermarkSize size = force_size.value_or(
-        get_watermark_size(image.cols, image.rows)
+        get_watermark_size(image_size.width, image_size.height)
     );
 
     // Get position config based on actual size used
-    WatermarkPosition config;
-    if (size == WatermarkSize::Small) {
-        config = WatermarkPosition{32, 32, 48};
-    } else {
-        config = WatermarkPosition{64, 64, 96};
+    WatermarkPosition config = get_watermark_config(size);
+    cv::Point pos = config.get_position(image_size.width, image_size.height);
+    return cv::Rect(pos.x, pos.y, config.logo_size, config.logo_size);
+}
+
+void WatermarkEngine::set_search_radius(int radius) {
+    search_radius_ = std::max(0, radius);
+}
+
+void WatermarkEngine::set_scale_search(bool enabled) {
+    scale_search_ = enabled;
+    if (!enabled || !scaled_templates_.empty()) {
+        return;
     }
 
-    cv::Point pos = config.get_position(image.cols, image.rows);
-    cv::Mat& alpha_map = get_alpha_map(size);
+    // Built on first use only: plain runs never pay for the pyramid
+    scaled_templates_.reserve(kMaxScaledLogoSize - kMinScaledLogoSize + 1);
+    for (int logo_size = kMinScaledLogoSize; logo_size <= kMaxScaledLogoSize; ++logo_size) {
+        scaled_templates_.push_back(
+            make_watermark_template(resample_alpha_map(alpha_map_large_, cv::Size2d(logo_size, logo_size))));
+    }
+    spdlog::debug("Scale search pyramid: {} levels ({}-{} px)",
+                  scaled_templates_.size(), kMinScaledLogoSize, kMaxScaledLogoSize);
+}
 
-    spdlog::debug("Removing watermark at ({}, {}) with {}x{} alpha map (size: {})",
-                  pos.x, pos.y, alpha_map.cols, alpha_map.rows,
-                  size == WatermarkSize::Small ? "Small" : "Large");
+cv::Rect WatermarkEngine::get_processing_rect(
+    const cv::Size& image_size,
+    std::optional<WatermarkSize> force_size) const {
+    if (search_radius_ == 0) {
+        return get_watermark_rect(image_size, force_size);
+    }
 
-    // Apply reverse alpha blending
-    remove_watermark_alpha_blend(image, alpha_map, pos, logo_value_);
+    cv::Rect area;
+    for (WatermarkSize size : {WatermarkSize::Small, WatermarkSize::Large}) {
+        if (force_size && *force_size != size) {
+            continue;
+        }
+        const cv::Rect rect = get_watermark_rect(image_size, size);
+        const cv::Rect window(rect.x - search_radius_, rect.y - search_radius_,
+                              rect.width + 2 * search_radius_, rect.height + 2 * search_radius_);
+        area = area.empty() ? window : (area | window);
+    }
+    if (scale_search_) {
+        for (int logo_size = kMinScaledLogoSize; logo_size <= kMaxScaledLogoSize; ++logo_size) {
+            const cv::Rect rect = scaled_logo_rect(image_size, logo_size);
+            area = area | cv::Rect(rect.x - search_radius_, rect.y - search_radius_,
+                                   rect.width + 2 * search_radius_, rect.height + 2 * search_radius_);
+        }
+    }
+    return area;
 }
 
+WatermarkMatch WatermarkEngine::locate_watermark(
+    const cv::Mat& region,
+    const cv::Rect& region_rect,
+    const cv::Size& image_size,
+    std::optional<WatermarkSize> force_size) const {
+    WatermarkMatch expected;
+    expected.size = force_size.value_or(get_watermark_size(image_size.width, image_size.height));
+    expected.rect = get_watermark_rect(image_size, expected.size);
 
-void WatermarkEngine::add_watermark(
-    cv::Mat& image,
-    std::optional<WatermarkSize> force_size) {
-    if (image.empty()) {
-        throw std::runtime_error("Empty image provided");
+    // Only the part of the expected watermark inside the crop can be checked
+    const cv::Rect image_rect(0, 0, image_size.width, image_size.height);
+    const cv::Rect visible = expected.rect & region_rect & image_rect;
+    if (!region.empty() && !visible.empty()) {
+        expected.confidence = watermark_confidence(
+            region(visible - region_rect.tl()),
+            get_detect_template(expected.size),
+            visible - expected.rect.tl());
+    }
+    if (search_radius_ == 0 || region.empty()) {
+        return expected;
     }
 
-    // Ensure BGR format
-    if (image.channels() == 4) {
-        cv::cvtColor(image, image, cv::COLOR_BGRA2BGR);
-    } else if (image.channels() == 1) {
-        cv::cvtColor(image, image, cv::COLOR_GRAY2BGR);
+    WatermarkMatch best = expected;
+    for (WatermarkSize size : {WatermarkSize::Small, WatermarkSize::Large}) {
+        if (force_size && *force_size != size) {
+            continue;
+        }
+        const cv::Rect rect = get_watermark_rect(image_size, size);
+        const cv::Rect window = cv::Rect(rect.x - search_radius_, rect.y - search_radius_,
+                                         rect.width + 2 * search_radius_,
+                                         rect.height + 2 * search_radius_) &
+                                region_rect & image_rect;
+        if (window.width < rect.width || window.height < rect.height) {
+            continue;   // Only whole placements are searched
+        }
+
+        const TemplateMatch match = match_watermark_template(
+            region(window - region_rect.tl()), get_detect_template(size));
+        if (match.confidence > best.confidence) {
+            best.size = size;
+            best.rect = cv::Rect(window.tl() + match.offset, rect.size());
+            best.confidence = match.confidence;
+        }
     }
 
-    // Determine watermark size
+    if (best.rect == expected.rect ||
+        best.confidence < kLocateMinConfidence ||
+        best.confidence < expected.confidence + kLocateMargin) {
+        best = expected;
+    } else {
+        spdlog::debug("Watermark found at ({}, {}) {}x{}, confidence {:.3f} (expected ({}, {}) {}x{}, {:.3f})",
+                      best.rect.x, best.rect.y, best.rect.width, best.rect.height, best.confidence,
+                      expected.rect.x, expected.rect.y, expected.rect.width, expected.rect.height,
+                      expected.confidence);
+    }
+
+    if (scale_search_) {
+        std::optional<WatermarkMatch> scaled =
+            locate_scaled_watermark(region, region_rect, image_size, force_size);
+        if (scaled &&
+            scaled->confidence >= kScaledMinConfidence &&
+            scaled->confidence >= best.confidence + kLocateMargin) {
+            spdlog::debug("Scaled watermark found at ({}, {}) {}x{}, confidence {:.3f} (was {:.3f})",
+                          scaled->rect.x, scaled->rect.y, scaled->rect.width, scaled->rect.height,
+                          scaled->confidence, best.confidence);
+            return std::move(*scaled);
+        }
+    }
+    return best;
+}
+
+std::optional<WatermarkMatch> WatermarkEngine::locate_scaled_watermark(
+    const cv::Mat& region,
+    const cv::Rect& region_rect,
+    const cv::Size& image_size,
+    std::optional<WatermarkSize> force_size) const {
+    const cv::Rect bounds = region_rect & cv::Rect(0, 0, image_size.width, image_size.height);
+
+    // Integer placement per pyramid level, scored on demand
+    struct LevelMatch {
+        bool scored = false;
+        double confidence = -1.0;
+        cv::Point2d center;
+    };
+    std::vector<LevelMatch> levels(scaled_templates_.size());
+
+    auto score_level = [&](int logo_size) {
+        if (logo_size < kMinScaledLogoSize || logo_size > kMaxScaledLogoSize) {
+            return;
+        }
+        LevelMatch& level = levels[logo_size - kMinScaledLogoSize];
+        if (level.scored) {
+            return;
+        }
+        level.scored = true;
+
+        const cv::Rect rect = scaled_logo_rect(image_size, logo_size);
+        const cv::Rect window = cv::Rect(rect.x - search_radius_, rect.y - search_radius_,
+                                         rect.width + 2 * search_radius_,
+                                         rect.height + 2 * search_radius_) & bounds;
+        if (window.width < logo_size || window.height < logo_size) {
+            return;
+        }
+        const TemplateMatch match = match_watermark_template(
+            region(window - region_rect.tl()), scaled_templates_[logo_size - kMinScaledLogoSize]);
+        level.confidence = match.confidence;
+        level.center = cv::Point2d(window.x + match.offset.x + logo_size * 0.5,
+                                   window.y + match.offset.y + logo_size * 0.5);
+    };
+
+    auto best_level = [&]() {
+        int best = -1;
+        for (size_t i = 0; i < levels.size(); ++i) {
+            if (levels[i].scored && (best < 0 || levels[i].confidence > levels[best].confidence)) {
+                best = static_cast<int>(i);
+            }
+        }
+        return best;
+    };
+
+    // Coarse to fine over the pyramid
+    for (int logo_size = kMinScaledLogoSize; logo_size <= kMaxScaledLogoSize; logo_size += kScaledCoarseStep) {
+        score_level(logo_size);
+    }
+    const int coarse = best_level();
+    if (coarse < 0 || levels[coarse].confidence <= 0.0) {
+        return std::nullopt;
+    }
+    for (int d = 1 - kScaledCoarseStep; d < kScaledCoarseStep; ++d) {
+        score_level(kMinScaledLogoSize + coarse + d);
+    }
+    const int fine = best_level();
+
+    // Sub-pixel refinement of (width, height, center x, center y) by
+    // coordinate descent; width and height separately, as resizing may have
+    // changed the aspect ratio. Refining around the center keeps size and
+    // position nearly independent; around the corner a size change also
+    // moves the logo.
+    const cv::Mat& source = (force_size == WatermarkSize::Small) ? alpha_map_small_ : alpha_map_large_;
+    const double level_size = kMinScaledLogoSize + fine;
+    double params[4] = {level_size, level_size, levels[fine].center.x, levels[fine].center.y};
+    auto size_of = [](const double* p) {
+        return cv::Size2d(p[0], p[1]);
+    };
+    auto origin_of = [](const double* p) {
+        return cv::Point2d(p[2] - p[0] * 0.5, p[3] - p[1] * 0.5);
+    };
+    double confidence = scaled_confidence(region, region_rect, bounds, source,
+                                          size_of(params), origin_of(params));
+    for (double step = kRefineStartStep; step >= kRefineEndStep; step *= 0.5) {
+        bool improved = true;
+        while (improved) {
+            improved = false;
+            for (int i = 0; i < 4; ++i) {
+                for (double delta : {-step, step}) {
+                    double candidate[4] = {params[0], params[1], params[2], params[3]};
+                    candidate[i] += delta;
+                    if (i < 2 && (candidate[i] < kMinScaledLogoSize || candidate[i] > kMaxScaledLogoSize)) {
+                        continue;
+                    }
+                    const double score = scaled_confidence(region, region_rect, bounds, source,
+                                                           size_of(candidate), origin_of(candidate));
+                    if (score > confidence) {
+                        confidence = score;
+                        std::copy(candidate, candidate + 4, params);
+                        improved = true;
+                    }
+                }
+            }
+        }
+    }
+
+    WatermarkMatch match;
+    match.size = force_size.value_or(WatermarkSize::Large);
+    match.confidence = confidence;
+
+    // A resized small-image watermark is better described by the 48 px
+    // capture; compare both at the refined placement
+    if (!force_size) {
+        const double small = scaled_confidence(region, region_rect, bounds, alpha_map_small_,
+                                               size_of(params), origin_of(params));
+        if (small > confidence) {
+            match.size = WatermarkSize::Small;
+            match.confidence = small;
+        }
+    }
+
+    match.rect = scaled_placement(get_alpha_map(match.size), size_of(params), origin_of(params),
+                                  match.alpha_map);
+    return match;
+}
+
+void WatermarkEngine::remove_watermark_region(
+    cv::Mat& region,
+    const cv::Rect& region_rect,
+    const cv::Size& image_size,
+    std::optional<WatermarkSize> force_size) const {
+    check_pixel_format(region);
+
     WatermarkSize size = force_size.value_or(
-        get_watermark_size(image.cols, image.rows)
+        get_watermark_size(image_size.width, image_size.height)
     );
+    cv::Rect rect = get_watermark_rect(image_size, size);
+    cv::Mat scaled_alpha_map;
+    if (search_radius_ > 0) {
+        ScopedStageTimer timer(Stage::Detect);
+        WatermarkMatch match = locate_watermark(region, region_rect, image_size, force_size);
+        size = match.size;
+        rect = match.rect;
+        scaled_alpha_map = std::move(match.alpha_map);
+    }
 
-    // Get position config based on actual size used
-    WatermarkPosition config;
-    if (size == WatermarkSize::Small) {
-        config = WatermarkPosition{32, 32, 48};
+    // Position relative to the crop
+    cv::Point pos = rect.tl() - region_rect.tl();
+    const cv::Mat& alpha_map = scaled_alpha_map.empty() ? get_alpha_map(size) : scaled_alpha_map;
+
+    spdlog::debug("Removing watermark at ({}, {}) with {}x{} alpha map (size: {}{})",
+                  rect.x, rect.y, alpha_map.cols, alpha_map.rows,
+                  size == WatermarkSize::Small ? "Small" : "Large",
+                  scaled_alpha_map.empty() ? "" : ", resampled");
+
+    // Apply reverse alpha blending
+    ScopedStageTimer timer(Stage::Blend);
+    if (scaled_alpha_map.empty()) {
+        apply_blend_table(region, get_blend_table(size, BlendDirection::Remove, region.channels()), pos);
     } else {
-        config = WatermarkPosition{64, 64, 96};
+        // One-off map for this placement, so no cached table
+        apply_blend_table(region,
+                          make_blend_table(scaled_alpha_map, BlendDirection::Remove, logo_value_,
+                                           region.channels()),
+                          pos);
     }
+}
 
-    cv::Point pos = config.get_position(image.cols, image.rows);
-    cv::Mat& alpha_map = get_alpha_map(size);
+void WatermarkEngine::add_watermark_region(
+    cv::Mat& region,
+    const cv::Rect& region_rect,
+    const cv::Size& image_size,
+    std::optional<WatermarkSize> force_size) const {
+    check_pixel_format(region);
+
+    WatermarkSize size = force_size.value_or(
+        get_watermark_size(image_size.width, image_size.height)
+    );
+    cv::Rect rect = get_watermark_rect(image_size, size);
+
+    // Position relative to the crop
+    cv::Point pos = rect.tl() - region_rect.tl();
+    const cv::Mat& alpha_map = get_alpha_map(size);
 
     spdlog::debug("Adding watermark at ({}, {}) with {}x{} alpha map (size: {})",
-                  pos.x, pos.y, alpha_map.cols, alpha_map.rows,
+                  rect.x, rect.y, alpha_map.cols, alpha_map.rows,
                   size == WatermarkSize::Small ? "Small" : "Large");
 
     // Apply alpha blending
-    add_watermark_alpha_blend(image, alpha_map, pos, logo_value_);
+    ScopedStageTimer timer(Stage::Blend);
+    apply_blend_table(region, get_blend_table(size, BlendDirection::Add, region.channels()), pos);
+}
+
+double WatermarkEngine::detect_watermark(
+    const cv::Mat& image,
+    std::optional<WatermarkSize> force_size) const {
+    return detect_watermark_region(image, cv::Rect(0, 0, image.cols, image.rows),
+                                   image.size(), force_size);
+}
+
+double WatermarkEngine::detect_watermark_region(
+    const cv::Mat& region,
+    const cv::Rect& region_rect,
+    const cv::Size& image_size,
+    std::optional<WatermarkSize> force_size) const {
+    if (region.empty()) {
+        return 0.0;
+    }
+
+    ScopedStageTimer timer(Stage::Detect);
+    const WatermarkMatch match = locate_watermark(region, region_rect, image_size, force_size);
+
+    spdlog::debug("Watermark confidence at ({}, {}): {:.3f} (size: {})",
+                  match.rect.x, match.rect.y, match.confidence,
+                  match.size == WatermarkSize::Small ? "Small" : "Large");
+    return match.confidence;
 }
 
-cv::Mat& WatermarkEngine::get_alpha_map(WatermarkSize size) {
+const cv::Mat& WatermarkEngine::get_alpha_map(WatermarkSize size) const {
     return (size == WatermarkSize::Small) ? alpha_map_small_ : alpha_map_large_;
 }
 
-bool process_image(
+const WatermarkTemplate& WatermarkEngine::get_detect_template(WatermarkSize size) const {
+    return (size == WatermarkSize::Small) ? detect_template_small_ : detect_template_large_;
+}
+
+size_t WatermarkEngine::blend_table_index(WatermarkSize size, BlendDirection direction, int channels) {
+    const size_t layout = channels == 1 ? 0 : (channels == 3 ? 1 : 2);
+    return (size == WatermarkSize::Small ? 0 : 6) +
+           (direction == BlendDirection::Remove ? 0 : 3) + layout;
+}
+
+const BlendTable& WatermarkEngine::get_blend_table(
+    WatermarkSize size,
+    BlendDirection direction,
+    int channels) const {
+    return blend_tables_[blend_table_index(size, direction, channels)];
+}
+
+bool read_file(
+    const std::filesystem::path& path,
+    std::vector<unsigned char>& buffer) {
+    ScopedStageTimer timer(Stage::Read);
+    std::ifstream in(path, std::ios::binary | std::ios::ate);
+    if (!in) {
+        return false;
+    }
+
+    std::streamsize size = in.tellg();
+    if (size < 0) {
+        return false;
+    }
+    in.seekg(0, std::ios::beg);
+
+    buffer.resize(static_cast<size_t>(size));
+    return static_cast<bool>(in.read(reinterpret_cast<char*>(buffer.data()), size));
+}
+
+bool read_stream(std::FILE* stream, std::vector<unsigned char>& buffer) {
+    constexpr size_t kChunkSize = 1 << 16;
+    buffer.clear();
+    while (true) {
+        const size_t offset = buffer.size();
+        buffer.resize(offset + kChunkSize);
+        const size_t got = std::fread(buffer.data() + offset, 1, kChunkSize, stream);
+        buffer.resize(offset + got);
+        if (got < kChunkSize) {
+            return std::ferror(stream) == 0;
+        }
+    }
+}
+
+bool write_stream(std::FILE* stream, const std::vector<unsigned char>& buffer) {
+    if (!buffer.empty() && std::fwrite(buffer.data(), 1, buffer.size(), stream) != buffer.size()) {
+        return false;
+    }
+    return std::fflush(stream) == 0;
+}
+
+bool decode_image(const unsigned char* data, size_t size, cv::Mat& image,
+                  SourceFormat* source) {
+    if (source != nullptr) {
+        source->clear();
+    }
+    if (size == 0 || size > static_cast<size_t>(std::numeric_limits<int>::max())) {
+        image.release();
+        return false;
+    }
+
+    // Headers only, from the bytes already in memory
+    if (source != nullptr && encoder_settings().preserve_source) {
+        read_source_format(data, size, *source);
+    }
+
+    // IMREAD_UNCHANGED skips the EXIF orientation, which only JPEGs carry
+    // in practice (and they have no alpha to keep)
+    const bool jpeg = detect_image_extension(data, size) == ".jpg";
+    const int flags = jpeg ? cv::IMREAD_ANYCOLOR : cv::IMREAD_UNCHANGED;
+
+    const cv::Mat encoded(1, static_cast<int>(size), CV_8UC1, const_cast<unsigned char*>(data));
+    {
+        ScopedStageTimer timer(Stage::Decode);
+        // Decoding into image reuses its buffer when size and type match
+        cv::imdecode(encoded, flags, &image);
+    }
+    if (image.empty()) {
+        return false;
+    }
+
+    if (image.depth() != CV_8U) {
+        ScopedStageTimer timer(Stage::ColorConvert);
+        const double scale = image.depth() == CV_16U ? 1.0 / 256.0 : 1.0;
+        image.convertTo(image, CV_8U, scale);
+    }
+    return true;
+}
+
+cv::Mat load_image(const std::filesystem::path& input_path) {
+    cv::Mat image;
+    load_image(input_path, image);
+    return image;
+}
+
+bool load_image(const std::filesystem::path& input_path, cv::Mat& image,
+                SourceFormat* source) {
+    // Map + imdecode rather than imread, so read and decode time separately
+    // and the decoder reads the mapping without a copy into a buffer
+    MappedFile file;
+    if (!file.open(input_path)) {
+        image.release();
+        if (source != nullptr) {
+            source->clear();
+        }
+        return false;
+    }
+    return decode_image(file.data(), file.size(), image, source);
+}
+
+namespace {
+
+std::string lowercase_extension(std::string ext) {
+    std::transform(ext.begin(), ext.end(), ext.begin(), ::tolower);
+    if (!ext.empty() && ext.front() != '.') {
+        ext.insert(ext.begin(), '.');
+    }
+    return ext;
+}
+
+// OpenCV added the JPEG sampling factor parameter in 4.6
+#if CV_VERSION_MAJOR > 4 || (CV_VERSION_MAJOR == 4 && CV_VERSION_MINOR >= 6)
+#define GWT_HAVE_JPEG_SAMPLING_FACTOR 1
+#endif
+
+int png_strategy_param(PngStrategy strategy) {
+    switch (strategy) {
+        case PngStrategy::Default:     return cv::IMWRITE_PNG_STRATEGY_DEFAULT;
+        case PngStrategy::Filtered:    return cv::IMWRITE_PNG_STRATEGY_FILTERED;
+        case PngStrategy::HuffmanOnly: return cv::IMWRITE_PNG_STRATEGY_HUFFMAN_ONLY;
+        case PngStrategy::Rle:         return cv::IMWRITE_PNG_STRATEGY_RLE;
+        case PngStrategy::Fixed:       return cv::IMWRITE_PNG_STRATEGY_FIXED;
+    }
+    return cv::IMWRITE_PNG_STRATEGY_DEFAULT;
+}
+
+// Parameters left at the encoder's default are not passed, so the default
+// profile encodes exactly as the fixed settings it replaces did
+std::vector<int> encode_params_for(const std::string& ext, const EncoderSettings& settings) {
+    std::vector<int> params;
+    if (ext == ".jpg" || ext == ".jpeg") {
+        const JpegSettings& jpeg = settings.jpeg;
+        params = {cv::IMWRITE_JPEG_QUALITY, jpeg.quality};
+        if (jpeg.optimize) {
+            params.insert(params.end(), {cv::IMWRITE_JPEG_OPTIMIZE, 1});
+        }
+        if (jpeg.progressive) {
+            params.insert(params.end(), {cv::IMWRITE_JPEG_PROGRESSIVE, 1});
+        }
+#ifdef GWT_HAVE_JPEG_SAMPLING_FACTOR
+        switch (jpeg.subsampling) {
+            case ChromaSubsampling::Auto: break;
+            case ChromaSubsampling::S444:
+                params.insert(params.end(), {cv::IMWRITE_JPEG_SAMPLING_FACTOR, cv::IMWRITE_JPEG_SAMPLING_FACTOR_444});
+                break;
+            case ChromaSubsampling::S422:
+                params.insert(params.end(), {cv::IMWRITE_JPEG_SAMPLING_FACTOR, cv::IMWRITE_JPEG_SAMPLING_FACTOR_422});
+                break;
+            case ChromaSubsampling::S420:
+                params.insert(params.end(), {cv::IMWRITE_JPEG_SAMPLING_FACTOR, cv::IMWRITE_JPEG_SAMPLING_FACTOR_420});
+                break;
+        }
+#endif
+    } else if (ext == ".png") {
+        // Lossless: level and strategy only trade file size for speed.
+        // Setting the level resets OpenCV's strategy to default, so the
+        // strategy has to come after it.
+        params = {cv::IMWRITE_PNG_COMPRESSION, settings.png.level};
+        if (settings.png.strategy != PngStrategy::Default) {
+            params.insert(params.end(), {cv::IMWRITE_PNG_STRATEGY, png_strategy_param(settings.png.strategy)});
+        }
+    } else if (ext == ".webp") {
+        // 101+ = lossless mode
+        params = {cv::IMWRITE_WEBP_QUALITY, settings.webp.quality};
+    }
+    return params;
+}
+
+#ifdef GWT_HAVE_WEBP
+
+// The method OpenCV's WebP encoder always uses
+constexpr int kOpenCvWebpMethod = 4;
+
+// libwebp's advanced API, for the method OpenCV does not expose
+bool encode_webp(const cv::Mat& image, const WebpSettings& settings, std::vector<unsigned char>& buffer) {
+    if (image.depth() != CV_8U || image.empty()) {
+        return false;
+    }
+
+    WebPConfig config;
+    const bool lossless = settings.quality > 100;
+    // Lossless "quality" is compression effort; 70 is what WebPEncodeLossless*() use
+    if (!WebPConfigPreset(&config, WEBP_PRESET_DEFAULT, lossless ? 70.0f : static_cast<float>(settings.quality))) {
+        return false;
+    }
+    config.lossless = lossless ? 1 : 0;
+    config.method = std::clamp(settings.method, 0, 6);
+    if (!WebPValidateConfig(&config)) {
+        return false;
+    }
+
+    cv::Mat source = image;
+    if (image.channels() == 1) {
+        cv::cvtColor(image, source, cv::COLOR_GRAY2BGR);
+    }
+
+    WebPPicture picture;
+    if (!WebPPictureInit(&picture)) {
+        return false;
+    }
+    picture.use_argb = lossless ? 1 : 0;
+    picture.width = source.cols;
+    picture.height = source.rows;
+    const int stride = static_cast<int>(source.step[0]);
+    const bool imported = source.channels() == 4
+        ? WebPPictureImportBGRA(&picture, source.ptr<uint8_t>(), stride) != 0
+        : WebPPictureImportBGR(&picture, source.ptr<uint8_t>(), stride) != 0;
+
+    WebPMemoryWriter writer;
+    WebPMemoryWriterInit(&writer);
+    picture.writer = WebPMemoryWrite;
+    picture.custom_ptr = &writer;
+
+    const bool ok = imported && WebPEncode(&config, &picture) != 0;
+    if (ok) {
+        buffer.assign(writer.mem, writer.mem + writer.size);
+    }
+    WebPPictureFree(&picture);
+    WebPMemoryWriterClear(&writer);
+    return ok;
+}
+
+#endif
+
+} // namespace
+
+std::vector<int> get_encode_params(const std::filesystem::path& output_path) {
+    return encode_params_for(lowercase_extension(output_path.extension().string()), encoder_settings());
+}
+
+bool encode_image(
+    const std::filesystem::path& output_path,
+    const cv::Mat& image,
+    std::vector<unsigned char>& buffer,
+    const SourceFormat* source) {
+    return encode_image_as(output_path.extension().string(), image, buffer, source);
+}
+
+bool encode_image_as(
+    const std::string& ext,
+    const cv::Mat& image,
+    std::vector<unsigned char>& buffer,
+    const SourceFormat* source) {
+    return encode_image_as(ext, image, buffer, encoder_settings(), source);
+}
+
+bool encode_image_as(
+    const std::string& ext,
+    const cv::Mat& image,
+    std::vector<unsigned char>& buffer,
+    const EncoderSettings& requested,
+    const SourceFormat* source) {
+    using Clock = std::chrono::steady_clock;
+
+    if (ext.empty()) {
+        return false;
+    }
+    const std::string normalized = lowercase_extension(ext);
+
+    const bool preserve = source != nullptr && requested.preserve_source;
+    const EncoderSettings settings = preserve
+        ? settings_for_source(requested, *source, normalized)
+        : requested;
+
+    const bool timed = stage_stats_enabled();
+    const Clock::time_point start = timed ? Clock::now() : Clock::time_point{};
+    bool ok = false;
+#ifdef GWT_HAVE_WEBP
+    if (normalized == ".webp" && settings.webp.method != kOpenCvWebpMethod) {
+        ok = encode_webp(image, settings.webp, buffer);
+    } else
+#endif
+    {
+        ok = cv::imencode(normalized, image, buffer, encode_params_for(normalized, settings));
+    }
+    if (ok && preserve) {
+        embed_source_metadata(*source, normalized, image.channels(), buffer);
+    }
+
+    if (timed) {
+        const auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start);
+        record_stage(Stage::Encode, elapsed);
+        if (ok) {
+            record_encode(encode_profile_name(settings.profile), normalized, elapsed, buffer.size());
+        }
+    }
+    return ok;
+}
+
+std::string detect_image_extension(const unsigned char* data, size_t size) {
+    if (size >= 8 && data[0] == 0x89 && data[1] == 'P' && data[2] == 'N' && data[3] == 'G') {
+        return ".png";
+    }
+    if (size >= 3 && data[0] == 0xFF && data[1] == 0xD8 && data[2] == 0xFF) {
+        return ".jpg";
+    }
+    if (size >= 12 && std::memcmp(data, "RIFF", 4) == 0 && std::memcmp(data + 8, "WEBP", 4) == 0) {
+        return ".webp";
+    }
+    if (size >= 2 && data[0] == 'B' && data[1] == 'M') {
+        return ".bmp";
+    }
+    return {};
+}
+
+bool write_file(
+    const std::filesystem::path& output_path,
+    const std::vector<unsigned char>& buffer) {
+    // Create output directory if needed
+    auto output_dir = output_path.parent_path();
+    if (!output_dir.empty()) {
+        ScopedStageTimer timer(Stage::Mkdir);
+        if (!std::filesystem::exists(output_dir)) {
+            std::filesystem::create_directories(output_dir);
+        }
+    }
+
+    return replace_file(output_path, buffer.data(), buffer.size());
+}
+
+namespace {
+
+bool is_jpeg_extension(const std::filesystem::path& path) {
+    std::string ext = path.extension().string();
+    std::transform(ext.begin(), ext.end(), ext.begin(), ::tolower);
+    return ext == ".jpg" || ext == ".jpeg";
+}
+
+bool is_png_extension(const std::filesystem::path& path) {
+    std::string ext = path.extension().string();
+    std::transform(ext.begin(), ext.end(), ext.begin(), ::tolower);
+    return ext == ".png";
+}
+
+// Buffers reused by every process_image() call on a thread. Batch workers
+// see the same image size over and over: imdecode refills the frame in
+// place and the encoder output keeps its capacity, so a worker's steady
+// state allocates neither.
+struct Scratch {
+    cv::Mat frame;
+    std::vector<unsigned char> encoded;
+    SourceFormat source;
+};
+
+thread_local Scratch tls_scratch;
+
+} // namespace
+
+bool try_patch_image(
     const std::filesystem::path& input_path,
     const std::filesystem::path& output_path,
     bool remove,
-    WatermarkEngine& engine,
+    const WatermarkEngine& engine,
     std::optional<WatermarkSize> force_size) {
+    std::vector<unsigned char> output;
+    if (!try_patch_image(input_path, output_path, output, remove, engine, force_size)) {
+        return false;
+    }
+    if (!write_file(output_path, output)) {
+        spdlog::error("Failed to write image: {}", output_path.string());
+        return false;
+    }
+    return true;
+}
+
+bool try_patch_image(
+    const std::filesystem::path& input_path,
+    const std::filesystem::path& output_path,
+    std::vector<unsigned char>& output,
+    bool remove,
+    const WatermarkEngine& engine,
+    std::optional<WatermarkSize> force_size) {
+    if (!(is_jpeg_extension(input_path) && is_jpeg_extension(output_path)) &&
+        !(is_png_extension(input_path) && is_png_extension(output_path))) {
+        return false;
+    }
+
+    MappedFile input;
+    if (!input.open(input_path)) {
+        return false;
+    }
+    return try_patch_image(input.data(), input.size(), input_path, output_path, output,
+                           remove, engine, force_size);
+}
+
+bool try_patch_image(
+    const unsigned char* data,
+    size_t size,
+    const std::filesystem::path& input_path,
+    const std::filesystem::path& output_path,
+    std::vector<unsigned char>& output,
+    bool remove,
+    const WatermarkEngine& engine,
+    std::optional<WatermarkSize> force_size) {
+    const bool jpeg = is_jpeg_extension(input_path) && is_jpeg_extension(output_path);
+    const bool png = is_png_extension(input_path) && is_png_extension(output_path);
+    if (!jpeg && !png) {
+        return false;
+    }
+
+    const std::string label = input_path.filename().string();
+    return jpeg ? patch_jpeg(data, size, output, remove, engine, force_size, label)
+                : patch_png(data, size, output, remove, engine, force_size, label);
+}
+
+bool process_image_buffer(
+    const std::vector<unsigned char>& input,
+    const std::string& output_ext,
+    std::vector<unsigned char>& output,
+    bool remove,
+    const WatermarkEngine& engine,
+    std::optional<WatermarkSize> force_size) {
+    return process_image_buffer(input.data(), input.size(), output_ext, output, remove, engine, force_size);
+}
+
+bool process_image_buffer(
+    const unsigned char* data,
+    size_t size,
+    const std::string& output_ext,
+    std::vector<unsigned char>& output,
+    bool remove,
+    const WatermarkEngine& engine,
+    std::optional<WatermarkSize> force_size,
+    bool* decode_failed) {
+    if (decode_failed != nullptr) {
+        *decode_failed = false;
+    }
+    const std::string input_ext = detect_image_extension(data, size);
+    const std::string ext = output_ext.empty() ? input_ext : lowercase_extension(output_ext);
+    if (ext.empty()) {
+        if (decode_failed != nullptr) {
+            *decode_failed = input_ext.empty();
+        }
+        return false;
+    }
+
+    // Same-format fast paths, as in try_patch_image()
+    const bool jpeg_out = (ext == ".jpg" || ext == ".jpeg");
+    if ((input_ext == ".jpg" && jpeg_out &&
+         patch_jpeg(data, size, output, remove, engine, force_size)) ||
+        (input_ext == ".png" && ext == ".png" &&
+         patch_png(data, size, output, remove, engine, force_size))) {
+        record_image(input_ext);
+        return true;
+    }
+
+    cv::Mat& image = tls_scratch.frame;
+    SourceFormat& source = tls_scratch.source;
+    if (!decode_image(data, size, image, &source)) {
+        if (decode_failed != nullptr) {
+            *decode_failed = true;
+        }
+        return false;
+    }
+
+    if (remove) {
+        engine.remove_watermark(image, force_size);
+    } else {
+        engine.add_watermark(image, force_size);
+    }
+    if (!encode_image_as(ext, image, output, &source)) {
+        return false;
+    }
+    record_image(input_ext);
+    return true;
+}
+
+bool convert_image_buffer(
+    const unsigned char* data,
+    size_t size,
+    const std::string& output_ext,
+    std::vector<unsigned char>& output) {
+    const std::string input_ext = detect_image_extension(data, size);
+    const std::string ext = output_ext.empty() ? input_ext : lowercase_extension(output_ext);
+    if (ext.empty()) {
+        return false;
+    }
+    if (ext == input_ext || (input_ext == ".jpg" && ext == ".jpeg")) {
+        output.assign(data, data + size);
+        return true;
+    }
+
+    cv::Mat& image = tls_scratch.frame;
+    SourceFormat& source = tls_scratch.source;
+    return decode_image(data, size, image, &source) && encode_image_as(ext, image, output, &source);
+}
+
+bool process_image_to_buffer(
+    const std::filesystem::path& input_path,
+    const std::filesystem::path& output_path,
+    std::vector<unsigned char>& output,
+    bool remove,
+    const WatermarkEngine& engine,
+    std::optional<WatermarkSize> force_size,
+    bool* patched) {
+    if (patched != nullptr) {
+        *patched = false;
+    }
     try {
-        // Read image
-        cv::Mat image = cv::imread(input_path.string(), cv::IMREAD_COLOR);
-        if (image.empty()) {
+        // Fast path: patch only the watermark area, keep everything else as-is
+        if (try_patch_image(input_path, output_path, output, remove, engine, force_size)) {
+            if (patched != nullptr) {
+                *patched = true;
+            }
+            return true;
+        }
+
+        // Read image (into this thread's frame, see Scratch)
+        cv::Mat& image = tls_scratch.frame;
+        SourceFormat& source = tls_scratch.source;
+        if (!load_image(input_path, image, &source)) {
             spdlog::error("Failed to load image: {}", input_path.string());
             return false;
         }
@@ -234,42 +1197,48 @@ bool process_image(
             engine.add_watermark(image, force_size);
         }
 
-        // Create output directory if needed
-        auto output_dir = output_path.parent_path();
-        if (!output_dir.empty() && !std::filesystem::exists(output_dir)) {
-            std::filesystem::create_directories(output_dir);
+        if (!encode_image(output_path, image, output, &source)) {
+            spdlog::error("Failed to encode image: {}", output_path.string());
+            return false;
         }
+        return true;
 
-        // Determine output format and quality
-        std::vector<int> params;
-        std::string ext = output_path.extension().string();
-        std::transform(ext.begin(), ext.end(), ext.begin(), ::tolower);
-
-        if (ext == ".jpg" || ext == ".jpeg") {
-            // JPEG: 100 = minimal loss (still lossy, but best quality)
-            params = {cv::IMWRITE_JPEG_QUALITY, 100};
-        } else if (ext == ".png") {
-            // PNG: lossless, compression level only affects file size/speed
-            params = {cv::IMWRITE_PNG_COMPRESSION, 6};
-        } else if (ext == ".webp") {
-            // WebP: 101+ = lossless mode
-            params = {cv::IMWRITE_WEBP_QUALITY, 101};
-        }
+    } catch (const std::exception& e) {
+        spdlog::error("Error processing {}: {}", input_path.string(), e.what());
+        return false;
+    }
+}
+
+bool process_image(
+    const std::filesystem::path& input_path,
+    const std::filesystem::path& output_path,
+    bool remove,
+    const WatermarkEngine& engine,
+    std::optional<WatermarkSize> force_size) {
+    // Encode in memory (into this thread's buffer, see Scratch), then write
+    std::vector<unsigned char>& buffer = tls_scratch.encoded;
+    bool patched = false;
+    if (!process_image_to_buffer(input_path, output_path, buffer, remove, engine, force_size, &patched)) {
+        return false;
+    }
 
-        // Write output
-        bool success = cv::imwrite(output_path.string(), image, params);
-        if (!success) {
+    try {
+        if (!write_file(output_path, buffer)) {
             spdlog::error("Failed to write image: {}", output_path.string());
             return false;
         }
-
-        spdlog::info("Saved: {}", output_path.filename().string());
-        return true;
-
     } catch (const std::exception& e) {
-        spdlog::error("Error processing {}: {}", input_path.string(), e.what());
+        spdlog::error("Error writing {}: {}", output_path.string(), e.what());
         return false;
     }
+
+    if (patched) {
+        spdlog::info("Saved: {} (patched)", output_path.filename().string());
+    } else {
+        spdlog::info("Saved: {}", output_path.filename().string());
+    }
+    record_image(input_path.extension().string());
+    return true;
 }
 
 } // namespace gwt
@@ -1,7 +1,16 @@
 #pragma once
 
+#include "blend_modes.hpp"
+#include "encoder_settings.hpp"
+#include "source_format.hpp"
+#include "watermark_detector.hpp"
+
 #include <opencv2/core.hpp>
+#include <array>
+#include <cstdint>
+#include <cstdio>
 #include <string>
+#include <vector>
 #include <optional>
 #include <filesystem>
 
@@ -32,6 +41,29 @@ struct WatermarkPosition {
     }
 };
 
+/**
+ * Where the watermark was found in an image
+ */
+struct WatermarkMatch {
+    WatermarkSize size;         // Alpha map the match is based on
+    cv::Rect rect;              // Image coordinates (may extend past the image)
+    double confidence = 0.0;    // See watermark_detector.hpp
+    cv::Mat alpha_map;          // Resampled map covering rect for a scaled match
+                                // (see set_scale_search()); empty otherwise
+};
+
+/**
+ * Default search radius for --search, in pixels around the expected position
+ */
+constexpr int kDefaultSearchRadius = 8;
+
+/**
+ * Logo sizes covered by scale search, in pixels (a 96 px logo downscaled to
+ * 25%, up to a 48 px logo upscaled by more than 2.5x)
+ */
+constexpr int kMinScaledLogoSize = 24;
+constexpr int kMaxScaledLogoSize = 128;
+
 /**
  * Get the appropriate watermark configuration based on image size
  *
@@ -41,6 +73,11 @@ struct WatermarkPosition {
  */
 WatermarkPosition get_watermark_config(int image_width, int image_height);
 
+/**
+ * Get the watermark configuration for an explicit size mode
+ */
+WatermarkPosition get_watermark_config(WatermarkSize size);
+
 /**
  * Determine watermark size mode from image dimensions
  */
@@ -52,12 +89,28 @@ WatermarkSize get_watermark_size(int image_width, int image_height);
  * Uses background captures to dynamically calculate alpha maps.
  * No pre-processed masks needed - just the original captures.
  *
+ * The engine is immutable after construction (apart from
+ * set_search_radius() and set_scale_search(), which must be called before
+ * it is shared), so a single instance can be shared by any number of
+ * worker threads.
+ *
  * Math:
  *   Gemini adds watermark: result = alpha * logo + (1 - alpha) * original
  *   To remove: original = (result - alpha * 255) / (1 - alpha)
  */
 class WatermarkEngine {
 public:
+    /**
+     * Initialize the engine with the built-in alpha maps (standalone mode)
+     *
+     * The maps and their blend factors are generated at build time
+     * (embedded_alpha_maps.hpp), so no capture is decoded; the engine views
+     * the static data directly.
+     *
+     * @param logo_value      The logo brightness (default: 255.0 = white)
+     */
+    explicit WatermarkEngine(float logo_value = 255.0f);
+
     /**
      * Initialize the engine with background captures from files
      *
@@ -93,50 +146,514 @@ public:
     /**
      * Remove watermark from an image
      *
+     * Gray, BGR and BGRA 8-bit images are blended as they are; only the
+     * watermark corner is touched and alpha is left unchanged.
+     *
      * @param image     The image to process (will be modified in-place)
      * @param force_size Force a specific watermark size (auto-detect if nullopt)
      */
     void remove_watermark(
         cv::Mat& image,
         std::optional<WatermarkSize> force_size = std::nullopt
-    );
+    ) const;
 
     /**
      * Add watermark to an image (Gemini-style)
      *
+     * Accepts the same pixel formats as remove_watermark().
+     *
      * @param image     The image to process (will be modified in-place)
      * @param force_size Force a specific watermark size (auto-detect if nullopt)
      */
     void add_watermark(
         cv::Mat& image,
         std::optional<WatermarkSize> force_size = std::nullopt
-    );
+    ) const;
+
+    /**
+     * Enable position search for removal and detection
+     *
+     * Instead of trusting the fixed Gemini layout, both logo sizes (or only
+     * force_size) are scored at every offset within +/-radius pixels of
+     * their expected positions, and the best match is used. A match only
+     * replaces the expected placement when it is clearly better (see
+     * locate_watermark()), so images that follow the layout are unaffected.
+     *
+     * Not thread-safe: configure before sharing the engine.
+     *
+     * @param radius  Search radius in pixels (0 = off, the default)
+     */
+    void set_search_radius(int radius);
+
+    int search_radius() const { return search_radius_; }
+
+    /**
+     * Also search for watermarks of images resized after generation
+     *
+     * Gemini keeps the margin at 2/3 of the logo size, so a resized image
+     * still has its logo at (W - 5/3 * L, H - 5/3 * L) for some logo size L.
+     * Every L from kMinScaledLogoSize to kMaxScaledLogoSize is tried within
+     * the position search radius (coarse to fine, against a pyramid of
+     * pre-resampled alpha maps built here once), then size and position are
+     * refined to 1/16 px (width and height separately, in case the aspect
+     * ratio changed). The best fit is removed with an alpha map resampled
+     * to exactly that size and sub-pixel offset.
+     *
+     * Only takes effect while the search radius is non-zero. Not
+     * thread-safe: configure before sharing the engine.
+     */
+    void set_scale_search(bool enabled);
+
+    bool scale_search() const { return scale_search_; }
+
+    /**
+     * Hash of the alpha maps and logo value (XXH3-64)
+     *
+     * Changes whenever the assets do; recorded by --incremental so outputs
+     * made with other assets are not mistaken for current ones.
+     */
+    uint64_t asset_hash() const { return asset_hash_; }
+
+    /**
+     * Get the watermark rectangle for an image of the given size
+     *
+     * @param image_size  Size of the full image
+     * @param force_size  Force a specific watermark size (auto-detect if nullopt)
+     * @return            Watermark rectangle in image coordinates (unclipped)
+     */
+    cv::Rect get_watermark_rect(
+        const cv::Size& image_size,
+        std::optional<WatermarkSize> force_size = std::nullopt
+    ) const;
+
+    /**
+     * Get the rectangle the region functions need pixels for
+     *
+     * The watermark rectangle, or with position search enabled, the union of
+     * every candidate placement (including scaled ones with scale search).
+     * Callers that decode only part of an image should decode (at least)
+     * this rectangle, clipped to the image.
+     */
+    cv::Rect get_processing_rect(
+        const cv::Size& image_size,
+        std::optional<WatermarkSize> force_size = std::nullopt
+    ) const;
+
+    /**
+     * Find the watermark in a crop of a larger image
+     *
+     * Without position search this is the expected placement with its
+     * confidence. With it, the best-scoring placement within the search
+     * radius wins if it reaches a confidence of 0.3 and beats the expected
+     * placement by a small margin; otherwise the expected placement is kept.
+     * A scaled match (set_scale_search()) must reach 0.4, as the many sizes
+     * tried make chance matches on clean images likelier, and beat the
+     * placement chosen so far by the same margin.
+     *
+     * @param region      Crop pixels (gray, BGR or BGRA, 8-bit)
+     * @param region_rect Where the crop sits in the full image
+     * @param image_size  Size of the full image
+     * @param force_size  Only consider this size (both sizes if nullopt)
+     */
+    WatermarkMatch locate_watermark(
+        const cv::Mat& region,
+        const cv::Rect& region_rect,
+        const cv::Size& image_size,
+        std::optional<WatermarkSize> force_size = std::nullopt
+    ) const;
+
+    /**
+     * Remove watermark from a crop of a larger image
+     *
+     * Used by the format-specific paths that only decode the pixels around
+     * the watermark. Parts of the watermark outside the crop are ignored.
+     * With position search enabled, the watermark is removed where
+     * locate_watermark() finds it.
+     *
+     * @param region      Crop pixels (gray, BGR or BGRA, 8-bit, modified in-place)
+     * @param region_rect Where the crop sits in the full image
+     * @param image_size  Size of the full image
+     * @param force_size  Force a specific watermark size (auto-detect if nullopt)
+     */
+    void remove_watermark_region(
+        cv::Mat& region,
+        const cv::Rect& region_rect,
+        const cv::Size& image_size,
+        std::optional<WatermarkSize> force_size = std::nullopt
+    ) const;
+
+    /**
+     * Add watermark to a crop of a larger image (see remove_watermark_region)
+     */
+    void add_watermark_region(
+        cv::Mat& region,
+        const cv::Rect& region_rect,
+        const cv::Size& image_size,
+        std::optional<WatermarkSize> force_size = std::nullopt
+    ) const;
+
+    /**
+     * Confidence that an image carries the watermark at its expected position
+     * (or, with position search enabled, where locate_watermark() finds it)
+     *
+     * See watermark_detector.hpp for the measure; compare the result with
+     * kDefaultDetectThreshold (or a user-chosen threshold).
+     *
+     * @param image       Gray, BGR or BGRA 8-bit image
+     * @param force_size  Force a specific watermark size (auto-detect if nullopt)
+     * @return            Confidence in [0, 1]
+     */
+    double detect_watermark(
+        const cv::Mat& image,
+        std::optional<WatermarkSize> force_size = std::nullopt
+    ) const;
+
+    /**
+     * Detect the watermark in a crop of a larger image (see remove_watermark_region)
+     */
+    double detect_watermark_region(
+        const cv::Mat& region,
+        const cv::Rect& region_rect,
+        const cv::Size& image_size,
+        std::optional<WatermarkSize> force_size = std::nullopt
+    ) const;
 
 private:
     cv::Mat alpha_map_small_;   // 48x48 alpha map (CV_32FC1, 0.0-1.0)
     cv::Mat alpha_map_large_;   // 96x96 alpha map (CV_32FC1, 0.0-1.0)
     float logo_value_;          // Logo brightness (255 = white)
+    int search_radius_ = 0;     // Position search radius (0 = fixed layout)
+    bool scale_search_ = false; // Also try resized logos (set_scale_search)
+    uint64_t asset_hash_ = 0;   // See asset_hash()
+
+    // Fixed-point blend factors, precomputed once per size, direction and
+    // channel layout (gray, BGR, BGRA), indexed by blend_table_index()
+    std::array<BlendTable, 12> blend_tables_;
+
+    // Alpha map gradients for detect_watermark()
+    WatermarkTemplate detect_template_small_;
+    WatermarkTemplate detect_template_large_;
+
+    // Scale search pyramid: the large alpha map resampled to every logo
+    // size from kMinScaledLogoSize up (index = size - kMinScaledLogoSize)
+    std::vector<WatermarkTemplate> scaled_templates_;
 
-    cv::Mat& get_alpha_map(WatermarkSize size);
+    const cv::Mat& get_alpha_map(WatermarkSize size) const;
+    const BlendTable& get_blend_table(WatermarkSize size, BlendDirection direction, int channels) const;
+    static size_t blend_table_index(WatermarkSize size, BlendDirection direction, int channels);
+    const WatermarkTemplate& get_detect_template(WatermarkSize size) const;
+
+    // Best resized-logo placement, or nullopt if no size fits in the region
+    std::optional<WatermarkMatch> locate_scaled_watermark(
+        const cv::Mat& region,
+        const cv::Rect& region_rect,
+        const cv::Size& image_size,
+        std::optional<WatermarkSize> force_size
+    ) const;
 
     // Helper to initialize alpha maps from cv::Mat
     void init_alpha_maps(const cv::Mat& bg_small, const cv::Mat& bg_large);
+
+    // Blend tables, detection templates and asset hash for the current maps;
+    // pixel_factors are the embedded Q16 factors when the maps are built in
+    void init_derived_state(bool pixel_factors);
 };
 
+/**
+ * Read a whole file into memory
+ *
+ * @param path    File path
+ * @param buffer  Receives the file contents
+ * @return        True if successful
+ */
+bool read_file(
+    const std::filesystem::path& path,
+    std::vector<unsigned char>& buffer
+);
+
+/**
+ * Read a stream (e.g. stdin) to EOF
+ *
+ * The stream must be in binary mode.
+ *
+ * @return  True if EOF was reached without a read error
+ */
+bool read_stream(std::FILE* stream, std::vector<unsigned char>& buffer);
+
+/**
+ * Write encoded bytes to a stream (e.g. stdout) and flush it
+ */
+bool write_stream(std::FILE* stream, const std::vector<unsigned char>& buffer);
+
+/**
+ * Decode an image for processing
+ *
+ * Gray stays gray and an alpha channel is kept (IMREAD_UNCHANGED), since
+ * the engine blends gray, BGR and BGRA in place. JPEGs are decoded with
+ * IMREAD_ANYCOLOR instead, which still applies the EXIF orientation.
+ * Deeper samples (16-bit PNG) are reduced to 8 bits, as IMREAD_COLOR did.
+ *
+ * @param data   Encoded image bytes
+ * @param size   Number of bytes at data
+ * @param image  Receives the decoded image; its buffer is reused when the
+ *               size and type match (see FramePool)
+ * @param source Optional; receives the input's format parameters and
+ *               metadata (see read_source_format()) when the encoder
+ *               settings preserve them, for encode_image()
+ * @return       True if successful
+ */
+bool decode_image(const unsigned char* data, size_t size, cv::Mat& image,
+                  SourceFormat* source = nullptr);
+
+/**
+ * Load an image file for processing (see decode_image())
+ *
+ * @param input_path   Input image path
+ * @return             Decoded image (empty on failure)
+ */
+cv::Mat load_image(const std::filesystem::path& input_path);
+
+/**
+ * Load an image file into an existing frame
+ *
+ * The frame's buffer is reused when the decoded image has the same size
+ * and type (see FramePool), so repeated loads of same-sized images do not
+ * allocate.
+ *
+ * @param input_path   Input image path
+ * @param image        Receives the decoded image (empty on failure)
+ * @param source       Optional; receives the input's format (see decode_image())
+ * @return             True if successful
+ */
+bool load_image(const std::filesystem::path& input_path, cv::Mat& image,
+                SourceFormat* source = nullptr);
+
+/**
+ * Get the OpenCV encoder parameters used for an output path (chosen by
+ * extension), from the process-wide encoder_settings()
+ */
+std::vector<int> get_encode_params(const std::filesystem::path& output_path);
+
+/**
+ * Encode an image in the format implied by the output path's extension
+ *
+ * @param output_path  Output path (only the extension is used)
+ * @param image        Image to encode
+ * @param buffer       Receives the encoded bytes
+ * @param source       Optional format of the input the image was decoded
+ *                     from (see encode_image_as())
+ * @return             True if successful
+ */
+bool encode_image(
+    const std::filesystem::path& output_path,
+    const cv::Mat& image,
+    std::vector<unsigned char>& buffer,
+    const SourceFormat* source = nullptr
+);
+
+/**
+ * Encode an image in the format named by an extension (".png", "jpg", ...)
+ *
+ * Uses the same encoder parameters as get_encode_params().
+ */
+bool encode_image_as(
+    const std::string& ext,
+    const cv::Mat& image,
+    std::vector<unsigned char>& buffer,
+    const SourceFormat* source = nullptr
+);
+
+/**
+ * Encode an image with explicit encoder settings
+ *
+ * A WebP method other than 4 goes through libwebp when the build has it
+ * (OpenCV always uses 4) and is ignored otherwise. JPEG subsampling needs
+ * OpenCV 4.6+. With --stats, encode time and output size are recorded
+ * per profile and format (see record_encode()).
+ *
+ * With a source and settings.preserve_source, the settings are adjusted
+ * to the input (settings_for_source()) and its ICC profile and EXIF are
+ * carried into JPEG and PNG output (embed_source_metadata()).
+ */
+bool encode_image_as(
+    const std::string& ext,
+    const cv::Mat& image,
+    std::vector<unsigned char>& buffer,
+    const EncoderSettings& settings,
+    const SourceFormat* source = nullptr
+);
+
+/**
+ * Identify an encoded image from its signature bytes
+ *
+ * @return  ".png", ".jpg", ".webp", ".bmp", or an empty string if unknown
+ */
+std::string detect_image_extension(const unsigned char* data, size_t size);
+
+/**
+ * Write encoded bytes to a file, creating the output directory if needed
+ *
+ * The file is replaced atomically and synced before this returns (see
+ * replace_file() in output_writer.hpp), so overwriting an input in place
+ * cannot leave it truncated. Batch runs use OutputWriter instead, which
+ * batches the syncs on a separate thread.
+ *
+ * @param output_path  Output file path
+ * @param buffer       Encoded image bytes
+ * @return             True if successful
+ */
+bool write_file(
+    const std::filesystem::path& output_path,
+    const std::vector<unsigned char>& buffer
+);
+
+/**
+ * Try the format-specific fast paths that patch only the watermark area
+ *
+ * Currently: JPEG -> JPEG via DCT-domain patching (see jpeg_patch.hpp),
+ * PNG -> PNG via partial zlib re-encoding (see png_patch.hpp).
+ *
+ * @return  True if the output was written; false if no fast path applies
+ *          (the caller should fall back to a full decode/encode)
+ */
+bool try_patch_image(
+    const std::filesystem::path& input_path,
+    const std::filesystem::path& output_path,
+    bool remove,
+    const WatermarkEngine& engine,
+    std::optional<WatermarkSize> force_size = std::nullopt
+);
+
+/**
+ * try_patch_image() without the write
+ *
+ * @param output  Receives the patched file for output_path
+ * @return        True if a fast path applied and produced output
+ */
+bool try_patch_image(
+    const std::filesystem::path& input_path,
+    const std::filesystem::path& output_path,
+    std::vector<unsigned char>& output,
+    bool remove,
+    const WatermarkEngine& engine,
+    std::optional<WatermarkSize> force_size = std::nullopt
+);
+
+/**
+ * try_patch_image() on an input already in memory
+ *
+ * @param data        Contents of input_path
+ * @param size        Number of bytes at data
+ * @param input_path  Where data came from (selects the fast path, labels logs)
+ */
+bool try_patch_image(
+    const unsigned char* data,
+    size_t size,
+    const std::filesystem::path& input_path,
+    const std::filesystem::path& output_path,
+    std::vector<unsigned char>& output,
+    bool remove,
+    const WatermarkEngine& engine,
+    std::optional<WatermarkSize> force_size = std::nullopt
+);
+
+/**
+ * Process an encoded image entirely in memory
+ *
+ * Same pipeline as process_image() (including the JPEG/PNG patch fast
+ * paths) without touching the filesystem.
+ *
+ * @param input       Encoded input image
+ * @param output_ext  Output format as an extension; empty keeps the input format
+ * @param output      Receives the encoded result
+ * @return            True if successful
+ */
+bool process_image_buffer(
+    const std::vector<unsigned char>& input,
+    const std::string& output_ext,
+    std::vector<unsigned char>& output,
+    bool remove,
+    const WatermarkEngine& engine,
+    std::optional<WatermarkSize> force_size = std::nullopt
+);
+
+/**
+ * Process an encoded image in caller-owned memory (see above), without
+ * copying it first
+ *
+ * @param data           Encoded input image
+ * @param size           Number of bytes at data
+ * @param decode_failed  If set, receives whether a failure was the input
+ *                       not decoding (as opposed to processing or encoding)
+ */
+bool process_image_buffer(
+    const unsigned char* data,
+    size_t size,
+    const std::string& output_ext,
+    std::vector<unsigned char>& output,
+    bool remove,
+    const WatermarkEngine& engine,
+    std::optional<WatermarkSize> force_size = std::nullopt,
+    bool* decode_failed = nullptr
+);
+
+/**
+ * Copy an encoded image into output_ext without processing it
+ *
+ * For inputs --skip-clean leaves alone when an output must still be
+ * produced (streams, --serve): the bytes are passed through if the format
+ * does not change, otherwise the image is decoded and re-encoded as is.
+ *
+ * @param output_ext  Output format as an extension; empty keeps the input format
+ * @return            False if the input cannot be decoded or encoded
+ */
+bool convert_image_buffer(
+    const unsigned char* data,
+    size_t size,
+    const std::string& output_ext,
+    std::vector<unsigned char>& output
+);
+
+/**
+ * Process a single image file into memory
+ *
+ * Everything process_image() does except the write: output receives the
+ * encoded file for output_path (format from its extension), for callers
+ * that store outputs themselves (see OutputWriter). Errors are logged.
+ *
+ * @param output   Receives the encoded result
+ * @param patched  If set, receives whether a patch fast path was used
+ * @return         True if successful
+ */
+bool process_image_to_buffer(
+    const std::filesystem::path& input_path,
+    const std::filesystem::path& output_path,
+    std::vector<unsigned char>& output,
+    bool remove,
+    const WatermarkEngine& engine,
+    std::optional<WatermarkSize> force_size = std::nullopt,
+    bool* patched = nullptr
+);
+
 /**
  * Process a single image file
  *
+ * The decoded frame and the encoder output are kept per thread and reused
+ * by the next call on the same thread, so batch workers do not allocate
+ * them per image. A thread keeps the buffers of the largest image it has
+ * processed until it exits.
+ *
  * @param input_path   Input image path
  * @param output_path  Output image path
  * @param remove       Remove watermark (true) or add watermark (false)
- * @param engine       The watermark engine to use
+ * @param engine       The watermark engine to use (thread-safe, shared)
  * @return             True if successful
  */
 bool process_image(
     const std::filesystem::path& input_path,
     const std::filesystem::path& output_path,
     bool remove,
-    WatermarkEngine& engine,
+    const WatermarkEngine& engine,
     std::optional<WatermarkSize> force_size = std::nullopt
 );
 
@@ -0,0 +1,172 @@
+/**
+ * @file    test_blend_kernels.cpp
+ * @brief   Gemini Watermark Tool - Blend Kernel Tests
+ * @author  AllenK (Kwyshell)
+ * @date    2026.10.18
+ * @license MIT
+ *
+ * @details
+ * Every row kernel this CPU runs must be bit-identical to
+ * blend_row_scalar(), including the loop tails (odd lengths), saturation
+ * on both ends and exact .5 results. apply_blend_table() is checked
+ * against the blend formulas evaluated per pixel, for gray, BGR and BGRA.
+ *
+ * @see https://github.com/allenk/GeminiWatermarkTool
+ */
+
+#include "test_common.hpp"
+
+#include "blend_kernels.hpp"
+#include "blend_modes.hpp"
+
+#include <opencv2/core.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+namespace {
+
+constexpr int32_t kOne = 1 << gwt::kBlendShift;
+constexpr int32_t kHalf = kOne / 2;
+
+// Random factors in the range make_blend_table() produces (scale up to
+// 100 for removal, 255 * scale + offset within int32), with a share of
+// identity samples and of exact ties
+void random_row(std::mt19937& rng, std::vector<uint8_t>& pixels,
+                std::vector<int32_t>& scale, std::vector<int32_t>& offset) {
+    std::uniform_int_distribution<int> byte(0, 255);
+    std::uniform_int_distribution<int32_t> scale_dist(0, 100 * kOne);
+    std::uniform_int_distribution<int> kind(0, 3);
+
+    for (size_t i = 0; i < pixels.size(); ++i) {
+        pixels[i] = static_cast<uint8_t>(byte(rng));
+        switch (kind(rng)) {
+            case 0:     // Identity (outside the logo)
+                scale[i] = kOne;
+                offset[i] = kHalf;
+                break;
+            case 1:     // in * 0.5 + k + 0.5: odd inputs land exactly on .5
+                scale[i] = kHalf;
+                offset[i] = kHalf + std::uniform_int_distribution<int32_t>(-200, 200)(rng) * kOne;
+                break;
+            default: {
+                scale[i] = scale_dist(rng);
+                const int32_t low = -255 * std::min(scale[i], 100 * kOne);
+                offset[i] = std::uniform_int_distribution<int32_t>(low, 255 * kOne)(rng) + kHalf;
+                break;
+            }
+        }
+    }
+}
+
+void test_kernels_match_scalar() {
+    std::mt19937 rng(20261018);
+    const size_t lengths[] = {0, 1, 3, 7, 15, 16, 17, 31, 33, 63, 64, 65, 127, 144, 255, 288, 1001};
+
+    for (gwt::BlendKernel kernel : {gwt::BlendKernel::SSE41, gwt::BlendKernel::AVX2,
+                                    gwt::BlendKernel::AVX512, gwt::BlendKernel::NEON}) {
+        const gwt::BlendRowFn fn = gwt::get_blend_kernel(kernel);
+        if (fn == nullptr) {
+            std::printf("%s: not available, skipped\n", gwt::blend_kernel_name(kernel));
+            continue;
+        }
+        std::printf("%s: checking\n", gwt::blend_kernel_name(kernel));
+
+        for (int round = 0; round < 200; ++round) {
+            for (size_t length : lengths) {
+                std::vector<uint8_t> pixels(length);
+                std::vector<int32_t> scale(length), offset(length);
+                random_row(rng, pixels, scale, offset);
+
+                std::vector<uint8_t> expected = pixels;
+                gwt::blend_row_scalar(expected.data(), scale.data(), offset.data(), length);
+                fn(pixels.data(), scale.data(), offset.data(), length);
+                CHECK(pixels == expected);
+            }
+        }
+    }
+}
+
+// Per pixel, as make_blend_table() defines it: the float formula turned
+// into Q16 factors, then out = saturate((in * scale + offset) >> 16)
+uint8_t reference_sample(uint8_t value, float alpha_value, gwt::BlendDirection direction, float logo) {
+    double alpha = alpha_value;
+    double scale = 1.0;
+    double offset = 0.0;
+    if (alpha >= 0.002f) {
+        if (direction == gwt::BlendDirection::Remove) {
+            alpha = std::min(alpha, double(0.99f));
+            scale = 1.0 / (1.0 - alpha);
+            offset = -alpha * logo * scale;
+        } else {
+            scale = 1.0 - alpha;
+            offset = alpha * logo;
+        }
+    }
+    const int64_t q_scale = std::lround(scale * kOne);
+    const int64_t q_offset = std::lround(offset * kOne) + kHalf;
+    const int64_t out = (value * q_scale + q_offset) >> gwt::kBlendShift;
+    return static_cast<uint8_t>(std::clamp<int64_t>(out, 0, 255));
+}
+
+void test_apply_blend_table() {
+    cv::Mat alpha(48, 48, CV_32FC1);
+    cv::randu(alpha, cv::Scalar(0.0), cv::Scalar(1.0));
+    alpha(cv::Rect(0, 0, 48, 8)).setTo(0.001f);     // Below the threshold: unchanged
+
+    const cv::Point positions[] = {{16, 20}, {-10, -5}, {70, 60}};
+
+    for (int channels : {1, 3, 4}) {
+        for (gwt::BlendDirection direction : {gwt::BlendDirection::Remove, gwt::BlendDirection::Add}) {
+            const float logo = 255.0f;
+            const gwt::BlendTable table = gwt::make_blend_table(alpha, direction, logo, channels);
+
+            for (const cv::Point& position : positions) {
+                cv::Mat image(100, 96, CV_8UC(channels));
+                cv::randu(image, cv::Scalar::all(0), cv::Scalar::all(256));
+                const cv::Mat original = image.clone();
+
+                gwt::apply_blend_table(image, table, position);
+
+                for (int y = 0; y < image.rows; ++y) {
+                    const uint8_t* in = original.ptr<uint8_t>(y);
+                    const uint8_t* out = image.ptr<uint8_t>(y);
+                    for (int x = 0; x < image.cols; ++x) {
+                        const int ax = x - position.x;
+                        const int ay = y - position.y;
+                        const bool inside = ax >= 0 && ay >= 0 && ax < alpha.cols && ay < alpha.rows;
+                        for (int c = 0; c < channels; ++c) {
+                            const size_t i = size_t(x) * channels + c;
+                            // Outside the logo, and the alpha channel, pass through
+                            const uint8_t expected = inside && c < 3
+                                ? reference_sample(in[i], alpha.at<float>(ay, ax), direction, logo)
+                                : in[i];
+                            if (out[i] != expected) {
+                                std::fprintf(stderr, "channels=%d %s at (%d,%d,%d): %d != %d\n",
+                                             channels, direction == gwt::BlendDirection::Remove ? "remove" : "add",
+                                             x, y, c, out[i], expected);
+                                ++g_failures;
+                                return;
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+} // namespace
+
+int main() {
+    std::printf("Best kernel: %s\n", gwt::blend_kernel_name(gwt::best_blend_kernel()));
+
+    test_kernels_match_scalar();
+    test_apply_blend_table();
+
+    return test_exit_code();
+}
@@ -0,0 +1,37 @@
+/**
+ * @file    test_common.hpp
+ * @brief   Gemini Watermark Tool - Shared Test Helpers
+ * @author  AllenK (Kwyshell)
+ * @date    2026.10.18
+ * @license MIT
+ *
+ * @details
+ * The tests are plain executables run by ctest: CHECK() reports a failed
+ * condition and keeps going, and main() returns test_exit_code() so any
+ * failure fails the test.
+ *
+ * @see https://github.com/allenk/GeminiWatermarkTool
+ */
+
+#pragma once
+
+#include <cstdio>
+
+inline int g_failures = 0;
+
+#define CHECK(cond)                                                             \
+    do {                                                                        \
+        if (!(cond)) {                                                          \
+            std::fprintf(stderr, "%s:%d: CHECK failed: %s\n", __FILE__, __LINE__, #cond); \
+            ++g_failures;                                                       \
+        }                                                                       \
+    } while (0)
+
+// Print the failure count, if any, and return the process exit code
+inline int test_exit_code() {
+    if (g_failures > 0) {
+        std::fprintf(stderr, "%d check(s) failed\n", g_failures);
+        return 1;
+    }
+    return 0;
+}
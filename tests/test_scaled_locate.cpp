@@ -0,0 +1,198 @@
+/**
+ * @file    test_scaled_locate.cpp
+ * @brief   Gemini Watermark Tool - Scaled Watermark Search Tests
+ * @author  AllenK (Kwyshell)
+ * @date    2026.10.18
+ * @license MIT
+ *
+ * @details
+ * resample_alpha_map() must keep the map's mass and put it at the requested
+ * sub-pixel phase. locate_watermark() with scale search must find the logo
+ * of a watermarked image resized afterwards, at the resized logo's size and
+ * position, and must not accept a scaled match on a clean image.
+ *
+ * @see https://github.com/allenk/GeminiWatermarkTool
+ */
+
+#include "test_common.hpp"
+
+#include "blend_modes.hpp"
+#include "watermark_engine.hpp"
+
+#include <opencv2/core.hpp>
+#include <opencv2/imgproc.hpp>
+#include <spdlog/spdlog.h>
+
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <optional>
+
+namespace {
+
+// Gemini's 96 px layout: the logo starts 64 + 96 px from the right and bottom
+constexpr double kLargeLogo = 96.0;
+constexpr double kLargeOffset = 160.0;
+
+// Maximum scaled-match confidence a clean image may reach (see
+// WatermarkEngine::locate_watermark())
+constexpr double kScaledMinConfidence = 0.4;
+
+/**
+ * Diagonal gradient plus fine deterministic texture, so the detector sees
+ * gradients everywhere rather than only at the logo
+ */
+cv::Mat make_image(int size, unsigned seed) {
+    cv::Mat image(size, size, CV_8UC3);
+    uint32_t state = seed;
+    auto grain = [&state] {
+        state = state * 1664525u + 1013904223u;  // LCG: same image on every platform
+        return static_cast<int>(state >> 28);    // 0..15
+    };
+
+    for (int y = 0; y < size; ++y) {
+        auto* row = image.ptr<cv::Vec3b>(y);
+        for (int x = 0; x < size; ++x) {
+            const int t = (x + y) * 160 / (2 * size);
+            row[x][0] = cv::saturate_cast<uchar>(40 + t + grain());
+            row[x][1] = cv::saturate_cast<uchar>(70 + t / 2 + grain());
+            row[x][2] = cv::saturate_cast<uchar>(180 - t + grain());
+        }
+    }
+    return image;
+}
+
+cv::Mat resize_to(const cv::Mat& image, int size) {
+    cv::Mat resized;
+    cv::resize(image, resized, cv::Size(size, size), 0, 0, cv::INTER_AREA);
+    return resized;
+}
+
+// Locate the watermark from the crop the region paths would decode
+gwt::WatermarkMatch locate(const gwt::WatermarkEngine& engine, const cv::Mat& image) {
+    const cv::Rect rect = engine.get_processing_rect(image.size()) &
+                          cv::Rect(0, 0, image.cols, image.rows);
+    return engine.locate_watermark(image(rect), rect, image.size());
+}
+
+// Centroid of a CV_32FC1 map in pixel units (pixel i spans [i, i + 1))
+cv::Point2d centroid(const cv::Mat& map) {
+    double mass = 0.0, cx = 0.0, cy = 0.0;
+    for (int y = 0; y < map.rows; ++y) {
+        const float* row = map.ptr<float>(y);
+        for (int x = 0; x < map.cols; ++x) {
+            mass += row[x];
+            cx += row[x] * (x + 0.5);
+            cy += row[x] * (y + 0.5);
+        }
+    }
+    return cv::Point2d(cx / mass, cy / mass);
+}
+
+void test_resample_alpha_map() {
+    // Off-center blob, so a wrong phase or scale moves the centroid
+    cv::Mat alpha(96, 96, CV_32FC1);
+    for (int y = 0; y < alpha.rows; ++y) {
+        for (int x = 0; x < alpha.cols; ++x) {
+            const double dx = x + 0.5 - 40.0, dy = y + 0.5 - 52.0;
+            alpha.at<float>(y, x) = static_cast<float>(0.5 * std::exp(-(dx * dx + dy * dy) / 300.0));
+        }
+    }
+    const double mass = cv::sum(alpha)[0];
+    const cv::Point2d center = centroid(alpha);
+
+    // Same size, no phase: the map itself
+    const cv::Mat same = gwt::resample_alpha_map(alpha, cv::Size2d(96.0, 96.0));
+    CHECK(same.size() == alpha.size());
+    CHECK(cv::norm(same, alpha, cv::NORM_INF) < 1e-4);
+
+    const struct { cv::Size2d size; cv::Point2d phase; } cases[] = {
+        {{48.0, 48.0}, {0.0, 0.0}},
+        {{72.0, 72.0}, {0.25, 0.75}},
+        {{63.36, 63.36}, {0.4, 0.4}},
+        {{40.5, 57.0}, {0.9, 0.1}},     // Aspect ratio changed
+        {{128.0, 128.0}, {0.5, 0.5}},   // Upscaled
+    };
+    for (const auto& c : cases) {
+        const cv::Mat resampled = gwt::resample_alpha_map(alpha, c.size, c.phase);
+        const double sx = c.size.width / alpha.cols;
+        const double sy = c.size.height / alpha.rows;
+
+        CHECK(resampled.type() == CV_32FC1);
+        CHECK(resampled.cols == static_cast<int>(std::ceil(c.phase.x + c.size.width - 1e-6)));
+        CHECK(resampled.rows == static_cast<int>(std::ceil(c.phase.y + c.size.height - 1e-6)));
+
+        // Box filtering keeps the mass, scaled by the area ratio
+        CHECK(std::abs(cv::sum(resampled)[0] / (mass * sx * sy) - 1.0) < 0.02);
+
+        const cv::Point2d moved = centroid(resampled);
+        CHECK(std::abs(moved.x - (c.phase.x + center.x * sx)) < 0.1);
+        CHECK(std::abs(moved.y - (c.phase.y + center.y * sy)) < 0.1);
+    }
+}
+
+void test_locate_resized(const gwt::WatermarkEngine& engine,
+                         const gwt::WatermarkEngine& scaling,
+                         int source_size, int resized_size) {
+    std::printf("locate %d -> %d\n", source_size, resized_size);
+
+    cv::Mat image = make_image(source_size, static_cast<unsigned>(source_size));
+    engine.add_watermark(image, gwt::WatermarkSize::Large);
+    const cv::Mat resized = resize_to(image, resized_size);
+
+    // Where the 96 px logo ends up, in resized pixels
+    const double scale = static_cast<double>(resized_size) / source_size;
+    const double logo = kLargeLogo * scale;
+    const double origin = (source_size - kLargeOffset) * scale;
+
+    const gwt::WatermarkMatch match = locate(scaling, resized);
+    std::printf("  rect (%d, %d) %dx%d, confidence %.3f, expected (%.2f, %.2f) %.2fx%.2f\n",
+                match.rect.x, match.rect.y, match.rect.width, match.rect.height,
+                match.confidence, origin, origin, logo, logo);
+
+    CHECK(match.confidence >= kScaledMinConfidence);
+    CHECK(std::abs(match.rect.x - std::floor(origin)) <= 1.0);
+    CHECK(std::abs(match.rect.y - std::floor(origin)) <= 1.0);
+    CHECK(std::abs(match.rect.width - logo) <= 2.0);
+    CHECK(std::abs(match.rect.height - logo) <= 2.0);
+    if (!match.alpha_map.empty()) {
+        CHECK(match.alpha_map.size() == match.rect.size());
+    }
+
+    // Off the standard layout only the resampled map fits
+    if (std::abs(logo - 48.0) > 2.0) {
+        CHECK(!match.alpha_map.empty());
+    }
+}
+
+void test_clean_stays_clean(const gwt::WatermarkEngine& scaling, int source_size, int resized_size) {
+    const cv::Mat clean = resize_to(make_image(source_size, 7u), resized_size);
+    const gwt::WatermarkMatch match = locate(scaling, clean);
+    std::printf("clean %d -> %d: confidence %.3f\n", source_size, resized_size, match.confidence);
+
+    CHECK(match.alpha_map.empty());
+    CHECK(match.confidence < kScaledMinConfidence);
+}
+
+} // namespace
+
+int main() {
+    spdlog::set_level(spdlog::level::warn);
+
+    const gwt::WatermarkEngine engine;
+    gwt::WatermarkEngine scaling;
+    scaling.set_search_radius(gwt::kDefaultSearchRadius);
+    scaling.set_scale_search(true);
+
+    test_resample_alpha_map();
+
+    test_locate_resized(engine, scaling, 2048, 1024);   // 0.5x: lands on the 48 px layout
+    test_locate_resized(engine, scaling, 2048, 1536);   // 0.75x: 72 px logo
+    test_locate_resized(engine, scaling, 2000, 1320);   // 0.66x: 63.36 px at a sub-pixel origin
+
+    test_clean_stays_clean(scaling, 2048, 2048);
+    test_clean_stays_clean(scaling, 2048, 1536);
+    test_clean_stays_clean(scaling, 2000, 1320);
+
+    return test_exit_code();
+}
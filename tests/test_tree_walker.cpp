@@ -0,0 +1,180 @@
+/**
+ * @file    test_tree_walker.cpp
+ * @brief   Gemini Watermark Tool - Directory Walk Tests
+ * @author  AllenK (Kwyshell)
+ * @date    2026.10.18
+ * @license MIT
+ *
+ * @details
+ * The walk submits pool tasks from inside pool tasks, and the recursive
+ * batch submits a processing task per file from the listing tasks; both
+ * rely on ThreadPool::wait() not returning while a task can still submit.
+ * A deep tree keeps listing tasks in flight for the whole walk, which is
+ * where an early return drops files (or touches a finished batch).
+ *
+ * @see https://github.com/allenk/GeminiWatermarkTool
+ */
+
+#include "test_common.hpp"
+
+#include "batch_runner.hpp"
+#include "thread_pool.hpp"
+#include "tree_walker.hpp"
+#include "watermark_engine.hpp"
+
+#include <opencv2/core.hpp>
+#include <opencv2/imgcodecs.hpp>
+#include <spdlog/spdlog.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <random>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+namespace {
+
+// Removes its directory when the test ends
+struct TempDir {
+    fs::path path;
+
+    TempDir() {
+        std::random_device rd;
+        path = fs::temp_directory_path() / ("gwt_test_tree_walker_" + std::to_string(rd()));
+        fs::create_directories(path);
+    }
+    ~TempDir() {
+        std::error_code ec;
+        fs::remove_all(path, ec);
+    }
+};
+
+// A chain of depth directories, each with `width` files and a sibling
+// leaf directory; returns the relative paths of all files
+std::vector<fs::path> make_deep_tree(const fs::path& root, int depth, int width,
+                                     const std::vector<unsigned char>& content) {
+    std::vector<fs::path> files;
+    fs::path dir;
+    for (int level = 0; level < depth; ++level) {
+        dir /= "d" + std::to_string(level);
+        for (const fs::path& sub : {dir, dir.parent_path() / ("leaf" + std::to_string(level))}) {
+            fs::create_directories(root / sub);
+            for (int i = 0; i < width; ++i) {
+                const fs::path file = sub / ("img" + std::to_string(i) + ".png");
+                std::ofstream(root / file, std::ios::binary)
+                    .write(reinterpret_cast<const char*>(content.data()), content.size());
+                files.push_back(file);
+            }
+        }
+    }
+    return files;
+}
+
+// Files found by a walk are processed by tasks submitted from the listing
+// task, as run_batch() does; wait() must cover all of them
+void test_walk_processes_every_file() {
+    TempDir tmp;
+    const std::vector<fs::path> files = make_deep_tree(tmp.path, 48, 4, {0});
+
+    for (int round = 0; round < 400; ++round) {
+        std::mutex mutex;
+        std::set<fs::path> seen;
+        std::atomic<size_t> processed{0};
+        {
+            gwt::ThreadPool pool(8);
+            gwt::walk_tree(pool, tmp.path, {}, [&](const fs::path& path, size_t) {
+                pool.submit([&, path](size_t) {
+                    {
+                        std::lock_guard<std::mutex> lock(mutex);
+                        seen.insert(path.lexically_relative(tmp.path));
+                    }
+                    processed++;
+                });
+            });
+            pool.wait();
+
+            // Read before the pool (and its workers) go away: anything that
+            // lands after wait() is a task that outlived it
+            CHECK(processed.load() == files.size());
+            std::lock_guard<std::mutex> lock(mutex);
+            CHECK(seen == std::set<fs::path>(files.begin(), files.end()));
+        }
+    }
+}
+
+// wait() covers a task's captures too: the last copy of on_file (or of
+// anything it holds) may be released by a worker's finished task
+void test_wait_outlives_captures() {
+    TempDir tmp;
+    make_deep_tree(tmp.path, 16, 4, {0});
+
+    // Counts live copies; slow to destroy, to widen the window
+    struct Guard {
+        std::atomic<int>* live;
+        explicit Guard(std::atomic<int>* l) : live(l) { ++*live; }
+        Guard(const Guard& other) : live(other.live) { ++*live; }
+        ~Guard() {
+            std::this_thread::sleep_for(std::chrono::microseconds(20));
+            --*live;
+        }
+    };
+
+    for (int round = 0; round < 200; ++round) {
+        std::atomic<int> live{0};
+        gwt::ThreadPool pool(8);
+        {
+            const Guard guard(&live);
+            gwt::walk_tree(pool, tmp.path, {}, [&, guard](const fs::path&, size_t) {
+                pool.submit([guard](size_t) {});
+            });
+        }
+        pool.wait();
+        CHECK(live.load() == 0);
+    }
+}
+
+// End to end: every image of a deep tree is written, mirrored under the
+// output directory, on both the pool and the pipeline path
+void test_recursive_batch_processes_every_file(bool pipeline) {
+    TempDir tmp;
+    const fs::path input = tmp.path / "in";
+    const fs::path output = tmp.path / "out";
+
+    std::vector<unsigned char> png;
+    cv::imencode(".png", cv::Mat(256, 256, CV_8UC3, cv::Scalar(40, 80, 120)), png);
+    const std::vector<fs::path> files = make_deep_tree(input, 24, 3, png);
+
+    gwt::WatermarkEngine engine;
+    gwt::BatchOptions options;
+    options.jobs = 8;
+    options.recursive = true;
+    options.pipeline = pipeline;
+
+    const gwt::BatchResult result = gwt::run_batch(input, output, false, engine, options);
+    CHECK(result.succeeded == files.size());
+    CHECK(result.failed == 0);
+    for (const fs::path& file : files) {
+        CHECK(fs::exists(output / file));
+    }
+}
+
+} // namespace
+
+int main() {
+    spdlog::set_level(spdlog::level::warn);
+
+    test_walk_processes_every_file();
+    test_wait_outlives_captures();
+    test_recursive_batch_processes_every_file(false);
+    test_recursive_batch_processes_every_file(true);
+
+    return test_exit_code();
+}
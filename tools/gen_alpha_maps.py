@@ -0,0 +1,216 @@
+#!/usr/bin/env python3
+"""
+Generate assets/embedded_alpha_maps.hpp from the captures embedded in
+assets/embedded_assets.hpp.
+
+The output holds what WatermarkEngine used to derive at startup: the CV_32FC1
+alpha maps (calculate_alpha_map) and the per-pixel Q16 blend factors for the
+default white logo (make_blend_table). Values are computed exactly as the C++
+code computes them, so engines built from the header and from the PNGs are
+bit-identical.
+
+Standard library only, so it can run at configure time on any build host.
+
+Usage: gen_alpha_maps.py <embedded_assets.hpp> <embedded_alpha_maps.hpp>
+"""
+
+import math
+import re
+import struct
+import sys
+import zlib
+
+# Must match blend_modes.hpp / blend_modes.cpp
+BLEND_SHIFT = 16
+ALPHA_THRESHOLD = 0.002
+MAX_ALPHA = 0.99
+LOGO_VALUE = 255.0
+
+CAPTURES = (("bg_48_png", 48), ("bg_96_png", 96))
+
+
+def f32(value):
+    """Round a Python float (double) to the nearest float32."""
+    return struct.unpack("<f", struct.pack("<f", value))[0]
+
+
+def lround(value):
+    """std::lround: round half away from zero."""
+    return int(math.floor(value + 0.5)) if value >= 0 else -int(math.floor(-value + 0.5))
+
+
+def float_literal(value):
+    text = "%.9g" % value
+    if not any(c in text for c in ".en"):
+        text += ".0"
+    return text + "f"
+
+
+def read_embedded(header, name):
+    match = re.search(r"\b%s\[\]\s*=\s*\{([^}]*)\}" % re.escape(name), header)
+    if not match:
+        sys.exit("gen_alpha_maps: %s not found" % name)
+    return bytes(int(tok, 16) for tok in re.findall(r"0x[0-9a-fA-F]{2}", match.group(1)))
+
+
+def paeth(a, b, c):
+    p = a + b - c
+    pa, pb, pc = abs(p - a), abs(p - b), abs(p - c)
+    if pa <= pb and pa <= pc:
+        return a
+    return b if pb <= pc else c
+
+
+def decode_png(data, name):
+    """Decode an 8-bit, non-interlaced gray/RGB/RGBA PNG into rows of pixels."""
+    if data[:8] != b"\x89PNG\r\n\x1a\n":
+        sys.exit("gen_alpha_maps: %s is not a PNG" % name)
+
+    pos = 8
+    idat = b""
+    width = height = channels = None
+    while pos < len(data):
+        length, kind = struct.unpack(">I4s", data[pos:pos + 8])
+        body = data[pos + 8:pos + 8 + length]
+        pos += 12 + length
+        if kind == b"IHDR":
+            width, height, depth, color, _, _, interlace = struct.unpack(">IIBBBBB", body)
+            channels = {0: 1, 2: 3, 6: 4}.get(color)
+            if depth != 8 or channels is None or interlace != 0:
+                sys.exit("gen_alpha_maps: %s must be 8-bit non-interlaced gray, RGB or RGBA" % name)
+        elif kind == b"IDAT":
+            idat += body
+        elif kind == b"IEND":
+            break
+
+    raw = zlib.decompress(idat)
+    stride = width * channels
+    rows = []
+    prev = bytearray(stride)
+    for y in range(height):
+        start = y * (stride + 1)
+        kind = raw[start]
+        row = bytearray(raw[start + 1:start + 1 + stride])
+        for i in range(stride):
+            left = row[i - channels] if i >= channels else 0
+            up = prev[i]
+            up_left = prev[i - channels] if i >= channels else 0
+            if kind == 1:
+                row[i] = (row[i] + left) & 0xFF
+            elif kind == 2:
+                row[i] = (row[i] + up) & 0xFF
+            elif kind == 3:
+                row[i] = (row[i] + ((left + up) >> 1)) & 0xFF
+            elif kind == 4:
+                row[i] = (row[i] + paeth(left, up, up_left)) & 0xFF
+            elif kind != 0:
+                sys.exit("gen_alpha_maps: %s has bad filter type %d" % (name, kind))
+        rows.append([row[x * channels:x * channels + channels] for x in range(width)])
+        prev = row
+    return width, height, rows
+
+
+def alpha_map(rows):
+    # calculate_alpha_map(): max of the color samples, convertTo(CV_32F, 1/255)
+    # (OpenCV scales in single precision)
+    scale = f32(1.0 / 255.0)
+    return [f32(float(max(px[:3])) * scale) for row in rows for px in row]
+
+
+def blend_factors(alpha, remove):
+    # make_blend_table() per pixel, rounding term folded into the offset
+    one = float(1 << BLEND_SHIFT)
+    bias = 1 << (BLEND_SHIFT - 1)
+    scales, offsets = [], []
+    for a in alpha:
+        scale, offset = 1.0, 0.0
+        if a >= f32(ALPHA_THRESHOLD):
+            if remove:
+                a = min(a, f32(MAX_ALPHA))
+                scale = 1.0 / (1.0 - a)
+                offset = -a * LOGO_VALUE * scale
+            else:
+                scale = 1.0 - a
+                offset = a * LOGO_VALUE
+        scales.append(lround(scale * one))
+        offsets.append(lround(offset * one) + bias)
+    return scales, offsets
+
+
+def emit_array(out, decl, values, fmt, per_line):
+    out.append("%s = {" % decl)
+    for i in range(0, len(values), per_line):
+        out.append("    " + ", ".join(fmt(v) for v in values[i:i + per_line]) + ",")
+    out.append("};")
+    out.append("")
+
+
+def main():
+    if len(sys.argv) != 3:
+        sys.exit(__doc__.strip().splitlines()[-1])
+
+    with open(sys.argv[1], "r", encoding="utf-8") as f:
+        header = f.read()
+
+    out = [
+        "#pragma once",
+        "",
+        "/**",
+        " * Embedded Alpha Maps",
+        " *",
+        " * Generated by tools/gen_alpha_maps.py from embedded_assets.hpp. Do not edit.",
+        " *",
+        " * The alpha maps are calculate_alpha_map() of the embedded captures",
+        " * (row-major CV_32FC1); the blend factors are the per-pixel Q16 scale and",
+        " * offset make_blend_table() derives from them for a white logo.",
+        " */",
+        "",
+        "#include <cstddef>",
+        "#include <cstdint>",
+        "",
+        "namespace gwt {",
+        "namespace embedded {",
+        "",
+        "// Logo value the blend factors were computed for",
+        "inline constexpr float alpha_maps_logo_value = %.1ff;" % LOGO_VALUE,
+        "",
+    ]
+
+    for name, expected in CAPTURES:
+        width, height, rows = decode_png(read_embedded(header, name), name)
+        if width != expected or height != expected:
+            sys.exit("gen_alpha_maps: %s is %dx%d, expected %dx%d"
+                     % (name, width, height, expected, expected))
+
+        alpha = alpha_map(rows)
+        n = expected
+        out.append("// alpha_map_%d (%dx%d)" % (n, n, n))
+        out.append("inline constexpr int alpha_map_%d_size = %d;" % (n, n))
+        out.append("")
+        emit_array(out, "alignas(64) inline constexpr float alpha_map_%d[%d * %d]" % (n, n, n),
+                   alpha, float_literal, 8)
+
+        for direction, remove in (("remove", True), ("add", False)):
+            scales, offsets = blend_factors(alpha, remove)
+            emit_array(out, "inline constexpr int32_t blend_%s_scale_%d[%d * %d]" % (direction, n, n, n),
+                       scales, str, 12)
+            emit_array(out, "inline constexpr int32_t blend_%s_offset_%d[%d * %d]" % (direction, n, n, n),
+                       offsets, str, 12)
+
+    out.append("} // namespace embedded")
+    out.append("} // namespace gwt")
+    out.append("")
+
+    text = "\n".join(out)
+    try:
+        with open(sys.argv[2], "r", encoding="utf-8") as f:
+            if f.read() == text:
+                return  # Unchanged: keep the timestamp so nothing rebuilds
+    except OSError:
+        pass
+    with open(sys.argv[2], "w", encoding="utf-8", newline="\n") as f:
+        f.write(text)
+
+
+if __name__ == "__main__":
+    main()